@@ -7,12 +7,49 @@
 #define FRACTIONAL_SIZE 30
 // Total chunk size = 32: 1x sign, 1x integer, 30x fractional
 #define CHUNK_SIZE (FRACTIONAL_SIZE + 2)
+// Mem::LimbCount in fractal.h: how many of the fractional limbs are actually
+// used (0 for all of them). Shallower zooms need a lot fewer.
+#define LIMB_COUNT 8
+// Variants of complexSquareAdd
+#define SQUARE_PLAIN 0
+#define SQUARE_BURNING_SHIP 1
+#define SQUARE_CELTIC 2
+#define SQUARE_TRICORN 3
+// Multiplications of at least this many limbs are split in halves first.
+#define KARATSUBA_THRESHOLD 24
+// Where LIMB_COUNT is (see MEMORY_BASE in fractal.cpp)
+#ifdef NATIVE
+extern "C" uintptr_t memoryBase;
+#define MEMORY_BASE memoryBase
+#else
+#define MEMORY_BASE 0
+#endif
 
 #define i128 __int128
 #define fill __builtin_memset
 #define memcpy __builtin_memcpy
 
 extern "C" {
+// The full 128-bit product of two limbs. WASM has no instruction for it, so
+// there it's put together from 32-bit halves instead of calling __multi3 from
+// compiler-rt (which the module doesn't have).
+static inline unsigned i128 multiplyLimbs(uint64_t a, uint64_t b) {
+#ifdef NATIVE
+  return (unsigned i128)a * b;
+#else
+  const uint64_t low = (a & 0xffffffff) * (b & 0xffffffff);
+  const uint64_t middle1 = (a >> 32) * (b & 0xffffffff);
+  const uint64_t middle2 = (a & 0xffffffff) * (b >> 32);
+  const uint64_t high = (a >> 32) * (b >> 32);
+  // The three terms of bits 32-95 can't overflow 64 bits together.
+  const uint64_t middle =
+      (low >> 32) + (middle1 & 0xffffffff) + (middle2 & 0xffffffff);
+  const uint64_t top =
+      high + (middle1 >> 32) + (middle2 >> 32) + (middle >> 32);
+  return (unsigned i128)top << 64 | (middle << 32 | (low & 0xffffffff));
+#endif
+}
+
 // Inlined sign read/write - using uint64_t now for consistency
 static inline void writeSign(uint64_t *loc, int64_t sign) {
   loc[0] = sign; // Sign is stored in the first uint64_t element
@@ -22,15 +59,23 @@ static inline void clearValue(uint64_t *valueBuffer) {
   __builtin_memcpy(valueBuffer, valueBuffer + FRACTIONAL_SIZE, 0);
 }
 
+// The number of fractional limbs every operation works with. The limbs after
+// them are ignored when reading and left alone when writing.
+static inline int fractionalSize() {
+  const uint32_t limbs =
+      *reinterpret_cast<const uint32_t *>(MEMORY_BASE + LIMB_COUNT);
+  return (limbs == 0 || limbs > FRACTIONAL_SIZE) ? FRACTIONAL_SIZE : limbs;
+}
+
 /**
  * @brief Determines if |a| >= |b|.
  * @param a Pointer to the first number.
  * @param b Pointer to the second number.
  * @return Boolean result.
  */
-static inline int isGte(const uint64_t *a, const uint64_t *b) {
+static inline int isGte(const uint64_t *a, const uint64_t *b, int n) {
   // Compare from the most significant part (integer) to the least significant.
-  for (int i = 1; i < CHUNK_SIZE; ++i) {
+  for (int i = 1; i < n + 2; ++i) {
     if (a[i] > b[i])
       return true;
     if (a[i] < b[i])
@@ -46,12 +91,13 @@ static inline int isGte(const uint64_t *a, const uint64_t *b) {
  * @param value1 Pointer to the first number.
  * @param value2 Pointer to the second number.
  * @param output Pointer to store the result.
+ * @param n Number of fractional limbs.
  */
 static inline void rawAdd(const uint64_t *value1, const uint64_t *value2,
-                          uint64_t *output) {
+                          uint64_t *output, int n) {
   uint64_t carry = 0;
   // Add fractional parts from least to most significant, propagating carry.
-  for (int i = CHUNK_SIZE - 1; i >= 2; --i) {
+  for (int i = n + 1; i >= 2; --i) {
     uint64_t sum = value1[i] + value2[i] + carry;
     // Carry is 1 if the sum wrapped around (is less than one of the addends).
     carry = (sum < value1[i]) || (carry && sum == value1[i]) ? 1 : 0;
@@ -68,13 +114,14 @@ static inline void rawAdd(const uint64_t *value1, const uint64_t *value2,
  * @param value1 Pointer to the minuend (larger number).
  * @param value2 Pointer to the subtrahend (smaller number).
  * @param output Pointer to store the result.
+ * @param n Number of fractional limbs.
  */
 static inline void rawSubtract(const uint64_t *value1, const uint64_t *value2,
-                               uint64_t *output) {
+                               uint64_t *output, int n) {
   int64_t borrow = 0;
   // Subtract fractional parts from least to most significant, propagating
   // borrow.
-  for (int i = CHUNK_SIZE - 1; i >= 2; --i) {
+  for (int i = n + 1; i >= 2; --i) {
     unsigned i128 diff = (unsigned i128)value1[i] - value2[i] - borrow;
     output[i] = (uint64_t)diff;
     // Borrow is 1 if the subtraction underflowed.
@@ -86,65 +133,187 @@ static inline void rawSubtract(const uint64_t *value1, const uint64_t *value2,
 }
 
 /**
- * @brief Multiplies an integer part by a fractional part.
- * @param output The buffer to store the full resulting number (sign is not
- * set).
- * @param integer The integer value multiplier.
- * @param fraction The fractional part multiplier.
+ * @brief Copies the integer and fractional limbs of a number in reverse, so
+ *        that the least significant limb comes first.
+ * @param value Pointer to the number.
+ * @param output The n + 1 limbs, least significant first.
+ * @param n Number of fractional limbs.
+ */
+static inline void to_little_endian(const uint64_t *value, uint64_t *output,
+                                    int n) {
+  for (int i = 0; i <= n; ++i) {
+    output[i] = value[n + 1 - i];
+  }
+}
+
+/**
+ * @brief Multiplies two little-endian limb arrays column by column (Comba),
+ *        keeping a 192-bit sum of each column instead of a whole row.
+ * @param a The first multiplier (n limbs).
+ * @param b The second multiplier (n limbs).
+ * @param output The full 2n-limb product.
+ * @param n Number of limbs.
  */
-static inline void multiply_int_frac(uint64_t *output, uint64_t integer,
-                                     const uint64_t *fraction) {
-  fill(output, 0, CHUNK_SIZE * sizeof(uint64_t));
-  unsigned i128 carry = 0;
-
-  // Multiply each fractional limb by the integer, propagating the carry.
-  for (int i = FRACTIONAL_SIZE - 1; i >= 0; --i) {
-    unsigned i128 product = (unsigned i128)integer * fraction[i] + carry;
-    output[i + 2] = (uint64_t)product; // Store the low 64 bits.
-    carry = product >> 64;             // High 64 bits are the new carry.
+static inline void comba_multiply(const uint64_t *a, const uint64_t *b,
+                                  uint64_t *output, int n) {
+  unsigned i128 sum = 0;
+  uint64_t overflow = 0;
+  for (int k = 0; k < 2 * n - 1; ++k) {
+    const int first = k < n ? 0 : k - n + 1;
+    const int last = k < n ? k : n - 1;
+    for (int i = first; i <= last; ++i) {
+      const unsigned i128 product = multiplyLimbs(a[i], b[k - i]);
+      sum += product;
+      overflow += sum < product;
+    }
+    output[k] = (uint64_t)sum;
+    sum = (sum >> 64) | ((unsigned i128)overflow << 64);
+    overflow = 0;
   }
-  output[1] = (uint64_t)carry; // The final carry becomes the integer part.
+  output[2 * n - 1] = (uint64_t)sum;
 }
 
 /**
- * @brief Multiplies two fractional parts together.
- * @param output The buffer to store the full resulting number (sign is not
- * set).
- * @param fraction1 The first fractional multiplier.
- * @param fraction2 The second fractional multiplier.
+ * @brief Squares a little-endian limb array column by column, calculating
+ *        every product of two different limbs once and doubling it.
+ * @param a The number to square (n limbs).
+ * @param output The full 2n-limb square.
+ * @param n Number of limbs.
  */
-static inline void multiply_frac_frac(uint64_t *output,
-                                      const uint64_t *fraction1,
-                                      const uint64_t *fraction2) {
-  // Use a temporary 128-bit buffer for the full 2N-limb product to prevent
-  // overflow.
-  unsigned i128 full_product[2 * FRACTIONAL_SIZE] = {0};
-  fill(output, 0, CHUNK_SIZE * sizeof(uint64_t));
-
-  // Standard schoolbook multiplication.
-  for (int i = 0; i < FRACTIONAL_SIZE; ++i) {
-    for (int j = 0; j < FRACTIONAL_SIZE; ++j) {
-      // The product of two limbs at f[i] and f[j] contributes to the result at
-      // position i+j. +1 because a fraction starts at f[0] = 2^-64, so
-      // f[i]*f[j] = 2^(-64(i+j+2)). The result index in full_product
-      // corresponds to 2^(-64*(index+1)).
-      full_product[i + j + 1] += (unsigned i128)fraction1[i] * fraction2[j];
+static inline void comba_square(const uint64_t *a, uint64_t *output, int n) {
+  unsigned i128 sum = 0;
+  uint64_t overflow = 0;
+  for (int k = 0; k < 2 * n - 1; ++k) {
+    const int first = k < n ? 0 : k - n + 1;
+    unsigned i128 cross = 0;
+    uint64_t crossOverflow = 0;
+    for (int i = first; i < k - i; ++i) {
+      const unsigned i128 product = multiplyLimbs(a[i], a[k - i]);
+      cross += product;
+      crossOverflow += cross < product;
+    }
+    // Double the products above the diagonal, then add the one on it.
+    crossOverflow = (crossOverflow << 1) | (uint64_t)(cross >> 127);
+    cross <<= 1;
+    sum += cross;
+    overflow += crossOverflow + (sum < cross);
+    if ((k & 1) == 0) {
+      const unsigned i128 product = multiplyLimbs(a[k / 2], a[k / 2]);
+      sum += product;
+      overflow += sum < product;
     }
+    output[k] = (uint64_t)sum;
+    sum = (sum >> 64) | ((unsigned i128)overflow << 64);
+    overflow = 0;
   }
+  output[2 * n - 1] = (uint64_t)sum;
+}
+
+/**
+ * @brief Adds b (nb limbs) to a (na >= nb limbs), both little-endian.
+ * @return The carry out of the last limb.
+ */
+static inline uint64_t add_limbs(uint64_t *a, int na, const uint64_t *b,
+                                 int nb) {
+  uint64_t carry = 0;
+  for (int i = 0; i < na && (i < nb || carry); ++i) {
+    const unsigned i128 sum =
+        (unsigned i128)a[i] + (i < nb ? b[i] : 0) + carry;
+    a[i] = (uint64_t)sum;
+    carry = (uint64_t)(sum >> 64);
+  }
+  return carry;
+}
+
+/**
+ * @brief Subtracts b (nb limbs) from a (na >= nb limbs), both little-endian.
+ * @note The result is only used when it is known to be positive.
+ */
+static inline void subtract_limbs(uint64_t *a, int na, const uint64_t *b,
+                                  int nb) {
+  uint64_t borrow = 0;
+  for (int i = 0; i < na && (i < nb || borrow); ++i) {
+    const unsigned i128 diff =
+        (unsigned i128)a[i] - (i < nb ? b[i] : 0) - borrow;
+    a[i] = (uint64_t)diff;
+    borrow = (uint64_t)(diff >> 64) & 1;
+  }
+}
 
-  // Propagate carries through the full product from LSB to MSB.
-  for (int i = 2 * FRACTIONAL_SIZE - 1; i > 0; --i) {
-    full_product[i - 1] += full_product[i] >> 64;
-    full_product[i] = (uint64_t)full_product[i]; // Truncate to 64 bits.
+/**
+ * @brief Multiplies two little-endian limb arrays, splitting them in halves
+ *        (Karatsuba) until they are short enough for comba_multiply:
+ *        a * b = a1*b1 B^2h + ((a0 + a1)(b0 + b1) - a0*b0 - a1*b1) B^h + a0*b0.
+ * @param a The first multiplier (n limbs).
+ * @param b The second multiplier (n limbs).
+ * @param output The full 2n-limb product.
+ * @param n Number of limbs.
+ */
+static void karatsuba_multiply(const uint64_t *a, const uint64_t *b,
+                               uint64_t *output, int n) {
+  if (n < KARATSUBA_THRESHOLD) {
+    comba_multiply(a, b, output, n);
+    return;
   }
+  const int h = n / 2;
+  const int m = n - h; // Limbs in the upper halves
+  uint64_t sumA[CHUNK_SIZE] = {0};
+  uint64_t sumB[CHUNK_SIZE] = {0};
+  uint64_t middle[2 * CHUNK_SIZE];
+  memcpy(sumA, a + h, m * sizeof(uint64_t));
+  memcpy(sumB, b + h, m * sizeof(uint64_t));
+  sumA[m] = add_limbs(sumA, m, a, h);
+  sumB[m] = add_limbs(sumB, m, b, h);
+
+  karatsuba_multiply(a, b, output, h);
+  karatsuba_multiply(a + h, b + h, output + 2 * h, m);
+  karatsuba_multiply(sumA, sumB, middle, m + 1);
+  subtract_limbs(middle, 2 * m + 2, output, 2 * h);
+  subtract_limbs(middle, 2 * m + 2, output + 2 * h, 2 * m);
+  // What's left is a0*b1 + a1*b0, which fits in the upper n + m limbs.
+  add_limbs(output + h, n + m, middle, 2 * m + 2 < n + m ? 2 * m + 2 : n + m);
+}
 
-  // The carry-out of the most significant fractional limb is the integer part
-  // of the product.
-  output[1] = (uint64_t)(full_product[0] >> 64);
+/**
+ * @brief Squares a little-endian limb array like karatsuba_multiply, with
+ *        a^2 = a1^2 B^2h + ((a0 + a1)^2 - a0^2 - a1^2) B^h + a0^2.
+ * @param a The number to square (n limbs).
+ * @param output The full 2n-limb square.
+ * @param n Number of limbs.
+ */
+static void karatsuba_square(const uint64_t *a, uint64_t *output, int n) {
+  if (n < KARATSUBA_THRESHOLD) {
+    comba_square(a, output, n);
+    return;
+  }
+  const int h = n / 2;
+  const int m = n - h;
+  uint64_t sumA[CHUNK_SIZE] = {0};
+  uint64_t middle[2 * CHUNK_SIZE];
+  memcpy(sumA, a + h, m * sizeof(uint64_t));
+  sumA[m] = add_limbs(sumA, m, a, h);
+
+  karatsuba_square(a, output, h);
+  karatsuba_square(a + h, output + 2 * h, m);
+  karatsuba_square(sumA, middle, m + 1);
+  subtract_limbs(middle, 2 * m + 2, output, 2 * h);
+  subtract_limbs(middle, 2 * m + 2, output + 2 * h, 2 * m);
+  add_limbs(output + h, n + m, middle, 2 * m + 2 < n + m ? 2 * m + 2 : n + m);
+}
 
-  // Copy the most significant N fractional limbs to the output buffer.
-  for (int i = 0; i < FRACTIONAL_SIZE; ++i) {
-    output[i + 2] = (uint64_t)full_product[i];
+/**
+ * @brief Turns the full product of two little-endian numbers back into a
+ *        fixed-point number, dropping the limbs below the last fractional one
+ *        (and anything that overflowed the integer part).
+ * @param product The 2(n + 1)-limb product.
+ * @param output Pointer to store the result (sign is not set).
+ * @param n Number of fractional limbs.
+ */
+static inline void from_product(const uint64_t *product, uint64_t *output,
+                                int n) {
+  // Both factors had n fractional limbs, so the product has 2n of them.
+  for (int i = 1; i <= n + 1; ++i) {
+    output[i] = product[2 * n + 1 - i];
   }
 }
 
@@ -155,6 +324,7 @@ static inline void multiply_frac_frac(uint64_t *output,
  * @param output Pointer to store the result. Can be the same as an input.
  */
 void add(const uint64_t *value1, const uint64_t *value2, uint64_t *output) {
+  const int n = fractionalSize();
   const uint64_t sign1 = value1[0];
   const uint64_t sign2 = value2[0];
 
@@ -163,69 +333,103 @@ void add(const uint64_t *value1, const uint64_t *value2, uint64_t *output) {
 
   if (sign1 == sign2) {
     // Same signs (e.g., 5 + 2 or -5 + -2): Add magnitudes, keep sign.
-    rawAdd(value1, value2, temp_result);
+    rawAdd(value1, value2, temp_result, n);
     temp_result[0] = sign1;
   } else {
     // Different signs (e.g., 5 + -2 or -5 + 2): Subtract smaller magnitude from
     // larger.
-    if (isGte(value1, value2)) {
+    if (isGte(value1, value2, n)) {
       // |value1| >= |value2|. Result is |value1| - |value2| with sign of
       // value1.
-      rawSubtract(value1, value2, temp_result);
+      rawSubtract(value1, value2, temp_result, n);
       temp_result[0] = sign1;
     } else {
       // |value2| > |value1|. Result is |value2| - |value1| with sign of value2.
-      rawSubtract(value2, value1, temp_result);
+      rawSubtract(value2, value1, temp_result, n);
       temp_result[0] = sign2;
     }
   }
-  memcpy(output, temp_result, CHUNK_SIZE * sizeof(uint64_t));
+  memcpy(output, temp_result, (n + 2) * sizeof(uint64_t));
 }
 
 /**
- * @brief Multiplies two fixed-point numbers.
- * @param value1 Pointer to the first operand.
- * @param value2 Pointer to the second operand.
+ * @brief Subtracts two fixed-point numbers (value1 - value2).
+ * @param value1 Pointer to the minuend.
+ * @param value2 Pointer to the subtrahend.
  * @param output Pointer to store the result. Can be the same as an input.
  */
-void multiply(const uint64_t *value1, const uint64_t *value2,
+void subtract(const uint64_t *value1, const uint64_t *value2,
               uint64_t *output) {
-  // Multiplication uses the distributive property:
-  // (A_i + A_f) * (B_i + B_f) = (A_i*B_i) + (A_i*B_f) + (B_i*A_f) + (A_f*B_f)
-  // We calculate each of the four partial products and sum them.
-
-  uint64_t p1_int_int[CHUNK_SIZE] = {0};
-  uint64_t p2_int_frac[CHUNK_SIZE];
-  uint64_t p3_frac_int[CHUNK_SIZE];
-  uint64_t p4_frac_frac[CHUNK_SIZE];
-
-  const uint64_t int1 = value1[1];
-  const uint64_t int2 = value2[1];
-  const uint64_t *frac1 = value1 + 2;
-  const uint64_t *frac2 = value2 + 2;
-
-  // P1: Integer * Integer. Result is purely an integer part for this precision.
-  p1_int_int[1] = (uint64_t)((unsigned i128)int1 * int2);
+  // Flip the sign of a copy and reuse the signed addition logic.
+  uint64_t negated[CHUNK_SIZE];
+  memcpy(negated, value2, (fractionalSize() + 2) * sizeof(uint64_t));
+  negated[0] = (value2[0] == POSITIVE) ? NEGATIVE : POSITIVE;
+  add(value1, negated, output);
+}
 
-  // P2: Integer1 * Fractional2
-  multiply_int_frac(p2_int_frac, int1, frac2);
+/**
+ * @brief Converts a fixed-point number to the nearest double.
+ * @note Starts at the first non-zero limb so tiny values (like the offset
+ *       between two deep zoom coordinates) keep their full precision.
+ * @param value Pointer to the number.
+ * @return The value as a double.
+ */
+double toDouble(const uint64_t *value) {
+  const int n = fractionalSize();
+  int first = 1;
+  while (first < n && value[first] == 0) {
+    ++first;
+  }
 
-  // P3: Fractional1 * Integer2
-  multiply_int_frac(p3_frac_int, int2, frac1);
+  // Two limbs are more than enough for a 53-bit mantissa.
+  double result = (double)value[first] + (double)value[first + 1] * 0x1p-64;
+  for (int i = 1; i < first; ++i) {
+    result *= 0x1p-64;
+  }
+  return value[0] == NEGATIVE ? -result : result;
+}
 
-  // P4: Fractional1 * Fractional2
-  multiply_frac_frac(p4_frac_frac, frac1, frac2);
+/**
+ * @brief Converts a double to a fixed-point number exactly.
+ * @note The integer part has to fit in a uint64_t.
+ * @param value The double to convert.
+ * @param output Pointer to store the result.
+ */
+void fromDouble(double value, uint64_t *output) {
+  const int n = fractionalSize();
+  fill(output, 0, (n + 2) * sizeof(uint64_t));
+  output[0] = value < 0.0 ? NEGATIVE : POSITIVE;
+  double magnitude = value < 0.0 ? -value : value;
+  output[1] = (uint64_t)magnitude;
+  magnitude -= (double)output[1];
+  // Each step moves 64 bits out of the fraction, so a double's 53-bit
+  // mantissa is used up after a few limbs (or sooner once it hits zero).
+  for (int i = 2; i < n + 2 && magnitude != 0.0; ++i) {
+    magnitude *= 0x1p64;
+    output[i] = (uint64_t)magnitude;
+    magnitude -= (double)output[i];
+  }
+}
 
-  // Sum all partial products using raw addition.
-  uint64_t temp_sum[CHUNK_SIZE];
-  rawAdd(p1_int_int, p2_int_frac, temp_sum);
-  rawAdd(temp_sum, p3_frac_int, temp_sum);
-  rawAdd(temp_sum, p4_frac_frac, temp_sum);
+/**
+ * @brief Multiplies two fixed-point numbers.
+ * @param value1 Pointer to the first operand.
+ * @param value2 Pointer to the second operand.
+ * @param output Pointer to store the result. Can be the same as an input.
+ */
+void multiply(const uint64_t *value1, const uint64_t *value2,
+              uint64_t *output) {
+  // The integer limb is just one more limb on top of the fractional ones, so
+  // this is a single (n + 1)-limb multiplication.
+  const int n = fractionalSize();
+  uint64_t a[CHUNK_SIZE], b[CHUNK_SIZE], product[2 * CHUNK_SIZE];
+  to_little_endian(value1, a, n);
+  to_little_endian(value2, b, n);
+  karatsuba_multiply(a, b, product, n + 1);
 
   // Set the final sign. Positive if signs are the same, negative otherwise.
-  temp_sum[0] = (value1[0] == value2[0]) ? POSITIVE : NEGATIVE;
-
-  memcpy(output, temp_sum, CHUNK_SIZE * sizeof(uint64_t));
+  output[0] = (value1[0] == value2[0]) ? POSITIVE : NEGATIVE;
+  from_product(product, output, n);
 }
 
 /**
@@ -234,35 +438,179 @@ void multiply(const uint64_t *value1, const uint64_t *value2,
  * @param output Pointer to store the result. Can be the same as the input.
  */
 void square(const uint64_t *value, uint64_t *output) {
-  // Squaring is a special case of multiplication:
-  // (A_i + A_f)^2 = (A_i*A_i) + 2*(A_i*A_f) + (A_f*A_f)
-  // This is faster than a general multiply as it computes (A_i*A_f) once.
+  // Squaring needs about half the limb products of a general multiply.
+  const int n = fractionalSize();
+  uint64_t a[CHUNK_SIZE], product[2 * CHUNK_SIZE];
+  to_little_endian(value, a, n);
+  karatsuba_square(a, product, n + 1);
+
+  // The result of a square is always positive.
+  output[0] = POSITIVE;
+  from_product(product, output, n);
+}
+
+// The fused iteration steps below keep every intermediate value as a Term, so
+// nothing goes back to the Decimal layout until the step is done.
+typedef struct {
+  uint64_t limbs[CHUNK_SIZE]; // Little-endian, the integer limb last
+  uint64_t sign;
+} Term;
 
-  uint64_t p1_int_sq[CHUNK_SIZE] = {0};
-  uint64_t p2_int_frac[CHUNK_SIZE];
-  uint64_t p3_frac_sq[CHUNK_SIZE];
+static inline void load_term(const uint64_t *value, Term *term, int n) {
+  to_little_endian(value, term->limbs, n);
+  term->sign = value[0];
+}
 
-  const uint64_t integer_part = value[1];
-  const uint64_t *frac_part = value + 2;
+static inline void store_term(const Term *term, uint64_t *value, int n) {
+  value[0] = term->sign;
+  for (int i = 0; i <= n; ++i) {
+    value[n + 1 - i] = term->limbs[i];
+  }
+}
+
+/**
+ * @brief Adds two terms with their signs (or subtracts when negate is set).
+ * @param output Can be the same as an input.
+ */
+static inline void term_add(const Term *a, const Term *b, Term *output,
+                            int negate, int n) {
+  const uint64_t signB = b->sign ^ (uint64_t)negate;
+  if (a->sign == signB) {
+    uint64_t carry = 0;
+    for (int i = 0; i <= n; ++i) {
+      const unsigned i128 sum =
+          (unsigned i128)a->limbs[i] + b->limbs[i] + carry;
+      output->limbs[i] = (uint64_t)sum;
+      carry = (uint64_t)(sum >> 64);
+    }
+    output->sign = a->sign;
+    return;
+  }
 
-  // P1: Integer^2
-  p1_int_sq[1] = (uint64_t)((unsigned i128)integer_part * integer_part);
+  // Different signs: subtract the smaller magnitude from the larger one.
+  int i = n;
+  while (i > 0 && a->limbs[i] == b->limbs[i]) {
+    --i;
+  }
+  const int aLarger = a->limbs[i] >= b->limbs[i];
+  const Term *larger = aLarger ? a : b;
+  const Term *smaller = aLarger ? b : a;
+  const uint64_t sign = aLarger ? a->sign : signB;
+  uint64_t borrow = 0;
+  for (i = 0; i <= n; ++i) {
+    const unsigned i128 diff =
+        (unsigned i128)larger->limbs[i] - smaller->limbs[i] - borrow;
+    output->limbs[i] = (uint64_t)diff;
+    borrow = (uint64_t)(diff >> 64) & 1;
+  }
+  output->sign = sign;
+}
 
-  // P2: Integer * Fractional
-  multiply_int_frac(p2_int_frac, integer_part, frac_part);
+static inline void term_multiply(const Term *a, const Term *b, Term *output,
+                                 int n) {
+  uint64_t product[2 * CHUNK_SIZE];
+  karatsuba_multiply(a->limbs, b->limbs, product, n + 1);
+  // Drop the n extra fractional limbs the product has.
+  memcpy(output->limbs, product + n, (n + 1) * sizeof(uint64_t));
+  output->sign = (a->sign == b->sign) ? POSITIVE : NEGATIVE;
+}
 
-  // P3: Fractional^2
-  multiply_frac_frac(p3_frac_sq, frac_part, frac_part);
+/**
+ * @brief z = z^2 with two multiplications: r^2 - i^2 = (r + i)(r - i) and
+ *        2ri.
+ */
+static inline void complex_square(Term *r, Term *i, int n) {
+  Term sum, difference;
+  term_add(r, i, &sum, 0, n);
+  term_add(r, i, &difference, 1, n);
+  term_multiply(r, i, i, n);
+  term_add(i, i, i, 0, n);
+  term_multiply(&sum, &difference, r, n);
+}
 
-  // Sum the parts: P1 + 2*P2 + P3
-  uint64_t temp_sum[CHUNK_SIZE];
-  rawAdd(p2_int_frac, p2_int_frac, temp_sum); // Calculate 2 * P2
-  rawAdd(temp_sum, p1_int_sq, temp_sum);
-  rawAdd(temp_sum, p3_frac_sq, temp_sum);
+/**
+ * @brief z = z * w with three multiplications (Gauss's trick):
+ *        re = wr(r + i) - i(wr + wi), im = wr(r + i) + r(wi - wr).
+ */
+static inline void complex_multiply(Term *r, Term *i, const Term *wr,
+                                    const Term *wi, int n) {
+  Term k1, k2, k3;
+  term_add(r, i, &k1, 0, n);
+  term_multiply(wr, &k1, &k1, n);
+  term_add(wi, wr, &k2, 1, n);
+  term_multiply(r, &k2, &k2, n);
+  term_add(wr, wi, &k3, 0, n);
+  term_multiply(i, &k3, &k3, n);
+  term_add(&k1, &k3, r, 1, n);
+  term_add(&k1, &k2, i, 0, n);
+}
 
-  // The result of a square is always positive.
-  temp_sum[0] = POSITIVE;
+/**
+ * @brief One iteration of z = z^2 + c (or a variant of it) in place, sharing
+ *        the partial products between the real and imaginary parts.
+ * @param zr Pointer to the real part of z.
+ * @param zi Pointer to the imaginary part of z.
+ * @param cr Pointer to the real part of c.
+ * @param ci Pointer to the imaginary part of c.
+ * @param variant SQUARE_PLAIN, SQUARE_BURNING_SHIP (|2ri|), SQUARE_CELTIC
+ *        (|r^2 - i^2|) or SQUARE_TRICORN (-2ri).
+ */
+void complexSquareAdd(uint64_t *zr, uint64_t *zi, const uint64_t *cr,
+                      const uint64_t *ci, int variant) {
+  const int n = fractionalSize();
+  Term r, i, c;
+  load_term(zr, &r, n);
+  load_term(zi, &i, n);
+  complex_square(&r, &i, n);
+  if (variant == SQUARE_BURNING_SHIP) {
+    i.sign = POSITIVE;
+  } else if (variant == SQUARE_CELTIC) {
+    r.sign = POSITIVE;
+  } else if (variant == SQUARE_TRICORN) {
+    i.sign ^= 1;
+  }
+  load_term(cr, &c, n);
+  term_add(&r, &c, &r, 0, n);
+  load_term(ci, &c, n);
+  term_add(&i, &c, &i, 0, n);
+  store_term(&r, zr, n);
+  store_term(&i, zi, n);
+}
 
-  memcpy(output, temp_sum, CHUNK_SIZE * sizeof(uint64_t));
+/**
+ * @brief One iteration of z = z^power + c in place, for powers 3-7, with
+ *        repeated squaring (z^7 is ((z^2 * z)^2) * z, 10 multiplications).
+ * @param zr Pointer to the real part of z.
+ * @param zi Pointer to the imaginary part of z.
+ * @param cr Pointer to the real part of c.
+ * @param ci Pointer to the imaginary part of c.
+ * @param power The power, from 3 to 7.
+ */
+void complexPowerAdd(uint64_t *zr, uint64_t *zi, const uint64_t *cr,
+                     const uint64_t *ci, int power) {
+  const int n = fractionalSize();
+  Term r, i, baseR, baseI, c;
+  load_term(zr, &baseR, n);
+  load_term(zi, &baseI, n);
+  r = baseR;
+  i = baseI;
+  // Go through the bits of the power after the first one: square for each
+  // bit, then multiply by z when it is set.
+  int bit = 1;
+  while ((bit << 1) <= power) {
+    bit <<= 1;
+  }
+  for (bit >>= 1; bit > 0; bit >>= 1) {
+    complex_square(&r, &i, n);
+    if (power & bit) {
+      complex_multiply(&r, &i, &baseR, &baseI, n);
+    }
+  }
+  load_term(cr, &c, n);
+  term_add(&r, &c, &r, 0, n);
+  load_term(ci, &c, n);
+  term_add(&i, &c, &i, 0, n);
+  store_term(&r, zr, n);
+  store_term(&i, zi, n);
+}
 }
-}
\ No newline at end of file
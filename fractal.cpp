@@ -7,20 +7,42 @@ executed by JavaScript.
 The run and render functions are exported to JS. (See ./vscode/tasks.json)
 
 FOR THE FUTURE:
-The code will use double for normal calculations then Bilinear Approximation and
-pertubation (not finished for all hybrids). Memory regions image should be in
-the README (GitHub version at https://github.com/plasma4/FractalSky/)
+The code uses double for normal calculations, then perturbation with Bilinear
+Approximation for deep zooms (not finished for all hybrids). Memory regions
+image should be in the README (GitHub version at
+https://github.com/plasma4/FractalSky/)
 */
 
+#include "fractal.h"
+
 #include <algorithm>
 #include <atomic>
 #include <stdint.h>
+#ifdef NATIVE
+#include <cmath> // Emscripten's headers already declare fmaxf and friends
+#endif
 
 // We don't need to include math.h if we use builtins.
 float sqrtf(float x);
 double sqrt(double x);
 double floor(double x);
 
+// Fixed-point routines from decimal.cpp (see the Decimal slots in fractal.h).
+extern "C" {
+void add(const uint64_t *value1, const uint64_t *value2, uint64_t *output);
+void subtract(const uint64_t *value1, const uint64_t *value2,
+              uint64_t *output);
+void multiply(const uint64_t *value1, const uint64_t *value2,
+              uint64_t *output);
+void square(const uint64_t *value, uint64_t *output);
+double toDouble(const uint64_t *value);
+void fromDouble(double value, uint64_t *output);
+void complexSquareAdd(uint64_t *zr, uint64_t *zi, const uint64_t *cr,
+                      const uint64_t *ci, int variant);
+void complexPowerAdd(uint64_t *zr, uint64_t *zi, const uint64_t *cr,
+                     const uint64_t *ci, int power);
+}
+
 #define sqrtf __builtin_sqrtf
 #define sqrt __builtin_sqrt
 #define floor __builtin_floor
@@ -32,25 +54,75 @@ double floor(double x);
 #define unlikely(x) __builtin_expect(!!(x), 0)
 #endif
 
-namespace Mem {
-// Pixel counter
-constexpr uint32_t AtomicCounter = 0;
-// Amount of limbs (for Decimal use), set to 0 for no limbs
-constexpr uint32_t LimbCount = 8;
-
-// Lookup tables (Shading is 64KB and PaletteData is 1000KB)
-constexpr uint32_t ShadingLUT = 32;
-constexpr uint32_t PaletteData = ShadingLUT + 65536;
-// 16 Decimal instances use 32 uint64_t's for 256 bytes/Decimal
-constexpr uint32_t DecimalStorage = PaletteData + 100000;
+// Where the memory regions in fractal.h are. WASM memory starts at 0, but the
+// native build (see native.cpp) allocates its own and points memoryBase at
+// it. The atomic counter is at address 0, so the WASM build needs
+// -fno-delete-null-pointer-checks (or the compiler drops code that uses it).
+#ifdef NATIVE
+extern "C" uintptr_t memoryBase;
+#define MEMORY_BASE memoryBase
+#else
+#define MEMORY_BASE 0
+#endif
 
-// This is where the per-pixel data starts.
-constexpr uint32_t PixelDataStart = DecimalStorage + 4096;
-} // namespace Mem
+// Variants of complexSquareAdd (same as the SQUARE_ defines in decimal.cpp)
+constexpr int SQUARE_PLAIN = 0;
+constexpr int SQUARE_BURNING_SHIP = 1;
+constexpr int SQUARE_CELTIC = 2;
+constexpr int SQUARE_TRICORN = 3;
 
 constexpr int CALC_CHUNK_SIZE = 32;
+// Tiles claimed at once with RUN_TRACING (in pixels per side), and the size
+// below which a tile is calculated fully instead of being split further.
+constexpr int TRACE_TILE_SIZE = 64;
+constexpr int TRACE_MIN_SIZE = 4;
+// Distance between the pixels of the first RUN_PROGRESSIVE pass
+constexpr int PROGRESSIVE_STEP = 8;
+// Smallest block RUN_TILES claims (bigger when there would be more than
+// TILE_COST_LIMIT of them), and the score above which a 16x16 tile of 4 is
+// claimed a block at a time instead.
+constexpr int TILE_BLOCK_SIZE = 8;
+constexpr int TILE_COST_LIMIT = 262144;
+constexpr int TILE_SPLIT_COST = 1 << 20;
+// Workers with a range of their own for RUN_STEALING; any others only steal
+// a block at a time.
+constexpr int WORKER_LIMIT = 256;
 constexpr int RENDER_CHUNK_SIZE = 4096;
+// Entries of Mem::PaletteLUT per palette color (fewer for long palettes, so
+// they fit), and the fewest worth using it with.
+constexpr int PALETTE_LUT_STEPS = 4096;
+constexpr int PALETTE_LUT_MIN_STEPS = 256;
+constexpr int PALETTE_LUT_SIZE = 524288;
+// How far apart (in any channel) the colors of two neighboring pixels can be
+// before RUN_ANTIALIAS adds samples to them
+constexpr int ANTIALIAS_CONTRAST = 32;
 const double BAILOUT_VALUE_SQR = 1e6;
+// Precision tiers run() picks from (see precisionTier), cheapest first.
+constexpr int TIER_FLOAT = 0;
+constexpr int TIER_DOUBLE = 1;
+constexpr int TIER_DOUBLE_DOUBLE = 2;
+constexpr int TIER_DECIMAL = 3; // Perturbation around a Decimal reference
+
+// Floats are only trusted for the first zoom / FLOAT_ZOOM iterations: the
+// rounding error of a float orbit grows by about 2^-22 every iteration, and
+// this keeps it under 1/1024 of a pixel (orbits near the boundary can grow it
+// faster, but those rarely escape that early). Pixels that haven't escaped by
+// then start over in doubles, and run() only uses floats while that's at
+// least FLOAT_MIN_ITERATIONS.
+const double FLOAT_ZOOM = 0x1p-12;
+constexpr int FLOAT_MIN_ITERATIONS = 8;
+// The reference orbit stops here; anything past it escapes anyway, and it
+// keeps the 64-bit integer limb of a Decimal from overflowing.
+const double REFERENCE_ESCAPE_SQR = 16.0;
+// Maximum relative error allowed for a bilinear approximation.
+const double BLA_EPSILON = 0x1p-53;
+// Coefficients kept by the series approximation (see RUN_SERIES).
+constexpr int SERIES_TERMS = 8;
+// How close z has to come back to an earlier z for RUN_PERIODICITY, in pixels.
+const double PERIOD_TOLERANCE = 0x1p-10;
+// Maximum error of the series at a probe, relative to |z| (8 times the
+// rounding error of a double).
+const double SERIES_TOLERANCE = 0x1p-50;
 
 static inline double absD(double x) { return std::fabs(x); }
 
@@ -87,6 +159,26 @@ static inline uint32_t mixBlack(uint32_t colorStart, uint32_t a) {
   return r ^ g ^ b ^ 0xff000000;
 }
 
+// Darkens a color by amount (0-255) in linear light instead of sRGB, with the
+// table main.js writes to Mem::ShadingLUT: every channel value (256 rows)
+// darkened by every amount.
+static inline uint32_t shadeBy(uint32_t color, int amount) {
+  if (!amount) {
+    return color;
+  }
+  const uint8_t *shades =
+      reinterpret_cast<uint8_t *>(MEMORY_BASE + Mem::ShadingLUT);
+  const uint32_t r = shades[(color & 0xff) << 8 | amount];
+  const uint32_t g = shades[((color >> 8) & 0xff) << 8 | amount];
+  const uint32_t b = shades[((color >> 16) & 0xff) << 8 | amount];
+  return r ^ (g << 8) ^ (b << 16) ^ 0xff000000;
+}
+
+// The darkening of a pixel with darkenAmount (0 to 1, or a little more).
+static inline uint32_t shade(uint32_t color, float darkenAmount) {
+  return shadeBy(color, std::clamp((int)(200.0f * darkenAmount), 0, 255));
+}
+
 static inline float powThreeQuarters(float x) {
   float t = sqrtf(x);
   return t * sqrtf(t);
@@ -107,7 +199,7 @@ static inline uint32_t getB(uint32_t color) { return (color >> 16) & 0xff; }
 static uint32_t mix2(uint32_t colorStart, uint32_t colorEnd, float a,
                      int renderMode, float darkenAmount) {
   uint32_t color = mix(colorStart, colorEnd, (a * sqrt(a)) * 255);
-  return mixBlack(color, 200 * darkenAmount);
+  return shade(color, darkenAmount);
 }
 
 // Get a smoothed, looped, index of a palette
@@ -211,7 +303,7 @@ uint32_t getPalette(float position, uint32_t *palette, int length,
   } else {
     color = mix(palette[id], palette[id + 1], mod * 255.0f);
   }
-  return mixBlack(color, 200.0f * darkenAmount);
+  return shade(color, darkenAmount);
 }
 
 // Rather efficient (WASM doesn't support logarithms and a near-accurate
@@ -230,6 +322,124 @@ static inline float flog2(float n) {
          1.725880027f / (0.3520887196f + castedFloat);
 }
 
+// Everything the coloring needs besides the pixel's own data.
+struct Coloring {
+  uint32_t *palette;
+  int paletteLen;
+  uint32_t interiorColor;
+  int renderMode;
+  int darkenEffect;
+  float speed1; // sqrt(sqrt(speed))
+  float speed2; // 0.035 * speed
+  float flowAmount;
+  const uint32_t *lut; // See paletteLUT (nullptr to use getPalette)
+  int lutSteps;
+};
+
+// Entries of the palette lookup table per palette color, or 0 if the palette
+// is too long for it.
+static inline int paletteSteps(int paletteLen) {
+  int steps = PALETTE_LUT_STEPS;
+  while (steps > PALETTE_LUT_MIN_STEPS &&
+         paletteLen * steps > PALETTE_LUT_SIZE) {
+    steps >>= 1;
+  }
+  return paletteLen * steps > PALETTE_LUT_SIZE ? 0 : steps;
+}
+
+// Everything the palette lookup table depends on. The render mode and
+// length come from run() or render() instead of memory, so a job that
+// started before they changed never leaves a table for the new ones behind.
+static inline uint64_t paletteKey(uint32_t version, int paletteLen,
+                                  int renderMode) {
+  return (uint64_t)version << 32 | (uint64_t)renderMode << 16 |
+         (uint64_t)paletteLen;
+}
+
+// getPalette (without darkening) at the middle of every 1/steps of every
+// palette color, so a pixel's color is one lookup instead of all of the
+// render mode's blending. Only one worker builds it (the others wait, since
+// it doesn't take long); returns nullptr if the palette doesn't fit.
+static const uint32_t *paletteLUT(uint32_t *palette, int paletteLen,
+                                  int renderMode) {
+  const int steps = paletteSteps(paletteLen);
+  if (steps == 0) {
+    return nullptr;
+  }
+  uint32_t *lut = reinterpret_cast<uint32_t *>(MEMORY_BASE + Mem::PaletteLUT);
+  std::atomic<uint32_t> *version = reinterpret_cast<std::atomic<uint32_t> *>(
+      MEMORY_BASE + Mem::PaletteVersion);
+  std::atomic<uint64_t> *built = reinterpret_cast<std::atomic<uint64_t> *>(
+      MEMORY_BASE + Mem::PaletteLUTKey);
+  std::atomic<int> *lock =
+      reinterpret_cast<std::atomic<int> *>(MEMORY_BASE + Mem::PaletteLUTLock);
+  // The version is read before the palette, so a palette written during the
+  // build gets the table built again next time.
+  const uint64_t key = paletteKey(version->load(std::memory_order_acquire),
+                                  paletteLen, renderMode);
+  while (built->load(std::memory_order_acquire) != key) {
+    int expected = 0;
+    if (lock->compare_exchange_strong(expected, 1,
+                                      std::memory_order_acquire)) {
+      if (built->load(std::memory_order_relaxed) != key) {
+        for (int id = 0; id < paletteLen; id++) {
+          for (int k = 0; k < steps; k++) {
+            lut[id * steps + k] =
+                getPalette(id + (k + 0.5f) / steps, palette, paletteLen,
+                           renderMode, 0.0f);
+          }
+        }
+        built->store(key, std::memory_order_release);
+      }
+      lock->store(0, std::memory_order_release);
+    }
+  }
+  return lut;
+}
+
+// getPalette, from the lookup table if there is one.
+static inline uint32_t paletteColor(const Coloring &c, float position,
+                                    float darkenAmount) {
+  if (c.lut == nullptr) {
+    return getPalette(position, c.palette, c.paletteLen, c.renderMode,
+                      darkenAmount);
+  }
+  // Same as getPalette's id and mod (see colorPixelsVector too)
+  const int whole = (int)position;
+  const int k = std::clamp((int)((position - (float)whole) * c.lutSteps), 0,
+                           c.lutSteps - 1);
+  return shade(c.lut[whole % c.paletteLen * c.lutSteps + k], darkenAmount);
+}
+
+// The color of a pixel with n iterations and shading l.
+static inline uint32_t pixelColor(const Coloring &c, float n, float l) {
+  if (n == -999.0f) {
+    return c.interiorColor;
+  }
+  const float finalDarken = (c.darkenEffect == 2) ? (1.0f - l) : l;
+  if (n < 1.25f) {
+    int index = static_cast<int>(c.flowAmount);
+    int indexModulo = index % c.paletteLen;
+    uint32_t color =
+        mix2(c.palette[indexModulo], c.palette[indexModulo + 1],
+             c.flowAmount - index, c.renderMode, finalDarken);
+    // Slightly above 1 due to log2() approximation
+    if (n > 1.000004f) {
+      // n * 1020 - 1020 -> 255 * (n * 4 - 4)
+      color = mix(color,
+                  paletteColor(c,
+                               flog2(n) * c.speed1 + (n - 1.0f) * c.speed2 +
+                                   c.flowAmount,
+                               finalDarken),
+                  (n * 1020.0f) - 1020.0f);
+    }
+    return color;
+  }
+  return paletteColor(
+      c, flog2(n) * c.speed1 + (n - 1.0f) * c.speed2 + c.flowAmount,
+      finalDarken);
+}
+
 static inline float doubleLogSqrt(float n) {
   // Simpler to create a function for this, as it's used so much
   return flog2(flog2(n) * 0.5);
@@ -896,8 +1106,8 @@ float prmbS(int iterations, double x, double y, double cx, double cy,
   double si = i * i;
   for (int n = 1; n <= iterations; n++) {
     double tr = 2.0 * r * i;
-    r = absD(sr - i * i + x);
-    i = -tr - y;
+    r = absD(sr - i * i + cx);
+    i = -tr - cy;
     sr = r * r;
     si = i * i;
     if (unlikely(sr + si > BAILOUT_VALUE_SQR)) {
@@ -1309,8 +1519,8 @@ float prmbS2(int iterations, double x, double y, double cx, double cy,
   double si = i * i;
   for (int n = 1; n <= iterations; n++) {
     double tr = 2.0 * r * i;
-    r = absD(sr - i * i + x);
-    i = -tr - y;
+    r = absD(sr - i * i + cx);
+    i = -tr - cy;
     sr = r * r;
     si = i * i;
     if (unlikely(sr + si > BAILOUT_VALUE_SQR)) {
@@ -1482,405 +1692,2600 @@ float mbbs4S2(int iterations, double x, double y, double cx, double cy,
   return -999.0f;
 }
 
-// Keep C export names
-extern "C" {
-// Simply renders the output; no fuss.
-void render(int pixels, int paletteLen, uint32_t interiorColor, int renderMode,
-            int darkenEffect, float speed, float flowAmount) {
-  // "What is the current pixel we are working on?"
-  std::atomic<int> *pixelAtomic =
-      reinterpret_cast<std::atomic<int> *>(Mem::AtomicCounter);
+// -----
 
-  // Points to the start of the iteration data.
-  float *iters = reinterpret_cast<float *>(Mem::PixelDataStart);
-  // Shading data immediately follows iteration data in memory.
-  float *shading = iters + pixels;
-  // RGBA data follows shading.
-  uint32_t *colors = reinterpret_cast<uint32_t *>(shading + pixels);
-  // Palette data is after the LUT.
-  uint32_t *palette = reinterpret_cast<uint32_t *>(Mem::PaletteData);
+// Runs the kernel needed for the fractal type and darken effect. Checking the
+// wasm2wat output of fractal.wasm reveals that this is optimized into a simple
+// jump table. Nice!
+static inline float escapeTime(int absType, int darkenEffect, int iterations,
+                               double x, double y, double cx, double cy,
+                               float *ptr) {
+  switch (darkenEffect) {
+  case 0:
+    switch (absType) {
+    case 1:
+      return mand(iterations, x, y, cx, cy);
+    case 2:
+      return mand3(iterations, x, y, cx, cy);
+    case 3:
+      return mand4(iterations, x, y, cx, cy);
+    case 4:
+      return mand5(iterations, x, y, cx, cy);
+    case 5:
+      return mand6(iterations, x, y, cx, cy);
+    case 6:
+      return mand7(iterations, x, y, cx, cy);
+    case 7:
+      return ship(iterations, x, y, cx, cy);
+    case 8:
+      return ship3(iterations, x, y, cx, cy);
+    case 9:
+      return ship4(iterations, x, y, cx, cy);
+    case 10:
+      return celt(iterations, x, y, cx, cy);
+    case 11:
+      return prmb(iterations, x, y, cx, cy);
+    case 12:
+      return buff(iterations, x, y, cx, cy);
+    case 13:
+      return tric(iterations, x, y, cx, cy);
+    case 14:
+      return mbbs(iterations, x, y, cx, cy);
+    case 15:
+      return mbbs3(iterations, x, y, cx, cy);
+    case 16:
+      return mbbs4(iterations, x, y, cx, cy);
+    }
+    break;
+  case 3:
+    switch (absType) {
+    case 1:
+      return mandS2(iterations, x, y, cx, cy, ptr);
+    case 2:
+      return mand3S2(iterations, x, y, cx, cy, ptr);
+    case 3:
+      return mand4S2(iterations, x, y, cx, cy, ptr);
+    case 4:
+      return mand5S2(iterations, x, y, cx, cy, ptr);
+    case 5:
+      return mand6S2(iterations, x, y, cx, cy, ptr);
+    case 6:
+      return mand7S2(iterations, x, y, cx, cy, ptr);
+    case 7:
+      return shipS2(iterations, x, y, cx, cy, ptr);
+    case 8:
+      return ship3S2(iterations, x, y, cx, cy, ptr);
+    case 9:
+      return ship4S2(iterations, x, y, cx, cy, ptr);
+    case 10:
+      return celtS2(iterations, x, y, cx, cy, ptr);
+    case 11:
+      return prmbS2(iterations, x, y, cx, cy, ptr);
+    case 12:
+      return buffS2(iterations, x, y, cx, cy, ptr);
+    case 13:
+      return tricS2(iterations, x, y, cx, cy, ptr);
+    case 14:
+      return mbbsS2(iterations, x, y, cx, cy, ptr);
+    case 15:
+      return mbbs3S2(iterations, x, y, cx, cy, ptr);
+    case 16:
+      return mbbs4S2(iterations, x, y, cx, cy, ptr);
+    }
+    break;
+  default:
+    switch (absType) {
+    case 1:
+      return mandS(iterations, x, y, cx, cy, ptr);
+    case 2:
+      return mand3S(iterations, x, y, cx, cy, ptr);
+    case 3:
+      return mand4S(iterations, x, y, cx, cy, ptr);
+    case 4:
+      return mand5S(iterations, x, y, cx, cy, ptr);
+    case 5:
+      return mand6(iterations, x, y, cx, cy);
+    case 6:
+      return mand7(iterations, x, y, cx, cy);
+    case 7:
+      return shipS(iterations, x, y, cx, cy, ptr);
+    case 8:
+      return ship3S(iterations, x, y, cx, cy, ptr);
+    case 9:
+      return ship4S(iterations, x, y, cx, cy, ptr);
+    case 10:
+      return celt(iterations, x, y, cx, cy);
+    case 11:
+      return prmb(iterations, x, y, cx, cy);
+    case 12:
+      return buff(iterations, x, y, cx, cy);
+    case 13:
+      return tric(iterations, x, y, cx, cy);
+    case 14:
+      return mbbs(iterations, x, y, cx, cy);
+    case 15:
+      return mbbs3(iterations, x, y, cx, cy);
+    case 16:
+      return mbbs4(iterations, x, y, cx, cy);
+    }
+  }
+  return -999.0f;
+}
 
-  const float speed1 = sqrtf(sqrtf(speed));
-  const float speed2 = 0.035f * speed;
-  const int totalChunks = (pixels + RENDER_CHUNK_SIZE - 1) / RENDER_CHUNK_SIZE;
+// -----
 
-  // This is the robust, thread-safe loop structure.
-  while (true) {
-    // Use the compiler built-in for the atomic operation.
-    int chunkIndex = pixelAtomic->fetch_add(1, std::memory_order_relaxed);
-    if (unlikely(chunkIndex >= totalChunks)) {
-      break;
+// Perturbation! Past PERTURBATION_ZOOM a double can't tell neighboring pixels
+// apart, so one reference orbit Z is computed with Decimals and every pixel
+// only iterates its (tiny) difference d from that orbit in plain doubles:
+// z = Z + d. Whenever |z| < |d| (or the reference runs out) the pixel
+// "rebases" onto the start of the reference, which avoids the glitches older
+// perturbation renderers needed to detect. Only formulas without hybrids or
+// unusual starting values are supported; the rest fall back to doubles.
+
+static inline bool hasPerturbation(int absType) {
+  return absType <= 7 || absType == 10 || absType == 13;
+}
+
+// Bilinear approximation only works for the conformal (Multibrot) formulas.
+static inline bool hasBLA(int absType) { return absType <= 6; }
+
+// One bilinear approximation: d -> A * d + B * dc, valid while |d| < radius.
+struct BLA {
+  double ar, ai;
+  double br, bi;
+  double radius;
+};
+// Mem::accumulationStart and main.js leave room for 2 of these per iteration.
+static_assert(sizeof(BLA) == 40, "BLA table size changed");
+
+// Level k of the BLA table skips 2^k iterations; level 0 starts at reference
+// index 1 and every level merges pairs of entries from the one below.
+struct BLALevels {
+  int start[32];
+  int count[32];
+  int levels;
+};
+
+// Everything a pixel needs from the reference calculation.
+struct Reference {
+  const double *orbit;
+  int length;
+  const BLA *bla; // nullptr when the formula has no BLA
+  BLALevels levels;
+};
+
+static void blaLevels(int orbitLength, BLALevels &out) {
+  int start = 0;
+  int count = orbitLength - 1;
+  out.levels = 0;
+  while (count > 0 && out.levels < 32) {
+    out.start[out.levels] = start;
+    out.count[out.levels] = count;
+    out.levels++;
+    start += count;
+    count >>= 1;
+  }
+}
+
+// Types that use directional shading with a derivative for darkenEffect 1/2
+// (the others use the kernels without shading, see escapeTime).
+static inline bool hasDerivativeShading(int absType) {
+  return absType <= 4 || (absType >= 7 && absType <= 9);
+}
+
+// Computes (|c + d| - |c|) without losing the precision of d.
+static inline double diffAbs(double c, double d) {
+  if (c >= 0.0) {
+    return (c + d >= 0.0) ? d : -(2.0 * c + d);
+  }
+  return (c + d > 0.0) ? 2.0 * c + d : -d;
+}
+
+// The same shading math the S and S2 kernels use, for the final z.
+static inline float derivativeShading(double r, double i, double dr,
+                                      double di) {
+  double sqm = dr * dr + di * di;
+  double ur = (r * dr + i * di) / sqm;
+  double ui = (i * dr - r * di) / sqm;
+  double norm = sqrt(ur * ur + ui * ui);
+  ur /= norm;
+  ui /= norm;
+  float t = (ur + ui) * 0.7071067811865475f + 1.5f;
+  return fmaxf(0.0f, t) * 0.4f;
+}
+
+static inline float directionShading(double r, double i) {
+  double ur = r + i;
+  double ui = i - r;
+  double norm = sqrt(ur * ur + ui * ui);
+  ur /= norm;
+  ui /= norm;
+  float t = (ur + ui) * 0.7071067811865475f + 1.5f;
+  return fmaxf(0.0f, t) * 0.4f;
+}
+
+// 1 / log2(power), used to smooth the iteration count.
+template <int Type> constexpr float smoothingFactor() {
+  return (Type == 2 || Type == 8 || Type == 15) ? 0.6309297535714575f
+         : (Type == 3 || Type == 9 || Type == 16) ? 0.5f
+         : Type == 4                              ? 0.43067655807339306f
+         : Type == 5                              ? 0.38685280723454163f
+         : Type == 6                              ? 0.3562071871080222f
+                                                  : 1.0f;
+}
+
+// One Decimal iteration of the reference orbit: z = f(z) + c.
+template <int Type>
+static void referenceStep(uint64_t *zr, uint64_t *zi, const uint64_t *cr,
+                          const uint64_t *ci) {
+  if constexpr (Type >= 2 && Type <= 6) {
+    complexPowerAdd(zr, zi, cr, ci, Type + 1);
+  } else {
+    complexSquareAdd(zr, zi, cr, ci,
+                     Type == 7    ? SQUARE_BURNING_SHIP
+                     : Type == 10 ? SQUARE_CELTIC
+                     : Type == 13 ? SQUARE_TRICORN
+                                  : SQUARE_PLAIN);
+  }
+}
+
+// Fills orbit with (re, im) pairs: orbit[0] is 0 and orbit[1] is the center,
+// matching z = c before the first iteration of the normal kernels. Returns the
+// index of the last usable point.
+template <int Type>
+static int referenceOrbit(int iterations, const uint64_t *cr,
+                          const uint64_t *ci, double *orbit) {
+  uint64_t zr[DECIMAL_LIMBS], zi[DECIMAL_LIMBS];
+  __builtin_memcpy(zr, cr, sizeof(zr));
+  __builtin_memcpy(zi, ci, sizeof(zi));
+  orbit[0] = 0.0;
+  orbit[1] = 0.0;
+  orbit[2] = toDouble(zr);
+  orbit[3] = toDouble(zi);
+
+  const int last = iterations + 1;
+  for (int m = 2; m <= last; m++) {
+    referenceStep<Type>(zr, zi, cr, ci);
+    const double X = toDouble(zr);
+    const double Y = toDouble(zi);
+    orbit[2 * m] = X;
+    orbit[2 * m + 1] = Y;
+    if (X * X + Y * Y > REFERENCE_ESCAPE_SQR) {
+      return m;
     }
+  }
+  return last;
+}
 
-    const int start = chunkIndex * RENDER_CHUNK_SIZE;
-    const int end = std::min(start + RENDER_CHUNK_SIZE, pixels);
+static int computeReference(int absType, int iterations, double *orbit) {
+  const uint64_t *storage =
+      reinterpret_cast<uint64_t *>(MEMORY_BASE + Mem::DecimalStorage);
+  const uint64_t *cr = storage + SLOT_CENTER_X * DECIMAL_LIMBS;
+  const uint64_t *ci = storage + SLOT_CENTER_Y * DECIMAL_LIMBS;
+  switch (absType) {
+  case 1:
+    return referenceOrbit<1>(iterations, cr, ci, orbit);
+  case 2:
+    return referenceOrbit<2>(iterations, cr, ci, orbit);
+  case 3:
+    return referenceOrbit<3>(iterations, cr, ci, orbit);
+  case 4:
+    return referenceOrbit<4>(iterations, cr, ci, orbit);
+  case 5:
+    return referenceOrbit<5>(iterations, cr, ci, orbit);
+  case 6:
+    return referenceOrbit<6>(iterations, cr, ci, orbit);
+  case 7:
+    return referenceOrbit<7>(iterations, cr, ci, orbit);
+  case 10:
+    return referenceOrbit<10>(iterations, cr, ci, orbit);
+  default:
+    return referenceOrbit<13>(iterations, cr, ci, orbit);
+  }
+}
+
+// d = f(Z + d) - f(Z) + dc, written so that no large terms cancel out.
+template <int Type>
+static inline void perturbStep(double X, double Y, double &x, double &y,
+                               double a, double b) {
+  if constexpr (Type <= 6) {
+    // z^p - Z^p = d * (z^(p-1) + z^(p-2) Z + ... + Z^(p-1)), with z = Z + d.
+    const double zr = X + x;
+    const double zi = Y + y;
+    double sr = 1.0, si = 0.0; // Running sum (Horner's method)
+    double pr = 1.0, pi = 0.0; // Z^k
+    for (int k = 1; k <= Type; k++) {
+      const double tr = pr * X - pi * Y;
+      pi = pr * Y + pi * X;
+      pr = tr;
+      const double ur = sr * zr - si * zi;
+      si = sr * zi + si * zr + pi;
+      sr = ur + pr;
+    }
+    const double nx = x * sr - y * si + a;
+    y = x * si + y * sr + b;
+    x = nx;
+  } else {
+    const double real = (2.0 * X + x) * x - (2.0 * Y + y) * y;
+    const double imag = X * y + x * Y + x * y;
+    if constexpr (Type == 7) {
+      x = real + a;
+      y = 2.0 * diffAbs(X * Y, imag) + b;
+    } else if constexpr (Type == 10) {
+      x = diffAbs(X * X - Y * Y, real) + a;
+      y = 2.0 * imag + b;
+    } else {
+      x = real + a;
+      y = -2.0 * imag + b;
+    }
+  }
+}
 
-    for (int i = start; i < end; ++i) {
-      float t = iters[i];
+// The derivative used by the S kernels: dz = p * z^(p-1) * dz + 1 (Burning
+// Ship kernels ignore the absolute values, so this does too).
+template <int Type>
+static inline void derivativeStep(double r, double i, double &dr, double &di) {
+  constexpr int power = (Type <= 6) ? Type + 1 : 2;
+  double pr = 1.0, pi = 0.0;
+  for (int k = 1; k < power; k++) {
+    const double tr = pr * r - pi * i;
+    pi = pr * i + pi * r;
+    pr = tr;
+  }
+  const double tempdr = power * (dr * pr - di * pi) + 1.0;
+  di = power * (dr * pi + di * pr);
+  dr = tempdr;
+}
 
-      // This is your original, correct coloring logic.
-      if (t == -999.0f) {
-        colors[i] = interiorColor;
-      } else {
-        const float s = shading[i];
-        const float finalDarken = (darkenEffect == 2) ? (1.0f - s) : s;
-        if (t < 1.25f) {
-          int index = static_cast<int>(flowAmount);
-          int indexModulo = index % paletteLen;
-          uint32_t c = mix2(palette[indexModulo], palette[indexModulo + 1],
-                            flowAmount - index, renderMode, finalDarken);
-          // Slightly above 1 due to log2() approximation
-          if (t > 1.000004f) {
-            // n * 1020 - 1020 -> 255 * (n * 4 - 4)
-            c = mix(
-                c,
-                getPalette(flog2(t) * speed1 + (t - 1) * speed2 + flowAmount,
-                           palette, paletteLen, renderMode, finalDarken),
-                (t * 1020.0f) - 1020.0f);
-          }
-          colors[i] = c;
-        } else {
-          float l = shading[i]; // Correctly read from the shading buffer
-          colors[i] =
-              getPalette(flog2(t) * speed1 + (t - 1) * speed2 + flowAmount,
-                         palette, paletteLen, renderMode, finalDarken);
-        }
+// Applies x, then y. dcMax is the largest dc of any pixel on the screen.
+static inline void mergeBLA(const BLA &x, const BLA &y, double dcMax,
+                            BLA &out) {
+  out.ar = y.ar * x.ar - y.ai * x.ai;
+  out.ai = y.ar * x.ai + y.ai * x.ar;
+  out.br = y.ar * x.br - y.ai * x.bi + y.br;
+  out.bi = y.ar * x.bi + y.ai * x.br + y.bi;
+  // After x, |d| <= |Ax| * |d| + |Bx| * dcMax has to stay inside y's radius.
+  const double ax = sqrt(x.ar * x.ar + x.ai * x.ai);
+  const double bx = sqrt(x.br * x.br + x.bi * x.bi);
+  double radius = (y.radius - bx * dcMax) / ax;
+  if (!(radius > 0.0)) {
+    radius = 0.0; // Also catches NaN from huge products
+  }
+  out.radius = std::min(x.radius, radius);
+}
+
+// Builds every level of the table from the reference orbit. For z^p + c, one
+// iteration is d -> p * Z^(p-1) * d + dc as long as the dropped d^2 term stays
+// small compared to it.
+template <int Type>
+static void buildBLA(const double *orbit, int orbitLength, double dcMax,
+                     BLA *table) {
+  constexpr int power = Type + 1;
+  BLALevels levels;
+  blaLevels(orbitLength, levels);
+  for (int m = 1; m < orbitLength; m++) {
+    const double X = orbit[2 * m];
+    const double Y = orbit[2 * m + 1];
+    double pr = 1.0, pi = 0.0;
+    for (int k = 1; k < power; k++) {
+      const double tr = pr * X - pi * Y;
+      pi = pr * Y + pi * X;
+      pr = tr;
+    }
+    BLA &entry = table[m - 1];
+    entry.ar = power * pr;
+    entry.ai = power * pi;
+    entry.br = 1.0;
+    entry.bi = 0.0;
+    entry.radius = BLA_EPSILON * sqrt(X * X + Y * Y) * 2.0 / (power - 1);
+  }
+  for (int k = 1; k < levels.levels; k++) {
+    const BLA *below = table + levels.start[k - 1];
+    BLA *level = table + levels.start[k];
+    for (int i = 0; i < levels.count[k]; i++) {
+      mergeBLA(below[2 * i], below[2 * i + 1], dcMax, level[i]);
+    }
+  }
+}
+
+static void computeBLA(int absType, const double *orbit, int orbitLength,
+                       double dcMax, BLA *table) {
+  switch (absType) {
+  case 1:
+    return buildBLA<1>(orbit, orbitLength, dcMax, table);
+  case 2:
+    return buildBLA<2>(orbit, orbitLength, dcMax, table);
+  case 3:
+    return buildBLA<3>(orbit, orbitLength, dcMax, table);
+  case 4:
+    return buildBLA<4>(orbit, orbitLength, dcMax, table);
+  case 5:
+    return buildBLA<5>(orbit, orbitLength, dcMax, table);
+  default:
+    return buildBLA<6>(orbit, orbitLength, dcMax, table);
+  }
+}
+
+// Skips as many iterations as possible from reference index m, returning how
+// many were skipped (0 if none of the approximations are valid here). The
+// derivative for shading goes through the same linear map.
+static inline int skipBLA(const Reference &ref, int m, int remaining,
+                          double &x, double &y, double a, double b,
+                          bool derivative, double &dr, double &di) {
+  // Level k only has entries where m - 1 is a multiple of 2^k, and level 0
+  // isn't worth it over a normal iteration.
+  const int j = m - 1;
+  if (j < 0 || (j & 1)) {
+    return 0;
+  }
+  const int top = j == 0 ? ref.levels.levels - 1
+                         : std::min(ref.levels.levels - 1, __builtin_ctz(j));
+  // A merged radius never exceeds the radius of its first half, so the valid
+  // levels are always 1..k for some k and the first failure ends the search.
+  const double mag = x * x + y * y;
+  const BLA *best = nullptr;
+  int k = 1;
+  for (; k <= top; k++) {
+    const int index = j >> k;
+    if (index >= ref.levels.count[k] || (1 << k) > remaining) {
+      break;
+    }
+    const BLA &e = ref.bla[ref.levels.start[k] + index];
+    if (!(mag < e.radius * e.radius)) {
+      break;
+    }
+    best = &e;
+  }
+  if (!best) {
+    return 0;
+  }
+  const BLA &e = *best;
+  const double nx = e.ar * x - e.ai * y + e.br * a - e.bi * b;
+  y = e.ar * y + e.ai * x + e.br * b + e.bi * a;
+  x = nx;
+  if (derivative) {
+    const double ndr = e.ar * dr - e.ai * di + e.br;
+    di = e.ar * di + e.ai * dr + e.bi;
+    dr = ndr;
+  }
+  return 1 << (k - 1);
+}
+
+template <int Type>
+static float perturb(int iterations, const Reference &ref, double a, double b,
+                     int darkenEffect, float *ptr) {
+  const bool derivative = (darkenEffect == 1 || darkenEffect == 2) &&
+                          hasDerivativeShading(Type);
+  const double *orbit = ref.orbit;
+  // Before the first iteration z = c, so d = dc and Z is the center.
+  double x = a;
+  double y = b;
+  double dr = 1.0;
+  double di = 0.0;
+  int m = 1;
+  int n = 0;
+  while (n < iterations) {
+    int steps = 0;
+    if constexpr (Type <= 6) {
+      if (ref.bla) {
+        steps = skipBLA(ref, m, iterations - n, x, y, a, b, derivative, dr,
+                        di);
+      }
+    }
+    if (steps == 0) {
+      const double X = orbit[2 * m];
+      const double Y = orbit[2 * m + 1];
+      if (derivative) {
+        derivativeStep<Type>(X + x, Y + y, dr, di);
+      }
+      perturbStep<Type>(X, Y, x, y, a, b);
+      steps = 1;
+    }
+    n += steps;
+    m += steps;
+    const double r = orbit[2 * m] + x;
+    const double i = orbit[2 * m + 1] + y;
+    const double mag = r * r + i * i;
+    if (unlikely(mag > BAILOUT_VALUE_SQR)) {
+      if (derivative) {
+        *ptr = derivativeShading(r, i, dr, di);
+      } else if (darkenEffect == 3) {
+        *ptr = directionShading(r, i);
       }
+      return (float)n - doubleLogSqrt(mag) * smoothingFactor<Type>();
+    }
+    // Rebase when z gets closer to 0 than the delta itself (or when the
+    // reference escaped); Z at the start of the orbit is 0, so d = z.
+    if (unlikely(mag < x * x + y * y || m == ref.length)) {
+      x = r;
+      y = i;
+      m = 0;
     }
   }
+  return -999.0f;
 }
 
-/**
- * @brief This is the main function! It renders a fractal image to a pixel
- * buffer using multithreading. Iterates through pixels, calculates fractal
- * values, and adds pixel data. Make sure to also read the JS code to understand
- * constants/inputs!
- *
- * @param type          [in]  int             Fractal type (1 is Mandelbrot,
- * negative means Julia set)
- * @param w             [in]  int             Image width in pixels
- * @param h             [in]  int             Image height in pixels
- * @param posX          [in]  double          Horizontal position of the
- * fractal.
- * @param posY          [in]  double          Vertical position of the fractal
- * @param zoom          [in]  double          Zoom level of the fractal
- * @param max           [in]  int             Maximum calculation 'score' before
- * early exit.
- * @param iterations    [in]  int             Maximum iterations per pixel
- * @param paletteLen    [in]  int             Total length of the color palette
- * @param interiorColor [in]  uint32_t        Color for pixels that do not
- * escape.
- * @param renderMode    [in]  int             Rendering mode for palette
- * application.
- * @param darkenEffect  [in]  int             Darkening/shading effect mode
- * @param speed         [in]  float           Palette color cycling speed
- * @param flowAmount    [in]  float           Palette flow/pan amount
- * @param data1         [in]  double          Additional data (Julia X)
- * @param data2         [in]  double          Additional data (Julia Y)
- *
- * @return              int             -1 for completion, pixel index if not
- * fully completed.
- */
-int run(int type, int w, int h, double posX, double posY, double zoom, int max,
-        int iterations, int paletteLen, uint32_t interiorColor, int renderMode,
-        int darkenEffect, float speed, float flowAmount, double data1,
-        double data2) {
-  // "What is the current pixel we are working on?"
-  std::atomic<int> *pixelAtomic =
-      reinterpret_cast<std::atomic<int> *>(Mem::AtomicCounter);
-  // Total pixels to work on
-  const int pixels = w * h;
+static inline float perturbPixel(int absType, int iterations,
+                                 const Reference &ref, double a, double b,
+                                 int darkenEffect, float *ptr) {
+  switch (absType) {
+  case 1:
+    return perturb<1>(iterations, ref, a, b, darkenEffect, ptr);
+  case 2:
+    return perturb<2>(iterations, ref, a, b, darkenEffect, ptr);
+  case 3:
+    return perturb<3>(iterations, ref, a, b, darkenEffect, ptr);
+  case 4:
+    return perturb<4>(iterations, ref, a, b, darkenEffect, ptr);
+  case 5:
+    return perturb<5>(iterations, ref, a, b, darkenEffect, ptr);
+  case 6:
+    return perturb<6>(iterations, ref, a, b, darkenEffect, ptr);
+  case 7:
+    return perturb<7>(iterations, ref, a, b, darkenEffect, ptr);
+  case 10:
+    return perturb<10>(iterations, ref, a, b, darkenEffect, ptr);
+  default:
+    return perturb<13>(iterations, ref, a, b, darkenEffect, ptr);
+  }
+}
 
-  // "What is the memory address of the data for the palette of colors to use?"
-  uint32_t *palette = reinterpret_cast<uint32_t *>(Mem::PaletteData);
-  // "What is the memory address of the data for iterations before exiting?"
-  float *iters = reinterpret_cast<float *>(Mem::PixelDataStart);
-  // "What is the memory address of the data for shading?"
-  float *shading = iters + pixels;
-  // "What is the memory address of the RGBA data for rendering?"
-  uint32_t *colors = reinterpret_cast<uint32_t *>(shading + pixels);
+// -----
 
-  const float speed1 = sqrtf(sqrtf(speed));
-  const float speed2 = 0.035f * speed;
-  int score = 0;
+// Series approximation! Around the center of the screen, z after n
+// iterations is a polynomial in dc (the offset of a pixel from the center):
+// z = A0 + A1 * dc + A2 * dc^2 + ... Iterating those coefficients once gives
+// a starting point for every pixel, so when the first few thousand iterations
+// look the same across the whole screen they only have to be done once.
+// A grid of probe points across the screen is iterated normally next to it,
+// and the series stops as soon as it disagrees with any of them by more than
+// rounding error. Only the Multibrots work, since the other formulas aren't
+// polynomials in dc.
 
-  // Capture the job ID at the start. This worker is now locked to this job.
-  const int biggerIterations = iterations + 2;
-  const int totalChunks = (pixels + CALC_CHUNK_SIZE - 1) / CALC_CHUNK_SIZE;
+static inline bool hasSeries(int absType, int darkenEffect) {
+  // The shading kernels start with a derivative of 1, which would be wrong
+  // past the first iteration (mand6 and mand7 have no derivative shading).
+  return absType <= 6 &&
+         (darkenEffect == 0 || darkenEffect == 3 || absType >= 5);
+}
 
-  // Find the absolute value
-  int absType = (type < 0) ? -type : type;
-  const bool isJulia = (type < 0);
+struct Series {
+  double re[SERIES_TERMS];
+  double im[SERIES_TERMS];
+};
 
-  // This is the main worker loop. It is pixel-based for best load balancing.
-  while (true) {
-    int i = pixelAtomic->fetch_add(CALC_CHUNK_SIZE, std::memory_order_relaxed);
+// Multiplies two series, dropping the terms that don't fit.
+static inline void seriesMultiply(const Series &x, const Series &y,
+                                  Series &out) {
+  for (int k = 0; k < SERIES_TERMS; k++) {
+    double r = 0.0;
+    double i = 0.0;
+    for (int j = 0; j <= k; j++) {
+      r += x.re[j] * y.re[k - j] - x.im[j] * y.im[k - j];
+      i += x.re[j] * y.im[k - j] + x.im[j] * y.re[k - j];
+    }
+    out.re[k] = r;
+    out.im[k] = i;
+  }
+}
 
-    const int startPixel = i;
-    const int endPixel = std::min(startPixel + CALC_CHUNK_SIZE, pixels);
+// Evaluates a series at dc with Horner's method.
+static inline void seriesValue(const Series &s, double a, double b, double &r,
+                               double &i) {
+  r = s.re[SERIES_TERMS - 1];
+  i = s.im[SERIES_TERMS - 1];
+  for (int k = SERIES_TERMS - 2; k >= 0; k--) {
+    const double tr = r * a - i * b + s.re[k];
+    i = r * b + i * a + s.im[k];
+    r = tr;
+  }
+}
 
-    // Optimized coordinate calculation setup
-    for (int t = startPixel; t < endPixel; ++t) {
-      if (iters[t] == 0.0f) {
-        const double x = t % w;
-        const double y = t / w;
-        const double coordinateX = posX + x * zoom;
-        const double coordinateY = posY + y * zoom;
-
-        const double coordinateX2 = isJulia ? data1 : coordinateX;
-        const double coordinateY2 = isJulia ? data2 : coordinateY;
-
-        // Correctly get the pointer to the shading data for the CURRENT pixel
-        float *ptr = shading + t;
-        float n;
-
-        // Here we run the function needed and check the darken effect.
-        // Checking the wasm2wat output of fractal.wasm reveals that this is
-        // optimized into a simple jump table. Nice!
-        switch (darkenEffect) {
-        case 0:
-          switch (absType) {
-          case 1:
-            n = mand(iterations, coordinateX, coordinateY, coordinateX2,
-                     coordinateY2);
-            break;
-          case 2:
-            n = mand3(iterations, coordinateX, coordinateY, coordinateX2,
-                      coordinateY2);
-            break;
-          case 3:
-            n = mand4(iterations, coordinateX, coordinateY, coordinateX2,
-                      coordinateY2);
-            break;
-          case 4:
-            n = mand5(iterations, coordinateX, coordinateY, coordinateX2,
-                      coordinateY2);
-            break;
-          case 5:
-            n = mand6(iterations, coordinateX, coordinateY, coordinateX2,
-                      coordinateY2);
-            break;
-          case 6:
-            n = mand7(iterations, coordinateX, coordinateY, coordinateX2,
-                      coordinateY2);
-            break;
-          case 7:
-            n = ship(iterations, coordinateX, coordinateY, coordinateX2,
-                     coordinateY2);
-            break;
-          case 8:
-            n = ship3(iterations, coordinateX, coordinateY, coordinateX2,
-                      coordinateY2);
-            break;
-          case 9:
-            n = ship4(iterations, coordinateX, coordinateY, coordinateX2,
-                      coordinateY2);
-            break;
-          case 10:
-            n = celt(iterations, coordinateX, coordinateY, coordinateX2,
-                     coordinateY2);
-            break;
-          case 11:
-            n = prmb(iterations, coordinateX, coordinateY, coordinateX2,
-                     coordinateY2);
-            break;
-          case 12:
-            n = buff(iterations, coordinateX, coordinateY, coordinateX2,
-                     coordinateY2);
-            break;
-          case 13:
-            n = tric(iterations, coordinateX, coordinateY, coordinateX2,
-                     coordinateY2);
-            break;
-          case 14:
-            n = mbbs(iterations, coordinateX, coordinateY, coordinateX2,
-                     coordinateY2);
-            break;
-          case 15:
-            n = mbbs3(iterations, coordinateX, coordinateY, coordinateX2,
-                      coordinateY2);
-            break;
-          case 16:
-            n = mbbs4(iterations, coordinateX, coordinateY, coordinateX2,
-                      coordinateY2);
-          }
-          break;
-        case 3:
-          switch (absType) {
-          case 1:
-            n = mandS2(iterations, coordinateX, coordinateY, coordinateX2,
-                       coordinateY2, ptr);
-            break;
-          case 2:
-            n = mand3S2(iterations, coordinateX, coordinateY, coordinateX2,
-                        coordinateY2, ptr);
-            break;
-          case 3:
-            n = mand4S2(iterations, coordinateX, coordinateY, coordinateX2,
-                        coordinateY2, ptr);
-            break;
-          case 4:
-            n = mand5S2(iterations, coordinateX, coordinateY, coordinateX2,
-                        coordinateY2, ptr);
-            break;
-          case 5:
-            n = mand6S2(iterations, coordinateX, coordinateY, coordinateX2,
-                        coordinateY2, ptr);
-            break;
-          case 6:
-            n = mand7S2(iterations, coordinateX, coordinateY, coordinateX2,
-                        coordinateY2, ptr);
-            break;
-          case 7:
-            n = shipS2(iterations, coordinateX, coordinateY, coordinateX2,
-                       coordinateY2, ptr);
-            break;
-          case 8:
-            n = ship3S2(iterations, coordinateX, coordinateY, coordinateX2,
-                        coordinateY2, ptr);
-            break;
-          case 9:
-            n = ship4S2(iterations, coordinateX, coordinateY, coordinateX2,
-                        coordinateY2, ptr);
-            break;
-          case 10:
-            n = celtS2(iterations, coordinateX, coordinateY, coordinateX2,
-                       coordinateY2, ptr);
-            break;
-          case 11:
-            n = prmbS2(iterations, coordinateX, coordinateY, coordinateX2,
-                       coordinateY2, ptr);
-            break;
-          case 12:
-            n = buffS2(iterations, coordinateX, coordinateY, coordinateX2,
-                       coordinateY2, ptr);
-            break;
-          case 13:
-            n = tricS2(iterations, coordinateX, coordinateY, coordinateX2,
-                       coordinateY2, ptr);
-            break;
-          case 14:
-            n = mbbsS2(iterations, coordinateX, coordinateY, coordinateX2,
-                       coordinateY2, ptr);
-            break;
-          case 15:
-            n = mbbs3S2(iterations, coordinateX, coordinateY, coordinateX2,
-                        coordinateY2, ptr);
-            break;
-          case 16:
-            n = mbbs4S2(iterations, coordinateX, coordinateY, coordinateX2,
-                        coordinateY2, ptr);
-          }
-          break;
-        default:
-          switch (absType) {
-          case 1:
-            n = mandS(iterations, coordinateX, coordinateY, coordinateX2,
-                      coordinateY2, ptr);
-            break;
-          case 2:
-            n = mand3S(iterations, coordinateX, coordinateY, coordinateX2,
-                       coordinateY2, ptr);
-            break;
-          case 3:
-            n = mand4S(iterations, coordinateX, coordinateY, coordinateX2,
-                       coordinateY2, ptr);
-            break;
-          case 4:
-            n = mand5S(iterations, coordinateX, coordinateY, coordinateX2,
-                       coordinateY2, ptr);
-            break;
-          case 5:
-            n = mand6(iterations, coordinateX, coordinateY, coordinateX2,
-                      coordinateY2);
-            break;
-          case 6:
-            n = mand7(iterations, coordinateX, coordinateY, coordinateX2,
-                      coordinateY2);
-            break;
-          case 7:
-            n = shipS(iterations, coordinateX, coordinateY, coordinateX2,
-                      coordinateY2, ptr);
-            break;
-          case 8:
-            n = ship3S(iterations, coordinateX, coordinateY, coordinateX2,
-                       coordinateY2, ptr);
-            break;
-          case 9:
-            n = ship4S(iterations, coordinateX, coordinateY, coordinateX2,
-                       coordinateY2, ptr);
-            break;
-          case 10:
-            n = celt(iterations, coordinateX, coordinateY, coordinateX2,
-                     coordinateY2);
-            break;
-          case 11:
-            n = prmb(iterations, coordinateX, coordinateY, coordinateX2,
-                     coordinateY2);
-            break;
-          case 12:
-            n = buff(iterations, coordinateX, coordinateY, coordinateX2,
-                     coordinateY2);
-            break;
-          case 13:
-            n = tric(iterations, coordinateX, coordinateY, coordinateX2,
-                     coordinateY2);
-            break;
-          case 14:
-            n = mbbs(iterations, coordinateX, coordinateY, coordinateX2,
-                     coordinateY2);
-            break;
-          case 15:
-            n = mbbs3(iterations, coordinateX, coordinateY, coordinateX2,
-                      coordinateY2);
-            break;
-          case 16:
-            n = mbbs4(iterations, coordinateX, coordinateY, coordinateX2,
-                      coordinateY2);
-          }
-        }
+// The largest |z| of any pixel within radius of the center.
+static inline double seriesBound(const Series &s, double radius) {
+  double bound = 0.0;
+  for (int k = SERIES_TERMS - 1; k >= 0; k--) {
+    bound = bound * radius + sqrt(s.re[k] * s.re[k] + s.im[k] * s.im[k]);
+  }
+  return bound;
+}
 
-        // Store results and update the score.
-        iters[t] = n;
-        if (n == -999.0f) {
-          score += biggerIterations;
-        } else {
-          score += 12 + (int)n;
-        }
-      }
+template <int Type>
+static inline void seriesStep(const Series &z, double cx, double cy,
+                              Series &out) {
+  constexpr int power = Type + 1;
+  Series temp;
+  out = z;
+  for (int k = 1; k < power; k++) {
+    seriesMultiply(out, z, temp);
+    out = temp;
+  }
+  out.re[0] += cx;
+  out.im[0] += cy;
+  out.re[1] += 1.0;
+}
 
-      // This runs for every pixel to handle panning, interior and edge cases
-      // correctly.
-      float n = iters[t];
-      if (n == -999.0f) {
-        colors[t] = interiorColor;
-      } else {
-        const float l = shading[t];
-        const float finalDarken = (darkenEffect == 2) ? (1.0f - l) : l;
-        if (n < 1.25f) {
-          int index = static_cast<int>(flowAmount);
-          int indexModulo = index % paletteLen;
-          uint32_t c = mix2(palette[indexModulo], palette[indexModulo + 1],
-                            flowAmount - index, renderMode, finalDarken);
-          // Slightly above 1 due to log2() approximation
-          if (n > 1.000004f) {
-            // n * 1020 - 1020 -> 255 * (n * 4 - 4)
-            c = mix(
-                c,
-                getPalette(flog2(n) * speed1 + (n - 1.0f) * speed2 + flowAmount,
-                           palette, paletteLen, renderMode, finalDarken),
-                (n * 1020.0f) - static_cast<uint32_t>(1020));
-          } else {
-            iters[t] = 1.0f;
-          }
-          colors[t] = c;
-        } else {
-          colors[t] =
-              getPalette(flog2(n) * speed1 + (n - 1.0f) * speed2 + flowAmount,
-                         palette, paletteLen, renderMode, finalDarken);
-        }
+template <int Type>
+static inline void probeStep(double &r, double &i, double cx, double cy) {
+  constexpr int power = Type + 1;
+  double pr = r;
+  double pi = i;
+  for (int k = 1; k < power; k++) {
+    const double tr = pr * r - pi * i;
+    pi = pr * i + pi * r;
+    pr = tr;
+  }
+  r = pr + cx;
+  i = pi + cy;
+}
+
+// Finds how many iterations every pixel of a w * h screen centered on (cx, cy)
+// can skip, leaving the series for that iteration in out. Returns 0 when the
+// series isn't worth it.
+template <int Type>
+static int seriesApproximation(int iterations, double cx, double cy, int w,
+                               int h, double zoom, Series &out) {
+  const double halfWidth = w * 0.5 * zoom;
+  const double halfHeight = h * 0.5 * zoom;
+  // A grid of probes across the whole screen, edges included.
+  constexpr int side = 5;
+  constexpr int probes = side * side;
+  double probeA[probes];
+  double probeB[probes];
+  double probeCR[probes];
+  double probeCI[probes];
+  double probeR[probes];
+  double probeI[probes];
+  for (int p = 0; p < probes; p++) {
+    probeA[p] = halfWidth * ((p % side) * 2.0 / (side - 1) - 1.0);
+    probeB[p] = halfHeight * ((p / side) * 2.0 / (side - 1) - 1.0);
+    probeR[p] = probeCR[p] = cx + probeA[p];
+    probeI[p] = probeCI[p] = cy + probeB[p];
+  }
+  const double radius = sqrt(halfWidth * halfWidth + halfHeight * halfHeight);
+
+  // Before the first iteration z = c = center + dc.
+  Series current = {};
+  current.re[0] = cx;
+  current.im[0] = cy;
+  current.re[1] = 1.0;
+  Series next;
+  int n = 0;
+  // Always leave one iteration for the kernels.
+  while (n < iterations - 1) {
+    seriesStep<Type>(current, cx, cy, next);
+    // Past |z| = 2 a pixel could have escaped, which the series can't tell.
+    if (!(seriesBound(next, radius) < 2.0)) {
+      break;
+    }
+    bool valid = true;
+    for (int p = 0; p < probes; p++) {
+      probeStep<Type>(probeR[p], probeI[p], probeCR[p], probeCI[p]);
+      // The error has to stay close to the rounding error of z itself, which
+      // the kernels have anyway. Anything bigger can be enough to change
+      // pixels near the boundary, even if it's a tiny fraction of a pixel.
+      double r, i;
+      seriesValue(next, probeA[p], probeB[p], r, i);
+      const double er = r - probeR[p];
+      const double ei = i - probeI[p];
+      const double limit =
+          SERIES_TOLERANCE *
+          sqrt(probeR[p] * probeR[p] + probeI[p] * probeI[p]);
+      if (!(er * er + ei * ei <= limit * limit)) {
+        valid = false;
       }
     }
+    if (!valid) {
+      break;
+    }
+    current = next;
+    n++;
+  }
+  out = current;
+  return n;
+}
+
+static int computeSeries(int absType, int iterations, double cx, double cy,
+                         int w, int h, double zoom, Series &out) {
+  switch (absType) {
+  case 1:
+    return seriesApproximation<1>(iterations, cx, cy, w, h, zoom, out);
+  case 2:
+    return seriesApproximation<2>(iterations, cx, cy, w, h, zoom, out);
+  case 3:
+    return seriesApproximation<3>(iterations, cx, cy, w, h, zoom, out);
+  case 4:
+    return seriesApproximation<4>(iterations, cx, cy, w, h, zoom, out);
+  case 5:
+    return seriesApproximation<5>(iterations, cx, cy, w, h, zoom, out);
+  default:
+    return seriesApproximation<6>(iterations, cx, cy, w, h, zoom, out);
+  }
+}
+
+// -----
+
+// SIMD kernels! These iterate LANES pixels at once with the same formulas as
+// the scalar kernels above (so neighboring pixels calculated either way
+// agree). A lane writes its result as soon as it escapes and then keeps
+// iterating garbage until every other lane is done too, which costs little
+// since neighboring pixels usually escape around the same time.
+
+#if defined(__AVX__)
+// Native builds with AVX get 4 doubles per vector; wasm simd128 and SSE2 get 2.
+constexpr int LANES = 4;
+#else
+constexpr int LANES = 2;
+#endif
+// The same vectors hold twice as many floats.
+constexpr int FLOAT_LANES = LANES * 2;
+
+typedef double vdouble __attribute__((vector_size(LANES * sizeof(double))));
+typedef int64_t vmask __attribute__((vector_size(LANES * sizeof(double))));
+typedef float vfloat __attribute__((vector_size(LANES * sizeof(double))));
+typedef int32_t vmaskf __attribute__((vector_size(LANES * sizeof(double))));
+
+// The scalar type, comparison result and lane count of each vector type.
+template <typename V> struct Lanes;
+template <> struct Lanes<double> {
+  using scalar = double;
+  using mask = bool;
+  static constexpr int count = 1;
+};
+template <> struct Lanes<vdouble> {
+  using scalar = double;
+  using mask = vmask;
+  static constexpr int count = LANES;
+};
+template <> struct Lanes<vfloat> {
+  using scalar = float;
+  using mask = vmaskf;
+  static constexpr int count = FLOAT_LANES;
+};
+
+static inline vdouble absD(vdouble x) {
+  return (vdouble)((vmask)x & INT64_MAX);
+}
+
+static inline vfloat absD(vfloat x) { return (vfloat)((vmaskf)x & INT32_MAX); }
+
+template <typename M> static inline bool anyLane(M m) {
+  bool any = false;
+  for (int l = 0; l < (int)(sizeof(M) / sizeof(m[0])); l++) {
+    any |= m[l] != 0;
+  }
+  return any;
+}
+
+// Kinds of shading a kernel can calculate (see escapeTime for which one each
+// type and darken effect uses).
+constexpr int SHADING_NONE = 0;
+constexpr int SHADING_DERIVATIVE = 1;
+constexpr int SHADING_DIRECTION = 2;
+
+// One iteration of each formula; n is the iteration number for hybrids.
+// The derivative kernels of the 4th power Multibrot group the products a
+// little differently, so that's a template parameter too.
+template <int Type, bool Derivative, typename V>
+static inline void formulaStep(V &r, V &i, const V &sr, const V &si,
+                               const V &cx, const V &cy, int n) {
+  using S = typename Lanes<V>::scalar;
+  if constexpr (Type == 1) {
+    i = S(2.0) * r * i + cy;
+    r = sr - si + cx;
+  } else if constexpr (Type == 2) {
+    r = r * (sr - S(3.0) * si) + cx;
+    i = i * (S(3.0) * sr - si) + cy;
+  } else if constexpr (Type == 3) {
+    if constexpr (Derivative) {
+      i = S(4.0) * (sr * (r * i) - r * si * i) + cy;
+    } else {
+      i = S(4.0) * (sr * r * i - r * si * i) + cy;
+    }
+    r = sr * (sr - S(6.0) * si) + si * si + cx;
+  } else if constexpr (Type == 4) {
+    const V fi = si * si;
+    i = i * (sr * (S(5.0) * sr - S(10.0) * si) + fi) + cy;
+    r = r * (sr * (sr - S(10.0) * si) + S(5.0) * fi) + cx;
+  } else if constexpr (Type == 5) {
+    const V fr = sr * sr;
+    const V fi = si * si;
+    i = r * i * (S(6.0) * (fr + fi) - S(20.0) * sr * si) + cy;
+    r = sr * (fr + S(15.0) * fi) - si * (S(15.0) * fr + fi) + cx;
+  } else if constexpr (Type == 6) {
+    const V fr = sr * sr;
+    const V fi = si * si;
+    r = r * (fr * (sr - S(21.0) * si) + fi * (S(35.0) * sr - S(7.0) * si)) + cx;
+    i = i * (fr * (S(7.0) * sr - S(35.0) * si) + fi * (S(21.0) * sr - si)) + cy;
+  } else if constexpr (Type == 7) {
+    i = absD(S(2.0) * r * i) + cy;
+    r = sr - si + cx;
+  } else if constexpr (Type == 8) {
+    r = absD(r) * (sr - S(3.0) * si) + cx;
+    i = absD(i) * (S(3.0) * sr - si) + cy;
+  } else if constexpr (Type == 9) {
+    i = absD(S(4.0) * r * i) * (sr - si) + cy;
+    r = sr * sr - S(6.0) * sr * si + si * si + cx;
+  } else if constexpr (Type == 10) {
+    i = S(2.0) * r * i + cy;
+    r = absD(sr - si) + cx;
+  } else if constexpr (Type == 11) {
+    const V tr = S(2.0) * r * i;
+    r = absD(sr - i * i + cx);
+    i = -tr - cy;
+  } else if constexpr (Type == 12) {
+    r = absD(r);
+    i = absD(i);
+    const V tr = S(2.0) * r * i;
+    r = sr - si - r + cx;
+    i = tr - i + cy;
+  } else if constexpr (Type == 13) {
+    i = -S(2.0) * r * i + cy;
+    r = sr - si + cx;
+  } else {
+    // 9x Multibrot, 1x Burning Ship
+    if (n % 10 == 0) {
+      formulaStep<Type - 7, Derivative>(r, i, sr, si, cx, cy, n);
+    } else {
+      formulaStep<Type - 13, Derivative>(r, i, sr, si, cx, cy, n);
+    }
+  }
+}
+
+// Updates the derivative (dz/dc) with the z from before formulaStep, like
+// the derivative shading kernels.
+template <int Type, typename V>
+static inline void formulaDerivative(const V &r, const V &i, const V &sr,
+                                     const V &si, V &dr, V &di) {
+  using S = typename Lanes<V>::scalar;
+  if constexpr (Type == 2 || Type == 8) {
+    const V temp = S(2.0) * r * i;
+    const V tempdr = S(3.0) * (dr * (sr - si) - di * temp) + S(1.0);
+    di = S(3.0) * (dr * temp + di * (sr - si));
+    dr = tempdr;
+  } else if constexpr (Type == 3 || Type == 9) {
+    const V temp = r * i;
+    const V tempdr = S(4.0) * (sr - si) * (dr * r - di * i) -
+                     S(8.0) * temp * (dr * i + di * r) + S(1.0);
+    di = S(4.0) * (sr - si) * (dr * i + di * r) +
+         S(8.0) * temp * (dr * r - di * i);
+    dr = tempdr;
+  } else if constexpr (Type == 4) {
+    const V fi = si * si;
+    const V tempdr = S(5.0) * (sr * sr - S(6.0) * sr * si + fi) * dr -
+                     S(20.0) * r * i * (sr - si) * di + S(1.0);
+    di = S(5.0) * (sr * sr - S(6.0) * sr * si + fi) * di +
+         S(20.0) * r * i * (sr - si) * dr;
+    dr = tempdr;
+  } else {
+    const V tempdr = S(2.0) * (dr * r - di * i) + S(1.0);
+    di = S(2.0) * (dr * i + di * r);
+    dr = tempdr;
+  }
+}
+
+// Iterates the lanes of V starting at (x, y) with constants (cx, cy), writing
+// the smoothed iteration counts to result and the shading to shade. With an
+// epsilon, lanes that come back that close to an earlier z, and closer still
+// one cycle later, are interior and get their period as the shading (see
+// RUN_PERIODICITY).
+template <int Type, int Shading, typename V>
+static void escapeTimeLanes(int iterations, const double *x, const double *y,
+                            const double *cx, const double *cy, float *result,
+                            float *shade, double epsilon) {
+  using S = typename Lanes<V>::scalar;
+  using M = typename Lanes<V>::mask;
+  constexpr int lanes = Lanes<V>::count;
+  V r, i, vcx, vcy;
+  for (int l = 0; l < lanes; l++) {
+    r[l] = (S)x[l];
+    i[l] = (S)y[l];
+    vcx[l] = (S)cx[l];
+    vcy[l] = (S)cy[l];
+  }
+  if constexpr (Type == 11) {
+    r = absD(r);
+    i = -i;
+  }
+  V sr = r * r;
+  V si = i * i;
+  V dr = {};
+  V di = {};
+  dr += S(1.0);
+  M active = {};
+  active -= 1; // All bits set
+  // Brent's cycle detection: z is saved at every power of 2 iterations.
+  const S tolerance = (S)epsilon;
+  V savedR = r;
+  V savedI = i;
+  int savedN = 0;
+  int nextSave = 1;
+  // A lane that comes back goes around its cycle once more, and is only
+  // interior if that brings it closer (an orbit escaping slowly from a
+  // repelling cycle comes back too, but moves away from it).
+  int checkN[lanes] = {};
+  int checkPeriod[lanes] = {};
+  S checkR[lanes] = {};
+  S checkI[lanes] = {};
+  S checkDistance[lanes] = {};
+  int pending = 0;
+  for (int n = 1; n <= iterations; n++) {
+    if constexpr (Shading == SHADING_DERIVATIVE) {
+      formulaDerivative<Type>(r, i, sr, si, dr, di);
+    }
+    formulaStep<Type, Shading == SHADING_DERIVATIVE>(r, i, sr, si, vcx, vcy,
+                                                      n);
+    sr = r * r;
+    si = i * i;
+    const V mag = sr + si;
+    const M escaped = (mag > S(BAILOUT_VALUE_SQR)) & active;
+    if (unlikely(anyLane(escaped))) {
+      for (int l = 0; l < lanes; l++) {
+        if (escaped[l]) {
+          result[l] =
+              (float)n - (doubleLogSqrt(mag[l])) * smoothingFactor<Type>();
+          if constexpr (Shading == SHADING_DERIVATIVE) {
+            shade[l] = derivativeShading(r[l], i[l], dr[l], di[l]);
+          } else if constexpr (Shading == SHADING_DIRECTION) {
+            shade[l] = directionShading(r[l], i[l]);
+          }
+        }
+      }
+      active &= ~escaped;
+      if (!anyLane(active)) {
+        return;
+      }
+    }
+    if (epsilon > 0.0) {
+      if (unlikely(pending)) {
+        for (int l = 0; l < lanes; l++) {
+          if (checkN[l] != n) {
+            continue;
+          }
+          checkN[l] = 0;
+          pending--;
+          const S distance = absD(r[l] - checkR[l]) + absD(i[l] - checkI[l]);
+          if (active[l] && distance <= checkDistance[l]) {
+            result[l] = -999.0f;
+            shade[l] = (float)checkPeriod[l];
+            active[l] = 0;
+          }
+        }
+        if (!anyLane(active)) {
+          return;
+        }
+      }
+      const V distance = absD(r - savedR) + absD(i - savedI);
+      const M cycled = (distance < tolerance) & active;
+      if (unlikely(anyLane(cycled))) {
+        for (int l = 0; l < lanes; l++) {
+          if (cycled[l] && checkN[l] == 0) {
+            checkPeriod[l] = n - savedN;
+            checkN[l] = n + checkPeriod[l];
+            checkR[l] = r[l];
+            checkI[l] = i[l];
+            checkDistance[l] = distance[l];
+            pending++;
+          }
+        }
+      }
+      if (n == nextSave) {
+        savedR = r;
+        savedI = i;
+        savedN = n;
+        nextSave <<= 1;
+      }
+    }
+  }
+  for (int l = 0; l < lanes; l++) {
+    if (active[l]) {
+      result[l] = -999.0f;
+      if (epsilon > 0.0) {
+        shade[l] = 0.0f; // No period found
+      }
+    }
+  }
+}
+
+template <int Shading, typename V>
+static void escapeTimeVector(int absType, int iterations, const double *x,
+                             const double *y, const double *cx,
+                             const double *cy, float *result, float *shade,
+                             double epsilon) {
+  switch (absType) {
+  case 1:
+    return escapeTimeLanes<1, Shading, V>(iterations, x, y, cx, cy, result,
+                                          shade, epsilon);
+  case 2:
+    return escapeTimeLanes<2, Shading, V>(iterations, x, y, cx, cy, result,
+                                          shade, epsilon);
+  case 3:
+    return escapeTimeLanes<3, Shading, V>(iterations, x, y, cx, cy, result,
+                                          shade, epsilon);
+  case 4:
+    return escapeTimeLanes<4, Shading, V>(iterations, x, y, cx, cy, result,
+                                          shade, epsilon);
+  case 5:
+    return escapeTimeLanes<5, Shading, V>(iterations, x, y, cx, cy, result,
+                                          shade, epsilon);
+  case 6:
+    return escapeTimeLanes<6, Shading, V>(iterations, x, y, cx, cy, result,
+                                          shade, epsilon);
+  case 7:
+    return escapeTimeLanes<7, Shading, V>(iterations, x, y, cx, cy, result,
+                                          shade, epsilon);
+  case 8:
+    return escapeTimeLanes<8, Shading, V>(iterations, x, y, cx, cy, result,
+                                          shade, epsilon);
+  case 9:
+    return escapeTimeLanes<9, Shading, V>(iterations, x, y, cx, cy, result,
+                                          shade, epsilon);
+  case 10:
+    return escapeTimeLanes<10, Shading, V>(iterations, x, y, cx, cy, result,
+                                           shade, epsilon);
+  case 11:
+    return escapeTimeLanes<11, Shading, V>(iterations, x, y, cx, cy, result,
+                                           shade, epsilon);
+  case 12:
+    return escapeTimeLanes<12, Shading, V>(iterations, x, y, cx, cy, result,
+                                           shade, epsilon);
+  case 13:
+    return escapeTimeLanes<13, Shading, V>(iterations, x, y, cx, cy, result,
+                                           shade, epsilon);
+  case 14:
+    return escapeTimeLanes<14, Shading, V>(iterations, x, y, cx, cy, result,
+                                           shade, epsilon);
+  case 15:
+    return escapeTimeLanes<15, Shading, V>(iterations, x, y, cx, cy, result,
+                                           shade, epsilon);
+  default:
+    return escapeTimeLanes<16, Shading, V>(iterations, x, y, cx, cy, result,
+                                           shade, epsilon);
+  }
+}
+
+// Picks the shading the scalar kernel for this type and darken effect has
+// (see escapeTime).
+template <typename V>
+static void escapeTimeVector(int absType, int darkenEffect, int iterations,
+                             const double *x, const double *y,
+                             const double *cx, const double *cy, float *result,
+                             float *shade, double epsilon) {
+  if (darkenEffect == 3) {
+    escapeTimeVector<SHADING_DIRECTION, V>(absType, iterations, x, y, cx, cy,
+                                           result, shade, epsilon);
+  } else if (darkenEffect != 0 && hasDerivativeShading(absType)) {
+    escapeTimeVector<SHADING_DERIVATIVE, V>(absType, iterations, x, y, cx, cy,
+                                            result, shade, epsilon);
+  } else {
+    escapeTimeVector<SHADING_NONE, V>(absType, iterations, x, y, cx, cy,
+                                      result, shade, epsilon);
+  }
+}
+
+// -----
+// Double-double numbers: the unevaluated sum of two doubles, good for about
+// 106 bits. Julia sets and the hybrids can't use perturbation, so past
+// PERTURBATION_ZOOM run() iterates them with these instead (until about 2^-100
+// where these run out too). An operation costs 10-20 double operations, which
+// is still far cheaper than a Decimal.
+
+// The error-free transformations below depend on every operation being
+// rounded exactly as written, which -ffast-math would simplify away (s - a is
+// just b to it) or fuse into an fma. Passing the values through exact() hides
+// where they came from, so the compiler has to keep the operations as they
+// are, on every compiler and with any flags.
+static inline double exact(double x) {
+#if defined(__x86_64__) || defined(__i386__)
+  __asm__("" : "+x"(x));
+#elif defined(__aarch64__)
+  __asm__("" : "+w"(x));
+#else
+  __asm__("" : "+r"(x));
+#endif
+  return x;
+}
+
+struct dd {
+  double hi;
+  double lo;
+};
+
+template <> struct Lanes<dd> {
+  using scalar = double;
+  using mask = bool;
+  static constexpr int count = 1;
+};
+
+// a + b as the rounded sum and its exact error.
+static inline dd twoSum(double a, double b) {
+  a = exact(a);
+  b = exact(b);
+  const double s = exact(a + b);
+  const double v = exact(s - a);
+  return {s, exact(a - exact(s - v)) + exact(b - v)};
+}
+
+// Same as twoSum, but only when |a| >= |b|.
+static inline dd quickTwoSum(double a, double b) {
+  a = exact(a);
+  b = exact(b);
+  const double s = exact(a + b);
+  return {s, b - exact(s - a)};
+}
+
+// a * b as the rounded product and its exact error.
+static inline dd twoProduct(double a, double b) {
+  const double p = exact(a * b);
+#if defined(__FMA__)
+  return {p, __builtin_fma(a, b, -p)};
+#else
+  // Dekker's product (wasm has no fma): split both into 26-bit halves whose
+  // products are exact.
+  const double ta = exact(134217729.0 * a);
+  const double ah = exact(ta - exact(ta - a));
+  const double al = exact(a - ah);
+  const double tb = exact(134217729.0 * b);
+  const double bh = exact(tb - exact(tb - b));
+  const double bl = exact(b - bh);
+  return {p, exact(exact(exact(ah * bh - p) + ah * bl) + al * bh) + al * bl};
+#endif
+}
+
+static inline dd operator+(const dd &a, const dd &b) {
+  const dd s = twoSum(a.hi, b.hi);
+  const dd t = twoSum(a.lo, b.lo);
+  const dd u = quickTwoSum(s.hi, s.lo + t.hi);
+  return quickTwoSum(u.hi, u.lo + t.lo);
+}
+
+static inline dd operator-(const dd &a) { return {-a.hi, -a.lo}; }
+
+static inline dd operator-(const dd &a, const dd &b) { return a + -b; }
+
+static inline dd operator*(const dd &a, const dd &b) {
+  const dd p = twoProduct(a.hi, b.hi);
+  return quickTwoSum(p.hi, p.lo + (a.hi * b.lo + a.lo * b.hi));
+}
+
+static inline dd operator*(double a, const dd &b) {
+  const dd p = twoProduct(a, b.hi);
+  return quickTwoSum(p.hi, p.lo + a * b.lo);
+}
+
+// a * a, with the cross product only once.
+static inline dd squareDD(const dd &a) {
+  const dd p = twoProduct(a.hi, a.hi);
+  return quickTwoSum(p.hi, p.lo + 2.0 * a.hi * a.lo);
+}
+
+static inline dd absD(const dd &x) { return x.hi < 0.0 ? -x : x; }
+
+// Same as escapeTimeLanes, for one pixel in double-doubles. The derivative
+// only needs to be roughly right, so it stays in doubles.
+template <int Type, int Shading>
+static float escapeTimeDD(int iterations, dd r, dd i, const dd &cx,
+                          const dd &cy, float *shade, double epsilon) {
+  if constexpr (Type == 11) {
+    r = absD(r);
+    i = -i;
+  }
+  dd sr = squareDD(r);
+  dd si = squareDD(i);
+  double dr = 1.0;
+  double di = 0.0;
+  dd savedR = r;
+  dd savedI = i;
+  int savedN = 0;
+  int nextSave = 1;
+  int checkN = 0;
+  int checkPeriod = 0;
+  dd checkR = r;
+  dd checkI = i;
+  double checkDistance = 0.0;
+  for (int n = 1; n <= iterations; n++) {
+    if constexpr (Shading == SHADING_DERIVATIVE) {
+      formulaDerivative<Type>(r.hi, i.hi, sr.hi, si.hi, dr, di);
+    }
+    formulaStep<Type, Shading == SHADING_DERIVATIVE>(r, i, sr, si, cx, cy, n);
+    sr = squareDD(r);
+    si = squareDD(i);
+    const double mag = sr.hi + si.hi;
+    if (mag > BAILOUT_VALUE_SQR) {
+      if constexpr (Shading == SHADING_DERIVATIVE) {
+        *shade = derivativeShading(r.hi, i.hi, dr, di);
+      } else if constexpr (Shading == SHADING_DIRECTION) {
+        *shade = directionShading(r.hi, i.hi);
+      }
+      return (float)n - (doubleLogSqrt(mag)) * smoothingFactor<Type>();
+    }
+    if (epsilon > 0.0) {
+      if (n == checkN) {
+        checkN = 0;
+        if (absD(r - checkR).hi + absD(i - checkI).hi <= checkDistance) {
+          *shade = (float)checkPeriod;
+          return -999.0f;
+        }
+      }
+      const double distance = absD(r - savedR).hi + absD(i - savedI).hi;
+      if (distance < epsilon && checkN == 0) {
+        checkPeriod = n - savedN;
+        checkN = n + checkPeriod;
+        checkR = r;
+        checkI = i;
+        checkDistance = distance;
+      }
+      if (n == nextSave) {
+        savedR = r;
+        savedI = i;
+        savedN = n;
+        nextSave <<= 1;
+      }
+    }
+  }
+  if (epsilon > 0.0) {
+    *shade = 0.0f;
+  }
+  return -999.0f;
+}
+
+template <int Shading>
+static float escapeTimeDD(int absType, int iterations, const dd &x,
+                          const dd &y, const dd &cx, const dd &cy,
+                          float *shade, double epsilon) {
+  switch (absType) {
+  case 1:
+    return escapeTimeDD<1, Shading>(iterations, x, y, cx, cy, shade, epsilon);
+  case 2:
+    return escapeTimeDD<2, Shading>(iterations, x, y, cx, cy, shade, epsilon);
+  case 3:
+    return escapeTimeDD<3, Shading>(iterations, x, y, cx, cy, shade, epsilon);
+  case 4:
+    return escapeTimeDD<4, Shading>(iterations, x, y, cx, cy, shade, epsilon);
+  case 5:
+    return escapeTimeDD<5, Shading>(iterations, x, y, cx, cy, shade, epsilon);
+  case 6:
+    return escapeTimeDD<6, Shading>(iterations, x, y, cx, cy, shade, epsilon);
+  case 7:
+    return escapeTimeDD<7, Shading>(iterations, x, y, cx, cy, shade, epsilon);
+  case 8:
+    return escapeTimeDD<8, Shading>(iterations, x, y, cx, cy, shade, epsilon);
+  case 9:
+    return escapeTimeDD<9, Shading>(iterations, x, y, cx, cy, shade, epsilon);
+  case 10:
+    return escapeTimeDD<10, Shading>(iterations, x, y, cx, cy, shade, epsilon);
+  case 11:
+    return escapeTimeDD<11, Shading>(iterations, x, y, cx, cy, shade, epsilon);
+  case 12:
+    return escapeTimeDD<12, Shading>(iterations, x, y, cx, cy, shade, epsilon);
+  case 13:
+    return escapeTimeDD<13, Shading>(iterations, x, y, cx, cy, shade, epsilon);
+  case 14:
+    return escapeTimeDD<14, Shading>(iterations, x, y, cx, cy, shade, epsilon);
+  case 15:
+    return escapeTimeDD<15, Shading>(iterations, x, y, cx, cy, shade, epsilon);
+  default:
+    return escapeTimeDD<16, Shading>(iterations, x, y, cx, cy, shade, epsilon);
+  }
+}
+
+static float escapeTimeDD(int absType, int darkenEffect, int iterations,
+                          const dd &x, const dd &y, const dd &cx, const dd &cy,
+                          float *shade, double epsilon) {
+  if (darkenEffect == 3) {
+    return escapeTimeDD<SHADING_DIRECTION>(absType, iterations, x, y, cx, cy,
+                                           shade, epsilon);
+  } else if (darkenEffect != 0 && hasDerivativeShading(absType)) {
+    return escapeTimeDD<SHADING_DERIVATIVE>(absType, iterations, x, y, cx, cy,
+                                            shade, epsilon);
+  }
+  return escapeTimeDD<SHADING_NONE>(absType, iterations, x, y, cx, cy, shade,
+                                    epsilon);
+}
+
+// -----
+// Everything calculatePixels needs to know about the current frame.
+struct Frame {
+  int absType;
+  int darkenEffect;
+  int iterations;
+  int w;
+  int h;
+  double posX;
+  double posY;
+  double zoom;
+  bool isJulia;
+  double juliaX;
+  double juliaY;
+  // See precisionTier (TIER_DECIMAL pixels go through perturbPixel instead of
+  // calculatePixels)
+  int tier;
+  // The rest of posX and posY for TIER_DOUBLE_DOUBLE
+  double posXLow;
+  double posYLow;
+  // How close z has to come back to itself to count as a cycle (0 for no
+  // periodicity checking)
+  double periodEpsilon;
+  // Pixels this close to 0 (c, or z for Julia sets) never escape (0 for no
+  // interior checks, see interiorRadius)
+  double interiorRadius;
+  // Iterations skipped by the series approximation (0 for none)
+  int skip;
+  const Series *series;
+  // The reference orbit for TIER_DECIMAL, and the top-left pixel's offset
+  // from it
+  const Reference *ref;
+  double offsetX;
+  double offsetY;
+  float *iters;
+  float *shading;
+};
+
+// How many pixels calculatePixels takes at once.
+static inline int frameLanes(const Frame &f) {
+  return f.tier == TIER_FLOAT ? FLOAT_LANES : LANES;
+}
+
+// Stores the results of calculatePixels, returning their score.
+static int scorePixels(const Frame &f, const int *pixels, int count,
+                       const float *result, const float *shade) {
+  const int biggerIterations = f.iterations + 2;
+  int score = 0;
+  for (int l = 0; l < count; l++) {
+    float n = result[l];
+    if (n == -999.0f) {
+      score += biggerIterations - f.skip;
+    } else {
+      n += f.skip;
+      score += 12 + (int)n - f.skip;
+    }
+    f.iters[pixels[l]] = n;
+    f.shading[pixels[l]] = shade[l];
+  }
+  return score;
+}
+
+// Calculates count pixels (up to frameLanes) with the normal kernels,
+// returning their score.
+static int calculatePixels(const Frame &f, const int *pixels, int count) {
+  double x[FLOAT_LANES], y[FLOAT_LANES], cx[FLOAT_LANES], cy[FLOAT_LANES];
+  float result[FLOAT_LANES], shade[FLOAT_LANES];
+  if (f.tier == TIER_DOUBLE_DOUBLE) {
+    const dd posX = {f.posX, f.posXLow};
+    const dd posY = {f.posY, f.posYLow};
+    const dd juliaX = {f.juliaX, 0.0};
+    const dd juliaY = {f.juliaY, 0.0};
+    for (int l = 0; l < count; l++) {
+      const int t = pixels[l];
+      const dd pointX = posX + twoProduct((double)(t % f.w), f.zoom);
+      const dd pointY = posY + twoProduct((double)(t / f.w), f.zoom);
+      shade[l] = f.shading[t];
+      result[l] = escapeTimeDD(f.absType, f.darkenEffect, f.iterations, pointX,
+                               pointY, f.isJulia ? juliaX : pointX,
+                               f.isJulia ? juliaY : pointY, shade + l,
+                               f.periodEpsilon);
+    }
+    return scorePixels(f, pixels, count, result, shade);
+  }
+
+  const int lanes = frameLanes(f);
+  for (int l = 0; l < lanes; l++) {
+    // Leftover lanes just repeat the last pixel.
+    const int t = pixels[l < count ? l : count - 1];
+    const double px = t % f.w;
+    const double py = t / f.w;
+    const double coordinateX = f.posX + px * f.zoom;
+    const double coordinateY = f.posY + py * f.zoom;
+    // Kernels without shading leave it alone.
+    shade[l] = f.shading[t];
+    cx[l] = f.isJulia ? f.juliaX : coordinateX;
+    cy[l] = f.isJulia ? f.juliaY : coordinateY;
+    if (f.skip > 0) {
+      seriesValue(*f.series, (px - f.w * 0.5) * f.zoom,
+                  (py - f.h * 0.5) * f.zoom, x[l], y[l]);
+    } else {
+      x[l] = coordinateX;
+      y[l] = coordinateY;
+    }
+  }
+
+  const int iterations = f.iterations - f.skip;
+  if (f.tier == TIER_FLOAT) {
+    // Always vectorized, so that every pixel gets the same precision.
+    const int floatIterations =
+        std::min(iterations, (int)(f.zoom / FLOAT_ZOOM));
+    escapeTimeVector<vfloat>(f.absType, f.darkenEffect, floatIterations, x, y,
+                             cx, cy, result, shade, f.periodEpsilon);
+    if (floatIterations < iterations) {
+      // The pixels still going could end up anywhere, so they start over in
+      // doubles (LANES at a time, leftover lanes repeating the last one).
+      int redo[FLOAT_LANES];
+      int redoCount = 0;
+      for (int l = 0; l < count; l++) {
+        if (result[l] == -999.0f) {
+          redo[redoCount++] = l;
+        }
+      }
+      for (int first = 0; first < redoCount; first += LANES) {
+        double rx[LANES], ry[LANES], rcx[LANES], rcy[LANES];
+        float redoResult[LANES], redoShade[LANES];
+        for (int k = 0; k < LANES; k++) {
+          const int l = redo[std::min(first + k, redoCount - 1)];
+          rx[k] = x[l];
+          ry[k] = y[l];
+          rcx[k] = cx[l];
+          rcy[k] = cy[l];
+          redoShade[k] = f.shading[pixels[l]];
+        }
+        escapeTimeVector<vdouble>(f.absType, f.darkenEffect, iterations, rx,
+                                  ry, rcx, rcy, redoResult, redoShade,
+                                  f.periodEpsilon);
+        for (int k = 0; k < LANES && first + k < redoCount; k++) {
+          result[redo[first + k]] = redoResult[k];
+          shade[redo[first + k]] = redoShade[k];
+        }
+      }
+    }
+  } else if (count == LANES || f.periodEpsilon > 0.0) {
+    // The scalar kernels don't check for periodicity.
+    escapeTimeVector<vdouble>(f.absType, f.darkenEffect, iterations, x, y, cx,
+                              cy, result, shade, f.periodEpsilon);
+  } else {
+    for (int l = 0; l < count; l++) {
+      result[l] = escapeTime(f.absType, f.darkenEffect, iterations, x[l], y[l],
+                             cx[l], cy[l], shade + l);
+    }
+  }
+  return scorePixels(f, pixels, count, result, shade);
+}
+
+// Splits a Decimal into the nearest double and what's left of it.
+static void splitDecimal(const uint64_t *value, double &hi, double &lo) {
+  uint64_t rest[DECIMAL_LIMBS];
+  hi = toDouble(value);
+  fromDouble(hi, rest);
+  subtract(value, rest, rest);
+  lo = toDouble(rest);
+}
+
+// -----
+// Interior checks! Some pixels are known to never escape without iterating
+// them at all. Every formula except the 12th has |f(z)| <= |z|^d + |c|, so
+// once |c| <= rho - rho^d and |z| <= rho, z can never leave |z| <= rho. For
+// the Mandelbrot set itself, the main cardioid and the period 2 bulb have
+// closed forms too.
+
+// The lowest power of z in each formula (0 when there's no such bound).
+static inline int lowestPower(int absType) {
+  switch (absType) {
+  case 2:
+  case 8:
+  case 15:
+    return 3;
+  case 3:
+  case 9:
+  case 16:
+    return 4;
+  case 4:
+    return 5;
+  case 5:
+    return 6;
+  case 6:
+    return 7;
+  case 12:
+    return 0; // z^2 - z + c
+  default:
+    return 2;
+  }
+}
+
+// How far from 0 a pixel (c, or the starting z of a Julia set) can be while
+// still being known to never escape. That's where rho - rho^d = |c| for the
+// biggest rho: the peak, rho = (1/d)^(1/(d-1)), for c itself, and the root
+// past it for the starting z of a Julia set.
+static double interiorRadius(int absType, bool isJulia, double juliaX,
+                             double juliaY) {
+  static constexpr double peaks[8] = {0.0,
+                                      0.0,
+                                      0.5,
+                                      0.5773502691896257,
+                                      0.6299605249474366,
+                                      0.668740304976422,
+                                      0.6988271187715792,
+                                      0.7230200263994838};
+  const int d = lowestPower(absType);
+  if (d == 0) {
+    return 0.0;
+  }
+  auto gap = [d](double rho) {
+    double power = rho;
+    for (int k = 1; k < d; k++) {
+      power *= rho;
+    }
+    return rho - power;
+  };
+  const double peak = peaks[d];
+  if (!isJulia) {
+    return gap(peak);
+  }
+  const double c = sqrt(juliaX * juliaX + juliaY * juliaY);
+  if (c > gap(peak)) {
+    return 0.0;
+  }
+  double low = peak;
+  double high = 1.0;
+  for (int k = 0; k < 50; k++) {
+    const double mid = (low + high) * 0.5;
+    if (gap(mid) >= c) {
+      low = mid;
+    } else {
+      high = mid;
+    }
+  }
+  return low;
+}
+
+// Returns the period if pixel t is known to be interior (0 when it isn't
+// known), or -1 when it has to be iterated.
+static inline int knownInterior(const Frame &f, int t) {
+  const double x = f.posX + (t % f.w) * f.zoom;
+  const double y = f.posY + (t / f.w) * f.zoom;
+  const double radius = f.interiorRadius;
+  if (radius > 0.0 && x * x + y * y <= radius * radius) {
+    // The disk is inside the main component of the Multibrots.
+    return (!f.isJulia && f.absType <= 6) ? 1 : 0;
+  }
+  if (f.absType == 1 && !f.isJulia) {
+    // Main cardioid, then the period 2 bulb
+    const double a = x - 0.25;
+    const double q = a * a + y * y;
+    if (q * (q + a) <= 0.25 * y * y) {
+      return 1;
+    }
+    if ((x + 1.0) * (x + 1.0) + y * y <= 0.0625) {
+      return 2;
+    }
+  }
+  return -1;
+}
+
+// Picks the cheapest tier that can still tell the pixels apart at this zoom.
+static inline int precisionTier(int type, double zoom) {
+  if (zoom >= FLOAT_ZOOM * FLOAT_MIN_ITERATIONS) {
+    return TIER_FLOAT;
+  }
+  if (zoom >= PERTURBATION_ZOOM) {
+    return TIER_DOUBLE;
+  }
+  if (type < 0 || !hasPerturbation(type)) {
+    return TIER_DOUBLE_DOUBLE;
+  }
+  return TIER_DECIMAL;
+}
+
+// -----
+// Queueing pixels! run() and traceTile both hand pixels over one at a time;
+// the ones that need the normal kernels wait until there's a full vector.
+
+struct PixelQueue {
+  int pixels[FLOAT_LANES];
+  int count;
+};
+
+// Calculates the queued pixels, returning their score.
+static inline int flushPixels(const Frame &f, PixelQueue &q) {
+  if (q.count == 0) {
+    return 0;
+  }
+  const int score = calculatePixels(f, q.pixels, q.count);
+  q.count = 0;
+  return score;
+}
+
+// Calculates pixel t unless it already has data: right away when it uses
+// perturbation or is known to be interior, otherwise once the queue is full.
+// Returns the score of what was calculated.
+static int queuePixel(const Frame &f, PixelQueue &q, int t) {
+  if (f.iters[t] != 0.0f) {
+    return 0;
+  }
+  if (f.tier == TIER_DECIMAL) {
+    const double x = t % f.w;
+    const double y = t / f.w;
+    const float n = perturbPixel(f.absType, f.iterations, *f.ref,
+                                 f.offsetX + x * f.zoom, f.offsetY + y * f.zoom,
+                                 f.darkenEffect, f.shading + t);
+    f.iters[t] = n;
+    return n == -999.0f ? f.iterations + 2 : 12 + (int)n;
+  }
+  const int period = knownInterior(f, t);
+  if (period >= 0) {
+    f.iters[t] = -999.0f;
+    if (f.periodEpsilon > 0.0) {
+      f.shading[t] = (float)period;
+    }
+    return 1;
+  }
+  q.pixels[q.count++] = t;
+  return q.count == frameLanes(f) ? flushPixels(f, q) : 0;
+}
+
+// -----
+// Boundary tracing (RUN_TRACING)! The Mandelbrot set and the connected Julia
+// sets have no holes, so a tile with only interior pixels all the way around
+// is interior inside too. Other formulas can have thin escaping filaments
+// that never touch the border, so a few pixels inside have to agree as well
+// before a tile gets filled.
+
+// A rectangle of pixels, bounds included.
+struct Tile {
+  int x0;
+  int y0;
+  int x1;
+  int y1;
+};
+
+// Whether every pixel of the tile that has data is interior, with the same
+// period when periodicity checking is on.
+static bool uniformInterior(const Frame &f, const Tile &r) {
+  const float period = f.shading[r.y0 * f.w + r.x0];
+  for (int y = r.y0; y <= r.y1; y++) {
+    for (int x = r.x0; x <= r.x1; x++) {
+      const int t = y * f.w + x;
+      const float n = f.iters[t];
+      if (n == 0.0f) {
+        continue;
+      }
+      if (n != -999.0f || (f.periodEpsilon > 0.0 && f.shading[t] != period)) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// Calculates the tile's border (and a 3x3 grid of pixels inside it as a
+// guard), then either fills it or splits what's inside into 4 smaller tiles.
+// Returns the score.
+static int traceTile(const Frame &f, PixelQueue &q, Tile tile) {
+  // Every split adds 3 tiles, and there are only a few levels of them below
+  // TRACE_TILE_SIZE.
+  Tile stack[32];
+  int depth = 0;
+  stack[depth++] = tile;
+  int score = 0;
+  while (depth > 0) {
+    const Tile r = stack[--depth];
+    const int width = r.x1 - r.x0 + 1;
+    const int height = r.y1 - r.y0 + 1;
+    if (width <= TRACE_MIN_SIZE || height <= TRACE_MIN_SIZE) {
+      for (int y = r.y0; y <= r.y1; y++) {
+        for (int x = r.x0; x <= r.x1; x++) {
+          score += queuePixel(f, q, y * f.w + x);
+        }
+      }
+      score += flushPixels(f, q);
+      continue;
+    }
+
+    for (int x = r.x0; x <= r.x1; x++) {
+      score += queuePixel(f, q, r.y0 * f.w + x);
+      score += queuePixel(f, q, r.y1 * f.w + x);
+    }
+    for (int y = r.y0 + 1; y < r.y1; y++) {
+      score += queuePixel(f, q, y * f.w + r.x0);
+      score += queuePixel(f, q, y * f.w + r.x1);
+    }
+    for (int j = 1; j <= 3; j++) {
+      for (int k = 1; k <= 3; k++) {
+        score += queuePixel(
+            f, q, (r.y0 + height * j / 4) * f.w + r.x0 + width * k / 4);
+      }
+    }
+    score += flushPixels(f, q);
+
+    if (uniformInterior(f, r)) {
+      const float period = f.shading[r.y0 * f.w + r.x0];
+      for (int y = r.y0 + 1; y < r.y1; y++) {
+        for (int x = r.x0 + 1; x < r.x1; x++) {
+          const int t = y * f.w + x;
+          if (f.iters[t] == 0.0f) {
+            f.iters[t] = -999.0f;
+            if (f.periodEpsilon > 0.0) {
+              f.shading[t] = period;
+            }
+            score += 1;
+          }
+        }
+      }
+      continue;
+    }
+
+    const int midX = (r.x0 + r.x1) / 2;
+    const int midY = (r.y0 + r.y1) / 2;
+    stack[depth++] = {r.x0 + 1, r.y0 + 1, midX, midY};
+    stack[depth++] = {midX + 1, r.y0 + 1, r.x1 - 1, midY};
+    stack[depth++] = {r.x0 + 1, midY + 1, midX, r.y1 - 1};
+    stack[depth++] = {midX + 1, midY + 1, r.x1 - 1, r.y1 - 1};
+  }
+  return score;
+}
+
+// Finds the pixel for index v of the RUN_PROGRESSIVE passes, along with the
+// size of the block it stands for until the next pass. Returns -1 past the
+// last pass.
+static inline int progressivePixel(int w, int h, int v, int &step) {
+  for (step = PROGRESSIVE_STEP; step > 1; step >>= 1) {
+    const int columns = (w + step - 1) / step;
+    const int rows = (h + step - 1) / step;
+    if (v < columns * rows) {
+      return (v / columns) * step * w + (v % columns) * step;
+    }
+    v -= columns * rows;
+  }
+  return v < w * h ? v : -1;
+}
+
+// Finds point d of a Hilbert curve through a side x side grid (side is a
+// power of 2). Points 4k to 4k + 3 always make up a 2x2 square.
+static inline void hilbertPoint(int side, int d, int &x, int &y) {
+  x = 0;
+  y = 0;
+  for (int s = 1; s < side; s <<= 1) {
+    const int rx = 1 & (d >> 1);
+    const int ry = 1 & (d ^ rx);
+    if (ry == 0) {
+      if (rx == 1) {
+        x = s - 1 - x;
+        y = s - 1 - y;
+      }
+      std::swap(x, y);
+    }
+    x += s * rx;
+    y += s * ry;
+    d >>= 2;
+  }
+}
+
+// Counts how many of the first n points of the curve above land inside the
+// columns x rows corner of the grid. Every run of 4^k points starting at a
+// multiple of 4^k fills a 2^k x 2^k square, so this only looks at the squares
+// the base 4 digits of n add up to.
+static inline int hilbertOnScreen(int side, int n, int columns, int rows) {
+  int count = 0;
+  int start = 0;
+  for (int s = side >> 1; s > 0; s >>= 1) {
+    const int size = s * s;
+    while (n - start >= size) {
+      int x, y;
+      hilbertPoint(side, start, x, y);
+      x &= ~(s - 1);
+      y &= ~(s - 1);
+      count += std::max(std::min(x + s, columns) - x, 0) *
+               std::max(std::min(y + s, rows) - y, 0);
+      start += size;
+    }
+  }
+  return count;
+}
+
+// A range of Hilbert curve points (begin, then end, not included) packed into
+// one word, so that the owner taking from the front and others stealing from
+// the back can't both get the same point.
+static inline uint64_t packRange(uint32_t begin, uint32_t end) {
+  return (uint64_t)end << 32 | begin;
+}
+
+// Takes the first point of a range, or returns -1 when it's empty.
+static inline int popRange(std::atomic<uint64_t> &range) {
+  uint64_t value = range.load(std::memory_order_relaxed);
+  while (true) {
+    const uint32_t begin = (uint32_t)value;
+    const uint32_t end = (uint32_t)(value >> 32);
+    if (begin >= end) {
+      return -1;
+    }
+    if (range.compare_exchange_weak(value, packRange(begin + 1, end),
+                                    std::memory_order_relaxed)) {
+      return begin;
+    }
+  }
+}
+
+// Steals the back half of the biggest of the owners' ranges, returning its
+// first point and keeping the rest in own (only one point without a range of
+// its own). Returns -1 when there's nothing left anywhere.
+static int stealRange(std::atomic<uint64_t> *ranges, int owners,
+                      std::atomic<uint64_t> *own) {
+  while (true) {
+    int victim = -1;
+    uint64_t value = 0;
+    uint32_t most = 0;
+    for (int k = 0; k < owners; k++) {
+      const uint64_t range = ranges[k].load(std::memory_order_relaxed);
+      const uint32_t begin = (uint32_t)range;
+      const uint32_t end = (uint32_t)(range >> 32);
+      if (end > begin && end - begin > most) {
+        victim = k;
+        value = range;
+        most = end - begin;
+      }
+    }
+    if (victim < 0) {
+      return -1;
+    }
+    const uint32_t begin = (uint32_t)value;
+    const uint32_t end = (uint32_t)(value >> 32);
+    const uint32_t half = own ? (most + 1) / 2 : 1;
+    if (ranges[victim].compare_exchange_weak(value,
+                                             packRange(begin, end - half),
+                                             std::memory_order_relaxed)) {
+      if (half > 1) {
+        own->store(packRange(end - half + 1, end), std::memory_order_relaxed);
+      }
+      return end - half;
+    }
+  }
+}
+
+// -----
+// Antialiasing (RUN_ANTIALIAS)! A pixel is only supersampled when its color
+// stands out from a neighbor's, which is mostly the edges of the set and
+// tight bands of color; everywhere else one sample is already enough.
+
+// The biggest difference between two colors in any channel.
+static inline int colorContrast(uint32_t a, uint32_t b) {
+  int most = 0;
+  for (int shift = 0; shift < 32; shift += 8) {
+    const int d = (int)((a >> shift) & 0xff) - (int)((b >> shift) & 0xff);
+    most = std::max(most, d < 0 ? -d : d);
+  }
+  return most;
+}
+
+// A number from -1/8 to 1/8 that's always the same for this pixel and axis.
+static inline double jitter(uint32_t t, uint32_t axis) {
+  uint32_t h = t * 0x9e3779b9u ^ axis * 0x85ebca6bu;
+  h ^= h >> 16;
+  h *= 0x7feb352du;
+  h ^= h >> 15;
+  return (h >> 8) * 0x1p-24 * 0.25 - 0.125;
+}
+
+// A copy of f whose top-left pixel is at (dx, dy) in f's pixels, with its
+// data in iters and shading instead.
+static Frame subFrame(const Frame &f, double dx, double dy, float *iters,
+                      float *shading) {
+  Frame sub = f;
+  sub.skip = 0; // The series is around the middle of the whole screen
+  sub.iters = iters;
+  sub.shading = shading;
+  if (f.tier == TIER_DOUBLE_DOUBLE) {
+    const dd cornerX = dd{f.posX, f.posXLow} + twoProduct(dx, f.zoom);
+    const dd cornerY = dd{f.posY, f.posYLow} + twoProduct(dy, f.zoom);
+    sub.posX = cornerX.hi;
+    sub.posXLow = cornerX.lo;
+    sub.posY = cornerY.hi;
+    sub.posYLow = cornerY.lo;
+  } else {
+    sub.posX = f.posX + dx * f.zoom;
+    sub.posY = f.posY + dy * f.zoom;
+  }
+  sub.offsetX = f.offsetX + dx * f.zoom;
+  sub.offsetY = f.offsetY + dy * f.zoom;
+  return sub;
+}
+
+// Adds 4 samples to pixel t if it needs them, one in each quarter of the
+// pixel (shifted by the same random amount), and colors it with the average
+// of all 5. The neighbors are compared by the color of their own sample,
+// since colors might already have their antialiased one (this pixel's can't
+// be yet). Returns the score.
+static int antialiasPixel(const Frame &f, const Coloring &c, int t,
+                          uint32_t *colors) {
+  const int x = t % f.w;
+  const int y = t / f.w;
+  const uint32_t own = colors[t];
+  const int neighbors[4] = {x > 0 ? t - 1 : -1, x < f.w - 1 ? t + 1 : -1,
+                            y > 0 ? t - f.w : -1, y < f.h - 1 ? t + f.w : -1};
+  bool edge = false;
+  for (int n : neighbors) {
+    // The same data is the same color.
+    if (n >= 0 &&
+        (f.iters[n] != f.iters[t] || f.shading[n] != f.shading[t]) &&
+        colorContrast(own, pixelColor(c, f.iters[n], f.shading[n])) >
+            ANTIALIAS_CONTRAST) {
+      edge = true;
+      break;
+    }
+  }
+  if (!edge) {
+    return 1;
+  }
+
+  // The samples are the pixels of a 2x2 frame at half the pixel size, so
+  // everything else about how they're calculated stays the same.
+  float sampleIters[4] = {};
+  float sampleShading[4] = {};
+  Frame sub = subFrame(f, x - 0.25 + jitter(t, 0), y - 0.25 + jitter(t, 1),
+                       sampleIters, sampleShading);
+  sub.w = 2;
+  sub.h = 2;
+  sub.zoom = f.zoom * 0.5;
+  PixelQueue queue;
+  queue.count = 0;
+  int score = 0;
+  for (int k = 0; k < 4; k++) {
+    score += queuePixel(sub, queue, k);
+  }
+  score += flushPixels(sub, queue);
+
+  uint32_t sums[4] = {};
+  for (int k = 0; k < 5; k++) {
+    const uint32_t color =
+        k == 4 ? own : pixelColor(c, sampleIters[k], sampleShading[k]);
+    for (int channel = 0; channel < 4; channel++) {
+      sums[channel] += (color >> (channel * 8)) & 0xff;
+    }
+  }
+  colors[t] = (sums[0] / 5) | (sums[1] / 5) << 8 | (sums[2] / 5) << 16 |
+              (sums[3] / 5) << 24;
+  return score + 1;
+}
+
+// -----
+// Accumulation (RUN_ACCUMULATE)! Every pass shifts the whole screen by the
+// same fraction of a pixel, so its samples are calculated a row at a time
+// like any other pixels, and the average of the passes gets closer to the
+// real color of every pixel the longer the view stays still.
+
+// The radical inverse of index in base (the Halton sequence), from 0 to 1.
+static inline double halton(int index, int base) {
+  double result = 0.0;
+  double fraction = 1.0;
+  while (index > 0) {
+    fraction /= base;
+    result += fraction * (index % base);
+    index /= base;
+  }
+  return result;
+}
+
+// Adds this pass's sample to pixels start to end (not included) and colors
+// them with the average. The first pass also adds the pixel's own sample
+// (from the middle of the pixel) to sums (one per channel of every pixel), so
+// after a pass they have passes + 2 samples. Returns the score.
+static int accumulatePixels(const Frame &f, const Coloring &c, int start,
+                            int end, int passes, uint32_t *sums,
+                            uint32_t *colors) {
+  // Spread out over the pixel (Halton 2, 3), from -1/2 to 1/2
+  const double dx = halton(passes + 1, 2) - 0.5;
+  const double dy = halton(passes + 1, 3) - 0.5;
+  const uint32_t count = passes + 2;
+  int score = 0;
+  for (int t = start; t < end;) {
+    // The part of this row in the chunk is a 1 pixel tall frame.
+    const int x = t % f.w;
+    const int length = std::min(end - t, f.w - x);
+    float sampleIters[CALC_CHUNK_SIZE] = {};
+    float sampleShading[CALC_CHUNK_SIZE] = {};
+    Frame row = subFrame(f, x + dx, t / f.w + dy, sampleIters, sampleShading);
+    row.w = length;
+    row.h = 1;
+    PixelQueue queue;
+    queue.count = 0;
+    for (int k = 0; k < length; k++) {
+      score += queuePixel(row, queue, k);
+    }
+    score += flushPixels(row, queue);
+
+    for (int k = 0; k < length; k++) {
+      uint32_t *sum = sums + (size_t)(t + k) * 4;
+      const uint32_t sample = pixelColor(c, sampleIters[k], sampleShading[k]);
+      const uint32_t own =
+          passes == 0 ? pixelColor(c, f.iters[t + k], f.shading[t + k]) : 0;
+      uint32_t color = 0;
+      for (int channel = 0; channel < 4; channel++) {
+        const int shift = channel * 8;
+        sum[channel] += ((sample >> shift) & 0xff) + ((own >> shift) & 0xff);
+        color |= (sum[channel] / count) << shift;
+      }
+      colors[t + k] = color;
+    }
+    t += length;
+  }
+  return score + end - start;
+}
+
+// -----
+// Vector coloring for render(). Everything up to which entry of the palette
+// lookup table a pixel uses is calculated FLOAT_LANES pixels at a time, which
+// leaves only the lookups themselves (WASM doesn't have gathers anyway).
+
+// flog2 for FLOAT_LANES floats at once (the same formula).
+static inline vfloat flog2(vfloat n) {
+  const vmaskf intRepresentation = (vmaskf)n;
+  const vfloat castedFloat =
+      (vfloat)((intRepresentation & 0x7fffff) | 0x3f000000);
+  vfloat y = __builtin_convertvector(intRepresentation, vfloat);
+  y *= 1.192092896e-7f;
+  return y - 124.2255173f - 1.498030305f * castedFloat -
+         1.725880027f / (0.3520887196f + castedFloat);
+}
+
+// Clamps every lane of x to low..high.
+static inline vmaskf clampLanes(vmaskf x, int low, int high) {
+  const vmaskf under = x < low;
+  const vmaskf over = x > high;
+  return (x & ~(under | over)) | (low & under) | (high & over);
+}
+
+// Colors pixels start to end (not included) the same as pixelColor. Pixels
+// under 1.25 iterations (including the interior) are blended with the flow
+// color, so vectors with any of those get pixelColor itself. The palette
+// position before flowAmount is saved in positions, or taken from there if
+// cached (only the flow changed since).
+static void colorPixelsVector(const Coloring &c, const float *iters,
+                              const float *shading, uint32_t *colors,
+                              float *positions, bool cached, int start,
+                              int end) {
+  int t = start;
+  if (c.lut != nullptr) {
+    const float inverseLen = 1.0f / c.paletteLen;
+    for (; t + FLOAT_LANES <= end; t += FLOAT_LANES) {
+      vfloat n, l, base;
+      __builtin_memcpy(&n, iters + t, sizeof(n));
+      __builtin_memcpy(&l, shading + t, sizeof(l));
+      if (cached) {
+        __builtin_memcpy(&base, positions + t, sizeof(base));
+      } else {
+        base = flog2(n) * c.speed1 + (n - 1.0f) * c.speed2;
+        __builtin_memcpy(positions + t, &base, sizeof(base));
+      }
+      const vfloat position = base + c.flowAmount;
+      const vmaskf whole = __builtin_convertvector(position, vmaskf);
+      const vmaskf k = clampLanes(
+          __builtin_convertvector(
+              (position - __builtin_convertvector(whole, vfloat)) *
+                  (float)c.lutSteps,
+              vmaskf),
+          0, c.lutSteps - 1);
+      // whole % paletteLen without dividing; the quotient can be 1 off,
+      // until whole is too big for a float to hold exactly.
+      const vmaskf quotient = __builtin_convertvector(
+          __builtin_convertvector(whole, vfloat) * inverseLen, vmaskf);
+      vmaskf id = whole - quotient * c.paletteLen;
+      id += c.paletteLen & (id < 0);
+      id -= c.paletteLen & (id >= c.paletteLen);
+      const vmaskf entry = id * c.lutSteps + k;
+      const vfloat darken = c.darkenEffect == 2 ? 1.0f - l : l;
+      const vmaskf amount =
+          clampLanes(__builtin_convertvector(200.0f * darken, vmaskf), 0, 255);
+
+      if (anyLane((n < 1.25f) | (whole >= (1 << 24)))) {
+        for (int lane = 0; lane < FLOAT_LANES; lane++) {
+          colors[t + lane] = pixelColor(c, n[lane], l[lane]);
+        }
+        continue;
+      }
+      for (int lane = 0; lane < FLOAT_LANES; lane++) {
+        colors[t + lane] = shadeBy(c.lut[entry[lane]], amount[lane]);
+      }
+    }
+  }
+  for (; t < end; t++) {
+    colors[t] = pixelColor(c, iters[t], shading[t]);
+  }
+}
+
+// Keep C export names
+extern "C" {
+// Simply renders the output; no fuss. cached says whether the palette
+// positions the last render() saved are still right (JS knows when the
+// iterations or speed changed since); they're saved again if not.
+void render(int pixels, int paletteLen, uint32_t interiorColor, int renderMode,
+            int darkenEffect, float speed, float flowAmount, int cached) {
+  // "What is the current pixel we are working on?"
+  std::atomic<int> *pixelAtomic =
+      reinterpret_cast<std::atomic<int> *>(MEMORY_BASE + Mem::AtomicCounter);
+
+  // Points to the start of the iteration data.
+  float *iters = reinterpret_cast<float *>(MEMORY_BASE + Mem::PixelDataStart);
+  // Shading data immediately follows iteration data in memory.
+  float *shading = iters + pixels;
+  // RGBA data follows shading.
+  uint32_t *colors = reinterpret_cast<uint32_t *>(shading + pixels);
+  // Then the palette positions for the next render()
+  float *positions = reinterpret_cast<float *>(colors + pixels);
+  // Palette data is after the LUT.
+  uint32_t *palette =
+      reinterpret_cast<uint32_t *>(MEMORY_BASE + Mem::PaletteData);
+
+  const Coloring coloring = {palette,
+                             paletteLen,
+                             interiorColor,
+                             renderMode,
+                             darkenEffect,
+                             sqrtf(sqrtf(speed)),
+                             0.035f * speed,
+                             flowAmount,
+                             paletteLUT(palette, paletteLen, renderMode),
+                             paletteSteps(paletteLen)};
+  const int totalChunks = (pixels + RENDER_CHUNK_SIZE - 1) / RENDER_CHUNK_SIZE;
+
+  // This is the robust, thread-safe loop structure.
+  while (true) {
+    // Use the compiler built-in for the atomic operation.
+    int chunkIndex = pixelAtomic->fetch_add(1, std::memory_order_relaxed);
+    if (unlikely(chunkIndex >= totalChunks)) {
+      break;
+    }
+
+    const int start = chunkIndex * RENDER_CHUNK_SIZE;
+    const int end = std::min(start + RENDER_CHUNK_SIZE, pixels);
+
+    colorPixelsVector(coloring, iters, shading, colors, positions, cached,
+                      start, end);
+  }
+}
+
+/**
+ * @brief This is the main function! It renders a fractal image to a pixel
+ * buffer using multithreading. Iterates through pixels, calculates fractal
+ * values, and adds pixel data. Make sure to also read the JS code to understand
+ * constants/inputs!
+ *
+ * @param type          [in]  int             Fractal type (1 is Mandelbrot,
+ * negative means Julia set)
+ * @param w             [in]  int             Image width in pixels
+ * @param h             [in]  int             Image height in pixels
+ * @param posX          [in]  double          Horizontal position of the
+ * fractal.
+ * @param posY          [in]  double          Vertical position of the fractal
+ * @param zoom          [in]  double          Zoom level of the fractal
+ * @param max           [in]  int             Maximum calculation 'score' before
+ * early exit.
+ * @param iterations    [in]  int             Maximum iterations per pixel
+ * @param paletteLen    [in]  int             Total length of the color palette
+ * @param interiorColor [in]  uint32_t        Color for pixels that do not
+ * escape.
+ * @param renderMode    [in]  int             Rendering mode for palette
+ * application.
+ * @param darkenEffect  [in]  int             Darkening/shading effect mode
+ * @param speed         [in]  float           Palette color cycling speed
+ * @param flowAmount    [in]  float           Palette flow/pan amount
+ * @param data1         [in]  double          Additional data (Julia X)
+ * @param data2         [in]  double          Additional data (Julia Y)
+ * @param flags         [in]  int             Opt-in modes (RUN_SERIES)
+ * @param worker        [in]  int             Which worker this is (from 0)
+ * @param workers       [in]  int             Amount of workers
+ *
+ * @return              int             -1 for completion, pixel index if not
+ * fully completed.
+ */
+int run(int type, int w, int h, double posX, double posY, double zoom, int max,
+        int iterations, int paletteLen, uint32_t interiorColor, int renderMode,
+        int darkenEffect, float speed, float flowAmount, double data1,
+        double data2, int flags, int worker, int workers) {
+  // "What is the current pixel we are working on?"
+  std::atomic<int> *pixelAtomic =
+      reinterpret_cast<std::atomic<int> *>(MEMORY_BASE + Mem::AtomicCounter);
+  // Total pixels to work on
+  const int pixels = w * h;
+
+  // "What is the memory address of the data for the palette of colors to use?"
+  uint32_t *palette =
+      reinterpret_cast<uint32_t *>(MEMORY_BASE + Mem::PaletteData);
+  // "What is the memory address of the data for iterations before exiting?"
+  float *iters = reinterpret_cast<float *>(MEMORY_BASE + Mem::PixelDataStart);
+  // "What is the memory address of the data for shading?"
+  float *shading = iters + pixels;
+  // "What is the memory address of the RGBA data for rendering?"
+  uint32_t *colors = reinterpret_cast<uint32_t *>(shading + pixels);
+
+  const Coloring coloring = {palette,
+                             paletteLen,
+                             interiorColor,
+                             renderMode,
+                             darkenEffect,
+                             sqrtf(sqrtf(speed)),
+                             0.035f * speed,
+                             flowAmount,
+                             paletteLUT(palette, paletteLen, renderMode),
+                             paletteSteps(paletteLen)};
+  int score = 0;
+
+  // Capture the job ID at the start. This worker is now locked to this job.
+  const int totalChunks = (pixels + CALC_CHUNK_SIZE - 1) / CALC_CHUNK_SIZE;
+
+  // Find the absolute value
+  int absType = (type < 0) ? -type : type;
+  const bool isJulia = (type < 0);
+
+  // Floats when zoomed out, and at deep zooms pixels are offsets from a
+  // Decimal reference orbit instead.
+  int tier = precisionTier(type, zoom);
+  if (tier == TIER_FLOAT && (flags & RUN_DOUBLE)) {
+    tier = TIER_DOUBLE;
+  }
+  const bool perturb = tier == TIER_DECIMAL;
+  double *orbit =
+      reinterpret_cast<double *>(MEMORY_BASE + Mem::referenceStart(pixels));
+  BLA *bla =
+      reinterpret_cast<BLA *>(MEMORY_BASE + Mem::blaStart(pixels, iterations));
+  Reference ref;
+  double offsetX = 0.0;
+  double offsetY = 0.0;
+  if (perturb) {
+    std::atomic<int> *state =
+        reinterpret_cast<std::atomic<int> *>(MEMORY_BASE + Mem::ReferenceState);
+    int *length = reinterpret_cast<int *>(MEMORY_BASE + Mem::ReferenceLength);
+    if (state->load(std::memory_order_acquire) != ReferenceReady) {
+      // Only one worker calculates the reference; the others report back
+      // without progress and get called again once it is done.
+      int expected = ReferenceStale;
+      if (!state->compare_exchange_strong(expected, ReferenceComputing,
+                                          std::memory_order_acquire)) {
+        return pixelAtomic->load(std::memory_order_relaxed);
+      }
+      *reinterpret_cast<uint32_t *>(MEMORY_BASE + Mem::LimbCount) =
+          limbsNeeded(zoom);
+      *length = computeReference(absType, iterations, orbit);
+      if (hasBLA(absType)) {
+        // main.js recalculates the reference before the screen center moves
+        // more than half a diagonal away (or the zoom gets bigger), so no
+        // pixel's dc is bigger than this.
+        const double dcMax = zoom * sqrt((double)w * w + (double)h * h);
+        computeBLA(absType, orbit, *length, dcMax, bla);
+      }
+      state->store(ReferenceReady, std::memory_order_release);
+    }
+    ref.orbit = orbit;
+    ref.length = *length;
+    ref.bla = hasBLA(absType) ? bla : nullptr;
+    blaLevels(ref.length, ref.levels);
+
+    // The offset of the top-left pixel from the reference center is small
+    // enough to fit in a double even when the coordinates themselves aren't.
+    const uint64_t *storage =
+        reinterpret_cast<uint64_t *>(MEMORY_BASE + Mem::DecimalStorage);
+    uint64_t difference[DECIMAL_LIMBS];
+    subtract(storage + SLOT_CORNER_X * DECIMAL_LIMBS,
+             storage + SLOT_CENTER_X * DECIMAL_LIMBS, difference);
+    offsetX = toDouble(difference);
+    subtract(storage + SLOT_CORNER_Y * DECIMAL_LIMBS,
+             storage + SLOT_CENTER_Y * DECIMAL_LIMBS, difference);
+    offsetY = toDouble(difference);
+  }
+
+  // Shallower zooms can skip the iterations all the pixels have in common.
+  const bool series = (flags & RUN_SERIES) && !perturb && !isJulia &&
+                      hasSeries(absType, darkenEffect);
+  Series *seriesData =
+      reinterpret_cast<Series *>(MEMORY_BASE + Mem::referenceStart(pixels));
+  int skip = 0;
+  if (series) {
+    std::atomic<int> *state =
+        reinterpret_cast<std::atomic<int> *>(MEMORY_BASE + Mem::SeriesState);
+    int *seriesSkip = reinterpret_cast<int *>(MEMORY_BASE + Mem::SeriesSkip);
+    if (state->load(std::memory_order_acquire) != ReferenceReady) {
+      int expected = ReferenceStale;
+      if (!state->compare_exchange_strong(expected, ReferenceComputing,
+                                          std::memory_order_acquire)) {
+        return pixelAtomic->load(std::memory_order_relaxed);
+      }
+      *seriesSkip = computeSeries(absType, iterations, posX + w * 0.5 * zoom,
+                                  posY + h * 0.5 * zoom, w, h, zoom,
+                                  *seriesData);
+      state->store(ReferenceReady, std::memory_order_release);
+    }
+    skip = *seriesSkip;
+  }
+
+  // posX and posY can't hold the position anymore; split the Decimal one into
+  // two doubles instead.
+  double posXLow = 0.0;
+  double posYLow = 0.0;
+  if (tier == TIER_DOUBLE_DOUBLE) {
+    const uint64_t *storage =
+        reinterpret_cast<uint64_t *>(MEMORY_BASE + Mem::DecimalStorage);
+    splitDecimal(storage + SLOT_CORNER_X * DECIMAL_LIMBS, posX, posXLow);
+    splitDecimal(storage + SLOT_CORNER_Y * DECIMAL_LIMBS, posY, posYLow);
+  }
+
+  const double periodEpsilon =
+      (flags & RUN_PERIODICITY) ? zoom * PERIOD_TOLERANCE : 0.0;
+  // Perturbation pixels don't have their own coordinates (and are rarely
+  // this far in anyway).
+  const double radius =
+      perturb ? 0.0 : interiorRadius(absType, isJulia, data1, data2);
+
+  const Frame frame = {absType,    darkenEffect,  iterations, w,
+                       h,          posX,          posY,       zoom,
+                       isJulia,    data1,         data2,      tier,
+                       posXLow,    posYLow,       periodEpsilon, radius,
+                       skip,       seriesData,    &ref,       offsetX,
+                       offsetY,    iters,         shading};
+  PixelQueue queue;
+  queue.count = 0;
+
+  // Colors pixels start to end (not included).
+  auto colorPixels = [&](int startPixel, int endPixel) {
+    for (int t = startPixel; t < endPixel; ++t) {
+      // This runs for every pixel to handle panning, interior and edge cases
+      // correctly.
+      const float n = iters[t];
+      colors[t] = pixelColor(coloring, n, shading[t]);
+      if (n != -999.0f && n <= 1.000004f) {
+        iters[t] = 1.0f;
+      }
+    }
+  };
+
+  if (flags & RUN_ANTIALIAS) {
+    // The screen is already done; this pass only adds samples to the pixels
+    // that need them.
+    while (true) {
+      const int i =
+          pixelAtomic->fetch_add(CALC_CHUNK_SIZE, std::memory_order_relaxed);
+      if (unlikely(i >= pixels)) {
+        return -1;
+      }
+      const int end = std::min(i + CALC_CHUNK_SIZE, pixels);
+      for (int t = i; t < end; t++) {
+        score += antialiasPixel(frame, coloring, t, colors);
+      }
+      if (unlikely(score >= max)) {
+        return end == pixels ? -1 : end;
+      }
+    }
+  }
+
+  if (flags & RUN_ACCUMULATE) {
+    // Like RUN_ANTIALIAS, but every pixel gets a sample.
+    const int passes =
+        *reinterpret_cast<int *>(MEMORY_BASE + Mem::AccumulatePasses);
+    uint32_t *sums = reinterpret_cast<uint32_t *>(
+        MEMORY_BASE + Mem::accumulationStart(pixels, iterations));
+    while (true) {
+      const int i =
+          pixelAtomic->fetch_add(CALC_CHUNK_SIZE, std::memory_order_relaxed);
+      if (unlikely(i >= pixels)) {
+        return -1;
+      }
+      const int end = std::min(i + CALC_CHUNK_SIZE, pixels);
+      score += accumulatePixels(frame, coloring, i, end, passes, sums, colors);
+      if (unlikely(score >= max)) {
+        return end == pixels ? -1 : end;
+      }
+    }
+  }
+
+  if (flags & RUN_TRACING) {
+    // Tiles instead of chunks; the counter counts tiles here.
+    const int tilesX = (w + TRACE_TILE_SIZE - 1) / TRACE_TILE_SIZE;
+    const int tilesY = (h + TRACE_TILE_SIZE - 1) / TRACE_TILE_SIZE;
+    while (true) {
+      const int i = pixelAtomic->fetch_add(1, std::memory_order_relaxed);
+      if (unlikely(i >= tilesX * tilesY)) {
+        return -1;
+      }
+      const int x0 = (i % tilesX) * TRACE_TILE_SIZE;
+      const int y0 = (i / tilesX) * TRACE_TILE_SIZE;
+      const int x1 = std::min(x0 + TRACE_TILE_SIZE, w) - 1;
+      const int y1 = std::min(y0 + TRACE_TILE_SIZE, h) - 1;
+      score += traceTile(frame, queue, {x0, y0, x1, y1});
+      for (int y = y0; y <= y1; y++) {
+        colorPixels(y * w + x0, y * w + x1 + 1);
+      }
+      if (unlikely(score >= max)) {
+        // Progress is reported in pixels, up to the end of this row of tiles.
+        return i == tilesX * tilesY - 1 ? -1 : (y1 + 1) * w;
+      }
+    }
+  }
+
+  if (flags & RUN_PROGRESSIVE) {
+    // The counter goes through the passes one after another, so a coarse
+    // version of the whole screen is done before any of the finer passes.
+    int total = 0;
+    for (int step = PROGRESSIVE_STEP; step > 1; step >>= 1) {
+      total += ((w + step - 1) / step) * ((h + step - 1) / step);
+    }
+    total += pixels;
+    while (true) {
+      const int i =
+          pixelAtomic->fetch_add(CALC_CHUNK_SIZE, std::memory_order_relaxed);
+      if (unlikely(i >= total)) {
+        return -1;
+      }
+      const int end = std::min(i + CALC_CHUNK_SIZE, total);
+      int chunk[CALC_CHUNK_SIZE];
+      int steps[CALC_CHUNK_SIZE];
+      for (int v = i; v < end; v++) {
+        chunk[v - i] = progressivePixel(w, h, v, steps[v - i]);
+        score += queuePixel(frame, queue, chunk[v - i]);
+      }
+      score += flushPixels(frame, queue);
+
+      for (int k = 0; k < end - i; k++) {
+        const int t = chunk[k];
+        colorPixels(t, t + 1);
+        // Pixels in the block without data of their own (yet) borrow the
+        // color.
+        const int x = t % w;
+        const int y = t / w;
+        const int blockW = std::min(steps[k], w - x);
+        const int blockH = std::min(steps[k], h - y);
+        for (int by = 0; by < blockH; by++) {
+          for (int bx = 0; bx < blockW; bx++) {
+            const int q = t + by * w + bx;
+            if (iters[q] == 0.0f) {
+              colors[q] = colors[t];
+            }
+          }
+        }
+      }
+      if (unlikely(score >= max)) {
+        // Progress is reported in pixels, so scale it down.
+        return end == total ? -1 : (int)((int64_t)end * pixels / total);
+      }
+    }
+  }
+
+  // RUN_TILES and RUN_STEALING hand out blocks along a Hilbert curve.
+  std::atomic<int> *costs =
+      reinterpret_cast<std::atomic<int> *>(MEMORY_BASE + Mem::TileCosts);
+  int block = TILE_BLOCK_SIZE;
+  while (((w + block - 1) / block) * ((h + block - 1) / block) >
+         TILE_COST_LIMIT) {
+    block <<= 1;
+  }
+  const int blocksX = (w + block - 1) / block;
+  const int blocksY = (h + block - 1) / block;
+  int side = 2;
+  while (side < blocksX || side < blocksY) {
+    side <<= 1;
+  }
+  const int totalBlocks = side * side;
+  // Calculates and colors the block at point d, returning its score.
+  auto calculateBlock = [&](int d) {
+    int bx, by;
+    hilbertPoint(side, d, bx, by);
+    if (bx >= blocksX || by >= blocksY) {
+      return 0; // Past the edge of the screen
+    }
+    const int x0 = bx * block;
+    const int y0 = by * block;
+    const int x1 = std::min(x0 + block, w);
+    const int y1 = std::min(y0 + block, h);
+    int blockScore = 0;
+    for (int y = y0; y < y1; y++) {
+      for (int x = x0; x < x1; x++) {
+        blockScore += queuePixel(frame, queue, y * w + x);
+      }
+    }
+    blockScore += flushPixels(frame, queue);
+    for (int y = y0; y < y1; y++) {
+      colorPixels(y * w + x0, y * w + x1);
+    }
+    costs[by * blocksX + bx].store(blockScore, std::memory_order_relaxed);
+    return blockScore;
+  };
+
+  if (flags & RUN_STEALING) {
+    std::atomic<uint64_t> *ranges = reinterpret_cast<std::atomic<uint64_t> *>(
+        MEMORY_BASE + Mem::WorkerRanges);
+    const int owners = std::min(workers, WORKER_LIMIT);
+    std::atomic<uint64_t> *own = worker < owners ? ranges + worker : nullptr;
+    std::atomic<int> *state =
+        reinterpret_cast<std::atomic<int> *>(MEMORY_BASE + Mem::RangeState);
+    if (state->load(std::memory_order_acquire) != ReferenceReady) {
+      // Only one worker splits up the curve; the others report back without
+      // progress and get called again.
+      int expected = ReferenceStale;
+      if (!state->compare_exchange_strong(expected, ReferenceComputing,
+                                          std::memory_order_acquire)) {
+        return pixelAtomic->load(std::memory_order_relaxed);
+      }
+      for (int k = 0; k < owners; k++) {
+        ranges[k].store(
+            packRange((int64_t)totalBlocks * k / owners,
+                      (int64_t)totalBlocks * (k + 1) / owners),
+            std::memory_order_relaxed);
+      }
+      state->store(ReferenceReady, std::memory_order_release);
+    }
+
+    while (true) {
+      int d = own ? popRange(*own) : -1;
+      if (d < 0) {
+        d = stealRange(ranges, owners, own);
+        if (d < 0) {
+          return -1; // Every block has been claimed, this worker is done.
+        }
+      }
+      score += calculateBlock(d);
+      if (unlikely(score >= max)) {
+        int left = 0;
+        int leftOnScreen = 0;
+        for (int k = 0; k < owners; k++) {
+          const uint64_t range = ranges[k].load(std::memory_order_relaxed);
+          const int begin = (int)(uint32_t)range;
+          const int end = (int)(range >> 32);
+          if (end > begin) {
+            left += end - begin;
+            leftOnScreen += hilbertOnScreen(side, end, blocksX, blocksY) -
+                            hilbertOnScreen(side, begin, blocksX, blocksY);
+          }
+        }
+        // Progress is reported in pixels, so scale the blocks on the screen
+        // down.
+        const int onScreen = blocksX * blocksY;
+        return left == 0 ? -1
+                         : (int)((int64_t)(onScreen - leftOnScreen) * pixels /
+                                 onScreen);
+      }
+    }
+  }
+
+  if (flags & RUN_TILES) {
+    // The score of the tile made up of blocks 4k to 4k + 3.
+    auto tileCost = [&](int k) {
+      int cost = 0;
+      for (int d = k * 4; d < k * 4 + 4; d++) {
+        int bx, by;
+        hilbertPoint(side, d, bx, by);
+        if (bx < blocksX && by < blocksY) {
+          cost += costs[by * blocksX + bx].load(std::memory_order_relaxed);
+        }
+      }
+      return cost;
+    };
+    const int splitCost = std::min(max / 4, TILE_SPLIT_COST);
+
+    while (true) {
+      // Whole tiles normally, and single blocks from expensive tiles (or the
+      // rest of one that was already started).
+      int i = pixelAtomic->load(std::memory_order_relaxed);
+      int size;
+      do {
+        if (unlikely(i >= totalBlocks)) {
+          return -1;
+        }
+        size = (i % 4 != 0 || tileCost(i / 4) > splitCost) ? 1 : 4;
+      } while (!pixelAtomic->compare_exchange_weak(i, i + size,
+                                                   std::memory_order_relaxed));
+
+      for (int d = i; d < i + size; d++) {
+        score += calculateBlock(d);
+      }
+      if (unlikely(score >= max)) {
+        // Progress is reported in pixels, so scale the blocks on the screen
+        // down.
+        return i + size >= totalBlocks
+                   ? -1
+                   : (int)((int64_t)hilbertOnScreen(side, i + size, blocksX,
+                                                    blocksY) *
+                           pixels / (blocksX * blocksY));
+      }
+    }
+  }
+
+  // This is the main worker loop. It is pixel-based for best load balancing.
+  while (true) {
+    int i = pixelAtomic->fetch_add(CALC_CHUNK_SIZE, std::memory_order_relaxed);
+
+    const int startPixel = i;
+    const int endPixel = std::min(startPixel + CALC_CHUNK_SIZE, pixels);
+
+    // Calculate the pixels without data first, a vector at a time.
+    for (int t = startPixel; t < endPixel; ++t) {
+      score += queuePixel(frame, queue, t);
+    }
+    score += flushPixels(frame, queue);
+    colorPixels(startPixel, endPixel);
+
     if (unlikely(i >= pixels)) {
       return -1; // All chunks have been claimed, this worker is done.
     } else if (unlikely(score >= max)) {
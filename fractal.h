@@ -0,0 +1,142 @@
+/*
+The memory layout and the parts of the run() interface that fractal.cpp
+shares with native.cpp, which sets up the same memory regions itself. main.js
+has its own copies of these, which have to be kept in sync by hand.
+*/
+
+#pragma once
+
+#include <stdint.h>
+
+namespace Mem {
+// Pixel counter (or tile, pass or block index depending on the run() mode)
+constexpr uint32_t AtomicCounter = 0;
+// Reference orbit status (see ReferenceStale and friends below)
+constexpr uint32_t ReferenceState = 4;
+// Fractional limbs decimal.cpp uses (see limbsNeeded), 0 for all of them
+constexpr uint32_t LimbCount = 8;
+// Amount of usable points in the reference orbit
+constexpr uint32_t ReferenceLength = 12;
+// Series approximation status (same values as ReferenceState)
+constexpr uint32_t SeriesState = 16;
+// Iterations skipped by the series approximation
+constexpr uint32_t SeriesSkip = 20;
+// RUN_STEALING status (same values as ReferenceState)
+constexpr uint32_t RangeState = 24;
+// RUN_ACCUMULATE passes already done on this screen (JS sets it before each
+// pass)
+constexpr uint32_t AccumulatePasses = 28;
+
+// Lookup tables (Shading is 64KB and PaletteData is 1000KB)
+constexpr uint32_t ShadingLUT = 32;
+constexpr uint32_t PaletteData = ShadingLUT + 65536;
+// 16 Decimal instances use 32 uint64_t's for 256 bytes/Decimal
+constexpr uint32_t DecimalStorage = PaletteData + 100000;
+
+// Score of each block the last time RUN_TILES or RUN_STEALING calculated it
+// (1MB, see TILE_COST_LIMIT)
+constexpr uint32_t TileCosts = DecimalStorage + 4096;
+// The blocks left for each worker with RUN_STEALING (see packRange, 2KB for
+// WORKER_LIMIT workers)
+constexpr uint32_t WorkerRanges = TileCosts + 1048576;
+// The palette lookup table (see paletteLUT): JS adds 1 to PaletteVersion
+// whenever it writes the palette, and whichever worker builds the table
+// holds PaletteLUTLock while it does and saves what the table is for in
+// PaletteLUTKey (see paletteKey). The table itself is 2MB.
+constexpr uint32_t PaletteVersion = WorkerRanges + 2048;
+constexpr uint32_t PaletteLUTKey = PaletteVersion + 8;
+constexpr uint32_t PaletteLUTLock = PaletteVersion + 16;
+constexpr uint32_t PaletteLUT = PaletteVersion + 32;
+
+// Constants the compiler puts in memory, like switch tables (4KB, JS passes
+// this as __memory_base), then the stack of each worker's instance of the
+// module (32KB each for WORKER_LIMIT workers, JS passes the top of a worker's
+// one as __stack_pointer). The native build uses its own.
+constexpr uint32_t StaticData = PaletteLUT + 2097152;
+constexpr uint32_t WorkerStacks = StaticData + 4096;
+
+// This is where the per-pixel data starts.
+constexpr uint32_t PixelDataStart = WorkerStacks + 8388608;
+
+// The reference orbit (pairs of doubles) comes right after the 16 bytes of
+// per-pixel data (iterations, shading, color and the palette position
+// render() saves), aligned to 8 bytes.
+static inline uintptr_t referenceStart(int pixels) {
+  return (PixelDataStart + (uintptr_t)pixels * 16 + 7) & ~(uintptr_t)7;
+}
+
+// The series approximation uses the same space when perturbation is off.
+
+// The BLA table follows the reference orbit (iterations + 2 points).
+static inline uintptr_t blaStart(int pixels, int iterations) {
+  return referenceStart(pixels) + (uintptr_t)(iterations + 2) * 16;
+}
+
+// The RUN_ACCUMULATE sums (4 uint32_t's per pixel) come after room for the
+// whole BLA table (about 2 entries of 40 bytes per iteration).
+static inline uintptr_t accumulationStart(int pixels, int iterations) {
+  return blaStart(pixels, iterations) + (uintptr_t)(iterations + 1) * 80;
+}
+} // namespace Mem
+
+// Values of Mem::ReferenceState. JS resets it to ReferenceStale whenever it
+// writes a new reference center.
+constexpr int ReferenceStale = 0;
+constexpr int ReferenceComputing = 1;
+constexpr int ReferenceReady = 2;
+
+// Opt-in modes for run() (the flags parameter), set from URL parameters in
+// main.js.
+constexpr int RUN_SERIES = 1;
+// Never iterate in floats, even when zoomed out
+constexpr int RUN_DOUBLE = 2;
+// Stop iterating interior pixels once their orbit repeats (except with
+// perturbation, where BLA already skips most of the interior)
+constexpr int RUN_PERIODICITY = 4;
+// Calculate the borders of tiles first and fill the ones that are interior
+// all the way around (Mariani-Silver)
+constexpr int RUN_TRACING = 8;
+// Calculate every 8th pixel first, then every 4th, 2nd and finally the rest,
+// coloring the pixels in between from the closest one so far (ignored with
+// RUN_TRACING)
+constexpr int RUN_PROGRESSIVE = 16;
+// Claim 8x8 blocks in Hilbert curve order, 4 at a time (16x16) unless they
+// were expensive last time (ignored with RUN_TRACING and RUN_PROGRESSIVE)
+constexpr int RUN_TILES = 32;
+// Give every worker its own stretch of the Hilbert curve, and let workers
+// that run out steal half of what's left from the one with the most (ignored
+// with RUN_TRACING and RUN_PROGRESSIVE, and takes priority over RUN_TILES)
+constexpr int RUN_STEALING = 64;
+// Instead of calculating, go over the finished screen and add 4 more samples
+// to every pixel whose color is far from one of its neighbors' (JS runs this
+// as an extra pass once a screen is done)
+constexpr int RUN_ANTIALIAS = 128;
+// Instead of calculating, add one more sample to every pixel of the finished
+// screen, with the whole screen shifted by a different fraction of a pixel
+// every pass, and color it with the average of its samples so far (JS keeps
+// running passes of this while the view is still)
+constexpr int RUN_ACCUMULATE = 256;
+
+// Decimal slots (each one is DECIMAL_LIMBS uint64_t's) in Mem::DecimalStorage
+// used for perturbation: the reference center and the top-left pixel.
+constexpr int DECIMAL_LIMBS = 32;
+constexpr int SLOT_CENTER_X = 0;
+constexpr int SLOT_CENTER_Y = 1;
+constexpr int SLOT_CORNER_X = 2;
+constexpr int SLOT_CORNER_Y = 3;
+
+// Below this pixel size doubles run out of bits, so run() switches to
+// perturbation (main.js uses the same value to know when to send Decimals).
+constexpr double PERTURBATION_ZOOM = 0x1p-48;
+
+// The fractional limbs a Decimal needs at this zoom: enough for the pixel size
+// plus two more, since the orbit's rounding errors grow with every iteration.
+// main.js recalculates the reference when this goes up.
+static inline int limbsNeeded(double zoom) {
+  int limbs = 2;
+  for (double scale = 1.0; zoom < scale && limbs < DECIMAL_LIMBS - 2;
+       scale *= 0x1p-64) {
+    limbs++;
+  }
+  return limbs;
+}
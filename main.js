@@ -238,20 +238,36 @@ function generateSRGBLinearLUT() {
 }
 
 /**
- * Generates a lookup table for converting linear sRGB values (0.0-1.0, represented as 0-255 integer steps) to 8-bit sRGB (0-255).
- * @returns {Uint8Array} A 256-element array where index is linear sRGB step and value is 8-bit sRGB.
+ * Writes the shading lookup table fractal.cpp darkens colors with (Mem::ShadingLUT): every 8-bit sRGB value darkened by every shade amount (0-255) in linear light.
+ * The shaded value is converted back to sRGB exactly, since rounding it to one of 256 linear steps first would lose most of the dark values.
+ *
+ * @param {ArrayBuffer} memory An object containing an ArrayBuffer.
+ * @param {number} shadingStart The byte offset in `memory.buffer` where the shading LUT should be written.
  */
-function generateLinearSRGBLUT() {
-  var lut = new Uint8Array(256);
-  for (var i = 0; i < 256; i++) {
-    var linear_norm = i / 255.0;
-    var srgb_val =
-      linear_norm > 0.0031308
-        ? 1.055 * Math.pow(linear_norm, 1 / 2.4) - 0.055
-        : 12.92 * linear_norm;
-    lut[i] = Math.round(Math.max(0, Math.min(1, srgb_val)) * 255);
+function writeShadingLUT(memory, shadingStart) {
+  var srgbToLinearLUT = generateSRGBLinearLUT();
+  var numShades = 256;
+  var shadingLUT = new Uint8Array(256 * numShades); // 256 original values * 256 shade amounts
+  for (var originalValue = 0; originalValue < 256; originalValue++) {
+    // Get the linear representation of the original sRGB 8-bit value
+    var linearValue = srgbToLinearLUT[originalValue];
+    for (var shadeAmount = 0; shadeAmount < numShades; shadeAmount++) {
+      var shadeFraction = 1 - shadeAmount / 255; // 0 (full shade) to 1 (no shade)
+      var shadedLinearValue = linearValue * shadeFraction;
+      var srgbValue =
+        shadedLinearValue > 0.0031308
+          ? 1.055 * Math.pow(shadedLinearValue, 1 / 2.4) - 0.055
+          : 12.92 * shadedLinearValue;
+      shadingLUT[originalValue * numShades + shadeAmount] = Math.round(
+        Math.max(0, Math.min(1, srgbValue)) * 255,
+      );
+    }
   }
-  return lut;
+
+  // Write the shadingLUT to the shared memory buffer
+  new Uint8Array(memory.buffer, shadingStart, shadingLUT.length).set(
+    shadingLUT,
+  );
 }
 
 /**
@@ -272,10 +288,6 @@ function initializeColorScience(
   shadingStart,
   originalPalette,
 ) {
-  // Generate sRGB <-> Linear sRGB LUTs once
-  var srgbToLinearLUT = generateSRGBLinearLUT();
-  var linearToSrgbLUT = generateLinearSRGBLUT();
-
   // originalPalette.length - 1 because we interpolate between N colors, meaning N-1 segments.
   // If originalPalette has 2 colors, there's 1 segment. If it has 10 colors, there are 9 segments.
   var originalPaletteSegments = originalPalette.length - 1;
@@ -299,30 +311,7 @@ function initializeColorScience(
   // Write the megaPalette to the shared memory buffer
   new Uint32Array(memory.buffer, paletteStart, finalLUTLength).set(megaPalette);
 
-  var numShades = 256;
-  var shadingLUT = new Uint8Array(256 * numShades); // 256 original values * 256 shade amounts
-  for (var originalValue = 0; originalValue < 256; originalValue++) {
-    // Get the linear representation of the original sRGB 8-bit value
-    var linearValue = srgbToLinearLUT[originalValue];
-    for (var shadeAmount = 0; shadeAmount < numShades; shadeAmount++) {
-      var shadeFraction = 1 - shadeAmount / 255; // 0 (full shade) to 1 (no shade)
-      var shadedLinearValue = linearValue * shadeFraction;
-
-      // Convert the shaded linear value back to an 8-bit sRGB value using the LUT
-      // We multiply by 255 and round to get the appropriate index for linearToSrgbLUT
-      var finalSrgbValue =
-        linearToSrgbLUT[
-          Math.round(Math.max(0, Math.min(1, shadedLinearValue)) * 255)
-        ];
-
-      shadingLUT[originalValue * numShades + shadeAmount] = finalSrgbValue;
-    }
-  }
-
-  // Write the shadingLUT to the shared memory buffer
-  new Uint8Array(memory.buffer, shadingStart, shadingLUT.length).set(
-    shadingLUT,
-  );
+  writeShadingLUT(memory, shadingStart);
 }
 
 function parseGracefulUrlParams(url) {
@@ -389,11 +378,38 @@ const fractalNames = [
 const shadingNames = ["Default", "Shadow", "Inverted Shadow", "Stripes"];
 
 var urlParameters = parseGracefulUrlParams(location);
+const maxWorkers = 256; // Every worker needs its own stack (see stackStart), same as WORKER_LIMIT in fractal.cpp
 const workerCount = useSharedWebWorkers
-  ? urlParameters.get("workers")
-    ? +urlParameters.get("workers")
-    : navigator.hardwareConcurrency
+  ? Math.min(
+      urlParameters.get("workers")
+        ? +urlParameters.get("workers")
+        : navigator.hardwareConcurrency,
+      maxWorkers,
+    )
   : 1;
+// Opt-in modes for run(), same as the RUN_ constants in fractal.h.
+const runSeries = 1;
+const runDouble = 2;
+const runPeriodicity = 4;
+const runTracing = 8;
+const runProgressive = 16;
+const runTiles = 32;
+const runStealing = 64;
+const runAntialias = 128;
+const runAccumulate = 256;
+const runFlags =
+  (urlParameters.has("series") ? runSeries : 0) |
+  (urlParameters.has("double") ? runDouble : 0) |
+  (urlParameters.has("periodicity") ? runPeriodicity : 0) |
+  (urlParameters.has("tracing") ? runTracing : 0) |
+  (urlParameters.has("progressive") ? runProgressive : 0) |
+  (urlParameters.has("tiles") ? runTiles : 0) |
+  (urlParameters.has("stealing") ? runStealing : 0);
+// With ?antialias, every finished screen gets one more pass of run() with runAntialias.
+const antialias = urlParameters.has("antialias");
+// With ?accumulate, a finished screen keeps getting passes of run() with runAccumulate while the view stays still, up to accumulateLimit of them (each one adds a sample to every pixel).
+const accumulate = urlParameters.has("accumulate");
+const accumulateLimit = 256;
 document.getElementById("hardwareWorkers").textContent =
   navigator.hardwareConcurrency +
   (navigator.hardwareConcurrency === 1 ? " worker" : " workers") +
@@ -401,8 +417,7 @@ document.getElementById("hardwareWorkers").textContent =
     ? " (overridden to " + workerCount + ")"
     : "");
 // Be very careful to not rename or remove this line when using tasks.json! This caused me several hours of headache... ):
-const unsharedWASMData =
-  "data:application/wasm;base64,AGFzbQEAAAABMQVgAABgBH1/f30Bf2ADf39/AX9gB39/f39/fX0AYBB/f398fHx/f39/f399fXx8AX8CDwEDZW52Bm1lbW9yeQIAAAMFBAECAwQHEAIGcmVuZGVyAAIDcnVuAAMKvKMBBNYXAgR9Cn8gAAJ/IACLQwAAAE9dBEAgAKgMAQtBgICAgHgLIgggAW8iAbIgCCABa7KSkyEEIAFBAnQiAUGkgARqKAIAIQsgAUGggARqKAIAIQoCQAJAAkACQAJAIAJBAWsOAwABAgMLAn8gC0EIdkH/AXEhCAJ/IARDAAB/Q5QgBJGUIgBDAACAT10gAEMAAAAAYHEEQCAAqQwBC0EACyIBIAtB/wFxbEH/ASABayIJIApB/wFxbGpBCHYiAiABIAhsIAkgCkEIdkH/AXFsakGAfnEgC0EQdkH/AXEgAWwgCkEQdkH/AXEgCWxqQQh0QYCAfHFzcyIJQQh2Qf8BcSIOsyIGQ83MTD+UQwAANEKSIgBDAACAT10gAEMAAAAAYHEEQCAAqQwBC0EAC0EIdAJ/IAlBEHZB/wFxIgyzIgVDzcxMP5RDAAA0QpIiAEMAAIBPXSAAQwAAAABgcQRAIACpDAELQQALQRB0cwJ/IAJB/wFxIg+zIgBDzcxMP5RDAAA0QpIiB0MAAIBPXSAHQwAAAABgcQRAIAepDAELQQALIghzIg1BgICAeHMhAiAEQ83MzD1gRQRAIARDzczMPGBFBEAgDUEIdkH/AXEhAgJ/IARDAADIQpQiAEMAAIBPXSAAQwAAAABgcQRAIACpDAELQQALIgEgDUEQdkH/AXFsQf8BIAFrIgkgDGxqQQh0QYCAfHEgASACbCAJIA5sakGAfnEgASAIQf8BcWwgCSAPbGpBCHZBgICAeHJzcyECDAULIARDmpmZPV8NBCANQQh2Qf8BcSECAn8gBEMAAMjClEMAACBBkiIAQwAAgE9dIABDAAAAAGBxBEAgAKkMAQtBAAsiASANQRB2Qf8BcWxB/wEgAWsiCSAMbGpBCHRBgIB8cSABIAJsIAkgDmxqQYB+cSABIAhB/wFxbCAJIA9sakEIdkGAgIB4cnNzIQIMBAsgCUGAgIB4cyEBIARDmpkZP19FBEACQAJ9IARDMzMzP2BFBEAgBEMAAMhClEMAAEjCkiAEQwAAID9gRQ0BGiAEQ83MLD9fBEAgAiEBDAMLIARDAADIwpRDAQBwQpIMAQsgBEPNzEw/Xw0BIARDpHB9P14NAQJ/IABDAABAP5RDAACAQpIiAEMAAIBPXSAAQwAAAABgcQRAIACpDAELQQALAn8gBkMAAEA/lEMAAIBCkiIGQwAAgE9dIAZDAAAAAGBxBEAgBqkMAQtBAAtBCHRzAn8gBUMAAEA/lEMAAIBCkiIAQwAAgE9dIABDAAAAAGBxBEAgAKkMAQtBAAtBEHRzQYCAgHhzIQIgBEMAAMhClEMAAKDCkiAEQzMzUz9gRQ0AGiAEQwAAYD9fBEAgAiEBDAILIARDAADIwpRDAAC0QpILIQAgAkH/AXEhCEH/AQJ/IABDAACAT10gAEMAAAAAYHEEQCAAqQwBC0EACyIBayIJIAxsIAJBEHZB/wFxIAFsakEIdEGAgHxxIAkgDmwgAkEIdkH/AXEgAWxqQYB+cSAJIA9sIAEgCGxqQQh2c3NBgICAeHMhAQsCf0MAAEhDIARDAAB6Q5RDAIB3w5JDAAAgQCAEQwAAIECUkyAEQ6RwfT9eG5EiAEMAAEhDlCAAkZSTIgBDAACAT10gAEMAAAAAYHEEQCAAqQwBC0EACyICRQRAIAEhAgwFC0H/ASACayICIAFBEHZB/wFxbEEIdEGAgHxxIAFBCHZB/wFxIAJsQYB+cSACIAFB/wFxbEEIdkGAgIB4cnNzIQIMBAsCQCAEQ83MTD5fDQAgBEOamZk+YA0AIARDZmZmPmBFBEAgBEMAAMhClEMAAKDBkiIAQwAAgE9dIABDAAAAAGBxBEAgASACIACpEAEhAgwGCyABIAJBABABIQIMBQsgBEPNzIw+Xw0EIARDAADIwpRDAQDwQZIiAEMAAIBPXSAAQwAAAABgcQRAIAEgAiAAqRABIQIMBQsgASACQQAQASECDAQLIARDzczMPl8EQCABIQIMBAsgBEMAAAA/YARAIAEhAgwECyAEQ5qZ2T5gRQRAIARDAADIQpRDAAAgwpIiAEMAAIBPXSAAQwAAAABgcQRAIAEgAiAAqRABIQIMBQsgASACQQAQASECDAQLIARDMzPzPl8NAyAEQwAAyMKUQwAASEKSIgBDAACAT10gAEMAAAAAYHEEQCABIAIgAKkQASECDAQLIAEgAkEAEAEhAgwDCyALQQh2Qf8BcSECAn8gBEMAAH9DlCIAQwAAgE9dIABDAAAAAGBxBEAgAKkMAQtBAAsiASALQf8BcWxB/wEgAWsiCCAKQf8BcWxqQQh2IgkgASACbCAIIApBCHZB/wFxbGpBgH5xIAtBEHZB/wFxIAFsIApBEHZB/wFxIAhsakEIdEGAgHxxc3MiCEGAgIB4cyECIARDAACgQJQiACAAj5MiAEPNzMw+Xw0CIABDAAAAP19FBEAgAENI4Xo/X0UEQAJ/QwAA+kUgAEMAAPpFlJMiAEMAAIBPXSAAQwAAAABgcQRAIACpDAELQQALIgFFDQRB/wEgAWsiASAIQRB2Qf8BcWxBCHRBgIB8cSAIQQh2Qf8BcSABbEGAfnEgASAJQf8BcWxBCHZBgICAeHJzcyECDAQLAn8gAEMAACBDlCIAQwAAgE9dIABDAAAAAGBxBEAgAKkMAQtBAAsiAUUNA0H/ASABayIBIAhBEHZB/wFxbEEIdEGAgHxxIAhBCHZB/wFxIAFsQYB+cSABIAlB/wFxbEEIdkGAgIB4cnNzIQIMAwsgAENI4fo+YEUEQAJ/IABDAEAcRZRDAAB6xJIiAEMAAIBPXSAAQwAAAABgcQRAIACpDAELQQALIgFFDQNB/wEgAWsiASAIQRB2Qf8BcWxBCHRBgIB8cSAIQQh2Qf8BcSABbEGAfnEgASAJQf8BcWxBCHZBgICAeHJzcyECDAMLAn8gAEMA0ITGlEMAEAZGkiIAQwAAgE9dIABDAAAAAGBxBEAgAKkMAQtBAAsiAUUNAkH/ASABayIBIAhBEHZB/wFxbEEIdEGAgHxxIAhBCHZB/wFxIAFsQYB+cSABIAlB/wFxbEEIdkGAgIB4cnNzIQIMAgsgC0EIdkH/AXEiESECIAtB/wFxIg0CfyAEQwAAf0OUIgBDAACAT10gAEMAAAAAYHEEQCAAqQwBC0EACyIBbCAKQf8BcSIOQf8BIAFrIhBsakEIdiIMIAEgAmwgECAKQQh2Qf8BcSIPbGpBgH5xIAtBEHZB/wFxIgkgAWwgECAKQRB2Qf8BcSIIbGpBCHRBgIB8cXNzIgpBgICAeHMhAiAEQwAAQECUIgAgAI+TIgVDmpmZPl8NASAFQzMzMz9gDQEgDEH/AXEhASAFQwBgn0SUIQAgCkEQdkH/AXEhECAKQQh2Qf8BcSEMIAVDAAAAP2BFBEBB/wECfyAAQwBAv8OSIgBDAACAT10gAEMAAAAAYHEEQCAAqQwBC0EACyICayIJIBBsIAIgCGxqQQh0QYCAfHEgCSAMbCACIA9sakGAfnEgASAJbCACIA5sakEIdkGAgIB4cnNzIQIMAgtB/wECfyAAQwBgH8SSIgBDAACAT10gAEMAAAAAYHEEQCAAqQwBC0EACyICayIIIBBsIAIgCWxqQQh0QYCAfHEgCCAMbCACIBFsakGAfnEgASAIbCACIA1sakEIdkGAgIB4cnNzIQIMAQsgC0EIdkH/AXEhAgJ/IARDAAB/Q5QiAEMAAIBPXSAAQwAAAABgcQRAIACpDAELQQALIgEgC0EQdkH/AXFsQf8BIAFrIgggCkEQdkH/AXFsakEIdEGAgHxxIAEgAmwgCkEIdkH/AXEgCGxqQYB+cSABIAtB/wFxbCAIIApB/wFxbGpBCHZBgICAeHJzcyECCwJ/IANDAABIQ5QiAEMAAIBPXSAAQwAAAABgcQRAIACpDAELQQALIgEEQEH/ASABayIBIAJBEHZB/wFxbEEIdEGAgHxxIAJBCHZB/wFxIAFsQYB+cSABIAJB/wFxbEEIdkGAgIB4cnNzIQILIAILZgEBf0H/ASACayIDIABBEHZB/wFxbCABQRB2Qf8BcSACbGpBCHRBgIB8cSADIABBCHZB/wFxbCABQQh2Qf8BcSACbGpBgH5xIAMgAEH/AXFsIAFB/wFxIAJsakEIdnNzQYCAgHhzC/IGAw5/BH0BfEEAQQAoAgAiCUEBajYCACAAQf8fakGAIG0iDyAJSgRAIABBAnQiB0HArQpqIhAgB2ohESAFQylcDz2UIRcgBZGRIRhB/wECfyAGIAaPk7siGUQAAAAAAOBvQKIgGZ+iIhlEAAAAAAAA8EFjIBlEAAAAAAAAAABmcQRAIBmrDAELQQALIgxrIQ0CfyAGi0MAAABPXQRAIAaoDAELQYCAgIB4CyESA0AgCUEMdCIJIABIBEAgCUGAIGoiByAAIAAgB0obIRMDQAJ/IAIgCUECdCIOQcCtCmoqAgAiBUMAwHnEWw0AGkMAAIA/IA4gEGoqAgAiFpMgFiAEQQJGGyEWIAVDAACgP2BFBEAgEiABb0ECdCIIQaSABGooAgAiB0H/AXEgDGwgCEGggARqKAIAIghB/wFxIA1sakEIdiIKIAdBCHZB/wFxIAxsIAhBCHZB/wFxIA1sakGAfnEgB0EQdkH/AXEgDGwgCEEQdkH/AXEgDWxqQQh0QYCAfHFzcyEHAn8gFkMAAEhDlCIVQwAAgE9dIBVDAAAAAGBxBEAgFakMAQtBAAsiCARAQf8BIAhrIgggB0EQdkH/AXFsQQh0QYCAfHEgCCAHQQh2Qf8BcWxBgH5xIApB/wFxIAhsQQh2c3MhBwsgBUMiAIA/X0UEQCAHQf8BcSEUAn8gBUMAAH9ElEMAAH/EkiIVQwAAgE9dIBVDAAAAAGBxBEAgFakMAQtBAAshCCAFvCILQf///wNxQYCAgPgDcr4hFSAFQwAAgL+SIBeUIAaSIAuzQwAAADSUQ3dz+MKSIBVDdb+/v5SSQ6Pp3L8gFUP5RLQ+kpWSIBiUkiABIAMgFhAAIgtBEHZB/wFxIAhsQf8BIAhrIgogB0EQdkH/AXFsakEIdEGAgHxxIAggC0EIdkH/AXFsIAogB0EIdkH/AXFsakGAfnEgC0H/AXEgCGwgCiAUbGpBCHZzcyEHCyAHQYCAgHhzDAELIAW8IgdB////A3FBgICA+ANyviEVIAVDAACAv5IgF5QgBpIgB7NDAAAANJRDd3P4wpIgFUN1v7+/lJJDo+ncvyAVQ/lEtD6SlZIgGJSSIAEgAyAWEAALIQcgDiARaiAHNgIAIBMgCUEBaiIJSg0ACwtBAEEAKAIAIglBAWo2AgAgCSAPSA0ACwsLhYQBAw18E38FfSAAQR91IiYgAHMgASACbCIjQQJ0IR0CfyANIA2Pk7siEUQAAAAAAOBvQKIgEZ+iIhFEAAAAAAAA8EFjIBFEAAAAAAAAAABmcQRAIBGrDAELQQALISQgHUHArQpqISggJmsCfyANi0MAAABPXQRAIA2oDAELQYCAgIB4CyEmIB0gKGohL0H/ASAkayEpIAdBAmohJyAMQylcDz2UITMgDJGRITRBfyEsQQFrISogB0EATCEfAkADQEEAQQAoAgAiAkEgaiIrNgIAIAIgI04NASAjICsgIyArSBshLQNAIAJBAnQiIUHArQpqIiUqAgAiDEMAAAAAWwRAIA8gAiABbSIdtyAFoiAEoCISIABBAEgiHhshFyAOIAIgASAdbGu3IAWiIAOgIhAgHhshGCAhIChqISACQAJAAkACQCALDgQAAgIBAgsCQAJAAkACQAJAAkACQAJAAkACQAJAAkACQAJAAkACQCAqDhAAAQIDBAUGBwgJCgsMDQ4PEgtDAMB5xCEwIB8NESAQIBCiIRMgEiASoiERQQEhHgNAIBMgEaEhFCASIBAgEKCiIBegIhIgEqIiESAUIBigIhAgEKIiE6AiFEQAAAAAgIQuQWVFBEAgFLa8Ih1B////A3FBgICA+ANyviEMIB2zQwAAADSUQ3dz+MKSIAxDdb+/v5SSQ6Pp3L8gDEP5RLQ+kpWSQwAAAD+UvCIdQf///wNxQYCAgPgDcr4hDCAes0N3c/hCkiAds0MAAAC0lJIgDEN1v78/lJJDo+ncPyAMQ/lEtD6SlZIhMAwTCyAHIB5GIB5BAWohHkUNAAsMEQtDAMB5xCEwIB8NECAQIBCiIRMgEiASoiERQQEhHgNAIBNEAAAAAAAACECiIRQgECATIBFEAAAAAAAACECioaIgGKAiECAQoiITIBQgEaEgEqIgF6AiEiASoiIRoCIURAAAAACAhC5BZUUEQCAUtrwiHUH///8DcUGAgID4A3K+IQwgHbNDAAAANJRDd3P4wpIgDEN1v7+/lJJDo+ncvyAMQ/lEtD6SlZJDAAAAP5S8Ih1B////A3FBgICA+ANyviEMIB6zIB2zQwAAADSUQ3dz+MKSIAxDdb+/v5SSQ6Pp3L8gDEP5RLQ+kpWSQ52EIb+UkiEwDBILIAcgHkYgHkEBaiEeRQ0ACwwQC0MAwHnEITAgHw0PIBAgEKIhESASIBKiIRNBASEeA0AgEyAToiEUIBNEAAAAAAAAGMCiIRYgEkQAAAAAAAAQQKIgESAToaIgEKIgF6AiEiASoiITIBQgGKAgESAWoCARoqAiECAQoiIRoCIURAAAAACAhC5BZUUEQCAUtrwiHUH///8DcUGAgID4A3K+IQwgHbNDAAAANJRDd3P4wpIgDEN1v7+/lJJDo+ncvyAMQ/lEtD6SlZJDAAAAP5S8Ih1B////A3FBgICA+ANyviEMIB6zIB2zQwAAADSUQ3dz+MKSIAxDdb+/v5SSQ6Pp3L8gDEP5RLQ+kpWSQwAAAD+UkyEwDBELIAcgHkYgHkEBaiEeRQ0ACwwPC0MAwHnEITAgHw0OIBAgEKIhEyASIBKiIhEgEaIhFUEBIR4DQCATRAAAAAAAABRAoiARRAAAAAAAACRAoiIUoSAToiAVoCASoiAXoCISIBKiIhEgEyAUoSAToiAVRAAAAAAAABRAoqAgEKIgGKAiECAQoiIToCIURAAAAACAhC5BZUUEQCAUtrwiHUH///8DcUGAgID4A3K+IQwgHbNDAAAANJRDd3P4wpIgDEN1v7+/lJJDo+ncvyAMQ/lEtD6SlZJDAAAAP5S8Ih1B////A3FBgICA+ANyviEMIB6zIB2zQwAAADSUQ3dz+MKSIAxDdb+/v5SSQ6Pp3L8gDEP5RLQ+kpWSQ6OB3L6UkiEwDBALIAcgHkYgESARoiEVIB5BAWohHkUNAAsMDgtDAMB5xCEwIB8NDSAQIBCiIhQgFKIhESASIBKiIhMgE6IhFUEBIR4DQCARRAAAAAAAAC5AoiAVoCAToiEWIBAgEqIgESAVoEQAAAAAAAAYQKIgE0QAAAAAAAA0wKIgFKKgoiAXoCISIBKiIhMgFCAVRAAAAAAAAC5AoiARoKIgFqEgGKAiECAQoiIUoCIRRAAAAACAhC5BZUUEQCARtrwiHUH///8DcUGAgID4A3K+IQwgHbNDAAAANJRDd3P4wpIgDEN1v7+/lJJDo+ncvyAMQ/lEtD6SlZJDAAAAP5S8Ih1B////A3FBgICA+ANyviEMIB6zIB2zQwAAADSUQ3dz+MKSIAxDdb+/v5SSQ6Pp3L8gDEP5RLQ+kpWSQ5IRxr6UkiEwDA8LIAcgHkYgEyAToiEVIBQgFKIhESAeQQFqIR5FDQALDA0LQwDAecQhMCAfDQwgECAQoiITIBOiIRUgEiASoiIRIBGiIRRBASEeA0AgE0QAAAAAAAAcQKIhFiATRAAAAAAAADVAoiEZIBNEAAAAAACAQUCiIBFEAAAAAAAAHECioSAUoiATIBFEAAAAAAAANUCioSAVoqAgEKIgGKAiECAQoiITIBYgEUQAAAAAAIBBQKKhIBWiIBkgEaEgFKKgIBKiIBegIhIgEqIiEaAiFEQAAAAAgIQuQWVFBEAgFLa8Ih1B////A3FBgICA+ANyviEMIB2zQwAAADSUQ3dz+MKSIAxDdb+/v5SSQ6Pp3L8gDEP5RLQ+kpWSQwAAAD+UvCIdQf///wNxQYCAgPgDcr4hDCAesyAds0MAAAA0lEN3c/jCkiAMQ3W/v7+UkkOj6dy/IAxD+US0PpKVkkPKYLa+lJIhMAwOCyAHIB5GIBEgEaIhFCATIBOiIRUgHkEBaiEeRQ0ACwwMC0MAwHnEITAgHw0LIBAgEKIhEyASIBKiIRFBASEeA0AgEyARoSEUIBIgECAQoKKZIBegIhIgEqIiESAUIBigIhAgEKIiE6AiFEQAAAAAgIQuQWVFBEAgFLa8Ih1B////A3FBgICA+ANyviEMIB2zQwAAADSUQ3dz+MKSIAxDdb+/v5SSQ6Pp3L8gDEP5RLQ+kpWSQwAAAD+UvCIdQf///wNxQYCAgPgDcr4hDCAes0N3c/hCkiAds0MAAAC0lJIgDEN1v78/lJJDo+ncPyAMQ/lEtD6SlZIhMAwNCyAHIB5GIB5BAWohHkUNAAsMCwtDAMB5xCEwIB8NCiAQIBCiIRMgEiASoiERQQEhHgNAIBNEAAAAAAAACECiIRQgEJkgEyARRAAAAAAAAAhAoqGiIBigIhAgEKIiEyAUIBGhIBKZoiAXoCISIBKiIhGgIhREAAAAAICELkFlRQRAIBS2vCIdQf///wNxQYCAgPgDcr4hDCAds0MAAAA0lEN3c/jCkiAMQ3W/v7+UkkOj6dy/IAxD+US0PpKVkkMAAAA/lLwiHUH///8DcUGAgID4A3K+IQwgHrMgHbNDAAAANJRDd3P4wpIgDEN1v7+/lJJDo+ncvyAMQ/lEtD6SlZJDnYQhv5SSITAMDAsgByAeRiAeQQFqIR5FDQALDAoLQwDAecQhMCAfDQkgECAQoiETIBIgEqIhEUEBIR4DQCARIBNEAAAAAAAAGMCioCARoiEUIBJEAAAAAAAAEECiIBCimSATIBGhoiAXoCISIBKiIhEgFCATIBOiIBigoCIQIBCiIhOgIhREAAAAAICELkFlRQRAIBS2vCIdQf///wNxQYCAgPgDcr4hDCAds0MAAAA0lEN3c/jCkiAMQ3W/v7+UkkOj6dy/IAxD+US0PpKVkkMAAAA/lLwiHUH///8DcUGAgID4A3K+IQwgHrMgHbNDAAAANJRDd3P4wpIgDEN1v7+/lJJDo+ncvyAMQ/lEtD6SlZJDAAAAP5STITAMCwsgByAeRiAeQQFqIR5FDQALDAkLQwDAecQhMCAfDQggECAQoiETIBIgEqIhEUEBIR4DQCATIBGhIRQgEiAQIBCgoiAXoCISIBKiIhEgFJkgGKAiECAQoiIToCIURAAAAACAhC5BZUUEQCAUtrwiHUH///8DcUGAgID4A3K+IQwgHbNDAAAANJRDd3P4wpIgDEN1v7+/lJJDo+ncvyAMQ/lEtD6SlZJDAAAAP5S8Ih1B////A3FBgICA+ANyviEMIB6zQ3dz+EKSIB2zQwAAALSUkiAMQ3W/vz+UkkOj6dw/IAxD+US0PpKVkiEwDAoLIAcgHkYgHkEBaiEeRQ0ACwwIC0MAwHnEITAgHw0HIBCZIREgEpohEiAQIBCiIRNBASEeA0AgEiASoiEQIBFEAAAAAAAAAMCiIBKiIBehIhIgEqIgEyAQoSAYoCIRIBGiIhOgIhBEAAAAAICELkFlRQRAIBC2vCIdQf///wNxQYCAgPgDcr4hDCAds0MAAAA0lEN3c/jCkiAMQ3W/v7+UkkOj6dy/IAxD+US0PpKVkkMAAAA/lLwiHUH///8DcUGAgID4A3K+IQwgHrNDd3P4QpIgHbNDAAAAtJSSIAxDdb+/P5SSQ6Pp3D8gDEP5RLQ+kpWSITAMCQsgByAeRiARmSERIB5BAWohHkUNAAsMBwtDAMB5xCEwIB8NBiAQIBCiIRMgEiASoiERQQEhHgNAIBCZIhAgEaAhFCAQIBKZIhEgEaCiIBGhIBegIhIgEqIiESAYIBShIBOgIhAgEKIiE6AiFEQAAAAAgIQuQWVFBEAgFLa8Ih1B////A3FBgICA+ANyviEMIB2zQwAAADSUQ3dz+MKSIAxDdb+/v5SSQ6Pp3L8gDEP5RLQ+kpWSQwAAAD+UvCIdQf///wNxQYCAgPgDcr4hDCAes0N3c/hCkiAds0MAAAC0lJIgDEN1v78/lJJDo+ncPyAMQ/lEtD6SlZIhMAwICyAHIB5GIB5BAWohHkUNAAsMBgtDAMB5xCEwIB8NBSAQIBCiIRMgEiASoiERQQEhHgNAIBMgEaEhFCAXIBIgECAQoKKhIhIgEqIiESAUIBigIhAgEKIiE6AiFEQAAAAAgIQuQWVFBEAgFLa8Ih1B////A3FBgICA+ANyviEMIB2zQwAAADSUQ3dz+MKSIAxDdb+/v5SSQ6Pp3L8gDEP5RLQ+kpWSQwAAAD+UvCIdQf///wNxQYCAgPgDcr4hDCAes0N3c/hCkiAds0MAAAC0lJIgDEN1v78/lJJDo+ncPyAMQ/lEtD6SlZIhMAwHCyAHIB5GIB5BAWohHkUNAAsMBQtDAMB5xCEwIB8NBCAQIBCiIRMgEiASoiERQQEhHkEBIR0DQAJ8IB1BCkYEQEEBIR0gEiAQIBCgopkMAQsgHUEBaiEdIBIgECAQoKILIBegIhIgEqIiFCATIBGhIBigIhAgEKIiE6AiEUQAAAAAgIQuQWVFBEAgEba8Ih1B////A3FBgICA+ANyviEMIB2zQwAAADSUQ3dz+MKSIAxDdb+/v5SSQ6Pp3L8gDEP5RLQ+kpWSQwAAAD+UvCIdQf///wNxQYCAgPgDcr4hDCAes0N3c/hCkiAds0MAAAC0lJIgDEN1v78/lJJDo+ncPyAMQ/lEtD6SlZIhMAwGCyAHIB5GIB5BAWohHiAUIRFFDQALDAQLQwDAecQhMCAfDQMgECAQoiERIBIgEqIhE0EBIR1BASEeA0AgE0QAAAAAAAAIQKIhFCASmSASIB5BCkYiIBsgEUQAAAAAAAAIQKIgE6GiIBegIhIgEqIiEyAQmSAQICAbIBEgFKGiIBigIhAgEKIiEaAiFEQAAAAAgIQuQWVFBEAgFLa8Ih5B////A3FBgICA+ANyviEMIB6zQwAAADSUQ3dz+MKSIAxDdb+/v5SSQ6Pp3L8gDEP5RLQ+kpWSQwAAAD+UvCIeQf///wNxQYCAgPgDcr4hDCAdsyAes0MAAAA0lEN3c/jCkiAMQ3W/v7+UkkOj6dy/IAxD+US0PpKVkkOdhCG/lJIhMAwFC0EBIB5BAWogIBshHiAHIB1GIB1BAWohHUUNAAsMAwtDAMB5xCEwIB8NAiAQIBCiIREgEiASoiETQQEhHkEBIR0DQAJ8IB1BCkYEQCASRAAAAAAAABBAoiAQopkgESAToaIhEkEBIR0gEyARRAAAAAAAABjAoqAgE6IgESARoqAMAQsgEkQAAAAAAAAQQKIgESAToaIgEKIhEiAdQQFqIR0gESATRAAAAAAAABjAoqAgEaIgEyAToqALIREgEiAXoCISIBKiIhMgESAYoCIQIBCiIhGgIhREAAAAAICELkFlRQRAIBS2vCIdQf///wNxQYCAgPgDcr4hDCAds0MAAAA0lEN3c/jCkiAMQ3W/v7+UkkOj6dy/IAxD+US0PpKVkkMAAAA/lLwiHUH///8DcUGAgID4A3K+IQwgHrMgHbNDAAAANJRDd3P4wpIgDEN1v7+/lJJDo+ncvyAMQ/lEtD6SlZJDAAAAP5STITAMBAsgByAeRiAeQQFqIR5FDQALDAILAkACQAJAAkACQAJAAkACQAJAAkACQAJAAkACQAJAAkAgKg4QAAECAwQFBgcICQoLDA0ODxELQwDAecQhMCAfDRAgECAQoiERIBIgEqIhFUEBIR4DQCARIBWhIBigIhQgFKIiESAQIBIgEqCiIBegIhIgEqIiFaAiEEQAAAAAgIQuQWVFBEAgICASRAAAAGCeoPY/oiAUIBKgIhEgEaIgEiAUoSIRIBGioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgAgELa8Ih1B////A3FBgICA+ANyviEMIB2zQwAAADSUQ3dz+MKSIAxDdb+/v5SSQ6Pp3L8gDEP5RLQ+kpWSQwAAAD+UvCIdQf///wNxQYCAgPgDcr4hDCAes0N3c/hCkiAds0MAAAC0lJIgDEN1v78/lJJDo+ncPyAMQ/lEtD6SlZIhMAwSCyAHIB5GIBQhECAeQQFqIR5FDQALDBALQwDAecQhMCAfDQ8gECAQoiETIBIgEqIhEUEBIR4DQCATRAAAAAAAAAhAoiEUIBMgEUQAAAAAAAAIQKKhIBCiIBigIhAgEKIiEyAUIBGhIBKiIBegIhIgEqIiEaAiFEQAAAAAgIQuQWVFBEAgICASRAAAAGCeoPY/oiAQIBKgIhEgEaIgEiAQoSIRIBGioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgAgFLa8Ih1B////A3FBgICA+ANyviEMIB2zQwAAADSUQ3dz+MKSIAxDdb+/v5SSQ6Pp3L8gDEP5RLQ+kpWSQwAAAD+UvCIdQf///wNxQYCAgPgDcr4hDCAesyAds0MAAAA0lEN3c/jCkiAMQ3W/v7+UkkOj6dy/IAxD+US0PpKVkkOdhCG/lJIhMAwRCyAHIB5GIB5BAWohHkUNAAsMDwtDAMB5xCEwIB8NDiAQIBCiIREgEiASoiETQQEhHgNAIBMgE6IhFCATRAAAAAAAABjAoiEWIBBEAAAAAAAAEECiIBKiIBEgE6GiIBegIhIgEqIiEyAUIBigIBEgFqAgEaKgIhAgEKIiEaAiFEQAAAAAgIQuQWVFBEAgICASRAAAAGCeoPY/oiASIBCgIhEgEaIgEiAQoSIRIBGioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgAgFLa8Ih1B////A3FBgICA+ANyviEMIB2zQwAAADSUQ3dz+MKSIAxDdb+/v5SSQ6Pp3L8gDEP5RLQ+kpWSQwAAAD+UvCIdQf///wNxQYCAgPgDcr4hDCAesyAds0MAAAA0lEN3c/jCkiAMQ3W/v7+UkkOj6dy/IAxD+US0PpKVkkMAAAA/lJMhMAwQCyAHIB5GIB5BAWohHkUNAAsMDgtDAMB5xCEwIB8NDSAQIBCiIRMgEiASoiIRIBGiIRVBASEeA0AgE0QAAAAAAAAUQKIgEUQAAAAAAAAkQKIiFKEgE6IgFaAgEqIgF6AiEiASoiIRIBMgFKEgE6IgFUQAAAAAAAAUQKKgIBCiIBigIhAgEKIiE6AiFEQAAAAAgIQuQWVFBEAgICASRAAAAGCeoPY/oiASIBCgIhEgEaIgEiAQoSIRIBGioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgAgFLa8Ih1B////A3FBgICA+ANyviEMIB2zQwAAADSUQ3dz+MKSIAxDdb+/v5SSQ6Pp3L8gDEP5RLQ+kpWSQwAAAD+UvCIdQf///wNxQYCAgPgDcr4hDCAesyAds0MAAAA0lEN3c/jCkiAMQ3W/v7+UkkOj6dy/IAxD+US0PpKVkkOjgdy+lJIhMAwPCyAHIB5GIBEgEaIhFSAeQQFqIR5FDQALDA0LQwDAecQhMCAfDQwgECAQoiIUIBSiIREgEiASoiITIBOiIRVBASEeA0AgEUQAAAAAAAAuQKIgFaAgE6IhFiASIBCiIBEgFaBEAAAAAAAAGECiIBREAAAAAAAANMCiIBOioKIgF6AiEiASoiITIBVEAAAAAAAALkCiIBGgIBSiIBahIBigIhAgEKIiFKAiEUQAAAAAgIQuQWVFBEAgICASRAAAAGCeoPY/oiASIBCgIhQgFKIgEiAQoSIQIBCioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgAgEba8Ih1B////A3FBgICA+ANyviEMIB2zQwAAADSUQ3dz+MKSIAxDdb+/v5SSQ6Pp3L8gDEP5RLQ+kpWSQwAAAD+UvCIdQf///wNxQYCAgPgDcr4hDCAesyAds0MAAAA0lEN3c/jCkiAMQ3W/v7+UkkOj6dy/IAxD+US0PpKVkkOSEca+lJIhMAwOCyAHIB5GIBMgE6IhFSAUIBSiIREgHkEBaiEeRQ0ACwwMC0MAwHnEITAgHw0LIBAgEKIiEyAToiEVIBIgEqIiESARoiEUQQEhHgNAIBNEAAAAAAAAHECiIRYgE0QAAAAAAAA1QKIhGSAVIBMgEUQAAAAAAAA1QKKhoiATRAAAAAAAgEFAoiARRAAAAAAAABxAoqEgFKKgIBCiIBigIhAgEKIiEyAVIBYgEUQAAAAAAIBBQKKhoiAUIBkgEaGioCASoiAXoCISIBKiIhGgIhREAAAAAICELkFlRQRAICAgEkQAAABgnqD2P6IgECASoCIRIBGiIBIgEKEiESARoqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIAIBS2vCIdQf///wNxQYCAgPgDcr4hDCAds0MAAAA0lEN3c/jCkiAMQ3W/v7+UkkOj6dy/IAxD+US0PpKVkkMAAAA/lLwiHUH///8DcUGAgID4A3K+IQwgHrMgHbNDAAAANJRDd3P4wpIgDEN1v7+/lJJDo+ncvyAMQ/lEtD6SlZJDymC2vpSSITAMDQsgByAeRiARIBGiIRQgEyAToiEVIB5BAWohHkUNAAsMCwtDAMB5xCEwIB8NCiAQIBCiIRMgEiASoiERQQEhHgNAIBMgEaEhFCAQIBIgEqCimSAXoCISIBKiIhEgFCAYoCIQIBCiIhOgIhREAAAAAICELkFlRQRAICAgEkQAAABgnqD2P6IgEiAQoCIRIBGiIBIgEKEiESARoqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIAIBS2vCIdQf///wNxQYCAgPgDcr4hDCAds0MAAAA0lEN3c/jCkiAMQ3W/v7+UkkOj6dy/IAxD+US0PpKVkkMAAAA/lLwiHUH///8DcUGAgID4A3K+IQwgHrNDd3P4QpIgHbNDAAAAtJSSIAxDdb+/P5SSQ6Pp3D8gDEP5RLQ+kpWSITAMDAsgByAeRiAeQQFqIR5FDQALDAoLQwDAecQhMCAfDQkgECAQoiETIBIgEqIhEUEBIR4DQCATRAAAAAAAAAhAoiEUIBMgEUQAAAAAAAAIQKKhIBCZoiAYoCIQIBCiIhMgFCARoSASmaIgF6AiEiASoiIRoCIURAAAAACAhC5BZUUEQCAgIBJEAAAAYJ6g9j+iIBAgEqAiESARoiASIBChIhEgEaKgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCACAUtrwiHUH///8DcUGAgID4A3K+IQwgHbNDAAAANJRDd3P4wpIgDEN1v7+/lJJDo+ncvyAMQ/lEtD6SlZJDAAAAP5S8Ih1B////A3FBgICA+ANyviEMIB6zIB2zQwAAADSUQ3dz+MKSIAxDdb+/v5SSQ6Pp3L8gDEP5RLQ+kpWSQ52EIb+UkiEwDAsLIAcgHkYgHkEBaiEeRQ0ACwwJC0MAwHnEITAgHw0IIBAgEKIhESASIBKiIRNBASEeA0AgEyAToiAYoCARIBNEAAAAAAAAGMCioCARoqAiFCAUoiIWIBBEAAAAAAAAEECiIBKimSARIBOhoiAXoCISIBKiIhOgIhFEAAAAAICELkFlRQRAICAgEkQAAABgnqD2P6IgFCASoCIQIBCiIBIgFKEiECAQoqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIAIBG2vCIdQf///wNxQYCAgPgDcr4hDCAds0MAAAA0lEN3c/jCkiAMQ3W/v7+UkkOj6dy/IAxD+US0PpKVkkMAAAA/lLwiHUH///8DcUGAgID4A3K+IQwgHrMgHbNDAAAANJRDd3P4wpIgDEN1v7+/lJJDo+ncvyAMQ/lEtD6SlZJDAAAAP5STITAMCgsgByAeRiAUIRAgFiERIB5BAWohHkUNAAsMCAtDAMB5xCEwIB8NByAQIBCiIRMgEiASoiERQQEhHgNAIBAgEiASoKIhFCATIBGhmSAYoCIQIBCiIhMgFCAXoCISIBKiIhGgIhREAAAAAICELkFlRQRAICAgEkQAAABgnqD2P6IgECASoCIRIBGiIBIgEKEiESARoqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIAIBS2vCIdQf///wNxQYCAgPgDcr4hDCAds0MAAAA0lEN3c/jCkiAMQ3W/v7+UkkOj6dy/IAxD+US0PpKVkkMAAAA/lLwiHUH///8DcUGAgID4A3K+IQwgHrNDd3P4QpIgHbNDAAAAtJSSIAxDdb+/P5SSQ6Pp3D8gDEP5RLQ+kpWSITAMCQsgByAeRiAeQQFqIR5FDQALDAcLQwDAecQhMCAfDQYgEJkhEyASmiERIBAgEKIhFEEBIR4DQCATRAAAAAAAAADAoiAUIBEgEaKhIBCgIhSZIRMgEaIgEqEiESARoiAUIBSiIhSgIhZEAAAAAICELkFlRQRAICAgEUQAAABgnqD2P6IgEyARoCIQIBCiIBEgE6EiESARoqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIAIBa2vCIdQf///wNxQYCAgPgDcr4hDCAds0MAAAA0lEN3c/jCkiAMQ3W/v7+UkkOj6dy/IAxD+US0PpKVkkMAAAA/lLwiHUH///8DcUGAgID4A3K+IQwgHrNDd3P4QpIgHbNDAAAAtJSSIAxDdb+/P5SSQ6Pp3D8gDEP5RLQ+kpWSITAMCAsgByAeRiAeQQFqIR5FDQALDAYLQwDAecQhMCAfDQUgECAQoiETIBIgEqIhEUEBIR4DQCAQmSIQIBGgIRQgECASmSIRIBGgoiARoSAXoCISIBKiIhEgGCAToCAUoSIQIBCiIhOgIhREAAAAAICELkFlRQRAICAgEkQAAABgnqD2P6IgEiAQoCIRIBGiIBIgEKEiESARoqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIAIBS2vCIdQf///wNxQYCAgPgDcr4hDCAds0MAAAA0lEN3c/jCkiAMQ3W/v7+UkkOj6dy/IAxD+US0PpKVkkMAAAA/lLwiHUH///8DcUGAgID4A3K+IQwgHrNDd3P4QpIgHbNDAAAAtJSSIAxDdb+/P5SSQ6Pp3D8gDEP5RLQ+kpWSITAMBwsgByAeRiAeQQFqIR5FDQALDAULQwDAecQhMCAfDQQgECAQoiERIBIgEqIhFUEBIR4DQCARIBWhIBigIhQgFKIiESAXIBAgEiASoKKhIhIgEqIiFaAiEEQAAAAAgIQuQWVFBEAgICASRAAAAGCeoPY/oiAUIBKgIhEgEaIgEiAUoSIRIBGioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgAgELa8Ih1B////A3FBgICA+ANyviEMIB2zQwAAADSUQ3dz+MKSIAxDdb+/v5SSQ6Pp3L8gDEP5RLQ+kpWSQwAAAD+UvCIdQf///wNxQYCAgPgDcr4hDCAes0N3c/hCkiAds0MAAAC0lJIgDEN1v78/lJJDo+ncPyAMQ/lEtD6SlZIhMAwGCyAHIB5GIBQhECAeQQFqIR5FDQALDAQLQwDAecQhMCAfDQMgECAQoiETIBIgEqIhEUEBIR1BASEeA0ACfCAdQQpGBEBBASEdIBAgEiASoKKZDAELIB1BAWohHSAQIBIgEqCiCyAXoCISIBKiIhQgEyARoSAYoCIQIBCiIhOgIhFEAAAAAICELkFlRQRAICAgEkQAAABgnqD2P6IgEiAQoCIUIBSiIBIgEKEiECAQoqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIAIBG2vCIdQf///wNxQYCAgPgDcr4hDCAds0MAAAA0lEN3c/jCkiAMQ3W/v7+UkkOj6dy/IAxD+US0PpKVkkMAAAA/lLwiHUH///8DcUGAgID4A3K+IQwgHrNDd3P4QpIgHbNDAAAAtJSSIAxDdb+/P5SSQ6Pp3D8gDEP5RLQ+kpWSITAMBQsgByAeRiAeQQFqIR4gFCERRQ0ACwwDC0MAwHnEITAgHw0CIBAgEKIhEyASIBKiIRFBASEeQQEhHQNAIBNEAAAAAAAACECiIRQgEJkgECAeQQpGIiIbIBMgEUQAAAAAAAAIQKKhoiAYoCIQIBCiIhMgFCARoSASmSASICIboiAXoCISIBKiIhGgIhREAAAAAICELkFlRQRAICAgEkQAAABgnqD2P6IgECASoCIRIBGiIBIgEKEiESARoqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIAIBS2vCIeQf///wNxQYCAgPgDcr4hDCAes0MAAAA0lEN3c/jCkiAMQ3W/v7+UkkOj6dy/IAxD+US0PpKVkkMAAAA/lLwiHkH///8DcUGAgID4A3K+IQwgHbMgHrNDAAAANJRDd3P4wpIgDEN1v7+/lJJDo+ncvyAMQ/lEtD6SlZJDnYQhv5SSITAMBAtBASAeQQFqICIbIR4gByAdRiAdQQFqIR1FDQALDAILQwDAecQhMCAfDQEgECAQoiERIBIgEqIhE0EBIR1BASEeA0AgE0QAAAAAAAAYQKIhFAJAIB1BCkYEQCARIBOhIBBEAAAAAAAAEECiIBKimaIhEkEBIR0MAQsgEEQAAAAAAAAQQKIgEqIgESAToaIhEiAdQQFqIR0LIBEgFKEgEaIgEyAToqAgGKAiECAQoiIRIBIgF6AiEiASoiIToCIURAAAAACAhC5BZUUEQCAgIBJEAAAAYJ6g9j+iIBAgEqAiESARoiASIBChIhEgEaKgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCACAUtrwiHUH///8DcUGAgID4A3K+IQwgHbNDAAAANJRDd3P4wpIgDEN1v7+/lJJDo+ncvyAMQ/lEtD6SlZJDAAAAP5S8Ih1B////A3FBgICA+ANyviEMIB6zIB2zQwAAADSUQ3dz+MKSIAxDdb+/v5SSQ6Pp3L8gDEP5RLQ+kpWSQwAAAD+UkyEwDAMLIAcgHkYgHkEBaiEeRQ0ACwwBCwJAAkACQAJAAkACQAJAAkACQAJAAkACQAJAAkACQAJAICoOEAABAgMEBQYHCAkKCwwNDg8QC0MAwHnEITAgHw0PIBAgEKIhFSASIBKiIRRBASEeRAAAAAAAAAAAIRNEAAAAAAAA8D8hEQNAIBEgEKIgEyASoqEiFiAWoEQAAAAAAADwP6AhFiATIBCiIBEgEqKgIhEgEaAhEyAVIBShIBigIhEgEaIiFSAQIBIgEqCiIBegIhIgEqIiFKAiGUQAAAAAgIQuQWVFBEAgICAWIBGiIBMgEqKgIBYgFqIgEyAToqAiFKMiECAWIBKiIBMgEaKhIBSjIhGgRAAAAGCeoOY/oiAQIBCiIBEgEaKgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCACAZtrwiHUH///8DcUGAgID4A3K+IQwgHbNDAAAANJRDd3P4wpIgDEN1v7+/lJJDo+ncvyAMQ/lEtD6SlZJDAAAAP5S8Ih1B////A3FBgICA+ANyviEMIB6zQ3dz+EKSIB2zQwAAALSUkiAMQ3W/vz+UkkOj6dw/IAxD+US0PpKVkiEwDBELIAcgHkYgESEQIBYhESAeQQFqIR5FDQALDA8LQwDAecQhMCAfDQ4gECAQoiETIBIgEqIhEUEBIR5EAAAAAAAAAAAhFEQAAAAAAADwPyEVA0AgEiAQIBCgoiIZIBWiIBMgEaEiGiAUoqBEAAAAAAAACECiIRYgGiAVoiAZIBSioUQAAAAAAAAIQKJEAAAAAAAA8D+gIRUgE0QAAAAAAAAIQKIhFCAQIBMgEUQAAAAAAAAIQKKhoiAYoCIQIBCiIhMgFCARoSASoiAXoCISIBKiIhGgIhREAAAAAICELkFlRQRAICAgFSAQoiAWIBKioCAVIBWiIBYgFqKgIhmjIhEgFSASoiAWIBCioSAZoyIQoEQAAABgnqDmP6IgESARoiAQIBCioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgAgFLa8Ih1B////A3FBgICA+ANyviEMIB2zQwAAADSUQ3dz+MKSIAxDdb+/v5SSQ6Pp3L8gDEP5RLQ+kpWSQwAAAD+UvCIdQf///wNxQYCAgPgDcr4hDCAesyAds0MAAAA0lEN3c/jCkiAMQ3W/v7+UkkOj6dy/IAxD+US0PpKVkkOdhCG/lJIhMAwQCyAHIB5GIBYhFCAeQQFqIR5FDQALDA4LQwDAecQhMCAfDQ0gECAQoiERIBIgEqIhE0EBIR5EAAAAAAAAAAAhFUQAAAAAAADwPyEUA0AgECAVoiASIBSioCIWIBEgE6EiGUQAAAAAAAAQQKIiGqIgECASoiIbRAAAAAAAACBAoiIcIBAgFKIgEiAVoqEiEKKgIRUgECAaoiAcIBaioUQAAAAAAADwP6AhFCATIBOiIRAgE0QAAAAAAAAYwKIhFiAZIBuiRAAAAAAAABBAoiAXoCISIBKiIhMgECAYoCARIBagIBGioCIQIBCiIhGgIhZEAAAAAICELkFlRQRAICAgFCAQoiASIBWioCAUIBSiIBUgFaKgIhmjIhEgEiAUoiAVIBCioSAZoyIQoEQAAABgnqDmP6IgESARoiAQIBCioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgAgFra8Ih1B////A3FBgICA+ANyviEMIB2zQwAAADSUQ3dz+MKSIAxDdb+/v5SSQ6Pp3L8gDEP5RLQ+kpWSQwAAAD+UvCIdQf///wNxQYCAgPgDcr4hDCAesyAds0MAAAA0lEN3c/jCkiAMQ3W/v7+UkkOj6dy/IAxD+US0PpKVkkMAAAA/lJMhMAwPCyAHIB5GIB5BAWohHkUNAAsMDQtDAMB5xCEwIB8NDCAQIBCiIRMgEiASoiIRIBGiIRVEAAAAAAAAAAAhGUEBIR5EAAAAAAAA8D8hFANAIBMgEUQAAAAAAAAYwKKgIBOiIBWgRAAAAAAAABRAoiIaIBmiIBJEAAAAAAAANECiIBMgEaGiIBCiIhsgFKKgIRYgGiAUoiAbIBmioUQAAAAAAADwP6AhFCATRAAAAAAAABRAoiARRAAAAAAAACRAoiIZoSAToiAVoCASoiAXoCISIBKiIhEgEyAZoSAToiAVRAAAAAAAABRAoqAgEKIgGKAiECAQoiIToCIZRAAAAACAhC5BZUUEQCAgIBQgEKIgFiASoqAgFCAUoiAWIBaioCIToyIRIBQgEqIgFiAQoqEgE6MiEKBEAAAAYJ6g5j+iIBEgEaIgECAQoqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIAIBm2vCIdQf///wNxQYCAgPgDcr4hDCAds0MAAAA0lEN3c/jCkiAMQ3W/v7+UkkOj6dy/IAxD+US0PpKVkkMAAAA/lLwiHUH///8DcUGAgID4A3K+IQwgHrMgHbNDAAAANJRDd3P4wpIgDEN1v7+/lJJDo+ncvyAMQ/lEtD6SlZJDo4HcvpSSITAMDgsgByAeRiARIBGiIRUgHkEBaiEeIBYhGUUNAAsMDAtDAMB5xCEwIB8NCyAQIBCiIhQgFKIhESASIBKiIhMgE6IhFUEBIR4DQCARRAAAAAAAAC5AoiAVoCAToiEWIBAgEqIgESAVoEQAAAAAAAAYQKIgE0QAAAAAAAA0wKIgFKKgoiAXoCISIBKiIhMgFCAVRAAAAAAAAC5AoiARoKIgFqEgGKAiECAQoiIUoCIRRAAAAACAhC5BZUUEQCARtrwiHUH///8DcUGAgID4A3K+IQwgHbNDAAAANJRDd3P4wpIgDEN1v7+/lJJDo+ncvyAMQ/lEtD6SlZJDAAAAP5S8Ih1B////A3FBgICA+ANyviEMIB6zIB2zQwAAADSUQ3dz+MKSIAxDdb+/v5SSQ6Pp3L8gDEP5RLQ+kpWSQ5IRxr6UkiEwDA0LIAcgHkYgEyAToiEVIBQgFKIhESAeQQFqIR5FDQALDAsLQwDAecQhMCAfDQogECAQoiITIBOiIRUgEiASoiIRIBGiIRRBASEeA0AgE0QAAAAAAAAcQKIhFiATRAAAAAAAADVAoiEZIBNEAAAAAACAQUCiIBFEAAAAAAAAHECioSAUoiATIBFEAAAAAAAANUCioSAVoqAgEKIgGKAiECAQoiITIBYgEUQAAAAAAIBBQKKhIBWiIBkgEaEgFKKgIBKiIBegIhIgEqIiEaAiFEQAAAAAgIQuQWVFBEAgFLa8Ih1B////A3FBgICA+ANyviEMIB2zQwAAADSUQ3dz+MKSIAxDdb+/v5SSQ6Pp3L8gDEP5RLQ+kpWSQwAAAD+UvCIdQf///wNxQYCAgPgDcr4hDCAesyAds0MAAAA0lEN3c/jCkiAMQ3W/v7+UkkOj6dy/IAxD+US0PpKVkkPKYLa+lJIhMAwMCyAHIB5GIBEgEaIhFCATIBOiIRUgHkEBaiEeRQ0ACwwKC0MAwHnEITAgHw0JIBAgEKIhFSASIBKiIRRBASEeRAAAAAAAAAAAIRNEAAAAAAAA8D8hEQNAIBEgEKIgEyASoqEiFiAWoEQAAAAAAADwP6AhFiAVIBShIRkgEyAQoiARIBKioCIRIBGgIRMgECASIBKgopkgF6AiEiASoiIUIBkgGKAiECAQoiIVoCIZRAAAAACAhC5BZUUEQCAgIBYgEKIgEyASoqAgFiAWoiATIBOioCIUoyIRIBYgEqIgEyAQoqEgFKMiEKBEAAAAYJ6g5j+iIBEgEaIgECAQoqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIAIBm2vCIdQf///wNxQYCAgPgDcr4hDCAds0MAAAA0lEN3c/jCkiAMQ3W/v7+UkkOj6dy/IAxD+US0PpKVkkMAAAA/lLwiHUH///8DcUGAgID4A3K+IQwgHrNDd3P4QpIgHbNDAAAAtJSSIAxDdb+/P5SSQ6Pp3D8gDEP5RLQ+kpWSITAMCwsgByAeRiAWIREgHkEBaiEeRQ0ACwwJC0MAwHnEITAgHw0IIBAgEKIhEyASIBKiIRFBASEeRAAAAAAAAAAAIRREAAAAAAAA8D8hFQNAIBIgECAQoKIiGSAVoiATIBGhIhogFKKgRAAAAAAAAAhAoiEWIBogFaIgGSAUoqFEAAAAAAAACECiRAAAAAAAAPA/oCEVIBNEAAAAAAAACECiIRQgEJkgEyARRAAAAAAAAAhAoqGiIBigIhAgEKIiEyASmSAUIBGhoiAXoCISIBKiIhGgIhREAAAAAICELkFlRQRAICAgFSAQoiAWIBKioCAVIBWiIBYgFqKgIhmjIhEgFSASoiAWIBCioSAZoyIQoEQAAABgnqDmP6IgESARoiAQIBCioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgAgFLa8Ih1B////A3FBgICA+ANyviEMIB2zQwAAADSUQ3dz+MKSIAxDdb+/v5SSQ6Pp3L8gDEP5RLQ+kpWSQwAAAD+UvCIdQf///wNxQYCAgPgDcr4hDCAesyAds0MAAAA0lEN3c/jCkiAMQ3W/v7+UkkOj6dy/IAxD+US0PpKVkkOdhCG/lJIhMAwKCyAHIB5GIBYhFCAeQQFqIR5FDQALDAgLQwDAecQhMCAfDQcgECAQoiERIBIgEqIhE0EBIR5EAAAAAAAAAAAhFUQAAAAAAADwPyEUA0AgECAVoiASIBSioCIWIBEgE6EiGUQAAAAAAAAQQKIiGqIgECASoiIbRAAAAAAAACBAoiIcIBAgFKIgEiAVoqEiEKKgIRUgECAaoiAcIBaioUQAAAAAAADwP6AhFCATIBOiIRAgE0QAAAAAAAAYwKIhFiAbRAAAAAAAABBAopkgGaIgF6AiEiASoiITIBAgGKAgESAWoCARoqAiECAQoiIRoCIWRAAAAACAhC5BZUUEQCAgIBQgEKIgEiAVoqAgFCAUoiAVIBWioCIZoyIRIBIgFKIgFSAQoqEgGaMiEKBEAAAAYJ6g5j+iIBEgEaIgECAQoqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIAIBa2vCIdQf///wNxQYCAgPgDcr4hDCAds0MAAAA0lEN3c/jCkiAMQ3W/v7+UkkOj6dy/IAxD+US0PpKVkkMAAAA/lLwiHUH///8DcUGAgID4A3K+IQwgHrMgHbNDAAAANJRDd3P4wpIgDEN1v7+/lJJDo+ncvyAMQ/lEtD6SlZJDAAAAP5STITAMCQsgByAeRiAeQQFqIR5FDQALDAcLQwDAecQhMCAfDQYgECAQoiETIBIgEqIhEUEBIR4DQCATIBGhIRQgEiAQIBCgoiAXoCISIBKiIhEgFJkgGKAiECAQoiIToCIURAAAAACAhC5BZUUEQCAUtrwiHUH///8DcUGAgID4A3K+IQwgHbNDAAAANJRDd3P4wpIgDEN1v7+/lJJDo+ncvyAMQ/lEtD6SlZJDAAAAP5S8Ih1B////A3FBgICA+ANyviEMIB6zQ3dz+EKSIB2zQwAAALSUkiAMQ3W/vz+UkkOj6dw/IAxD+US0PpKVkiEwDAgLIAcgHkYgHkEBaiEeRQ0ACwwGC0MAwHnEITAgHw0FIBCZIREgEpohEiAQIBCiIRNBASEeA0AgEiASoiEQIBFEAAAAAAAAAMCiIBKiIBehIhIgEqIgEyAQoSAYoCIRIBGiIhOgIhBEAAAAAICELkFlRQRAIBC2vCIdQf///wNxQYCAgPgDcr4hDCAds0MAAAA0lEN3c/jCkiAMQ3W/v7+UkkOj6dy/IAxD+US0PpKVkkMAAAA/lLwiHUH///8DcUGAgID4A3K+IQwgHrNDd3P4QpIgHbNDAAAAtJSSIAxDdb+/P5SSQ6Pp3D8gDEP5RLQ+kpWSITAMBwsgByAeRiARmSERIB5BAWohHkUNAAsMBQtDAMB5xCEwIB8NBCAQIBCiIRMgEiASoiERQQEhHgNAIBCZIhAgEaAhFCAQIBKZIhEgEaCiIBGhIBegIhIgEqIiESAYIBShIBOgIhAgEKIiE6AiFEQAAAAAgIQuQWVFBEAgFLa8Ih1B////A3FBgICA+ANyviEMIB2zQwAAADSUQ3dz+MKSIAxDdb+/v5SSQ6Pp3L8gDEP5RLQ+kpWSQwAAAD+UvCIdQf///wNxQYCAgPgDcr4hDCAes0N3c/hCkiAds0MAAAC0lJIgDEN1v78/lJJDo+ncPyAMQ/lEtD6SlZIhMAwGCyAHIB5GIB5BAWohHkUNAAsMBAtDAMB5xCEwIB8NAyAQIBCiIRMgEiASoiERQQEhHgNAIBMgEaEhFCAXIBIgECAQoKKhIhIgEqIiESAUIBigIhAgEKIiE6AiFEQAAAAAgIQuQWVFBEAgFLa8Ih1B////A3FBgICA+ANyviEMIB2zQwAAADSUQ3dz+MKSIAxDdb+/v5SSQ6Pp3L8gDEP5RLQ+kpWSQwAAAD+UvCIdQf///wNxQYCAgPgDcr4hDCAes0N3c/hCkiAds0MAAAC0lJIgDEN1v78/lJJDo+ncPyAMQ/lEtD6SlZIhMAwFCyAHIB5GIB5BAWohHkUNAAsMAwtDAMB5xCEwIB8NAiAQIBCiIRMgEiASoiERQQEhHkEBIR0DQAJ8IB1BCkYEQEEBIR0gEiAQIBCgopkMAQsgHUEBaiEdIBIgECAQoKILIBegIhIgEqIiFCATIBGhIBigIhAgEKIiE6AiEUQAAAAAgIQuQWVFBEAgEba8Ih1B////A3FBgICA+ANyviEMIB2zQwAAADSUQ3dz+MKSIAxDdb+/v5SSQ6Pp3L8gDEP5RLQ+kpWSQwAAAD+UvCIdQf///wNxQYCAgPgDcr4hDCAes0N3c/hCkiAds0MAAAC0lJIgDEN1v78/lJJDo+ncPyAMQ/lEtD6SlZIhMAwECyAHIB5GIB5BAWohHiAUIRFFDQALDAILQwDAecQhMCAfDQEgECAQoiERIBIgEqIhE0EBIR1BASEeA0AgE0QAAAAAAAAIQKIhFCASmSASIB5BCkYiIBsgEUQAAAAAAAAIQKIgE6GiIBegIhIgEqIiEyAQmSAQICAbIBEgFKGiIBigIhAgEKIiEaAiFEQAAAAAgIQuQWVFBEAgFLa8Ih5B////A3FBgICA+ANyviEMIB6zQwAAADSUQ3dz+MKSIAxDdb+/v5SSQ6Pp3L8gDEP5RLQ+kpWSQwAAAD+UvCIeQf///wNxQYCAgPgDcr4hDCAdsyAes0MAAAA0lEN3c/jCkiAMQ3W/v7+UkkOj6dy/IAxD+US0PpKVkkOdhCG/lJIhMAwDC0EBIB5BAWogIBshHiAHIB1GIB1BAWohHUUNAAsMAQtDAMB5xCEwIB8NACAQIBCiIREgEiASoiETQQEhHkEBIR0DQAJ8IB1BCkYEQCASRAAAAAAAABBAoiAQopkgESAToaIhEkEBIR0gEyARRAAAAAAAABjAoqAgE6IgESARoqAMAQsgEkQAAAAAAAAQQKIgESAToaIgEKIhEiAdQQFqIR0gESATRAAAAAAAABjAoqAgEaIgEyAToqALIREgEiAXoCISIBKiIhMgESAYoCIQIBCiIhGgIhREAAAAAICELkFlRQRAIBS2vCIdQf///wNxQYCAgPgDcr4hDCAds0MAAAA0lEN3c/jCkiAMQ3W/v7+UkkOj6dy/IAxD+US0PpKVkkMAAAA/lLwiHUH///8DcUGAgID4A3K+IQwgHrMgHbNDAAAANJRDd3P4wpIgDEN1v7+/lJJDo+ncvyAMQ/lEtD6SlZJDAAAAP5STITAMAgsgByAeRyAeQQFqIR4NAAsLICUgMDgCACAwQwDAecRbIR4gJwJ/IDCLQwAAAE9dBEAgMKgMAQtBgICAgHgLQQxqIB4bIC5qIS4gMCEMCyAhIC9qAn8gCSAMQwDAecRbDQAaQwAAgD8gISAoaioCACIykyAyIAtBAkYbITIgDEMAAKA/YEUEQCAmIAhvQQJ0Ih5BpIAEaigCACIdQf8BcSAkbCAeQaCABGooAgAiHkH/AXEgKWxqQQh2IiAgHUEIdkH/AXEgJGwgHkEIdkH/AXEgKWxqQYB+cSAdQRB2Qf8BcSAkbCAeQRB2Qf8BcSApbGpBCHRBgIB8cXNzIR4CfyAyQwAASEOUIjFDAACAT10gMUMAAAAAYHEEQCAxqQwBC0EACyIdBEBB/wEgHWsiHSAeQRB2Qf8BcWxBCHRBgIB8cSAdIB5BCHZB/wFxbEGAfnEgIEH/AXEgHWxBCHZzcyEeCyAMQyIAgD9fRQRAIB5B/wFxISUCfyAMQwAAf0SUQwAAf8SSIjFDAACAT10gMUMAAAAAYHEEQCAxqQwBC0EACyEdIAy8IiFB////A3FBgICA+ANyviExIAxDAACAv5IgM5QgDZIgIbNDAAAANJRDd3P4wpIgMUN1v7+/lJJDo+ncvyAxQ/lEtD6SlZIgNJSSIAggCiAyEAAiIUEQdkH/AXEgHWxB/wEgHWsiICAeQRB2Qf8BcWxqQQh0QYCAfHEgHSAhQQh2Qf8BcWwgICAeQQh2Qf8BcWxqQYB+cSAhQf8BcSAdbCAgICVsakEIdnNzQYCAgHhzDAILICVBgICA/AM2AgAgHkGAgIB4cwwBCyAMvCIdQf///wNxQYCAgPgDcr4hMSAMQwAAgL+SIDOUIA2SIB2zQwAAADSUQ3dz+MKSIDFDdb+/v5SSQ6Pp3L8gMUP5RLQ+kpWSIDSUkiAIIAogMhAACzYCACAtIAJBAWoiAkoNAAsgBiAuSg0AC0F/IC0gIyArTBshLAsgLAsApgQEbmFtZQEWBAACZjEBAmYyAgZyZW5kZXIDA3J1bgLgAwQAEgACcDABAnAxAgJwMgMCcDMEAmw0BQJsNQYCbDYHAmw3CAJsOAkCbDkKA2wxMAsDbDExDANsMTINA2wxMw4DbDE0DwNsMTUQA2wxNhEDbDE3AQQAAnAwAQJwMQICcDIDAmwzAhoAAnAwAQJwMQICcDIDAnAzBAJwNAUCcDUGAnA2BwJsNwgCbDgJAmw5CgNsMTALA2wxMQwDbDEyDQNsMTMOA2wxNA8DbDE1EANsMTYRA2wxNxIDbDE4EwNsMTkUA2wyMBUDbDIxFgNsMjIXA2wyMxgDbDI0GQNsMjUDNQACcDABAnAxAgJwMgMCcDMEAnA0BQJwNQYCcDYHAnA3CAJwOAkCcDkKA3AxMAsDcDExDANwMTINA3AxMw4DcDE0DwNwMTUQA2wxNhEDbDE3EgNsMTgTA2wxORQDbDIwFQNsMjEWA2wyMhcDbDIzGANsMjQZA2wyNRoDbDI2GwNsMjccA2wyOB0DbDI5HgNsMzAfA2wzMSADbDMyIQNsMzMiA2wzNCMDbDM1JANsMzYlA2wzNyYDbDM4JwNsMzkoA2w0MCkDbDQxKgNsNDIrA2w0MywDbDQ0LQNsNDUuA2w0Ni8DbDQ3MANsNDgxA2w0OTIDbDUwMwNsNTE0A2w1MgQVBQACdDABAnQxAgJ0MgMCdDMEAnQ0Bg0BAAplbnYubWVtb3J5";
+const unsharedWASMData = "data:application/wasm;base64,AGFzbQEAAAAADwhkeWxpbmsuMAEEeAQAAAGnARJgAABgCH9/f39/fX1/AGACf38Bf2ADf319AX9gBX1/f399AX9gA39/fwF/YBN/f398fHx/f39/f399fXx8f39/AX9gAX8BfGADf39/AGAGf398fH9/AGAEf39/fwF/YAR/f39/AGAEfHx8fAF9YAF9AX1gDH9/fHx8fHx8fHx/fAF9YAl/f39/f39/f3wAYAp/f3x8fHx8fHx8AGAIf398fHx8fHwAAk8EA2VudgZtZW1vcnkCAAEDZW52D19fc3RhY2tfcG9pbnRlcgN/AQNlbnYNX19tZW1vcnlfYmFzZQN/AANlbnYMX190YWJsZV9iYXNlA38AAzIxAAECAwQFBgcICAgICQUCAgoICwwNDg4ODw8PDw8PEBAQEBAQEBAQEBEQEBAQEBAQEAcQAgZyZW5kZXIAAQNydW4ABgrRlhgxAgAL6g8GAX8BfQZ/CHsFfwh7I4CAgIAAQdAAayIIJICAgIAAIAggBjgCRCAIIAQ2AjggCCADNgI0IAggAjYCMCAIIAE2AiwgCEGggAQ2AiggCCAFQylcDz2UIgk4AkAgCCAFkZEiBTgCPCAIIAEgAxCCgICAACIKNgJIQYAgIQMCQCABQYEBSA0AAkAgAUGBAk4NAEGAECEDDAELAkAgAUGBBE4NAEGACCEDDAELQQBBgAJBgAQgAUGACEobIAFBgBBKGyEDCyAIIAM2AkxBAEEAKAIAIgtBAWo2AgACQCALIABB/x9qQYAgbSIMTg0AAkAgCkUNACAAQQJ0IgJB4N3KBWoiDSACaiIOIAJqIQ8gA0F/av0RIRBDAACAPyABspX9EyERIAn9EyESIAX9EyETIAP9ESEUIAH9ESEVIAb9EyEWIAOz/RMhFyAAQQJ0IRggAEEDdCIZQeDdygVqIRoDQAJAAkAgC0EMdCIBQQRyIgMgAUGAIGoiAiAAIAIgAEgbIhtMDQAgASEcDAELIBogC0EOdGohCwNAIAMhHCANIAFBAnQiAWr9AAIAIR0gAUHg3coFav0AAgAhHgJAAkAgB0UNACAPIAFq/QACACEfDAELIA8gAWogEiAe/QwAAIC/AACAvwAAgL8AAIC//eQB/eYBIBMgHv36Af0MAAAANAAAADQAAAA0AAAANP3mAf0Md3P4wndz+MJ3c/jCd3P4wv3kASAe/Qz//38A//9/AP//fwD//38A/U79DAAAAD8AAAA/AAAAPwAAAD/9UCIf/Qx1v7+/db+/v3W/v791v7+//eYB/eQB/Qyj6dy/o+ncv6Pp3L+j6dy/IB/9DPlEtD75RLQ++US0PvlEtD795AH95wH95AH95gH95AEiH/0LAgALAkACQAJAIB79HwBDAACgP10NACAWIB/95AEiIP34ASIf/RsAQf///wdKDQAgHv0fAUMAAKA/XQ0AIB/9GwFB////B0oNACAe/R8CQwAAoD9dDQAgH/0bAkH///8HSg0AIB79HwNDAACgP10NACAf/RsDQYCAgAhIDQELQQAhASALIQMDQCAIIB39CwQQIAggHv0LBAAgAyAIQShqIAggAUECdEEMcSICcioCACAIQRBqIAJyKgIAEIOAgIAANgIAIANBBGohAyABQQFqIgFBBEcNAAwCCwsgDiABaiEBIApBACAgICD9aSIh/eUBIBf95gH9+AEiHv0bACIDQQAgA0EAShsgECAe/TkiIP0bAEEBcRsgEP0MAAAAAAAAAAAAAAAAAAAAACIiICD9UiIj/RsAckECdGogHyAVIBEgIf3mAf34Af21Af2xASIfQR/9rAEgFf1OIB/9rgEiHyAiIBUgHyAV/Tn9Uv2xASAU/bUBIiH9GwBBAnRqKAIAIQMCQEEA/QwAAIA/AACAPwAAgD8AAIA/IB395QEgHSAEQQJGG/0MAABIQwAASEMAAEhDAABIQ/3mAf34ASId/RsAIgJBACACQQBKGyAd/Qz/AAAA/wAAAP8AAAD/AAAAIiT9OyIf/RsAQQFxGyAkICIgH/1SIiL9GwByIgJFDQAgAiADQYD+A3FyLQAgQQh0IAIgA0EIdEGA/gNxci0AIHIgAiADQQh2QYD+A3FyLQAgQRB0ckGAgIB4ciEDCyABIAM2AgAgCkEAIB79GwEiA0EAIANBAEobICD9GwFBAXEbICP9GwFyQQJ0aiAh/RsBQQJ0aigCACEDAkBBACAd/RsBIgJBACACQQBKGyAf/RsBQQFxGyAi/RsBciICRQ0AIAIgA0GA/gNxci0AIEEIdCACIANBCHRBgP4DcXItACByIAIgA0EIdkGA/gNxci0AIEEQdHJBgICAeHIhAwsgAUEEaiADNgIAIApBACAe/RsCIgNBACADQQBKGyAg/RsCQQFxGyAj/RsCckECdGogIf0bAkECdGooAgAhAwJAQQAgHf0bAiICQQAgAkEAShsgH/0bAkEBcRsgIv0bAnIiAkUNACACIANBgP4DcXItACBBCHQgAiADQQh0QYD+A3FyLQAgciACIANBCHZBgP4DcXItACBBEHRyQYCAgHhyIQMLIAFBCGogAzYCACAKQQAgHv0bAyIDQQAgA0EAShsgIP0bA0EBcRsgI/0bA3JBAnRqICH9GwNBAnRqKAIAIQMCQEEAIB39GwMiAkEAIAJBAEobIB/9GwNBAXEbICL9GwNyIgJFDQAgAiADQYD+A3FyLQAgQQh0IAIgA0EIdEGA/gNxci0AIHIgAiADQQh2QYD+A3FyLQAgQRB0ckGAgIB4ciEDCyABQQxqIAM2AgALIAtBEGohCyAcIQEgHEEEaiIDIBtMDQALCwJAIBsgHEwNACAbIBxrIQMgHEECdEHg3coFaiEBA0AgASAZaiAIQShqIAEqAgAgASAYaioCABCDgICAADYCACABQQRqIQEgA0F/aiIDDQALC0EAQQAoAgAiC0EBajYCACALIAxIDQAMAgsLIABBAnQhAiAAQQN0IRwDQAJAIAAgC0EMdCIBTA0AIAFBgCBqIgMgACADIABIGyABayEDIAtBDnRB4N3KBWohAQNAIAEgHGogCEEoaiABKgIAIAEgAmoqAgAQg4CAgAA2AgAgAUEEaiEBIANBf2oiAw0ACwtBAEEAKAIAIgtBAWo2AgAgCyAMSA0ACwsgCEHQAGokgICAgAALsgMHAn8BfgJ/AX0CfwF9AX8CQAJAAkAgAEGBAU4NAEGAICECDAELAkAgAEGBAk4NAEGAECECDAELAkAgAEGBBE4NAEGACCECDAELQQAhAyAAQYAQSg0BQYACQYAEIABBgAhKGyECC0HgvcoAIQNBACkDyL1KIAGsQhCGIACshEEANQLAvUpCIIaEIgRRDQACQCAAQQBKDQADQEEAQQAoAtC9SiIFQQEgBRs2AtC9SgJAIAUNAAJAQQApA8i9SiAEUQ0AQQAgBDcDyL1KC0EAQQA2AtC9SgtBACkDyL1KIARSDQAMAgsLIAJBAnQhBkMAAIA/IAKzlSEHA0BBAEEAKALQvUoiBUEBIAUbNgLQvUoCQCAFDQACQEEAKQPIvUogBFENAEEAIQhB4L3KACEJA0AgCLMhCiAJIQVBACELA0AgBSALs0MAAAA/kiAHlCAKkkGggAQgACABQwAAAAAQhICAgAA2AgAgBUEEaiEFIAIgC0EBaiILRw0ACyAJIAZqIQkgCEEBaiIIIABHDQALQQAgBDcDyL1KC0EAQQA2AtC9SgtBACkDyL1KIARSDQALCyADC/IHBAF9AXwIfwF9AkAgAUMAwHnEXA0AIAAoAggPC0MAAIA/IAKTIAIgACgCEEECRhshAgJAAkAgAUMAAKA/YA0AQf8BIAAqAhwiAyADj5O7IgREAAAAAADgb0CiIASfovwDIgVrIgYgACgCACIHIAP8ACAAKAIEIghvQQJ0aiIJKAIAIgpBCHZB/wFxbCAJQQRqKAIAIglBCHZB/wFxIAVsakGAfnEgBiAKQf8BcWwgCUH/AXEgBWxqIgtBCHZzIgwgBiAKQRB2Qf8BcWwgCUEQdkH/AXEgBWxqQQh0QYCAfHFzIQUgAkMAAEhDlPwAIgpBACAKQQBKGyIGQf8BIAZB/wFIGyEGAkACQCAKQQFODQAgBUGAgIB4cyEFDAELIAxBgP4DcSAGci0AIEEIdCALQYD+A3EgBnItACByIAVBCHZBgP4DcSAGci0AIEEQdHJBgICAeHIhBQsgAUMiAIA/Xw0BIAAqAhQgAbwiCbNDAAAANJRDd3P4wpIgCUH///8DcUGAgID4A3K+Ig1Ddb+/v5SSQ6Pp3L8gDUP5RLQ+kpWSlCADkiAAKgIYIAFDAACAv5KUkiEDAkACQCAAKAIgIgkNACADIAcgCCAAKAIMIAIQhICAgAAhAAwBCyAJIAAoAiQiAEF/aiILIAMgA4+TIACylPwAIgxBACAMQQBKGyIMIAsgDEgbQQJ0aiAD/AAgCG8gAGxBAnRqKAIAIQAgCkEBSA0AIABBgP4DcSAGci0AIEEIdCAAQQh0QYD+A3EgBnItACByIABBCHZBgP4DcSAGci0AIEEQdHIhAAsgAEH/AXEgAUMAAH9ElEMAAH/EkvwBIgZsIAVB/wFxQf8BIAZrIgpsakEIdkGAgIB4ciAAQQh2Qf8BcSAGbCAFQQh2Qf8BcSAKbGpBgH5xcyAAQRB2Qf8BcSAGbCAFQRB2Qf8BcSAKbGpBCHRBgIB8cXMPCyAAKgIYIAFDAACAv5KUIAAqAhQgAbwiBbNDAAAANJRDd3P4wpIgBUH///8DcUGAgID4A3K+IgFDdb+/v5SSQ6Pp3L8gAUP5RLQ+kpWSlJIgACoCHJIhAQJAIAAoAiAiBg0AIAEgACgCACAAKAIEIAAoAgwgAhCEgICAAA8LIAYgACgCJCIFQX9qIgogASABj5MgBbKU/AAiCUEAIAlBAEobIgkgCiAJSBtBAnRqIAH8ACAAKAIEbyAFbEECdGooAgAhBSACQwAASEOU/AAiAEEBSA0AIAVBgP4DcSAAQf8BIABB/wFJGyIAci0AIEEIdCAFQQh0QYD+A3EgAHItACByIAVBCHZBgP4DcSAAci0AIEEQdHJBgICAeHIhBQsgBQuhEgUEfwJ9An8BfQJ/IAAgAPwAIgUgAm8iArIgBSACa7KSkyEAIAEgAkECdGoiASgCACECIAFBBGooAgAhAQJAAkACQAJAAkAgA0F/ag4DAAECAwsgAUEIdkH/AXEgAEMAAH9DlCAAkZT8ASIDbCACQQh2Qf8BcUH/ASADayIFbGpBgH5xIAFB/wFxIANsIAJB/wFxIAVsakEIdiIGcyIHQQh2Qf8BcSIIsyIJQ83MTD+UQwAANEKS/AFBCHQgBkH/AXEiBrMiCkPNzEw/lEMAADRCkvwBIgtzIgwgByABQRB2Qf8BcSADbCACQRB2Qf8BcSAFbGpBCHRBgIB8cXMiA0EQdkH/AXEiAbMiDUPNzEw/lEMAADRCkvwBQRB0cyIFQYCAgHhzIQICQCAAQ83MzD1gDQACQCAAQ83MzDxgDQAgC0H/AXEgAEMAAMhClPwBIgJsIAZB/wEgAmsiA2xqQQh2QYCAgHhyIAxBCHZB/wFxIAJsIAggA2xqQYB+cXMgBUEQdkH/AXEgAmwgASADbGpBCHRBgIB8cXMhAgwFCyAAQ5qZmT1fDQQgC0H/AXEgAEMAAMjClEMAACBBkvwBIgJsIAZB/wEgAmsiA2xqQQh2QYCAgHhyIAxBCHZB/wFxIAJsIAggA2xqQYB+cXMgBUEQdkH/AXEgAmwgASADbGpBCHRBgIB8cXMhAgwECyADQYCAgHhzIQMCQCAAQ5qZGT9fDQACQAJAAkAgAEMzMzM/YA0AAkAgAEMAACA/YA0AIABDAADIQpRDAABIwpIhCQwCCwJAIABDzcwsP19FDQAgAiEDDAMLIABDAADIwpRDAQBwQpIhCQwBCyAAQ83MTD9fDQEgAEOkcH0/Xg0BIAlDAABAP5RDAACAQpL8AUEIdCAKQwAAQD+UQwAAgEKS/AFzIA1DAABAP5RDAACAQpL8AUEQdHNBgICAeHMhAgJAIABDMzNTP2ANACAAQwAAyEKUQwAAoMKSIQkMAQsCQCAAQwAAYD9fRQ0AIAIhAwwCCyAAQwAAyMKUQwAAtEKSIQkLQf8BIAn8ASIDayIFIAhsIAJBCHZB/wFxIANsakGAfnEgBSAGbCACQf8BcSADbGpBCHZzIAUgAWwgAkEQdkH/AXEgA2xqQQh0QYCAfHFzQYCAgHhzIQMLAkBDAABIQyAAQwAAekOUQwCAd8OSQwAAIEAgAEMAACBAlJMgAEOkcH0/XhuRIgBDAABIQ5QgAJGUk/wBIgINACADIQIMBQsgA0H/AXFB/wEgAmsiAmxBCHZBgICAeHIgA0EIdkH/AXEgAmxBgH5xcyACIANBEHZB/wFxbEEIdEGAgHxxcyECDAQLAkAgAEPNzEw+Xw0AIABDmpmZPmANAAJAIABDZmZmPmANACADIAIgAEMAAMhClEMAAKDBkvwBEIWAgIAAIQIMBQsgAEPNzIw+Xw0EIAMgAiAAQwAAyMKUQwEA8EGS/AEQhYCAgAAhAgwECwJAIABDzczMPl9FDQAgAyECDAQLAkAgAEMAAAA/YEUNACADIQIMBAsCQCAAQ5qZ2T5gDQAgAyACIABDAADIQpRDAAAgwpL8ARCFgICAACECDAQLIABDMzPzPl8NAyADIAIgAEMAAMjClEMAAEhCkvwBEIWAgIAAIQIMAwsgAUEIdkH/AXEgAEMAAH9DlPwBIgNsIAJBCHZB/wFxQf8BIANrIgVsakGAfnEgAUH/AXEgA2wgAkH/AXEgBWxqQQh2IgZzIgcgAUEQdkH/AXEgA2wgAkEQdkH/AXEgBWxqQQh0QYCAfHFzIgFBgICAeHMhAiAAQwAAoECUIgAgAI+TIgBDzczMPl8NAgJAIABDAAAAP18NAAJAIABDSOF6P18NAEMAAPpFIABDAAD6RZST/AEiA0UNBCAGQf8BcUH/ASADayICbEEIdkGAgIB4ciAHQQh2Qf8BcSACbEGAfnFzIAIgAUEQdkH/AXFsQQh0QYCAfHFzIQIMBAsgAEMAACBDlPwBIgNFDQMgBkH/AXFB/wEgA2siAmxBCHZBgICAeHIgB0EIdkH/AXEgAmxBgH5xcyACIAFBEHZB/wFxbEEIdEGAgHxxcyECDAMLAkAgAENI4fo+YA0AIABDAEAcRZRDAAB6xJL8ASIDRQ0DIAZB/wFxQf8BIANrIgJsQQh2QYCAgHhyIAdBCHZB/wFxIAJsQYB+cXMgAiABQRB2Qf8BcWxBCHRBgIB8cXMhAgwDCyAAQwDQhMaUQwAQBkaS/AEiA0UNAiAGQf8BcUH/ASADayICbEEIdkGAgIB4ciAHQQh2Qf8BcSACbEGAfnFzIAIgAUEQdkH/AXFsQQh0QYCAfHFzIQIMAgsgAUEIdkH/AXEiCCAAQwAAf0OU/AEiA2wgAkEIdkH/AXEiC0H/ASADayIFbGpBgH5xIAFB/wFxIgwgA2wgAkH/AXEiDiAFbGpBCHYiBnMiByABQRB2Qf8BcSIPIANsIAJBEHZB/wFxIgMgBWxqQQh0QYCAfHFzIgFBgICAeHMhAiAAQwAAQECUIgAgAI+TIgBDmpmZPl8NASAAQzMzMz9gDQEgBkH/AXEhAiAAQwBgn0SUIQkgAUEQdkH/AXEhASAHQQh2Qf8BcSEFAkAgAEMAAAA/YA0AIAJB/wEgCUMAQL/DkvwBIgZrIgdsIA4gBmxqQQh2QYCAgHhyIAUgB2wgCyAGbGpBgH5xcyABIAdsIAMgBmxqQQh0QYCAfHFzIQIMAgsgAkH/ASAJQwBgH8SS/AEiA2siBmwgDCADbGpBCHZBgICAeHIgBSAGbCAIIANsakGAfnFzIAEgBmwgDyADbGpBCHRBgIB8cXMhAgwBCyABQf8BcSAAQwAAf0OU/AEiA2wgAkH/AXFB/wEgA2siBWxqQQh2QYCAgHhyIAFBCHZB/wFxIANsIAJBCHZB/wFxIAVsakGAfnFzIAFBEHZB/wFxIANsIAJBEHZB/wFxIAVsakEIdEGAgHxxcyECCwJAIARDAABIQ5T8ACIBQQFIDQAgAkGA/gNxIAFB/wEgAUH/AUkbIgFyLQAgQQh0IAJBCHRBgP4DcSABci0AIHIgAkEIdkGA/gNxIAFyLQAgQRB0ckGAgIB4ciECCyACC2YBAX9B/wEgAmsiAyAAQQh2Qf8BcWwgAUEIdkH/AXEgAmxqQYB+cSADIABB/wFxbCABQf8BcSACbGpBCHZzIAMgAEEQdkH/AXFsIAFBEHZB/wFxIAJsakEIdEGAgHxxc0GAgIB4cwvu2QIPBX8DfAR/AXsGfwN8CXsBfwF+E3wOewV8AX4JfwN+I4CAgIAAQeARayITJICAgIAAIBMgATYCzAIgEyACNgLIAiATQeDdygU2AsQCIBMgAiABbCIUQQJ0IgFB4N3KBWoiAjYCwAIgEyACIAFqNgK8AiATIA04ArACIBMgDEMpXA89lDgCrAIgEyAMkZE4AqgCIBMgCzYCpAIgEyAKNgKgAiATIAk2ApwCIBMgCDYCmAIgE0GggAQ2ApQCIBMgCCAKEIKAgIAANgK0AgJAAkAgCEGBAU4NAEGAICEIDAELAkAgCEGBAk4NAEGAECEIDAELAkAgCEGBBE4NAEGACCEIDAELQQBBgAJBgAQgCEGACEobIAhBgBBKGyEICyATIAg2ArgCIAAgAEEfdSIIcyEBAkACQCAFRAAAAAAAAGA/Zg0AQQFBAiAFRAAAAAAAAPA8ZiICGyEVIABBAEgNASACDQFBAiEVIABBDk8NASOBgICAAEHAgICAAGogAEECdGooAgAhFQwBCyAQQQF2QQFxIRULIAEgCGshFiAUQQR0QefdygVqQXBxIRdEAAAAAAAAAAAhGEQAAAAAAAAAACEZAkACQCAVQQNHDQAgFyAHQQR0akEgaiEIAkBBACgCBEECRg0AQQBBACgCBCIBQQEgARs2AgQCQAJAAkACQAJAAkACQAJAAkACQCABDQBEAAAAAAAA8D8hGkECIQICQCAFRAAAAAAAAPA/Zg0AQQIhAQNAIAFBAWohAiAaRAAAAAAAAPA7oiIaIAVlDQEgAUEdSSEKIAIhASAKDQALC0EAIAI2AgggB0EBaiEJAkACQAJAAkACQAJAAkACQAJAAkAgFkF/ag4KAAECAwQFBggIBwgLAkBBgAJFIgENACATQeANakHAjQpBgAL8CgAACwJAIAENACATQcCPCkGAAvwKAAALIBf9DAAAAAAAAAAAAAAAAAAAAAD9CwQAIBcgE0HgDWoQh4CAgAA5AxAgFyATEIeAgIAAOQMYIAdBAUgNCCATQQhyIRsgE0HgDWpBCHIhHEECIR0DQCATQeANaiATQQAQiICAgABBASECAkBBHkEAKAIIIgEgAUFhakFiSRsiCkECSSIeDQBBASECIBwhAQNAIAEpAwBCAFINASABQQhqIQEgCiACQQFqIgJHDQALIAohAgsgHCACQQN0IgFqKQMAukQAAAAAAADwO6IgE0HgDWogAWopAwC6oCEaAkAgAkECSQ0AQQEhAQJAIAJBAkYNAP0MAAAAAAAAAAAAAAAAAADwPyAa/SIAIR8gAkF/aiIgQX5xIiFBfmoiIkEBdiEjAkAgIkEOSQ0AICNBeWoiJEEDdkEBaiIlQQdxIQECQCAkQThJDQAgJUH4////A3EhJANAICRBeGoiJA0AC/0MAAAAAAAAAAAAAAAAAAAAACEfCwJAIAENAP0MAAAAAAAAAAAAAAAAAAAAACEfDAELA0AgH/0MAAAAAAAA8B8AAAAAAADwH/3yASEfIAFBf2oiAQ0ACwsCQCAiQQ5xQQ5GDQAgI0EBakEHcSEBA0AgH/0MAAAAAAAA8DsAAAAAAADwO/3yASEfIAFBf2oiAQ0ACwsgHyAfIB/9DQgJCgsMDQ4PAAECAwQFBgf98gH9IQAhGiAgICFGDQEgIEEBciEBCyACIAFrIQEDQCAaRAAAAAAAAPA7oiEaIAFBf2oiAQ0ACwsgEykD4A1CAVEhJCAamiEmQQEhAgJAIB4NAEEBIQIgGyEBA0AgASkDAEIAUg0BIAFBCGohASAKIAJBAWoiAkcNAAsgCiECCyAmIBogJBshJiAbIAJBA3QiAWopAwC6RAAAAAAAAPA7oiATIAFqKQMAuqAhGgJAIAJBAkkNAEEBIQECQCACQQJGDQD9DAAAAAAAAAAAAAAAAAAA8D8gGv0iACEfIAJBf2oiHkF+cSIiQX5qIiRBAXYhIAJAICRBDkkNACAgQXlqIgpBA3ZBAWoiIUEHcSEBAkAgCkE4SQ0AICFB+P///wNxIQoDQCAKQXhqIgoNAAv9DAAAAAAAAAAAAAAAAAAAAAAhHwsCQCABDQD9DAAAAAAAAAAAAAAAAAAAAAAhHwwBCwNAIB/9DAAAAAAAAPAfAAAAAAAA8B/98gEhHyABQX9qIgENAAsLAkAgJEEOcUEORg0AICBBAWpBB3EhAQNAIB/9DAAAAAAAAPA7AAAAAAAA8Dv98gEhHyABQX9qIgENAAsLIB8gHyAf/Q0ICQoLDA0ODwABAgMEBQYH/fIB/SEAIRogHiAiRg0BIB5BAXIhAQsgAiABayEBA0AgGkQAAAAAAADwO6IhGiABQX9qIgENAAsLIBcgHUEEdGoiASAmOQMAIAFBCGogGpogGiATKQMAQgFRGyIaOQMAAkAgGiAaoiAmICaioEQAAAAAAAAwQGRFDQAgHSEJDAoLIB0gCUchASAdQQFqIR0gAQ0ADAkLCwJAQYACRSIBDQAgE0HgDWpBwI0KQYAC/AoAAAsCQCABDQAgE0HAjwpBgAL8CgAACyAX/QwAAAAAAAAAAAAAAAAAAAAA/QsEACAXIBNB4A1qEIeAgIAAOQMQIBcgExCHgICAADkDGCAHQQFIDQcgE0EIciEbIBNB4A1qQQhyIRxBAiEdA0AgE0HgDWogE0EDEImAgIAAQQEhAgJAQR5BACgCCCIBIAFBYWpBYkkbIgpBAkkiHg0AQQEhAiAcIQEDQCABKQMAQgBSDQEgAUEIaiEBIAogAkEBaiICRw0ACyAKIQILIBwgAkEDdCIBaikDALpEAAAAAAAA8DuiIBNB4A1qIAFqKQMAuqAhGgJAIAJBAkkNAEEBIQECQCACQQJGDQD9DAAAAAAAAAAAAAAAAAAA8D8gGv0iACEfIAJBf2oiIEF+cSIhQX5qIiJBAXYhIwJAICJBDkkNACAjQXlqIiRBA3ZBAWoiJUEHcSEBAkAgJEE4SQ0AICVB+P///wNxISQDQCAkQXhqIiQNAAv9DAAAAAAAAAAAAAAAAAAAAAAhHwsCQCABDQD9DAAAAAAAAAAAAAAAAAAAAAAhHwwBCwNAIB/9DAAAAAAAAPAfAAAAAAAA8B/98gEhHyABQX9qIgENAAsLAkAgIkEOcUEORg0AICNBAWpBB3EhAQNAIB/9DAAAAAAAAPA7AAAAAAAA8Dv98gEhHyABQX9qIgENAAsLIB8gHyAf/Q0ICQoLDA0ODwABAgMEBQYH/fIB/SEAIRogICAhRg0BICBBAXIhAQsgAiABayEBA0AgGkQAAAAAAADwO6IhGiABQX9qIgENAAsLIBMpA+ANQgFRISQgGpohJkEBIQICQCAeDQBBASECIBshAQNAIAEpAwBCAFINASABQQhqIQEgCiACQQFqIgJHDQALIAohAgsgJiAaICQbISYgGyACQQN0IgFqKQMAukQAAAAAAADwO6IgEyABaikDALqgIRoCQCACQQJJDQBBASEBAkAgAkECRg0A/QwAAAAAAAAAAAAAAAAAAPA/IBr9IgAhHyACQX9qIh5BfnEiIkF+aiIkQQF2ISACQCAkQQ5JDQAgIEF5aiIKQQN2QQFqIiFBB3EhAQJAIApBOEkNACAhQfj///8DcSEKA0AgCkF4aiIKDQAL/QwAAAAAAAAAAAAAAAAAAAAAIR8LAkAgAQ0A/QwAAAAAAAAAAAAAAAAAAAAAIR8MAQsDQCAf/QwAAAAAAADwHwAAAAAAAPAf/fIBIR8gAUF/aiIBDQALCwJAICRBDnFBDkYNACAgQQFqQQdxIQEDQCAf/QwAAAAAAADwOwAAAAAAAPA7/fIBIR8gAUF/aiIBDQALCyAfIB8gH/0NCAkKCwwNDg8AAQIDBAUGB/3yAf0hACEaIB4gIkYNASAeQQFyIQELIAIgAWshAQNAIBpEAAAAAAAA8DuiIRogAUF/aiIBDQALCyAXIB1BBHRqIgEgJjkDACABQQhqIBqaIBogEykDAEIBURsiGjkDAAJAIBogGqIgJiAmoqBEAAAAAAAAMEBkRQ0AIB0hCQwJCyAdIAlHIQEgHUEBaiEdIAENAAwICwsCQEGAAkUiAQ0AIBNB4A1qQcCNCkGAAvwKAAALAkAgAQ0AIBNBwI8KQYAC/AoAAAsgF/0MAAAAAAAAAAAAAAAAAAAAAP0LBAAgFyATQeANahCHgICAADkDECAXIBMQh4CAgAA5AxggB0EBSA0GIBNBCHIhGyATQeANakEIciEcQQIhHQNAIBNB4A1qIBNBBBCJgICAAEEBIQICQEEeQQAoAggiASABQWFqQWJJGyIKQQJJIh4NAEEBIQIgHCEBA0AgASkDAEIAUg0BIAFBCGohASAKIAJBAWoiAkcNAAsgCiECCyAcIAJBA3QiAWopAwC6RAAAAAAAAPA7oiATQeANaiABaikDALqgIRoCQCACQQJJDQBBASEBAkAgAkECRg0A/QwAAAAAAAAAAAAAAAAAAPA/IBr9IgAhHyACQX9qIiBBfnEiIUF+aiIiQQF2ISMCQCAiQQ5JDQAgI0F5aiIkQQN2QQFqIiVBB3EhAQJAICRBOEkNACAlQfj///8DcSEkA0AgJEF4aiIkDQAL/QwAAAAAAAAAAAAAAAAAAAAAIR8LAkAgAQ0A/QwAAAAAAAAAAAAAAAAAAAAAIR8MAQsDQCAf/QwAAAAAAADwHwAAAAAAAPAf/fIBIR8gAUF/aiIBDQALCwJAICJBDnFBDkYNACAjQQFqQQdxIQEDQCAf/QwAAAAAAADwOwAAAAAAAPA7/fIBIR8gAUF/aiIBDQALCyAfIB8gH/0NCAkKCwwNDg8AAQIDBAUGB/3yAf0hACEaICAgIUYNASAgQQFyIQELIAIgAWshAQNAIBpEAAAAAAAA8DuiIRogAUF/aiIBDQALCyATKQPgDUIBUSEkIBqaISZBASECAkAgHg0AQQEhAiAbIQEDQCABKQMAQgBSDQEgAUEIaiEBIAogAkEBaiICRw0ACyAKIQILICYgGiAkGyEmIBsgAkEDdCIBaikDALpEAAAAAAAA8DuiIBMgAWopAwC6oCEaAkAgAkECSQ0AQQEhAQJAIAJBAkYNAP0MAAAAAAAAAAAAAAAAAADwPyAa/SIAIR8gAkF/aiIeQX5xIiJBfmoiJEEBdiEgAkAgJEEOSQ0AICBBeWoiCkEDdkEBaiIhQQdxIQECQCAKQThJDQAgIUH4////A3EhCgNAIApBeGoiCg0AC/0MAAAAAAAAAAAAAAAAAAAAACEfCwJAIAENAP0MAAAAAAAAAAAAAAAAAAAAACEfDAELA0AgH/0MAAAAAAAA8B8AAAAAAADwH/3yASEfIAFBf2oiAQ0ACwsCQCAkQQ5xQQ5GDQAgIEEBakEHcSEBA0AgH/0MAAAAAAAA8DsAAAAAAADwO/3yASEfIAFBf2oiAQ0ACwsgHyAfIB/9DQgJCgsMDQ4PAAECAwQFBgf98gH9IQAhGiAeICJGDQEgHkEBciEBCyACIAFrIQEDQCAaRAAAAAAAAPA7oiEaIAFBf2oiAQ0ACwsgFyAdQQR0aiIBICY5AwAgAUEIaiAamiAaIBMpAwBCAVEbIho5AwACQCAaIBqiICYgJqKgRAAAAAAAADBAZEUNACAdIQkMCAsgHSAJRyEBIB1BAWohHSABDQAMBwsLAkBBgAJFIgENACATQeANakHAjQpBgAL8CgAACwJAIAENACATQcCPCkGAAvwKAAALIBf9DAAAAAAAAAAAAAAAAAAAAAD9CwQAIBcgE0HgDWoQh4CAgAA5AxAgFyATEIeAgIAAOQMYIAdBAUgNBSATQQhyIRsgE0HgDWpBCHIhHEECIR0DQCATQeANaiATQQUQiYCAgABBASECAkBBHkEAKAIIIgEgAUFhakFiSRsiCkECSSIeDQBBASECIBwhAQNAIAEpAwBCAFINASABQQhqIQEgCiACQQFqIgJHDQALIAohAgsgHCACQQN0IgFqKQMAukQAAAAAAADwO6IgE0HgDWogAWopAwC6oCEaAkAgAkECSQ0AQQEhAQJAIAJBAkYNAP0MAAAAAAAAAAAAAAAAAADwPyAa/SIAIR8gAkF/aiIgQX5xIiFBfmoiIkEBdiEjAkAgIkEOSQ0AICNBeWoiJEEDdkEBaiIlQQdxIQECQCAkQThJDQAgJUH4////A3EhJANAICRBeGoiJA0AC/0MAAAAAAAAAAAAAAAAAAAAACEfCwJAIAENAP0MAAAAAAAAAAAAAAAAAAAAACEfDAELA0AgH/0MAAAAAAAA8B8AAAAAAADwH/3yASEfIAFBf2oiAQ0ACwsCQCAiQQ5xQQ5GDQAgI0EBakEHcSEBA0AgH/0MAAAAAAAA8DsAAAAAAADwO/3yASEfIAFBf2oiAQ0ACwsgHyAfIB/9DQgJCgsMDQ4PAAECAwQFBgf98gH9IQAhGiAgICFGDQEgIEEBciEBCyACIAFrIQEDQCAaRAAAAAAAAPA7oiEaIAFBf2oiAQ0ACwsgEykD4A1CAVEhJCAamiEmQQEhAgJAIB4NAEEBIQIgGyEBA0AgASkDAEIAUg0BIAFBCGohASAKIAJBAWoiAkcNAAsgCiECCyAmIBogJBshJiAbIAJBA3QiAWopAwC6RAAAAAAAAPA7oiATIAFqKQMAuqAhGgJAIAJBAkkNAEEBIQECQCACQQJGDQD9DAAAAAAAAAAAAAAAAAAA8D8gGv0iACEfIAJBf2oiHkF+cSIiQX5qIiRBAXYhIAJAICRBDkkNACAgQXlqIgpBA3ZBAWoiIUEHcSEBAkAgCkE4SQ0AICFB+P///wNxIQoDQCAKQXhqIgoNAAv9DAAAAAAAAAAAAAAAAAAAAAAhHwsCQCABDQD9DAAAAAAAAAAAAAAAAAAAAAAhHwwBCwNAIB/9DAAAAAAAAPAfAAAAAAAA8B/98gEhHyABQX9qIgENAAsLAkAgJEEOcUEORg0AICBBAWpBB3EhAQNAIB/9DAAAAAAAAPA7AAAAAAAA8Dv98gEhHyABQX9qIgENAAsLIB8gHyAf/Q0ICQoLDA0ODwABAgMEBQYH/fIB/SEAIRogHiAiRg0BIB5BAXIhAQsgAiABayEBA0AgGkQAAAAAAADwO6IhGiABQX9qIgENAAsLIBcgHUEEdGoiASAmOQMAIAFBCGogGpogGiATKQMAQgFRGyIaOQMAAkAgGiAaoiAmICaioEQAAAAAAAAwQGRFDQAgHSEJDAcLIB0gCUchASAdQQFqIR0gAQ0ADAYLCwJAQYACRSIBDQAgE0HgDWpBwI0KQYAC/AoAAAsCQCABDQAgE0HAjwpBgAL8CgAACyAX/QwAAAAAAAAAAAAAAAAAAAAA/QsEACAXIBNB4A1qEIeAgIAAOQMQIBcgExCHgICAADkDGCAHQQFIDQQgE0EIciEbIBNB4A1qQQhyIRxBAiEdA0AgE0HgDWogE0EGEImAgIAAQQEhAgJAQR5BACgCCCIBIAFBYWpBYkkbIgpBAkkiHg0AQQEhAiAcIQEDQCABKQMAQgBSDQEgAUEIaiEBIAogAkEBaiICRw0ACyAKIQILIBwgAkEDdCIBaikDALpEAAAAAAAA8DuiIBNB4A1qIAFqKQMAuqAhGgJAIAJBAkkNAEEBIQECQCACQQJGDQD9DAAAAAAAAAAAAAAAAAAA8D8gGv0iACEfIAJBf2oiIEF+cSIhQX5qIiJBAXYhIwJAICJBDkkNACAjQXlqIiRBA3ZBAWoiJUEHcSEBAkAgJEE4SQ0AICVB+P///wNxISQDQCAkQXhqIiQNAAv9DAAAAAAAAAAAAAAAAAAAAAAhHwsCQCABDQD9DAAAAAAAAAAAAAAAAAAAAAAhHwwBCwNAIB/9DAAAAAAAAPAfAAAAAAAA8B/98gEhHyABQX9qIgENAAsLAkAgIkEOcUEORg0AICNBAWpBB3EhAQNAIB/9DAAAAAAAAPA7AAAAAAAA8Dv98gEhHyABQX9qIgENAAsLIB8gHyAf/Q0ICQoLDA0ODwABAgMEBQYH/fIB/SEAIRogICAhRg0BICBBAXIhAQsgAiABayEBA0AgGkQAAAAAAADwO6IhGiABQX9qIgENAAsLIBMpA+ANQgFRISQgGpohJkEBIQICQCAeDQBBASECIBshAQNAIAEpAwBCAFINASABQQhqIQEgCiACQQFqIgJHDQALIAohAgsgJiAaICQbISYgGyACQQN0IgFqKQMAukQAAAAAAADwO6IgEyABaikDALqgIRoCQCACQQJJDQBBASEBAkAgAkECRg0A/QwAAAAAAAAAAAAAAAAAAPA/IBr9IgAhHyACQX9qIh5BfnEiIkF+aiIkQQF2ISACQCAkQQ5JDQAgIEF5aiIKQQN2QQFqIiFBB3EhAQJAIApBOEkNACAhQfj///8DcSEKA0AgCkF4aiIKDQAL/QwAAAAAAAAAAAAAAAAAAAAAIR8LAkAgAQ0A/QwAAAAAAAAAAAAAAAAAAAAAIR8MAQsDQCAf/QwAAAAAAADwHwAAAAAAAPAf/fIBIR8gAUF/aiIBDQALCwJAICRBDnFBDkYNACAgQQFqQQdxIQEDQCAf/QwAAAAAAADwOwAAAAAAAPA7/fIBIR8gAUF/aiIBDQALCyAfIB8gH/0NCAkKCwwNDg8AAQIDBAUGB/3yAf0hACEaIB4gIkYNASAeQQFyIQELIAIgAWshAQNAIBpEAAAAAAAA8DuiIRogAUF/aiIBDQALCyAXIB1BBHRqIgEgJjkDACABQQhqIBqaIBogEykDAEIBURsiGjkDAAJAIBogGqIgJiAmoqBEAAAAAAAAMEBkRQ0AIB0hCQwGCyAdIAlHIQEgHUEBaiEdIAENAAwFCwsCQEGAAkUiAQ0AIBNB4A1qQcCNCkGAAvwKAAALAkAgAQ0AIBNBwI8KQYAC/AoAAAsgF/0MAAAAAAAAAAAAAAAAAAAAAP0LBAAgFyATQeANahCHgICAADkDECAXIBMQh4CAgAA5AxggB0EBSA0DIBNBCHIhGyATQeANakEIciEcQQIhHQNAIBNB4A1qIBNBBxCJgICAAEEBIQICQEEeQQAoAggiASABQWFqQWJJGyIKQQJJIh4NAEEBIQIgHCEBA0AgASkDAEIAUg0BIAFBCGohASAKIAJBAWoiAkcNAAsgCiECCyAcIAJBA3QiAWopAwC6RAAAAAAAAPA7oiATQeANaiABaikDALqgIRoCQCACQQJJDQBBASEBAkAgAkECRg0A/QwAAAAAAAAAAAAAAAAAAPA/IBr9IgAhHyACQX9qIiBBfnEiIUF+aiIiQQF2ISMCQCAiQQ5JDQAgI0F5aiIkQQN2QQFqIiVBB3EhAQJAICRBOEkNACAlQfj///8DcSEkA0AgJEF4aiIkDQAL/QwAAAAAAAAAAAAAAAAAAAAAIR8LAkAgAQ0A/QwAAAAAAAAAAAAAAAAAAAAAIR8MAQsDQCAf/QwAAAAAAADwHwAAAAAAAPAf/fIBIR8gAUF/aiIBDQALCwJAICJBDnFBDkYNACAjQQFqQQdxIQEDQCAf/QwAAAAAAADwOwAAAAAAAPA7/fIBIR8gAUF/aiIBDQALCyAfIB8gH/0NCAkKCwwNDg8AAQIDBAUGB/3yAf0hACEaICAgIUYNASAgQQFyIQELIAIgAWshAQNAIBpEAAAAAAAA8DuiIRogAUF/aiIBDQALCyATKQPgDUIBUSEkIBqaISZBASECAkAgHg0AQQEhAiAbIQEDQCABKQMAQgBSDQEgAUEIaiEBIAogAkEBaiICRw0ACyAKIQILICYgGiAkGyEmIBsgAkEDdCIBaikDALpEAAAAAAAA8DuiIBMgAWopAwC6oCEaAkAgAkECSQ0AQQEhAQJAIAJBAkYNAP0MAAAAAAAAAAAAAAAAAADwPyAa/SIAIR8gAkF/aiIeQX5xIiJBfmoiJEEBdiEgAkAgJEEOSQ0AICBBeWoiCkEDdkEBaiIhQQdxIQECQCAKQThJDQAgIUH4////A3EhCgNAIApBeGoiCg0AC/0MAAAAAAAAAAAAAAAAAAAAACEfCwJAIAENAP0MAAAAAAAAAAAAAAAAAAAAACEfDAELA0AgH/0MAAAAAAAA8B8AAAAAAADwH/3yASEfIAFBf2oiAQ0ACwsCQCAkQQ5xQQ5GDQAgIEEBakEHcSEBA0AgH/0MAAAAAAAA8DsAAAAAAADwO/3yASEfIAFBf2oiAQ0ACwsgHyAfIB/9DQgJCgsMDQ4PAAECAwQFBgf98gH9IQAhGiAeICJGDQEgHkEBciEBCyACIAFrIQEDQCAaRAAAAAAAAPA7oiEaIAFBf2oiAQ0ACwsgFyAdQQR0aiIBICY5AwAgAUEIaiAamiAaIBMpAwBCAVEbIho5AwACQCAaIBqiICYgJqKgRAAAAAAAADBAZEUNACAdIQkMBQsgHSAJRyEBIB1BAWohHSABDQAMBAsLAkBBgAJFIgENACATQeANakHAjQpBgAL8CgAACwJAIAENACATQcCPCkGAAvwKAAALIBf9DAAAAAAAAAAAAAAAAAAAAAD9CwQAIBcgE0HgDWoQh4CAgAA5AxAgFyATEIeAgIAAOQMYIAdBAUgNAiATQQhyIRsgE0HgDWpBCHIhHEECIR0DQEEBIQIgE0HgDWogE0EBEIiAgIAAAkBBHkEAKAIIIgEgAUFhakFiSRsiCkECSSIeDQBBASECIBwhAQNAIAEpAwBCAFINASABQQhqIQEgCiACQQFqIgJHDQALIAohAgsgHCACQQN0IgFqKQMAukQAAAAAAADwO6IgE0HgDWogAWopAwC6oCEaAkAgAkECSQ0AQQEhAQJAIAJBAkYNAP0MAAAAAAAAAAAAAAAAAADwPyAa/SIAIR8gAkF/aiIgQX5xIiFBfmoiIkEBdiEjAkAgIkEOSQ0AICNBeWoiJEEDdkEBaiIlQQdxIQECQCAkQThJDQAgJUH4////A3EhJANAICRBeGoiJA0AC/0MAAAAAAAAAAAAAAAAAAAAACEfCwJAIAENAP0MAAAAAAAAAAAAAAAAAAAAACEfDAELA0AgH/0MAAAAAAAA8B8AAAAAAADwH/3yASEfIAFBf2oiAQ0ACwsCQCAiQQ5xQQ5GDQAgI0EBakEHcSEBA0AgH/0MAAAAAAAA8DsAAAAAAADwO/3yASEfIAFBf2oiAQ0ACwsgHyAfIB/9DQgJCgsMDQ4PAAECAwQFBgf98gH9IQAhGiAgICFGDQEgIEEBciEBCyACIAFrIQEDQCAaRAAAAAAAAPA7oiEaIAFBf2oiAQ0ACwsgEykD4A1CAVEhJCAamiEmQQEhAgJAIB4NAEEBIQIgGyEBA0AgASkDAEIAUg0BIAFBCGohASAKIAJBAWoiAkcNAAsgCiECCyAmIBogJBshJiAbIAJBA3QiAWopAwC6RAAAAAAAAPA7oiATIAFqKQMAuqAhGgJAIAJBAkkNAEEBIQECQCACQQJGDQD9DAAAAAAAAAAAAAAAAAAA8D8gGv0iACEfIAJBf2oiHkF+cSIiQX5qIiRBAXYhIAJAICRBDkkNACAgQXlqIgpBA3ZBAWoiIUEHcSEBAkAgCkE4SQ0AICFB+P///wNxIQoDQCAKQXhqIgoNAAv9DAAAAAAAAAAAAAAAAAAAAAAhHwsCQCABDQD9DAAAAAAAAAAAAAAAAAAAAAAhHwwBCwNAIB/9DAAAAAAAAPAfAAAAAAAA8B/98gEhHyABQX9qIgENAAsLAkAgJEEOcUEORg0AICBBAWpBB3EhAQNAIB/9DAAAAAAAAPA7AAAAAAAA8Dv98gEhHyABQX9qIgENAAsLIB8gHyAf/Q0ICQoLDA0ODwABAgMEBQYH/fIB/SEAIRogHiAiRg0BIB5BAXIhAQsgAiABayEBA0AgGkQAAAAAAADwO6IhGiABQX9qIgENAAsLIBcgHUEEdGoiASAmOQMAIAFBCGogGpogGiATKQMAQgFRGyIaOQMAAkAgGiAaoiAmICaioEQAAAAAAAAwQGRFDQAgHSEJDAQLIB0gCUchASAdQQFqIR0gAQ0ADAMLCwJAQYACRSIBDQAgE0HgDWpBwI0KQYAC/AoAAAsCQCABDQAgE0HAjwpBgAL8CgAACyAX/QwAAAAAAAAAAAAAAAAAAAAA/QsEACAXIBNB4A1qEIeAgIAAOQMQIBcgExCHgICAADkDGCAHQQFIDQEgE0EIciEbIBNB4A1qQQhyIRxBAiEdA0AgE0HgDWogE0ECEIiAgIAAQQEhAgJAQR5BACgCCCIBIAFBYWpBYkkbIgpBAkkiHg0AQQEhAiAcIQEDQCABKQMAQgBSDQEgAUEIaiEBIAogAkEBaiICRw0ACyAKIQILIBwgAkEDdCIBaikDALpEAAAAAAAA8DuiIBNB4A1qIAFqKQMAuqAhGgJAIAJBAkkNAEEBIQECQCACQQJGDQD9DAAAAAAAAAAAAAAAAAAA8D8gGv0iACEfIAJBf2oiIEF+cSIhQX5qIiJBAXYhIwJAICJBDkkNACAjQXlqIiRBA3ZBAWoiJUEHcSEBAkAgJEE4SQ0AICVB+P///wNxISQDQCAkQXhqIiQNAAv9DAAAAAAAAAAAAAAAAAAAAAAhHwsCQCABDQD9DAAAAAAAAAAAAAAAAAAAAAAhHwwBCwNAIB/9DAAAAAAAAPAfAAAAAAAA8B/98gEhHyABQX9qIgENAAsLAkAgIkEOcUEORg0AICNBAWpBB3EhAQNAIB/9DAAAAAAAAPA7AAAAAAAA8Dv98gEhHyABQX9qIgENAAsLIB8gHyAf/Q0ICQoLDA0ODwABAgMEBQYH/fIB/SEAIRogICAhRg0BICBBAXIhAQsgAiABayEBA0AgGkQAAAAAAADwO6IhGiABQX9qIgENAAsLIBMpA+ANQgFRISQgGpohJkEBIQICQCAeDQBBASECIBshAQNAIAEpAwBCAFINASABQQhqIQEgCiACQQFqIgJHDQALIAohAgsgJiAaICQbISYgGyACQQN0IgFqKQMAukQAAAAAAADwO6IgEyABaikDALqgIRoCQCACQQJJDQBBASEBAkAgAkECRg0A/QwAAAAAAAAAAAAAAAAAAPA/IBr9IgAhHyACQX9qIh5BfnEiIkF+aiIkQQF2ISACQCAkQQ5JDQAgIEF5aiIKQQN2QQFqIiFBB3EhAQJAIApBOEkNACAhQfj///8DcSEKA0AgCkF4aiIKDQAL/QwAAAAAAAAAAAAAAAAAAAAAIR8LAkAgAQ0A/QwAAAAAAAAAAAAAAAAAAAAAIR8MAQsDQCAf/QwAAAAAAADwHwAAAAAAAPAf/fIBIR8gAUF/aiIBDQALCwJAICRBDnFBDkYNACAgQQFqQQdxIQEDQCAf/QwAAAAAAADwOwAAAAAAAPA7/fIBIR8gAUF/aiIBDQALCyAfIB8gH/0NCAkKCwwNDg8AAQIDBAUGB/3yAf0hACEaIB4gIkYNASAeQQFyIQELIAIgAWshAQNAIBpEAAAAAAAA8DuiIRogAUF/aiIBDQALCyAXIB1BBHRqIgEgJjkDACABQQhqIBqaIBogEykDAEIBURsiGjkDAAJAIBogGqIgJiAmoqBEAAAAAAAAMEBkRQ0AIB0hCQwDCyAdIAlHIQEgHUEBaiEdIAENAAwCCwsCQEGAAkUiAQ0AIBNB4A1qQcCNCkGAAvwKAAALAkAgAQ0AIBNBwI8KQYAC/AoAAAsgF/0MAAAAAAAAAAAAAAAAAAAAAP0LBAAgFyATQeANahCHgICAADkDECAXIBMQh4CAgAA5AxggB0EBSA0AIBNBCHIhGyATQeANakEIciEcQQIhHQNAIBNB4A1qIBNBAxCIgICAAEEBIQICQEEeQQAoAggiASABQWFqQWJJGyIKQQJJIh4NAEEBIQIgHCEBA0AgASkDAEIAUg0BIAFBCGohASAKIAJBAWoiAkcNAAsgCiECCyAcIAJBA3QiAWopAwC6RAAAAAAAAPA7oiATQeANaiABaikDALqgIRoCQCACQQJJDQBBASEBAkAgAkECRg0A/QwAAAAAAAAAAAAAAAAAAPA/IBr9IgAhHyACQX9qIiBBfnEiIUF+aiIiQQF2ISMCQCAiQQ5JDQAgI0F5aiIkQQN2QQFqIiVBB3EhAQJAICRBOEkNACAlQfj///8DcSEkA0AgJEF4aiIkDQAL/QwAAAAAAAAAAAAAAAAAAAAAIR8LAkAgAQ0A/QwAAAAAAAAAAAAAAAAAAAAAIR8MAQsDQCAf/QwAAAAAAADwHwAAAAAAAPAf/fIBIR8gAUF/aiIBDQALCwJAICJBDnFBDkYNACAjQQFqQQdxIQEDQCAf/QwAAAAAAADwOwAAAAAAAPA7/fIBIR8gAUF/aiIBDQALCyAfIB8gH/0NCAkKCwwNDg8AAQIDBAUGB/3yAf0hACEaICAgIUYNASAgQQFyIQELIAIgAWshAQNAIBpEAAAAAAAA8DuiIRogAUF/aiIBDQALCyATKQPgDUIBUSEkIBqaISZBASECAkAgHg0AQQEhAiAbIQEDQCABKQMAQgBSDQEgAUEIaiEBIAogAkEBaiICRw0ACyAKIQILICYgGiAkGyEmIBsgAkEDdCIBaikDALpEAAAAAAAA8DuiIBMgAWopAwC6oCEaAkAgAkECSQ0AQQEhAQJAIAJBAkYNAP0MAAAAAAAAAAAAAAAAAADwPyAa/SIAIR8gAkF/aiIeQX5xIiJBfmoiJEEBdiEgAkAgJEEOSQ0AICBBeWoiCkEDdkEBaiIhQQdxIQECQCAKQThJDQAgIUH4////A3EhCgNAIApBeGoiCg0AC/0MAAAAAAAAAAAAAAAAAAAAACEfCwJAIAENAP0MAAAAAAAAAAAAAAAAAAAAACEfDAELA0AgH/0MAAAAAAAA8B8AAAAAAADwH/3yASEfIAFBf2oiAQ0ACwsCQCAkQQ5xQQ5GDQAgIEEBakEHcSEBA0AgH/0MAAAAAAAA8DsAAAAAAADwO/3yASEfIAFBf2oiAQ0ACwsgHyAfIB/9DQgJCgsMDQ4PAAECAwQFBgf98gH9IQAhGiAeICJGDQEgHkEBciEBCyACIAFrIQEDQCAaRAAAAAAAAPA7oiEaIAFBf2oiAQ0ACwsgFyAdQQR0aiIBICY5AwAgAUEIaiAamiAaIBMpAwBCAVEbIho5AwACQCAaIBqiICYgJqKgRAAAAAAAADBAZEUNACAdIQkMAgsgHSAJRyEBIB1BAWohHSABDQALC0EAIAk2AgwgFkEGSw0JIBMoAsgCtyIaIBqiIBMoAswCtyIaIBqioJ8gBaIhGgJAAkACQAJAAkACQCAWQX9qDgUAAQIDBAULQQAhIiATQQA2AuAPIAlBAkgNDiAJQX9qIgohAUEAIQICQANAICJBH0oNASATQeANaiAiQQJ0aiACNgIAIBNB4A1qIBMoAuAPQQJ0akGAAWogATYCACATIBMoAuAPQQFqIiI2AuAPIAIgAWohAiABQQFLIQkgAUEBdiEBIAkNAAsLIBdBEGohAiAIIQEDQCAC/QAEACEfIAFBEGr9DAAAAAAAAPA/AAAAAAAAAAD9CwMAIAEgHyAf/fAB/QsDACABQSBqIB8gH/3yASIf/SEBIB/9IQCgn0QAAAAAAACwPKI5AwAgAUEoaiEBIAJBEGohAiAKQX9qIgoNAAsgIkECSA0OIBMoAuANIQJBASEgA0AgE0HgDWogIEECdGoiASgCACEhAkAgASgCgAEiJEEBSA0AIAJBKGwhCiAhQShsIQkDQCAIIAlqIgIgCCAKaiIBKwMAIAFBKGoiHSsDAKIgAUEIaiIeKwMAIicgAUEwaiIbKwMAIiiioTkDACACQQhqICggASsDACImoiAnIB0rAwAiKKKgOQMAIAJBEGogAUE4aisDACAoIAFBEGoiHSsDAKKgIAFBGGoiHCsDACIYIBsrAwAiGaKhOQMAIAJBGGogGSAdKwMAIieiIBggKKKgIAFBwABqKwMAoDkDACACQSBqIAFByABqKwMAIBwrAwAiKCAooiAnICeioJ8gGqKhIB4rAwAiKCAooiAmICaioJ+jIiZEAAAAAAAAAAAgJkQAAAAAAAAAAGQbIiYgAUEgaisDACIoICYgKGMbOQMAIApB0ABqIQogCUEoaiEJICRBf2oiJA0ACwsgISECICBBAWoiICAiRw0ADA8LC0EAISIgE0EANgLgDyAJQQJIDQ0gCUF/aiIKIQFBACECAkADQCAiQR9KDQEgE0HgDWogIkECdGogAjYCACATQeANaiATKALgD0ECdGpBgAFqIAE2AgAgEyATKALgD0EBaiIiNgLgDyACIAFqIQIgAUEBSyEJIAFBAXYhASAJDQALCyAXQRhqIQIgCCEBA0AgAkF4aisDACEmIAIrAwAhKCABQRBq/QwAAAAAAADwPwAAAAAAAAAA/QsDACABQQhqICggJkQAAAAAAAAYQKKiOQMAIAEgJiAmoiImICggKKIiKKFEAAAAAAAACECiOQMAIAFBIGogKCAmoJ9EAAAAAAAAoDyiOQMAIAJBEGohAiABQShqIQEgCkF/aiIKDQALICJBAkgNDSATKALgDSECQQEhIANAIBNB4A1qICBBAnRqIgEoAgAhIQJAIAEoAoABIiRBAUgNACACQShsIQogIUEobCEJA0AgCCAJaiICIAggCmoiASsDACABQShqIh0rAwCiIAFBCGoiHisDACInIAFBMGoiGysDACIooqE5AwAgAkEIaiAoIAErAwAiJqIgJyAdKwMAIiiioDkDACACQRBqIAFBOGorAwAgKCABQRBqIh0rAwCioCABQRhqIhwrAwAiGCAbKwMAIhmioTkDACACQRhqIBkgHSsDACInoiAYICiioCABQcAAaisDAKA5AwAgAkEgaiABQcgAaisDACAcKwMAIiggKKIgJyAnoqCfIBqioSAeKwMAIiggKKIgJiAmoqCfoyImRAAAAAAAAAAAICZEAAAAAAAAAABkGyImIAFBIGorAwAiKCAmIChjGzkDACAKQdAAaiEKIAlBKGohCSAkQX9qIiQNAAsLICEhAiAgQQFqIiAgIkYNDgwACwtBACEiIBNBADYC4A8gCUECSA0MIAlBf2oiJCEBQQAhAgJAA0AgIkEfSg0BIBNB4A1qICJBAnRqIAI2AgAgE0HgDWogEygC4A9BAnRqQYABaiABNgIAIBMgEygC4A9BAWoiIjYC4A8gAiABaiECIAFBAUshCiABQQF2IQEgCg0ACwtBASEBIAlBAkYNCgJAIBcgCUEEdGogCE0NACAXQRBqIAggJEEobGpJDQsL/QwBAAAAAgAAAAAAAAAAAAAAISkgJEF+cSIKIQIDQCAIICn9DP/////////////////////9rgEiKv0bAEEobGoiAf0MAAAAAAAA8D8AAAAAAAAAACIr/QsDECABIBcgKUEB/asBIiz9DAEAAAABAAAAAQAAAAEAAAD9UCIf/RsBQQN0aiAXIB/9GwBBA3Rq/V0DAP1XAwABIh8gH/3yASItIBcgLP0bAUEDdGogFyAs/RsAQQN0av1dAwD9VwMAASIsICz98gEiLv3wAf3vAf0MVVVVVVVVlTxVVVVVVVWVPP3yASIv/SEAOQMgIAEgLCAuIC398QEiLf3yASAfICwgHyAf/fAB/fIBIi798gH98QH9DAAAAAAAABBAAAAAAAAAEEAiMP3yASIxIC0gH/3yASAuICz98gH98AEgMP3yASIf/Q0AAQIDBAUGBxAREhMUFRYX/QsDACAIICr9GwFBKGxqIgEgK/0LAxAgASAv/SEBOQMgIAEgMSAf/Q0ICQoLDA0ODxgZGhscHR4f/QsDACAp/QwCAAAAAgAAAAIAAAACAAAA/a4BISkgAkF+aiICDQALICQgCkYNCyAkQQFyIQEMCgtBACEiIBNBADYC4A8gCUECSA0LIAlBf2oiJCEBQQAhAgJAA0AgIkEfSg0BIBNB4A1qICJBAnRqIAI2AgAgE0HgDWogEygC4A9BAnRqQYABaiABNgIAIBMgEygC4A9BAWoiIjYC4A8gAiABaiECIAFBAUshCiABQQF2IQEgCg0ACwtBASEBIAlBAkYNBwJAIBcgCUEEdGogCE0NACAXQRBqIAggJEEobGpJDQgL/QwBAAAAAgAAAAAAAAAAAAAAISkgJEF+cSIKIQIDQCAIICn9DP/////////////////////9rgEiKv0bAEEobGoiAf0MAAAAAAAA8D8AAAAAAAAAACIr/QsDECABIBcgKUEB/asBIiz9DAEAAAABAAAAAQAAAAEAAAD9UCIf/RsBQQN0aiAXIB/9GwBBA3Rq/V0DAP1XAwABIh8gH/3yASItIBcgLP0bAUEDdGogFyAs/RsAQQN0av1dAwD9VwMAASIsICz98gEiLv3wAf3vAf0MAAAAAAAAkDwAAAAAAACQPP3yASIv/SEAOQMgIAEgLCAsIC4gLf3xASIt/fIBIB8gLCAfIB/98AH98gEiLv3yAf3xASIw/fIBIB8gLSAf/fIBIC4gLP3yAf3wASIt/fIB/fEB/QwAAAAAAAAUQAAAAAAAABRAIi798gEiMSAwIB/98gEgLSAs/fIB/fABIC798gEiH/0NAAECAwQFBgcQERITFBUWF/0LAwAgCCAq/RsBQShsaiIBICv9CwMQIAEgL/0hATkDICABIDEgH/0NCAkKCwwNDg8YGRobHB0eH/0LAwAgKf0MAgAAAAIAAAACAAAAAgAAAP2uASEpIAJBfmoiAg0ACyAkIApGDQggJEEBciEBDAcLQQAhIiATQQA2AuAPIAlBAkgNCiAJQX9qIiQhAUEAIQICQANAICJBH0oNASATQeANaiAiQQJ0aiACNgIAIBNB4A1qIBMoAuAPQQJ0akGAAWogATYCACATIBMoAuAPQQFqIiI2AuAPIAIgAWohAiABQQFLIQogAUEBdiEBIAoNAAsLQQEhASAJQQJGDQQCQCAXIAlBBHRqIAhNDQAgF0EQaiAIICRBKGxqSQ0FC/0MAQAAAAIAAAAAAAAAAAAAACEpICRBfnEiCiECA0AgCCAp/Qz//////////////////////a4BIir9GwBBKGxqIgH9DAAAAAAAAPA/AAAAAAAAAAAiK/0LAxAgASAXIClBAf2rASIs/QwBAAAAAQAAAAEAAAABAAAA/VAiH/0bAUEDdGogFyAf/RsAQQN0av1dAwD9VwMAASIfIB/98gEiLSAXICz9GwFBA3RqIBcgLP0bAEEDdGr9XQMA/VcDAAEiLCAs/fIBIi798AH97wH9DJqZmZmZmYk8mpmZmZmZiTz98gEiL/0hADkDICABICwgLCAsIC4gLf3xASIt/fIBIB8gLCAfIB/98AH98gEiLv3yAf3xASIw/fIBIB8gLSAf/fIBIC4gLP3yAf3wASIt/fIB/fEBIi798gEgHyAwIB/98gEgLSAs/fIB/fABIi398gH98QH9DAAAAAAAABhAAAAAAAAAGEAiMP3yASIxIC4gH/3yASAtICz98gH98AEgMP3yASIf/Q0AAQIDBAUGBxAREhMUFRYX/QsDACAIICr9GwFBKGxqIgEgK/0LAxAgASAv/SEBOQMgIAEgMSAf/Q0ICQoLDA0ODxgZGhscHR4f/QsDACAp/QwCAAAAAgAAAAIAAAACAAAA/a4BISkgAkF+aiICDQALICQgCkYNBSAkQQFyIQEMBAtBACEiIBNBADYC4A8gCUECSA0JIAlBf2oiJCEBQQAhAgJAA0AgIkEfSg0BIBNB4A1qICJBAnRqIAI2AgAgE0HgDWogEygC4A9BAnRqQYABaiABNgIAIBMgEygC4A9BAWoiIjYC4A8gAiABaiECIAFBAUshCiABQQF2IQEgCg0ACwtBASEBIAlBAkYNAQJAIBcgCUEEdGogCE0NACAXQRBqIAggJEEobGpJDQIL/QwBAAAAAgAAAAAAAAAAAAAAISkgJEF+cSIKIQIDQCAIICn9DP/////////////////////9rgEiKv0bAEEobGoiAf0MAAAAAAAA8D8AAAAAAAAAACIr/QsDECABIBcgKUEB/asBIiz9DAEAAAABAAAAAQAAAAEAAAD9UCIf/RsBQQN0aiAXIB/9GwBBA3Rq/V0DAP1XAwABIh8gH/3yASItIBcgLP0bAUEDdGogFyAs/RsAQQN0av1dAwD9VwMAASIsICz98gEiLv3wAf3vAf0MVVVVVVVVhTxVVVVVVVWFPP3yASIv/SEAOQMgIAEgLCAsICwgLCAuIC398QEiLf3yASAfICwgHyAf/fAB/fIBIi798gH98QEiMP3yASAfIC0gH/3yASAuICz98gH98AEiLf3yAf3xASIu/fIBIB8gMCAf/fIBIC0gLP3yAf3wASIt/fIB/fEBIjD98gEgHyAuIB/98gEgLSAs/fIB/fABIi398gH98QH9DAAAAAAAABxAAAAAAAAAHEAiLv3yASIxIDAgH/3yASAtICz98gH98AEgLv3yASIf/Q0AAQIDBAUGBxAREhMUFRYX/QsDACAIICr9GwFBKGxqIgEgK/0LAxAgASAv/SEBOQMgIAEgMSAf/Q0ICQoLDA0ODxgZGhscHR4f/QsDACAp/QwCAAAAAgAAAAIAAAACAAAA/a4BISkgAkF+aiICDQALICQgCkYNAiAkQQFyIQEMAQtBACgCACEyDAsLIAkgAWshCiAXIAFBBHRqIQIgAUEobCAIakFYaiEBA0AgAkEIaisDACEmIAIrAwAhKCABQRBq/QwAAAAAAADwPwAAAAAAAAAA/QsDACABQSBqICYgJqIiJyAoICiiIhign0RVVVVVVVWFPKI5AwAgAUEIaiAmICggKCAoIBggJ6EiJ6IgJiAoICYgJqCiIhiioSIZoiAmICcgJqIgGCAooqAiJ6KhIhiiICYgGSAmoiAnICiioCInoqEiGaIgKCAYICaiICcgKKKgIieioEQAAAAAAAAcQKI5AwAgASAZICiiICcgJqKhRAAAAAAAABxAojkDACABQShqIQEgAkEQaiECIApBf2oiCg0ACwsgIkECSA0GIBMoAuANIQJBASEgA0AgE0HgDWogIEECdGoiASgCACEhAkAgASgCgAEiJEEBSA0AIAJBKGwhCiAhQShsIQkDQCAIIAlqIgIgCCAKaiIBKwMAIAFBKGoiHSsDAKIgAUEIaiIeKwMAIicgAUEwaiIbKwMAIiiioTkDACACQQhqICggASsDACImoiAnIB0rAwAiKKKgOQMAIAJBEGogAUE4aisDACAoIAFBEGoiHSsDAKKgIAFBGGoiHCsDACIYIBsrAwAiGaKhOQMAIAJBGGogGSAdKwMAIieiIBggKKKgIAFBwABqKwMAoDkDACACQSBqIAFByABqKwMAIBwrAwAiKCAooiAnICeioJ8gGqKhIB4rAwAiKCAooiAmICaioJ+jIiZEAAAAAAAAAAAgJkQAAAAAAAAAAGQbIiYgAUEgaisDACIoICYgKGMbOQMAIApB0ABqIQogCUEoaiEJICRBf2oiJA0ACwsgISECICBBAWoiICAiRg0HDAALCyAJIAFrIQogFyABQQR0aiECIAFBKGwgCGpBWGohAQNAIAJBCGorAwAhJiACKwMAISggAUEQav0MAAAAAAAA8D8AAAAAAAAAAP0LAwAgAUEgaiAmICaiIicgKCAooiIYoJ9EmpmZmZmZiTyiOQMAIAFBCGogJiAoICggGCAnoSInoiAmICggJiAmoKIiGKKhIhmiICYgJyAmoiAYICiioCInoqEiGKIgKCAZICaiICcgKKKgIieioEQAAAAAAAAYQKI5AwAgASAYICiiICcgJqKhRAAAAAAAABhAojkDACABQShqIQEgAkEQaiECIApBf2oiCg0ACwsgIkECSA0EIBMoAuANIQJBASEgA0AgE0HgDWogIEECdGoiASgCACEhAkAgASgCgAEiJEEBSA0AIAJBKGwhCiAhQShsIQkDQCAIIAlqIgIgCCAKaiIBKwMAIAFBKGoiHSsDAKIgAUEIaiIeKwMAIicgAUEwaiIbKwMAIiiioTkDACACQQhqICggASsDACImoiAnIB0rAwAiKKKgOQMAIAJBEGogAUE4aisDACAoIAFBEGoiHSsDAKKgIAFBGGoiHCsDACIYIBsrAwAiGaKhOQMAIAJBGGogGSAdKwMAIieiIBggKKKgIAFBwABqKwMAoDkDACACQSBqIAFByABqKwMAIBwrAwAiKCAooiAnICeioJ8gGqKhIB4rAwAiKCAooiAmICaioJ+jIiZEAAAAAAAAAAAgJkQAAAAAAAAAAGQbIiYgAUEgaisDACIoICYgKGMbOQMAIApB0ABqIQogCUEoaiEJICRBf2oiJA0ACwsgISECICBBAWoiICAiRg0FDAALCyAJIAFrIQogFyABQQR0aiECIAFBKGwgCGpBWGohAQNAIAJBCGorAwAhJiACKwMAISggAUEQav0MAAAAAAAA8D8AAAAAAAAAAP0LAwAgAUEgaiAmICaiIicgKCAooiIYoJ9EAAAAAAAAkDyiOQMAIAFBCGogJiAoIBggJ6EiJ6IgJiAoICYgJqCiIhiioSIZoiAoICcgJqIgGCAooqAiJ6KgRAAAAAAAABRAojkDACABIBkgKKIgJyAmoqFEAAAAAAAAFECiOQMAIAFBKGohASACQRBqIQIgCkF/aiIKDQALCyAiQQJIDQIgEygC4A0hAkEBISADQCATQeANaiAgQQJ0aiIBKAIAISECQCABKAKAASIkQQFIDQAgAkEobCEKICFBKGwhCQNAIAggCWoiAiAIIApqIgErAwAgAUEoaiIdKwMAoiABQQhqIh4rAwAiJyABQTBqIhsrAwAiKKKhOQMAIAJBCGogKCABKwMAIiaiICcgHSsDACIooqA5AwAgAkEQaiABQThqKwMAICggAUEQaiIdKwMAoqAgAUEYaiIcKwMAIhggGysDACIZoqE5AwAgAkEYaiAZIB0rAwAiJ6IgGCAooqAgAUHAAGorAwCgOQMAIAJBIGogAUHIAGorAwAgHCsDACIoICiiICcgJ6KgnyAaoqEgHisDACIoICiiICYgJqKgn6MiJkQAAAAAAAAAACAmRAAAAAAAAAAAZBsiJiABQSBqKwMAIiggJiAoYxs5AwAgCkHQAGohCiAJQShqIQkgJEF/aiIkDQALCyAhIQIgIEEBaiIgICJGDQMMAAsLIAkgAWshCiAXIAFBBHRqIQIgAUEobCAIakFYaiEBA0AgAkEIaisDACEmIAIrAwAhKCABQRBq/QwAAAAAAADwPwAAAAAAAAAA/QsDACABQSBqICYgJqIiJyAoICiiIhign0RVVVVVVVWVPKI5AwAgAUEIaiAmIBggJ6EiJ6IgKCAoICYgJqCiIhiioEQAAAAAAAAQQKI5AwAgASAnICiiIBggJqKhRAAAAAAAABBAojkDACABQShqIQEgAkEQaiECIApBf2oiCg0ACwsgIkECSA0AIBMoAuANIQJBASEgA0AgE0HgDWogIEECdGoiASgCACEhAkAgASgCgAEiJEEBSA0AIAJBKGwhCiAhQShsIQkDQCAIIAlqIgIgCCAKaiIBKwMAIAFBKGoiHSsDAKIgAUEIaiIeKwMAIicgAUEwaiIbKwMAIiiioTkDACACQQhqICggASsDACImoiAnIB0rAwAiKKKgOQMAIAJBEGogAUE4aisDACAoIAFBEGoiHSsDAKKgIAFBGGoiHCsDACIYIBsrAwAiGaKhOQMAIAJBGGogGSAdKwMAIieiIBggKKKgIAFBwABqKwMAoDkDACACQSBqIAFByABqKwMAIBwrAwAiKCAooiAnICeioJ8gGqKhIB4rAwAiKCAooiAmICaioJ+jIiZEAAAAAAAAAAAgJkQAAAAAAAAAAGQbIiYgAUEgaisDACIoICYgKGMbOQMAIApB0ABqIQogCUEoaiEJICRBf2oiJA0ACwsgISECICBBAWoiICAiRw0ACwtBAEECNgIECyATIBc2AgAgE0EAKAIMIgE2AgQgE0EANgKMAiATIAhBACAWQQdJGzYCCAJAIAFBAkgNACABQX9qIQhBACEBIBNBDGohCkEAIQIDQCABQR9KDQEgCiABQQJ0aiACNgIAIAogEygCjAJBAnRqQYABaiAINgIAIBMgEygCjAJBAWoiATYCjAIgAiAIaiECIAhBAUshCSAIQQF2IQggCQ0ACwtBwJEKQcCNCiATQeANahCKgICAAEEBIQECQEEeQQAoAggiCCAIQWFqQWJJGyICQQJJDQAgE0HgDWpBCHIhCEEBIQEDQCAIKQMAQgBSDQEgCEEIaiEIIAIgAUEBaiIBRw0ACyACIQELIBNB4A1qIAFBA3RqIghBCGopAwC6RAAAAAAAAPA7oiAIKQMAuqAhGgJAIAFBAkkNAEEBIQgCQCABQQJGDQD9DAAAAAAAAAAAAAAAAAAA8D8gGv0iACEfIAFBf2oiJEF+cSIdQX5qIglBAXYhHgJAIAlBDkkNACAeQXlqIgpBA3ZBAWoiG0EHcSEIAkAgCkE4SQ0AIBtB+P///wNxIQoDQCAKQXhqIgoNAAv9DAAAAAAAAAAAAAAAAAAAAAAhHwsCQCAIDQD9DAAAAAAAAAAAAAAAAAAAAAAhHwwBCwNAIB/9DAAAAAAAAPAfAAAAAAAA8B/98gEhHyAIQX9qIggNAAsLAkAgCUEOcUEORg0AIB5BAWpBB3EhCANAIB/9DAAAAAAAAPA7AAAAAAAA8Dv98gEhHyAIQX9qIggNAAsLIB8gHyAf/Q0ICQoLDA0ODwABAgMEBQYH/fIB/SEAIRogJCAdRg0BICRBAXIhCAsgASAIayEIA0AgGkQAAAAAAADwO6IhGiAIQX9qIggNAAsLIBMpA+ANITNBwJMKQcCPCiATQeANahCKgICAAEEBIQECQCACQQJJDQAgE0HgDWpBCHIhCEEBIQEDQCAIKQMAQgBSDQEgCEEIaiEIIAIgAUEBaiIBRw0ACyACIQELIDNCAVEhCiAamiEoIBNB4A1qIAFBA3RqIghBCGopAwC6RAAAAAAAAPA7oiAIKQMAuqAhJgJAIAFBAkkNAEEBIQgCQCABQQJGDQD9DAAAAAAAAAAAAAAAAAAA8D8gJv0iACEfIAFBf2oiJEF+cSIdQX5qIglBAXYhHgJAIAlBDkkNACAeQXlqIgJBA3ZBAWoiG0EHcSEIAkAgAkE4SQ0AIBtB+P///wNxIQIDQCACQXhqIgINAAv9DAAAAAAAAAAAAAAAAAAAAAAhHwsCQCAIDQD9DAAAAAAAAAAAAAAAAAAAAAAhHwwBCwNAIB/9DAAAAAAAAPAfAAAAAAAA8B/98gEhHyAIQX9qIggNAAsLAkAgCUEOcUEORg0AIB5BAWpBB3EhCANAIB/9DAAAAAAAAPA7AAAAAAAA8Dv98gEhHyAIQX9qIggNAAsLIB8gHyAf/Q0ICQoLDA0ODwABAgMEBQYH/fIB/SEAISYgJCAdRg0BICRBAXIhCAsgASAIayEIA0AgJkQAAAAAAADwO6IhJiAIQX9qIggNAAsLICggGiAKGyEZICaaICYgEykD4A1CAVEbIRgLQQAhCQJAAkACQCAAQQBIDQAgEEEBcUUNACAVQQNGDQAgFkEGSw0AAkACQCALDgQBAAABAAsgFkEFSQ0BCwJAQQAoAhBBAkYNAEEAQQAoAhAiCEEBIAgbNgIQIAgNAiAFRAAAAAAAAOA/oiImIBMoAsgCt6IiGv0UIR8gJiATKALMAreiIib9FCEsIBogBKAiNP0UISkgJiADoCI1/RQhKgJAAkACQAJAAkACQAJAIBZBf2oOBQABAgMEBQv9DAABAAAAAAAAAAAAAAAAAAAhK0EAIQgDQCATQZALaiAIaiAr/RYAQQVuIgH9DyAr/RYBQQVuIgL9FwH9iQH9qQH9/wH9DAAAAAAAAOA/AAAAAAAA4D8iLf3yAf0MAAAAAAAA8L8AAAAAAADwvyIu/fABIB/98gEiL/0LBAAgE0HwB2ogCGogLyAp/fABIi/9CwQAIBNB0ARqIAhqIC/9CwQAIBNB4A1qIAhq/QwAAAAAAAAAAAAAAAAAAAAAIAFBe2z9FwAgAkF7bP0XASAr/W79iQH9qQH9/wEgLf3yASAu/fABICz98gEiLf0LBAAgE0HACWogCGogLSAq/fABIi39CwQAIBNBoAZqIAhqIC39CwQAICv9DAICAgICAgICAgICAgICAgL9biErIAhBEGoiCEHAAUcNAAsgEyAmOQOgDyATICYgNaAiNjkDgAsgEyA2OQPgByATIBo5A9AMIBMgGiA0oCI3OQOwCSATIDc5A5AGQQAhAgJAQfAARQ0AIBNB8AxqQQBB8AD8CwALIBMgNDkDoA0gEyA1OQPgDCATQoCAgICAgID4PzcD6AwCQCAHQQFMDQAgB0F/aiEKIBogGqIgJiAmoqCfIShBACECA0AgE0HgDGogE0HgDGogE0HQA2oQi4CAgAAgEyATKwPQAyA1oCInOQPQAyATIBMrA5AEIDSgIjg5A5AEIBMgEysD2ANEAAAAAAAA8D+gIjk5A9gDIBMrA6AEIjogOqIgEysD4AMiOyA7oqCfIBMrA6gEIjwgPKIgEysD6AMiPSA9oqCfIBMrA7AEIj4gPqIgEysD8AMiPyA/oqCfIBMrA7gEIkAgQKIgEysD+AMiQSBBoqCfIBMrA8AEIkIgQqIgEysDgAQiQyBDoqCfIBMrA8gEIkQgRKIgEysDiAQiRSBFoqCfICiioCAooqAgKKKgICiioCAooqAgKKIgEysDmAQiRiBGoiA5IDmioJ+gICiiIDggOKIgJyAnoqCfoEQAAAAAAAAAQGYNASA4/RQhRyAn/RQhSCBG/RQhSSA5/RQhSiA6/RQhSyA7/RQhTCA8/RQhTSA9/RQhTiA+/RQhTyA//RQhUCBA/RQhUSBB/RQhUiBC/RQhUyBE/RQhLSBD/RQhVCBF/RQhLv0MAQAAAAAAAAABAAAAAAAAACErQQAhCANAIBNBoAZqIAhqIgEgAf0ABAAiLCAs/fIBIBNB0ARqIAhqIgH9AAQAIh8gH/3yAf3xASATQcAJaiAIav0ABAD98AEiKf0LBAAgASAsIB8gH/3wAf3yASATQfAHaiAIav0ABAD98AEiKv0LBAAgRyAq/fEBIBNB4A1qIAhq/QAEACIfIC798gEgVP3wASATQZALaiAIav0ABAAiLCAt/fIB/fEBIi8gH/3yASBS/fABIB8gLf3yASBT/fABICwgLv3yAf3wASIwICz98gH98QEiMSAf/fIBIFD98AEgLyAs/fIBIFH98AEgMCAf/fIB/fABIi8gLP3yAf3xASIwIB/98gEgTv3wASAxICz98gEgT/3wASAvIB/98gH98AEiLyAs/fIB/fEBIjEgH/3yASBM/fABIDAgLP3yASBN/fABIC8gH/3yAf3wASIvICz98gH98QEiMCAf/fIBIEr98AEgMSAs/fIBIEv98AEgLyAf/fIB/fABIi8gLP3yAf3xASIxICz98gH98AEgMCAs/fIBIEn98AEgLyAf/fIB/fABIi8gH/3yAf3wASIwIDD98gEgSCAxIB/98gH98AEgKSAvICz98gH98AH98QEiHyAf/fIB/fABICkgKf3yASAqICr98gH98AH97wH9DAAAAAAAANA8AAAAAAAA0Dz98gEiHyAf/fIB/UsgK/1OISsgCEEQaiIIQcABRw0ACyATIBMrA+AHIlUgVaIgEysDkAYiViBWoqEgNqAiVzkD4AcgEyBVIFYgVqCiIDegIlY5A5AGIDggVqEgJiBFoiBDoCAaIESioSI4ICaiIEGgICYgRKIgQqAgGiBFoqAiRCAaoqEiRSAmoiA/oCA4IBqiIECgIEQgJqKgIjggGqKhIkQgJqIgPaAgRSAaoiA+oCA4ICaioCI4IBqioSJFICaiIDugIEQgGqIgPKAgOCAmoqAiOCAaoqEiRCAmoiA5oCBFIBqiIDqgIDggJqKgIjggGqKhIjkgGqKgIEQgGqIgRqAgOCAmoqAiOCAmoqAiRCBEoiAnIDkgJqKgIFcgOCAaoqChIicgJ6KgIFcgV6IgViBWoqCfRAAAAAAAANA8oiInICeiZA0BICv9TUE//csBQT/9zAH9xAENAQJAQYABRQ0AIBNB4AxqIBNB0ANqQYAB/AoAAAsgAkEBaiICIApHDQALIAohAgtBgAFFDQUgFyATQeAMakGAAfwKAAAMBQv9DAABAAAAAAAAAAAAAAAAAAAhK0EAIQgDQCATQZALaiAIaiAr/RYAQQVuIgH9DyAr/RYBQQVuIgL9FwH9iQH9qQH9/wH9DAAAAAAAAOA/AAAAAAAA4D8iLf3yAf0MAAAAAAAA8L8AAAAAAADwvyIu/fABIB/98gEiL/0LBAAgE0HwB2ogCGogLyAp/fABIi/9CwQAIBNB0ARqIAhqIC/9CwQAIBNB4A1qIAhq/QwAAAAAAAAAAAAAAAAAAAAAIAFBe2z9FwAgAkF7bP0XASAr/W79iQH9qQH9/wEgLf3yASAu/fABICz98gEiLf0LBAAgE0HACWogCGogLSAq/fABIi39CwQAIBNBoAZqIAhqIC39CwQAICv9DAICAgICAgICAgICAgICAgL9biErIAhBEGoiCEHAAUcNAAsgEyAmOQOgDyATICYgNaAiWDkDgAsgEyBYOQPgByATIBo5A9AMIBMgGiA0oCJZOQOwCSATIFk5A5AGQQAhAgJAQfAARQ0AIBNB4ANqQQBB8AD8CwALIBMgNDkDkAQgEyA1OQPQAyATQoCAgICAgID4PzcD2AMCQCAHQQFMDQAgB0F/aiEJIBogGqIgJiAmoqCfIShBACECA0AgE0HQA2ogE0HQA2ogE0HgDGoQi4CAgAACQEGAAUUiCg0AIBNB0AJqIBNB4AxqQYAB/AoAAAsgE0HQAmogE0HQA2ogE0HgDGoQi4CAgAACQCAKDQAgE0HQAmogE0HgDGpBgAH8CgAACyATIBMrA9ACIDWgIjg5A9ACIBMgEysDkAMgNKAiOTkDkAMgEyATKwPYAkQAAAAAAADwP6AiRDkD2AIgEysDoAMiPCA8oiATKwPgAiI9ID2ioJ8gEysDqAMiPiA+oiATKwPoAiI/ID+ioJ8gEysDsAMiQCBAoiATKwPwAiJBIEGioJ8gEysDuAMiQiBCoiATKwP4AiJDIEOioJ8gEysDwAMiRiBGoiATKwOAAyJWIFaioJ8gEysDyAMiRSBFoiATKwOIAyI6IDqioJ8gKKKgICiioCAooqAgKKKgICiioCAooiATKwOYAyJXIFeiIEQgRKKgn6AgKKIgOSA5oiA4IDiioJ+gRAAAAAAAAABAZg0BIDn9FCFHIDj9FCFIIFf9FCFJIET9FCFKIDz9FCFLID39FCFMID79FCFNID/9FCFOIED9FCFPIEH9FCFQIEL9FCFRIEP9FCFSIEb9FCFTIEX9FCEtIFb9FCFUIDr9FCEu/QwBAAAAAAAAAAEAAAAAAAAAIStBACEIA0AgE0GgBmogCGoiASAB/QAEACIsICz98gEgE0HQBGogCGoiAf0ABAAiHyAf/fIB/fEBIiogLP3yASAsIB8gH/3wAf3yASIvIB/98gH98QEgE0HACWogCGr9AAQA/fABIin9CwQAIAEgLyAs/fIBIBNB8AdqIAhq/QAEAP3wASAqIB/98gH98AEiKv0LBAAgRyAq/fEBIBNB4A1qIAhq/QAEACIfIC798gEgVP3wASATQZALaiAIav0ABAAiLCAt/fIB/fEBIi8gH/3yASBS/fABIB8gLf3yASBT/fABICwgLv3yAf3wASIwICz98gH98QEiMSAf/fIBIFD98AEgLyAs/fIBIFH98AEgMCAf/fIB/fABIi8gLP3yAf3xASIwIB/98gEgTv3wASAxICz98gEgT/3wASAvIB/98gH98AEiLyAs/fIB/fEBIjEgH/3yASBM/fABIDAgLP3yASBN/fABIC8gH/3yAf3wASIvICz98gH98QEiMCAf/fIBIEr98AEgMSAs/fIBIEv98AEgLyAf/fIB/fABIi8gLP3yAf3xASIxICz98gH98AEgMCAs/fIBIEn98AEgLyAf/fIB/fABIi8gH/3yAf3wASIwIDD98gEgSCAxIB/98gH98AEgKSAvICz98gH98AH98QEiHyAf/fIB/fABICkgKf3yASAqICr98gH98AH97wH9DAAAAAAAANA8AAAAAAAA0Dz98gEiHyAf/fIB/UsgK/1OISsgCEEQaiIIQcABRw0ACyATIBMrA+AHIjsgO6IgEysDkAYiJyAnoqEiNiA7oiA7ICcgJ6CiIjcgJ6KhIFigIlU5A+AHIBMgNyA7oiBZoCA2ICeioCInOQOQBiA5ICehICYgOqIgVqAgGiBFoqEiOSAmoiBDoCAmIEWiIEagIBogOqKgIkUgGqKhIjogJqIgQaAgOSAaoiBCoCBFICaioCI5IBqioSJFICaiID+gIDogGqIgQKAgOSAmoqAiOSAaoqEiOiAmoiA9oCBFIBqiID6gIDkgJqKgIjkgGqKhIkUgJqIgRKAgOiAaoiA8oCA5ICaioCI5IBqioSJEIBqioCBFIBqiIFegIDkgJqKgIjkgJqKgIkUgRaIgOCBEICaioCBVIDkgGqKgoSI4IDiioCBVIFWiICcgJ6Kgn0QAAAAAAADQPKIiJyAnomQNASAr/U1BP/3LAUE//cwB/cQBDQECQCAKDQAgE0HQA2ogE0HQAmpBgAH8CgAACyACQQFqIgIgCUcNAAsgCSECC0GAAUUNBCAXIBNB0ANqQYAB/AoAAAwEC/0MAAEAAAAAAAAAAAAAAAAAACErQQAhCANAIBNBkAtqIAhqICv9FgBBBW4iAf0PICv9FgFBBW4iAv0XAf2JAf2pAf3/Af0MAAAAAAAA4D8AAAAAAADgPyIt/fIB/QwAAAAAAADwvwAAAAAAAPC/Ii798AEgH/3yASIv/QsEACATQfAHaiAIaiAvICn98AEiL/0LBAAgE0HQBGogCGogL/0LBAAgE0HgDWogCGr9DAAAAAAAAAAAAAAAAAAAAAAgAUF7bP0XACACQXts/RcBICv9bv2JAf2pAf3/ASAt/fIBIC798AEgLP3yASIt/QsEACATQcAJaiAIaiAtICr98AEiLf0LBAAgE0GgBmogCGogLf0LBAAgK/0MAgICAgICAgICAgICAgICAv1uISsgCEEQaiIIQcABRw0ACyATICY5A6APIBMgJiA1oCJYOQOACyATIFg5A+AHIBMgGjkD0AwgEyAaIDSgIlk5A7AJIBMgWTkDkAZBACECAkBB8ABFDQAgE0HgA2pBAEHwAPwLAAsgEyA0OQOQBCATIDU5A9ADIBNCgICAgICAgPg/NwPYAwJAIAdBAUwNACAHQX9qIQkgGiAaoiAmICaioJ8hJ0EAIQIDQCATQdADaiATQdADaiATQeAMahCLgICAAAJAQYABRSIKDQAgE0HQAmogE0HgDGpBgAH8CgAACyATQdACaiATQdADaiATQeAMahCLgICAAAJAIAoNACATQdACaiATQeAMakGAAfwKAAALIBNB0AJqIBNB0ANqIBNB4AxqEIuAgIAAAkAgCg0AIBNB0AJqIBNB4AxqQYAB/AoAAAsgEyATKwPQAiA1oCI5OQPQAiATIBMrA5ADIDSgIkQ5A5ADIBMgEysD2AJEAAAAAAAA8D+gIkU5A9gCIBMrA6ADIjwgPKIgEysD4AIiPSA9oqCfIBMrA6gDIj4gPqIgEysD6AIiPyA/oqCfIBMrA7ADIkAgQKIgEysD8AIiQSBBoqCfIBMrA7gDIkIgQqIgEysD+AIiQyBDoqCfIBMrA8ADIkYgRqIgEysDgAMiViBWoqCfIBMrA8gDIjogOqIgEysDiAMiOyA7oqCfICeioCAnoqAgJ6KgICeioCAnoqAgJ6IgEysDmAMiVyBXoiBFIEWioJ+gICeiIEQgRKIgOSA5oqCfoEQAAAAAAAAAQGYNASBE/RQhRyA5/RQhSCBX/RQhSSBF/RQhSiA8/RQhSyA9/RQhTCA+/RQhTSA//RQhTiBA/RQhTyBB/RQhUCBC/RQhUSBD/RQhUiBG/RQhUyA6/RQhLSBW/RQhVCA7/RQhLv0MAQAAAAAAAAABAAAAAAAAACErQQAhCANAIBNBoAZqIAhqIgEgAf0ABAAiLCAs/fIBIBNB0ARqIAhqIgH9AAQAIh8gH/3yAf3xASIpICz98gEgLCAfIB/98AH98gEiKiAf/fIB/fEBIi8gLP3yASApIB/98gEgKiAs/fIB/fABIiogH/3yAf3xASATQcAJaiAIav0ABAD98AEiKf0LBAAgASAqICz98gEgE0HwB2ogCGr9AAQA/fABIC8gH/3yAf3wASIq/QsEACBHICr98QEgE0HgDWogCGr9AAQAIh8gLv3yASBU/fABIBNBkAtqIAhq/QAEACIsIC398gH98QEiLyAf/fIBIFL98AEgHyAt/fIBIFP98AEgLCAu/fIB/fABIjAgLP3yAf3xASIxIB/98gEgUP3wASAvICz98gEgUf3wASAwIB/98gH98AEiLyAs/fIB/fEBIjAgH/3yASBO/fABIDEgLP3yASBP/fABIC8gH/3yAf3wASIvICz98gH98QEiMSAf/fIBIEz98AEgMCAs/fIBIE398AEgLyAf/fIB/fABIi8gLP3yAf3xASIwIB/98gEgSv3wASAxICz98gEgS/3wASAvIB/98gH98AEiLyAs/fIB/fEBIjEgLP3yAf3wASAwICz98gEgSf3wASAvIB/98gH98AEiLyAf/fIB/fABIjAgMP3yASBIIDEgH/3yAf3wASApIC8gLP3yAf3wAf3xASIfIB/98gH98AEgKSAp/fIBICogKv3yAf3wAf3vAf0MAAAAAAAA0DwAAAAAAADQPP3yASIfIB/98gH9SyAr/U4hKyAIQRBqIghBwAFHDQALIBMgEysD4AciOCA4oiATKwOQBiIoICiioSJVIDiiIDggKCAooKIiNiAooqEiNyA4oiBVICiiIDYgOKKgIjYgKKKhIFigIlU5A+AHIBMgNiA4oiBZoCA3ICiioCIoOQOQBiBEICihICYgO6IgVqAgGiA6oqEiOCAmoiBDoCAmIDqiIEagIBogO6KgIkQgGqKhIjogJqIgQaAgOCAaoiBCoCBEICaioCI4IBqioSJEICaiID+gIDogGqIgQKAgOCAmoqAiOCAaoqEiOiAmoiA9oCBEIBqiID6gIDggJqKgIjggGqKhIkQgJqIgRaAgOiAaoiA8oCA4ICaioCI4IBqioSJFIBqioCBEIBqiIFegIDggJqKgIjggJqKgIkQgRKIgOSBFICaioCBVIDggGqKgoSI4IDiioCBVIFWiICggKKKgn0QAAAAAAADQPKIiKCAoomQNASAr/U1BP/3LAUE//cwB/cQBDQECQCAKDQAgE0HQA2ogE0HQAmpBgAH8CgAACyACQQFqIgIgCUcNAAsgCSECC0GAAUUNAyAXIBNB0ANqQYAB/AoAAAwDC/0MAAEAAAAAAAAAAAAAAAAAACErQQAhCANAIBNBkAtqIAhqICv9FgBBBW4iAf0PICv9FgFBBW4iAv0XAf2JAf2pAf3/Af0MAAAAAAAA4D8AAAAAAADgPyIt/fIB/QwAAAAAAADwvwAAAAAAAPC/Ii798AEgH/3yASIv/QsEACATQfAHaiAIaiAvICn98AEiL/0LBAAgE0HQBGogCGogL/0LBAAgE0HgDWogCGr9DAAAAAAAAAAAAAAAAAAAAAAgAUF7bP0XACACQXts/RcBICv9bv2JAf2pAf3/ASAt/fIBIC798AEgLP3yASIt/QsEACATQcAJaiAIaiAtICr98AEiLf0LBAAgE0GgBmogCGogLf0LBAAgK/0MAgICAgICAgICAgICAgICAv1uISsgCEEQaiIIQcABRw0ACyATICY5A6APIBMgJiA1oCJYOQOACyATIFg5A+AHIBMgGjkD0AwgEyAaIDSgIlk5A7AJIBMgWTkDkAZBACECAkBB8ABFDQAgE0HgA2pBAEHwAPwLAAsgEyA0OQOQBCATIDU5A9ADIBNCgICAgICAgPg/NwPYAwJAIAdBAUwNACAHQX9qIQkgGiAaoiAmICaioJ8hOEEAIQIDQCATQdADaiATQdADaiATQeAMahCLgICAAAJAQYABRSIKDQAgE0HQAmogE0HgDGpBgAH8CgAACyATQdACaiATQdADaiATQeAMahCLgICAAAJAIAoNACATQdACaiATQeAMakGAAfwKAAALIBNB0AJqIBNB0ANqIBNB4AxqEIuAgIAAAkAgCg0AIBNB0AJqIBNB4AxqQYAB/AoAAAsgE0HQAmogE0HQA2ogE0HgDGoQi4CAgAACQCAKDQAgE0HQAmogE0HgDGpBgAH8CgAACyATIBMrA9ACIDWgIjk5A9ACIBMgEysDkAMgNKAiRDkDkAMgEyATKwPYAkQAAAAAAADwP6AiRTkD2AIgEysDoAMiPCA8oiATKwPgAiI9ID2ioJ8gEysDqAMiPiA+oiATKwPoAiI/ID+ioJ8gEysDsAMiQCBAoiATKwPwAiJBIEGioJ8gEysDuAMiQiBCoiATKwP4AiJDIEOioJ8gEysDwAMiRiBGoiATKwOAAyJWIFaioJ8gEysDyAMiOiA6oiATKwOIAyI7IDuioJ8gOKKgIDiioCA4oqAgOKKgIDiioCA4oiATKwOYAyJXIFeiIEUgRaKgn6AgOKIgRCBEoiA5IDmioJ+gRAAAAAAAAABAZg0BIET9FCFHIDn9FCFIIFf9FCFJIEX9FCFKIDz9FCFLID39FCFMID79FCFNID/9FCFOIED9FCFPIEH9FCFQIEL9FCFRIEP9FCFSIEb9FCFTIDr9FCEtIFb9FCFUIDv9FCEu/QwBAAAAAAAAAAEAAAAAAAAAIStBACEIA0AgE0GgBmogCGoiASAB/QAEACIsICz98gEgE0HQBGogCGoiAf0ABAAiHyAf/fIB/fEBIikgLP3yASAsIB8gH/3wAf3yASIqIB/98gH98QEiLyAs/fIBICkgH/3yASAqICz98gH98AEiKSAf/fIB/fEBIiogLP3yASAvIB/98gEgKSAs/fIB/fABIi8gH/3yAf3xASATQcAJaiAIav0ABAD98AEiKf0LBAAgASAvICz98gEgE0HwB2ogCGr9AAQA/fABICogH/3yAf3wASIq/QsEACBHICr98QEgE0HgDWogCGr9AAQAIh8gLv3yASBU/fABIBNBkAtqIAhq/QAEACIsIC398gH98QEiLyAf/fIBIFL98AEgHyAt/fIBIFP98AEgLCAu/fIB/fABIjAgLP3yAf3xASIxIB/98gEgUP3wASAvICz98gEgUf3wASAwIB/98gH98AEiLyAs/fIB/fEBIjAgH/3yASBO/fABIDEgLP3yASBP/fABIC8gH/3yAf3wASIvICz98gH98QEiMSAf/fIBIEz98AEgMCAs/fIBIE398AEgLyAf/fIB/fABIi8gLP3yAf3xASIwIB/98gEgSv3wASAxICz98gEgS/3wASAvIB/98gH98AEiLyAs/fIB/fEBIjEgLP3yAf3wASAwICz98gEgSf3wASAvIB/98gH98AEiLyAf/fIB/fABIjAgMP3yASBIIDEgH/3yAf3wASApIC8gLP3yAf3wAf3xASIfIB/98gH98AEgKSAp/fIBICogKv3yAf3wAf3vAf0MAAAAAAAA0DwAAAAAAADQPP3yASIfIB/98gH9SyAr/U4hKyAIQRBqIghBwAFHDQALIBMgEysD4AciJyAnoiATKwOQBiIoICiioSJVICeiICcgKCAooKIiNiAooqEiNyAnoiBVICiiIDYgJ6KgIlUgKKKhIjYgJ6IgNyAooiBVICeioCI3ICiioSBYoCJVOQPgByATIDcgJ6IgWaAgNiAooqAiKDkDkAYgRCAooSAmIDuiIFagIBogOqKhIicgJqIgQ6AgJiA6oiBGoCAaIDuioCJEIBqioSI6ICaiIEGgICcgGqIgQqAgRCAmoqAiJyAaoqEiRCAmoiA/oCA6IBqiIECgICcgJqKgIicgGqKhIjogJqIgPaAgRCAaoiA+oCAnICaioCInIBqioSJEICaiIEWgIDogGqIgPKAgJyAmoqAiJyAaoqEiRSAaoqAgRCAaoiBXoCAnICaioCInICaioCJEIESiIDkgRSAmoqAgVSAnIBqioKEiJyAnoqAgVSBVoiAoICiioJ9EAAAAAAAA0DyiIiggKKJkDQEgK/1NQT/9ywFBP/3MAf3EAQ0BAkAgCg0AIBNB0ANqIBNB0AJqQYAB/AoAAAsgAkEBaiICIAlHDQALIAkhAgtBgAFFDQIgFyATQdADakGAAfwKAAAMAgv9DAABAAAAAAAAAAAAAAAAAAAhK0EAIQgDQCATQZALaiAIaiAr/RYAQQVuIgH9DyAr/RYBQQVuIgL9FwH9iQH9qQH9/wH9DAAAAAAAAOA/AAAAAAAA4D8iLf3yAf0MAAAAAAAA8L8AAAAAAADwvyIu/fABIB/98gEiL/0LBAAgE0HwB2ogCGogLyAp/fABIi/9CwQAIBNB0ARqIAhqIC/9CwQAIBNB4A1qIAhq/QwAAAAAAAAAAAAAAAAAAAAAIAFBe2z9FwAgAkF7bP0XASAr/W79iQH9qQH9/wEgLf3yASAu/fABICz98gEiLf0LBAAgE0HACWogCGogLSAq/fABIi39CwQAIBNBoAZqIAhqIC39CwQAICv9DAICAgICAgICAgICAgICAgL9biErIAhBEGoiCEHAAUcNAAsgEyAmOQOgDyATICYgNaAiWDkDgAsgEyBYOQPgByATIBo5A9AMIBMgGiA0oCJZOQOwCSATIFk5A5AGQQAhAgJAQfAARQ0AIBNB4ANqQQBB8AD8CwALIBMgNDkDkAQgEyA1OQPQAyATQoCAgICAgID4PzcD2AMCQCAHQQFMDQAgB0F/aiEJIBogGqIgJiAmoqCfIThBACECA0AgE0HQA2ogE0HQA2ogE0HgDGoQi4CAgAACQEGAAUUiCg0AIBNB0AJqIBNB4AxqQYAB/AoAAAsgE0HQAmogE0HQA2ogE0HgDGoQi4CAgAACQCAKDQAgE0HQAmogE0HgDGpBgAH8CgAACyATQdACaiATQdADaiATQeAMahCLgICAAAJAIAoNACATQdACaiATQeAMakGAAfwKAAALIBNB0AJqIBNB0ANqIBNB4AxqEIuAgIAAAkAgCg0AIBNB0AJqIBNB4AxqQYAB/AoAAAsgE0HQAmogE0HQA2ogE0HgDGoQi4CAgAACQCAKDQAgE0HQAmogE0HgDGpBgAH8CgAACyATIBMrA9ACIDWgIjk5A9ACIBMgEysDkAMgNKAiRDkDkAMgEyATKwPYAkQAAAAAAADwP6AiRTkD2AIgEysDoAMiPCA8oiATKwPgAiI9ID2ioJ8gEysDqAMiPiA+oiATKwPoAiI/ID+ioJ8gEysDsAMiQCBAoiATKwPwAiJBIEGioJ8gEysDuAMiQiBCoiATKwP4AiJDIEOioJ8gEysDwAMiRiBGoiATKwOAAyJWIFaioJ8gEysDyAMiOiA6oiATKwOIAyI7IDuioJ8gOKKgIDiioCA4oqAgOKKgIDiioCA4oiATKwOYAyJXIFeiIEUgRaKgn6AgOKIgRCBEoiA5IDmioJ+gRAAAAAAAAABAZg0BIET9FCFHIDn9FCFIIFf9FCFJIEX9FCFKIDz9FCFLID39FCFMID79FCFNID/9FCFOIED9FCFPIEH9FCFQIEL9FCFRIEP9FCFSIEb9FCFTIDr9FCEtIFb9FCFUIDv9FCEu/QwBAAAAAAAAAAEAAAAAAAAAIStBACEIA0AgE0GgBmogCGoiASAB/QAEACIsICz98gEgE0HQBGogCGoiAf0ABAAiHyAf/fIB/fEBIikgLP3yASAsIB8gH/3wAf3yASIqIB/98gH98QEiLyAs/fIBICkgH/3yASAqICz98gH98AEiKSAf/fIB/fEBIiogLP3yASAvIB/98gEgKSAs/fIB/fABIikgH/3yAf3xASIvICz98gEgKiAf/fIBICkgLP3yAf3wASIqIB/98gH98QEgE0HACWogCGr9AAQA/fABIin9CwQAIAEgKiAs/fIBIBNB8AdqIAhq/QAEAP3wASAvIB/98gH98AEiKv0LBAAgRyAq/fEBIBNB4A1qIAhq/QAEACIfIC798gEgVP3wASATQZALaiAIav0ABAAiLCAt/fIB/fEBIi8gH/3yASBS/fABIB8gLf3yASBT/fABICwgLv3yAf3wASIwICz98gH98QEiMSAf/fIBIFD98AEgLyAs/fIBIFH98AEgMCAf/fIB/fABIi8gLP3yAf3xASIwIB/98gEgTv3wASAxICz98gEgT/3wASAvIB/98gH98AEiLyAs/fIB/fEBIjEgH/3yASBM/fABIDAgLP3yASBN/fABIC8gH/3yAf3wASIvICz98gH98QEiMCAf/fIBIEr98AEgMSAs/fIBIEv98AEgLyAf/fIB/fABIi8gLP3yAf3xASIxICz98gH98AEgMCAs/fIBIEn98AEgLyAf/fIB/fABIi8gH/3yAf3wASIwIDD98gEgSCAxIB/98gH98AEgKSAvICz98gH98AH98QEiHyAf/fIB/fABICkgKf3yASAqICr98gH98AH97wH9DAAAAAAAANA8AAAAAAAA0Dz98gEiHyAf/fIB/UsgK/1OISsgCEEQaiIIQcABRw0ACyATIBMrA+AHIicgJ6IgEysDkAYiKCAooqEiVSAnoiAnICggKKCiIjYgKKKhIjcgJ6IgVSAooiA2ICeioCJVICiioSI2ICeiIDcgKKIgVSAnoqAiVSAooqEiNyAnoiA2ICiiIFUgJ6KgIjYgKKKhIFigIlU5A+AHIBMgNiAnoiBZoCA3ICiioCIoOQOQBiBEICihICYgO6IgVqAgGiA6oqEiJyAmoiBDoCAmIDqiIEagIBogO6KgIkQgGqKhIjogJqIgQaAgJyAaoiBCoCBEICaioCInIBqioSJEICaiID+gIDogGqIgQKAgJyAmoqAiJyAaoqEiOiAmoiA9oCBEIBqiID6gICcgJqKgIicgGqKhIkQgJqIgRaAgOiAaoiA8oCAnICaioCInIBqioSJFIBqioCBEIBqiIFegICcgJqKgIicgJqKgIkQgRKIgOSBFICaioCBVICcgGqKgoSInICeioCBVIFWiICggKKKgn0QAAAAAAADQPKIiKCAoomQNASAr/U1BP/3LAUE//cwB/cQBDQECQCAKDQAgE0HQA2ogE0HQAmpBgAH8CgAACyACQQFqIgIgCUcNAAsgCSECC0GAAUUNASAXIBNB0ANqQYAB/AoAAAwBC/0MAAEAAAAAAAAAAAAAAAAAACErQQAhCANAIBNBkAtqIAhqICv9FgBBBW4iAf0PICv9FgFBBW4iAv0XAf2JAf2pAf3/Af0MAAAAAAAA4D8AAAAAAADgPyIt/fIB/QwAAAAAAADwvwAAAAAAAPC/Ii798AEgH/3yASIv/QsEACATQfAHaiAIaiAvICn98AEiL/0LBAAgE0HQBGogCGogL/0LBAAgE0HgDWogCGr9DAAAAAAAAAAAAAAAAAAAAAAgAUF7bP0XACACQXts/RcBICv9bv2JAf2pAf3/ASAt/fIBIC798AEgLP3yASIt/QsEACATQcAJaiAIaiAtICr98AEiLf0LBAAgE0GgBmogCGogLf0LBAAgK/0MAgICAgICAgICAgICAgICAv1uISsgCEEQaiIIQcABRw0ACyATICY5A6APIBMgJiA1oCJYOQOACyATIFg5A+AHIBMgGjkD0AwgEyAaIDSgIlk5A7AJIBMgWTkDkAZBACECAkBB8ABFDQAgE0HgA2pBAEHwAPwLAAsgEyA0OQOQBCATIDU5A9ADIBNCgICAgICAgPg/NwPYAwJAIAdBAUwNACAHQX9qIQkgGiAaoiAmICaioJ8hOEEAIQIDQCATQdADaiATQdADaiATQeAMahCLgICAAAJAQYABRSIKDQAgE0HQAmogE0HgDGpBgAH8CgAACyATQdACaiATQdADaiATQeAMahCLgICAAAJAIAoNACATQdACaiATQeAMakGAAfwKAAALIBNB0AJqIBNB0ANqIBNB4AxqEIuAgIAAAkAgCg0AIBNB0AJqIBNB4AxqQYAB/AoAAAsgE0HQAmogE0HQA2ogE0HgDGoQi4CAgAACQCAKDQAgE0HQAmogE0HgDGpBgAH8CgAACyATQdACaiATQdADaiATQeAMahCLgICAAAJAIAoNACATQdACaiATQeAMakGAAfwKAAALIBNB0AJqIBNB0ANqIBNB4AxqEIuAgIAAAkAgCg0AIBNB0AJqIBNB4AxqQYAB/AoAAAsgEyATKwPQAiA1oCI5OQPQAiATIBMrA5ADIDSgIkQ5A5ADIBMgEysD2AJEAAAAAAAA8D+gIkU5A9gCIBMrA6ADIjwgPKIgEysD4AIiPSA9oqCfIBMrA6gDIj4gPqIgEysD6AIiPyA/oqCfIBMrA7ADIkAgQKIgEysD8AIiQSBBoqCfIBMrA7gDIkIgQqIgEysD+AIiQyBDoqCfIBMrA8ADIkYgRqIgEysDgAMiViBWoqCfIBMrA8gDIjogOqIgEysDiAMiOyA7oqCfIDiioCA4oqAgOKKgIDiioCA4oqAgOKIgEysDmAMiVyBXoiBFIEWioJ+gIDiiIEQgRKIgOSA5oqCfoEQAAAAAAAAAQGYNASBE/RQhRyA5/RQhSCBX/RQhSSBF/RQhSiA8/RQhSyA9/RQhTCA+/RQhTSA//RQhTiBA/RQhTyBB/RQhUCBC/RQhUSBD/RQhUiBG/RQhUyA6/RQhLSBW/RQhVCA7/RQhLv0MAQAAAAAAAAABAAAAAAAAACErQQAhCANAIBNBoAZqIAhqIgEgAf0ABAAiLCAs/fIBIBNB0ARqIAhqIgH9AAQAIh8gH/3yAf3xASIpICz98gEgLCAfIB/98AH98gEiKiAf/fIB/fEBIi8gLP3yASApIB/98gEgKiAs/fIB/fABIikgH/3yAf3xASIqICz98gEgLyAf/fIBICkgLP3yAf3wASIpIB/98gH98QEiLyAs/fIBICogH/3yASApICz98gH98AEiKSAf/fIB/fEBIiogLP3yASAvIB/98gEgKSAs/fIB/fABIi8gH/3yAf3xASATQcAJaiAIav0ABAD98AEiKf0LBAAgASAvICz98gEgE0HwB2ogCGr9AAQA/fABICogH/3yAf3wASIq/QsEACBHICr98QEgE0HgDWogCGr9AAQAIh8gLv3yASBU/fABIBNBkAtqIAhq/QAEACIsIC398gH98QEiLyAf/fIBIFL98AEgHyAt/fIBIFP98AEgLCAu/fIB/fABIjAgLP3yAf3xASIxIB/98gEgUP3wASAvICz98gEgUf3wASAwIB/98gH98AEiLyAs/fIB/fEBIjAgH/3yASBO/fABIDEgLP3yASBP/fABIC8gH/3yAf3wASIvICz98gH98QEiMSAf/fIBIEz98AEgMCAs/fIBIE398AEgLyAf/fIB/fABIi8gLP3yAf3xASIwIB/98gEgSv3wASAxICz98gEgS/3wASAvIB/98gH98AEiLyAs/fIB/fEBIjEgLP3yAf3wASAwICz98gEgSf3wASAvIB/98gH98AEiLyAf/fIB/fABIjAgMP3yASBIIDEgH/3yAf3wASApIC8gLP3yAf3wAf3xASIfIB/98gH98AEgKSAp/fIBICogKv3yAf3wAf3vAf0MAAAAAAAA0DwAAAAAAADQPP3yASIfIB/98gH9SyAr/U4hKyAIQRBqIghBwAFHDQALIBMgEysD4AciJyAnoiATKwOQBiIoICiioSJVICeiICcgKCAooKIiNiAooqEiNyAnoiBVICiiIDYgJ6KgIlUgKKKhIjYgJ6IgNyAooiBVICeioCJVICiioSI3ICeiIDYgKKIgVSAnoqAiVSAooqEiNiAnoiA3ICiiIFUgJ6KgIjcgKKKhIFigIlU5A+AHIBMgNyAnoiBZoCA2ICiioCIoOQOQBiBEICihICYgO6IgVqAgGiA6oqEiJyAmoiBDoCAmIDqiIEagIBogO6KgIkQgGqKhIjogJqIgQaAgJyAaoiBCoCBEICaioCInIBqioSJEICaiID+gIDogGqIgQKAgJyAmoqAiJyAaoqEiOiAmoiA9oCBEIBqiID6gICcgJqKgIicgGqKhIkQgJqIgRaAgOiAaoiA8oCAnICaioCInIBqioSJFIBqioCBEIBqiIFegICcgJqKgIicgJqKgIkQgRKIgOSBFICaioCBVICcgGqKgoSInICeioCBVIFWiICggKKKgn0QAAAAAAADQPKIiKCAoomQNASAr/U1BP/3LAUE//cwB/cQBDQECQCAKDQAgE0HQA2ogE0HQAmpBgAH8CgAACyACQQFqIgIgCUcNAAsgCSECC0GAAUUNACAXIBNB0ANqQYAB/AoAAAtBACACNgIUQQBBAjYCEAtBACgCFCEJC0QAAAAAAAAAACEoRAAAAAAAAAAAITREAAAAAAAAAAAhNQJAIBVBAkcNAEEBIQECQEEeQQAoAggiJCAkQWFqIh1BYkkbIgJBAkkNAEHIkQohCEEBIQEDQCAIKQMAQgBSDQEgCEEIaiEIIAIgAUEBaiIBRw0ACyACIQELIAFBA3QiCEHIkQpqKQMAukQAAAAAAADwO6IgCEHAkQpqKQMAuqAhGgJAIAFBAkkNAEEBIQgCQCABQQJGDQD9DAAAAAAAAAAAAAAAAAAA8D8gGv0iACEfIAFBf2oiG0F+cSIcQX5qIh5BAXYhIgJAIB5BDkkNACAiQXlqIgpBA3ZBAWoiIEEHcSEIAkAgCkE4SQ0AICBB+P///wNxIQoDQCAKQXhqIgoNAAv9DAAAAAAAAAAAAAAAAAAAAAAhHwsCQCAIDQD9DAAAAAAAAAAAAAAAAAAAAAAhHwwBCwNAIB/9DAAAAAAAAPAfAAAAAAAA8B/98gEhHyAIQX9qIggNAAsLAkAgHkEOcUEORg0AICJBAWpBB3EhCANAIB/9DAAAAAAAAPA7AAAAAAAA8Dv98gEhHyAIQX9qIggNAAsLIB8gHyAf/Q0ICQoLDA0ODwABAgMEBQYH/fIB/SEAIRogGyAcRg0BIBtBAXIhCAsgASAIayEIA0AgGkQAAAAAAADwO6IhGiAIQX9qIggNAAsLQQApA8CRCiEzAkBBICAkQQJqIB1BYkkbIgpBA3QiHUUiHg0AIBNB4A1qQQAgHfwLAAsgEyAamSIm/Ac3A+gNIBMgGpogGiAzQgFRGyIDRAAAAAAAAAAAY603A+ANAkAgCkEDSA0AICYgJp2hIhpEAAAAAAAAAABhDQAgE0HwDWohCEEDIQEDQCAIIBpEAAAAAAAA8EOiIhr8BzcDACABIApODQEgCEEIaiEIIAFBAWohASAaIBqdoSIaRAAAAAAAAAAAYg0ACwtBwJEKIBNB4A1qIBNB4A1qEIqAgIAAQQEhAQJAIAJBAkkNACATQeANakEIciEIQQEhAQNAIAgpAwBCAFINASAIQQhqIQggAiABQQFqIgFHDQALIAIhAQsgE0HgDWogAUEDdGoiCEEIaikDALpEAAAAAAAA8DuiIAgpAwC6oCEmAkAgAUECSQ0AQQEhCAJAIAFBAkYNAP0MAAAAAAAAAAAAAAAAAADwPyAm/SIAIR8gAUF/aiIcQX5xIiJBfmoiG0EBdiEgAkAgG0EOSQ0AICBBeWoiJEEDdkEBaiIhQQdxIQgCQCAkQThJDQAgIUH4////A3EhJANAICRBeGoiJA0AC/0MAAAAAAAAAAAAAAAAAAAAACEfCwJAIAgNAP0MAAAAAAAAAAAAAAAAAAAAACEfDAELA0AgH/0MAAAAAAAA8B8AAAAAAADwH/3yASEfIAhBf2oiCA0ACwsCQCAbQQ5xQQ5GDQAgIEEBakEHcSEIA0AgH/0MAAAAAAAA8DsAAAAAAADwO/3yASEfIAhBf2oiCA0ACwsgHyAfIB/9DQgJCgsMDQ4PAAECAwQFBgf98gH9IQAhJiAcICJGDQEgHEEBciEICyABIAhrIQgDQCAmRAAAAAAAAPA7oiEmIAhBf2oiCA0ACwtBASEBAkAgAkECSQ0AQciTCiEIQQEhAQNAIAgpAwBCAFINASAIQQhqIQggAiABQQFqIgFHDQALIAIhAQsgAUEDdCIIQciTCmopAwC6RAAAAAAAAPA7oiAIQcCTCmopAwC6oCEaAkAgAUECSQ0AQQEhCAJAIAFBAkYNAP0MAAAAAAAAAAAAAAAAAADwPyAa/SIAIR8gAUF/aiIcQX5xIiJBfmoiG0EBdiEgAkAgG0EOSQ0AICBBeWoiJEEDdkEBaiIhQQdxIQgCQCAkQThJDQAgIUH4////A3EhJANAICRBeGoiJA0AC/0MAAAAAAAAAAAAAAAAAAAAACEfCwJAIAgNAP0MAAAAAAAAAAAAAAAAAAAAACEfDAELA0AgH/0MAAAAAAAA8B8AAAAAAADwH/3yASEfIAhBf2oiCA0ACwsCQCAbQQ5xQQ5GDQAgIEEBakEHcSEIA0AgH/0MAAAAAAAA8DsAAAAAAADwO/3yASEfIAhBf2oiCA0ACwsgHyAfIB/9DQgJCgsMDQ4PAAECAwQFBgf98gH9IQAhGiAcICJGDQEgHEEBciEICyABIAhrIQgDQCAaRAAAAAAAAPA7oiEaIAhBf2oiCA0ACwsgEykD4A0hM0EAKQPAkwohWgJAIB4NACATQeANakEAIB38CwALIBMgGpkiJ/wHNwPoDSATIBqaIBogWkIBURsiBEQAAAAAAAAAAGOtNwPgDQJAIApBA0gNACAnICedoSIaRAAAAAAAAAAAYQ0AIBNB8A1qIQhBAyEBA0AgCCAaRAAAAAAAAPBDoiIa/Ac3AwAgASAKTg0BIAhBCGohCCABQQFqIQEgGiAanaEiGkQAAAAAAAAAAGINAAsLQcCTCiATQeANaiATQeANahCKgICAAEEBIQECQCACQQJJDQAgE0HgDWpBCHIhCEEBIQEDQCAIKQMAQgBSDQEgCEEIaiEIIAIgAUEBaiIBRw0ACyACIQELIDNCAVEhCiAmmiEnIBNB4A1qIAFBA3RqIghBCGopAwC6RAAAAAAAAPA7oiAIKQMAuqAhGgJAIAFBAkkNAEEBIQgCQCABQQJGDQD9DAAAAAAAAAAAAAAAAAAA8D8gGv0iACEfIAFBf2oiHUF+cSIeQX5qIiRBAXYhGwJAICRBDkkNACAbQXlqIgJBA3ZBAWoiHEEHcSEIAkAgAkE4SQ0AIBxB+P///wNxIQIDQCACQXhqIgINAAv9DAAAAAAAAAAAAAAAAAAAAAAhHwsCQCAIDQD9DAAAAAAAAAAAAAAAAAAAAAAhHwwBCwNAIB/9DAAAAAAAAPAfAAAAAAAA8B/98gEhHyAIQX9qIggNAAsLAkAgJEEOcUEORg0AIBtBAWpBB3EhCANAIB/9DAAAAAAAAPA7AAAAAAAA8Dv98gEhHyAIQX9qIggNAAsLIB8gHyAf/Q0ICQoLDA0ODwABAgMEBQYH/fIB/SEAIRogHSAeRg0BIB1BAXIhCAsgASAIayEIA0AgGkQAAAAAAADwO6IhGiAIQX9qIggNAAsLICcgJiAKGyE1IBqaIBogEykD4A1CAVEbITQLIABBH3YhCiAFRAAAAAAAAFA/okQAAAAAAAAAACAQQQRxGyE4QQMhCAJAIBVBA0YNAAJAAkACQAJAAkACQCAWQX5qDg8FAAECAwQFAAQEBgQEBQAEC0EEIQgMBAtBBSEIDAMLQQYhCAwCC0EHIQgMAQtBAiEICyOBgICAAEGAgICAAGogCEEDdGorAwAhGkEAIQECQCAAQQBIDQD9DAAAAAAAAAAAAAAAAAAA8D8gGv0iACIsIBr9FCIq/fIBIR8gCEF+av0RISkCQCAIQQZxIghBAkYNACAfICr98gEhK0EEIQECQCAIQQRHDQBBAiEBIB8hLCArIR8MAQsgKyAq/fIBIR8gKyEsCyAaICwgHyAB/RH9DAAAAAABAAAAAAAAAAAAAAD9UCAp/Tz9xwH9UiIfIB8gH/0NCAkKCwwNDg8AAQIDBAUGB/3yAf0hAKEhKAwBC/0MAAAAAAAAAAAAAAAAAADwPyItIBr9IgAiLCAa/RQiKf3yASEfIAhBfmr9ESErIA8gD6IhJkEAIQECQCAIQQZxIgBBAkYNACAfICn98gEhKkEEIQECQCAAQQRHDQBBAiEBIB8hLCAqIR8MAQsgKiAp/fIBIR8gKiEsCyAmIA4gDqKgnyInIBogLCAfIAH9Ef0MAAAAAAEAAAAAAAAAAAAAACIu/VAgK/08/ccB/VIiHyAfIB/9DQgJCgsMDQ4PAAECAwQFBgf98gH9IQChZA0ARAAAAAAAAPA/ISZBMiEIIABBAkYhAiAAQQRGIQAgGiEoA0AgLSAoICagRAAAAAAAAOA/oiIa/SIAIiwgGv0UIin98gEhHwJAAkAgAkUNAEEAIQEMAQsgHyAp/fIBISoCQCAARQ0AQQIhASAfISwgKiEfDAELICogKf3yASEfQQQhASAqISwLIBogJiAaICwgHyAB/REgLv1QICv9PP3HAf1SIh8gHyAf/Q0ICQoLDA0ODwABAgMEBQYH/fIB/SEAoSAnYyIBGyEmICggGiABGyEoIAhBf2oiCA0ACwsgEyAHNgKYCyATIAs2ApQLIBMgFjYCkAsgEyAYOQOYDCATIBk5A5AMIBMgFzYChAwgEyAJNgKADCATICg5A/gLIBMgODkD8AsgEyA0OQPoCyATIDU5A+ALIBMgFTYC2AsgEyAPOQPQCyATIA45A8gLIBMgCjoAwAsgEyAFOQO4CyATIAQ5A7ALIBMgAzkDqAsgEyATKALIAiIINgKgCyATIBMoAswCIgE2ApwLIBMgEzYCiAwgEyATKALEAjYCoAwgEyATKALAAjYCpAwgE0EANgLgBCATIBNBwAJqNgLsDCATIBNBlAJqNgLoDCATIBNBvAJqNgLkDCATIBNBxAJqNgLgDAJAIBBBgAFxRQ0AQX8hMkEAIQsDQEEAQQAoAgAiCUEgaiIjNgIAIAkgFE4NBCAUICMgFCAjSBshISAJQQJ0IQggCUG5893xeWwhAgNAIBMoAqALIREgCSIBQQFqIQkgEygCpAwiJCAIaiESIBMoAqAMIh0gCGohFiATKAK8AiAIaiIHKAIAIgpBGHYhACAKQf8BcSEVIApBEHZB/wFxIRcgCkEIdkH/AXEhEAJAAkACQCABQX9qQX8gAUEAIBMoApwLIgprIAEgCm0iHmxqIhtBAEobIhxBAEgNACAkIBxBAnQiHGoqAgAhDAJAIB0gHGoqAgAiDSAWKgIAXA0AIAwgEioCAFsNAQsgFSATQZQCaiANIAwQg4CAgAAiHEH/AXFrIiIgIkEfdSIicyAiayIiIBAgHEEIdkH/AXFrIiAgIEEfdSIgcyAgayIgICIgIEsbIiIgFyAcQRB2Qf8BcWsiICAgQR91IiBzICBrIiAgIiAgSxsiIiAAIBxBGHZrIhwgHEEfdSIccyAcayIcICIgHEsbQSBLDQELAkAgCUF/IBsgCkF/akgbIhxBAEgNACAkIBxBAnQiHGoqAgAhDAJAIB0gHGoqAgAiDSAWKgIAXA0AIAwgEioCAFsNAQsgFSATQZQCaiANIAwQg4CAgAAiHEH/AXFrIiIgIkEfdSIicyAiayIiIBAgHEEIdkH/AXFrIiAgIEEfdSIgcyAgayIgICIgIEsbIiIgFyAcQRB2Qf8BcWsiICAgQR91IiBzICBrIiAgIiAgSxsiIiAAIBxBGHZrIhwgHEEfdSIccyAcayIcICIgHEsbQSBLDQELAkAgASAKa0F/IB5BAEobIhxBAEgNACAkIBxBAnQiHGoqAgAhDAJAIB0gHGoqAgAiDSAWKgIAXA0AIAwgEioCAFsNAQsgFSATQZQCaiANIAwQg4CAgAAiHEH/AXFrIiIgIkEfdSIicyAiayIiIBAgHEEIdkH/AXFrIiAgIEEfdSIgcyAgayIgICIgIEsbIiIgFyAcQRB2Qf8BcWsiICAgQR91IiBzICBrIiAgIiAgSxsiIiAAIBxBGHZrIhwgHEEfdSIccyAcayIcICIgHEsbQSBLDQELQQEhHCAKIAFqQX8gHiARQX9qSBsiAUEASA0BICQgAUECdCIBaioCACEMAkAgHSABaioCACINIBYqAgBcDQAgDCASKgIAWw0CCyAVIBNBlAJqIA0gDBCDgICAACIBQf8BcWsiCiAKQR91IgpzIAprIgogECABQQh2Qf8BcWsiFiAWQR91IhZzIBZrIhYgCiAWSxsiCiAXIAFBEHZB/wFxayIWIBZBH3UiFnMgFmsiFiAKIBZLGyIKIAAgAUEYdmsiASABQR91IgFzIAFrIgEgCiABSxtBIUkNAQsgE/0MAAAAAAAAAAAAAAAAAAAAACIf/QsE8AcgEyAf/QsEoAYgE0HgDWogE0GQC2ogAkEQdiACc0Gt6qz/B2wiAUEXdiABQQh2c7hEAAAAAAAAUD6iRAAAAAAAANi/oCAbt6AgAkHrlK+veHMiAUEQdiABc0Gt6qz/B2wiAUEXdiABQQh2c7hEAAAAAAAAUD6iRAAAAAAAANi/oCAet6AgE0HwB2ogE0GgBmoQjICAgAAgE0KCgICAIDcC7A0gEyATKwO4C0QAAAAAAADgP6I5A4gOIBNBADYC0AkgE0HgDWogE0HACWpBABCNgICAACEkIBNB4A1qIBNBwAlqQQEQjYCAgAAhHSATQeANaiATQcAJakECEI2AgIAAIR4gE0HgDWogE0HACWpBAxCNgICAACEbIBNB4A1qIBNBwAlqEI6AgIAAIRwgByATQZQCaiATKgLwByATKgKgBhCDgICAACIBQRh2IABqIBNBlAJqIBMqAvQHIBMqAqQGEIOAgIAAIgpBGHZqIBNBlAJqIBMqAvgHIBMqAqgGEIOAgIAAIgBBGHZqIBNBlAJqIBMqAvwHIBMqAqwGEIOAgIAAIhZBGHZqQQVuQRh0IAFB/wFxIBVqIApB/wFxaiAAQf8BcWogFkH/AXFqQQVuciABQQh2Qf8BcSAQaiAKQQh2Qf8BcWogAEEIdkH/AXFqIBZBCHZB/wFxakEFbkEIdHIgAUEQdkH/AXEgF2ogCkEQdkH/AXFqIABBEHZB/wFxaiAWQRB2Qf8BcWpBBW5BEHRyNgIAIBwgGyAeICQgHWpqampBAWohHAsgCEEEaiEIIAJBufPd8XlqIQIgHCALaiELIAkgIUcNAAsgCyAGSA0ACyAhQX8gFCAjShshMgwDCyAQQYACcUUNAUEAKAIcIhtBAmohCSAbQQFqIVsgFyAHQeAAbGpB8ABqISBBfyEyQQAhJQNAQQBBACgCACIhQSBqIiM2AgAgISAUTg0DIBQgI0ghCiATKAK8AiEiAkACQCAbQQBODQBEAAAAAAAA4L8hGkQAAAAAAADgvyEmDAELRAAAAAAAAAAAIRpEAAAAAAAA8D8hJiBbIQgDQCAmRAAAAAAAAOA/oiImIAhBAXG4oiAaoCEaIAhBAUshASAIQQF2IQggAQ0AC0QAAAAAAAAAACEmRAAAAAAAAPA/ISggWyEIA0AgKERVVVVVVVXVP6IiKCAIQQNuIgFBfWwgCGq3oiAmoCEmIAhBAkshAiABIQggAg0ACyAmRAAAAAAAAOC/oCEmIBpEAAAAAAAA4L+gIRoLIBQgIyAKGyESQQAhACAhIQcDQCATKAKcCyEIAkBBgAFFIgENACATQcAJakEAQYAB/AsACwJAIAENACATQfAHakEAQYAB/AsACyATQeANaiATQZALaiAaIAcgByAIbSIBIAhsayICt6AgJiABt6AgE0HACWogE0HwB2oQjICAgAAgEyAIIAJrIgggEiAHayIBIAggAUgbIh02AuwNIBNBATYC8A0gE0EANgKwBgJAAkAgHUEBSA0AQQAhCANAIBNB4A1qIBNBoAZqIAgQjYCAgAAgAGohACAdIAhBAWoiCEcNAAsgE0HgDWogE0GgBmoQjoCAgAAhESATKAKgDCAHQQJ0IghqIRwgEygCpAwgCGohCyAiIAhqIR4gICAHQQR0aiEIQQAhASAdIRUDQCATQZQCaiATQcAJaiABaioCACATQfAHaiABaioCABCDgICAACEKQQAhAgJAIBsNACATQZQCaiAcIAFqKgIAIAsgAWoqAgAQg4CAgAAhAgsgCCACQf8BcSAKQf8BcWogCCgCAGoiFzYCACAIQQxqIhAgAkEYdiAKQRh2aiAQKAIAaiIQNgIAIAhBBGoiFiACQQh2Qf8BcSAKQQh2Qf8BcWogFigCAGoiFjYCACAIQQhqIiQgAkEQdkH/AXEgCkEQdkH/AXFqICQoAgBqIgI2AgAgHiABaiAWIAluQQh0IBcgCW5yIAIgCW5BEHRyIBAgCW5BGHRyNgIAIAhBEGohCCABQQRqIQEgFUF/aiIVDQALIBEgAGohAAwBCyATQeANaiATQaAGahCOgICAACAAaiEACyAdIAdqIgcgEkgNAAsgJSAhayASaiAAaiIlIAZIDQALIBJBfyAUICNKGyEyDAILQQAoAgAhMgwBCwJAIBBBCHFFDQAgCEE/akHAAG0gAUE/akHAAG0iXGwhXSBcQQZ0IV5BfyEyQQAhXwNAQQBBACgCACJgQQFqNgIAIGAgXU4NAiATKALMAiEIIBMoAsgCIWEgEyBgIFxtImJBBnQiGzYC5A0gEyBgIGIgXGxrQQZ0IiU2AuANIBMgYSAbQcAAaiIBIGEgAUgbImNBf2o2AuwNIBMgCCAlQcAAaiIBIAggAUgbIltBf2o2AugNQQAhAUEBISQDQCATQeANaiAkQX9qIgtBBHRqIhYoAgQhAiAWKAIMIQkCQAJAAkACQAJAIBYoAggiFyAWKAIAIgBrIh5BBEgNACAJIAJrIghBBEgNACAIQQFqIRAgHkEBaiEVIBZBDHIhESAWQQhyISIgFkEEciEgIBdBAWohCiAAIQgDQCATQZALaiATQdAEaiAIIBMoApwLIAJsahCNgICAACABaiATQZALaiATQdAEaiAIIBMoApwLIAlsahCNgICAAGohASAKIAhBAWoiCEcNAAsgAkEBaiIdIQgDQCATQZALaiATQdAEaiATKAKcCyAIbCAAahCNgICAACABaiATQZALaiATQdAEaiATKAKcCyAIbCAXahCNgICAAGohASAJIAhBAWoiCEcNAAsgE0GQC2ogE0HQBGogEygCnAsgEEECdiACaiIIbCAVQQJ2IABqIgpqEI2AgIAAIAFqIBNBkAtqIBNB0ARqIBMoApwLIAhsIBVBAXYgAGoiAWoQjYCAgABqIBNBkAtqIBNB0ARqIBMoApwLIAhsIBVBA2xBAnYgAGoiCGoQjYCAgABqIBNBkAtqIBNB0ARqIBMoApwLIBBBAXYgAmoiHGwgCmoQjYCAgABqIBNBkAtqIBNB0ARqIBMoApwLIBxsIAFqEI2AgIAAaiATQZALaiATQdAEaiATKAKcCyAcbCAIahCNgICAAGogE0GQC2ogE0HQBGogEygCnAsgEEEDbEECdiACaiIQbCAKahCNgICAAGogE0GQC2ogE0HQBGogEygCnAsgEGwgAWoQjYCAgABqIBNBkAtqIBNB0ARqIBMoApwLIBBsIAhqEI2AgIAAaiATQZALaiATQdAEahCOgICAAGohASATKAKkDCIUIBMoApwLIhwgAmwiCEECdCIKaiAAQQJ0IgdqKgIAIQ0gEygCoAwhECATKwPwC0QAAAAAAAAAAGQNASAQIAogB2pqIR4gHEECdCESIAIhBwNAIBUhCiAeIQgDQAJAIAgqAgAiDEMAAAAAWw0AIAxDAMB5xFwNBgsgCEEEaiEIIApBf2oiCg0ACyAeIBJqIR4gByAJRyEIIAdBAWohByAIDQAMAwsLAkAgCSACSA0AIBcgAEgNACAXQQFqIQoDQCAAIQgDQCATQZALaiATQdAEaiAIIAIgEygCnAtsahCNgICAACABaiEBIAogCEEBaiIIRw0ACyACIAlGIQggAkEBaiECIAhFDQALCyATQZALaiATQdAEahCOgICAACABaiEBIAshJAwDCyAcQQJ0ISEgHkEBaiEjIBAgACAIakECdCIIaiEeIBQgCGohByACIRIDQCAeIQggByEKICMhFQNAAkAgCCoCACIMQwAAAABbDQAgDEMAwHnEXA0EIAoqAgAgDVwNBAsgCEEEaiEIIApBBGohCiAVQX9qIhUNAAsgHiAhaiEeIAcgIWohByASIAlGIQggEkEBaiESIAhFDQALCyAAQQFqIh4gFyAAQX9zaiIHQXxxIhJqISIgAEECaiEgIBQgHEECdCIkIB1sIghqIRUgECAIaiEWIAdBAXEhESAe/RH9DAAAAAABAAAAAgAAAAMAAAD9rgEhLSAXQX5qIABGIQADQCAdIBxsIQgCQAJAIBMrA/ALRAAAAAAAAAAAZQ0AAkACQCARDQAgHiEIDAELAkAgECAeIAhqQQJ0IghqIgIqAgBDAAAAAFwNACACQYCA56N8NgIAIBQgCGogDTgCACABQQFqIQELICAhCAsgAA0BIBcgCGshCiAIQQJ0IQgDQAJAIBYgCGoiAioCAEMAAAAAXA0AIAJBgIDno3w2AgAgFSAIaiANOAIAIAFBAWohAQsCQCACQQRqIgIqAgBDAAAAAFwNACACQYCA56N8NgIAIBUgCGpBBGogDTgCACABQQFqIQELIAhBCGohCCAKQX5qIgoNAAwCCwsCQAJAIAdBBE8NACAeIQgMAQv9DAAAAAAAAAAAAAAAAAAAAAAgAf0cACEqIAj9ESErIBIhCCAtISwDQAJAIBAgLCAr/a4BIin9GwBBAnRqIgH9AAIA/QwAAAAAAAAAAAAAAAAAAAAA/UEiH/0bAEEBcUUNACABQYCA56N8NgIACwJAIB/9GwFBAXFFDQAgECAp/RsBQQJ0akGAgOejfDYCAAsCQCAf/RsCQQFxRQ0AIBAgKf0bAkECdGpBgIDno3w2AgALAkAgH/0bA0EBcUUNACAQICn9GwNBAnRqQYCA56N8NgIACyAs/QwEAAAABAAAAAQAAAAEAAAA/a4BISwgKiAf/bEBISogCEF8aiIIDQALICogKiAf/Q0ICQoLDA0ODwABAgMAAQID/a4BIh8gHyAf/Q0EBQYHAAECAwABAgMAAQID/a4B/RsAIQEgIiEIIAcgEkYNAQsgFyAIayECIBYgCEECdGohCANAAkAgCCoCAEMAAAAAXA0AIAhBgIDno3w2AgAgAUEBaiEBCyAIQQRqIQggAkF/aiICDQALCyAVICRqIRUgFiAkaiEWIB1BAWoiHSAJRw0ACyALISQMAQsgICAdNgIAIBYgAEEBaiIVNgIAICIgFyAAakECbSIKNgIAIBEgCSACakECbSICNgIAIBNB4A1qICRBBHRqIgggAjYCDCAIIBdBf2oiADYCCCAIIB02AgQgCCAKQQFqIhc2AgAgCEEcaiAJQX9qIgk2AgAgCEEYaiAKNgIAIAhBFGogAkEBaiICNgIAIAhBEGogFTYCACAIQSxqIAk2AgAgCEEoaiAANgIAIAhBJGogAjYCACAIQSBqIBc2AgAgJEEDaiEkCyAkQQBKDQALAkAgYSAbTA0AIGBBBnQiCCBeIGJsIgJrIRUgWyACaiAIayEXIBMoAuQMIRAgEygC7AwhFiATKALoDCEAIBMoAuAMISQDQAJAIBMoAswCIBtsIgggJWogCCBbak4NACAkKAIAIBUgCGpBAnQiCmohCCAWKAIAIApqIQIgECgCACAKaiEKIBchCQNAIAogACAIKgIAIgwgAioCABCDgICAADYCAAJAIAxDAMB5xFsNACAMQyIAgD9eDQAgCEGAgID8AzYCAAsgCEEEaiEIIAJBBGohAiAKQQRqIQogCUF/aiIJDQALCyAbQQFqIhsgY0cNAAsLIAEgX2oiXyAGSA0AC0F/IBMoAswCIGNsIGAgXUF/akYbITIMAQsCQCAQQRBxRQ0AQQBBACgCACIkQSBqNgIAAkAgJCAIQQFqQQJtIAFBAWpBAm1sIAhBA2pBBG0gAUEDakEEbWwgCEEHakEIbSABQQdqQQhtbGpqIBRqIiFIDQBBfyEyDAILQQAhHANAICEgJEEgaiIjICEgI0gbISACQCAhICRMDQAgE0HgDWohCSATQcAJaiEAICQhCANAQQghASAIIQICQAJAIAggEygCyAIiF0EHakEIbSATKALMAiIVQQdqQQhtIgpsIhBIDQBBBCEBIAggEGsiAiAXQQNqQQRtIBVBA2pBBG0iCmwiFkgNAEECIQEgCCAQIBZqIhBrIgIgF0EBakECbSAVQQFqQQJtIgpsIhZIDQAgAEEBNgIAIAggECAWamsiAUF/IAEgFyAVbEgbIQEMAQsgACABNgIAIAIgCm0iFyAVbCACIBcgCmxraiABbCEBCyAJIAE2AgAgAEEEaiEAIAlBBGohCSATQZALaiATQdAEaiABEI2AgIAAIBxqIRwgICAIQQFqIghHDQALCyATQZALaiATQdAEahCOgICAACAcaiEcAkAgICAkayILQQFIDQAgEygC5AwoAgAhByATKALsDCgCACESIBMoAuAMKAIAIRFBACEbIBMoAugMISIDQCAHIBNB4A1qIBtBAnQiCGooAgAiAkECdCIWaiAiIBEgFmoiASoCACIMIBIgFmoqAgAQg4CAgAA2AgACQCAMQwDAecRbDQAgDEMiAIA/Xg0AIAFBgICA/AM2AgALAkAgEygCyAIgAiATKALMAiIBbSIJayIKIBNBwAlqIAhqKAIAIgggCiAISBsiJEEBSA0AIAkgAWwgAmsgAWoiAUEBSA0AIBMoAsQCIQogASAIIAEgCEgbIh1BfnEhECAdQQFxIR5BACEJA0AgEygCvAIiFSAWaiEXQQAhCAJAAkAgHUEBRg0AQQAhCANAAkAgCiACIAhqIBMoAswCIAlsIgFqQQJ0IgBqKgIAQwAAAABcDQAgFSAAaiAXKAIANgIAIBMoAswCIAlsIQELAkAgCiACIAFqIAhqQQFqQQJ0IgFqKgIAQwAAAABcDQAgFSABaiAXKAIANgIACyAQIAhBAmoiCEcNAAsgHkUNAQsgCiAIIAJqIBMoAswCIAlsakECdCIIaioCAEMAAAAAXA0AIBUgCGogFygCADYCAAsgCUEBaiIJICRHDQALCyAbQQFqIhsgC0cNAAsLAkAgHCAGSA0AQX8hMiAhICNMDQMgIKwgFKx+ICGsf6chMgwDC0EAQQAoAgAiJEEgajYCACAkICFIDQALQX8hMgwBCyATQcCtCjYCwAkgCEF/aiEJIAFBf2ohAEEIIQEDQCABIghBAXQhASAJIAhqIAhtIgIgACAIaiAIbSIKbEGAgBBKDQALIBMgCDYC8AcgEyAKNgKgBiATIAI2AtADIAogAiAKIAJKGyECQQIhAQNAIAEiCEEBdCEBIAggAkgNAAsgEyAINgLQAiATIBNBwAlqNgKEDiATIBNB4AxqNgKADiATIBNB0ARqNgL8DSATIBNBkAtqNgL4DSATIBNByAJqNgL0DSATIBNBzAJqNgLwDSATIBNB8AdqNgLsDSATIBNB0ANqNgLoDSATIBNBoAZqNgLkDSATIBNB0AJqNgLgDSAIIAhsIRsCQAJAAkACQCAQQcAAcUUNACASQYACIBJBgAJIGyEVAkBBACgCGEECRg0AQQBBACgCGCIIQQEgCBs2AhggCA0CAkAgEkEBSA0AIBVBASAVQQFKG60hWiAVrSFkIButIWVBwK3KACEIQgAhMwNAIDMgZIAhZiAIIGUgM3wiMyBkgEIghiBmQv////8Pg4Q3AwAgCEEIaiEIIFpCf3wiWlBFDQALC0EAQQI2AhgLIBFBA3RBwK3KAGpBACAVIBFKGyEAIBJBAUghEEEAIRYDQAJAAkAgAEUNACAAKQMAIlqnIFpCIIinTw0AAkADQCAAIFpCAXxC/////w+DIFpCgICAgHCDhCAAKQMAIjMgMyBaUSIIGzcDACAIDQEgMyFaIDOnIDNCIIinSQ0ADAILCyBapyIJQX9KDQELAkAgEEUNAEF/ITIMBwtCACFaQQAhAUF/IQJBACEIAkADQAJAAkAgCEEDdEHArcoAaikDACJkQiCIpyIKIGSnIglLDQAgWiEzDAELIFohMyAKIAlrIgogAU0NACBkITMgCiEBIAghAgsgMyFaIAhBAWoiCCAVRw0AAkAgAkEASA0AIAJBA3QiCCAzQiCIpyABQQFqQQF2QQEgABsiF2siCa1CIIYgM0L/////D4OEIAgpA8CtSiJaIFogM1EiChs3A8CtSkF/IQJBACEBQQAhCEIAIVogCg0CDAELC0F/ITIMBwsCQCAXQQJJDQAgACAzQoCAgIBwgyAJQQFqrYQ3AwALIAlBAE4NAEF/ITIMBgsgE0HgDWogCRCPgICAACAWaiIWIAZIDQALAkAgEkEBTg0AQX8hMgwFCyAVQQEgFUEBShshAUEAIRdBwK3KACEIIBMoAtADIRUgEygCoAYhACATKALQAiEQQQAhCQNAAkAgCCkDACIzQiCIpyICIDOnIgpMDQAgECACIAAgFRCQgICAACAXaiAQIAogACAVEJCAgIAAayEXIAkgCmsgAmohCQsgCEEIaiEIIAFBf2oiAUUNBAwACwsgEEEgcQ0BQQAhCgNAQQBBACgCACIXQSBqIhA2AgACQAJAIBQgF0wNACAUIBAgFCAQSBshACAXIQgDQCATQZALaiATQdAEaiAIEI2AgIAAIApqIQogACAIQQFqIghHDQALIAAgF2shCSATQZALaiATQdAEahCOgICAACEWIBMoAuAMKAIAIBdBAnQiAmohCCATKALsDCgCACACaiEBIBMoAuQMKAIAIAJqIQIgEygC6AwhFQNAIAIgFSAIKgIAIgwgASoCABCDgICAADYCAAJAIAxDAMB5xFsNACAMQyIAgD9eDQAgCEGAgID8AzYCAAsgCEEEaiEIIAFBBGohASACQQRqIQIgCUF/aiIJDQALIBQgF0oNAUF/ITIMBgsgE0GQC2ogE0HQBGoQjoCAgAAaQX8hMgwFCyAWIApqIgogBkgNAAsgAEF/IBQgEEobITIMAwtBACgCACEyDAILIAZBBG0iCEGAgMAAIAhBgIDAAEgbIQdBfyEyIAZBfUghEkEAISQDQEEAKAIAIhAgG04NAiATKALQAyEcIBMoAsAJIQsgEygCoAYhHQJAAkAgEygC0AIiAkECSA0AA0ACQAJAIBBBA3ENAEEBIQhBACEAQQAhCiAQIQEDQCABQQF2IhVBAXEhCQJAAkAgFSABc0EBcSIVRQ0AIAAhFwwBCwJAIAkNACAKIRcgACEKDAELIAhBf2oiFiAKayEXIBYgAGshCgsgAUECdSEBIAogFSAIbGohCiAXIAkgCGxqIQAgCEEBdCIIIAJIDQALQQAhFUEAIR4CQCAAIB1ODQBBACEeIAogHE4NACALIAogHWwgAGpBAnRqKAIAIR4LQQEhCCAQQQFyIQFBACEKA0AgAUEBdiIAQQFxIQkCQAJAIAAgAXNBAXEiAEUNACAVIRcMAQsCQCAJDQAgCiEXIBUhCgwBCyAIQX9qIhYgCmshFyAWIBVrIQoLIAFBAnUhASAKIAAgCGxqIQogFyAJIAhsaiEVIAhBAXQiCCACSA0ACwJAIBUgHU4NACAKIBxODQAgCyAKIB1sIBVqQQJ0aigCACAeaiEeCyAQQQJyIQFBASEIQQAhAEEAIQoDQCABQQF2IhVBAXEhCQJAAkAgFSABc0EBcSIVRQ0AIAAhFwwBCwJAIAkNACAKIRcgACEKDAELIAhBf2oiFiAKayEXIBYgAGshCgsgAUECdSEBIAogFSAIbGohCiAXIAkgCGxqIQAgCEEBdCIIIAJIDQALAkAgACAdTg0AIAogHE4NACALIAogHWwgAGpBAnRqKAIAIB5qIR4LIBBBA3IhAUEBIQhBACEAQQAhCgNAIAFBAXYiFUEBcSEJAkACQCAVIAFzQQFxIhVFDQAgACEXDAELAkAgCQ0AIAohFyAAIQoMAQsgCEF/aiIWIAprIRcgFiAAayEKCyABQQJ1IQEgCiAVIAhsaiEKIBcgCSAIbGohACAIQQF0IgggAkgNAAsCQCAAIB1ODQAgCiAcTg0AIAsgCiAdbCAAakECdGooAgAgHmohHgtBBCEIIB4gB0wNAQtBASEIC0EAIAggEGoiCEEAKAIAIgEgASAQRiIKGzYCACAKDQIgASEQIAEgG0gNAAwFCwsCQCAdQQFIDQAgHEEBSA0AA0ACQAJAIBBBA3ENAEEEIQggCygCACIBIAFqIgEgAWogB0wNAQtBASEIC0EAIAggEGoiCEEAKAIAIgEgASAQRiICGzYCACACDQIgASEQIAEgG0gNAAwFCwsCQCASRQ0AA0BBACAQQQFqIghBACgCACIBIAEgEEYiAhs2AgAgAg0CIAEhECABIBtIDQAMBQsLA0BBAEEBQQQgEEEDcRsgEGoiCEEAKAIAIgEgASAQRhs2AgAgASAQRg0BIAEhECABIBtIDQAMBAsLA0AgE0HgDWogEBCPgICAACAkaiEkIBBBAWoiECAISA0ACyAkIAZIDQALIAggG04NASATKALQAiAIIBMoAqAGIgEgEygC0AMiAhCQgICAAK0gFKx+IAIgAWysf6chMgwBCwJAIAkNAEF/ITIMAQsgFSAAbCIIIBdrrCAUrH4gCKx/pyEyCyATQeARaiSAgICAACAyC/IDBAN/AXwBewV/QQEhAQJAQR5BACgCCCICIAJBYWpBYkkbIgNBAkkNACAAQQhqIQJBASEBA0AgAikDAEIAUg0BIAJBCGohAiADIAFBAWoiAUcNAAsgAyEBCyAAIAFBA3RqIgJBCGopAwC6RAAAAAAAAPA7oiACKQMAuqAhBAJAIAFBAkkNAEEBIQICQCABQQJGDQD9DAAAAAAAAAAAAAAAAAAA8D8gBP0iACEFIAFBf2oiBkF+cSIHQX5qIghBAXYhCQJAIAhBDkkNACAJQXlqIgNBA3ZBAWoiCkEHcSECAkAgA0E4SQ0AIApB+P///wNxIQMDQCADQXhqIgMNAAv9DAAAAAAAAAAAAAAAAAAAAAAhBQsCQCACDQD9DAAAAAAAAAAAAAAAAAAAAAAhBQwBCwNAIAX9DAAAAAAAAPAfAAAAAAAA8B/98gEhBSACQX9qIgINAAsLAkAgCEEOcUEORg0AIAlBAWpBB3EhAgNAIAX9DAAAAAAAAPA7AAAAAAAA8Dv98gEhBSACQX9qIgINAAsLIAUgBSAF/Q0ICQoLDA0ODwABAgMEBQYH/fIB/SEAIQQgBiAHRg0BIAZBAXIhAgsgASACayECA0AgBEQAAAAAAADwO6IhBCACQX9qIgINAAsLIASaIAQgACkDAEIBURsLixsFCX8BewN+AX8EfiOAgICAAEGgBmsiAySAgICAAEEAIQQCQAJAQR5BACgCCCIFIAVBYWpBYkkbIgZBAWoiB0ECSQ0AAkACQAJAIAdBfnEiBEF+aiIIDQBBACEJDAELIAZBA3QgAGpBcGohBSAIQQF2QQFqQf7///8HcSIKQQF0IQkgA0GYBGohCwNAIAtBEGogBf0AAwAgDP0NCAkKCwwNDg8AAQIDBAUGB/0LAwAgCyAFQRBq/QADACAM/Q0ICQoLDA0ODwABAgMEBQYH/QsDACAFQWBqIQUgC0EgaiELIApBfmoiCg0ACyAIQQJxDQELIANBmARqIAlBA3RqIAAgByAJa0EDdGpBeGr9AAMAIAz9DQgJCgsMDQ4PAAECAwQFBgf9CwMACyAHIARGDQELIAZBA3QgBEEDdCILayAAakEIaiEFIAYgBGtBAWohCiADQZgEaiALaiELA0AgCyAFKQMANwMAIAVBeGohBSALQQhqIQsgCkF/aiIKDQALCyADIAApAwA3A5gGQQAhBAJAAkAgB0ECSQ0AAkACQAJAIAdBfnEiBEF+aiIIDQBBACEJDAELIAZBA3QgAWpBcGohBSAIQQF2QQFqQf7///8HcSIKQQF0IQkgA0GQAmohCwNAIAtBEGogBf0AAwAgDP0NCAkKCwwNDg8AAQIDBAUGB/0LAwAgCyAFQRBq/QADACAM/Q0ICQoLDA0ODwABAgMEBQYH/QsDACAFQWBqIQUgC0EgaiELIApBfmoiCg0ACyAIQQJxDQELIANBkAJqIAlBA3RqIAEgByAJa0EDdGpBeGr9AAMAIAz9DQgJCgsMDQ4PAAECAwQFBgf9CwMACyAHIARGDQELIAZBA3QgBEEDdCILayABakEIaiEFIAYgBGtBAWohCiADQZACaiALaiELA0AgCyAFKQMANwMAIAVBeGohBSALQQhqIQsgCkF/aiIKDQALCyADIAEpAwA3A5AEIANBmARqIANBkAJqIAYQkYCAgAACQAJAAkACQCACDgQDAAECAwsgA0IANwOQBAwCCyADQgA3A5gGDAELIAMgAykDkARCAYU3A5AEC0EAIQQCQAJAIAdBAkkNAAJAAkACQCAHQX5xIgRBfmoiCQ0AQQAhAgwBCyAGQQN0QcCNCmohBSAJQQF2QQFqQf7///8HcSIKQQF0IQIgA0EIaiELA0AgCyAF/QADACAM/Q0ICQoLDA0ODwABAgMEBQYH/QsDACALQRBqIAVBcGr9AAMAIAz9DQgJCgsMDQ4PAAECAwQFBgf9CwMAIAVBYGohBSALQSBqIQsgCkF+aiIKDQALIAlBAnENAQsgA0EIaiACQQN0aiAHIAJrQQN0QbiNCmr9AAMAIAz9DQgJCgsMDQ4PAAECAwQFBgf9CwMACyAHIARGDQELIAZBA3QgBEEDdCILa0HIjQpqIQUgBiAEa0EBaiEKIANBCGogC2ohCwNAIAsgBSkDADcDACAFQXhqIQUgC0EIaiELIApBf2oiCg0ACwtBACEKIANBACkDwI0KIg03A4gCAkACQAJAAkACQAJAAkACQAJAIA0gAykDmAYiDlINACAGDQFCACEPDAYLIAYhBQJAIAZBAUgNACADQZgEaiAGQQN0IgVqIQsgA0EIaiAFaiEKIAYhBQNAIAspAwAgCikDAFINASALQXhqIQsgCkF4aiEKIAVBAUohBCAFQX9qIQUgBA0AC0EAIQULIANBmARqIANBCGogA0GYBGogBUEDdCIFaikDACADQQhqIAVqKQMAVCIJGyEIIANBCGogA0GYBGogCRshECAGDQFCACEPQQAhBAwCCyAHQX5xIQJBACEKQgAhDyADQQhqIQsgA0GYBGohBQNAIAUgBSkDACIRIA98Ig8gCykDAHwiEjcDACAFQQhqIgQgDyARVK0gEiAPVK18IhEgBCkDAHwiDyALQQhqKQMAfCISNwMAIA8gEVStIBIgD1StfCEPIAVBEGohBSALQRBqIQsgAiAKQQJqIgpHDQAMBAsLIAdBfnEhAkEAIQRCACEPIANBmARqIQUgECELIAghCgNAIAUgCykDACISIA8gCikDAHwiEX03AwAgBUEIaiALQQhqKQMAIhMgESAPVK0gEiARVK19QgGDIhEgCkEIaikDAHwiD303AwAgDyARVK0gEyAPVK18QgGDIQ8gC0EQaiELIApBEGohCiAFQRBqIQUgAiAEQQJqIgRHDQALIAZBAXENAQsgA0GYBGogBEEDdCIFaiAQIAVqKQMAIA8gCCAFaikDAHx9NwMACyANIA4gCRshDQwDCyAGQQFxDQELIANBmARqIApBA3QiBWoiCyALKQMAIA98IANBCGogBWopAwB8NwMACyADKQOYBiENCyADIA03A5gGQQAhBAJAAkAgB0ECSQ0AAkACQAJAIAdBfnEiBEF+aiIJDQBBACECDAELIAZBA3RBwI8KaiEFIAlBAXZBAWpB/v///wdxIgpBAXQhAiADQQhqIQsDQCALIAX9AAMAIAz9DQgJCgsMDQ4PAAECAwQFBgf9CwMAIAtBEGogBUFwav0AAwAgDP0NCAkKCwwNDg8AAQIDBAUGB/0LAwAgBUFgaiEFIAtBIGohCyAKQX5qIgoNAAsgCUECcQ0BCyADQQhqIAJBA3RqIAcgAmtBA3RBuI8Kav0AAwAgDP0NCAkKCwwNDg8AAQIDBAUGB/0LAwALIAcgBEYNAQsgBkEDdCAEQQN0IgtrQciPCmohBSAGIARrQQFqIQogA0EIaiALaiELA0AgCyAFKQMANwMAIAVBeGohBSALQQhqIQsgCkF/aiIKDQALC0EAIQogA0EAKQPAjwoiDjcDiAICQAJAAkACQAJAAkACQAJAAkAgDiADKQOQBCIUUg0AIAYNAUIAIQ8MBgsgBiEFAkAgBkEBSA0AIANBkAJqIAZBA3QiBWohCyADQQhqIAVqIQogBiEFA0AgCykDACAKKQMAUg0BIAtBeGohCyAKQXhqIQogBUEBSiEEIAVBf2ohBSAEDQALQQAhBQsgA0GQAmogA0EIaiADQZACaiAFQQN0IgVqKQMAIANBCGogBWopAwBUIgkbIQggA0EIaiADQZACaiAJGyEQIAYNAUIAIQ9BACEEDAILIAdBfnEhAkEAIQpCACEPIANBCGohCyADQZACaiEFA0AgBSAFKQMAIhEgD3wiDyALKQMAfCISNwMAIAVBCGoiBCAPIBFUrSASIA9UrXwiESAEKQMAfCIPIAtBCGopAwB8IhI3AwAgDyARVK0gEiAPVK18IQ8gBUEQaiEFIAtBEGohCyACIApBAmoiCkcNAAwECwsgB0F+cSECQQAhBEIAIQ8gA0GQAmohBSAQIQsgCCEKA0AgBSALKQMAIhIgDyAKKQMAfCIRfTcDACAFQQhqIAtBCGopAwAiEyARIA9UrSASIBFUrX1CAYMiESAKQQhqKQMAfCIPfTcDACAPIBFUrSATIA9UrXxCAYMhDyALQRBqIQsgCkEQaiEKIAVBEGohBSACIARBAmoiBEcNAAsgBkEBcQ0BCyADQZACaiAEQQN0IgVqIBAgBWopAwAgDyAIIAVqKQMAfH03AwALIA4gFCAJGyEPDAMLIAZBAXENAQsgA0GQAmogCkEDdCIFaiILIAspAwAgD3wgA0EIaiAFaikDAHw3AwALIAMpA5AEIQ8LIAAgDTcDACADIA83A5AEQQAhBAJAAkAgB0ECSQ0AAkACQAJAIAdBfnEiBEF+aiIJDQBBACECDAELIAZBA3QgAGpBcGohBSAJQQF2QQFqQf7///8HcSIKQQF0IQIgA0GYBGohCwNAIAVBEGogC/0AAwAgDP0NCAkKCwwNDg8AAQIDBAUGB/0LAwAgBSALQRBq/QADACAM/Q0ICQoLDA0ODwABAgMEBQYH/QsDACALQSBqIQsgBUFgaiEFIApBfmoiCg0ACyAJQQJxDQELIAAgByACa0EDdGpBeGogA0GYBGogAkEDdGr9AAMAIAz9DQgJCgsMDQ4PAAECAwQFBgf9CwMACyAHIARGDQELIAZBA3QgBEEDdCILayAAakEIaiEFIAYgBGtBAWohCiADQZgEaiALaiELA0AgBSALKQMANwMAIAtBCGohCyAFQXhqIQUgCkF/aiIKDQALCyABIA83AwBBACEEAkACQCAHQQJJDQACQAJAAkAgB0F+cSIEQX5qIgANAEEAIQIMAQsgBkEDdCABakFwaiEFIABBAXZBAWpB/v///wdxIgpBAXQhAiADQZACaiELA0AgBUEQaiAL/QADACAM/Q0ICQoLDA0ODwABAgMEBQYH/QsDACAFIAtBEGr9AAMAIAz9DQgJCgsMDQ4PAAECAwQFBgf9CwMAIAtBIGohCyAFQWBqIQUgCkF+aiIKDQALIABBAnENAQsgASAHIAJrQQN0akF4aiADQZACaiACQQN0av0AAwAgDP0NCAkKCwwNDg8AAQIDBAUGB/0LAwALIAcgBEYNAQsgBkEDdCAEQQN0IgtrIAFqQQhqIQUgBiAEa0EBaiEKIANBkAJqIAtqIQsDQCAFIAspAwA3AwAgC0EIaiELIAVBeGohBSAKQX9qIgoNAAsLIANBoAZqJICAgIAAC6A2CAl/AXsBfgt/BX4DfwJ+A38jgICAgABBwBJrIgMkgICAgABBACEEAkACQEEeQQAoAggiBSAFQWFqQWJJGyIGQQFqIgdBAkkNAAJAAkACQCAHQX5xIgRBfmoiCA0AQQAhCQwBCyAGQQN0IABqQXBqIQUgCEEBdkEBakH+////B3EiCkEBdCEJIANBkAJqIQsDQCALQRBqIAX9AAMAIAz9DQgJCgsMDQ4PAAECAwQFBgf9CwMAIAsgBUEQav0AAwAgDP0NCAkKCwwNDg8AAQIDBAUGB/0LAwAgBUFgaiEFIAtBIGohCyAKQX5qIgoNAAsgCEECcQ0BCyADQZACaiAJQQN0aiAAIAcgCWtBA3RqQXhq/QADACAM/Q0ICQoLDA0ODwABAgMEBQYH/QsDAAsgByAERg0BCyAGQQN0IARBA3QiC2sgAGpBCGohBSAGIARrQQFqIQogA0GQAmogC2ohCwNAIAsgBSkDADcDACAFQXhqIQUgC0EIaiELIApBf2oiCg0ACwsgAyAAKQMANwOQBEEAIQQCQAJAIAdBAkkNAAJAAkACQCAHQX5xIgRBfmoiCA0AQQAhCQwBCyAGQQN0IAFqQXBqIQUgCEEBdkEBakH+////B3EiCkEBdCEJIANBCGohCwNAIAtBEGogBf0AAwAgDP0NCAkKCwwNDg8AAQIDBAUGB/0LAwAgCyAFQRBq/QADACAM/Q0ICQoLDA0ODwABAgMEBQYH/QsDACAFQWBqIQUgC0EgaiELIApBfmoiCg0ACyAIQQJxDQELIANBCGogCUEDdGogASAHIAlrQQN0akF4av0AAwAgDP0NCAkKCwwNDg8AAQIDBAUGB/0LAwALIAcgBEYNAQsgBkEDdCAEQQN0IgtrIAFqQQhqIQUgBiAEa0EBaiEKIANBCGogC2ohCwNAIAsgBSkDADcDACAFQXhqIQUgC0EIaiELIApBf2oiCg0ACwsgAyABKQMAIg03A4gCAkBBiAJFIgUNACADQaAGaiADQZACakGIAvwKAAALAkAgBQ0AIANBmARqIANBCGpBiAL8CgAAC0EBIQUDQCAFIghBAXQiBSACTA0ACwJAIAhBAkgNACAGQQFxIQ4gB0F+cSEFIAdBA3QhDyADQbAKaiAGQQN0IgtqIRAgA0G4DGogC2ohESADQagIaiALaiESIANBCGogC2ohEyADQZACaiALaiEUIANBoAZqIAtqIRUgA0GYBGogC2ohFiADQcAOaiALaiEXA0AgA0GgBmogA0GYBGogBhCRgICAAAJAIAhBAXYiGCACcUUNAAJAAkAgAykDoAgiGSADKQOYBiIaUg0AAkACQCAGDQBCACEbQQAhCQwBC0EAIQlCACEbIANBuAxqIQsgA0GYBGohCiADQaAGaiEEA0AgCyAEKQMAIhwgG3wiGyAKKQMAfCIdNwMAIAtBCGogGyAcVK0gHSAbVK18IhwgBEEIaikDAHwiGyAKQQhqKQMAfCIdNwMAIBsgHFStIB0gG1StfCEbIARBEGohBCAKQRBqIQogC0EQaiELIAUgCUECaiIJRw0ACyAODQILIANBuAxqIAlBA3QiC2ogA0GgBmogC2opAwAgG3wgA0GYBGogC2opAwB8NwMADAELIBUhCiAWIQQgBiELAkAgBkEBSA0AA0AgCikDACAEKQMAUg0BIApBeGohCiAEQXhqIQQgC0EBSiEJIAtBf2ohCyAJDQALQQAhCwsgA0GgBmogA0GYBGogA0GgBmogC0EDdCILaikDACADQZgEaiALaikDAFQiHhshHyADQZgEaiADQaAGaiAeGyEgAkACQAJAIAYNAEIAIRtBACEJDAELQQAhCUIAIRsgA0G4DGohCyAgIQogHyEEA0AgCyAKKQMAIh0gGyAEKQMAfCIcfTcDACALQQhqIApBCGopAwAiISAcIBtUrSAdIBxUrX1CAYMiHCAEQQhqKQMAfCIbfTcDACAbIBxUrSAhIBtUrXxCAYMhGyAKQRBqIQogBEEQaiEEIAtBEGohCyAFIAlBAmoiCUcNAAsgDg0BCyADQbgMaiAJQQN0IgtqICAgC2opAwAgGyAfIAtqKQMAfH03AwALIBogGSAeGyEaCyADIBo3A7gOIANBkAJqIANBuAxqIANBwA5qIAcQkoCAgAACQCAPRSIeDQAgA0G4DGogFyAP/AoAAAsgAyADKQOQBCIZIAMpA7gOUiIfrSIaNwO4DgJAAkAgDSAZQgGFIiJSDQACQAJAIAYNAEIAIRtBACEJDAELQQAhCUIAIRsgA0GwCmohCyADQZACaiEKIANBCGohBANAIAsgBCkDACIcIBt8IhsgCikDAHwiHTcDACALQQhqIBsgHFStIB0gG1StfCIcIARBCGopAwB8IhsgCkEIaikDAHwiHTcDACAbIBxUrSAdIBtUrXwhGyAEQRBqIQQgCkEQaiEKIAtBEGohCyAFIAlBAmoiCUcNAAsgDSEcIA4NAgsgA0GwCmogCUEDdCILaiADQQhqIAtqKQMAIBt8IANBkAJqIAtqKQMAfDcDACANIRwMAQsgEyEKIBQhBCAGIQsCQCAGQQFIDQADQCAKKQMAIAQpAwBSDQEgCkF4aiEKIARBeGohBCALQQFKIQkgC0F/aiELIAkNAAtBACELCyADQQhqIANBkAJqIANBCGogC0EDdCILaikDACADQZACaiALaikDAFQiIBshIyADQZACaiADQQhqICAbISQCQAJAAkAgBg0AQgAhG0EAIQkMAQtBACEJQgAhGyADQbAKaiELICQhCiAjIQQDQCALIAopAwAiHSAbIAQpAwB8Ihx9NwMAIAtBCGogCkEIaikDACIhIBwgG1StIB0gHFStfUIBgyIcIARBCGopAwB8Iht9NwMAIBsgHFStICEgG1StfEIBgyEbIApBEGohCiAEQRBqIQQgC0EQaiELIAUgCUECaiIJRw0ACyAODQELIANBsApqIAlBA3QiC2ogJCALaikDACAbICMgC2opAwB8fTcDAAsgIiANICAbIRwLIAMgHDcDsAwgA0GgBmogA0GwCmogA0HADmogBxCSgICAAAJAIB4NACADQbAKaiAXIA/8CgAACyADIAMpA6AIIAMpA7AMUiIgrSIiNwOwDAJAAkAgGSANUg0AAkACQCAGDQBCACEbQQAhCQwBC0EAIQlCACEbIANBqAhqIQsgA0EIaiEKIANBkAJqIQQDQCALIAQpAwAiHCAbfCIbIAopAwB8Ih03AwAgC0EIaiAbIBxUrSAdIBtUrXwiHCAEQQhqKQMAfCIbIApBCGopAwB8Ih03AwAgGyAcVK0gHSAbVK18IRsgBEEQaiEEIApBEGohCiALQRBqIQsgBSAJQQJqIglHDQALIA0hHCAODQILIANBqAhqIAlBA3QiC2ogA0GQAmogC2opAwAgG3wgA0EIaiALaikDAHw3AwAgDSEcDAELIBQhCiATIQQgBiELAkAgBkEBSA0AA0AgCikDACAEKQMAUg0BIApBeGohCiAEQXhqIQQgC0EBSiEJIAtBf2ohCyAJDQALQQAhCwsgA0GQAmogA0EIaiADQZACaiALQQN0IgtqKQMAIANBCGogC2opAwBUIiMbISQgA0EIaiADQZACaiAjGyElAkACQAJAIAYNAEIAIRtBACEJDAELQQAhCUIAIRsgA0GoCGohCyAlIQogJCEEA0AgCyAKKQMAIh0gGyAEKQMAfCIcfTcDACALQQhqIApBCGopAwAiISAcIBtUrSAdIBxUrX1CAYMiHCAEQQhqKQMAfCIbfTcDACAbIBxUrSAhIBtUrXxCAYMhGyAKQRBqIQogBEEQaiEEIAtBEGohCyAFIAlBAmoiCUcNAAsgDg0BCyADQagIaiAJQQN0IgtqICUgC2opAwAgGyAkIAtqKQMAfH03AwALIA0gGSAjGyEcCyADIBw3A6gKIANBmARqIANBqAhqIANBwA5qIAcQkoCAgAACQCAeDQAgA0GoCGogFyAP/AoAAAsgAyADKQOYBiADKQOoClKtIhs3A6gKAkACQCAbQgGFIhkgGlINAAJAAkAgBg0AQgAhG0EAIQkMAQtBACEJQgAhGyADQaAGaiELIANBqAhqIQogA0G4DGohBANAIAsgBCkDACIcIBt8IhsgCikDAHwiHTcDACALQQhqIBsgHFStIB0gG1StfCIcIARBCGopAwB8IhsgCkEIaikDAHwiHTcDACAbIBxUrSAdIBtUrXwhGyAEQRBqIQQgCkEQaiEKIAtBEGohCyAFIAlBAmoiCUcNAAsgGiEcIA4NAgsgA0GgBmogCUEDdCILaiADQbgMaiALaikDACAbfCADQagIaiALaikDAHw3AwAgGiEcDAELIBEhCiASIQQgBiELAkAgBkEBSA0AA0AgCikDACAEKQMAUg0BIApBeGohCiAEQXhqIQQgC0EBSiEJIAtBf2ohCyAJDQALQQAhCwsgA0G4DGogA0GoCGogA0G4DGogC0EDdCILaikDACADQagIaiALaikDAFQiHhshIyADQagIaiADQbgMaiAeGyEkAkACQAJAIAYNAEIAIRtBACEJDAELQQAhCUIAIRsgA0GgBmohCyAkIQogIyEEA0AgCyAKKQMAIh0gGyAEKQMAfCIcfTcDACALQQhqIApBCGopAwAiISAcIBtUrSAdIBxUrX1CAYMiHCAEQQhqKQMAfCIbfTcDACAbIBxUrSAhIBtUrXxCAYMhGyAKQRBqIQogBEEQaiEEIAtBEGohCyAFIAlBAmoiCUcNAAsgDg0BCyADQaAGaiAJQQN0IgtqICQgC2opAwAgGyAjIAtqKQMAfH03AwALIBkgGiAeGyEcCyADIBw3A6AIAkACQCAfICBzDQACQAJAIAYNAEIAIRtBACEJDAELQQAhCUIAIRsgA0GYBGohCyADQbAKaiEKIANBuAxqIQQDQCALIAQpAwAiHCAbfCIbIAopAwB8Ih03AwAgC0EIaiAbIBxUrSAdIBtUrXwiHCAEQQhqKQMAfCIbIApBCGopAwB8Ih03AwAgGyAcVK0gHSAbVK18IRsgBEEQaiEEIApBEGohCiALQRBqIQsgBSAJQQJqIglHDQALIA4NAgsgA0GYBGogCUEDdCILaiADQbgMaiALaikDACAbfCADQbAKaiALaikDAHw3AwAMAQsgESEKIBAhBCAGIQsCQCAGQQFIDQADQCAKKQMAIAQpAwBSDQEgCkF4aiEKIARBeGohBCALQQFKIQkgC0F/aiELIAkNAAtBACELCyADQbgMaiADQbAKaiADQbgMaiALQQN0IgtqKQMAIANBsApqIAtqKQMAVCIeGyEfIANBsApqIANBuAxqIB4bISACQAJAAkAgBg0AQgAhG0EAIQkMAQtBACEJQgAhGyADQZgEaiELICAhCiAfIQQDQCALIAopAwAiHSAbIAQpAwB8Ihx9NwMAIAtBCGogCkEIaikDACIhIBwgG1StIB0gHFStfUIBgyIcIARBCGopAwB8Iht9NwMAIBsgHFStICEgG1StfEIBgyEbIApBEGohCiAEQRBqIQQgC0EQaiELIAUgCUECaiIJRw0ACyAODQELIANBmARqIAlBA3QiC2ogICALaikDACAbIB8gC2opAwB8fTcDAAsgIiAaIB4bIRoLIAMgGjcDmAYLIAhBA0ohCyAYIQggCw0ACwtBACEEAkACQCAHQQJJDQACQAJAAkAgB0F+cSIEQX5qIggNAEEAIQkMAQsgBkEDdEHAjQpqIQUgCEEBdkEBakH+////B3EiCkEBdCEJIANBwA5qIQsDQCALIAX9AAMAIAz9DQgJCgsMDQ4PAAECAwQFBgf9CwMAIAtBEGogBUFwav0AAwAgDP0NCAkKCwwNDg8AAQIDBAUGB/0LAwAgBUFgaiEFIAtBIGohCyAKQX5qIgoNAAsgCEECcQ0BCyADQcAOaiAJQQN0aiAHIAlrQQN0QbiNCmr9AAMAIAz9DQgJCgsMDQ4PAAECAwQFBgf9CwMACyAHIARGDQELIAZBA3QgBEEDdCILa0HIjQpqIQUgBiAEa0EBaiEKIANBwA5qIAtqIQsDQCALIAUpAwA3AwAgBUF4aiEFIAtBCGohCyAKQX9qIgoNAAsLQQAhCiADQQApA8CNCiIaNwPAEAJAAkACQAJAAkACQAJAAkACQCAaIAMpA6AIIg1SDQAgBg0BQgAhGwwGCyAGIQUCQCAGQQFIDQAgA0GgBmogBkEDdCIFaiELIANBwA5qIAVqIQogBiEFA0AgCykDACAKKQMAUg0BIAtBeGohCyAKQXhqIQogBUEBSiEEIAVBf2ohBSAEDQALQQAhBQsgA0GgBmogA0HADmogA0GgBmogBUEDdCIFaikDACADQcAOaiAFaikDAFQiCBshAiADQcAOaiADQaAGaiAIGyEYIAYNAUIAIRtBACEEDAILIAdBfnEhCUEAIQpCACEbIANBwA5qIQsgA0GgBmohBQNAIAUgBSkDACIcIBt8IhsgCykDAHwiHTcDACAFQQhqIgQgGyAcVK0gHSAbVK18IhwgBCkDAHwiGyALQQhqKQMAfCIdNwMAIBsgHFStIB0gG1StfCEbIAVBEGohBSALQRBqIQsgCSAKQQJqIgpHDQAMBAsLIAdBfnEhCUEAIQRCACEbIANBoAZqIQUgGCELIAIhCgNAIAUgCykDACIdIBsgCikDAHwiHH03AwAgBUEIaiALQQhqKQMAIiEgHCAbVK0gHSAcVK19QgGDIhwgCkEIaikDAHwiG303AwAgGyAcVK0gISAbVK18QgGDIRsgC0EQaiELIApBEGohCiAFQRBqIQUgCSAEQQJqIgRHDQALIAZBAXENAQsgA0GgBmogBEEDdCIFaiAYIAVqKQMAIBsgAiAFaikDAHx9NwMACyAaIA0gCBshGgwDCyAGQQFxDQELIANBoAZqIApBA3QiBWoiCyALKQMAIBt8IANBwA5qIAVqKQMAfDcDAAsgAykDoAghGgsgAyAaNwOgCEEAIQQCQAJAIAdBAkkNAAJAAkACQCAHQX5xIgRBfmoiCA0AQQAhCQwBCyAGQQN0QcCPCmohBSAIQQF2QQFqQf7///8HcSIKQQF0IQkgA0HADmohCwNAIAsgBf0AAwAgDP0NCAkKCwwNDg8AAQIDBAUGB/0LAwAgC0EQaiAFQXBq/QADACAM/Q0ICQoLDA0ODwABAgMEBQYH/QsDACAFQWBqIQUgC0EgaiELIApBfmoiCg0ACyAIQQJxDQELIANBwA5qIAlBA3RqIAcgCWtBA3RBuI8Kav0AAwAgDP0NCAkKCwwNDg8AAQIDBAUGB/0LAwALIAcgBEYNAQsgBkEDdCAEQQN0IgtrQciPCmohBSAGIARrQQFqIQogA0HADmogC2ohCwNAIAsgBSkDADcDACAFQXhqIQUgC0EIaiELIApBf2oiCg0ACwtBACEKIANBACkDwI8KIg03A8AQAkACQAJAAkACQAJAAkACQAJAIA0gAykDmAYiGVINACAGDQFCACEbDAYLIAYhBQJAIAZBAUgNACADQZgEaiAGQQN0IgVqIQsgA0HADmogBWohCiAGIQUDQCALKQMAIAopAwBSDQEgC0F4aiELIApBeGohCiAFQQFKIQQgBUF/aiEFIAQNAAtBACEFCyADQZgEaiADQcAOaiADQZgEaiAFQQN0IgVqKQMAIANBwA5qIAVqKQMAVCIIGyECIANBwA5qIANBmARqIAgbIRggBg0BQgAhG0EAIQQMAgsgB0F+cSEJQQAhCkIAIRsgA0HADmohCyADQZgEaiEFA0AgBSAFKQMAIhwgG3wiGyALKQMAfCIdNwMAIAVBCGoiBCAbIBxUrSAdIBtUrXwiHCAEKQMAfCIbIAtBCGopAwB8Ih03AwAgGyAcVK0gHSAbVK18IRsgBUEQaiEFIAtBEGohCyAJIApBAmoiCkcNAAwECwsgB0F+cSEJQQAhBEIAIRsgA0GYBGohBSAYIQsgAiEKA0AgBSALKQMAIh0gGyAKKQMAfCIcfTcDACAFQQhqIAtBCGopAwAiISAcIBtUrSAdIBxUrX1CAYMiHCAKQQhqKQMAfCIbfTcDACAbIBxUrSAhIBtUrXxCAYMhGyALQRBqIQsgCkEQaiEKIAVBEGohBSAJIARBAmoiBEcNAAsgBkEBcQ0BCyADQZgEaiAEQQN0IgVqIBggBWopAwAgGyACIAVqKQMAfH03AwALIA0gGSAIGyEbDAMLIAZBAXENAQsgA0GYBGogCkEDdCIFaiILIAspAwAgG3wgA0HADmogBWopAwB8NwMACyADKQOYBiEbCyAAIBo3AwAgAyAbNwOYBkEAIQQCQAJAIAdBAkkNAAJAAkACQCAHQX5xIgRBfmoiCA0AQQAhCQwBCyAGQQN0IABqQXBqIQUgCEEBdkEBakH+////B3EiCkEBdCEJIANBoAZqIQsDQCAFQRBqIAv9AAMAIAz9DQgJCgsMDQ4PAAECAwQFBgf9CwMAIAUgC0EQav0AAwAgDP0NCAkKCwwNDg8AAQIDBAUGB/0LAwAgC0EgaiELIAVBYGohBSAKQX5qIgoNAAsgCEECcQ0BCyAAIAcgCWtBA3RqQXhqIANBoAZqIAlBA3Rq/QADACAM/Q0ICQoLDA0ODwABAgMEBQYH/QsDAAsgByAERg0BCyAGQQN0IARBA3QiC2sgAGpBCGohBSAGIARrQQFqIQogA0GgBmogC2ohCwNAIAUgCykDADcDACALQQhqIQsgBUF4aiEFIApBf2oiCg0ACwsgASAbNwMAQQAhBAJAAkAgB0ECSQ0AAkACQAJAIAdBfnEiBEF+aiIIDQBBACEJDAELIAZBA3QgAWpBcGohBSAIQQF2QQFqQf7///8HcSIKQQF0IQkgA0GYBGohCwNAIAVBEGogC/0AAwAgDP0NCAkKCwwNDg8AAQIDBAUGB/0LAwAgBSALQRBq/QADACAM/Q0ICQoLDA0ODwABAgMEBQYH/QsDACALQSBqIQsgBUFgaiEFIApBfmoiCg0ACyAIQQJxDQELIAEgByAJa0EDdGpBeGogA0GYBGogCUEDdGr9AAMAIAz9DQgJCgsMDQ4PAAECAwQFBgf9CwMACyAHIARGDQELIAZBA3QgBEEDdCILayABakEIaiEFIAYgBGtBAWohCiADQZgEaiALaiELA0AgBSALKQMANwMAIAtBCGohCyAFQXhqIQUgCkF/aiIKDQALCyADQcASaiSAgICAAAv9BwYEfwF+AX8EfgZ/AX4jgICAgABBgARrIgMkgICAgAACQEGAAkEAKAIIIgRBA3RBEGogBEFhakFiSSIFGyIGRQ0AIAMgASAG/AoAAAsgAyABKQMAUK0iBzcDAEEeIAQgBRshCAJAAkACQAJAIAApAwAiCSAHUQ0AIAhBAWohBiAAQQhqIQQgA0EIciEBQX8hBQwBCyAIQQJqIQYgACAIQQN0QQhqIgVqIQQgAyAFaiEBIANBgAJqIAVqIQVCACEKA0AgBSAEKQMAIgsgCnwgASkDAHwiDDcDACAMIAtUIApCAFIgDCALUXFyrSEKIARBeGohBCABQXhqIQEgBUF4aiEFIAZBf2oiBkECSg0ACyAAKQMIIAp8IAMpAwh8IQoMAQsCQAJAAkADQCAEKQMAIgogASkDACILVg0BAkAgCiALVA0AIARBCGohBCABQQhqIQEgCCAFQQFqIgVGDQIMAQsLIAhBAU4NAUIAIQoMAgsCQAJAIAhBAU4NAEIAIQoMAQtCACEKAkAgCEEBRg0AIAhBAXEhDSAIQQN0IQQgCEH+////B3EhDkIAIQogA0GAAmohASADIQUgACEPA0AgASAEaiIQQQhqIA8gBGoiEUEIaikDACIMIAogBSAEaiISQQhqKQMAfCILfTcDACAQIBEpAwAiEyALIApUrSAMIAtUrX1CAYMiCyASKQMAfCIKfTcDACAKIAtUrSATIApUrXxCAYMhCiAPQXBqIQ8gBUFwaiEFIAFBcGohASAGQX5qIQYgDkF+aiIODQALIA1FDQELIANBgAJqIAZBA3QiBGogACAEaikDACIMIAogAyAEaikDAHwiC303AwAgCyAKVK0gDCALVK18QgGDIQoLIAApAwggCiADKQMIfH0hCgwDC0IAIQoCQCAIQQFGDQAgCEEBcSENIAhBA3QhBCAIQf7///8HcSEOQgAhCiADQYACaiEBIAMhBSAAIQ8DQCABIARqIhBBCGogBSAEaiIRQQhqKQMAIgwgCiAPIARqIhJBCGopAwB8Igt9NwMAIBAgESkDACITIAsgClStIAwgC1StfUIBgyILIBIpAwB8Igp9NwMAIAogC1StIBMgClStfEIBgyEKIAVBcGohBSAPQXBqIQ8gAUFwaiEBIAZBfmohBiAOQX5qIg4NAAsgDUUNAQsgA0GAAmogBkEDdCIEaiADIARqKQMAIgwgCiAAIARqKQMAfCILfTcDACALIApUrSAMIAtUrXxCAYMhCgsgAykDCCAKIAApAwh8fSEKCyAHIQkLIAMgCTcDgAIgAyAKNwOIAgJAIAhBA3RBEGoiBEUNACACIANBgAJqIAT8CgAACyADQYAEaiSAgICAAAv0DAEgfCACIAArA0AiAyABKwMAIgSiIAErA0AiBSAAKwMAIgaioDkDQCACIAQgBqIgBSADoqE5AwAgAiABKwMIIgMgACsDACIEoiABKwMAIgUgACsDCCIGoqAgASsDSCIHIAArA0AiCKIgASsDQCIJIAArA0giCqKgoTkDCCACIAogBaIgCCADoiAHIASioKAgCSAGoqA5A0ggAiABKwMQIgMgACsDACIEoiABKwMIIgUgACsDCCIGoqAgASsDACIHIAArAxAiCKKgIAErA1AiCSAAKwNAIgqiIAErA0giCyAAKwNIIgyioCABKwNAIg0gACsDUCIOoqChOQMQIAIgDiAHoiAMIAWiIAogA6IgCSAEoqCgIAsgBqKgoCANIAiioDkDUCACIAErAxgiAyAAKwMAIgSiIAErAxAiBSAAKwMIIgaioCABKwMIIgcgACsDECIIoqAgASsDACIJIAArAxgiCqKgIAErA1giCyAAKwNAIgyiIAErA1AiDSAAKwNIIg6ioCABKwNIIg8gACsDUCIQoqAgASsDQCIRIAArA1giEqKgoTkDGCACIBIgCaIgECAHoiAOIAWiIAwgA6IgCyAEoqCgIA0gBqKgoCAPIAiioKAgESAKoqA5A1ggAiABKwMgIgMgACsDACIEoiABKwMYIgUgACsDCCIGoqAgASsDECIHIAArAxAiCKKgIAErAwgiCSAAKwMYIgqioCABKwMAIgsgACsDICIMoqAgASsDYCINIAArA0AiDqIgASsDWCIPIAArA0giEKKgIAErA1AiESAAKwNQIhKioCABKwNIIhMgACsDWCIUoqAgASsDQCIVIAArA2AiFqKgoTkDICACIBYgC6IgFCAJoiASIAeiIBAgBaIgDiADoiANIASioKAgDyAGoqCgIBEgCKKgoCATIAqioKAgFSAMoqA5A2AgAiABKwMoIgMgACsDACIEoiABKwMgIgUgACsDCCIGoqAgASsDGCIHIAArAxAiCKKgIAErAxAiCSAAKwMYIgqioCABKwMIIgsgACsDICIMoqAgASsDACINIAArAygiDqKgIAErA2giDyAAKwNAIhCiIAErA2AiESAAKwNIIhKioCABKwNYIhMgACsDUCIUoqAgASsDUCIVIAArA1giFqKgIAErA0giFyAAKwNgIhiioCABKwNAIhkgACsDaCIaoqChOQMoIAIgGiANoiAYIAuiIBYgCaIgFCAHoiASIAWiIBAgA6IgDyAEoqCgIBEgBqKgoCATIAiioKAgFSAKoqCgIBcgDKKgoCAZIA6ioDkDaCACIAErAzAiAyAAKwMAIgSiIAErAygiBSAAKwMIIgaioCABKwMgIgcgACsDECIIoqAgASsDGCIJIAArAxgiCqKgIAErAxAiCyAAKwMgIgyioCABKwMIIg0gACsDKCIOoqAgASsDACIPIAArAzAiEKKgIAErA3AiESAAKwNAIhKiIAErA2giEyAAKwNIIhSioCABKwNgIhUgACsDUCIWoqAgASsDWCIXIAArA1giGKKgIAErA1AiGSAAKwNgIhqioCABKwNIIhsgACsDaCIcoqAgASsDQCIdIAArA3AiHqKgoTkDMCACIB4gD6IgHCANoiAaIAuiIBggCaIgFiAHoiAUIAWiIBIgA6IgESAEoqCgIBMgBqKgoCAVIAiioKAgFyAKoqCgIBkgDKKgoCAbIA6ioKAgHSAQoqA5A3AgAiABKwM4IgMgACsDACIEoiABKwMwIgUgACsDCCIGoqAgASsDKCIHIAArAxAiCKKgIAErAyAiCSAAKwMYIgqioCABKwMYIgsgACsDICIMoqAgASsDECINIAArAygiDqKgIAErAwgiDyAAKwMwIhCioCABKwMAIhEgACsDOCISoqAgASsDeCITIAArA0AiFKIgASsDcCIVIAArA0giFqKgIAErA2giFyAAKwNQIhiioCABKwNgIhkgACsDWCIaoqAgASsDWCIbIAArA2AiHKKgIAErA1AiHSAAKwNoIh6ioCABKwNIIh8gACsDcCIgoqAgASsDQCIhIAArA3giIqKgoTkDOCACICIgEaIgICAPoiAeIA2iIBwgC6IgGiAJoiAYIAeiIBYgBaIgFCADoiATIASioKAgFSAGoqCgIBcgCKKgoCAZIAqioKAgGyAMoqCgIB0gDqKgoCAfIBCioKAgISASoqA5A3gL/wQBC3wCQEGAAUUNACAAIAFBgAH8CgAACyAAIAU2ApQBIAAgBDYCkAEgAEEANgJwIAErAxghBgJAAkAgASgCSEECRw0AIANEAAAAAgAAoEGiIQcgByADoSEIIAcgCKEhCSABKwMoIgpEAAAAAgAAoEGiIQcgByAKoSEIIAcgCKEhByAKIAehIQsgCiADoiIMIQggCSAHoiAIoSENIA0gCSALoqAhDSADIAmhIQMgDSADIAeioCEJIAkgAyALoqAhDSABKwNYIQMgDSADoCEJIAkgA6EhDiANIA6hIQ8gCSAOoSENIAMgDaEhECABKwMgIQ0gCCANoCEDIAMgDaEhDiAIIA6hIQggAyAOoSEOIA0gDqEhDSAIIA2gIAmgIQkgCSADoCEIIAggA6EhAyAPIBCgIAmgIAOhIQMgAyAIoCEJIAkgCKEhCCAAIAMgCKE5A1ggAkQAAAACAACgQaIhAyADIAKhIQggAyAIoSEDIAogAqIiDSEIIAcgA6IgCKEhCiAKIAsgA6KgIQogAiADoSEDIAogByADoqAhByAHIAsgA6KgIQIgASsDUCEDIAIgA6AhByAHIAOhIQsgAiALoSEKIAcgC6EhAiADIAKhIQsgCCAGoCEDIAMgBqEhAiAIIAKhIQggAyACoSECIAYgAqEhBiAIIAagIAegIQcgByADoCEGIAYgA6EhAyAKIAugIAegIAOhIQcgByAGoCEDIAMgBqEhBiAAIAcgBqE5A1AMAQsgASsDICABKwMoIgcgA6IiDKAhCSAHIAKiIg0gBqAhAwsgACAJOQMgIAAgAzkDGCAAIA0gASsDgAGgOQOAASAAIAErA4gBIAygOQOIAQvVQAwDfwN8An8BfQh/A3wEfwF8AX8BfAZ/CnxBACEDAkAgACgCkAEgAkECdGoiBCoCAEMAAAAAXA0AAkAgACgCSEEDRw0AIAAoApQBIAJBAnRqIQUgACsDiAEgACsDKCIGIAIgACgCDCIDbSIBt6KgIQcgBiACIAEgA2xrt6IgACsDgAGgIQggACgCBCEJIAAoAnghCiAAKAIIIQICQAJAAkACQAJAAkACQAJAAkACQCAAKAIAQX9qDgoAAQIDBAUGCAgHCAtDAMB5xCELIAJBAUgNCCAJQX9qIQwgCigCACENIApBmAFqIQ4gCigCjAJBf2ohDyAKKAIQIRAgCigCBCERIAooApABIRIgCigCCCETRAAAAAAAAAAAIRRBACEBQQEhA0QAAAAAAADwPyEVIAchFiAIIQYDQAJAAkAgE0UNACADQQFIDQAgA0F/aiIXQQFxDQAgF2giGCAPIBggD0gbIA8gFxsiGUEBSA0AIBdBAXYiGCASTg0AIAIgAWsiGkECSA0AIAYgBqIgFiAWoqAiGyATIBggEGoiHEEobGorAyAiHSAdomYNAEEBIRgCQAJAIBlBAUcNACAcIR4MAQsCQCAXQQJ1Ih8gCigClAFIDQAgHCEeDAELAkAgGkEETg0AIBwhHgwBCyAZQQFqISBBAiEYIA4hIQJAA0ACQCAbIBMgIUH8fmooAgAgH2oiHkEobGorAyAiHSAdomZFDQAgHCEeIBghIgwCCwJAIBkgGEYNACAXIBhBAWoiInUiHyAhKAIATg0CQQIgGHQhIyAhQQRqISEgHiEcICIhGCAjIBpKDQIMAQsLICAhIgsgIkF/aiEYCyATIB5BKGxqIhdFDQAgFysDGCIkIAeiIBcrAwgiHSAWoqAhJSAXKwMQIiYgCKIgFysDACIbIAaioCEnIB0gBqIgGyAWoqAgJiAHoqAhFiAkIAiiISgCQCAMQQFLDQAgHSAVoiEGICYgGyAVoqAgHSAUoqEhFSAGIBsgFKKgICSgIRQLICcgJaEhBiAWICigIR1BASAYdCEXDAELIA0gA0EEdGoiFysDACEdIBdBCGorAwAhGwJAIAxBAUsNACAbIBagIiQgFKIhJiAkIBWiIB0gBqAiJCAUoqAiFCAUoCEUICQgFaIgJqEiJCAkoEQAAAAAAADwP6AhFQsgHSAdoCAGoCIkIBaiIAegIBsgG6AgFqAiGyAGoqAhHSAkIAaiIAigIBsgFqKhIQZBASEXCyAXIAFqIQECQCANIBcgA2oiA0EEdGoiF0EIaisDACAdoCIbIBuiIBcrAwAgBqAiJCAkoqAiFkQAAAAAgIQuQWUNAAJAAkACQCAMQQFLDQAgJCAbIBUgFBCTgICAACELDAELIAlBA0cNASAbRAAAAGCeoPY/oiAbICSgIgYgBqIgGyAkoSIGIAaioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQhCwsgBSALOAIACyABsiAWthCUgICAAJMhCwwKCwJAAkAgFiAdIB2iIAYgBqKgYw0AIB0hFiADIBFHDQELQQAhAyAkIQYgGyEWCyABIAJIDQAMCQsLQwDAecQhCyACQQFIDQcgCUF/aiEMIAooAgAhDSAKQZgBaiEOIAooAowCQX9qIQ8gCigCECEQIAooAgQhESAKKAKQASESIAooAgghE0QAAAAAAAAAACEnQQAhAUEBIQNEAAAAAAAA8D8hKCAHIRQgCCEGA0ACQAJAIBNFDQAgA0EBSA0AIANBf2oiF0EBcQ0AIBdoIhggDyAYIA9IGyAPIBcbIhlBAUgNACAXQQF2IhggEk4NACACIAFrIhpBAkgNACAGIAaiIBQgFKKgIhYgEyAYIBBqIhxBKGxqKwMgIh0gHaJmDQBBASEYAkACQCAZQQFHDQAgHCEeDAELAkAgF0ECdSIfIAooApQBSA0AIBwhHgwBCwJAIBpBBE4NACAcIR4MAQsgGUEBaiEgQQIhGCAOISECQANAAkAgFiATICFB/H5qKAIAIB9qIh5BKGxqKwMgIh0gHaJmRQ0AIBwhHiAYISIMAgsCQCAZIBhGDQAgFyAYQQFqIiJ1Ih8gISgCAE4NAkECIBh0ISMgIUEEaiEhIB4hHCAiIRggIyAaSg0CDAELCyAgISILICJBf2ohGAsgEyAeQShsaiIXRQ0AIBcrAxgiGyAHoiAXKwMIIh0gFKKgIRUgFysDECIkIAiiIBcrAwAiFiAGoqAhJiAdIAaiIBYgFKKgICQgB6KgIRQgGyAIoiElAkAgDEEBSw0AIB0gKKIhBiAkIBYgKKKgIB0gJ6KhISggBiAWICeioCAboCEnCyAmIBWhIQYgFCAloCEdQQEgGHQhFwwBCyANIANBBHRqIhcrAwAiJCAGoCEbIBdBCGorAwAiHSAUoCEWAkAgDEEBSw0AIBsgFiAWoKIiFSAooiEmIBsgG6IgFiAWoqEiJSAooiAVICeioUQAAAAAAAAIQKJEAAAAAAAA8D+gISggJiAlICeioEQAAAAAAAAIQKIhJwsgGyAkoCIVIBaiICQgHSAdoKKgIBYgHaAiJiAboqAiJSAGoiAHoCAVIBuiICQgJKKgICYgFqIgHSAdoqChIhYgFKKgIR0gFiAGoiAIoCAlIBSioSEGQQEhFwsgFyABaiEBAkAgDSAXIANqIgNBBHRqIhdBCGorAwAgHaAiFiAWoiAXKwMAIAagIhsgG6KgIiREAAAAAICELkFlDQACQAJAAkAgDEEBSw0AIBsgFiAoICcQk4CAgAAhCwwBCyAJQQNHDQEgFkQAAABgnqD2P6IgFiAboCIGIAaiIBYgG6EiBiAGoqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UIQsLIAUgCzgCAAsgAbIgJLYQlICAgABDnYQhv5SSIQsMCQsCQAJAICQgHSAdoiAGIAaioGMNACAdIRQgAyARRw0BC0EAIQMgGyEGIBYhFAsgASACSA0ADAgLC0MAwHnEIQsgAkEBSA0GIAlBf2ohDCAKKAIAIQ0gCkGYAWohDiAKKAKMAkF/aiEPIAooAhAhECAKKAIEIREgCigCkAEhEiAKKAIIIRNEAAAAAAAAAAAhKUEAIQFBASEDRAAAAAAAAPA/ISogByEUIAghGwNAAkACQCATRQ0AIANBAUgNACADQX9qIhdBAXENACAXaCIYIA8gGCAPSBsgDyAXGyIZQQFIDQAgF0EBdiIYIBJODQAgAiABayIaQQJIDQAgGyAboiAUIBSioCIdIBMgGCAQaiIcQShsaisDICIGIAaiZg0AQQEhGAJAAkAgGUEBRw0AIBwhHgwBCwJAIBdBAnUiHyAKKAKUAUgNACAcIR4MAQsCQCAaQQRODQAgHCEeDAELIBlBAWohIEECIRggDiEhAkADQAJAIB0gEyAhQfx+aigCACAfaiIeQShsaisDICIGIAaiZkUNACAcIR4gGCEiDAILAkAgGSAYRg0AIBcgGEEBaiIidSIfICEoAgBODQJBAiAYdCEjICFBBGohISAeIRwgIiEYICMgGkoNAgwBCwsgICEiCyAiQX9qIRgLIBMgHkEobGoiF0UNACAXKwMYIhYgB6IgFysDCCIGIBSioCEVIBcrAxAiJCAIoiAXKwMAIh0gG6KgISYgBiAboiAdIBSioCAkIAeioCEUIBYgCKIhJQJAIAxBAUsNACAGICqiIRsgJCAdICqioCAGICmioSEqIBsgHSApoqAgFqAhKQsgJiAVoSEbIBQgJaAhBkEBIBh0IRcMAQsgDSADQQR0aiIXKwMAIiQgG6AhHSAXQQhqKwMAIhYgFKAhBgJAIAxBAUsNACAdIB2iIAYgBqKhIhUgBqIgHSAGIAagoiImIB2ioCIlICqiIScgFSAdoiAmIAaioSIVICqiICUgKaKhRAAAAAAAABBAokQAAAAAAADwP6AhKiAnIBUgKaKgRAAAAAAAABBAoiEpCyAkICSiIBYgFqKhIhUgFqIgJCAWIBagoiImICSioCAdICSgIiUgBqIgJqAgBiAWoCInIB2ioCIoIB2ioCAVICcgBqKhICUgHaKgIiUgBqKgIicgG6IgB6AgJSAdoiAVICSioCAoIAaiICYgFqKgoSIdIBSioCEGIB0gG6IgCKAgJyAUoqEhG0EBIRcLIBcgAWohAQJAIA0gFyADaiIDQQR0aiIXQQhqKwMAIAagIh0gHaIgFysDACAboCIWIBaioCIkRAAAAACAhC5BZQ0AAkACQAJAIAxBAUsNACAWIB0gKiApEJOAgIAAIQsMAQsgCUEDRw0BIB1EAAAAYJ6g9j+iIB0gFqAiBiAGoiAdIBahIgYgBqKgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lCELCyAFIAs4AgALIAGyICS2EJSAgIAAQwAAAL+UkiELDAgLAkACQCAkIAYgBqIgGyAboqBjDQAgBiEUIAMgEUcNAQtBACEDIBYhGyAdIRQLIAEgAkgNAAwHCwtDAMB5xCELIAJBAUgNBSAJQX9qIQwgCigCACENIApBmAFqIQ4gCigCjAJBf2ohDyAKKAIQIRAgCigCBCERIAooApABIRIgCigCCCETRAAAAAAAAAAAISpBACEBQQEhA0QAAAAAAADwPyErIAchFCAIISQDQAJAAkAgE0UNACADQQFIDQAgA0F/aiIXQQFxDQAgF2giGCAPIBggD0gbIA8gFxsiGUEBSA0AIBdBAXYiGCASTg0AIAIgAWsiGkECSA0AICQgJKIgFCAUoqAiHSATIBggEGoiHEEobGorAyAiBiAGomYNAEEBIRgCQAJAIBlBAUcNACAcIR4MAQsCQCAXQQJ1Ih8gCigClAFIDQAgHCEeDAELAkAgGkEETg0AIBwhHgwBCyAZQQFqISBBAiEYIA4hIQJAA0ACQCAdIBMgIUH8fmooAgAgH2oiHkEobGorAyAiBiAGomZFDQAgHCEeIBghIgwCCwJAIBkgGEYNACAXIBhBAWoiInUiHyAhKAIATg0CQQIgGHQhIyAhQQRqISEgHiEcICIhGCAjIBpKDQIMAQsLICAhIgsgIkF/aiEYCyATIB5BKGxqIhdFDQAgFysDGCIWIAeiIBcrAwgiBiAUoqAhFSAXKwMQIhsgCKIgFysDACIdICSioCEmIAYgJKIgHSAUoqAgGyAHoqAhFCAWIAiiISUCQCAMQQFLDQAgBiAroiEkIBsgHSAroqAgBiAqoqEhKyAkIB0gKqKgIBagISoLICYgFaEhJCAUICWgIQZBASAYdCEXDAELIA0gA0EEdGoiFysDACIbICSgIR0gF0EIaisDACIWIBSgIQYCQCAMQQFLDQAgHSAdoiAGIAaioSIVIB2iIB0gBiAGoKIiJiAGoqEiJSAGoiAVIAaiICYgHaKgIhUgHaKgIiYgK6IhJyAlIB2iIBUgBqKhIhUgK6IgJiAqoqFEAAAAAAAAFECiRAAAAAAAAPA/oCErICcgFSAqoqBEAAAAAAAAFECiISoLIBsgG6IgFiAWoqEiFSAboiAbIBYgFqCiIiYgFqKhIiUgFqIgFSAWoiAmIBuioCInIBuioCAdIBugIiggBqIgJqAgBiAWoCImIB2ioCIpIB2iICegIBUgJiAGoqEgKCAdoqAiFSAGoqAiJiAdoqAgJSApIAaioSAVIB2ioCIVIAaioCIoICSiIAegIBUgHaIgJSAboqAgJiAGoiAnIBaioKEiHSAUoqAhBiAdICSiIAigICggFKKhISRBASEXCyAXIAFqIQECQCANIBcgA2oiA0EEdGoiF0EIaisDACAGoCIdIB2iIBcrAwAgJKAiFiAWoqAiG0QAAAAAgIQuQWUNAAJAAkACQCAMQQFLDQAgFiAdICsgKhCTgICAACELDAELIAlBA0cNASAdRAAAAGCeoPY/oiAdIBagIgYgBqIgHSAWoSIGIAaioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQhCwsgBSALOAIACyABsiAbthCUgICAAEOjgdy+lJIhCwwHCwJAAkAgGyAGIAaiICQgJKKgYw0AIAYhFCADIBFHDQELQQAhAyAWISQgHSEUCyABIAJIDQAMBgsLQwDAecQhCyACQQFIDQQgCigCACENIApBmAFqIRAgCigCjAJBf2ohESAKKAIQIRIgCigCBCEMIAooApABISMgCigCCCETQQAhAUEBIQMgByEUIAghJANAAkACQCATRQ0AIANBAUgNACADQX9qIhdBAXENACAXaCIPIBEgDyARSBsgESAXGyIhQQFIDQAgF0EBdiIPICNODQAgAiABayIeQQJIDQAgJCAkoiAUIBSioCIdIBMgDyASaiIiQShsaisDICIGIAaiZg0AQQEhDwJAAkAgIUEBRw0AICIhGQwBCwJAIBdBAnUiGiAKKAKUAUgNACAiIRkMAQsCQCAeQQRODQAgIiEZDAELICFBAWohDkECIQ8gECEYAkADQAJAIB0gEyAYQfx+aigCACAaaiIZQShsaisDICIGIAaiZkUNACAiIRkgDyEfDAILAkAgISAPRg0AIBcgD0EBaiIfdSIaIBgoAgBODQJBAiAPdCEcIBhBBGohGCAZISIgHyEPIBwgHkoNAgwBCwsgDiEfCyAfQX9qIQ8LIBMgGUEobGoiF0UNACAXKwMIIh0gJKIgFysDACIWIBSioCAXKwMQIhsgB6KgIBcrAxgiFSAIoqAhBkEBIA90IRcgGyAIoiAWICSioCAVIAeiIB0gFKKgoSEkDAELIA0gA0EEdGoiFysDACIdIB2iIBdBCGorAwAiBiAGoqEiFSAdoiAdIAYgBqCiIiYgBqKhIiUgHaIgFSAGoiAmIB2ioCInIAaioSIoIAaiICUgBqIgJyAdoqAiKSAdoqAgHSAkoCIWIB2gIiogBiAUoCIboiAmoCAbIAagIiYgFqKgIisgFqIgJ6AgFSAmIBuioSAqIBaioCIVIBuioCImIBaiICmgICUgKyAboqEgFSAWoqAiFSAboqAiJSAWoqAgKCAmIBuioSAVIBaioCIVIBuioCImICSiIAegIBUgFqIgKCAdoqAgJSAboiApIAaioKEiHSAUoqAhBiAdICSiIAigICYgFKKhISRBASEXCyAXIAFqIQECQCANIBcgA2oiA0EEdGoiF0EIaisDACAGoCIdIB2iIBcrAwAgJKAiFiAWoqAiG0QAAAAAgIQuQWUNAAJAIAlBA0cNACAFIB1EAAAAYJ6g9j+iIB0gFqAiBiAGoiAdIBahIgYgBqKgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCAAsgAbIgG7YQlICAgABDkhHGvpSSIQsMBgsCQAJAIBsgBiAGoiAkICSioGMNACAGIRQgAyAMRw0BC0EAIQMgFiEkIB0hFAsgASACSA0ADAULC0MAwHnEIQsgAkEBSA0DIAooAgAhDSAKQZgBaiEQIAooAowCQX9qIREgCigCECESIAooAgQhDCAKKAKQASEjIAooAgghE0EAIQFBASEDIAchFCAIISQDQAJAAkAgE0UNACADQQFIDQAgA0F/aiIXQQFxDQAgF2giDyARIA8gEUgbIBEgFxsiIUEBSA0AIBdBAXYiDyAjTg0AIAIgAWsiHkECSA0AICQgJKIgFCAUoqAiHSATIA8gEmoiIkEobGorAyAiBiAGomYNAEEBIQ8CQAJAICFBAUcNACAiIRkMAQsCQCAXQQJ1IhogCigClAFIDQAgIiEZDAELAkAgHkEETg0AICIhGQwBCyAhQQFqIQ5BAiEYIBAhDwJAA0ACQCAdIBMgD0H8fmooAgAgGmoiGUEobGorAyAiBiAGomZFDQAgIiEZIBghHwwCCwJAICEgGEYNACAXIBhBAWoiH3UiGiAPKAIATg0CQQIgGHQhHCAPQQRqIQ8gGSEiIB8hGCAcIB5KDQIMAQsLIA4hHwsgH0F/aiEPCyATIBlBKGxqIhdFDQAgFysDCCIdICSiIBcrAwAiFiAUoqAgFysDECIbIAeioCAXKwMYIhUgCKKgIQZBASAPdCEXIBsgCKIgFiAkoqAgFSAHoiAdIBSioKEhJAwBCyANIANBBHRqIhcrAwAiHSAdoiAXQQhqKwMAIgYgBqKhIhUgHaIgHSAGIAagoiImIAaioSIlIB2iIBUgBqIgJiAdoqAiJyAGoqEiKCAdoiAlIAaiICcgHaKgIikgBqKhIiogBqIgKCAGoiApIB2ioCIrIB2ioCAdICSgIhYgHaAiLCAGIBSgIhuiICagIBsgBqAiJiAWoqAiLSAWoiAnoCAVICYgG6KhICwgFqKgIhUgG6KgIiYgFqIgKaAgJSAtIBuioSAVIBaioCIVIBuioCIlIBaiICugICggJiAboqEgFSAWoqAiFSAboqAiJiAWoqAgKiAlIBuioSAVIBaioCIVIBuioCIlICSiIAegIBUgFqIgKiAdoqAgJiAboiArIAaioKEiHSAUoqAhBiAdICSiIAigICUgFKKhISRBASEXCyAXIAFqIQECQCANIBcgA2oiA0EEdGoiF0EIaisDACAGoCIdIB2iIBcrAwAgJKAiFiAWoqAiG0QAAAAAgIQuQWUNAAJAIAlBA0cNACAFIB1EAAAAYJ6g9j+iIB0gFqAiBiAGoiAdIBahIgYgBqKgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCAAsgAbIgG7YQlICAgABDymC2vpSSIQsMBQsCQAJAIBsgBiAGoiAkICSioGMNACAGIRQgAyAMRw0BC0EAIQMgFiEkIB0hFAsgASACSA0ADAQLC0MAwHnEIQsgAkEBSA0CIAlBf2ohDSAKKAIAIRcgCigCBCETQQAhAUEBIQNEAAAAAAAAAAAhJUQAAAAAAADwPyEnIAchHSAIIQYDQCAXIANBBHRqIgorAwAiGyAGoCEkIApBCGorAwAhFgJAIA1BAUsNACAWIB2gIhQgJaIhFSAUICeiICQgJaKgIhQgFKAhJSAkICeiIBWhIhQgFKBEAAAAAAAA8D+gIScLICQgHaIgFiAGoqAiFCAWIBuiIiQgJKCgIRUgFCAkoCEmIBsgG6AgBqAgBqIgCKAgFiAWoCAdoCAdoqEhBgJAAkAgJEQAAAAAAAAAAGMNACAVmiAUICZEAAAAAAAAAABjGyEdDAELIBUgFJogJkQAAAAAAAAAAGQbIR0LIAFBAWohAQJAIBcgA0EBaiIDQQR0aiIKQQhqKwMAIB0gHaAgB6AiHaAiFiAWoiAKKwMAIAagIhsgG6KgIiREAAAAAICELkFlDQACQAJAAkAgDUEBSw0AIBsgFiAnICUQk4CAgAAhCwwBCyAJQQNHDQEgFkQAAABgnqD2P6IgFiAboCIGIAaiIBYgG6EiBiAGoqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UIQsLIAUgCzgCAAsgAbMgJLYQlICAgACTIQsMBAsCQAJAICQgHSAdoiAGIAaioGMNACADIBNHDQELQQAhAyAbIQYgFiEdCyACIAFHDQAMAwsLQwDAecQhCyACQQFIDQEgCigCACEXIAooAgQhDUEAIQFBASEDIAchBiAIIR0DQCAXIANBBHRqIgorAwAiFiAWoCAdoCAdoiAKQQhqKwMAIhsgG6AgBqAgBqKhIhQgFiAWoiAbIBuioSIkICSgoCEVIBQgJKAhJgJAAkAgJEQAAAAAAAAAAGMNACAVmiAUICZEAAAAAAAAAABjGyEkDAELIBUgFJogJkQAAAAAAAAAAGQbISQLIAFBAWohAQJAIBcgA0EBaiIDQQR0aiIKQQhqKwMAIBYgHaAgBqIgGyAdoqAiBiAGoCAHoCIGoCIWIBaiIAorAwAgJCAIoCIdoCIbIBuioCIkRAAAAACAhC5BZQ0AAkAgCUEDRw0AIAUgFkQAAABgnqD2P6IgFiAboCIGIAaiIBYgG6EiBiAGoqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIACyABsyAkthCUgICAAJMhCwwDCwJAAkAgJCAdIB2iIAYgBqKgYw0AIB0hHSADIA1HDQELQQAhAyAbIR0gFiEGCyACIAFHDQAMAgsLQwDAecQhCyACQQFIDQAgCigCACEXIAooAgQhDUEAIQFBASEDIAchHSAIIQYDQCAXIANBBHRqIgpBCGorAwAiFiAGoiEkIAorAwAiGyAGoCEUIAFBAWohAQJAIBsgG6AgBqAgBqIgCKAgFiAWoCAdoCAdoqEiBiAXIANBAWoiA0EEdGoiCisDAKAiGyAboiAHICQgFCAdoqAiHSAdoKEiHSAKQQhqKwMAoCIWIBaioCIkRAAAAACAhC5BZQ0AAkAgCUEDRw0AIAUgFkQAAABgnqD2P6IgFiAboCIGIAaiIBYgG6EiBiAGoqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIACyABsyAkthCUgICAAJMhCwwCCwJAAkAgJCAGIAaiIB0gHaKgYw0AIB0hHSADIA1HDQELQQAhAyAbIQYgFiEdCyACIAFHDQALCyAEIAs4AgAgACgCCEECaiAL/ABBDGogC0MAwHnEWxsPCyAAKwMoIh0gAiAAKAIMIhdtIgq3oiAAKwMgoCEGIB0gAiAKIBdsa7eiIAArAxigIR0CQAJAAkAgACsDaCIWRAAAAAAAAAAAZQ0AIAYgBqIgHSAdoqAgFiAWomQNACAALQAwRSAAKAIAQQdIcbMhCwwBCyAAKAIAQQFHDQEgAC0AMEH/AXENAQJAIAYgBqIiFiAdRAAAAAAAANC/oCIGIAaioCIbIAagIBuiIBZEAAAAAAAA0D+iZUUNAEMAAIA/IQsMAQsgFiAdRAAAAAAAAPA/oCIGIAaioEQAAAAAAACwP2QNAUMAAABAIQsLIARBgIDno3w2AgBBASEDIAArA2BEAAAAAAAAAABlDQEgACgClAEgAkECdGogCzgCAEEBDwsgASABKAIQIhdBAWo2AhAgASAXQQJ0aiACNgIAIAEoAhBBAkEEIAAoAkgbRw0AIAAgARCOgICAACEDCyADC+6QAQoEfwZ8AX8DfAp/CHwBfQF/BHsCfSOAgICAAEGAAmsiAiSAgICAAAJAAkAgASgCECIDDQBBACEEDAELAkACQAJAIAAoAkgiBUECRw0AAkAgA0EBTg0AQQAhBAwDCyAAKwNAIQYgACsDOCEHIAArA1ghCCAAKwMgIQkgACsDUCEKIAArAxghCyAAKAIAIgxBBUggDEF5akEDSXIhBSAAKwMoIg1EAAAAAgAAoEGiIQ4gACsDYCEPIAAoAgghECAAKAIEIREgACgClAEhEiAAKAIMIRMgAkHwAGohFCACQeAAaiEEIAAtADBB/wFxIRUgASEWIAMhFwNAIAQgEiAWKAIAIhhBAnRqKgIAOAIAIBggE20iGbciGkQAAAACAACgQaIhGyAbIBqhIRwgGyAcoSEbIA4gDaEhHCAOIByhIRwgDSAcoSEdIA0gGqIhHiAbIByiIB6hIR8gHyAbIB2ioCEfIBogG6EhGyAfIBsgHKKgIRogGiAbIB2ioCEbIBsgCKAhGiAaIAihIR8gGyAfoSEgIBogH6EhGyAIIBuhISEgHiAJoCEbIBsgCaEhHyAeIB+hIR4gGyAfoSEfIAkgH6EhHyAeIB+gIBqgIRogGiAboCEeIB4gG6EhGyAgICGgIBqgIBuhIRsgGyAeoCEaIBogHqEhHiAbIB6hISEgGCAZIBNsa7ciH0QAAAACAACgQaIhGyAbIB+hIR4gGyAeoSEbIA0gH6IhHiAcIBuiIB6hISAgICAdIBuioCEgIB8gG6EhGyAgIBwgG6KgIRwgHCAdIBuioCEbIBsgCqAhHCAcIAqhIR0gGyAdoSEfIBwgHaEhGyAKIBuhISAgHiALoCEbIBsgC6EhHSAeIB2hIR4gGyAdoSEdIAsgHaEhHSAeIB2gIBygIR4gHiAboCEcIBwgG6EhGyAfICCgIB6gIBuhIR4gHiAcoCEbIBsgHKEhHCAeIByhIRwCQAJAAkACQCARDgQCAQEAAQsgDCAQIBsgHCAaICEgByAbIBUbRAAAAAAAAAAAIBwgFRsgBiAaIBUbRAAAAAAAAAAAICEgFRsgBCAPEJWAgIAAISIMAgsgBUUNACAMIBAgGyAcIBogISAHIBsgFRtEAAAAAAAAAAAgHCAVGyAGIBogFRtEAAAAAAAAAAAgISAVGyAEIA8QloCAgAAhIgwBCyAMIBAgGyAcIBogISAHIBsgFRtEAAAAAAAAAAAgHCAVGyAGIBogFRtEAAAAAAAAAAAgISAVGyAEIA8Ql4CAgAAhIgsgFCAiOAIAIBZBBGohFiAEQQRqIQQgFEEEaiEUIBdBf2oiF0UNAgwACwtBAkEEIAUbIQwgA0F/aiEQIAAoAhC3RAAAAAAAAOA/oiEJIAAoAgwiE7dEAAAAAAAA4D+iIQogACgCdCEEIAArA0AhDSAAKwM4ISAgACgClAEhESAAKwMgISEgACsDKCEeIAArAxghCEEAIRUgAkHgAGohFiAALQAwQf8BcSEXIAAoAnAiI0EBSCESQQAhFANAIBYgESABIBQgECAUIANIG0ECdGooAgAiGEECdGoqAgA4AgAgAkGAAWogFWogDSAeIBggE20iGbciHKIgIaAiHSAXGzkDACACQaABaiAVaiAgIB4gGCAZIBNsa7ciGqIgCKAiGyAXGzkDAAJAIBINACAEKwMwIAQrAzgiHSAaIAqhIB6iIhuioCAEKwN4IhogHCAJoSAeoiIcoqEiHyAboiAaIBuiIB0gHKKgIAQrA3CgIh0gHKKhIAQrAyigIhogG6IgHSAboiAfIByioCAEKwNooCIdIByioSAEKwMgoCIfIBuiIBogHKIgBCsDYKAgHSAboqAiHSAcoqEgBCsDGKAiGiAboiAfIByiIAQrA1igIB0gG6KgIh0gHKKhIAQrAxCgIh8gG6IgGiAcoiAEKwNQoCAdIBuioCIdIByioSAEKwMIoCIaIByiIAQrA0CgIB8gHKIgBCsDSKAgHSAboqAiHyAboqAhHSAaIBuiIAQrAwCgIB8gHKKhIRsLIAJB4AFqIBVqIBs5AwAgAkHAAWogFWogHTkDACAWQQRqIRYgFUEIaiEVIAwgFEEBaiIURw0ACyAAKAIIICNrIQQCQAJAIAUNACAEIB5EAAAAAAAAsECi/AIiFSAEIBVIGyEWIAArA2AhGyAAKAIAIRQCQAJAAkACQCAAKAIEDgQCAQEAAQsgFCAWIAJB4AFqIAJBwAFqIAJBoAFqIAJBgAFqIAJB8ABqIAJB4ABqIBsQmICAgAAMAgsCQCAUQQVIDQAgFEF5akECSw0BCyAUIBYgAkHgAWogAkHAAWogAkGgAWogAkGAAWogAkHwAGogAkHgAGogGxCZgICAAAwBCyAUIBYgAkHgAWogAkHAAWogAkGgAWogAkGAAWogAkHwAGogAkHgAGogGxCagICAAAsgBCAVTA0BIANBAUgNAUEAIRVBACEWAkACQCADQQFGDQAgA0EBcSETIANB/v///wdxIRhBACEWIAJB8ABqIRRBACEVA0ACQCAUKgIAQwDAecRcDQAgAkHQAGogFUECdGogFjYCACAVQQFqIRULAkAgFEEEaioCAEMAwHnEXA0AIAJB0ABqIBVBAnRqIBZBAWo2AgAgFUEBaiEVCyAUQQhqIRQgGCAWQQJqIhZHDQALIBNFDQELIAJB8ABqIBZBAnRqKgIAQwDAecRcDQAgAkHQAGogFUECdGogFjYCACAVQQFqIRULIBVBAUgNASAVQX9qIRZBACEUIAJB0ABqIRMDQCACIAJB4AFqIAJB0ABqIBYgFCAWIBRIG0ECdGooAgAiF0EDdCIYaisDADkDQCACIAJBwAFqIBhqKwMAOQMwIAIgAkGgAWogGGorAwA5AyAgAiACQYABaiAYaisDADkDECACIAAoApQBIhkgASAXQQJ0aigCAEECdGoqAgA4AgAgAiACQeABaiACQdAAaiAWIBRBAWoiFyAWIBdIG0ECdGooAgAiDEEDdCIYaisDADkDSCACIAJBwAFqIBhqKwMAOQM4IAIgAkGgAWogGGorAwA5AyggAiACQYABaiAYaisDADkDGCACIBkgASAMQQJ0aigCAEECdGoqAgA4AgQgACsDYCEbIAAoAgAhGAJAAkACQAJAIAAoAgQOBAEAAAIACwJAIBhBBUgNACAYQXlqQQJLDQELIBggBCACQcAAaiACQTBqIAJBIGogAkEQaiACQQhqIAIgGxCbgICAAAwCCyAYIAQgAkHAAGogAkEwaiACQSBqIAJBEGogAkEIaiACIBsQnICAgAAMAQsgGCAEIAJBwABqIAJBMGogAkEgaiACQRBqIAJBCGogAiAbEJ2AgIAACyACQfAAaiATKAIAQQJ0IhhqIAIqAgg4AgAgAkHgAGogGGogAioCADgCAAJAIBcgFU4NACACQfAAaiATQQRqKAIAQQJ0IhhqIAIqAgw4AgAgAkHgAGogGGogAioCBDgCAAsgE0EIaiETIBRBAmoiFCAVSA0ADAILCyAAKwNgIRsCQAJAIANBAkYNACAbRAAAAAAAAAAAZA0AIANBAU4NAUEAIQQMBAsgACgCACEVAkACQAJAIAAoAgQOBAIBAQABCyAVIAQgAkHgAWogAkHAAWogAkGgAWogAkGAAWogAkHwAGogAkHgAGogGxCdgICAAAwDCwJAIBVBBUgNACAVQXlqQQJLDQELIBUgBCACQeABaiACQcABaiACQaABaiACQYABaiACQfAAaiACQeAAaiAbEJuAgIAADAILIBUgBCACQeABaiACQcABaiACQaABaiACQYABaiACQfAAaiACQeAAaiAbEJyAgIAADAELIAAoAgQhF0EAIRUgACgCAEF/aiEZIARBAUghDANAIAJB4ABqIBVBAnQiFmohEyACQYABaiAVQQN0IhRqKwMAIR4gAkGgAWogFGorAwAhHSACQcABaiAUaisDACEbIAJB4AFqIBRqKwMAIRwCQAJAAkACQCAXDgQAAgIBAgtDAMB5xCEiAkACQAJAAkACQAJAAkACQAJAAkACQAJAAkACQAJAAkAgGQ4QAAECAwQFBgcICQoLDA0ODxILIAwNESAcIByiIRogGyAboiEfQQAhFANAIBogH6EhGiAUQQFqIRQCQCAbIBwgHKCiIB6gIhsgG6IiHyAaIB2gIhwgHKIiGqAiDUQAAAAAgIQuQWUNACAUskN3c/hCkiANtrwiFLNDAAAANJRDd3P4wpIgFEH///8DcUGAgID4A3K+IiJDdb+/v5SSQ6Pp3L8gIkP5RLQ+kpWSQwAAAD+UvCIUs0MAAAC0lJIgFEH///8DcUGAgID4A3K+IiJDdb+/P5SSQ6Pp3D8gIkP5RLQ+kpWSISIMEwsgHCEcIAQgFEcNAAwSCwsgDA0QIBwgHKIhGiAbIBuiIR9BACEUA0AgGkQAAAAAAAAIQKIhDSAUQQFqIRQCQCAcIBogH0QAAAAAAAAIQKKhoiAdoCIcIByiIhogDSAfoSAboiAeoCIbIBuiIh+gIg1EAAAAAICELkFlDQAgFLIgDba8IhSzQwAAADSUQ3dz+MKSIBRB////A3FBgICA+ANyviIiQ3W/v7+UkkOj6dy/ICJD+US0PpKVkkMAAAA/lLwiFLNDAAAANJRDd3P4wpIgFEH///8DcUGAgID4A3K+IiJDdb+/v5SSQ6Pp3L8gIkP5RLQ+kpWSQ52EIb+UkiEiDBILIB8hHyAEIBRHDQAMEQsLIAwNDyAcIByiIR8gGyAboiEaQQAhFANAIBogGqIhDSAaRAAAAAAAABjAoiEgIBRBAWohFAJAIBtEAAAAAAAAEECiIB8gGqGiIByiIB6gIhsgG6IiGiANIB2gIB8gIKAgH6KgIhwgHKIiH6AiDUQAAAAAgIQuQWUNACAUsiANtrwiFLNDAAAANJRDd3P4wpIgFEH///8DcUGAgID4A3K+IiJDdb+/v5SSQ6Pp3L8gIkP5RLQ+kpWSQwAAAD+UvCIUs0MAAAA0lEN3c/jCkiAUQf///wNxQYCAgPgDcr4iIkN1v7+/lJJDo+ncvyAiQ/lEtD6SlZJDAAAAP5STISIMEQsgHyEfIBwhHCAEIBRHDQAMEAsLIAwNDiAcIByiIRogGyAboiIfIB+iIQ1BACEUA0AgFEEBaiEUAkAgGkQAAAAAAAAUQKIgH0QAAAAAAAAkQKIiIKEgGqIgDaAgG6IgHqAiGyAboiIfIBogIKEgGqIgDUQAAAAAAAAUQKKgIByiIB2gIhwgHKIiGqAiDUQAAAAAgIQuQWUNACAUsiANtrwiFLNDAAAANJRDd3P4wpIgFEH///8DcUGAgID4A3K+IiJDdb+/v5SSQ6Pp3L8gIkP5RLQ+kpWSQwAAAD+UvCIUs0MAAAA0lEN3c/jCkiAUQf///wNxQYCAgPgDcr4iIkN1v7+/lJJDo+ncvyAiQ/lEtD6SlZJDo4HcvpSSISIMEAsgHyAfoiENIBohGiAEIBRHDQAMDwsLIAwNDSAcIByiIiAgIKIhHyAbIBuiIhogGqIhDUEAIRQDQCAfRAAAAAAAAC5AoiANoCAaoiEhIBRBAWohFAJAIBwgG6IgHyANoEQAAAAAAAAYQKIgGkQAAAAAAAA0wKIgIKKgoiAeoCIbIBuiIhogICANRAAAAAAAAC5AoiAfoKIgIaEgHaAiISAhoiIcoCIfRAAAAACAhC5BZQ0AIBSyIB+2vCIUs0MAAAA0lEN3c/jCkiAUQf///wNxQYCAgPgDcr4iIkN1v7+/lJJDo+ncvyAiQ/lEtD6SlZJDAAAAP5S8IhSzQwAAADSUQ3dz+MKSIBRB////A3FBgICA+ANyviIiQ3W/v7+UkkOj6dy/ICJD+US0PpKVkkOSEca+lJIhIgwPCyAaIBqiIQ0gHCAcoiEfIBwhICAhIRwgBCAURw0ADA4LCyAMDQwgHv0UIB39IgEhJCAb/RQgHP0iASIlICX98gEiJv0hASEbICb9IQAhHCAmICb98gEhJkEAIRQDQCAUQQFqIRQCQCAb/RT9DAAAAAAAABxAAAAAAACAQUD98gEgHP0UIif9DAAAAAAAgEHAAAAAAAAAHMD98gH98AEgJiAm/Q0ICQoLDA0ODwABAgMEBQYH/fIBIBtEAAAAAAAANUCi/RQgG/0iASAnIBxEAAAAAAAANUCi/SIB/fEBICb98gH98AEgJf3yASAk/fABIiUgJf3yASIm/SEBIhsgJv0hACIcoCIeRAAAAACAhC5BZQ0AIBSyIB62vCIUs0MAAAA0lEN3c/jCkiAUQf///wNxQYCAgPgDcr4iIkN1v7+/lJJDo+ncvyAiQ/lEtD6SlZJDAAAAP5S8IhSzQwAAADSUQ3dz+MKSIBRB////A3FBgICA+ANyviIiQ3W/v7+UkkOj6dy/ICJD+US0PpKVkkPKYLa+lJIhIgwOCyAmICb98gEhJiAEIBRHDQAMDQsLIAwNCyAcIByiIRogGyAboiEfQQAhFANAIBogH6EhGiAUQQFqIRQCQCAbIBwgHKCimSAeoCIbIBuiIh8gGiAdoCIcIByiIhqgIg1EAAAAAICELkFlDQAgFLJDd3P4QpIgDba8IhSzQwAAADSUQ3dz+MKSIBRB////A3FBgICA+ANyviIiQ3W/v7+UkkOj6dy/ICJD+US0PpKVkkMAAAA/lLwiFLNDAAAAtJSSIBRB////A3FBgICA+ANyviIiQ3W/vz+UkkOj6dw/ICJD+US0PpKVkiEiDA0LIBwhHCAEIBRHDQAMDAsLIAwNCiAcIByiIRogGyAboiEfQQAhFANAIBpEAAAAAAAACECiIQ0gFEEBaiEUAkAgHJkgGiAfRAAAAAAAAAhAoqGiIB2gIhwgHKIiGiANIB+hIBuZoiAeoCIbIBuiIh+gIg1EAAAAAICELkFlDQAgFLIgDba8IhSzQwAAADSUQ3dz+MKSIBRB////A3FBgICA+ANyviIiQ3W/v7+UkkOj6dy/ICJD+US0PpKVkkMAAAA/lLwiFLNDAAAANJRDd3P4wpIgFEH///8DcUGAgID4A3K+IiJDdb+/v5SSQ6Pp3L8gIkP5RLQ+kpWSQ52EIb+UkiEiDAwLIB8hHyAEIBRHDQAMCwsLIAwNCSAcIByiIRogGyAboiEfQQAhFANAIB8gGkQAAAAAAAAYwKKgIB+iIQ0gFEEBaiEUAkAgG0QAAAAAAAAQQKIgHKKZIBogH6GiIB6gIhsgG6IiHyANIBogGqIgHaCgIhwgHKIiGqAiDUQAAAAAgIQuQWUNACAUsiANtrwiFLNDAAAANJRDd3P4wpIgFEH///8DcUGAgID4A3K+IiJDdb+/v5SSQ6Pp3L8gIkP5RLQ+kpWSQwAAAD+UvCIUs0MAAAA0lEN3c/jCkiAUQf///wNxQYCAgPgDcr4iIkN1v7+/lJJDo+ncvyAiQ/lEtD6SlZJDAAAAP5STISIMCwsgGiEaIBwhHCAEIBRHDQAMCgsLIAwNCCAcIByiIRogGyAboiEfQQAhFANAIBogH6EhGiAUQQFqIRQCQCAbIBwgHKCiIB6gIhsgG6IiHyAamSAdoCIcIByiIhqgIg1EAAAAAICELkFlDQAgFLJDd3P4QpIgDba8IhSzQwAAADSUQ3dz+MKSIBRB////A3FBgICA+ANyviIiQ3W/v7+UkkOj6dy/ICJD+US0PpKVkkMAAAA/lLwiFLNDAAAAtJSSIBRB////A3FBgICA+ANyviIiQ3W/vz+UkkOj6dw/ICJD+US0PpKVkiEiDAoLIBwhHCAEIBRHDQAMCQsLIAwNByAcmSEfIBuaIRsgHCAcoiEaQQAhFANAIBRBAWohFAJAIBogGyAboqEgHaAiHCAcoiIaIB9EAAAAAAAAAMCiIBuiIB6hIhsgG6KgIh9EAAAAAICELkFlDQAgFLJDd3P4QpIgH7a8IhSzQwAAADSUQ3dz+MKSIBRB////A3FBgICA+ANyviIiQ3W/v7+UkkOj6dy/ICJD+US0PpKVkkMAAAA/lLwiFLNDAAAAtJSSIBRB////A3FBgICA+ANyviIiQ3W/vz+UkkOj6dw/ICJD+US0PpKVkiEiDAkLIByZIR8gGyEbIAQgFEcNAAwICwsgDA0GIBwgHKIhGiAbIBuiIR9BACEUA0AgHJkiHCAfoCENIBRBAWohFAJAIBwgG5kiGyAboKIgG6EgHqAiGyAboiIfIB0gDaEgGqAiHCAcoiIaoCINRAAAAACAhC5BZQ0AIBSyQ3dz+EKSIA22vCIUs0MAAAA0lEN3c/jCkiAUQf///wNxQYCAgPgDcr4iIkN1v7+/lJJDo+ncvyAiQ/lEtD6SlZJDAAAAP5S8IhSzQwAAALSUkiAUQf///wNxQYCAgPgDcr4iIkN1v78/lJJDo+ncPyAiQ/lEtD6SlZIhIgwICyAEIBRHDQAMBwsLIAwNBSAcIByiIRogGyAboiEfQQAhFANAIBogH6EhGiAUQQFqIRQCQCAeIBsgHCAcoKKhIhsgG6IiHyAaIB2gIhwgHKIiGqAiDUQAAAAAgIQuQWUNACAUskN3c/hCkiANtrwiFLNDAAAANJRDd3P4wpIgFEH///8DcUGAgID4A3K+IiJDdb+/v5SSQ6Pp3L8gIkP5RLQ+kpWSQwAAAD+UvCIUs0MAAAC0lJIgFEH///8DcUGAgID4A3K+IiJDdb+/P5SSQ6Pp3D8gIkP5RLQ+kpWSISIMBwsgHCEcIAQgFEcNAAwGCwsgDA0EIBwgHKIhGiAbIBuiIR9BASEYQQAhFANAAkACQCAYQQpHDQAgGyAcIBygopkhG0EBIRgMAQsgGEEBaiEYIBsgHCAcoKIhGwsgFEEBaiEUAkAgGyAeoCIbIBuiIg0gGiAfoSAdoCIcIByiIhqgIh9EAAAAAICELkFlDQAgFLJDd3P4QpIgH7a8IhSzQwAAADSUQ3dz+MKSIBRB////A3FBgICA+ANyviIiQ3W/v7+UkkOj6dy/ICJD+US0PpKVkkMAAAA/lLwiFLNDAAAAtJSSIBRB////A3FBgICA+ANyviIiQ3W/vz+UkkOj6dw/ICJD+US0PpKVkiEiDAYLIA0hHyAEIBRHDQAMBQsLIAwNAyAcIByiIRogGyAboiEfQQEhGEEAIRQDQCAaRAAAAAAAAAhAoiENIBRBAWohFAJAIByZIBwgGEEKRiITGyAaIB9EAAAAAAAACECioaIgHaAiHCAcoiIaIBuZIBsgExsgDSAfoaIgHqAiGyAboiIfoCINRAAAAACAhC5BZQ0AIBSyIA22vCIUs0MAAAA0lEN3c/jCkiAUQf///wNxQYCAgPgDcr4iIkN1v7+/lJJDo+ncvyAiQ/lEtD6SlZJDAAAAP5S8IhSzQwAAADSUQ3dz+MKSIBRB////A3FBgICA+ANyviIiQ3W/v7+UkkOj6dy/ICJD+US0PpKVkkOdhCG/lJIhIgwFC0EBIBhBAWogExshGCAfIR8gBCAURw0ADAQLCyAMDQIgHCAcoiEfIBsgG6IhGkEBIRhBACEUA0ACQAJAIBhBCkcNACAbRAAAAAAAABBAoiAcopkgHyAaoaIhGyAaIB9EAAAAAAAAGMCioCAaoiEcIB8gH6IhH0EBIRgMAQsgG0QAAAAAAAAQQKIgHyAaoaIgHKIhGyAYQQFqIRggHyAaRAAAAAAAABjAoqAgH6IhHCAaIBqiIR8LIBRBAWohFAJAIBsgHqAiGyAboiIaIB8gHaAgHKAiHCAcoiIfoCINRAAAAACAhC5BZQ0AIBSyIA22vCIUs0MAAAA0lEN3c/jCkiAUQf///wNxQYCAgPgDcr4iIkN1v7+/lJJDo+ncvyAiQ/lEtD6SlZJDAAAAP5S8IhSzQwAAADSUQ3dz+MKSIBRB////A3FBgICA+ANyviIiQ3W/v7+UkkOj6dy/ICJD+US0PpKVkkMAAAA/lJMhIgwECyAEIBRHDQAMAwsLQwDAecQhIgJAAkACQAJAAkACQAJAAkACQAJAAkACQAJAAkACQAJAIBkOEAABAgMEBQYHCAkKCwwNDg8RCyAMDRAgHCAcoiEfIBsgG6IhDUEAIRQDQCAUQQFqIRQCQCAfIA2hIB2gIhogGqIiHyAcIBsgG6CiIB6gIhsgG6IiDaAiHEQAAAAAgIQuQWUNACATIBtEAAAAYJ6g9j+iIBogG6AiHiAeoiAbIBqhIhsgG6Kgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCACAUskN3c/hCkiActrwiFLNDAAAANJRDd3P4wpIgFEH///8DcUGAgID4A3K+IiJDdb+/v5SSQ6Pp3L8gIkP5RLQ+kpWSQwAAAD+UvCIUs0MAAAC0lJIgFEH///8DcUGAgID4A3K+IiJDdb+/P5SSQ6Pp3D8gIkP5RLQ+kpWSISIMEgsgGiEcIAQgFEcNAAwRCwsgDA0PIBwgHKIhGiAbIBuiIR9BACEUA0AgGkQAAAAAAAAIQKIhDSAUQQFqIRQCQCAaIB9EAAAAAAAACECioSAcoiAdoCIcIByiIhogDSAfoSAboiAeoCIbIBuiIh+gIg1EAAAAAICELkFlDQAgEyAbRAAAAGCeoPY/oiAcIBugIh4gHqIgGyAcoSIbIBuioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgAgFLIgDba8IhSzQwAAADSUQ3dz+MKSIBRB////A3FBgICA+ANyviIiQ3W/v7+UkkOj6dy/ICJD+US0PpKVkkMAAAA/lLwiFLNDAAAANJRDd3P4wpIgFEH///8DcUGAgID4A3K+IiJDdb+/v5SSQ6Pp3L8gIkP5RLQ+kpWSQ52EIb+UkiEiDBELIB8hHyAEIBRHDQAMEAsLIAwNDiAcIByiIR8gGyAboiEaQQAhFANAIB8gGqEhDSAcRAAAAAAAABBAoiEgIBRBAWohFAJAIBogGqIgHaAgHyAaRAAAAAAAABjAoqAgH6KgIhwgHKIiHyANICAgG6KiIB6gIhsgG6IiGqAiDUQAAAAAgIQuQWUNACATIBtEAAAAYJ6g9j+iIBwgG6AiHiAeoiAbIByhIhsgG6Kgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCACAUsiANtrwiFLNDAAAANJRDd3P4wpIgFEH///8DcUGAgID4A3K+IiJDdb+/v5SSQ6Pp3L8gIkP5RLQ+kpWSQwAAAD+UvCIUs0MAAAA0lEN3c/jCkiAUQf///wNxQYCAgPgDcr4iIkN1v7+/lJJDo+ncvyAiQ/lEtD6SlZJDAAAAP5STISIMEAsgGiEaIAQgFEcNAAwPCwsgDA0NIBwgHKIhGiAbIBuiIh8gH6IhDUEAIRQDQCAUQQFqIRQCQCAaRAAAAAAAABRAoiAfRAAAAAAAACRAoiIgoSAaoiANoCAboiAeoCIbIBuiIh8gGiAgoSAaoiANRAAAAAAAABRAoqAgHKIgHaAiHCAcoiIaoCINRAAAAACAhC5BZQ0AIBMgG0QAAABgnqD2P6IgGyAcoCIeIB6iIBsgHKEiGyAboqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIAIBSyIA22vCIUs0MAAAA0lEN3c/jCkiAUQf///wNxQYCAgPgDcr4iIkN1v7+/lJJDo+ncvyAiQ/lEtD6SlZJDAAAAP5S8IhSzQwAAADSUQ3dz+MKSIBRB////A3FBgICA+ANyviIiQ3W/v7+UkkOj6dy/ICJD+US0PpKVkkOjgdy+lJIhIgwPCyAfIB+iIQ0gGiEaIAQgFEcNAAwOCwsgDA0MIBwgHKIiICAgoiEfIBsgG6IiGiAaoiENQQAhFANAIB9EAAAAAAAALkCiIA2gIBqiISEgFEEBaiEUAkAgGyAcoiAfIA2gRAAAAAAAABhAoiAgRAAAAAAAADTAoiAaoqCiIB6gIhsgG6IiGiANRAAAAAAAAC5AoiAfoCAgoiAhoSAdoCIcIByiIiCgIh9EAAAAAICELkFlDQAgEyAbRAAAAGCeoPY/oiAbIBygIh4gHqIgGyAcoSIbIBuioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgAgFLIgH7a8IhSzQwAAADSUQ3dz+MKSIBRB////A3FBgICA+ANyviIiQ3W/v7+UkkOj6dy/ICJD+US0PpKVkkMAAAA/lLwiFLNDAAAANJRDd3P4wpIgFEH///8DcUGAgID4A3K+IiJDdb+/v5SSQ6Pp3L8gIkP5RLQ+kpWSQ5IRxr6UkiEiDA4LIBogGqIhDSAgICCiIR8gHCEcICAhICAEIBRHDQAMDQsLIAwNCyAcIByiIhogGqIhDSAbIBuiIh8gH6IhIEEAIRQDQCAaRAAAAAAAABxAoiEhIBpEAAAAAAAANUCiIQggFEEBaiEUAkAgDSAaIB9EAAAAAAAANUCioaIgGkQAAAAAAIBBQKIgH0QAAAAAAAAcQKKhICCioCAcoiAdoCIcIByiIhogDSAhIB9EAAAAAACAQUCioaIgICAIIB+hoqAgG6IgHqAiGyAboiIfoCINRAAAAACAhC5BZQ0AIBMgG0QAAABgnqD2P6IgHCAboCIeIB6iIBsgHKEiGyAboqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIAIBSyIA22vCIUs0MAAAA0lEN3c/jCkiAUQf///wNxQYCAgPgDcr4iIkN1v7+/lJJDo+ncvyAiQ/lEtD6SlZJDAAAAP5S8IhSzQwAAADSUQ3dz+MKSIBRB////A3FBgICA+ANyviIiQ3W/v7+UkkOj6dy/ICJD+US0PpKVkkPKYLa+lJIhIgwNCyAfIB+iISAgGiAaoiENIB8hHyAEIBRHDQAMDAsLIAwNCiAcIByiIR8gGyAboiENQQAhFANAIBRBAWohFAJAIB8gDaEgHaAiGiAaoiIfIBwgGyAboKKZIB6gIhsgG6IiDaAiHEQAAAAAgIQuQWUNACATIBtEAAAAYJ6g9j+iIBogG6AiHiAeoiAbIBqhIhsgG6Kgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCACAUskN3c/hCkiActrwiFLNDAAAANJRDd3P4wpIgFEH///8DcUGAgID4A3K+IiJDdb+/v5SSQ6Pp3L8gIkP5RLQ+kpWSQwAAAD+UvCIUs0MAAAC0lJIgFEH///8DcUGAgID4A3K+IiJDdb+/P5SSQ6Pp3D8gIkP5RLQ+kpWSISIMDAsgGiEcIAQgFEcNAAwLCwsgDA0JIBwgHKIhGiAbIBuiIR9BACEUA0AgGkQAAAAAAAAIQKIhDSAUQQFqIRQCQCAaIB9EAAAAAAAACECioSAcmaIgHaAiHCAcoiIaIA0gH6EgG5miIB6gIhsgG6IiH6AiDUQAAAAAgIQuQWUNACATIBtEAAAAYJ6g9j+iIBwgG6AiHiAeoiAbIByhIhsgG6Kgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCACAUsiANtrwiFLNDAAAANJRDd3P4wpIgFEH///8DcUGAgID4A3K+IiJDdb+/v5SSQ6Pp3L8gIkP5RLQ+kpWSQwAAAD+UvCIUs0MAAAA0lEN3c/jCkiAUQf///wNxQYCAgPgDcr4iIkN1v7+/lJJDo+ncvyAiQ/lEtD6SlZJDnYQhv5SSISIMCwsgHyEfIAQgFEcNAAwKCwsgDA0IIBwgHKIhHyAbIBuiIRpBACEUA0AgFEEBaiEUAkAgGiAaoiAdoCAfIBpEAAAAAAAAGMCioCAfoqAiDSANoiIgIB8gGqEgHEQAAAAAAAAQQKIgG6KZoiAeoCIbIBuiIhqgIhxEAAAAAICELkFlDQAgEyAbRAAAAGCeoPY/oiANIBugIh4gHqIgGyANoSIbIBuioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgAgFLIgHLa8IhSzQwAAADSUQ3dz+MKSIBRB////A3FBgICA+ANyviIiQ3W/v7+UkkOj6dy/ICJD+US0PpKVkkMAAAA/lLwiFLNDAAAANJRDd3P4wpIgFEH///8DcUGAgID4A3K+IiJDdb+/v5SSQ6Pp3L8gIkP5RLQ+kpWSQwAAAD+UkyEiDAoLIA0hHCAgIR8gBCAURw0ADAkLCyAMDQcgHCAcoiEaIBsgG6IhH0EAIRQDQCAcIBsgG6CiIRsgFEEBaiEUAkAgGiAfoZkgHaAiHCAcoiIaIBsgHqAiGyAboiIfoCINRAAAAACAhC5BZQ0AIBMgG0QAAABgnqD2P6IgHCAboCIeIB6iIBsgHKEiGyAboqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIAIBSyQ3dz+EKSIA22vCIUs0MAAAA0lEN3c/jCkiAUQf///wNxQYCAgPgDcr4iIkN1v7+/lJJDo+ncvyAiQ/lEtD6SlZJDAAAAP5S8IhSzQwAAALSUkiAUQf///wNxQYCAgPgDcr4iIkN1v78/lJJDo+ncPyAiQ/lEtD6SlZIhIgwJCyAfIR8gBCAURw0ADAgLCyAMDQYgHJkhGiAbmiEbIBwgHKIhHEEAIRQDQCAaRAAAAAAAAADAoiEfIBRBAWohFCAcIBsgG6KhIB2gIhyZIRoCQCAcIByiIhwgHyAboiAeoSIbIBuioCIfRAAAAACAhC5BZQ0AIBMgG0QAAABgnqD2P6IgGiAboCIcIByiIBsgGqEiGyAboqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIAIBSyQ3dz+EKSIB+2vCIUs0MAAAA0lEN3c/jCkiAUQf///wNxQYCAgPgDcr4iIkN1v7+/lJJDo+ncvyAiQ/lEtD6SlZJDAAAAP5S8IhSzQwAAALSUkiAUQf///wNxQYCAgPgDcr4iIkN1v78/lJJDo+ncPyAiQ/lEtD6SlZIhIgwICyAbIRsgBCAURw0ADAcLCyAMDQUgHCAcoiEaIBsgG6IhH0EAIRQDQCAcmSIcIB+gIQ0gFEEBaiEUAkAgHCAbmSIbIBugoiAboSAeoCIbIBuiIh8gHSAaoCANoSIcIByiIhqgIg1EAAAAAICELkFlDQAgEyAbRAAAAGCeoPY/oiAbIBygIh4gHqIgGyAcoSIbIBuioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgAgFLJDd3P4QpIgDba8IhSzQwAAADSUQ3dz+MKSIBRB////A3FBgICA+ANyviIiQ3W/v7+UkkOj6dy/ICJD+US0PpKVkkMAAAA/lLwiFLNDAAAAtJSSIBRB////A3FBgICA+ANyviIiQ3W/vz+UkkOj6dw/ICJD+US0PpKVkiEiDAcLIAQgFEcNAAwGCwsgDA0EIBwgHKIhHyAbIBuiIQ1BACEUA0AgFEEBaiEUAkAgHyANoSAdoCIaIBqiIh8gHiAcIBsgG6CioSIbIBuiIg2gIhxEAAAAAICELkFlDQAgEyAbRAAAAGCeoPY/oiAaIBugIh4gHqIgGyAaoSIbIBuioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgAgFLJDd3P4QpIgHLa8IhSzQwAAADSUQ3dz+MKSIBRB////A3FBgICA+ANyviIiQ3W/v7+UkkOj6dy/ICJD+US0PpKVkkMAAAA/lLwiFLNDAAAAtJSSIBRB////A3FBgICA+ANyviIiQ3W/vz+UkkOj6dw/ICJD+US0PpKVkiEiDAYLIBohHCAEIBRHDQAMBQsLIAwNAyAcIByiIRogGyAboiEfQQEhGEEAIRQDQAJAAkAgGEEKRw0AIBwgGyAboKKZIRtBASEYDAELIBhBAWohGCAcIBsgG6CiIRsLIBRBAWohFAJAIBsgHqAiGyAboiINIBogH6EgHaAiHCAcoiIaoCIfRAAAAACAhC5BZQ0AIBMgG0QAAABgnqD2P6IgGyAcoCIeIB6iIBsgHKEiGyAboqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIAIBSyQ3dz+EKSIB+2vCIUs0MAAAA0lEN3c/jCkiAUQf///wNxQYCAgPgDcr4iIkN1v7+/lJJDo+ncvyAiQ/lEtD6SlZJDAAAAP5S8IhSzQwAAALSUkiAUQf///wNxQYCAgPgDcr4iIkN1v78/lJJDo+ncPyAiQ/lEtD6SlZIhIgwFCyANIR8gBCAURw0ADAQLCyAMDQIgHCAcoiEaIBsgG6IhH0EBIRhBACEUA0AgGiAfRAAAAAAAAAjAoqAhDQJAAkAgGEEKRw0AIBpEAAAAAAAACECiIB+hIR8gG5khICAcmSEcQQEhGAwBCyAYQQFqIRggGkQAAAAAAAAIQKIgH6EhICAbIR8LIBRBAWohFAJAIA0gHKIgHaAiHCAcoiIaICAgH6IgHqAiGyAboiIfoCINRAAAAACAhC5BZQ0AIBMgG0QAAABgnqD2P6IgHCAboCIeIB6iIBsgHKEiGyAboqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIAIBSyIA22vCIUs0MAAAA0lEN3c/jCkiAUQf///wNxQYCAgPgDcr4iIkN1v7+/lJJDo+ncvyAiQ/lEtD6SlZJDAAAAP5S8IhSzQwAAADSUQ3dz+MKSIBRB////A3FBgICA+ANyviIiQ3W/v7+UkkOj6dy/ICJD+US0PpKVkkOdhCG/lJIhIgwECyAEIBRHDQAMAwsLIAwNASAcIByiIR8gGyAboiEaQQEhGEEAIRQDQCAaRAAAAAAAABhAoiENAkACQCAYQQpHDQAgHyAaoSAcRAAAAAAAABBAoiAbopmiIRsgHyANoSAfoiAaIBqioCEcQQEhGAwBCyAcRAAAAAAAABBAoiAboiAfIBqhoiEbIBhBAWohGCAfIA2hIB+iIBogGqKgIRwLIBRBAWohFAJAIBwgHaAiHCAcoiIfIBsgHqAiGyAboiIaoCINRAAAAACAhC5BZQ0AIBMgG0QAAABgnqD2P6IgHCAboCIeIB6iIBsgHKEiGyAboqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIAIBSyIA22vCIUs0MAAAA0lEN3c/jCkiAUQf///wNxQYCAgPgDcr4iIkN1v7+/lJJDo+ncvyAiQ/lEtD6SlZJDAAAAP5S8IhSzQwAAADSUQ3dz+MKSIBRB////A3FBgICA+ANyviIiQ3W/v7+UkkOj6dy/ICJD+US0PpKVkkMAAAA/lJMhIgwDCyAEIBRHDQAMAgsLQwDAecQhIgJAAkACQAJAAkACQAJAAkACQAJAAkACQAJAAkACQAJAIBkOEAABAgMEBQYHCAkKCwwNDg8QCyAMDQ8gHCAcoiENIBsgG6IhIEQAAAAAAAAAACEaRAAAAAAAAPA/IR9BACEUA0AgHyAcoiAaIBuioSIhICGgRAAAAAAAAPA/oCEhIBogHKIgHyAboqAiGiAaoCEaIBRBAWohFAJAIA0gIKEgHaAiHyAfoiINIBwgGyAboKIgHqAiGyAboiIgoCIcRAAAAACAhC5BZQ0AIBMgISAfoiAaIBuioCAhICGiIBogGqKgIh2jIh4gISAboiAaIB+ioSAdoyIboEQAAABgnqDmP6IgHiAeoiAbIBuioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgAgFLJDd3P4QpIgHLa8IhSzQwAAADSUQ3dz+MKSIBRB////A3FBgICA+ANyviIiQ3W/v7+UkkOj6dy/ICJD+US0PpKVkkMAAAA/lLwiFLNDAAAAtJSSIBRB////A3FBgICA+ANyviIiQ3W/vz+UkkOj6dw/ICJD+US0PpKVkiEiDBELIB8hHCAbIRsgISEfIAQgFEcNAAwQCwsgDA0OIBwgHKIhGiAbIBuiIR9EAAAAAAAAAAAhIEQAAAAAAADwPyENQQAhFANAIBsgHCAcoKIiCCANoiAaIB+hIgkgIKKgRAAAAAAAAAhAoiEhIAkgDaIgCCAgoqFEAAAAAAAACECiRAAAAAAAAPA/oCENIBpEAAAAAAAACECiISAgFEEBaiEUAkAgHCAaIB9EAAAAAAAACECioaIgHaAiHCAcoiIaICAgH6EgG6IgHqAiGyAboiIfoCIgRAAAAACAhC5BZQ0AIBMgDSAcoiAhIBuioCANIA2iICEgIaKgIh2jIh4gDSAboiAhIByioSAdoyIboEQAAABgnqDmP6IgHiAeoiAbIBuioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgAgFLIgILYQlICAgABDnYQhv5SSISIMEAsgHyEfICEhICAEIBRHDQAMDwsLIAwNDSAcIByiIR8gGyAboiEaRAAAAAAAAAAAIQ1EAAAAAAAA8D8hIEEAIRQDQCAcIA2iIBsgIKKgIiEgHyAaoSIIRAAAAAAAABBAoiIJoiAcIBuiIgpEAAAAAAAAIECiIgsgHCAgoiAbIA2ioSIboqAhDSAbIAmiIAsgIaKhRAAAAAAAAPA/oCEgIBogGqIhHCAaRAAAAAAAABjAoiEhIBRBAWohFAJAIAggCqJEAAAAAAAAEECiIB6gIhsgG6IiGiAcIB2gIB8gIaAgH6KgIhwgHKIiH6AiIUQAAAAAgIQuQWUNACATICAgHKIgGyANoqAgICAgoiANIA2ioCIdoyIeIBsgIKIgDSAcoqEgHaMiG6BEAAAAYJ6g5j+iIB4gHqIgGyAboqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIAIBSyICG2EJSAgIAAQwAAAL+UkiEiDA8LIAQgFEcNAAwOCwsgDA0MIBwgHKIhGiAbIBuiIh8gH6IhDUQAAAAAAAAAACEhRAAAAAAAAPA/ISBBACEUA0AgGiAfRAAAAAAAABjAoqAgGqIgDaBEAAAAAAAAFECiIgkgIaIgG0QAAAAAAAA0QKIgGiAfoaIgHKIiCiAgoqAhCCAJICCiIAogIaKhRAAAAAAAAPA/oCEgIBRBAWohFAJAIBpEAAAAAAAAFECiIB9EAAAAAAAAJECiIiGhIBqiIA2gIBuiIB6gIhsgG6IiHyAaICGhIBqiIA1EAAAAAAAAFECioCAcoiAdoCIcIByiIhqgIg1EAAAAAICELkFlDQAgEyAgIByiIAggG6KgICAgIKIgCCAIoqAiHaMiHiAgIBuiIAggHKKhIB2jIhugRAAAAGCeoOY/oiAeIB6iIBsgG6Kgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCACAUsiANthCUgICAAEOjgdy+lJIhIgwOCyAfIB+iIQ0gHCEcIBshGyAaIRogHyEfIAghISAEIBRHDQAMDQsLIAwNCyAcIByiIiAgIKIhHyAbIBuiIhogGqIhDUEAIRQDQCAfRAAAAAAAAC5AoiANoCAaoiEhIBRBAWohFAJAIBwgG6IgHyANoEQAAAAAAAAYQKIgGkQAAAAAAAA0wKIgIKKgoiAeoCIbIBuiIhogICANRAAAAAAAAC5AoiAfoKIgIaEgHaAiISAhoiIcoCIfRAAAAACAhC5BZQ0AIBSyIB+2vCIUs0MAAAA0lEN3c/jCkiAUQf///wNxQYCAgPgDcr4iIkN1v7+/lJJDo+ncvyAiQ/lEtD6SlZJDAAAAP5S8IhSzQwAAADSUQ3dz+MKSIBRB////A3FBgICA+ANyviIiQ3W/v7+UkkOj6dy/ICJD+US0PpKVkkOSEca+lJIhIgwNCyAaIBqiIQ0gHCAcoiEfIBwhICAhIRwgBCAURw0ADAwLCyAMDQogHv0UIB39IgEhJCAb/RQgHP0iASIlICX98gEiJv0hASEbICb9IQAhHCAmICb98gEhJkEAIRQDQCAUQQFqIRQCQCAb/RT9DAAAAAAAABxAAAAAAACAQUD98gEgHP0UIif9DAAAAAAAgEHAAAAAAAAAHMD98gH98AEgJiAm/Q0ICQoLDA0ODwABAgMEBQYH/fIBIBtEAAAAAAAANUCi/RQgG/0iASAnIBxEAAAAAAAANUCi/SIB/fEBICb98gH98AEgJf3yASAk/fABIiUgJf3yASIm/SEBIhsgJv0hACIcoCIeRAAAAACAhC5BZQ0AIBSyIB62vCIUs0MAAAA0lEN3c/jCkiAUQf///wNxQYCAgPgDcr4iIkN1v7+/lJJDo+ncvyAiQ/lEtD6SlZJDAAAAP5S8IhSzQwAAADSUQ3dz+MKSIBRB////A3FBgICA+ANyviIiQ3W/v7+UkkOj6dy/ICJD+US0PpKVkkPKYLa+lJIhIgwMCyAmICb98gEhJiAEIBRHDQAMCwsLIAwNCSAcIByiIQ0gGyAboiEgRAAAAAAAAAAAIRpEAAAAAAAA8D8hH0EAIRQDQCAfIByiIBogG6KhIiEgIaBEAAAAAAAA8D+gISEgGiAcoiAfIBuioCIaIBqgIRogFEEBaiEUAkAgDSAgoSAdoCIfIB+iIg0gHCAbIBugopkgHqAiGyAboiIgoCIcRAAAAACAhC5BZQ0AIBMgISAfoiAaIBuioCAhICGiIBogGqKgIh2jIh4gISAboiAaIB+ioSAdoyIboEQAAABgnqDmP6IgHiAeoiAbIBuioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgAgFLJDd3P4QpIgHLa8IhSzQwAAADSUQ3dz+MKSIBRB////A3FBgICA+ANyviIiQ3W/v7+UkkOj6dy/ICJD+US0PpKVkkMAAAA/lLwiFLNDAAAAtJSSIBRB////A3FBgICA+ANyviIiQ3W/vz+UkkOj6dw/ICJD+US0PpKVkiEiDAsLIB8hHCAbIRsgISEfIAQgFEcNAAwKCwsgDA0IIBwgHKIhGiAbIBuiIR9EAAAAAAAAAAAhIEQAAAAAAADwPyENQQAhFANAIBsgHCAcoKIiCCANoiAaIB+hIgkgIKKgRAAAAAAAAAhAoiEhIAkgDaIgCCAgoqFEAAAAAAAACECiRAAAAAAAAPA/oCENIBpEAAAAAAAACECiISAgFEEBaiEUAkAgHJkgGiAfRAAAAAAAAAhAoqGiIB2gIhwgHKIiGiAbmSAgIB+hoiAeoCIbIBuiIh+gIiBEAAAAAICELkFlDQAgEyANIByiICEgG6KgIA0gDaIgISAhoqAiHaMiHiANIBuiICEgHKKhIB2jIhugRAAAAGCeoOY/oiAeIB6iIBsgG6Kgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCACAUsiAgthCUgICAAEOdhCG/lJIhIgwKCyAfIR8gISEgIAQgFEcNAAwJCwsgDA0HIBwgHKIhHyAbIBuiIRpEAAAAAAAAAAAhDUQAAAAAAADwPyEgQQAhFANAIBwgDaIgGyAgoqAiISAfIBqhIghEAAAAAAAAEECiIgmiIBwgG6IiCkQAAAAAAAAgQKIiCyAcICCiIBsgDaKhIhuioCENIBsgCaIgCyAhoqFEAAAAAAAA8D+gISAgGiAaoiEcIBpEAAAAAAAAGMCiISEgFEEBaiEUAkAgCkQAAAAAAAAQQKKZIAiiIB6gIhsgG6IiGiAcIB2gIB8gIaAgH6KgIhwgHKIiH6AiIUQAAAAAgIQuQWUNACATICAgHKIgGyANoqAgICAgoiANIA2ioCIdoyIeIBsgIKIgDSAcoqEgHaMiG6BEAAAAYJ6g5j+iIB4gHqIgGyAboqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIAIBSyICG2EJSAgIAAQwAAAL+UkiEiDAkLIAQgFEcNAAwICwsgDA0GIBwgHKIhGiAbIBuiIR9BACEUA0AgGiAfoSEaIBRBAWohFAJAIBsgHCAcoKIgHqAiGyAboiIfIBqZIB2gIhwgHKIiGqAiDUQAAAAAgIQuQWUNACAUskN3c/hCkiANtrwiFLNDAAAANJRDd3P4wpIgFEH///8DcUGAgID4A3K+IiJDdb+/v5SSQ6Pp3L8gIkP5RLQ+kpWSQwAAAD+UvCIUs0MAAAC0lJIgFEH///8DcUGAgID4A3K+IiJDdb+/P5SSQ6Pp3D8gIkP5RLQ+kpWSISIMCAsgHCEcIAQgFEcNAAwHCwsgDA0FIByZIR8gG5ohGyAcIByiIRpBACEUA0AgFEEBaiEUAkAgGiAbIBuioSAdoCIcIByiIhogH0QAAAAAAAAAwKIgG6IgHqEiGyAboqAiH0QAAAAAgIQuQWUNACAUskN3c/hCkiAftrwiFLNDAAAANJRDd3P4wpIgFEH///8DcUGAgID4A3K+IiJDdb+/v5SSQ6Pp3L8gIkP5RLQ+kpWSQwAAAD+UvCIUs0MAAAC0lJIgFEH///8DcUGAgID4A3K+IiJDdb+/P5SSQ6Pp3D8gIkP5RLQ+kpWSISIMBwsgHJkhHyAbIRsgBCAURw0ADAYLCyAMDQQgHCAcoiEaIBsgG6IhH0EAIRQDQCAcmSIcIB+gIQ0gFEEBaiEUAkAgHCAbmSIbIBugoiAboSAeoCIbIBuiIh8gHSANoSAaoCIcIByiIhqgIg1EAAAAAICELkFlDQAgFLJDd3P4QpIgDba8IhSzQwAAADSUQ3dz+MKSIBRB////A3FBgICA+ANyviIiQ3W/v7+UkkOj6dy/ICJD+US0PpKVkkMAAAA/lLwiFLNDAAAAtJSSIBRB////A3FBgICA+ANyviIiQ3W/vz+UkkOj6dw/ICJD+US0PpKVkiEiDAYLIAQgFEcNAAwFCwsgDA0DIBwgHKIhGiAbIBuiIR9BACEUA0AgGiAfoSEaIBRBAWohFAJAIB4gGyAcIBygoqEiGyAboiIfIBogHaAiHCAcoiIaoCINRAAAAACAhC5BZQ0AIBSyQ3dz+EKSIA22vCIUs0MAAAA0lEN3c/jCkiAUQf///wNxQYCAgPgDcr4iIkN1v7+/lJJDo+ncvyAiQ/lEtD6SlZJDAAAAP5S8IhSzQwAAALSUkiAUQf///wNxQYCAgPgDcr4iIkN1v78/lJJDo+ncPyAiQ/lEtD6SlZIhIgwFCyAcIRwgBCAURw0ADAQLCyAMDQIgHCAcoiEaIBsgG6IhH0EBIRhBACEUA0ACQAJAIBhBCkcNACAbIBwgHKCimSEbQQEhGAwBCyAYQQFqIRggGyAcIBygoiEbCyAUQQFqIRQCQCAbIB6gIhsgG6IiDSAaIB+hIB2gIhwgHKIiGqAiH0QAAAAAgIQuQWUNACAUskN3c/hCkiAftrwiFLNDAAAANJRDd3P4wpIgFEH///8DcUGAgID4A3K+IiJDdb+/v5SSQ6Pp3L8gIkP5RLQ+kpWSQwAAAD+UvCIUs0MAAAC0lJIgFEH///8DcUGAgID4A3K+IiJDdb+/P5SSQ6Pp3D8gIkP5RLQ+kpWSISIMBAsgDSEfIAQgFEcNAAwDCwsgDA0BIBwgHKIhGiAbIBuiIR9BASEYQQAhFANAIBpEAAAAAAAACECiIQ0gFEEBaiEUAkAgHJkgHCAYQQpGIhMbIBogH0QAAAAAAAAIQKKhoiAdoCIcIByiIhogG5kgGyATGyANIB+hoiAeoCIbIBuiIh+gIg1EAAAAAICELkFlDQAgFLIgDba8IhSzQwAAADSUQ3dz+MKSIBRB////A3FBgICA+ANyviIiQ3W/v7+UkkOj6dy/ICJD+US0PpKVkkMAAAA/lLwiFLNDAAAANJRDd3P4wpIgFEH///8DcUGAgID4A3K+IiJDdb+/v5SSQ6Pp3L8gIkP5RLQ+kpWSQ52EIb+UkiEiDAMLQQEgGEEBaiATGyEYIB8hHyAEIBRHDQAMAgsLIAwNACAcIByiIR8gGyAboiEaQQEhGEEAIRQDQAJAAkAgGEEKRw0AIBtEAAAAAAAAEECiIByimSAfIBqhoiEbIBogH0QAAAAAAAAYwKKgIBqiIRwgHyAfoiEfQQEhGAwBCyAbRAAAAAAAABBAoiAfIBqhoiAcoiEbIBhBAWohGCAfIBpEAAAAAAAAGMCioCAfoiEcIBogGqIhHwsgFEEBaiEUAkAgGyAeoCIbIBuiIhogHyAdoCAcoCIcIByiIh+gIg1EAAAAAICELkFlDQAgFLIgDba8IhSzQwAAADSUQ3dz+MKSIBRB////A3FBgICA+ANyviIiQ3W/v7+UkkOj6dy/ICJD+US0PpKVkkMAAAA/lLwiFLNDAAAANJRDd3P4wpIgFEH///8DcUGAgID4A3K+IiJDdb+/v5SSQ6Pp3L8gIkP5RLQ+kpWSQwAAAD+UkyEiDAILIAQgFEcNAAsLIAJB8ABqIBZqICI4AgAgFUEBaiIVIANHDQALCwJAIANBAU4NAEEAIQQMAgsgACgCCCAAKAJwIhdrQQJqIRkgACgClAEhDCAAKAKQASEAIBeyIShBACEEIAJB4ABqIRUgAkHwAGohFCABIRYDQCAAIBYoAgBBAnQiGGpDAMB5xCAUKgIAIiIgKJIiKSAiQwDAecRbIhMbOAIAIAwgGGogFSoCADgCACAZICn8ACAXa0EMaiATGyAEaiEEIBRBBGohFCAWQQRqIRYgFUEEaiEVIANBf2oiAw0ADAILCyAAKAIIIAAoAnAiF2tBAmohGSAAKAKUASEMIAAoApABIQAgF7IhKEEAIQQgAkHgAGohFSACQfAAaiEUIAEhFgNAIAAgFigCAEECdCIYakMAwHnEIBQqAgAiIiAokiIpICJDAMB5xFsiExs4AgAgDCAYaiAVKgIAOAIAIBkgKfwAIBdrQQxqIBMbIARqIQQgFEEEaiEUIBZBBGohFiAVQQRqIRUgA0F/aiIDDQALCyABQQA2AhALIAJBgAJqJICAgIAAIAQL+AQCD38BfUEAIQJBACEDQQAhBAJAIAAoAgAoAgAiBUECSA0AQQAhA0EAIQRBASEGA0AgAUEBdiIHQQFxIQgCQAJAIAcgAXNBAXEiB0UNACADIQkgBCEKDAELAkAgCA0AIAQhCSADIQoMAQsgBkF/aiIJIANrIQogCSAEayEJCyABQQJ1IQEgCSAHIAZsaiEDIAogCCAGbGohBCAGQQF0IgYgBUgNAAsLAkAgBCAAKAIEKAIATg0AIAMgACgCCCgCAE4NACAAKAIQKAIAIgEgACgCDCgCACIGIARsIgUgBmoiCCABIAhIGyEHQQAhAQJAIAYgA2wiCiAAKAIUKAIAIgggCiAGaiIGIAggBkgbIgtOIgkNACAHIAVMDQBBACEBIAohCANAIAUhBgNAIAAoAhggACgCHCAGIAggACgCECgCAGxqEI2AgIAAIAFqIQEgByAGQQFqIgZHDQALIAhBAWoiCCALRw0ACwsgACgCGCAAKAIcEI6AgIAAIAFqIQICQCAJDQAgByAFTA0AIAAoAhAhDCAHIAVrIQ0gACgCICIGKAIIIQkgBigCBCgCACEOIAYoAgwoAgAhDyAGKAIAKAIAIRADQCAQIAUgDCgCACAKbGpBAnQiCGohBiAPIAhqIQEgDiAIaiEIIA0hBwNAIAggCSAGKgIAIhEgASoCABCDgICAADYCAAJAIBFDAMB5xFsNACARQyIAgD9eDQAgBkGAgID8AzYCAAsgBkEEaiEGIAFBBGohASAIQQRqIQggB0F/aiIHDQALIApBAWoiCiALRw0ACwsgACgCJCgCACAAKAIEKAIAIANsIARqQQJ0aiACNgIACyACC7ECAQ5/QQAhBAJAIABBAkgNACAAIQVBACEEQQAhBgNAAkAgASAGayAFQQF2IgcgB2wiCEgNAEEAIAdrIQkDQEEBIQpBACELQQAhDCAGIQ0DQCANQQF2Ig5BAXEhDwJAAkAgDiANc0EBcSIORQ0AIAshECAMIREMAQsCQCAPDQAgDCEQIAshEQwBCyAKQX9qIhAgC2shESAQIAxrIRALIA1BAnYhDSAQIA4gCmxqIQsgESAPIApsaiEMIApBAXQiCiAASA0ACyAMIAlxIgogB2oiDSACIA0gAkgbIAprIgpBACAKQQBKGyALIAlxIgogB2oiDSADIA0gA0gbIAprIgpBACAKQQBKG2wgBGohBCABIAYgCGoiBmsgCE4NAAsLIAVBA0shCiAHIQUgCg0ACwsgBAvqDAgBfwJ+BH8BfgJ/AX4BfwN+I4CAgIAAQZAIayIDJICAgIAAAkACQAJAAkACQCAAKQOAAiIEIAEpA4ACIgVRDQAgAiEGAkAgAkEBSA0AIAAgAkEDdCIGaiEHIAEgBmohCCACIQYDQCAHKQMAIAgpAwBSDQEgB0F4aiEHIAhBeGohCCAGQQFKIQkgBkF/aiEGIAkNAAtBACEGCyAFIAQgACAGQQN0IgZqKQMAIAEgBmopAwBUIgcbIQpBACEGIAJBAEgNBCAAIAEgBxshCyABIAAgBxshDCACDQFCACENDAILQQAhBiAFIQogAkEASA0DAkACQCACDQBCACENDAELIAJBAWpBfnEhDkEAIQZCACENIANBiAJqIQcgACEIIAEhCQNAIAcgCCkDACIPIA18Ig0gCSkDAHwiEDcDACAHQQhqIA0gD1StIBAgDVStfCIPIAhBCGopAwB8Ig0gCUEIaikDAHwiEDcDACANIA9UrSAQIA1UrXwhDSAIQRBqIQggCUEQaiEJIAdBEGohByAOIAZBAmoiBkcNAAsgBSEKIAJBAXENBAsgACAGQQN0IgdqKQMAIA18IAEgB2opAwB8IQ0gBSEKDAILIAJBAWpBfnEhDkEAIQZCACENIANBiAJqIQcgDCEIIAshCQNAIAcgCCkDACIQIA0gCSkDAHwiD303AwAgB0EIaiAIQQhqKQMAIhEgDyANVK0gECAPVK19QgGDIg8gCUEIaikDAHwiDX03AwAgDSAPVK0gESANVK18QgGDIQ0gCEEQaiEIIAlBEGohCSAHQRBqIQcgDiAGQQJqIgZHDQALIAJBAXENAgsgDCAGQQN0IgdqKQMAIA0gCyAHaikDAHx9IQ0LIANBiAJqIAZBA3RqIA03AwALIAMgCjcDiAQCQAJAAkACQAJAIAQgBUIBhSINUQ0AIAIhBgJAIAJBAUgNACAAIAJBA3QiBmohByABIAZqIQggAiEGA0AgBykDACAIKQMAUg0BIAdBeGohByAIQXhqIQggBkEBSiEJIAZBf2ohBiAJDQALQQAhBgsgDSAEIAAgBkEDdCIGaikDACABIAZqKQMAVCIHGyEEQQAhBiACQQBIDQQgACABIAcbIQsgASAAIAcbIQwgAg0BQgAhDQwCC0EAIQYgAkEASA0DAkACQCACDQBCACENDAELIAJBAWpBfnEhDkEAIQZCACENIAMhByAAIQggASEJA0AgByAIKQMAIg8gDXwiDSAJKQMAfCIQNwMAIAdBCGogDSAPVK0gECANVK18Ig8gCEEIaikDAHwiDSAJQQhqKQMAfCIQNwMAIA0gD1StIBAgDVStfCENIAhBEGohCCAJQRBqIQkgB0EQaiEHIA4gBkECaiIGRw0ACyACQQFxDQQLIAAgBkEDdCIHaikDACANfCABIAdqKQMAfCENDAILIAJBAWpBfnEhDkEAIQZCACENIAMhByAMIQggCyEJA0AgByAIKQMAIhAgDSAJKQMAfCIPfTcDACAHQQhqIAhBCGopAwAiESAPIA1UrSAQIA9UrX1CAYMiDyAJQQhqKQMAfCINfTcDACANIA9UrSARIA1UrXxCAYMhDSAIQRBqIQggCUEQaiEJIAdBEGohByAOIAZBAmoiBkcNAAsgAkEBcQ0CCyAMIAZBA3QiB2opAwAgDSALIAdqKQMAfH0hDQsgAyAGQQN0aiANNwMACyADIAQ3A4ACIAAgASADQZAEaiACQQFqIg4QkoCAgAACQCAOQQN0IgtFIgwNACABIANBkARqIAJBA3RqIAv8CgAACyABIAApA4ACIAEpA4ACUq0iDTcDgAJBACEHAkAgAkEASA0AAkACQAJAIAINAEIAIQ0MAQsgDkF+cSEJQQAhB0IAIQ0gASEGA0AgBiAGKQMAIg9CAYYiECANfCINNwMAIAZBCGoiCCAIKQMAIhFCAYYiBCAPQj+IIA0gEFStfHwiDTcDACARQj+IIA0gBFStfCENIAZBEGohBiAJIAdBAmoiB0cNAAsgAkEBcQ0BCyABIAdBA3RqIgYgBikDAEIBhiANfDcDAAsgASkDgAIhDQsgASANNwOAAiADQYgCaiADIANBkARqIA4QkoCAgAACQCAMDQAgACADQZAEaiACQQN0aiAL/AoAAAsgACADKQOIBCADKQOAAlKtNwOAAiADQZAIaiSAgICAAAvlCgkCfwF+An8BfgR/An4BfwV+An8jgICAgABBgAhrIgQkgICAgAACQAJAAkAgA0EXSg0AIANBAXRBf2ohBQJAIANBAU4NAEIAIQYMAgsgBUEBIAVBAUobIQcgA0F/aiEIQgAhBkIAIQlBACEKA0ACQAJAQQAgCiADa0EBaiAKIANIIgsbIgwgCiAIIAsbIg1MDQBCACEOIAYhDyAJIQYMAQsgACAMQQN0IhBqIQsgASAQayEQIA0gDGtBAWohDEIAIQ4gBiEPIAkhBgNAIA4gECkDACIJQv////8PgyIRIAspAwAiEkL/////D4MiE34iFEIgiCARIBJCIIgiEn4iEUL/////D4N8IAlCIIgiCSATfiITQv////8Pg3wiFUIghiAUQv////8Pg4QiFCAPfCIPIBRUIg0gEUIgiCAJIBJ+fCATQiCIfCAVQiCIfCIJIAZ8IA2tfCIGIAlUIAYgCVEbrXwhDiALQQhqIQsgEEF4aiEQIAxBf2oiDA0ACwsgAiAKQQN0aiAPNwMAIAFBCGohASAOIQkgCkEBaiIKIAdGDQIMAAsLIARBgAZqIAMgA0EBdiILayINQQN0IhBqIQcCQEEAQYACIBBrIBBB/wFLGyIMRSIKDQAgB0EAIAz8CwALIAAgC0EDdCIWaiEFAkAgEEUiFw0AIARBgAZqIAUgEPwKAAALIARBgARqIBBqIQgCQCAKDQAgCEEAIAz8CwALIAEgFmohFgJAIBcNACAEQYAEaiAWIBD8CgAACwJAAkAgDUEBSA0AQQAhECAEQYAGaiEMIAAhCkIAIQYCQANAAkAgECALSQ0AIAZQRQ0AQgAhBgwCC0IAIQkCQCAQIAtPDQAgCikDACEJCyAMIAwpAwAiDiAGfCIGIAl8Igk3AwAgBiAOVK0gCSAGVK18IQYgDEEIaiEMIApBCGohCiANIBBBAWoiEEcNAAsLIAcgBjcDAEEAIRAgBEGABGohDCABIQpCACEGA0ACQCAQIAtJDQAgBlBFDQBCACEGDAMLQgAhCQJAIBAgC08NACAKKQMAIQkLIAwgDCkDACIOIAZ8IgYgCXwiCTcDACAGIA5UrSAJIAZUrXwhBiAMQQhqIQwgCkEIaiEKIA0gEEEBaiIQRw0ADAILC0IAIQYgB0IANwMACyAIIAY3AwAgACABIAIgCxCSgICAACAFIBYgAiADQf7///8HcSIIQQN0aiIKIA0QkoCAgAAgBEGABmogBEGABGogBCANQQFqEJKAgIAAIA1BAXQiAEECaiEHQQAhEAJAIA1BAEgNAEIAIQYgBCEMIAIhAQJAA0ACQCAQIAhJDQAgBlANAgtCACEJAkAgECAITw0AIAEpAwAhCQsgDCAMKQMAIg4gBiAJfCIJfTcDACAJIAZUrSAOIAlUrXxCAYMhBiAMQQhqIQwgAUEIaiEBIAcgEEEBaiIQRw0ACwtBACEQQgAhBiAEIQwDQAJAIBAgAEgNACAGUA0CC0IAIQkCQCAQIABODQAgCikDACEJCyAMIAwpAwAiDiAGIAl8Igl9NwMAIAkgBlStIA4gCVStfEIBgyEGIAxBCGohDCAKQQhqIQogByAQQQFqIhBHDQALCyANIANqIgpBAUgNASAHIAogByAKSBshDSACIAtBA3RqIRBBACELQgAhBiAEIQwDQAJAIAsgDUgNACAGUA0DC0IAIQkCQCALIA1ODQAgDCkDACEJCyAQIBApAwAiDiAGfCIGIAl8Igk3AwAgBiAOVK0gCSAGVK18IQYgEEEIaiEQIAxBCGohDCAKIAtBAWoiC0cNAAwCCwsgAiAFQQN0aiAGNwMACyAEQYAIaiSAgICAAAteAQJ8IAMgAaIgAiAAoqAgAyADoiACIAKioCIEoyIFIAIgAaIgAyAAoqEgBKMiA6BEAAAAYJ6g5j+iIAUgBaIgAyADoqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UC3wBAX8gALwiAbNDAAAANJRDd3P4wpIgAUH///8DcUGAgID4A3K+IgBDdb+/v5SSQ6Pp3L8gAEP5RLQ+kpWSQwAAAD+UvCIBs0MAAAA0lEN3c/jCkiABQf///wNxQYCAgPgDcr4iAEN1v7+/lJJDo+ncvyAAQ/lEtD6SlZILiMkBCQF/CHwCfwF8A38IfAF9B3wCfyOAgICAAEEgayIMJICAgIAAAkACQAJAAkACQAJAAkACQAJAAkACQAJAAkACQAJAAkACQCAAQX9qDg8AAQIDBAUGBwgJCgsMDQ4PCyAMIAQ5AxAgDCADOQMIIAwgAjkDACAMIAU5AxgCQCABQQFIDQAgBEQAAAACAACgQaIhDSANIAShIQ4gDSAOoSEOIAQgDqEhDyAEIASiIQ0gDiAOoiANoSEQIBAgDyAOoiIRoCEOIA4gEaAhDiAPIA+iIAQgBSAFoKKgIA6gIRAgECANoCESIBIgDaEhEyACRAAAAAIAAKBBoiENIA0gAqEhDiANIA6hIQ4gAiAOoSEPIAIgAqIhDSAOIA6iIA2hIREgESAPIA6iIhSgIQ4gDiAUoCEOIA8gD6IgAiADIAOgoqAgDqAhDiAOIA2gIREgESANoSENQQAhFUEAIAFrIRYgDiANoSENIBAgE6EhD0ECIQBBASEBRAAAAAAAAAAAIRdBACEYQQAhGUEBIRogAyEbIAIhHCAFIR0gBCEeA0AgDCAMQRBqIBEgDSASIA8gBiAHIAggCRCegICAACAMKwMQIg9EAAAAAgAAoEGiIQ0gDSAPoSEOIA0gDqEhDiAPIA6hIRAgDyAPoiENIA4gDqIgDaEhESARIBAgDqIiEqAhDiAOIBKgIQ4gECAQoiAPIAwrAxgiHyAfoKKgIA6gIRQgFCANoCESIAwrAwAiEEQAAAACAACgQaIhDiAOIBChIREgDiARoSERIBAgEaEhEyAQIBCiIQ4gESARoiAOoSEgICAgEyARoiIhoCERIBEgIaAhESATIBOiIBAgDCsDCCIiICKgoqAgEaAhEyATIA6gIRECQCASIBGgIiBEAAAAAICELkFlDQAgCiAPRAAAAGCeoPY/oiAPIBCgIgsgC6IgDyAQoSILIAuioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgAgAbJDd3P4QpIgILa8IgGzQwAAADSUQ3dz+MKSIAFB////A3FBgICA+ANyviIjQ3W/v7+UkkOj6dy/ICND+US0PpKVkkMAAAA/lLwiAbNDAAAAtJSSIAFB////A3FBgICA+ANyviIjQ3W/vz+UkkOj6dw/ICND+US0PpKVkiEjDBILAkAgC0QAAAAAAAAAAGUNAAJAIAEgGUcNACAiISAgG5ohJCAkICCgISEgISAgoSElICEgJaEhJiAgICahIScgJCAloSEoIBAhJCAcmiElICUgJKAhICAgICShISYgICAmoSEpICQgKaEhJCAlICahISUgJSAkoCAhoCEkICQgIKAhISAhICChISAgKCAnoCAkoCAgoSEgICAgIaAhJCAfISAgHZohJSAlICCgISEgISAgoSEmICEgJqEhJyAgICehISggJSAmoSEpIA8hJSAemiEmICYgJaAhICAgICWhIScgICAnoSEqICUgKqEhJSAmICehISYgJiAloCAhoCElICUgIKAhISAhICChISAgKSAooCAloCAgoSEgICAgIaAhIEEAIRkgIJogICAgRAAAAAAAAAAAYxsgJJogJCAkRAAAAAAAAAAAYxugIBdkDQAgCiAYsjgCAEMAwHnEISMMEwsgIiEgIAOaISQgJCAgoCEhICEgIKEhJSAhICWhISYgICAmoSEnICQgJaEhKCAQISQgApohJSAlICSgISAgICAkoSEmICAgJqEhKSAkICmhISQgJSAmoSElICUgJKAgIaAhJCAkICCgISEgISAgoSEgICggJ6AgJKAgIKEhICAgICGgISQgHyEgIAWaISUgJSAgoCEhICEgIKEhJiAhICahIScgICAnoSEoICUgJqEhKSAPISUgBJohJiAmICWgISAgICAloSEnICAgJ6EhKiAlICqhISUgJiAnoSEmICYgJaAgIaAhJSAlICCgISEgISAgoSEgICkgKKAgJaAgIKEhICAgICGgISACQCAgmiAgICBEAAAAAAAAAABjGyAkmiAkICREAAAAAAAAAABjG6AiICALZg0AIBkNACAAIBVrIRkgASAVayEYIA8hHiAfIR0gECEcICIhGyAgIRcLIAEgGkcNACAPIQQgHyEFIBAhAiAiIQMgACEaIAEhFQsgEiANoSENIBQgDaEhDyARIA6hIQ0gEyANoSENIABBAmohACAWIAFBAWoiAWpBAUcNAAsLQwDAecQhIyALRAAAAAAAAAAAZQ0PIApBADYCAAwPCyAMIAQ5AxAgDCADOQMIIAwgAjkDACAMIAU5AxgCQCABQQFIDQAgBEQAAAACAACgQaIhDSANIAShIQ4gDSAOoSEOIAQgDqEhDyAEIASiIQ0gDiAOoiANoSEQIBAgDyAOoiIRoCEOIA4gEaAhDiAPIA+iIAQgBSAFoKKgIA6gIRAgECANoCESIBIgDaEhEyACRAAAAAIAAKBBoiENIA0gAqEhDiANIA6hIQ4gAiAOoSEPIAIgAqIhDSAOIA6iIA2hIREgESAPIA6iIhSgIQ4gDiAUoCEOIA8gD6IgAiADIAOgoqAgDqAhDiAOIA2gIREgESANoSENQQAhFUEAIAFrIRYgDiANoSENIBAgE6EhD0ECIQBBASEBRAAAAAAAAAAAIRdBACEYQQAhGUEBIRogAyEbIAIhHCAFIR0gBCEeA0AgDCAMQRBqIBEgDSASIA8gBiAHIAggCRCfgICAACAMKwMQIg9EAAAAAgAAoEGiIQ0gDSAPoSEOIA0gDqEhDiAPIA6hIRAgDyAPoiENIA4gDqIgDaEhESARIBAgDqIiEqAhDiAOIBKgIQ4gECAQoiAPIAwrAxgiHyAfoKKgIA6gIRQgFCANoCESIAwrAwAiEEQAAAACAACgQaIhDiAOIBChIREgDiARoSERIBAgEaEhEyAQIBCiIQ4gESARoiAOoSEgICAgEyARoiIhoCERIBEgIaAhESATIBOiIBAgDCsDCCIiICKgoqAgEaAhEyATIA6gIRECQCASIBGgIiBEAAAAAICELkFlDQAgCiAPRAAAAGCeoPY/oiAPIBCgIgsgC6IgDyAQoSILIAuioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgAgAbIgILa8IgGzQwAAADSUQ3dz+MKSIAFB////A3FBgICA+ANyviIjQ3W/v7+UkkOj6dy/ICND+US0PpKVkkMAAAA/lLwiAbNDAAAANJRDd3P4wpIgAUH///8DcUGAgID4A3K+IiNDdb+/v5SSQ6Pp3L8gI0P5RLQ+kpWSQ52EIb+UkiEjDBELAkAgC0QAAAAAAAAAAGUNAAJAIAEgGUcNACAiISAgG5ohJCAkICCgISEgISAgoSElICEgJaEhJiAgICahIScgJCAloSEoIBAhJCAcmiElICUgJKAhICAgICShISYgICAmoSEpICQgKaEhJCAlICahISUgJSAkoCAhoCEkICQgIKAhISAhICChISAgKCAnoCAkoCAgoSEgICAgIaAhJCAfISAgHZohJSAlICCgISEgISAgoSEmICEgJqEhJyAgICehISggJSAmoSEpIA8hJSAemiEmICYgJaAhICAgICWhIScgICAnoSEqICUgKqEhJSAmICehISYgJiAloCAhoCElICUgIKAhISAhICChISAgKSAooCAloCAgoSEgICAgIaAhIEEAIRkgIJogICAgRAAAAAAAAAAAYxsgJJogJCAkRAAAAAAAAAAAYxugIBdkDQAgCiAYsjgCAEMAwHnEISMMEgsgIiEgIAOaISQgJCAgoCEhICEgIKEhJSAhICWhISYgICAmoSEnICQgJaEhKCAQISQgApohJSAlICSgISAgICAkoSEmICAgJqEhKSAkICmhISQgJSAmoSElICUgJKAgIaAhJCAkICCgISEgISAgoSEgICggJ6AgJKAgIKEhICAgICGgISQgHyEgIAWaISUgJSAgoCEhICEgIKEhJiAhICahIScgICAnoSEoICUgJqEhKSAPISUgBJohJiAmICWgISAgICAloSEnICAgJ6EhKiAlICqhISUgJiAnoSEmICYgJaAgIaAhJSAlICCgISEgISAgoSEgICkgKKAgJaAgIKEhICAgICGgISACQCAgmiAgICBEAAAAAAAAAABjGyAkmiAkICREAAAAAAAAAABjG6AiICALZg0AIBkNACAAIBVrIRkgASAVayEYIA8hHiAfIR0gECEcICIhGyAgIRcLIAEgGkcNACAPIQQgHyEFIBAhAiAiIQMgACEaIAEhFQsgEiANoSENIBQgDaEhDyARIA6hIQ0gEyANoSENIABBAmohACAWIAFBAWoiAWpBAUcNAAsLQwDAecQhIyALRAAAAAAAAAAAZQ0OIApBADYCAAwOCyAMIAQ5AxAgDCADOQMIIAwgAjkDACAMIAU5AxgCQCABQQFIDQAgBEQAAAACAACgQaIhDSANIAShIQ4gDSAOoSEOIAQgDqEhDyAEIASiIQ0gDiAOoiANoSEQIBAgDyAOoiIRoCEOIA4gEaAhDiAPIA+iIAQgBSAFoKKgIA6gIRAgECANoCESIBIgDaEhEyACRAAAAAIAAKBBoiENIA0gAqEhDiANIA6hIQ4gAiAOoSEPIAIgAqIhDSAOIA6iIA2hIREgESAPIA6iIhSgIQ4gDiAUoCEOIA8gD6IgAiADIAOgoqAgDqAhDiAOIA2gIREgESANoSENQQAhFUEAIAFrIRYgDiANoSENIBAgE6EhD0ECIQBBASEBRAAAAAAAAAAAIRdBACEYQQAhGUEBIRogAyEbIAIhHCAFIR0gBCEeA0AgDCAMQRBqIBEgDSASIA8gBiAHIAggCRCggICAACAMKwMQIg9EAAAAAgAAoEGiIQ0gDSAPoSEOIA0gDqEhDiAPIA6hIRAgDyAPoiENIA4gDqIgDaEhESARIBAgDqIiEqAhDiAOIBKgIQ4gECAQoiAPIAwrAxgiHyAfoKKgIA6gIRQgFCANoCESIAwrAwAiEEQAAAACAACgQaIhDiAOIBChIREgDiARoSERIBAgEaEhEyAQIBCiIQ4gESARoiAOoSEgICAgEyARoiIhoCERIBEgIaAhESATIBOiIBAgDCsDCCIiICKgoqAgEaAhEyATIA6gIRECQCASIBGgIiBEAAAAAICELkFlDQAgCiAPRAAAAGCeoPY/oiAPIBCgIgsgC6IgDyAQoSILIAuioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgAgAbIgILa8IgGzQwAAADSUQ3dz+MKSIAFB////A3FBgICA+ANyviIjQ3W/v7+UkkOj6dy/ICND+US0PpKVkkMAAAA/lLwiAbNDAAAANJRDd3P4wpIgAUH///8DcUGAgID4A3K+IiNDdb+/v5SSQ6Pp3L8gI0P5RLQ+kpWSQwAAAD+UkyEjDBALAkAgC0QAAAAAAAAAAGUNAAJAIAEgGUcNACAiISAgG5ohJCAkICCgISEgISAgoSElICEgJaEhJiAgICahIScgJCAloSEoIBAhJCAcmiElICUgJKAhICAgICShISYgICAmoSEpICQgKaEhJCAlICahISUgJSAkoCAhoCEkICQgIKAhISAhICChISAgKCAnoCAkoCAgoSEgICAgIaAhJCAfISAgHZohJSAlICCgISEgISAgoSEmICEgJqEhJyAgICehISggJSAmoSEpIA8hJSAemiEmICYgJaAhICAgICWhIScgICAnoSEqICUgKqEhJSAmICehISYgJiAloCAhoCElICUgIKAhISAhICChISAgKSAooCAloCAgoSEgICAgIaAhIEEAIRkgIJogICAgRAAAAAAAAAAAYxsgJJogJCAkRAAAAAAAAAAAYxugIBdkDQAgCiAYsjgCAEMAwHnEISMMEQsgIiEgIAOaISQgJCAgoCEhICEgIKEhJSAhICWhISYgICAmoSEnICQgJaEhKCAQISQgApohJSAlICSgISAgICAkoSEmICAgJqEhKSAkICmhISQgJSAmoSElICUgJKAgIaAhJCAkICCgISEgISAgoSEgICggJ6AgJKAgIKEhICAgICGgISQgHyEgIAWaISUgJSAgoCEhICEgIKEhJiAhICahIScgICAnoSEoICUgJqEhKSAPISUgBJohJiAmICWgISAgICAloSEnICAgJ6EhKiAlICqhISUgJiAnoSEmICYgJaAgIaAhJSAlICCgISEgISAgoSEgICkgKKAgJaAgIKEhICAgICGgISACQCAgmiAgICBEAAAAAAAAAABjGyAkmiAkICREAAAAAAAAAABjG6AiICALZg0AIBkNACAAIBVrIRkgASAVayEYIA8hHiAfIR0gECEcICIhGyAgIRcLIAEgGkcNACAPIQQgHyEFIBAhAiAiIQMgACEaIAEhFQsgEiANoSENIBQgDaEhDyARIA6hIQ0gEyANoSENIABBAmohACAWIAFBAWoiAWpBAUcNAAsLQwDAecQhIyALRAAAAAAAAAAAZQ0NIApBADYCAAwNCyAMIAQ5AxAgDCADOQMIIAwgAjkDACAMIAU5AxgCQCABQQFIDQAgBEQAAAACAACgQaIhDSANIAShIQ4gDSAOoSEOIAQgDqEhDyAEIASiIQ0gDiAOoiANoSEQIBAgDyAOoiIRoCEOIA4gEaAhDiAPIA+iIAQgBSAFoKKgIA6gIRAgECANoCESIBIgDaEhEyACRAAAAAIAAKBBoiENIA0gAqEhDiANIA6hIQ4gAiAOoSEPIAIgAqIhDSAOIA6iIA2hIREgESAPIA6iIhSgIQ4gDiAUoCEOIA8gD6IgAiADIAOgoqAgDqAhDiAOIA2gIREgESANoSENQQAhFUEAIAFrIRYgDiANoSENIBAgE6EhD0ECIQBBASEBRAAAAAAAAAAAIRdBACEYQQAhGUEBIRogAyEbIAIhHCAFIR0gBCEeA0AgDCAMQRBqIBEgDSASIA8gBiAHIAggCRChgICAACAMKwMQIg9EAAAAAgAAoEGiIQ0gDSAPoSEOIA0gDqEhDiAPIA6hIRAgDyAPoiENIA4gDqIgDaEhESARIBAgDqIiEqAhDiAOIBKgIQ4gECAQoiAPIAwrAxgiHyAfoKKgIA6gIRQgFCANoCESIAwrAwAiEEQAAAACAACgQaIhDiAOIBChIREgDiARoSERIBAgEaEhEyAQIBCiIQ4gESARoiAOoSEgICAgEyARoiIhoCERIBEgIaAhESATIBOiIBAgDCsDCCIiICKgoqAgEaAhEyATIA6gIRECQCASIBGgIiBEAAAAAICELkFlDQAgCiAPRAAAAGCeoPY/oiAPIBCgIgsgC6IgDyAQoSILIAuioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgAgAbIgILa8IgGzQwAAADSUQ3dz+MKSIAFB////A3FBgICA+ANyviIjQ3W/v7+UkkOj6dy/ICND+US0PpKVkkMAAAA/lLwiAbNDAAAANJRDd3P4wpIgAUH///8DcUGAgID4A3K+IiNDdb+/v5SSQ6Pp3L8gI0P5RLQ+kpWSQ6OB3L6UkiEjDA8LAkAgC0QAAAAAAAAAAGUNAAJAIAEgGUcNACAiISAgG5ohJCAkICCgISEgISAgoSElICEgJaEhJiAgICahIScgJCAloSEoIBAhJCAcmiElICUgJKAhICAgICShISYgICAmoSEpICQgKaEhJCAlICahISUgJSAkoCAhoCEkICQgIKAhISAhICChISAgKCAnoCAkoCAgoSEgICAgIaAhJCAfISAgHZohJSAlICCgISEgISAgoSEmICEgJqEhJyAgICehISggJSAmoSEpIA8hJSAemiEmICYgJaAhICAgICWhIScgICAnoSEqICUgKqEhJSAmICehISYgJiAloCAhoCElICUgIKAhISAhICChISAgKSAooCAloCAgoSEgICAgIaAhIEEAIRkgIJogICAgRAAAAAAAAAAAYxsgJJogJCAkRAAAAAAAAAAAYxugIBdkDQAgCiAYsjgCAEMAwHnEISMMEAsgIiEgIAOaISQgJCAgoCEhICEgIKEhJSAhICWhISYgICAmoSEnICQgJaEhKCAQISQgApohJSAlICSgISAgICAkoSEmICAgJqEhKSAkICmhISQgJSAmoSElICUgJKAgIaAhJCAkICCgISEgISAgoSEgICggJ6AgJKAgIKEhICAgICGgISQgHyEgIAWaISUgJSAgoCEhICEgIKEhJiAhICahIScgICAnoSEoICUgJqEhKSAPISUgBJohJiAmICWgISAgICAloSEnICAgJ6EhKiAlICqhISUgJiAnoSEmICYgJaAgIaAhJSAlICCgISEgISAgoSEgICkgKKAgJaAgIKEhICAgICGgISACQCAgmiAgICBEAAAAAAAAAABjGyAkmiAkICREAAAAAAAAAABjG6AiICALZg0AIBkNACAAIBVrIRkgASAVayEYIA8hHiAfIR0gECEcICIhGyAgIRcLIAEgGkcNACAPIQQgHyEFIBAhAiAiIQMgACEaIAEhFQsgEiANoSENIBQgDaEhDyARIA6hIQ0gEyANoSENIABBAmohACAWIAFBAWoiAWpBAUcNAAsLQwDAecQhIyALRAAAAAAAAAAAZQ0MIApBADYCAAwMCyAMIAQ5AxAgDCADOQMIIAwgAjkDACAMIAU5AxgCQCABQQFIDQAgBEQAAAACAACgQaIhDSANIAShIQ4gDSAOoSEOIAQgDqEhDyAEIASiIQ0gDiAOoiANoSEQIBAgDyAOoiIRoCEOIA4gEaAhDiAPIA+iIAQgBSAFoKKgIA6gIRAgECANoCESIBIgDaEhEyACRAAAAAIAAKBBoiENIA0gAqEhDiANIA6hIQ4gAiAOoSEPIAIgAqIhDSAOIA6iIA2hIREgESAPIA6iIhSgIQ4gDiAUoCEOIA8gD6IgAiADIAOgoqAgDqAhDiAOIA2gIREgESANoSENQQAhFUEAIAFrIRYgDiANoSENIBAgE6EhD0ECIQBBASEBRAAAAAAAAAAAIRdBACEYQQAhGUEBIRogAyEbIAIhHCAFIR0gBCEeA0AgDCAMQRBqIBEgDSASIA8gBiAHIAggCRCigICAACAMKwMQIg9EAAAAAgAAoEGiIQ0gDSAPoSEOIA0gDqEhDiAPIA6hIRAgDyAPoiENIA4gDqIgDaEhESARIBAgDqIiEqAhDiAOIBKgIQ4gECAQoiAPIAwrAxgiHyAfoKKgIA6gIRQgFCANoCESIAwrAwAiEEQAAAACAACgQaIhDiAOIBChIREgDiARoSERIBAgEaEhEyAQIBCiIQ4gESARoiAOoSEgICAgEyARoiIhoCERIBEgIaAhESATIBOiIBAgDCsDCCIiICKgoqAgEaAhEyATIA6gIRECQCASIBGgIiBEAAAAAICELkFlDQAgCiAPRAAAAGCeoPY/oiAPIBCgIgsgC6IgDyAQoSILIAuioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgAgAbIgILa8IgGzQwAAADSUQ3dz+MKSIAFB////A3FBgICA+ANyviIjQ3W/v7+UkkOj6dy/ICND+US0PpKVkkMAAAA/lLwiAbNDAAAANJRDd3P4wpIgAUH///8DcUGAgID4A3K+IiNDdb+/v5SSQ6Pp3L8gI0P5RLQ+kpWSQ5IRxr6UkiEjDA4LAkAgC0QAAAAAAAAAAGUNAAJAIAEgGUcNACAiISAgG5ohJCAkICCgISEgISAgoSElICEgJaEhJiAgICahIScgJCAloSEoIBAhJCAcmiElICUgJKAhICAgICShISYgICAmoSEpICQgKaEhJCAlICahISUgJSAkoCAhoCEkICQgIKAhISAhICChISAgKCAnoCAkoCAgoSEgICAgIaAhJCAfISAgHZohJSAlICCgISEgISAgoSEmICEgJqEhJyAgICehISggJSAmoSEpIA8hJSAemiEmICYgJaAhICAgICWhIScgICAnoSEqICUgKqEhJSAmICehISYgJiAloCAhoCElICUgIKAhISAhICChISAgKSAooCAloCAgoSEgICAgIaAhIEEAIRkgIJogICAgRAAAAAAAAAAAYxsgJJogJCAkRAAAAAAAAAAAYxugIBdkDQAgCiAYsjgCAEMAwHnEISMMDwsgIiEgIAOaISQgJCAgoCEhICEgIKEhJSAhICWhISYgICAmoSEnICQgJaEhKCAQISQgApohJSAlICSgISAgICAkoSEmICAgJqEhKSAkICmhISQgJSAmoSElICUgJKAgIaAhJCAkICCgISEgISAgoSEgICggJ6AgJKAgIKEhICAgICGgISQgHyEgIAWaISUgJSAgoCEhICEgIKEhJiAhICahIScgICAnoSEoICUgJqEhKSAPISUgBJohJiAmICWgISAgICAloSEnICAgJ6EhKiAlICqhISUgJiAnoSEmICYgJaAgIaAhJSAlICCgISEgISAgoSEgICkgKKAgJaAgIKEhICAgICGgISACQCAgmiAgICBEAAAAAAAAAABjGyAkmiAkICREAAAAAAAAAABjG6AiICALZg0AIBkNACAAIBVrIRkgASAVayEYIA8hHiAfIR0gECEcICIhGyAgIRcLIAEgGkcNACAPIQQgHyEFIBAhAiAiIQMgACEaIAEhFQsgEiANoSENIBQgDaEhDyARIA6hIQ0gEyANoSENIABBAmohACAWIAFBAWoiAWpBAUcNAAsLQwDAecQhIyALRAAAAAAAAAAAZQ0LIApBADYCAAwLCyAMIAQ5AxAgDCADOQMIIAwgAjkDACAMIAU5AxgCQCABQQFIDQAgBEQAAAACAACgQaIhDSANIAShIQ4gDSAOoSEOIAQgDqEhDyAEIASiIQ0gDiAOoiANoSEQIBAgDyAOoiIRoCEOIA4gEaAhDiAPIA+iIAQgBSAFoKKgIA6gIRAgECANoCESIBIgDaEhEyACRAAAAAIAAKBBoiENIA0gAqEhDiANIA6hIQ4gAiAOoSEPIAIgAqIhDSAOIA6iIA2hIREgESAPIA6iIhSgIQ4gDiAUoCEOIA8gD6IgAiADIAOgoqAgDqAhDiAOIA2gIREgESANoSENQQAhFUEAIAFrIRYgDiANoSENIBAgE6EhD0ECIQBBASEBRAAAAAAAAAAAIRdBACEYQQAhGUEBIRogAyEbIAIhHCAFIR0gBCEeA0AgDCAMQRBqIBEgDSASIA8gBiAHIAggCRCjgICAACAMKwMQIg9EAAAAAgAAoEGiIQ0gDSAPoSEOIA0gDqEhDiAPIA6hIRAgDyAPoiENIA4gDqIgDaEhESARIBAgDqIiEqAhDiAOIBKgIQ4gECAQoiAPIAwrAxgiHyAfoKKgIA6gIRQgFCANoCESIAwrAwAiEEQAAAACAACgQaIhDiAOIBChIREgDiARoSERIBAgEaEhEyAQIBCiIQ4gESARoiAOoSEgICAgEyARoiIhoCERIBEgIaAhESATIBOiIBAgDCsDCCIiICKgoqAgEaAhEyATIA6gIRECQCASIBGgIiBEAAAAAICELkFlDQAgCiAPRAAAAGCeoPY/oiAPIBCgIgsgC6IgDyAQoSILIAuioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgAgAbIgILa8IgGzQwAAADSUQ3dz+MKSIAFB////A3FBgICA+ANyviIjQ3W/v7+UkkOj6dy/ICND+US0PpKVkkMAAAA/lLwiAbNDAAAANJRDd3P4wpIgAUH///8DcUGAgID4A3K+IiNDdb+/v5SSQ6Pp3L8gI0P5RLQ+kpWSQ8pgtr6UkiEjDA0LAkAgC0QAAAAAAAAAAGUNAAJAIAEgGUcNACAiISAgG5ohJCAkICCgISEgISAgoSElICEgJaEhJiAgICahIScgJCAloSEoIBAhJCAcmiElICUgJKAhICAgICShISYgICAmoSEpICQgKaEhJCAlICahISUgJSAkoCAhoCEkICQgIKAhISAhICChISAgKCAnoCAkoCAgoSEgICAgIaAhJCAfISAgHZohJSAlICCgISEgISAgoSEmICEgJqEhJyAgICehISggJSAmoSEpIA8hJSAemiEmICYgJaAhICAgICWhIScgICAnoSEqICUgKqEhJSAmICehISYgJiAloCAhoCElICUgIKAhISAhICChISAgKSAooCAloCAgoSEgICAgIaAhIEEAIRkgIJogICAgRAAAAAAAAAAAYxsgJJogJCAkRAAAAAAAAAAAYxugIBdkDQAgCiAYsjgCAEMAwHnEISMMDgsgIiEgIAOaISQgJCAgoCEhICEgIKEhJSAhICWhISYgICAmoSEnICQgJaEhKCAQISQgApohJSAlICSgISAgICAkoSEmICAgJqEhKSAkICmhISQgJSAmoSElICUgJKAgIaAhJCAkICCgISEgISAgoSEgICggJ6AgJKAgIKEhICAgICGgISQgHyEgIAWaISUgJSAgoCEhICEgIKEhJiAhICahIScgICAnoSEoICUgJqEhKSAPISUgBJohJiAmICWgISAgICAloSEnICAgJ6EhKiAlICqhISUgJiAnoSEmICYgJaAgIaAhJSAlICCgISEgISAgoSEgICkgKKAgJaAgIKEhICAgICGgISACQCAgmiAgICBEAAAAAAAAAABjGyAkmiAkICREAAAAAAAAAABjG6AiICALZg0AIBkNACAAIBVrIRkgASAVayEYIA8hHiAfIR0gECEcICIhGyAgIRcLIAEgGkcNACAPIQQgHyEFIBAhAiAiIQMgACEaIAEhFQsgEiANoSENIBQgDaEhDyARIA6hIQ0gEyANoSENIABBAmohACAWIAFBAWoiAWpBAUcNAAsLQwDAecQhIyALRAAAAAAAAAAAZQ0KIApBADYCAAwKCyAMIAQ5AxAgDCADOQMIIAwgAjkDACAMIAU5AxgCQCABQQFIDQAgBEQAAAACAACgQaIhDSANIAShIQ4gDSAOoSEOIAQgDqEhDyAEIASiIQ0gDiAOoiANoSEQIBAgDyAOoiIRoCEOIA4gEaAhDiAPIA+iIAQgBSAFoKKgIA6gIRAgECANoCESIBIgDaEhEyACRAAAAAIAAKBBoiENIA0gAqEhDiANIA6hIQ4gAiAOoSEPIAIgAqIhDSAOIA6iIA2hIREgESAPIA6iIhSgIQ4gDiAUoCEOIA8gD6IgAiADIAOgoqAgDqAhDiAOIA2gIREgESANoSENQQAhFUEAIAFrIRYgDiANoSENIBAgE6EhD0ECIQBBASEBRAAAAAAAAAAAIRdBACEYQQAhGUEBIRogAyEbIAIhHCAFIR0gBCEeA0AgDCAMQRBqIBEgDSASIA8gBiAHIAggCRCkgICAACAMKwMQIg9EAAAAAgAAoEGiIQ0gDSAPoSEOIA0gDqEhDiAPIA6hIRAgDyAPoiENIA4gDqIgDaEhESARIBAgDqIiEqAhDiAOIBKgIQ4gECAQoiAPIAwrAxgiHyAfoKKgIA6gIRQgFCANoCESIAwrAwAiEEQAAAACAACgQaIhDiAOIBChIREgDiARoSERIBAgEaEhEyAQIBCiIQ4gESARoiAOoSEgICAgEyARoiIhoCERIBEgIaAhESATIBOiIBAgDCsDCCIiICKgoqAgEaAhEyATIA6gIRECQCASIBGgIiBEAAAAAICELkFlDQAgCiAPRAAAAGCeoPY/oiAPIBCgIgsgC6IgDyAQoSILIAuioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgAgAbJDd3P4QpIgILa8IgGzQwAAADSUQ3dz+MKSIAFB////A3FBgICA+ANyviIjQ3W/v7+UkkOj6dy/ICND+US0PpKVkkMAAAA/lLwiAbNDAAAAtJSSIAFB////A3FBgICA+ANyviIjQ3W/vz+UkkOj6dw/ICND+US0PpKVkiEjDAwLAkAgC0QAAAAAAAAAAGUNAAJAIAEgGUcNACAiISAgG5ohJCAkICCgISEgISAgoSElICEgJaEhJiAgICahIScgJCAloSEoIBAhJCAcmiElICUgJKAhICAgICShISYgICAmoSEpICQgKaEhJCAlICahISUgJSAkoCAhoCEkICQgIKAhISAhICChISAgKCAnoCAkoCAgoSEgICAgIaAhJCAfISAgHZohJSAlICCgISEgISAgoSEmICEgJqEhJyAgICehISggJSAmoSEpIA8hJSAemiEmICYgJaAhICAgICWhIScgICAnoSEqICUgKqEhJSAmICehISYgJiAloCAhoCElICUgIKAhISAhICChISAgKSAooCAloCAgoSEgICAgIaAhIEEAIRkgIJogICAgRAAAAAAAAAAAYxsgJJogJCAkRAAAAAAAAAAAYxugIBdkDQAgCiAYsjgCAEMAwHnEISMMDQsgIiEgIAOaISQgJCAgoCEhICEgIKEhJSAhICWhISYgICAmoSEnICQgJaEhKCAQISQgApohJSAlICSgISAgICAkoSEmICAgJqEhKSAkICmhISQgJSAmoSElICUgJKAgIaAhJCAkICCgISEgISAgoSEgICggJ6AgJKAgIKEhICAgICGgISQgHyEgIAWaISUgJSAgoCEhICEgIKEhJiAhICahIScgICAnoSEoICUgJqEhKSAPISUgBJohJiAmICWgISAgICAloSEnICAgJ6EhKiAlICqhISUgJiAnoSEmICYgJaAgIaAhJSAlICCgISEgISAgoSEgICkgKKAgJaAgIKEhICAgICGgISACQCAgmiAgICBEAAAAAAAAAABjGyAkmiAkICREAAAAAAAAAABjG6AiICALZg0AIBkNACAAIBVrIRkgASAVayEYIA8hHiAfIR0gECEcICIhGyAgIRcLIAEgGkcNACAPIQQgHyEFIBAhAiAiIQMgACEaIAEhFQsgEiANoSENIBQgDaEhDyARIA6hIQ0gEyANoSENIABBAmohACAWIAFBAWoiAWpBAUcNAAsLQwDAecQhIyALRAAAAAAAAAAAZQ0JIApBADYCAAwJCyAMIAQ5AxAgDCADOQMIIAwgAjkDACAMIAU5AxgCQCABQQFIDQAgBEQAAAACAACgQaIhDSANIAShIQ4gDSAOoSEOIAQgDqEhDyAEIASiIQ0gDiAOoiANoSEQIBAgDyAOoiIRoCEOIA4gEaAhDiAPIA+iIAQgBSAFoKKgIA6gIRAgECANoCESIBIgDaEhEyACRAAAAAIAAKBBoiENIA0gAqEhDiANIA6hIQ4gAiAOoSEPIAIgAqIhDSAOIA6iIA2hIREgESAPIA6iIhSgIQ4gDiAUoCEOIA8gD6IgAiADIAOgoqAgDqAhDiAOIA2gIREgESANoSENQQAhFUEAIAFrIRYgDiANoSENIBAgE6EhD0ECIQBBASEBRAAAAAAAAAAAIRdBACEYQQAhGUEBIRogAyEbIAIhHCAFIR0gBCEeA0AgDCAMQRBqIBEgDSASIA8gBiAHIAggCRClgICAACAMKwMQIg9EAAAAAgAAoEGiIQ0gDSAPoSEOIA0gDqEhDiAPIA6hIRAgDyAPoiENIA4gDqIgDaEhESARIBAgDqIiEqAhDiAOIBKgIQ4gECAQoiAPIAwrAxgiHyAfoKKgIA6gIRQgFCANoCESIAwrAwAiEEQAAAACAACgQaIhDiAOIBChIREgDiARoSERIBAgEaEhEyAQIBCiIQ4gESARoiAOoSEgICAgEyARoiIhoCERIBEgIaAhESATIBOiIBAgDCsDCCIiICKgoqAgEaAhEyATIA6gIRECQCASIBGgIiBEAAAAAICELkFlDQAgCiAPRAAAAGCeoPY/oiAPIBCgIgsgC6IgDyAQoSILIAuioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgAgAbIgILa8IgGzQwAAADSUQ3dz+MKSIAFB////A3FBgICA+ANyviIjQ3W/v7+UkkOj6dy/ICND+US0PpKVkkMAAAA/lLwiAbNDAAAANJRDd3P4wpIgAUH///8DcUGAgID4A3K+IiNDdb+/v5SSQ6Pp3L8gI0P5RLQ+kpWSQ52EIb+UkiEjDAsLAkAgC0QAAAAAAAAAAGUNAAJAIAEgGUcNACAiISAgG5ohJCAkICCgISEgISAgoSElICEgJaEhJiAgICahIScgJCAloSEoIBAhJCAcmiElICUgJKAhICAgICShISYgICAmoSEpICQgKaEhJCAlICahISUgJSAkoCAhoCEkICQgIKAhISAhICChISAgKCAnoCAkoCAgoSEgICAgIaAhJCAfISAgHZohJSAlICCgISEgISAgoSEmICEgJqEhJyAgICehISggJSAmoSEpIA8hJSAemiEmICYgJaAhICAgICWhIScgICAnoSEqICUgKqEhJSAmICehISYgJiAloCAhoCElICUgIKAhISAhICChISAgKSAooCAloCAgoSEgICAgIaAhIEEAIRkgIJogICAgRAAAAAAAAAAAYxsgJJogJCAkRAAAAAAAAAAAYxugIBdkDQAgCiAYsjgCAEMAwHnEISMMDAsgIiEgIAOaISQgJCAgoCEhICEgIKEhJSAhICWhISYgICAmoSEnICQgJaEhKCAQISQgApohJSAlICSgISAgICAkoSEmICAgJqEhKSAkICmhISQgJSAmoSElICUgJKAgIaAhJCAkICCgISEgISAgoSEgICggJ6AgJKAgIKEhICAgICGgISQgHyEgIAWaISUgJSAgoCEhICEgIKEhJiAhICahIScgICAnoSEoICUgJqEhKSAPISUgBJohJiAmICWgISAgICAloSEnICAgJ6EhKiAlICqhISUgJiAnoSEmICYgJaAgIaAhJSAlICCgISEgISAgoSEgICkgKKAgJaAgIKEhICAgICGgISACQCAgmiAgICBEAAAAAAAAAABjGyAkmiAkICREAAAAAAAAAABjG6AiICALZg0AIBkNACAAIBVrIRkgASAVayEYIA8hHiAfIR0gECEcICIhGyAgIRcLIAEgGkcNACAPIQQgHyEFIBAhAiAiIQMgACEaIAEhFQsgEiANoSENIBQgDaEhDyARIA6hIQ0gEyANoSENIABBAmohACAWIAFBAWoiAWpBAUcNAAsLQwDAecQhIyALRAAAAAAAAAAAZQ0IIApBADYCAAwICyAMIAQ5AxAgDCADOQMIIAwgAjkDACAMIAU5AxgCQCABQQFIDQAgBEQAAAACAACgQaIhDSANIAShIQ4gDSAOoSEOIAQgDqEhDyAEIASiIQ0gDiAOoiANoSEQIBAgDyAOoiIRoCEOIA4gEaAhDiAPIA+iIAQgBSAFoKKgIA6gIRAgECANoCESIBIgDaEhEyACRAAAAAIAAKBBoiENIA0gAqEhDiANIA6hIQ4gAiAOoSEPIAIgAqIhDSAOIA6iIA2hIREgESAPIA6iIhSgIQ4gDiAUoCEOIA8gD6IgAiADIAOgoqAgDqAhDiAOIA2gIREgESANoSENQQAhFUEAIAFrIRYgDiANoSENIBAgE6EhD0ECIQBBASEBRAAAAAAAAAAAIRdBACEYQQAhGUEBIRogAyEbIAIhHCAFIR0gBCEeA0AgDCAMQRBqIBEgDSASIA8gBiAHIAggCRCmgICAACAMKwMQIg9EAAAAAgAAoEGiIQ0gDSAPoSEOIA0gDqEhDiAPIA6hIRAgDyAPoiENIA4gDqIgDaEhESARIBAgDqIiEqAhDiAOIBKgIQ4gECAQoiAPIAwrAxgiHyAfoKKgIA6gIRQgFCANoCESIAwrAwAiEEQAAAACAACgQaIhDiAOIBChIREgDiARoSERIBAgEaEhEyAQIBCiIQ4gESARoiAOoSEgICAgEyARoiIhoCERIBEgIaAhESATIBOiIBAgDCsDCCIiICKgoqAgEaAhEyATIA6gIRECQCASIBGgIiBEAAAAAICELkFlDQAgCiAPRAAAAGCeoPY/oiAPIBCgIgsgC6IgDyAQoSILIAuioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgAgAbIgILa8IgGzQwAAADSUQ3dz+MKSIAFB////A3FBgICA+ANyviIjQ3W/v7+UkkOj6dy/ICND+US0PpKVkkMAAAA/lLwiAbNDAAAANJRDd3P4wpIgAUH///8DcUGAgID4A3K+IiNDdb+/v5SSQ6Pp3L8gI0P5RLQ+kpWSQwAAAD+UkyEjDAoLAkAgC0QAAAAAAAAAAGUNAAJAIAEgGUcNACAiISAgG5ohJCAkICCgISEgISAgoSElICEgJaEhJiAgICahIScgJCAloSEoIBAhJCAcmiElICUgJKAhICAgICShISYgICAmoSEpICQgKaEhJCAlICahISUgJSAkoCAhoCEkICQgIKAhISAhICChISAgKCAnoCAkoCAgoSEgICAgIaAhJCAfISAgHZohJSAlICCgISEgISAgoSEmICEgJqEhJyAgICehISggJSAmoSEpIA8hJSAemiEmICYgJaAhICAgICWhIScgICAnoSEqICUgKqEhJSAmICehISYgJiAloCAhoCElICUgIKAhISAhICChISAgKSAooCAloCAgoSEgICAgIaAhIEEAIRkgIJogICAgRAAAAAAAAAAAYxsgJJogJCAkRAAAAAAAAAAAYxugIBdkDQAgCiAYsjgCAEMAwHnEISMMCwsgIiEgIAOaISQgJCAgoCEhICEgIKEhJSAhICWhISYgICAmoSEnICQgJaEhKCAQISQgApohJSAlICSgISAgICAkoSEmICAgJqEhKSAkICmhISQgJSAmoSElICUgJKAgIaAhJCAkICCgISEgISAgoSEgICggJ6AgJKAgIKEhICAgICGgISQgHyEgIAWaISUgJSAgoCEhICEgIKEhJiAhICahIScgICAnoSEoICUgJqEhKSAPISUgBJohJiAmICWgISAgICAloSEnICAgJ6EhKiAlICqhISUgJiAnoSEmICYgJaAgIaAhJSAlICCgISEgISAgoSEgICkgKKAgJaAgIKEhICAgICGgISACQCAgmiAgICBEAAAAAAAAAABjGyAkmiAkICREAAAAAAAAAABjG6AiICALZg0AIBkNACAAIBVrIRkgASAVayEYIA8hHiAfIR0gECEcICIhGyAgIRcLIAEgGkcNACAPIQQgHyEFIBAhAiAiIQMgACEaIAEhFQsgEiANoSENIBQgDaEhDyARIA6hIQ0gEyANoSENIABBAmohACAWIAFBAWoiAWpBAUcNAAsLQwDAecQhIyALRAAAAAAAAAAAZQ0HIApBADYCAAwHCyAMIAQ5AxAgDCADOQMIIAwgAjkDACAMIAU5AxgCQCABQQFIDQAgBEQAAAACAACgQaIhDSANIAShIQ4gDSAOoSEOIAQgDqEhDyAEIASiIQ0gDiAOoiANoSEQIBAgDyAOoiIRoCEOIA4gEaAhDiAPIA+iIAQgBSAFoKKgIA6gIRAgECANoCESIBIgDaEhEyACRAAAAAIAAKBBoiENIA0gAqEhDiANIA6hIQ4gAiAOoSEPIAIgAqIhDSAOIA6iIA2hIREgESAPIA6iIhSgIQ4gDiAUoCEOIA8gD6IgAiADIAOgoqAgDqAhDiAOIA2gIREgESANoSENQQAhFUEAIAFrIRYgDiANoSENIBAgE6EhD0ECIQBBASEBRAAAAAAAAAAAIRdBACEYQQAhGUEBIRogAyEbIAIhHCAFIR0gBCEeA0AgDCAMQRBqIBEgDSASIA8gBiAHIAggCRCngICAACAMKwMQIg9EAAAAAgAAoEGiIQ0gDSAPoSEOIA0gDqEhDiAPIA6hIRAgDyAPoiENIA4gDqIgDaEhESARIBAgDqIiEqAhDiAOIBKgIQ4gECAQoiAPIAwrAxgiHyAfoKKgIA6gIRQgFCANoCESIAwrAwAiEEQAAAACAACgQaIhDiAOIBChIREgDiARoSERIBAgEaEhEyAQIBCiIQ4gESARoiAOoSEgICAgEyARoiIhoCERIBEgIaAhESATIBOiIBAgDCsDCCIiICKgoqAgEaAhEyATIA6gIRECQCASIBGgIiBEAAAAAICELkFlDQAgCiAPRAAAAGCeoPY/oiAPIBCgIgsgC6IgDyAQoSILIAuioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgAgAbJDd3P4QpIgILa8IgGzQwAAADSUQ3dz+MKSIAFB////A3FBgICA+ANyviIjQ3W/v7+UkkOj6dy/ICND+US0PpKVkkMAAAA/lLwiAbNDAAAAtJSSIAFB////A3FBgICA+ANyviIjQ3W/vz+UkkOj6dw/ICND+US0PpKVkiEjDAkLAkAgC0QAAAAAAAAAAGUNAAJAIAEgGUcNACAiISAgG5ohJCAkICCgISEgISAgoSElICEgJaEhJiAgICahIScgJCAloSEoIBAhJCAcmiElICUgJKAhICAgICShISYgICAmoSEpICQgKaEhJCAlICahISUgJSAkoCAhoCEkICQgIKAhISAhICChISAgKCAnoCAkoCAgoSEgICAgIaAhJCAfISAgHZohJSAlICCgISEgISAgoSEmICEgJqEhJyAgICehISggJSAmoSEpIA8hJSAemiEmICYgJaAhICAgICWhIScgICAnoSEqICUgKqEhJSAmICehISYgJiAloCAhoCElICUgIKAhISAhICChISAgKSAooCAloCAgoSEgICAgIaAhIEEAIRkgIJogICAgRAAAAAAAAAAAYxsgJJogJCAkRAAAAAAAAAAAYxugIBdkDQAgCiAYsjgCAEMAwHnEISMMCgsgIiEgIAOaISQgJCAgoCEhICEgIKEhJSAhICWhISYgICAmoSEnICQgJaEhKCAQISQgApohJSAlICSgISAgICAkoSEmICAgJqEhKSAkICmhISQgJSAmoSElICUgJKAgIaAhJCAkICCgISEgISAgoSEgICggJ6AgJKAgIKEhICAgICGgISQgHyEgIAWaISUgJSAgoCEhICEgIKEhJiAhICahIScgICAnoSEoICUgJqEhKSAPISUgBJohJiAmICWgISAgICAloSEnICAgJ6EhKiAlICqhISUgJiAnoSEmICYgJaAgIaAhJSAlICCgISEgISAgoSEgICkgKKAgJaAgIKEhICAgICGgISACQCAgmiAgICBEAAAAAAAAAABjGyAkmiAkICREAAAAAAAAAABjG6AiICALZg0AIBkNACAAIBVrIRkgASAVayEYIA8hHiAfIR0gECEcICIhGyAgIRcLIAEgGkcNACAPIQQgHyEFIBAhAiAiIQMgACEaIAEhFQsgEiANoSENIBQgDaEhDyARIA6hIQ0gEyANoSENIABBAmohACAWIAFBAWoiAWpBAUcNAAsLQwDAecQhIyALRAAAAAAAAAAAZQ0GIApBADYCAAwGCyAMIAWaIiY5AxggDCAEmiInOQMQIAwgA5ogAyACRAAAAAAAAAAAYyIAGyIlOQMIIAwgApogAiAAGyIkOQMAAkAgAUEBSA0AICREAAAAAgAAoEGiIQIgAiAkoSEEIAIgBKEhBCAkIAShIQMgJCAkoiECIAQgBKIgAqEhBSAFIAMgBKIiDaAhBCAEIA2gIQQgAyADoiAkICUgJaCioCAEoCEEIAQgAqAhDiAOIAKhIQJBACEVQQAgAWshFiAEIAKhIQJBAiEAQQEhAUQAAAAAAAAAACEoQQAhGEEAIRlBASEaICUhKSAkISogJyEXICYhGwNAIAwgDEEQaiAOIAIgBiAHIAggCRCogICAACAMKwMAIgNEAAAAAgAAoEGiIQIgAiADoSEEIAIgBKEhBCADIAShIQUgAyADoiECIAQgBKIgAqEhDSANIAUgBKIiDqAhBCAEIA6gIQQgBSAFoiADIAwrAwgiEiASoKKgIASgIRAgECACoCEOIAwrAxAiBEQAAAACAACgQaIhBSAFIAShIQ0gBSANoSEFIAQgBaEhDyAEIASiIQ0gBSAFoiANoSERIBEgDyAFoiIToCEFIAUgE6AhBSAPIA+iIAQgDCsDGCIPIA+goqAgBaAhBSAFIA2gIQUCQCAFIA6gIgVEAAAAAICELkFlDQAgCiAERAAAAGCeoPY/oiAEIAOgIgsgC6IgBCADoSILIAuioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgAgAbJDd3P4QpIgBba8IgGzQwAAADSUQ3dz+MKSIAFB////A3FBgICA+ANyviIjQ3W/v7+UkkOj6dy/ICND+US0PpKVkkMAAAA/lLwiAbNDAAAAtJSSIAFB////A3FBgICA+ANyviIjQ3W/vz+UkkOj6dw/ICND+US0PpKVkiEjDAgLAkAgC0QAAAAAAAAAAGUNAAJAIAEgGUcNACASIQUgKZohESARIAWgIQ0gDSAFoSETIA0gE6EhFCAFIBShISAgESAToSEhIAMhESAqmiETIBMgEaAhBSAFIBGhIRQgBSAUoSEfIBEgH6EhESATIBShIRMgEyARoCANoCERIBEgBaAhDSANIAWhIQUgISAgoCARoCAFoSEFIAUgDaAhESAPIQUgG5ohEyATIAWgIQ0gDSAFoSEUIA0gFKEhICAFICChISEgEyAUoSEfIAQhEyAXmiEUIBQgE6AhBSAFIBOhISAgBSAgoSEiIBMgIqEhEyAUICChIRQgFCAToCANoCETIBMgBaAhDSANIAWhIQUgHyAhoCAToCAFoSEFIAUgDaAhBUEAIRkgBZogBSAFRAAAAAAAAAAAYxsgEZogESARRAAAAAAAAAAAYxugIChkDQAgCiAYsjgCAEMAwHnEISMMCQsgEiEFICWaIREgESAFoCENIA0gBaEhEyANIBOhIRQgBSAUoSEgIBEgE6EhISADIREgJJohEyATIBGgIQUgBSARoSEUIAUgFKEhHyARIB+hIREgEyAUoSETIBMgEaAgDaAhESARIAWgIQ0gDSAFoSEFICEgIKAgEaAgBaEhBSAFIA2gIREgDyEFICaaIRMgEyAFoCENIA0gBaEhFCANIBShISAgBSAgoSEhIBMgFKEhHyAEIRMgJ5ohFCAUIBOgIQUgBSAToSEgIAUgIKEhIiATICKhIRMgFCAgoSEUIBQgE6AgDaAhEyATIAWgIQ0gDSAFoSEFIB8gIaAgE6AgBaEhBSAFIA2gIQUCQCAFmiAFIAVEAAAAAAAAAABjGyARmiARIBFEAAAAAAAAAABjG6AiBSALZg0AIBkNACAAIBVrIRkgASAVayEYIA8hGyAEIRcgAyEqIBIhKSAFISgLIAEgGkcNACAEIScgDyEmIAMhJCASISUgACEaIAEhFQsgDiACoSECIBAgAqEhAiAAQQJqIQAgFiABQQFqIgFqQQFHDQALC0MAwHnEISMgC0QAAAAAAAAAAGUNBSAKQQA2AgAMBQsgDCAEOQMQIAwgAzkDCCAMIAI5AwAgDCAFOQMYAkAgAUEBSA0AIAREAAAAAgAAoEGiIQ0gDSAEoSEOIA0gDqEhDiAEIA6hIQ8gBCAEoiENIA4gDqIgDaEhECAQIA8gDqIiEaAhDiAOIBGgIQ4gDyAPoiAEIAUgBaCioCAOoCEQIBAgDaAhEiASIA2hIRMgAkQAAAACAACgQaIhDSANIAKhIQ4gDSAOoSEOIAIgDqEhDyACIAKiIQ0gDiAOoiANoSERIBEgDyAOoiIUoCEOIA4gFKAhDiAPIA+iIAIgAyADoKKgIA6gIQ4gDiANoCERIBEgDaEhDUEAIRVBACABayEWIA4gDaEhDSAQIBOhIQ9BAiEAQQEhAUQAAAAAAAAAACEXQQAhGEEAIRlBASEaIAMhGyACIRwgBSEdIAQhHgNAIAwgDEEQaiARIA0gEiAPIAYgByAIIAkQqYCAgAAgDCsDECIPRAAAAAIAAKBBoiENIA0gD6EhDiANIA6hIQ4gDyAOoSEQIA8gD6IhDSAOIA6iIA2hIREgESAQIA6iIhKgIQ4gDiASoCEOIBAgEKIgDyAMKwMYIh8gH6CioCAOoCEUIBQgDaAhEiAMKwMAIhBEAAAAAgAAoEGiIQ4gDiAQoSERIA4gEaEhESAQIBGhIRMgECAQoiEOIBEgEaIgDqEhICAgIBMgEaIiIaAhESARICGgIREgEyAToiAQIAwrAwgiIiAioKKgIBGgIRMgEyAOoCERAkAgEiARoCIgRAAAAACAhC5BZQ0AIAogD0QAAABgnqD2P6IgDyAQoCILIAuiIA8gEKEiCyALoqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIAIAGyQ3dz+EKSICC2vCIBs0MAAAA0lEN3c/jCkiABQf///wNxQYCAgPgDcr4iI0N1v7+/lJJDo+ncvyAjQ/lEtD6SlZJDAAAAP5S8IgGzQwAAALSUkiABQf///wNxQYCAgPgDcr4iI0N1v78/lJJDo+ncPyAjQ/lEtD6SlZIhIwwHCwJAIAtEAAAAAAAAAABlDQACQCABIBlHDQAgIiEgIBuaISQgJCAgoCEhICEgIKEhJSAhICWhISYgICAmoSEnICQgJaEhKCAQISQgHJohJSAlICSgISAgICAkoSEmICAgJqEhKSAkICmhISQgJSAmoSElICUgJKAgIaAhJCAkICCgISEgISAgoSEgICggJ6AgJKAgIKEhICAgICGgISQgHyEgIB2aISUgJSAgoCEhICEgIKEhJiAhICahIScgICAnoSEoICUgJqEhKSAPISUgHpohJiAmICWgISAgICAloSEnICAgJ6EhKiAlICqhISUgJiAnoSEmICYgJaAgIaAhJSAlICCgISEgISAgoSEgICkgKKAgJaAgIKEhICAgICGgISBBACEZICCaICAgIEQAAAAAAAAAAGMbICSaICQgJEQAAAAAAAAAAGMboCAXZA0AIAogGLI4AgBDAMB5xCEjDAgLICIhICADmiEkICQgIKAhISAhICChISUgISAloSEmICAgJqEhJyAkICWhISggECEkIAKaISUgJSAkoCEgICAgJKEhJiAgICahISkgJCApoSEkICUgJqEhJSAlICSgICGgISQgJCAgoCEhICEgIKEhICAoICegICSgICChISAgICAhoCEkIB8hICAFmiElICUgIKAhISAhICChISYgISAmoSEnICAgJ6EhKCAlICahISkgDyElIASaISYgJiAloCEgICAgJaEhJyAgICehISogJSAqoSElICYgJ6EhJiAmICWgICGgISUgJSAgoCEhICEgIKEhICApICigICWgICChISAgICAhoCEgAkAgIJogICAgRAAAAAAAAAAAYxsgJJogJCAkRAAAAAAAAAAAYxugIiAgC2YNACAZDQAgACAVayEZIAEgFWshGCAPIR4gHyEdIBAhHCAiIRsgICEXCyABIBpHDQAgDyEEIB8hBSAQIQIgIiEDIAAhGiABIRULIBIgDaEhDSAUIA2hIQ8gESAOoSENIBMgDaEhDSAAQQJqIQAgFiABQQFqIgFqQQFHDQALC0MAwHnEISMgC0QAAAAAAAAAAGUNBCAKQQA2AgAMBAsgDCAEOQMQIAwgAzkDCCAMIAI5AwAgDCAFOQMYAkAgAUEBSA0AIAREAAAAAgAAoEGiIQ0gDSAEoSEOIA0gDqEhDiAEIA6hIQ8gBCAEoiENIA4gDqIgDaEhECAQIA8gDqIiEaAhDiAOIBGgIQ4gDyAPoiAEIAUgBaCioCAOoCEQIBAgDaAhEiASIA2hIRMgAkQAAAACAACgQaIhDSANIAKhIQ4gDSAOoSEOIAIgDqEhDyACIAKiIQ0gDiAOoiANoSERIBEgDyAOoiIUoCEOIA4gFKAhDiAPIA+iIAIgAyADoKKgIA6gIQ4gDiANoCERIBEgDaEhDUEAIRVBACABayEWIA4gDaEhDSAQIBOhIQ9BAiEAQQEhAUQAAAAAAAAAACEXQQAhGEEAIRlBASEaIAMhGyACIRwgBSEdIAQhHgNAIAwgDEEQaiARIA0gEiAPIAYgByAIIAkQqoCAgAAgDCsDECIPRAAAAAIAAKBBoiENIA0gD6EhDiANIA6hIQ4gDyAOoSEQIA8gD6IhDSAOIA6iIA2hIREgESAQIA6iIhKgIQ4gDiASoCEOIBAgEKIgDyAMKwMYIh8gH6CioCAOoCEUIBQgDaAhEiAMKwMAIhBEAAAAAgAAoEGiIQ4gDiAQoSERIA4gEaEhESAQIBGhIRMgECAQoiEOIBEgEaIgDqEhICAgIBMgEaIiIaAhESARICGgIREgEyAToiAQIAwrAwgiIiAioKKgIBGgIRMgEyAOoCERAkAgEiARoCIgRAAAAACAhC5BZQ0AIAogD0QAAABgnqD2P6IgDyAQoCILIAuiIA8gEKEiCyALoqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIAIAGyQ3dz+EKSICC2vCIBs0MAAAA0lEN3c/jCkiABQf///wNxQYCAgPgDcr4iI0N1v7+/lJJDo+ncvyAjQ/lEtD6SlZJDAAAAP5S8IgGzQwAAALSUkiABQf///wNxQYCAgPgDcr4iI0N1v78/lJJDo+ncPyAjQ/lEtD6SlZIhIwwGCwJAIAtEAAAAAAAAAABlDQACQCABIBlHDQAgIiEgIBuaISQgJCAgoCEhICEgIKEhJSAhICWhISYgICAmoSEnICQgJaEhKCAQISQgHJohJSAlICSgISAgICAkoSEmICAgJqEhKSAkICmhISQgJSAmoSElICUgJKAgIaAhJCAkICCgISEgISAgoSEgICggJ6AgJKAgIKEhICAgICGgISQgHyEgIB2aISUgJSAgoCEhICEgIKEhJiAhICahIScgICAnoSEoICUgJqEhKSAPISUgHpohJiAmICWgISAgICAloSEnICAgJ6EhKiAlICqhISUgJiAnoSEmICYgJaAgIaAhJSAlICCgISEgISAgoSEgICkgKKAgJaAgIKEhICAgICGgISBBACEZICCaICAgIEQAAAAAAAAAAGMbICSaICQgJEQAAAAAAAAAAGMboCAXZA0AIAogGLI4AgBDAMB5xCEjDAcLICIhICADmiEkICQgIKAhISAhICChISUgISAloSEmICAgJqEhJyAkICWhISggECEkIAKaISUgJSAkoCEgICAgJKEhJiAgICahISkgJCApoSEkICUgJqEhJSAlICSgICGgISQgJCAgoCEhICEgIKEhICAoICegICSgICChISAgICAhoCEkIB8hICAFmiElICUgIKAhISAhICChISYgISAmoSEnICAgJ6EhKCAlICahISkgDyElIASaISYgJiAloCEgICAgJaEhJyAgICehISogJSAqoSElICYgJ6EhJiAmICWgICGgISUgJSAgoCEhICEgIKEhICApICigICWgICChISAgICAhoCEgAkAgIJogICAgRAAAAAAAAAAAYxsgJJogJCAkRAAAAAAAAAAAYxugIiAgC2YNACAZDQAgACAVayEZIAEgFWshGCAPIR4gHyEdIBAhHCAiIRsgICEXCyABIBpHDQAgDyEEIB8hBSAQIQIgIiEDIAAhGiABIRULIBIgDaEhDSAUIA2hIQ8gESAOoSENIBMgDaEhDSAAQQJqIQAgFiABQQFqIgFqQQFHDQALC0MAwHnEISMgC0QAAAAAAAAAAGUNAyAKQQA2AgAMAwsgDCAEOQMQIAwgAzkDCCAMIAI5AwAgDCAFOQMYAkAgAUEBSA0AIAREAAAAAgAAoEGiIQ0gDSAEoSEOIA0gDqEhDiAEIA6hIQ8gBCAEoiENIA4gDqIgDaEhECAQIA8gDqIiEaAhDiAOIBGgIQ4gDyAPoiAEIAUgBaCioCAOoCEQIBAgDaAhEiASIA2hIRMgAkQAAAACAACgQaIhDSANIAKhIQ4gDSAOoSEOIAIgDqEhDyACIAKiIQ0gDiAOoiANoSERIBEgDyAOoiIUoCEOIA4gFKAhDiAPIA+iIAIgAyADoKKgIA6gIQ4gDiANoCERIBEgDaEhDSAOIA2hIQ0gECAToSEPQQAhAEECIRZBACEYQQEhGUQAAAAAAAAAACEXQQAhK0EAIRpBASEsIAMhGyACIRwgBSEdIAQhHgNAAkACQCAZQQpuQQpsQX9qIAAiFUcNACAMIAxBEGogESANIBIgDyAGIAcgCCAJEKSAgIAADAELIAwgDEEQaiARIA0gEiAPIAYgByAIIAkQnoCAgAALIBVBAWohACAMKwMQIg9EAAAAAgAAoEGiIQ0gDSAPoSEOIA0gDqEhDiAPIA6hIRAgDyAPoiENIA4gDqIgDaEhESARIBAgDqIiEqAhDiAOIBKgIQ4gECAQoiAPIAwrAxgiHyAfoKKgIA6gIRQgFCANoCESIAwrAwAiEEQAAAACAACgQaIhDiAOIBChIREgDiARoSERIBAgEaEhEyAQIBCiIQ4gESARoiAOoSEgICAgEyARoiIhoCERIBEgIaAhESATIBOiIBAgDCsDCCIiICKgoqAgEaAhEyATIA6gIRECQCASIBGgIiBEAAAAAICELkFlDQAgCiAPRAAAAGCeoPY/oiAPIBCgIgsgC6IgDyAQoSILIAuioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgAgALJDd3P4QpIgILa8IgGzQwAAADSUQ3dz+MKSIAFB////A3FBgICA+ANyviIjQ3W/v7+UkkOj6dy/ICND+US0PpKVkkMAAAA/lLwiAbNDAAAAtJSSIAFB////A3FBgICA+ANyviIjQ3W/vz+UkkOj6dw/ICND+US0PpKVkiEjDAULAkAgC0QAAAAAAAAAAGUNAAJAIAAgGkcNACAiISAgG5ohJCAkICCgISEgISAgoSElICEgJaEhJiAgICahIScgJCAloSEoIBAhJCAcmiElICUgJKAhICAgICShISYgICAmoSEpICQgKaEhJCAlICahISUgJSAkoCAhoCEkICQgIKAhISAhICChISAgKCAnoCAkoCAgoSEgICAgIaAhJCAfISAgHZohJSAlICCgISEgISAgoSEmICEgJqEhJyAgICehISggJSAmoSEpIA8hJSAemiEmICYgJaAhICAgICWhIScgICAnoSEqICUgKqEhJSAmICehISYgJiAloCAhoCElICUgIKAhISAhICChISAgKSAooCAloCAgoSEgICAgIaAhIEEAIRogIJogICAgRAAAAAAAAAAAYxsgJJogJCAkRAAAAAAAAAAAYxugIBdkDQAgCiArsjgCAEMAwHnEISMMBgsgIiEgIAOaISQgJCAgoCEhICEgIKEhJSAhICWhISYgICAmoSEnICQgJaEhKCAQISQgApohJSAlICSgISAgICAkoSEmICAgJqEhKSAkICmhISQgJSAmoSElICUgJKAgIaAhJCAkICCgISEgISAgoSEgICggJ6AgJKAgIKEhICAgICGgISQgHyEgIAWaISUgJSAgoCEhICEgIKEhJiAhICahIScgICAnoSEoICUgJqEhKSAPISUgBJohJiAmICWgISAgICAloSEnICAgJ6EhKiAlICqhISUgJiAnoSEmICYgJaAgIaAhJSAlICCgISEgISAgoSEgICkgKKAgJaAgIKEhICAgICGgISACQCAgmiAgICBEAAAAAAAAAABjGyAkmiAkICREAAAAAAAAAABjG6AiICALZg0AIBoNACAWIBhrIRogFSAYa0EBaiErIA8hHiAfIR0gECEcICIhGyAgIRcLIAAgLEcNACAPIQQgHyEFIBAhAiAiIQMgFiEsIAAhGAsgEiANoSENIBQgDaEhDyARIA6hIQ0gEyANoSENIBZBAmohFiAZQQFqIRkgASAARw0ACwtDAMB5xCEjIAtEAAAAAAAAAABlDQIgCkEANgIADAILIAwgBDkDECAMIAM5AwggDCACOQMAIAwgBTkDGAJAIAFBAUgNACAERAAAAAIAAKBBoiENIA0gBKEhDiANIA6hIQ4gBCAOoSEPIAQgBKIhDSAOIA6iIA2hIRAgECAPIA6iIhGgIQ4gDiARoCEOIA8gD6IgBCAFIAWgoqAgDqAhECAQIA2gIRIgEiANoSETIAJEAAAAAgAAoEGiIQ0gDSACoSEOIA0gDqEhDiACIA6hIQ8gAiACoiENIA4gDqIgDaEhESARIA8gDqIiFKAhDiAOIBSgIQ4gDyAPoiACIAMgA6CioCAOoCEOIA4gDaAhESARIA2hIQ0gDiANoSENIBAgE6EhD0EAIQBBAiEWQQAhGEEBIRlEAAAAAAAAAAAhF0EAIStBACEaQQEhLCADIRsgAiEcIAUhHSAEIR4DQAJAAkAgGUEKbkEKbEF/aiAAIhVHDQAgDCAMQRBqIBEgDSASIA8gBiAHIAggCRClgICAAAwBCyAMIAxBEGogESANIBIgDyAGIAcgCCAJEJ+AgIAACyAVQQFqIQAgDCsDECIPRAAAAAIAAKBBoiENIA0gD6EhDiANIA6hIQ4gDyAOoSEQIA8gD6IhDSAOIA6iIA2hIREgESAQIA6iIhKgIQ4gDiASoCEOIBAgEKIgDyAMKwMYIh8gH6CioCAOoCEUIBQgDaAhEiAMKwMAIhBEAAAAAgAAoEGiIQ4gDiAQoSERIA4gEaEhESAQIBGhIRMgECAQoiEOIBEgEaIgDqEhICAgIBMgEaIiIaAhESARICGgIREgEyAToiAQIAwrAwgiIiAioKKgIBGgIRMgEyAOoCERAkAgEiARoCIgRAAAAACAhC5BZQ0AIAogD0QAAABgnqD2P6IgDyAQoCILIAuiIA8gEKEiCyALoqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIAIACyICC2vCIBs0MAAAA0lEN3c/jCkiABQf///wNxQYCAgPgDcr4iI0N1v7+/lJJDo+ncvyAjQ/lEtD6SlZJDAAAAP5S8IgGzQwAAADSUQ3dz+MKSIAFB////A3FBgICA+ANyviIjQ3W/v7+UkkOj6dy/ICND+US0PpKVkkOdhCG/lJIhIwwECwJAIAtEAAAAAAAAAABlDQACQCAAIBpHDQAgIiEgIBuaISQgJCAgoCEhICEgIKEhJSAhICWhISYgICAmoSEnICQgJaEhKCAQISQgHJohJSAlICSgISAgICAkoSEmICAgJqEhKSAkICmhISQgJSAmoSElICUgJKAgIaAhJCAkICCgISEgISAgoSEgICggJ6AgJKAgIKEhICAgICGgISQgHyEgIB2aISUgJSAgoCEhICEgIKEhJiAhICahIScgICAnoSEoICUgJqEhKSAPISUgHpohJiAmICWgISAgICAloSEnICAgJ6EhKiAlICqhISUgJiAnoSEmICYgJaAgIaAhJSAlICCgISEgISAgoSEgICkgKKAgJaAgIKEhICAgICGgISBBACEaICCaICAgIEQAAAAAAAAAAGMbICSaICQgJEQAAAAAAAAAAGMboCAXZA0AIAogK7I4AgBDAMB5xCEjDAULICIhICADmiEkICQgIKAhISAhICChISUgISAloSEmICAgJqEhJyAkICWhISggECEkIAKaISUgJSAkoCEgICAgJKEhJiAgICahISkgJCApoSEkICUgJqEhJSAlICSgICGgISQgJCAgoCEhICEgIKEhICAoICegICSgICChISAgICAhoCEkIB8hICAFmiElICUgIKAhISAhICChISYgISAmoSEnICAgJ6EhKCAlICahISkgDyElIASaISYgJiAloCEgICAgJaEhJyAgICehISogJSAqoSElICYgJ6EhJiAmICWgICGgISUgJSAgoCEhICEgIKEhICApICigICWgICChISAgICAhoCEgAkAgIJogICAgRAAAAAAAAAAAYxsgJJogJCAkRAAAAAAAAAAAYxugIiAgC2YNACAaDQAgFiAYayEaIBUgGGtBAWohKyAPIR4gHyEdIBAhHCAiIRsgICEXCyAAICxHDQAgDyEEIB8hBSAQIQIgIiEDIBYhLCAAIRgLIBIgDaEhDSAUIA2hIQ8gESAOoSENIBMgDaEhDSAWQQJqIRYgGUEBaiEZIAEgAEcNAAsLQwDAecQhIyALRAAAAAAAAAAAZQ0BIApBADYCAAwBCyAMIAQ5AxAgDCADOQMIIAwgAjkDACAMIAU5AxgCQCABQQFIDQAgBEQAAAACAACgQaIhDSANIAShIQ4gDSAOoSEOIAQgDqEhDyAEIASiIQ0gDiAOoiANoSEQIBAgDyAOoiIRoCEOIA4gEaAhDiAPIA+iIAQgBSAFoKKgIA6gIRAgECANoCESIBIgDaEhEyACRAAAAAIAAKBBoiENIA0gAqEhDiANIA6hIQ4gAiAOoSEPIAIgAqIhDSAOIA6iIA2hIREgESAPIA6iIhSgIQ4gDiAUoCEOIA8gD6IgAiADIAOgoqAgDqAhDiAOIA2gIREgESANoSENIA4gDaEhDSAQIBOhIQ9BACEAQQIhFkEAIRhBASEZRAAAAAAAAAAAIRdBACErQQAhGkEBISwgAyEbIAIhHCAFIR0gBCEeA0ACQAJAIBlBCm5BCmxBf2ogACIVRw0AIAwgDEEQaiARIA0gEiAPIAYgByAIIAkQpoCAgAAMAQsgDCAMQRBqIBEgDSASIA8gBiAHIAggCRCggICAAAsgFUEBaiEAIAwrAxAiD0QAAAACAACgQaIhDSANIA+hIQ4gDSAOoSEOIA8gDqEhECAPIA+iIQ0gDiAOoiANoSERIBEgECAOoiISoCEOIA4gEqAhDiAQIBCiIA8gDCsDGCIfIB+goqAgDqAhFCAUIA2gIRIgDCsDACIQRAAAAAIAAKBBoiEOIA4gEKEhESAOIBGhIREgECARoSETIBAgEKIhDiARIBGiIA6hISAgICATIBGiIiGgIREgESAhoCERIBMgE6IgECAMKwMIIiIgIqCioCARoCETIBMgDqAhEQJAIBIgEaAiIEQAAAAAgIQuQWUNACAKIA9EAAAAYJ6g9j+iIA8gEKAiCyALoiAPIBChIgsgC6Kgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCACAAsiAgtrwiAbNDAAAANJRDd3P4wpIgAUH///8DcUGAgID4A3K+IiNDdb+/v5SSQ6Pp3L8gI0P5RLQ+kpWSQwAAAD+UvCIBs0MAAAA0lEN3c/jCkiABQf///wNxQYCAgPgDcr4iI0N1v7+/lJJDo+ncvyAjQ/lEtD6SlZJDAAAAP5STISMMAwsCQCALRAAAAAAAAAAAZQ0AAkAgACAaRw0AICIhICAbmiEkICQgIKAhISAhICChISUgISAloSEmICAgJqEhJyAkICWhISggECEkIByaISUgJSAkoCEgICAgJKEhJiAgICahISkgJCApoSEkICUgJqEhJSAlICSgICGgISQgJCAgoCEhICEgIKEhICAoICegICSgICChISAgICAhoCEkIB8hICAdmiElICUgIKAhISAhICChISYgISAmoSEnICAgJ6EhKCAlICahISkgDyElIB6aISYgJiAloCEgICAgJaEhJyAgICehISogJSAqoSElICYgJ6EhJiAmICWgICGgISUgJSAgoCEhICEgIKEhICApICigICWgICChISAgICAhoCEgQQAhGiAgmiAgICBEAAAAAAAAAABjGyAkmiAkICREAAAAAAAAAABjG6AgF2QNACAKICuyOAIAQwDAecQhIwwECyAiISAgA5ohJCAkICCgISEgISAgoSElICEgJaEhJiAgICahIScgJCAloSEoIBAhJCACmiElICUgJKAhICAgICShISYgICAmoSEpICQgKaEhJCAlICahISUgJSAkoCAhoCEkICQgIKAhISAhICChISAgKCAnoCAkoCAgoSEgICAgIaAhJCAfISAgBZohJSAlICCgISEgISAgoSEmICEgJqEhJyAgICehISggJSAmoSEpIA8hJSAEmiEmICYgJaAhICAgICWhIScgICAnoSEqICUgKqEhJSAmICehISYgJiAloCAhoCElICUgIKAhISAhICChISAgKSAooCAloCAgoSEgICAgIaAhIAJAICCaICAgIEQAAAAAAAAAAGMbICSaICQgJEQAAAAAAAAAAGMboCIgIAtmDQAgGg0AIBYgGGshGiAVIBhrQQFqISsgDyEeIB8hHSAQIRwgIiEbICAhFwsgACAsRw0AIA8hBCAfIQUgECECICIhAyAWISwgACEYCyASIA2hIQ0gFCANoSEPIBEgDqEhDSATIA2hIQ0gFkECaiEWIBlBAWohGSABIABHDQALC0MAwHnEISMgC0QAAAAAAAAAAGUNACAKQQA2AgALIAxBIGokgICAgAAgIwuIpQIJAX8IfAJ/AXwDfwx8AX0WfAJ/I4CAgIAAQSBrIgwkgICAgAACQAJAAkACQAJAAkACQAJAAkACQAJAAkACQAJAAkACQAJAIABBf2oODwABAgMEBQYHCAkKCwwNDg8LIAwgBDkDECAMIAM5AwggDCACOQMAIAwgBTkDGAJAIAFBAUgNACAERAAAAAIAAKBBoiENIA0gBKEhDiANIA6hIQ4gBCAOoSEPIAQgBKIhDSAOIA6iIA2hIRAgECAPIA6iIhGgIQ4gDiARoCEOIA8gD6IgBCAFIAWgoqAgDqAhESARIA2gIRAgECANoSESIAJEAAAAAgAAoEGiIQ0gDSACoSEOIA0gDqEhDiACIA6hIQ8gAiACoiENIA4gDqIgDaEhEyATIA8gDqIiFKAhDiAOIBSgIQ4gDyAPoiACIAMgA6CioCAOoCEOIA4gDaAhDyAPIA2hIQ1BACEVQQAgAWshFiAOIA2hIQ0gESASoSESQQIhAEEBIQFEAAAAAAAAAAAhF0EAIRhBACEZQQEhGkQAAAAAAADwPyEbRAAAAAAAAAAAIRwgAiEdIAQhHiADIR8gAiEgIAUhISAEISIDQCACIRQgBCEjIAwgDEEQaiAPIA0gECASIAYgByAIIAkQq4CAgAAgDCsDECIERAAAAAIAAKBBoiECIAIgBKEhDSACIA2hIQIgBCACoSEOIAQgBKIhDSACIAKiIA2hIQ8gDyAOIAKiIhCgIQIgAiAQoCECIA4gDqIgBCAMKwMYIiQgJKCioCACoCESIBIgDaAhECAMKwMAIgJEAAAAAgAAoEGiIQ4gDiACoSEPIA4gD6EhDyACIA+hIREgAiACoiEOIA8gD6IgDqEhEyATIBEgD6IiJaAhDyAPICWgIQ8gESARoiACIAwrAwgiJSAloKKgIA+gIREgESAOoCEPIBQgGyIToiAcICOioSImICagRAAAAAAAAPA/oCEbIBwgFKIgEyAjoqAiEyAToCEcAkAgECAPoCITRAAAAACAhC5BZQ0AIAogBCAcoiACIBuioCAbIBuiIBwgHKKgIgWjIgMgBCAboiACIByioSAFoyIEoEQAAABgnqDmP6IgAyADoiAEIASioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgAgAbJDd3P4QpIgE7a8IgGzQwAAADSUQ3dz+MKSIAFB////A3FBgICA+ANyviInQ3W/v7+UkkOj6dy/ICdD+US0PpKVkkMAAAA/lLwiAbNDAAAAtJSSIAFB////A3FBgICA+ANyviInQ3W/vz+UkkOj6dw/ICdD+US0PpKVkiEnDBILAkAgC0QAAAAAAAAAAGUNAAJAIAEgGUcNACAlIRMgH5ohIyAjIBOgIRQgFCAToSEmIBQgJqEhKCATICihISkgIyAmoSEqIAIhIyAgmiEmICYgI6AhEyATICOhISggEyAooSErICMgK6EhIyAmICihISYgJiAjoCAUoCEjICMgE6AhFCAUIBOhIRMgKiApoCAjoCAToSETIBMgFKAhIyAkIRMgIZohJiAmIBOgIRQgFCAToSEoIBQgKKEhKSATICmhISogJiAooSErIAQhJiAimiEoICggJqAhEyATICahISkgEyApoSEsICYgLKEhJiAoICmhISggKCAmoCAUoCEmICYgE6AhFCAUIBOhIRMgKyAqoCAmoCAToSETIBMgFKAhE0EAIRkgE5ogEyATRAAAAAAAAAAAYxsgI5ogIyAjRAAAAAAAAAAAYxugIBdkDQAgCiAYsjgCAEMAwHnEIScMEwsgJSETIAOaISMgIyAToCEUIBQgE6EhJiAUICahISggEyAooSEpICMgJqEhKiACISMgHZohJiAmICOgIRMgEyAjoSEoIBMgKKEhKyAjICuhISMgJiAooSEmICYgI6AgFKAhIyAjIBOgIRQgFCAToSETICogKaAgI6AgE6EhEyATIBSgISMgJCETIAWaISYgJiAToCEUIBQgE6EhKCAUICihISkgEyApoSEqICYgKKEhKyAEISYgHpohKCAoICagIRMgEyAmoSEpIBMgKaEhLCAmICyhISYgKCApoSEoICggJqAgFKAhJiAmIBOgIRQgFCAToSETICsgKqAgJqAgE6EhEyATIBSgIRMCQCATmiATIBNEAAAAAAAAAABjGyAjmiAjICNEAAAAAAAAAABjG6AiEyALZg0AIBkNACAAIBVrIRkgASAVayEYIAQhIiAkISEgAiEgICUhHyATIRcLIAEgGkcNACAEIR4gJCEFIAIhHSAlIQMgACEaIAEhFQsgECANoSENIBIgDaEhEiAPIA6hIQ0gESANoSENIABBAmohACAWIAFBAWoiAWpBAUcNAAsLQwDAecQhJyALRAAAAAAAAAAAZQ0PIApBADYCAAwPCyAMIAQ5AxAgDCADOQMIIAwgAjkDACAMIAU5AxgCQCABQQFIDQAgBEQAAAACAACgQaIhDSANIAShIQ4gDSAOoSEOIAQgDqEhDyAEIASiIQ0gDiAOoiANoSEQIBAgDyAOoiIRoCEOIA4gEaAhDiAPIA+iIAQgBSAFoKKgIA6gIREgESANoCEQIBAgDaEhEiACRAAAAAIAAKBBoiENIA0gAqEhDiANIA6hIQ4gAiAOoSEPIAIgAqIhDSAOIA6iIA2hIRMgEyAPIA6iIhSgIQ4gDiAUoCEOIA8gD6IgAiADIAOgoqAgDqAhDiAOIA2gIQ8gDyANoSENQQAhFUEAIAFrIRYgDiANoSENIBEgEqEhEkECIQBBASEBRAAAAAAAAAAAIRdBACEYQQAhGUEBIRpEAAAAAAAA8D8hHEQAAAAAAAAAACEbIAIhHSAEIR4gAyEfIAIhICAFISEgBCEiA0AgAiEUIAQhIyAMIAxBEGogDyImIA0gECIoIBIgBiAHIAggCRCsgICAACAMKwMQIgREAAAAAgAAoEGiIQIgAiAEoSENIAIgDaEhAiAEIAKhIQ4gBCAEoiENIAIgAqIgDaEhDyAPIA4gAqIiEKAhAiACIBCgIQIgDiAOoiAEIAwrAxgiJCAkoKKgIAKgIRIgEiANoCEQIAwrAwAiAkQAAAACAACgQaIhDiAOIAKhIQ8gDiAPoSEPIAIgD6EhESACIAKiIQ4gDyAPoiAOoSETIBMgESAPoiIloCEPIA8gJaAhDyARIBGiIAIgDCsDCCIlICWgoqAgD6AhESARIA6gIQ8gGyITICYgKKEiJqIgHCAjIBQgFKCiIhSioEQAAAAAAAAIQKIhGyAcICaiIBMgFKKhRAAAAAAAAAhAokQAAAAAAADwP6AhHAJAIBAgD6AiE0QAAAAAgIQuQWUNACAKIAQgG6IgAiAcoqAgHCAcoiAbIBuioCIFoyIDIAQgHKIgAiAboqEgBaMiBKBEAAAAYJ6g5j+iIAMgA6IgBCAEoqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIAIAGyIBO2vCIBs0MAAAA0lEN3c/jCkiABQf///wNxQYCAgPgDcr4iJ0N1v7+/lJJDo+ncvyAnQ/lEtD6SlZJDAAAAP5S8IgGzQwAAADSUQ3dz+MKSIAFB////A3FBgICA+ANyviInQ3W/v7+UkkOj6dy/ICdD+US0PpKVkkOdhCG/lJIhJwwRCwJAIAtEAAAAAAAAAABlDQACQCABIBlHDQAgJSETIB+aISMgIyAToCEUIBQgE6EhJiAUICahISggEyAooSEpICMgJqEhKiACISMgIJohJiAmICOgIRMgEyAjoSEoIBMgKKEhKyAjICuhISMgJiAooSEmICYgI6AgFKAhIyAjIBOgIRQgFCAToSETICogKaAgI6AgE6EhEyATIBSgISMgJCETICGaISYgJiAToCEUIBQgE6EhKCAUICihISkgEyApoSEqICYgKKEhKyAEISYgIpohKCAoICagIRMgEyAmoSEpIBMgKaEhLCAmICyhISYgKCApoSEoICggJqAgFKAhJiAmIBOgIRQgFCAToSETICsgKqAgJqAgE6EhEyATIBSgIRNBACEZIBOaIBMgE0QAAAAAAAAAAGMbICOaICMgI0QAAAAAAAAAAGMboCAXZA0AIAogGLI4AgBDAMB5xCEnDBILICUhEyADmiEjICMgE6AhFCAUIBOhISYgFCAmoSEoIBMgKKEhKSAjICahISogAiEjIB2aISYgJiAjoCETIBMgI6EhKCATICihISsgIyAroSEjICYgKKEhJiAmICOgIBSgISMgIyAToCEUIBQgE6EhEyAqICmgICOgIBOhIRMgEyAUoCEjICQhEyAFmiEmICYgE6AhFCAUIBOhISggFCAooSEpIBMgKaEhKiAmICihISsgBCEmIB6aISggKCAmoCETIBMgJqEhKSATICmhISwgJiAsoSEmICggKaEhKCAoICagIBSgISYgJiAToCEUIBQgE6EhEyArICqgICagIBOhIRMgEyAUoCETAkAgE5ogEyATRAAAAAAAAAAAYxsgI5ogIyAjRAAAAAAAAAAAYxugIhMgC2YNACAZDQAgACAVayEZIAEgFWshGCAEISIgJCEhIAIhICAlIR8gEyEXCyABIBpHDQAgBCEeICQhBSACIR0gJSEDIAAhGiABIRULIBAgDaEhDSASIA2hIRIgDyAOoSENIBEgDaEhDSAAQQJqIQAgFiABQQFqIgFqQQFHDQALC0MAwHnEIScgC0QAAAAAAAAAAGUNDiAKQQA2AgAMDgsgDCAEOQMQIAwgAzkDCCAMIAI5AwAgDCAFOQMYAkAgAUEBSA0AIAREAAAAAgAAoEGiIQ0gDSAEoSEOIA0gDqEhDiAEIA6hIQ8gBCAEoiENIA4gDqIgDaEhECAQIA8gDqIiEaAhDiAOIBGgIQ4gDyAPoiAEIAUgBaCioCAOoCERIBEgDaAhECAQIA2hIRIgAkQAAAACAACgQaIhDSANIAKhIQ4gDSAOoSEOIAIgDqEhDyACIAKiIQ0gDiAOoiANoSETIBMgDyAOoiIUoCEOIA4gFKAhDiAPIA+iIAIgAyADoKKgIA6gIQ4gDiANoCEPIA8gDaEhDUEAIRVBACABayEWIA4gDaEhDSARIBKhIRJBAiEAQQEhAUQAAAAAAAAAACEXQQAhGEEAIRlBASEaRAAAAAAAAPA/IRxEAAAAAAAAAAAhIyACIR0gBCEeIAMhHyACISAgBSEhIAQhIgNAIAIhEyAEIRQgDCAMQRBqIA8iJiANIBAiKCASIAYgByAIIAkQrYCAgAAgDCsDECIERAAAAAIAAKBBoiECIAIgBKEhDSACIA2hIQIgBCACoSEOIAQgBKIhDSACIAKiIA2hIQ8gDyAOIAKiIhCgIQIgAiAQoCECIA4gDqIgBCAMKwMYIiUgJaCioCACoCESIBIgDaAhECAMKwMAIgJEAAAAAgAAoEGiIQ4gDiACoSEPIA4gD6EhDyACIA+hIREgAiACoiEOIA8gD6IgDqEhJCAkIBEgD6IiKaAhDyAPICmgIQ8gESARoiACIAwrAwgiJCAkoKKgIA+gIREgESAOoCEPICMgE6IgHCAUoqAiKSAmICihRAAAAAAAABBAoiImoiAcIBOiICMgFKKhIhwgEyAURAAAAAAAACBAoqIiE6KgISNEAAAAAAAA8D8gKSAToqEgHCAmoqAhHAJAIBAgD6AiE0QAAAAAgIQuQWUNACAKIAQgI6IgAiAcoqAgHCAcoiAjICOioCIFoyIDIAQgHKIgAiAjoqEgBaMiBKBEAAAAYJ6g5j+iIAMgA6IgBCAEoqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIAIAGyIBO2vCIBs0MAAAA0lEN3c/jCkiABQf///wNxQYCAgPgDcr4iJ0N1v7+/lJJDo+ncvyAnQ/lEtD6SlZJDAAAAP5S8IgGzQwAAADSUQ3dz+MKSIAFB////A3FBgICA+ANyviInQ3W/v7+UkkOj6dy/ICdD+US0PpKVkkMAAAA/lJMhJwwQCwJAIAtEAAAAAAAAAABlDQACQCABIBlHDQAgJCETIB+aISYgJiAToCEUIBQgE6EhKCAUICihISkgEyApoSEbICYgKKEhKiACISYgIJohKCAoICagIRMgEyAmoSEpIBMgKaEhKyAmICuhISYgKCApoSEoICggJqAgFKAhJiAmIBOgIRQgFCAToSETICogG6AgJqAgE6EhEyATIBSgISYgJSETICGaISggKCAToCEUIBQgE6EhKSAUICmhIRsgEyAboSEqICggKaEhKyAEISggIpohKSApICigIRMgEyAooSEbIBMgG6EhLCAoICyhISggKSAboSEpICkgKKAgFKAhKCAoIBOgIRQgFCAToSETICsgKqAgKKAgE6EhEyATIBSgIRNBACEZIBOaIBMgE0QAAAAAAAAAAGMbICaaICYgJkQAAAAAAAAAAGMboCAXZA0AIAogGLI4AgBDAMB5xCEnDBELICQhEyADmiEmICYgE6AhFCAUIBOhISggFCAooSEpIBMgKaEhGyAmICihISogAiEmIB2aISggKCAmoCETIBMgJqEhKSATICmhISsgJiAroSEmICggKaEhKCAoICagIBSgISYgJiAToCEUIBQgE6EhEyAqIBugICagIBOhIRMgEyAUoCEmICUhEyAFmiEoICggE6AhFCAUIBOhISkgFCApoSEbIBMgG6EhKiAoICmhISsgBCEoIB6aISkgKSAooCETIBMgKKEhGyATIBuhISwgKCAsoSEoICkgG6EhKSApICigIBSgISggKCAToCEUIBQgE6EhEyArICqgICigIBOhIRMgEyAUoCETAkAgE5ogEyATRAAAAAAAAAAAYxsgJpogJiAmRAAAAAAAAAAAYxugIhMgC2YNACAZDQAgACAVayEZIAEgFWshGCAEISIgJSEhIAIhICAkIR8gEyEXCyABIBpHDQAgBCEeICUhBSACIR0gJCEDIAAhGiABIRULIBAgDaEhDSASIA2hIRIgDyAOoSENIBEgDaEhDSAAQQJqIQAgFiABQQFqIgFqQQFHDQALC0MAwHnEIScgC0QAAAAAAAAAAGUNDSAKQQA2AgAMDQsCQCABQQFIDQAgBEQAAAACAACgQaIhDSANIAShIQ4gDSAOoSEOIAQgDqEhDyAEIASiIQ0gDiAOoiANoSEQIBAgDyAOoiIRoCEOIA4gEaAhDiAPIA+iIAQgBSAFoKKgIA6gIRAgECANoCEmICYgDaEhESACRAAAAAIAAKBBoiENIA0gAqEhDiANIA6hIQ4gAiAOoSEPIAIgAqIhDSAOIA6iIA2hIRIgEiAPIA6iIhOgIQ4gDiAToCEOIA8gD6IgAiADIAOgoqAgDqAhDiAOIA2gIRIgEiANoSENQQAhFUEAIAFrIRYgDiANoSEpIBAgEaEhLEQAAIACAADEQSENIA1EAAAAAAAAFMCgIQ4gDSAOoSEoRAAAgAIAANRBIQ0gDUQAAAAAAAAkwKAhDiANIA6hIR1BAiEAQQEhAUQAAAAAAAAAACEtQQAhGEEAIRlBASEaRAAAAAAAAPA/IR5EAAAAAAAAAAAhFyADISAgAiEhIAQhLiAFIS8gAiEwIAMhMSAEISIgBSEyA0AgEiINRAAAAAIAAKBBoiEOIA4gDaEhDyAOIA+hIQ8gDSAPoSERIA1EAAAAAAAAFECiIRAgDyAooiAQoSEOIA4gESAooqAhDkQAAAAAAAAUQCAooSElIA4gDyAloqAhDiARICWiIClEAAAAAAAAFECioCAOoCESIBIgEKAhDiAOIBChIRAgEiAQoSEkICYiEEQAAAACAACgQaIhEiASIBChIRMgEiAToSESIBAgEqEhFCAQRAAAAAAAACRAoiETIB0gEqIgE6EhHCAcIB0gFKKgISNEAAAAAAAAJEAgHaEhHCAjIBwgEqKgISMgHCAUoiAsRAAAAAAAACRAoqAgI6AhHCAcIBOgISMgIyAToSETIBMgHKEhHCAcICSgISYgJiAkoSETICYgE6EhGyAkIBuhIRsgHCAToSEqICOaISMgIyAOoCETIBMgDqEhJCATICShISsgDiAroSEOICMgJKEhJCAkIA6gICagIQ4gDiAToCEkICQgE6EhEyAqIBugIA6gIBOhISYgJiAkoCEOIA4gJKEhKiAORAAAAAIAAKBBoiETIBMgDqEhJCATICShISQgDiAkoSEbIA4gDaIhEyAkIA+iIBOhISsgKyAbIA+ioCErICsgJCARoqAhJCAmICqhIA2iIA4gKaKgIBsgEaKgICSgISQgJCAToCEOIA4gE6EhEyAkIBOhISQgECAQoiETIBIgEqIgE6EhJiAmIBQgEqIiG6AhEiASIBugIRIgFCAUoiAsIBAgEKCioCASoCEUIBQgE6AhEiASIBOhIRMgFCAToSIfIRMgEyAkoCEUIBQgJKEhJiATICahIRsgFCAmoSETICQgE6EhKiASISQgJCAOoCETIBMgDqEhJiAkICahISQgEyAmoSEmIA4gJqEhDiAkIA6gIBSgIQ4gDiAToCEUIBQgE6EhEyAbICqgIA6gIBOhISYgJiAUoCEOIA4gFKEhKyAORAAAAAIAAKBBoiETIBMgDqEhFCATIBShIRQgDiAUoSEbIAREAAAAAgAAoEGiIRMgEyAEoSEkIBMgJKEhJCAEICShISogDiAEoiETIBQgJKIgE6EhLCAsIBsgJKKgISQgJCAUICqioCEUICYgK6EgBKIgDiAFoqAgGyAqoqAgFKAhDiAOIBOgIQUgBSAToSETIA4gE6EhDiAJIA6gIRMgEyAOoSEUIAkgFKEhJCATIBShIRQgDiAUoSEmIAggBaAhDiAOIAWhIRQgCCAUoSEbIA4gFKEhFCAFIBShIQUgGyAFoCAToCETIBMgDqAhBSAFIA6hIQ4gJCAmoCAToCAOoSEmICYgBaAhDiAORAAAAAIAAKBBoiETIBMgDqEhFCATIBShIRMgDiAToSEUIA4gDqIhJCATIBOiICShIRsgGyAUIBOiIiqgIRMgEyAqoCETIA4gBaEhBSAUIBSiIA4gJiAFoSIFIAWgoqAgE6AhKiAqICSgISYgKSETIBMgHKAhFCAUIBOhIRsgHCAboSErIBQgG6EhHCATIByhISwgDSEcIBwgI6AhEyATIByhIRsgIyAboSEjIBMgG6EhGyAcIBuhIRwgIyAcoCAUoCEcIBwgE6AhFCAUIBOhIRMgKyAsoCAcoCAToSEjICMgFKAhEyATIBShISsgE0QAAAACAACgQaIhFCAUIBOhIRwgFCAcoSEcIBMgHKEhGyATIA2iIRQgHCAPoiAUoSEsICwgGyAPoqAhDyAPIBwgEaKgIQ8gIyAroSANoiATICmioCAbIBGioCAPoCERIBEgFKAhDyAPIBShIRMgESAToSETIBJEAAAAAgAAoEGiIREgESASoSEUIBEgFKEhFCASIBShIRwgEkQAAAAAAAAUQKIhESAUICiiIBGhIRIgEiAcICiioCESIBIgFCAloqAhEiAcICWiIB9EAAAAAAAAFECioCASoCEUIBQgEaAhEiASIBGhIREgFCARoSERIBEgE6AhFCAUIBOhISUgESAloSEcIBQgJaEhESATIBGhISUgEiAPoCERIBEgD6EhEyASIBOhIRIgESAToSETIA8gE6EhDyASIA+gIBSgIQ8gDyARoCESIBIgEaEhESAcICWgIA+gIBGhIRQgFCASoCEPIA8gEqEhIyAPRAAAAAIAAKBBoiERIBEgD6EhEiARIBKhIRIgDyASoSElIAJEAAAAAgAAoEGiIREgESACoSETIBEgE6EhEyACIBOhIRwgDyACoiERIBIgE6IgEaEhKSApICUgE6KgIRMgEyASIByioCESIBQgI6EgAqIgDyADoqAgJSAcoqAgEqAhDyAPIBGgIQMgAyARoSERIA8gEaEhDyAHIA+gIREgESAPoSESIAcgEqEhEyARIBKhIRIgDyASoSEUIAYgA6AhDyAPIAOhIRIgBiASoSElIA8gEqEhEiADIBKhIQMgJSADoCARoCERIBEgD6AhAyADIA+hIQ8gEyAUoCARoCAPoSEUIBQgA6AhDyAPRAAAAAIAAKBBoiERIBEgD6EhEiARIBKhIRIgDyASoSETIA8gD6IhESASIBKiIBGhISUgJSATIBKiIhygIRIgEiAcoCESIA8gA6EhAyATIBOiIA8gFCADoSIDIAOgoqAgEqAhEyATIBGgIRIgBEQAAAAAAAA0QKIgAqIgDSAQoaIiBCAeoiAQIBAgDUQAAAAAAAAYwKKgoiANIA2ioEQAAAAAAAAUQKIiAiAXIg2ioCEXIAIgHqJEAAAAAAAA8D+gIAQgDaKhIR4CQCAmIBKgIgREAAAAAICELkFlDQAgCiAPIB6iIA4gF6KgIB4gHqIgFyAXoqAiA6MiAiAOIB6iIA8gF6KhIAOjIgOgRAAAAGCeoOY/oiACIAKiIAMgA6Kgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCACABsiAEtrwiAbNDAAAANJRDd3P4wpIgAUH///8DcUGAgID4A3K+IidDdb+/v5SSQ6Pp3L8gJ0P5RLQ+kpWSQwAAAD+UvCIBs0MAAAA0lEN3c/jCkiABQf///wNxQYCAgPgDcr4iJ0N1v7+/lJJDo+ncvyAnQ/lEtD6SlZJDo4HcvpSSIScMDwsgDyECIA4hBAJAIAtEAAAAAAAAAABlDQACQCABIBlHDQAgAyENIDGaIQ8gDyANoCEOIA4gDaEhECAOIBChIRQgDSAUoSElIA8gEKEhHCACIQ8gMJohECAQIA+gIQ0gDSAPoSEUIA0gFKEhIyAPICOhIQ8gECAUoSEQIBAgD6AgDqAhDyAPIA2gIQ4gDiANoSENIBwgJaAgD6AgDaEhDSANIA6gIQ8gBSENIC+aIRAgECANoCEOIA4gDaEhFCAOIBShISUgDSAloSEcIBAgFKEhIyAEIRAgLpohFCAUIBCgIQ0gDSAQoSElIA0gJaEhKSAQICmhIRAgFCAloSEUIBQgEKAgDqAhECAQIA2gIQ4gDiANoSENICMgHKAgEKAgDaEhDSANIA6gIQ1BACEZIA2aIA0gDUQAAAAAAAAAAGMbIA+aIA8gD0QAAAAAAAAAAGMboCAtZA0AIAogGLI4AgBDAMB5xCEnDBALIAMhDSAgmiEPIA8gDaAhDiAOIA2hIRAgDiAQoSEUIA0gFKEhJSAPIBChIRwgAiEPICGaIRAgECAPoCENIA0gD6EhFCANIBShISMgDyAjoSEPIBAgFKEhECAQIA+gIA6gIQ8gDyANoCEOIA4gDaEhDSAcICWgIA+gIA2hIQ0gDSAOoCEPIAUhDSAymiEQIBAgDaAhDiAOIA2hIRQgDiAUoSElIA0gJaEhHCAQIBShISMgBCEQICKaIRQgFCAQoCENIA0gEKEhJSANICWhISkgECApoSEQIBQgJaEhFCAUIBCgIA6gIRAgECANoCEOIA4gDaEhDSAjIBygIBCgIA2hIQ0gDSAOoCENAkAgDZogDSANRAAAAAAAAAAAYxsgD5ogDyAPRAAAAAAAAAAAYxugIg0gC2YNACAZDQAgACAVayEZIAEgFWshGCADITEgAiEwIAUhLyAEIS4gDSEtCyABIBpHDQAgBSEyIAQhIiACISEgAyEgIAAhGiABIRULICYgJKEhDSAqIA2hISwgEiARoSENIBMgDaEhKSAAQQJqIQAgFiABQQFqIgFqQQFHDQALC0MAwHnEIScgC0QAAAAAAAAAAGUNDCAKQQA2AgAMDAsCQCABQQFIDQAgBEQAAAACAACgQaIhDSANIAShIQ4gDSAOoSEOIAQgDqEhDyAEIASiIQ0gDiAOoiANoSEQIBAgDyAOoiIRoCEOIA4gEaAhDiAPIA+iIAQgBSAFoKKgIA6gIRAgECANoCEbIBsgDaEhESACRAAAAAIAAKBBoiENIA0gAqEhDiANIA6hIQ0gAiANoSEPIAIgAqIhDiANIA2iIA6hIRIgEiAPIA2iIhOgIQ0gDSAToCENIA8gD6IgAiADIAOgoqAgDaAhDyAPIA6gIQ0gDSAOoSEOQQAhFUEAIAFrIRYgDyAOoSEeIBAgEaEhF0QAAAADAADIQSEOIA5EAAAAAAAAGMCgIQ8gDiAPoSEiRAAAgAIAAORBIQ4gDkQAAAAAAAA0wKAhDyAOIA+hITJEAADAAwAA3kEhDiAORAAAAAAAAC7AoCEPIA4gD6EhK0ECIQBBASEBRAAAAAAAAAAAITNBACEYQQAhGUEBIRpEAAAAAAAA8D8hLkQAAAAAAAAAACEtIAMhMSACITQgBCE1IAUhNiACITcgAyE4IAQhOSAFIToDQCANRAAAAAIAAKBBoiEOIA4gDaEhDyAOIA+hIQ8gDSAPoSESIA0gDaIhDiAPIA+iIA6hIRAgECASIA+iIhGgIRAgECARoCEQIBIgEqIgHiANIA2goqAgEKAhECAQIA6gIRQgFCAOoSEOIBAgDqEiLyEkIBsiEEQAAAACAACgQaIhDiAOIBChIREgDiARoSERIBAgEaEhEyAQIBCiIQ4gESARoiAOoSElICUgEyARoiIcoCElICUgHKAhJSATIBOiIBcgECAQoKKgICWgIRwgHCAOoCElICUgDqEhDiAcIA6hIjAhKCAoICSgISMgIyAkoSEOICMgDqEhHCAkIByhIRsgKCAOoSEqIBQhHCAlISkgKSAcoCEOIA4gHKEhJiAOICahISwgHCAsoSEsICkgJqEhJiAmICygICOgISYgJiAOoCEjICMgDqEhDiAqIBugICagIA6hIRsgGyAjoCEOIA4gI6EhHSAORAAAAAIAAKBBoiEjICMgDqEhJiAjICahISYgDiAmoSEqRAAAAAAAABhAICKhISwgDkQAAAAAAAAYQKIhIyAmICKiICOhIQ4gDiAqICKioCEOIA4gJiAsoqAhDiAqICyiIBsgHaFEAAAAAAAAGECioCAOoCEmICYgI6AhDiAOICOhISMgJiAjoSEbIA1EAAAAAAAANECiISYgMiAPoiAmoSEjICMgMiASoqAhKkQAAAAAAAA0QCAyoSEjICogIyAPoqAhKiAjIBKiIB5EAAAAAAAANECioCAqoCEsICwgJqAhIyAjICahIR8gI0QAAAACAACgQaIhJiAmICOhISogJiAqoSEqICMgKqEhHSAjIBCiISYgKiARoiAmoSEgICAgKiAToqAhKiAqIB0gEaKgISogLCAfoSAQoiAjIBeioCAdIBOioCAqoCEjICMgJqAhKiAqICahISYgJiAjoSEjICMgG6AhJiAmIBuhISwgIyAsoSEdICYgLKEhIyAbICOhISwgKpohGyAbIA6gISMgIyAOoSEqIBsgKqEhGyAjICqhISogDiAqoSEOIBsgDqAgJqAhDiAOICOgISYgJiAjoSEjIB0gLKAgDqAgI6EhKiAqICagIQ4gDiAmoSEfIAJEAAAAAgAAoEGiISMgIyACoSEmICMgJqEhJiAERAAAAAIAAKBBoiEjICMgBKEhGyAjIBuhIRsgBCAboSEsIAIgBKIhIyAbICaiICOhIR0gHSAsICaioCEdIAIgJqEhJiAdIBsgJqKgIRsgAiAFoiADIASioCAsICaioCAboCEbIBsgI6AhAyADICOhISAgDkQAAAACAACgQaIhBSAFIA6hISMgBSAjoSEjIA4gI6EhLCADRAAAAAIAAKBBoiEFIAUgA6EhJiAFICahISYgAyAmoSEdIA4gA6IhBSAjICaiIAWhISEgISAsICaioCEmICYgIyAdoqAhIyAqIB+hIAOiIA4gGyAgoaKgICwgHaKgICOgIQ4gDiAFoCEDIAMgBaEhBSAOIAWhIQUgCSAFoCEOIA4gBaEhIyAJICOhISYgDiAjoSEjIAUgI6EhGyAIIAOgIQUgBSADoSEjIAggI6EhKiAFICOhISMgAyAjoSEDICogA6AgDqAhDiAOIAWgIQMgAyAFoSEFICYgG6AgDqAgBaEhGyAbIAOgIQ4gDkQAAAACAACgQaIhBSAFIA6hISMgBSAjoSEFIA4gBaEhJiAOIA6iISMgBSAFoiAjoSEqICogJiAFoiIsoCEFIAUgLKAhKiAOIAOhIQMgJiAmoiAOIBsgA6EiBSAFoKKgICqgIR0gHSAjoCEbICVEAAAAAgAAoEGiIQMgAyAloSEmIAMgJqEhKiAlICqhISxEAAAAAAAALkAgK6EhJiAlRAAAAAAAAC5AoiEDICogK6IgA6EhJSAlICwgK6KgISUgJSAqICaioCElICwgJqIgMEQAAAAAAAAuQKKgICWgISogKiADoCElICUgA6EhAyAqIAOhIQMgAyAkoCEqICogJKEhLCADICyhIR8gKiAsoSEDICQgA6EhLCAlIBygIQMgAyAcoSEkICUgJKEhJSADICShISQgHCAkoSEkICUgJKAgKqAhJSAlIAOgISQgJCADoSEDIB8gLKAgJaAgA6EhHCAcICSgIQMgAyAkoSEsIANEAAAAAgAAoEGiISQgJCADoSElICQgJaEhJSADICWhISogAyANoiEkICUgD6IgJKEhHyAfICogD6KgIQ8gDyAlIBKioCEPIBwgLKEgDaIgAyAeoqAgKiASoqAgD6AhDSANICSgIQMgAyAkoSEPIA0gD6EhJCAURAAAAAIAAKBBoiENIA0gFKEhDyANIA+hIQ0gFCANoSESIBREAAAAAAAALkCiIQ8gDSAroiAPoSEUIBQgEiAroqAhFCAUIA0gJqKgIQ0gEiAmoiAvRAAAAAAAAC5AoqAgDaAhEiASIA+gIQ0gDSAPoSEPIBIgD6EhDyAPICigIRIgEiAPoSEUICggFKEhJSASIBShIRQgDyAUoSEcIA0gKaAhDyAPIA2hIRQgKSAUoSEmIA8gFKEhFCANIBShIQ0gJiANoCASoCENIA0gD6AhEiASIA+hIQ8gJSAcoCANoCAPoSEUIBQgEqAhDSANIBKhIRwgDUQAAAACAACgQaIhDyAPIA2hIRIgDyASoSESIA0gEqEhJSANIBCiIQ8gEiARoiAPoSEmICYgJSARoqAhESARIBIgE6KgIREgECAUIByhoiANIBeioCAlIBOioCARoCENIA0gD6AhECAQIA+hIQ8gDyANoSENIA0gJKAhDyAPICShIREgDyARoSESICQgEqEhEiANIBGhIRMgEJohECAQIAOgIQ0gDSADoSERIA0gEaEhFCADIBShIQMgECARoSEQIBAgA6AgD6AhAyADIA2gIQ8gDyANoSENIBMgEqAgA6AgDaEhDSANIA+gIQMgAyAPoSEPIA0gD6EhDSAHIA2gIQ8gDyANoSEQIAcgEKEhESAPIBChIRAgDSAQoSESIAYgA6AhDSANIAOhIRAgBiAQoSETIA0gEKEhECADIBChIQMgEyADoCAPoCEPIA8gDaAhAyADIA2hIQ0gESASoCAPoCANoSESIBIgA6AhDyAPRAAAAAIAAKBBoiENIA0gD6EhECANIBChIQ0gDyANoSERIA8gD6IhECANIA2iIBChIRMgEyARIA2iIhSgIQ0gDSAUoCENIA8gA6EhAyARIBGiIA8gEiADoSIDIAOgoqAgDaAhESARIBCgIQ0gLiISIAKiIC0gBKKhIhMgE6BEAAAAAAAA8D+gIS4gLSACoiASIASioCIEIASgIS0CQCAbIA2gIgREAAAAAICELkFlDQAgCiAPIC6iIA4gLaKgIC4gLqIgLSAtoqAiA6MiAiAOIC6iIA8gLaKhIAOjIgOgRAAAAGCeoOY/oiACIAKiIAMgA6Kgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCACABsiAEtrwiAbNDAAAANJRDd3P4wpIgAUH///8DcUGAgID4A3K+IidDdb+/v5SSQ6Pp3L8gJ0P5RLQ+kpWSQwAAAD+UvCIBs0MAAAA0lEN3c/jCkiABQf///wNxQYCAgPgDcr4iJ0N1v7+/lJJDo+ncvyAnQ/lEtD6SlZJDkhHGvpSSIScMDgsgDiEEIA8hAgJAIAtEAAAAAAAAAABlDQACQCABIBlHDQAgAyEOIDiaIRIgEiAOoCEPIA8gDqEhEyAPIBOhIRQgDiAUoSEkIBIgE6EhJSACIRIgN5ohEyATIBKgIQ4gDiASoSEUIA4gFKEhHCASIByhIRIgEyAUoSETIBMgEqAgD6AhEiASIA6gIQ8gDyAOoSEOICUgJKAgEqAgDqEhDiAOIA+gIRIgBSEOIDaaIRMgEyAOoCEPIA8gDqEhFCAPIBShISQgDiAkoSElIBMgFKEhHCAEIRMgNZohFCAUIBOgIQ4gDiAToSEkIA4gJKEhJiATICahIRMgFCAkoSEUIBQgE6AgD6AhEyATIA6gIQ8gDyAOoSEOIBwgJaAgE6AgDqEhDiAOIA+gIQ5BACEZIA6aIA4gDkQAAAAAAAAAAGMbIBKaIBIgEkQAAAAAAAAAAGMboCAzZA0AIAogGLI4AgBDAMB5xCEnDA8LIAMhDiAxmiESIBIgDqAhDyAPIA6hIRMgDyAToSEUIA4gFKEhJCASIBOhISUgAiESIDSaIRMgEyASoCEOIA4gEqEhFCAOIBShIRwgEiAcoSESIBMgFKEhEyATIBKgIA+gIRIgEiAOoCEPIA8gDqEhDiAlICSgIBKgIA6hIQ4gDiAPoCESIAUhDiA6miETIBMgDqAhDyAPIA6hIRQgDyAUoSEkIA4gJKEhJSATIBShIRwgBCETIDmaIRQgFCAToCEOIA4gE6EhJCAOICShISYgEyAmoSETIBQgJKEhFCAUIBOgIA+gIRMgEyAOoCEPIA8gDqEhDiAcICWgIBOgIA6hIQ4gDiAPoCEOAkAgDpogDiAORAAAAAAAAAAAYxsgEpogEiASRAAAAAAAAAAAYxugIg4gC2YNACAZDQAgACAVayEZIAEgFWshGCADITggAiE3IAUhNiAEITUgDiEzCyABIBpHDQAgBSE6IAQhOSACITQgAyExIAAhGiABIRULIBsgI6EhDiAdIA6hIRcgDSAQoSEOIBEgDqEhHiAAQQJqIQAgFiABQQFqIgFqQQFHDQALC0MAwHnEIScgC0QAAAAAAAAAAGUNCyAKQQA2AgAMCwsCQCABQQFIDQAgBEQAAAACAACgQaIhDSANIAShIQ4gDSAOoSEOIAQgDqEhDyAEIASiIQ0gDiAOoiANoSEQIBAgDyAOoiIRoCEOIA4gEaAhDiAPIA+iIAQgBSAFoKKgIA6gIRAgECANoCEpICkgDaEhESACRAAAAAIAAKBBoiENIA0gAqEhDiANIA6hIQ0gAiANoSEPIAIgAqIhDiANIA2iIA6hIRIgEiAPIA2iIhOgIQ0gDSAToCENIA8gD6IgAiADIAOgoqAgDaAhDyAPIA6gIQ0gDSAOoSEOQQAhFUEAIAFrIRYgDyAOoSElIBAgEaEhHkQAAIADAADMQSEOIA5EAAAAAAAAHMCgIQ8gDiAPoSEfRAAAMAIAgPFBIQ4gDkQAAAAAAIBBwKAhDyAOIA+hISBEAACgAgAA5UEhDiAORAAAAAAAADXAoCEPIA4gD6EhIUECIQBBASEBRAAAAAAAAAAAITdBACEYQQAhGUEBIRpEAAAAAAAA8D8hNEQAAAAAAAAAACExIAMhOiACITMgBCE4IAUhOyACITwgAyE9IAQhNSAFITYDQCANRAAAAAIAAKBBoiEOIA4gDaEhDyAOIA+hIQ4gDSAOoSEQIA1EAAAAAAAAHECiIQ8gHyAOoiAPoSERIBEgHyAQoqAhEUQAAAAAAAAcQCAfoSEbIBEgGyAOoqAhESAbIBCiICVEAAAAAAAAHECioCARoCERIBEgD6AhEiASIA+hIQ8gESAPoSEkICkiE0QAAAACAACgQaIhDyAPIBOhIREgDyARoSEPIBMgD6EhESATRAAAAAAAgEFAoiEUICAgD6IgFKEhHCAcICAgEaKgIRxEAAAAAACAQUAgIKEhKiAcICogD6KgIRwgKiARoiAeRAAAAAAAgEFAoqAgHKAhHCAcIBSgISMgIyAUoSEUIBQgHKEhFCAUICSgIRwgHCAkoSEmIBwgJqEhKCAkICihISggFCAmoSEmICOaISQgJCASoCEUIBQgEqEhIyAUICOhISkgEiApoSESICQgI6EhJCAkIBKgIBygIRIgEiAUoCEkICQgFKEhFCAmICigIBKgIBShISYgJiAkoCESIBIgJKEhLCANIA2iISQgDiAOoiAkoSEUIBQgECAOoiIcoCEUIBQgHKAhFCAQIBCiICUgDSANoKKgIBSgISggKCAkoCEUIBQgJKEhHSASRAAAAAIAAKBBoiEkICQgEqEhHCAkIByhIRwgEiAcoSEpIBREAAAAAgAAoEGiISQgJCAUoSEjICQgI6EhIyAUICOhISsgEiAUoiEkIBwgI6IgJKEhFyAXICkgI6KgIRcgFyAcICuioCEcICYgLKEgFKIgEiAoIB2hIjmioCApICuioCAcoCEcIBwgJKAhEiASICShISQgHCAkoSEXIA1EAAAAAAAANUCiIRwgISAOoiAcoSEkICQgISAQoqAhJEQAAAAAAAA1QCAhoSEsICQgLCAOoqAhJCAsIBCiICVEAAAAAAAANUCioCAkoCEmICYgHKAhJCAkIByhIRwgJiAcoSEcIB6aISggKCAcoCEmICYgHKEhKSAoICmhIR0gJiApoSEoIBwgKKEhIiATmiEoICggJKAhHCAcICShISkgKCApoSEoIBwgKaEhKSAkICmhISQgKCAkoCAmoCEmICYgHKAhJCAkIByhIRwgHSAioCAmoCAcoSEiICIgJKAhHCAcICShIS4gEyAToiEmIA8gD6IgJqEhJCAkIBEgD6IiKKAhJCAkICigISQgESARoiAeIBMgE6CioCAkoCEyIDIgJqAhJCAkICahIS8gHEQAAAACAACgQaIhJiAmIByhISggJiAooSEpIBwgKaEhLSAkRAAAAAIAAKBBoiEmICYgJKEhKCAmICihISYgJCAmoSEdIBwgJKIhKCApICaiICihITAgMCAtICaioCEwIDAgKSAdoqAhKSAiIC6hICSiIBwgMiAvoSIvoqAgLSAdoqAgKaAhHCAcICigISkgKSAooSEoIBwgKKEhHCAcIBegISggKCAXoSEiIBwgIqEhMiAoICKhIRwgFyAcoSEiICkgEqAhHCAcIBKhIRcgKSAXoSEpIBwgF6EhFyASIBehIRIgKSASoCAooCESIBIgHKAhKCAoIByhIRwgMiAioCASoCAcoSEXIBcgKKAhEiASICihIS0gEkQAAAACAACgQaIhHCAcIBKhISggHCAooSEoIBIgKKEhIiAERAAAAAIAAKBBoiEcIBwgBKEhKSAcICmhISkgBCApoSEyIBIgBKIhHCAoICmiIByhIS4gLiAiICmioCEpICkgKCAyoqAhKCAXIC2hIASiIBIgBaKgICIgMqKgICigIRIgEiAcoCEFIAUgHKEhHCASIByhIRIgCSASoCEcIBwgEqEhKCAJICihISkgHCAooSEoIBIgKKEhFyAIIAWgIRIgEiAFoSEoIAggKKEhIiASICihISggBSAooSEFICIgBaAgHKAhHCAcIBKgIQUgBSASoSESICkgF6AgHKAgEqEhFyAXIAWgIRIgEkQAAAACAACgQaIhHCAcIBKhISggHCAooSEcIBIgHKEhKSASIBKiISggHCAcoiAooSEiICIgKSAcoiIyoCEcIBwgMqAhHCASIAWhIQUgKSApoiASIBcgBaEiBSAFoKKgIBygISIgIiAooCEpIA1EAAAAAACAQUCiIRwgICAOoiAcoSEXIBcgICAQoqAhFyAXICogDqKgIQ4gKiAQoiAlRAAAAAAAgEFAoqAgDqAhECAQIBygIQ4gDiAcoSEcIBAgHKEhHCATRAAAAAAAABxAoiEQIB8gD6IgEKEhKiAqIB8gEaKgISogKiAbIA+ioCEqIBsgEaIgHkQAAAAAAAAcQKKgICqgIRsgGyAQoCEqICogEKEhECAQIBuhIRAgECAcoCEbIBsgHKEhFyAbIBehITIgHCAyoSEyIBAgF6EhFyAqmiEcIBwgDqAhECAQIA6hISogECAqoSEtIA4gLaEhDiAcICqhIRwgHCAOoCAboCEOIA4gEKAhHCAcIBChIRAgFyAyoCAOoCAQoSEbIBsgHKAhDiAOIByhIRcgDkQAAAACAACgQaIhECAQIA6hIRwgECAcoSEcIA4gHKEhKiAOICSiIRAgHCAmoiAQoSEyIDIgKiAmoqAhJiAmIBwgHaKgIRwgGyAXoSAkoiAOIC+ioCAqIB2ioCAcoCEOIA4gEKAhJCAkIBChIRAgDiAQoSEQIBNEAAAAAAAANUCiIQ4gISAPoiAOoSETIBMgISARoqAhEyATICwgD6KgIQ8gLCARoiAeRAAAAAAAADVAoqAgD6AhDyAPIA6gIREgESAOoSEOIA4gD6EhDiAOICWgIQ8gDyAloSETIA4gE6EhHCAPIBOhIQ4gJSAOoSElIBGaIREgESANoCEOIA4gDaEhEyARIBOhIREgDiAToSETIA0gE6EhDSARIA2gIA+gIQ0gDSAOoCEPIA8gDqEhDiAcICWgIA2gIA6hIREgESAPoCENIA0gD6EhJSANRAAAAAIAAKBBoiEOIA4gDaEhDyAOIA+hIQ8gDSAPoSETIA0gFKIhDiAPICOiIA6hIRwgHCATICOioCEcIBwgDyAroqAhDyARICWhIBSiIA0gOaKgIBMgK6KgIA+gIQ8gDyAOoCENIA0gDqEhDiAPIA6hIQ4gECAOoCEPIA8gDqEhESAQIBGhIRMgDyARoSEQIA4gEKEhESAkIA2gIQ4gDiANoSEQICQgEKEhFCAOIBChIRAgDSAQoSENIBQgDaAgD6AhDSANIA6gIQ8gDyAOoSEOIBMgEaAgDaAgDqEhESARIA+gIQ0gDSAPoSEkIA1EAAAAAgAAoEGiIQ4gDiANoSEPIA4gD6EhDyANIA+hIRMgAkQAAAACAACgQaIhDiAOIAKhIRAgDiAQoSEQIAIgEKEhFCANIAKiIQ4gDyAQoiAOoSElICUgEyAQoqAhECAQIA8gFKKgIQ8gESAkoSACoiANIAOioCATIBSioCAPoCENIA0gDqAhAyADIA6hIQ4gDSAOoSENIAcgDaAhDiAOIA2hIQ8gByAPoSEQIA4gD6EhDyANIA+hIREgBiADoCENIA0gA6EhDyAGIA+hIRMgDSAPoSEPIAMgD6EhAyATIAOgIA6gIQ4gDiANoCEDIAMgDaEhDSAQIBGgIA6gIA2hIREgESADoCEOIA5EAAAAAgAAoEGiIQ0gDSAOoSEPIA0gD6EhDSAOIA2hIRAgDiAOoiEPIA0gDaIgD6EhEyATIBAgDaIiFKAhDSANIBSgIQ0gDiADoSEDIBAgEKIgDiARIAOhIgMgA6CioCANoCEQIBAgD6AhDSA0IhEgAqIgMSAEoqEiEyAToEQAAAAAAADwP6AhNCAxIAKiIBEgBKKgIgQgBKAhMQJAICkgDaAiBEQAAAAAgIQuQWUNACAKIBIgMaIgDiA0oqAgNCA0oiAxIDGioCIDoyICIBIgNKIgDiAxoqEgA6MiA6BEAAAAYJ6g5j+iIAIgAqIgAyADoqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIAIAGyIAS2vCIBs0MAAAA0lEN3c/jCkiABQf///wNxQYCAgPgDcr4iJ0N1v7+/lJJDo+ncvyAnQ/lEtD6SlZJDAAAAP5S8IgGzQwAAADSUQ3dz+MKSIAFB////A3FBgICA+ANyviInQ3W/v7+UkkOj6dy/ICdD+US0PpKVkkPKYLa+lJIhJwwNCyASIQQgDiECAkAgC0QAAAAAAAAAAGUNAAJAIAEgGUcNACADIQ4gPZohEiASIA6gIREgESAOoSETIBEgE6EhFCAOIBShISQgEiAToSElIAIhEiA8miETIBMgEqAhDiAOIBKhIRQgDiAUoSEcIBIgHKEhEiATIBShIRMgEyASoCARoCESIBIgDqAhESARIA6hIQ4gJSAkoCASoCAOoSEOIA4gEaAhEiAFIQ4gO5ohEyATIA6gIREgESAOoSEUIBEgFKEhJCAOICShISUgEyAUoSEcIAQhEyA4miEUIBQgE6AhDiAOIBOhISQgDiAkoSEjIBMgI6EhEyAUICShIRQgFCAToCARoCETIBMgDqAhESARIA6hIQ4gHCAloCAToCAOoSEOIA4gEaAhDkEAIRkgDpogDiAORAAAAAAAAAAAYxsgEpogEiASRAAAAAAAAAAAYxugIDdkDQAgCiAYsjgCAEMAwHnEIScMDgsgAyEOIDqaIRIgEiAOoCERIBEgDqEhEyARIBOhIRQgDiAUoSEkIBIgE6EhJSACIRIgM5ohEyATIBKgIQ4gDiASoSEUIA4gFKEhHCASIByhIRIgEyAUoSETIBMgEqAgEaAhEiASIA6gIREgESAOoSEOICUgJKAgEqAgDqEhDiAOIBGgIRIgBSEOIDaaIRMgEyAOoCERIBEgDqEhFCARIBShISQgDiAkoSElIBMgFKEhHCAEIRMgNZohFCAUIBOgIQ4gDiAToSEkIA4gJKEhIyATICOhIRMgFCAkoSEUIBQgE6AgEaAhEyATIA6gIREgESAOoSEOIBwgJaAgE6AgDqEhDiAOIBGgIQ4CQCAOmiAOIA5EAAAAAAAAAABjGyASmiASIBJEAAAAAAAAAABjG6AiDiALZg0AIBkNACAAIBVrIRkgASAVayEYIAMhPSACITwgBSE7IAQhOCAOITcLIAEgGkcNACAFITYgBCE1IAIhMyADITogACEaIAEhFQsgKSAooSEOICIgDqEhHiANIA+hIQ4gECAOoSElIABBAmohACAWIAFBAWoiAWpBAUcNAAsLQwDAecQhJyALRAAAAAAAAAAAZQ0KIApBADYCAAwKCyAMIAQ5AxAgDCADOQMIIAwgAjkDACAMIAU5AxgCQCABQQFIDQAgBEQAAAACAACgQaIhDSANIAShIQ4gDSAOoSEOIAQgDqEhDyAEIASiIQ0gDiAOoiANoSEQIBAgDyAOoiIRoCEOIA4gEaAhDiAPIA+iIAQgBSAFoKKgIA6gIREgESANoCEQIBAgDaEhEiACRAAAAAIAAKBBoiENIA0gAqEhDiANIA6hIQ4gAiAOoSEPIAIgAqIhDSAOIA6iIA2hIRMgEyAPIA6iIhSgIQ4gDiAUoCEOIA8gD6IgAiADIAOgoqAgDqAhDiAOIA2gIQ8gDyANoSENQQAhFUEAIAFrIRYgDiANoSENIBEgEqEhEkECIQBBASEBRAAAAAAAAAAAIRdBACEYQQAhGUEBIRpEAAAAAAAA8D8hG0QAAAAAAAAAACEcIAIhHSAEIR4gAyEfIAIhICAFISEgBCEiA0AgAiEUIAQhIyAMIAxBEGogDyANIBAgEiAGIAcgCCAJEK6AgIAAIAwrAxAiBEQAAAACAACgQaIhAiACIAShIQ0gAiANoSECIAQgAqEhDiAEIASiIQ0gAiACoiANoSEPIA8gDiACoiIQoCECIAIgEKAhAiAOIA6iIAQgDCsDGCIkICSgoqAgAqAhEiASIA2gIRAgDCsDACICRAAAAAIAAKBBoiEOIA4gAqEhDyAOIA+hIQ8gAiAPoSERIAIgAqIhDiAPIA+iIA6hIRMgEyARIA+iIiWgIQ8gDyAloCEPIBEgEaIgAiAMKwMIIiUgJaCioCAPoCERIBEgDqAhDyAUIBsiE6IgHCAjoqEiJiAmoEQAAAAAAADwP6AhGyAcIBSiIBMgI6KgIhMgE6AhHAJAIBAgD6AiE0QAAAAAgIQuQWUNACAKIAQgHKIgAiAboqAgGyAboiAcIByioCIFoyIDIAQgG6IgAiAcoqEgBaMiBKBEAAAAYJ6g5j+iIAMgA6IgBCAEoqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIAIAGyQ3dz+EKSIBO2vCIBs0MAAAA0lEN3c/jCkiABQf///wNxQYCAgPgDcr4iJ0N1v7+/lJJDo+ncvyAnQ/lEtD6SlZJDAAAAP5S8IgGzQwAAALSUkiABQf///wNxQYCAgPgDcr4iJ0N1v78/lJJDo+ncPyAnQ/lEtD6SlZIhJwwMCwJAIAtEAAAAAAAAAABlDQACQCABIBlHDQAgJSETIB+aISMgIyAToCEUIBQgE6EhJiAUICahISggEyAooSEpICMgJqEhKiACISMgIJohJiAmICOgIRMgEyAjoSEoIBMgKKEhKyAjICuhISMgJiAooSEmICYgI6AgFKAhIyAjIBOgIRQgFCAToSETICogKaAgI6AgE6EhEyATIBSgISMgJCETICGaISYgJiAToCEUIBQgE6EhKCAUICihISkgEyApoSEqICYgKKEhKyAEISYgIpohKCAoICagIRMgEyAmoSEpIBMgKaEhLCAmICyhISYgKCApoSEoICggJqAgFKAhJiAmIBOgIRQgFCAToSETICsgKqAgJqAgE6EhEyATIBSgIRNBACEZIBOaIBMgE0QAAAAAAAAAAGMbICOaICMgI0QAAAAAAAAAAGMboCAXZA0AIAogGLI4AgBDAMB5xCEnDA0LICUhEyADmiEjICMgE6AhFCAUIBOhISYgFCAmoSEoIBMgKKEhKSAjICahISogAiEjIB2aISYgJiAjoCETIBMgI6EhKCATICihISsgIyAroSEjICYgKKEhJiAmICOgIBSgISMgIyAToCEUIBQgE6EhEyAqICmgICOgIBOhIRMgEyAUoCEjICQhEyAFmiEmICYgE6AhFCAUIBOhISggFCAooSEpIBMgKaEhKiAmICihISsgBCEmIB6aISggKCAmoCETIBMgJqEhKSATICmhISwgJiAsoSEmICggKaEhKCAoICagIBSgISYgJiAToCEUIBQgE6EhEyArICqgICagIBOhIRMgEyAUoCETAkAgE5ogEyATRAAAAAAAAAAAYxsgI5ogIyAjRAAAAAAAAAAAYxugIhMgC2YNACAZDQAgACAVayEZIAEgFWshGCAEISIgJCEhIAIhICAlIR8gEyEXCyABIBpHDQAgBCEeICQhBSACIR0gJSEDIAAhGiABIRULIBAgDaEhDSASIA2hIRIgDyAOoSENIBEgDaEhDSAAQQJqIQAgFiABQQFqIgFqQQFHDQALC0MAwHnEIScgC0QAAAAAAAAAAGUNCSAKQQA2AgAMCQsgDCAEOQMQIAwgAzkDCCAMIAI5AwAgDCAFOQMYAkAgAUEBSA0AIAREAAAAAgAAoEGiIQ0gDSAEoSEOIA0gDqEhDiAEIA6hIQ8gBCAEoiENIA4gDqIgDaEhECAQIA8gDqIiEaAhDiAOIBGgIQ4gDyAPoiAEIAUgBaCioCAOoCERIBEgDaAhECAQIA2hIRIgAkQAAAACAACgQaIhDSANIAKhIQ4gDSAOoSEOIAIgDqEhDyACIAKiIQ0gDiAOoiANoSETIBMgDyAOoiIUoCEOIA4gFKAhDiAPIA+iIAIgAyADoKKgIA6gIQ4gDiANoCEPIA8gDaEhDUEAIRVBACABayEWIA4gDaEhDSARIBKhIRJBAiEAQQEhAUQAAAAAAAAAACEXQQAhGEEAIRlBASEaRAAAAAAAAPA/IRxEAAAAAAAAAAAhGyACIR0gBCEeIAMhHyACISAgBSEhIAQhIgNAIAIhFCAEISMgDCAMQRBqIA8iJiANIBAiKCASIAYgByAIIAkQr4CAgAAgDCsDECIERAAAAAIAAKBBoiECIAIgBKEhDSACIA2hIQIgBCACoSEOIAQgBKIhDSACIAKiIA2hIQ8gDyAOIAKiIhCgIQIgAiAQoCECIA4gDqIgBCAMKwMYIiQgJKCioCACoCESIBIgDaAhECAMKwMAIgJEAAAAAgAAoEGiIQ4gDiACoSEPIA4gD6EhDyACIA+hIREgAiACoiEOIA8gD6IgDqEhEyATIBEgD6IiJaAhDyAPICWgIQ8gESARoiACIAwrAwgiJSAloKKgIA+gIREgESAOoCEPIBsiEyAmICihIiaiIBwgIyAUIBSgoiIUoqBEAAAAAAAACECiIRsgHCAmoiATIBSioUQAAAAAAAAIQKJEAAAAAAAA8D+gIRwCQCAQIA+gIhNEAAAAAICELkFlDQAgCiAEIBuiIAIgHKKgIBwgHKIgGyAboqAiBaMiAyAEIByiIAIgG6KhIAWjIgSgRAAAAGCeoOY/oiADIAOiIAQgBKKgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCACABsiATtrwiAbNDAAAANJRDd3P4wpIgAUH///8DcUGAgID4A3K+IidDdb+/v5SSQ6Pp3L8gJ0P5RLQ+kpWSQwAAAD+UvCIBs0MAAAA0lEN3c/jCkiABQf///wNxQYCAgPgDcr4iJ0N1v7+/lJJDo+ncvyAnQ/lEtD6SlZJDnYQhv5SSIScMCwsCQCALRAAAAAAAAAAAZQ0AAkAgASAZRw0AICUhEyAfmiEjICMgE6AhFCAUIBOhISYgFCAmoSEoIBMgKKEhKSAjICahISogAiEjICCaISYgJiAjoCETIBMgI6EhKCATICihISsgIyAroSEjICYgKKEhJiAmICOgIBSgISMgIyAToCEUIBQgE6EhEyAqICmgICOgIBOhIRMgEyAUoCEjICQhEyAhmiEmICYgE6AhFCAUIBOhISggFCAooSEpIBMgKaEhKiAmICihISsgBCEmICKaISggKCAmoCETIBMgJqEhKSATICmhISwgJiAsoSEmICggKaEhKCAoICagIBSgISYgJiAToCEUIBQgE6EhEyArICqgICagIBOhIRMgEyAUoCETQQAhGSATmiATIBNEAAAAAAAAAABjGyAjmiAjICNEAAAAAAAAAABjG6AgF2QNACAKIBiyOAIAQwDAecQhJwwMCyAlIRMgA5ohIyAjIBOgIRQgFCAToSEmIBQgJqEhKCATICihISkgIyAmoSEqIAIhIyAdmiEmICYgI6AhEyATICOhISggEyAooSErICMgK6EhIyAmICihISYgJiAjoCAUoCEjICMgE6AhFCAUIBOhIRMgKiApoCAjoCAToSETIBMgFKAhIyAkIRMgBZohJiAmIBOgIRQgFCAToSEoIBQgKKEhKSATICmhISogJiAooSErIAQhJiAemiEoICggJqAhEyATICahISkgEyApoSEsICYgLKEhJiAoICmhISggKCAmoCAUoCEmICYgE6AhFCAUIBOhIRMgKyAqoCAmoCAToSETIBMgFKAhEwJAIBOaIBMgE0QAAAAAAAAAAGMbICOaICMgI0QAAAAAAAAAAGMboCITIAtmDQAgGQ0AIAAgFWshGSABIBVrIRggBCEiICQhISACISAgJSEfIBMhFwsgASAaRw0AIAQhHiAkIQUgAiEdICUhAyAAIRogASEVCyAQIA2hIQ0gEiANoSESIA8gDqEhDSARIA2hIQ0gAEECaiEAIBYgAUEBaiIBakEBRw0ACwtDAMB5xCEnIAtEAAAAAAAAAABlDQggCkEANgIADAgLIAwgBDkDECAMIAM5AwggDCACOQMAIAwgBTkDGAJAIAFBAUgNACAERAAAAAIAAKBBoiENIA0gBKEhDiANIA6hIQ4gBCAOoSEPIAQgBKIhDSAOIA6iIA2hIRAgECAPIA6iIhGgIQ4gDiARoCEOIA8gD6IgBCAFIAWgoqAgDqAhESARIA2gIRAgECANoSESIAJEAAAAAgAAoEGiIQ0gDSACoSEOIA0gDqEhDiACIA6hIQ8gAiACoiENIA4gDqIgDaEhEyATIA8gDqIiFKAhDiAOIBSgIQ4gDyAPoiACIAMgA6CioCAOoCEOIA4gDaAhDyAPIA2hIQ1BACEVQQAgAWshFiAOIA2hIQ0gESASoSESQQIhAEEBIQFEAAAAAAAAAAAhF0EAIRhBACEZQQEhGkQAAAAAAADwPyEcRAAAAAAAAAAAISMgAiEdIAQhHiADIR8gAiEgIAUhISAEISIDQCACIRMgBCEUIAwgDEEQaiAPIiYgDSAQIiggEiAGIAcgCCAJELCAgIAAIAwrAxAiBEQAAAACAACgQaIhAiACIAShIQ0gAiANoSECIAQgAqEhDiAEIASiIQ0gAiACoiANoSEPIA8gDiACoiIQoCECIAIgEKAhAiAOIA6iIAQgDCsDGCIlICWgoqAgAqAhEiASIA2gIRAgDCsDACICRAAAAAIAAKBBoiEOIA4gAqEhDyAOIA+hIQ8gAiAPoSERIAIgAqIhDiAPIA+iIA6hISQgJCARIA+iIimgIQ8gDyApoCEPIBEgEaIgAiAMKwMIIiQgJKCioCAPoCERIBEgDqAhDyAjIBOiIBwgFKKgIikgJiAooUQAAAAAAAAQQKIiJqIgHCAToiAjIBSioSIcIBMgFEQAAAAAAAAgQKKiIhOioCEjRAAAAAAAAPA/ICkgE6KhIBwgJqKgIRwCQCAQIA+gIhNEAAAAAICELkFlDQAgCiAEICOiIAIgHKKgIBwgHKIgIyAjoqAiBaMiAyAEIByiIAIgI6KhIAWjIgSgRAAAAGCeoOY/oiADIAOiIAQgBKKgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCACABsiATtrwiAbNDAAAANJRDd3P4wpIgAUH///8DcUGAgID4A3K+IidDdb+/v5SSQ6Pp3L8gJ0P5RLQ+kpWSQwAAAD+UvCIBs0MAAAA0lEN3c/jCkiABQf///wNxQYCAgPgDcr4iJ0N1v7+/lJJDo+ncvyAnQ/lEtD6SlZJDAAAAP5STIScMCgsCQCALRAAAAAAAAAAAZQ0AAkAgASAZRw0AICQhEyAfmiEmICYgE6AhFCAUIBOhISggFCAooSEpIBMgKaEhGyAmICihISogAiEmICCaISggKCAmoCETIBMgJqEhKSATICmhISsgJiAroSEmICggKaEhKCAoICagIBSgISYgJiAToCEUIBQgE6EhEyAqIBugICagIBOhIRMgEyAUoCEmICUhEyAhmiEoICggE6AhFCAUIBOhISkgFCApoSEbIBMgG6EhKiAoICmhISsgBCEoICKaISkgKSAooCETIBMgKKEhGyATIBuhISwgKCAsoSEoICkgG6EhKSApICigIBSgISggKCAToCEUIBQgE6EhEyArICqgICigIBOhIRMgEyAUoCETQQAhGSATmiATIBNEAAAAAAAAAABjGyAmmiAmICZEAAAAAAAAAABjG6AgF2QNACAKIBiyOAIAQwDAecQhJwwLCyAkIRMgA5ohJiAmIBOgIRQgFCAToSEoIBQgKKEhKSATICmhIRsgJiAooSEqIAIhJiAdmiEoICggJqAhEyATICahISkgEyApoSErICYgK6EhJiAoICmhISggKCAmoCAUoCEmICYgE6AhFCAUIBOhIRMgKiAboCAmoCAToSETIBMgFKAhJiAlIRMgBZohKCAoIBOgIRQgFCAToSEpIBQgKaEhGyATIBuhISogKCApoSErIAQhKCAemiEpICkgKKAhEyATICihIRsgEyAboSEsICggLKEhKCApIBuhISkgKSAooCAUoCEoICggE6AhFCAUIBOhIRMgKyAqoCAooCAToSETIBMgFKAhEwJAIBOaIBMgE0QAAAAAAAAAAGMbICaaICYgJkQAAAAAAAAAAGMboCITIAtmDQAgGQ0AIAAgFWshGSABIBVrIRggBCEiICUhISACISAgJCEfIBMhFwsgASAaRw0AIAQhHiAlIQUgAiEdICQhAyAAIRogASEVCyAQIA2hIQ0gEiANoSESIA8gDqEhDSARIA2hIQ0gAEECaiEAIBYgAUEBaiIBakEBRw0ACwtDAMB5xCEnIAtEAAAAAAAAAABlDQcgCkEANgIADAcLAkAgAUEBSA0AIAREAAAAAgAAoEGiIQ0gDSAEoSEOIA0gDqEhDiAEIA6hIQ8gBCAEoiENIA4gDqIgDaEhECAQIA8gDqIiEaAhDiAOIBGgIQ4gDyAPoiAEIAUgBaCioCAOoCEQIBAgDaAhEiASIA2hIREgAkQAAAACAACgQaIhDSANIAKhIQ4gDSAOoSEOIAIgDqEhDyACIAKiIQ0gDiAOoiANoSETIBMgDyAOoiIUoCEOIA4gFKAhDiAPIA+iIAIgAyADoKKgIA6gIQ4gDiANoCEPIA8gDaEhDUEAIRpBACABayEVIA4gDaEhDiAQIBGhIRxEAAAAAgAAsEEhDSANRAAAAAAAAADAoCEQIA0gEKEhKEQAAAAAAAAAQCAooSEpQQIhAEEBIQFEAAAAAAAAAAAhIEEAIT5BACEWQQEhGEQAAAAAAADwPyEbRAAAAAAAAAAAISMgAyEdIAIhHiAEISEgBSEiIAIhMiADIS0gBCEXIAUhHwNAIBIhJiACRAAAAAIAAKBBoiENIA0gAqEhECANIBChIRAgAiAQoSERIAIgAqAhDSAQICiiIA2hIRIgEiARICiioCESIBIgECApoqAhECARICmiIAMgA6CgIBCgIRIgEiANoCEDIAMgDaEhJCADRAAAAAIAAKBBoiENIA0gA6EhECANIBChIRAgAyAQoSETIAREAAAAAgAAoEGiIQ0gDSAEoSERIA0gEaEhESAEIBGhIRQgAyAEoiENIBEgEKIgDaEhJSAlIBQgEKKgIRAgECARIBOioCEQIBIgJKEgBKIgAyAFoqAgFCAToqAgEKAhBSAFIA2gIQMgAyANoSENIAUgDaEhBSAJIAWgIQ0gDSAFoSEQIAkgEKEhESANIBChIRAgBSAQoSESIAggA6AhBSAFIAOhIRAgCCAQoSETIAUgEKEhECADIBChIQMgEyADoCANoCENIA0gBaAhAyADIAWhIQUgESASoCANoCAFoSESIBIgA6AhDSANRAAAAAIAAKBBoiEFIAUgDaEhECAFIBChIQUgDSAFoSERIA0gDaIhECAFIAWiIBChIRMgEyARIAWiIhSgIQUgBSAUoCETIA0gA6EhAyARIBGiIA0gEiADoSIFIAWgoqAgE6AhJCAkIBCgIRIgHJohAyADIA6gIREgESAOoSETIBEgE6EhFCAOIBShIRQgAyAToSElICaaIQ4gDiAPoCEDIAMgD6EhEyADIBOhIRwgDyAcoSEPIA4gE6EhDiAOIA+gIBGgIQ8gDyADoCEOIA4gA6EhAyAlIBSgIA+gIAOhIQ8gDyAOoCEDIAMgDqEhDiAPIA6hIg6aIA4gA0QAAAAAAAAAAGMiGRshDiAHIA6gIQ8gDyAOoSERIAcgEaEhEyAPIBGhIREgDiARoSEUIAOaIAMgGRshDiAGIA6gIQMgAyAOoSERIAYgEaEhJSADIBGhIREgDiARoSEOICUgDqAgD6AhDiAOIAOgIQ8gDyADoSEDIBMgFKAgDqAgA6EhFCAUIA+gIQ4gDkQAAAACAACgQaIhAyADIA6hIREgAyARoSEDIA4gA6EhEyAOIA6iIREgAyADoiARoSElICUgEyADoiIcoCEDIAMgHKAhJSAOIA+hIQMgEyAToiAOIBQgA6EiAyADoKKgICWgIRMgEyARoCEPIBsiFCACoiAjIASioSIlICWgRAAAAAAAAPA/oCEbICMgAqIgFCAEoqAiBCAEoCEjAkAgEiAPoCIERAAAAACAhC5BZQ0AIAogDiAboiANICOioCAbIBuiICMgI6KgIgOjIgIgDSAboiAOICOioSADoyIDoEQAAABgnqDmP6IgAiACoiADIAOioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgAgAbJDd3P4QpIgBLa8IgGzQwAAADSUQ3dz+MKSIAFB////A3FBgICA+ANyviInQ3W/v7+UkkOj6dy/ICdD+US0PpKVkkMAAAA/lLwiAbNDAAAAtJSSIAFB////A3FBgICA+ANyviInQ3W/vz+UkkOj6dw/ICdD+US0PpKVkiEnDAkLIA4hAiANIQQCQCALRAAAAAAAAAAAZQ0AAkAgASAWRw0AIAMhDSAtmiEUIBQgDaAhDiAOIA2hISUgDiAloSEcIA0gHKEhJiAUICWhISogAiEUIDKaISUgJSAUoCENIA0gFKEhHCANIByhISsgFCAroSEUICUgHKEhJSAlIBSgIA6gIRQgFCANoCEOIA4gDaEhDSAqICagIBSgIA2hIQ0gDSAOoCEUIAUhDSAimiElICUgDaAhDiAOIA2hIRwgDiAcoSEmIA0gJqEhKiAlIByhISsgBCElICGaIRwgHCAloCENIA0gJaEhJiANICahISwgJSAsoSElIBwgJqEhHCAcICWgIA6gISUgJSANoCEOIA4gDaEhDSArICqgICWgIA2hIQ0gDSAOoCENQQAhFiANmiANIA1EAAAAAAAAAABjGyAUmiAUIBREAAAAAAAAAABjG6AgIGQNACAKID6yOAIAQwDAecQhJwwKCyADIQ0gHZohFCAUIA2gIQ4gDiANoSElIA4gJaEhHCANIByhISYgFCAloSEqIAIhFCAemiElICUgFKAhDSANIBShIRwgDSAcoSErIBQgK6EhFCAlIByhISUgJSAUoCAOoCEUIBQgDaAhDiAOIA2hIQ0gKiAmoCAUoCANoSENIA0gDqAhFCAFIQ0gH5ohJSAlIA2gIQ4gDiANoSEcIA4gHKEhJiANICahISogJSAcoSErIAQhJSAXmiEcIBwgJaAhDSANICWhISYgDSAmoSEsICUgLKEhJSAcICahIRwgHCAloCAOoCElICUgDaAhDiAOIA2hIQ0gKyAqoCAloCANoSENIA0gDqAhDQJAIA2aIA0gDUQAAAAAAAAAAGMbIBSaIBQgFEQAAAAAAAAAAGMboCINIAtmDQAgFg0AIAAgGmshFiABIBprIT4gAyEtIAIhMiAFISIgBCEhIA0hIAsgASAYRw0AIAUhHyAEIRcgAiEeIAMhHSAAIRggASEaCyASIBChIQ0gJCANoSEcIA8gEaEhDSATIA2hIQ4gAEECaiEAIBUgAUEBaiIBakEBRw0ACwtDAMB5xCEnIAtEAAAAAAAAAABlDQYgCkEANgIADAYLAkAgAUEBSA0AIAKaIAIgAkQAAAAAAAAAAGMiABsiDUQAAAACAACgQaIhAiACIA2hIQ4gAiAOoSEOIA0gDqEhDyANIA2iIQIgDiAOoiACoSEQIBAgDyAOoiIRoCEOIA4gEaAhDiAPIA+iIA0gA5ogAyAAGyIkICSgoqAgDqAhDiAOIAKgIQMgAyACoSECQQAhGkEAIAFrIRUgDiACoSEOIAmaISggCJohKUQAAAACAACwQSECIAJEAAAAAAAAAMCgIQkgAiAJoSEmRAAAAAAAAABAICahIRtBAiEAQQEhAUQAAAAAAAAAACEXQQAhPkEAIRZBASEYRAAAAAAAAPA/ISpEAAAAAAAAAAAhIyAEmiIEIR8gBZoiESEgIA0hISAkISIgBCErIBEhLCANIR0gJCEeA0AgDSEJICQhJSAERAAAAAIAAKBBoiECIAIgBKEhBSACIAWhIQIgBCACoSEIIAQgBKIhBSACIAKiIAWhIQ0gDSAIIAKiIg+gIQ0gDSAPoCENIAggCKIgESAEIASgoqAgDaAhDSANIAWgIQ8gDyAFoSEFIAUgDaEhBSAFIA6gIQ0gDSAOoSEQIAUgEKEhEiANIBChIQUgDiAFoSEQIA+aIQ4gDiADoCEFIAUgA6EhDyAOIA+hIQ4gBSAPoSEPIAMgD6EhAyAOIAOgIA2gIQMgAyAFoCENIA0gBaEhBSASIBCgIAOgIAWhIQUgBSANoCEDIAMgDaEhDSAFIA2hIQUgByAFoCENIA0gBaEhDiAHIA6hIQ8gDSAOoSEOIAUgDqEhECAGIAOgIQUgBSADoSEOIAYgDqEhEiAFIA6hIQ4gAyAOoSEDIBIgA6AgDaAhDSANIAWgIQMgAyAFoSEFIA8gEKAgDaAgBaEhEiASIAOgIQUgBZogBSAFRAAAAAAAAAAAYyIZGyINRAAAAAIAAKBBoiEOIA4gDaEhDyAOIA+hIQ4gDSAOoSEQIA0gDaIhDyAOIA6iIA+hIRMgEyAQIA6iIhSgIQ4gDiAUoCEOIAUgA6EhAyAQIBCiIA0gEiADoSIDmiADIBkbIiQgJKCioCAOoCEUIBQgD6AhAyAJRAAAAAIAAKBBoiEFIAUgCaEhDiAFIA6hIQUgCSAFoSEQIAkgCaAhDiAFICaiIA6hIRIgEiAQICaioCESIBIgBSAboqAhBSAQIBuiICUgJaCgIAWgIRIgEiAOoCEFIAUgDqEhJSAFRAAAAAIAAKBBoiEOIA4gBaEhECAOIBChIRAgBSAQoSETIAUgBKIhDiACIBCiIA6hIRwgHCAIIBCioCEQIBAgAiAToqAhAiASICWhIASiIAUgEaKgIAggE6KgIAKgIQIgAiAOoCEIIAggDqEhBSAFIAKhIQIgKCACoCEFIAUgAqEhDiAoIA6hIRAgBSAOoSEOIAIgDqEhESAImiEIICkgCKAhAiACIAihIQ4gKSAOoSESIAIgDqEhDiAIIA6hIQggEiAIoCAFoCEIIAggAqAhBSAFIAKhIQIgECARoCAIoCACoSERIBEgBaAhAiACRAAAAAIAAKBBoiEIIAggAqEhDiAIIA6hIQggAiAIoSEQIAIgAqIhDiAIIAiiIA6hIRIgEiAQIAiiIhOgIQggCCAToCEIIAIgBaEhBSAQIBCiIAIgESAFoSIRIBGgoqAgCKAhBSAFIA6gIQUgCSAqIgiiICMgBKKhIg4gDqBEAAAAAAAA8D+gISogIyAJoiAIIASioCIEIASgISMCQCAFIAOgIgREAAAAAICELkFlDQAgCiACICOiIA0gKqKgICogKqIgIyAjoqAiBaMiAyACICqiIA0gI6KhIAWjIgKgRAAAAGCeoOY/oiADIAOiIAIgAqKgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCACABskN3c/hCkiAEtrwiAbNDAAAANJRDd3P4wpIgAUH///8DcUGAgID4A3K+IidDdb+/v5SSQ6Pp3L8gJ0P5RLQ+kpWSQwAAAD+UvCIBs0MAAAC0lJIgAUH///8DcUGAgID4A3K+IidDdb+/P5SSQ6Pp3D8gJ0P5RLQ+kpWSIScMCAsgAiEEAkAgC0QAAAAAAAAAAGUNAAJAIAEgFkcNACAkIQIgIpohCSAJIAKgIQUgBSACoSEIIAUgCKEhDiACIA6hIRAgCSAIoSESIA0hCSAhmiEIIAggCaAhAiACIAmhIQ4gAiAOoSETIAkgE6EhCSAIIA6hIQggCCAJoCAFoCEJIAkgAqAhBSAFIAKhIQIgEiAQoCAJoCACoSECIAIgBaAhCSARIQIgIJohCCAIIAKgIQUgBSACoSEOIAUgDqEhECACIBChIRIgCCAOoSETIAQhCCAfmiEOIA4gCKAhAiACIAihIRAgAiAQoSElIAggJaEhCCAOIBChIQ4gDiAIoCAFoCEIIAggAqAhBSAFIAKhIQIgEyASoCAIoCACoSECIAIgBaAhAkEAIRYgApogAiACRAAAAAAAAAAAYxsgCZogCSAJRAAAAAAAAAAAYxugIBdkDQAgCiA+sjgCAEMAwHnEIScMCQsgJCECIB6aIQkgCSACoCEFIAUgAqEhCCAFIAihIQ4gAiAOoSEQIAkgCKEhEiANIQkgHZohCCAIIAmgIQIgAiAJoSEOIAIgDqEhEyAJIBOhIQkgCCAOoSEIIAggCaAgBaAhCSAJIAKgIQUgBSACoSECIBIgEKAgCaAgAqEhAiACIAWgIQkgESECICyaIQggCCACoCEFIAUgAqEhDiAFIA6hIRAgAiAQoSESIAggDqEhEyAEIQggK5ohDiAOIAigIQIgAiAIoSEQIAIgEKEhJSAIICWhIQggDiAQoSEOIA4gCKAgBaAhCCAIIAKgIQUgBSACoSECIBMgEqAgCKAgAqEhAiACIAWgIQICQCACmiACIAJEAAAAAAAAAABjGyAJmiAJIAlEAAAAAAAAAABjG6AiAiALZg0AIBYNACAAIBprIRYgASAaayE+ICQhIiANISEgESEgIAQhHyACIRcLIAEgGEcNACAkIR4gDSEdIBEhLCAEISsgACEYIAEhGgsgAyAPoSECIBQgAqEhDiAAQQJqIQAgFSABQQFqIgFqQQFHDQALC0MAwHnEIScgC0QAAAAAAAAAAGUNBSAKQQA2AgAMBQsCQCABQQFIDQAgBEQAAAACAACgQaIhDSANIAShIQ4gDSAOoSEOIAQgDqEhDyAEIASiIQ0gDiAOoiANoSEQIBAgDyAOoiIRoCEOIA4gEaAhDiAPIA+iIAQgBSAFoKKgIA6gIRAgECANoCESIBIgDaEhESACRAAAAAIAAKBBoiENIA0gAqEhDiANIA6hIQ4gAiAOoSEPIAIgAqIhDSAOIA6iIA2hIRMgEyAPIA6iIhSgIQ4gDiAUoCEOIA8gD6IgAiADIAOgoqAgDqAhDiAOIA2gIQ8gDyANoSENQQAhGkEAIAFrIRUgDiANoSEOIBAgEaEhK0QAAAACAACwQSENIA1EAAAAAAAAAMCgIRAgDSAQoSEpRAAAAAAAAABAICmhIRtBAiEAQQEhAUQAAAAAAAAAACEgQQAhPkEAIRZBASEYRAAAAAAAAPA/ISpEAAAAAAAAAAAhJiADIR0gAiEeIAQhISAFISIgAiEyIAMhLSAEIRcgBSEfA0AgEiEsIAKaIAIgAkQAAAAAAAAAAGMiGRsiEUQAAAACAACgQaIhDSANIBGhIRAgDSAQoSEQIBEgEKEhEiARIBGgIQ0gECApoiANoSETIBMgEiApoqAhEyATIBAgG6KgIRAgEiAboiADmiADIBkbIiggKKCgIBCgIRQgFCANoCEDIAMgDaEhHCADRAAAAAIAAKBBoiENIA0gA6EhECANIBChIRAgAyAQoSEkIASaIAQgBEQAAAAAAAAAAGMiGRsiEkQAAAACAACgQaIhDSANIBKhIRMgDSAToSETIBIgE6EhJSADIBKiIQ0gEyAQoiANoSEjICMgJSAQoqAhECAQIBMgJKKgIRAgFCAcoSASoiADIAWaIAUgGRsiE6KgICUgJKKgIBCgIQUgBSANoCEDIAMgDaEhDSAFIA2hIQUgE5ohECAQIAWgIQ0gDSAFoSETIBAgE6EhFCANIBOhIRAgBSAQoSETIBKaIRAgECADoCEFIAUgA6EhEiAQIBKhIRAgBSASoSESIAMgEqEhAyAQIAOgIA2gIQMgAyAFoCENIA0gBaEhBSAUIBOgIAOgIAWhIQUgBSANoCEDIAMgDaEhDSAFIA2hIQUgCSAFoCENIA0gBaEhECAJIBChIRIgDSAQoSEQIAUgEKEhEyAIIAOgIQUgBSADoSEQIAggEKEhFCAFIBChIRAgAyAQoSEDIBQgA6AgDaAhDSANIAWgIQMgAyAFoSEFIBIgE6AgDaAgBaEhEyATIAOgIQ0gDUQAAAACAACgQaIhBSAFIA2hIRAgBSAQoSEFIA0gBaEhEiANIA2iIRAgBSAFoiAQoSEUIBQgEiAFoiIkoCEFIAUgJKAhFCANIAOhIQMgEiASoiANIBMgA6EiBSAFoKKgIBSgISQgJCAQoCESICuaIQMgAyAOoCETIBMgDqEhFCATIBShISUgDiAloSElIAMgFKEhHCAsmiEOIA4gD6AhAyADIA+hIRQgAyAUoSEjIA8gI6EhDyAOIBShIQ4gDiAPoCAToCEPIA8gA6AhDiAOIAOhIQMgHCAloCAPoCADoSEPIA8gDqAhAyADIA6hIQ4gDyAOoSEOICiaIRMgEyAOoCEPIA8gDqEhFCATIBShISUgDyAUoSETIA4gE6EhFCARmiERIBEgA6AhDiAOIAOhIRMgESAToSERIA4gE6EhEyADIBOhIQMgESADoCAPoCEDIAMgDqAhDyAPIA6hIQ4gJSAUoCADoCAOoSEOIA4gD6AhAyADIA+hIQ8gDiAPoSEOIAcgDqAhDyAPIA6hIREgByARoSETIA8gEaEhESAOIBGhIRQgBiADoCEOIA4gA6EhESAGIBGhISUgDiARoSERIAMgEaEhAyAlIAOgIA+gIQ8gDyAOoCEDIAMgDqEhDiATIBSgIA+gIA6hIRQgFCADoCEOIA5EAAAAAgAAoEGiIQ8gDyAOoSERIA8gEaEhDyAOIA+hIRMgDiAOoiERIA8gD6IgEaEhJSAlIBMgD6IiHKAhDyAPIBygIQ8gDiADoSEDIBMgE6IgDiAUIAOhIgMgA6CioCAPoCETIBMgEaAhDyAqIhQgAqIgJiAEoqEiJSAloEQAAAAAAADwP6AhKiAmIAKiIBQgBKKgIgQgBKAhJgJAIBIgD6AiBEQAAAAAgIQuQWUNACAKIA0gJqIgDiAqoqAgKiAqoiAmICaioCIDoyICIA0gKqIgDiAmoqEgA6MiA6BEAAAAYJ6g5j+iIAIgAqIgAyADoqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIAIAGyQ3dz+EKSIAS2vCIBs0MAAAA0lEN3c/jCkiABQf///wNxQYCAgPgDcr4iJ0N1v7+/lJJDo+ncvyAnQ/lEtD6SlZJDAAAAP5S8IgGzQwAAALSUkiABQf///wNxQYCAgPgDcr4iJ0N1v78/lJJDo+ncPyAnQ/lEtD6SlZIhJwwHCyAOIQIgDSEEAkAgC0QAAAAAAAAAAGUNAAJAIAEgFkcNACADIQ0gLZohFCAUIA2gIQ4gDiANoSElIA4gJaEhHCANIByhISMgFCAloSEoIAIhFCAymiElICUgFKAhDSANIBShIRwgDSAcoSErIBQgK6EhFCAlIByhISUgJSAUoCAOoCEUIBQgDaAhDiAOIA2hIQ0gKCAjoCAUoCANoSENIA0gDqAhFCAFIQ0gIpohJSAlIA2gIQ4gDiANoSEcIA4gHKEhIyANICOhISggJSAcoSErIAQhJSAhmiEcIBwgJaAhDSANICWhISMgDSAjoSEsICUgLKEhJSAcICOhIRwgHCAloCAOoCElICUgDaAhDiAOIA2hIQ0gKyAooCAloCANoSENIA0gDqAhDUEAIRYgDZogDSANRAAAAAAAAAAAYxsgFJogFCAURAAAAAAAAAAAYxugICBkDQAgCiA+sjgCAEMAwHnEIScMCAsgAyENIB2aIRQgFCANoCEOIA4gDaEhJSAOICWhIRwgDSAcoSEjIBQgJaEhKCACIRQgHpohJSAlIBSgIQ0gDSAUoSEcIA0gHKEhKyAUICuhIRQgJSAcoSElICUgFKAgDqAhFCAUIA2gIQ4gDiANoSENICggI6AgFKAgDaEhDSANIA6gIRQgBSENIB+aISUgJSANoCEOIA4gDaEhHCAOIByhISMgDSAjoSEoICUgHKEhKyAEISUgF5ohHCAcICWgIQ0gDSAloSEjIA0gI6EhLCAlICyhISUgHCAjoSEcIBwgJaAgDqAhJSAlIA2gIQ4gDiANoSENICsgKKAgJaAgDaEhDSANIA6gIQ0CQCANmiANIA1EAAAAAAAAAABjGyAUmiAUIBREAAAAAAAAAABjG6AiDSALZg0AIBYNACAAIBprIRYgASAaayE+IAMhLSACITIgBSEiIAQhISANISALIAEgGEcNACAFIR8gBCEXIAIhHiADIR0gACEYIAEhGgsgEiAQoSENICQgDaEhKyAPIBGhIQ0gEyANoSEOIABBAmohACAVIAFBAWoiAWpBAUcNAAsLQwDAecQhJyALRAAAAAAAAAAAZQ0EIApBADYCAAwECwJAIAFBAUgNACAERAAAAAIAAKBBoiENIA0gBKEhDiANIA6hIQ4gBCAOoSEPIAQgBKIhDSAOIA6iIA2hIRAgECAPIA6iIhGgIQ4gDiARoCEOIA8gD6IgBCAFIAWgoqAgDqAhECAQIA2gIRIgEiANoSERIAJEAAAAAgAAoEGiIQ0gDSACoSEOIA0gDqEhDiACIA6hIQ8gAiACoiENIA4gDqIgDaEhEyATIA8gDqIiFKAhDiAOIBSgIQ4gDyAPoiACIAMgA6CioCAOoCEOIA4gDaAhDyAPIA2hIQ1BACEVQQAgAWshFiAOIA2hIQ4gECARoSEcRAAAAAIAALDBIQ0gDUQAAAAAAAAAQKAhECANIBChISNBAiEAQQEhAUQAAAAAAAAAACEfQQAhGEEAIRlBASEaRAAAAAAAAPA/ISlEAAAAAAAAAAAhJiADISwgAiEdIAQhICAFISEgAiEiIAMhMiAEIR4gBSEXA0AgEiEoIAJEAAAAAgAAoEGiIQ0gDSACoSEQIA0gEKEhECACIBChIREgAkQAAAAAAAAAwKIhDSAQICOiIA2hIRIgEiARICOioCETRAAAAAAAAADAICOhIRIgEyAQIBKioCEQIBEgEqIgAyADoKEgEKAhEiASIA2gIQMgAyANoSEkIANEAAAAAgAAoEGiIQ0gDSADoSEQIA0gEKEhECADIBChIRMgBEQAAAACAACgQaIhDSANIAShIREgDSARoSERIAQgEaEhFCADIASiIQ0gESAQoiANoSElICUgFCAQoqAhECAQIBEgE6KgIRAgEiAkoSAEoiADIAWioCAUIBOioCAQoCEFIAUgDaAhAyADIA2hIQ0gBSANoSEFIAkgBaAhDSANIAWhIRAgCSAQoSERIA0gEKEhECAFIBChIRIgCCADoCEFIAUgA6EhECAIIBChIRMgBSAQoSEQIAMgEKEhAyATIAOgIA2gIQ0gDSAFoCEDIAMgBaEhBSARIBKgIA2gIAWhIRIgEiADoCENIA1EAAAAAgAAoEGiIQUgBSANoSEQIAUgEKEhBSANIAWhIREgDSANoiEQIAUgBaIgEKEhEyATIBEgBaIiFKAhBSAFIBSgIRMgDSADoSEDIBEgEaIgDSASIAOhIgUgBaCioCAToCEkICQgEKAhEiAcmiEDIAMgDqAhESARIA6hIRMgESAToSEUIA4gFKEhFCADIBOhISUgKJohDiAOIA+gIQMgAyAPoSETIAMgE6EhHCAPIByhIQ8gDiAToSEOIA4gD6AgEaAhDyAPIAOgIQ4gDiADoSEDICUgFKAgD6AgA6EhDyAPIA6gIQMgAyAOoSEOIA8gDqEhDiAHIA6gIQ8gDyAOoSERIAcgEaEhEyAPIBGhIREgDiARoSEUIAYgA6AhDiAOIAOhIREgBiARoSElIA4gEaEhESADIBGhIQMgJSADoCAPoCEPIA8gDqAhAyADIA6hIQ4gEyAUoCAPoCAOoSEUIBQgA6AhDiAORAAAAAIAAKBBoiEPIA8gDqEhESAPIBGhIQ8gDiAPoSETIA4gDqIhESAPIA+iIBGhISUgJSATIA+iIhygIQ8gDyAcoCEPIA4gA6EhAyATIBOiIA4gFCADoSIDIAOgoqAgD6AhEyATIBGgIQ8gKSIUIAKiICYgBKKhIiUgJaBEAAAAAAAA8D+gISkgJiACoiAUIASioCIEIASgISYCQCASIA+gIgREAAAAAICELkFlDQAgCiAOICmiIA0gJqKgICkgKaIgJiAmoqAiA6MiAiANICmiIA4gJqKhIAOjIgOgRAAAAGCeoOY/oiACIAKiIAMgA6Kgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCACABskN3c/hCkiAEtrwiAbNDAAAANJRDd3P4wpIgAUH///8DcUGAgID4A3K+IidDdb+/v5SSQ6Pp3L8gJ0P5RLQ+kpWSQwAAAD+UvCIBs0MAAAC0lJIgAUH///8DcUGAgID4A3K+IidDdb+/P5SSQ6Pp3D8gJ0P5RLQ+kpWSIScMBgsgDiECIA0hBAJAIAtEAAAAAAAAAABlDQACQCABIBlHDQAgAyENIDKaIRQgFCANoCEOIA4gDaEhJSAOICWhIRwgDSAcoSEoIBQgJaEhGyACIRQgIpohJSAlIBSgIQ0gDSAUoSEcIA0gHKEhKiAUICqhIRQgJSAcoSElICUgFKAgDqAhFCAUIA2gIQ4gDiANoSENIBsgKKAgFKAgDaEhDSANIA6gIRQgBSENICGaISUgJSANoCEOIA4gDaEhHCAOIByhISggDSAooSEbICUgHKEhKiAEISUgIJohHCAcICWgIQ0gDSAloSEoIA0gKKEhKyAlICuhISUgHCAooSEcIBwgJaAgDqAhJSAlIA2gIQ4gDiANoSENICogG6AgJaAgDaEhDSANIA6gIQ1BACEZIA2aIA0gDUQAAAAAAAAAAGMbIBSaIBQgFEQAAAAAAAAAAGMboCAfZA0AIAogGLI4AgBDAMB5xCEnDAcLIAMhDSAsmiEUIBQgDaAhDiAOIA2hISUgDiAloSEcIA0gHKEhKCAUICWhIRsgAiEUIB2aISUgJSAUoCENIA0gFKEhHCANIByhISogFCAqoSEUICUgHKEhJSAlIBSgIA6gIRQgFCANoCEOIA4gDaEhDSAbICigIBSgIA2hIQ0gDSAOoCEUIAUhDSAXmiElICUgDaAhDiAOIA2hIRwgDiAcoSEoIA0gKKEhGyAlIByhISogBCElIB6aIRwgHCAloCENIA0gJaEhKCANICihISsgJSAroSElIBwgKKEhHCAcICWgIA6gISUgJSANoCEOIA4gDaEhDSAqIBugICWgIA2hIQ0gDSAOoCENAkAgDZogDSANRAAAAAAAAAAAYxsgFJogFCAURAAAAAAAAAAAYxugIg0gC2YNACAZDQAgACAVayEZIAEgFWshGCADITIgAiEiIAUhISAEISAgDSEfCyABIBpHDQAgBSEXIAQhHiACIR0gAyEsIAAhGiABIRULIBIgEKEhDSAkIA2hIRwgDyARoSENIBMgDaEhDiAAQQJqIQAgFiABQQFqIgFqQQFHDQALC0MAwHnEIScgC0QAAAAAAAAAAGUNAyAKQQA2AgAMAwsgDCAEOQMQIAwgAzkDCCAMIAI5AwAgDCAFOQMYAkAgAUEBSA0AIAREAAAAAgAAoEGiIQ0gDSAEoSEOIA0gDqEhDiAEIA6hIQ8gBCAEoiENIA4gDqIgDaEhECAQIA8gDqIiEaAhDiAOIBGgIQ4gDyAPoiAEIAUgBaCioCAOoCERIBEgDaAhECAQIA2hIRIgAkQAAAACAACgQaIhDSANIAKhIQ4gDSAOoSEOIAIgDqEhDyACIAKiIQ0gDiAOoiANoSETIBMgDyAOoiIUoCEOIA4gFKAhDiAPIA+iIAIgAyADoKKgIA6gIQ4gDiANoCEPIA8gDaEhDSAOIA2hIQ0gESASoSESQQAhAEECIRZBACEYQQEhGUQAAAAAAAAAACEXQQAhP0EAIRpBASE+RAAAAAAAAPA/IRxEAAAAAAAAAAAhIyACIR0gBCEeIAMhHyACISAgBSEhIAQhIgNAIBwgAqIgIyAEoqEiDiAOoCEOICMgAqIgHCAEoqAhBAJAAkAgGUEKbkEKbEF/aiAAIhVHDQAgDCAMQRBqIA8gDSAQIBIgBiAHIAggCRCugICAAAwBCyAMIAxBEGogDyANIBAgEiAGIAcgCCAJEKuAgIAACyAORAAAAAAAAPA/oCEcIAQgBKAhIyAVQQFqIQAgDCsDECIERAAAAAIAAKBBoiECIAIgBKEhDSACIA2hIQIgBCACoSEOIAQgBKIhDSACIAKiIA2hIQ8gDyAOIAKiIhCgIQIgAiAQoCECIA4gDqIgBCAMKwMYIiQgJKCioCACoCESIBIgDaAhECAMKwMAIgJEAAAAAgAAoEGiIQ4gDiACoSEPIA4gD6EhDyACIA+hIREgAiACoiEOIA8gD6IgDqEhEyATIBEgD6IiFKAhDyAPIBSgIQ8gESARoiACIAwrAwgiJSAloKKgIA+gIREgESAOoCEPAkAgECAPoCITRAAAAACAhC5BZQ0AIAogBCAjoiACIByioCAcIByiICMgI6KgIgWjIgMgBCAcoiACICOioSAFoyIEoEQAAABgnqDmP6IgAyADoiAEIASioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgAgALJDd3P4QpIgE7a8IgGzQwAAADSUQ3dz+MKSIAFB////A3FBgICA+ANyviInQ3W/v7+UkkOj6dy/ICdD+US0PpKVkkMAAAA/lLwiAbNDAAAAtJSSIAFB////A3FBgICA+ANyviInQ3W/vz+UkkOj6dw/ICdD+US0PpKVkiEnDAULAkAgC0QAAAAAAAAAAGUNAAJAIAAgGkcNACAlIRMgH5ohJiAmIBOgIRQgFCAToSEoIBQgKKEhKSATICmhIRsgJiAooSEqIAIhJiAgmiEoICggJqAhEyATICahISkgEyApoSErICYgK6EhJiAoICmhISggKCAmoCAUoCEmICYgE6AhFCAUIBOhIRMgKiAboCAmoCAToSETIBMgFKAhJiAkIRMgIZohKCAoIBOgIRQgFCAToSEpIBQgKaEhGyATIBuhISogKCApoSErIAQhKCAimiEpICkgKKAhEyATICihIRsgEyAboSEsICggLKEhKCApIBuhISkgKSAooCAUoCEoICggE6AhFCAUIBOhIRMgKyAqoCAooCAToSETIBMgFKAhE0EAIRogE5ogEyATRAAAAAAAAAAAYxsgJpogJiAmRAAAAAAAAAAAYxugIBdkDQAgCiA/sjgCAEMAwHnEIScMBgsgJSETIAOaISYgJiAToCEUIBQgE6EhKCAUICihISkgEyApoSEbICYgKKEhKiACISYgHZohKCAoICagIRMgEyAmoSEpIBMgKaEhKyAmICuhISYgKCApoSEoICggJqAgFKAhJiAmIBOgIRQgFCAToSETICogG6AgJqAgE6EhEyATIBSgISYgJCETIAWaISggKCAToCEUIBQgE6EhKSAUICmhIRsgEyAboSEqICggKaEhKyAEISggHpohKSApICigIRMgEyAooSEbIBMgG6EhLCAoICyhISggKSAboSEpICkgKKAgFKAhKCAoIBOgIRQgFCAToSETICsgKqAgKKAgE6EhEyATIBSgIRMCQCATmiATIBNEAAAAAAAAAABjGyAmmiAmICZEAAAAAAAAAABjG6AiEyALZg0AIBoNACAWIBhrIRogFSAYa0EBaiE/IAQhIiAkISEgAiEgICUhHyATIRcLIAAgPkcNACAEIR4gJCEFIAIhHSAlIQMgFiE+IAAhGAsgECANoSENIBIgDaEhEiAPIA6hIQ0gESANoSENIBZBAmohFiAZQQFqIRkgASAARw0ACwtDAMB5xCEnIAtEAAAAAAAAAABlDQIgCkEANgIADAILIAwgBDkDECAMIAM5AwggDCACOQMAIAwgBTkDGAJAIAFBAUgNACAERAAAAAIAAKBBoiENIA0gBKEhDiANIA6hIQ4gBCAOoSEPIAQgBKIhDSAOIA6iIA2hIRAgECAPIA6iIhGgIQ4gDiARoCEOIA8gD6IgBCAFIAWgoqAgDqAhESARIA2gIRAgECANoSESIAJEAAAAAgAAoEGiIQ0gDSACoSEOIA0gDqEhDiACIA6hIQ8gAiACoiENIA4gDqIgDaEhEyATIA8gDqIiFKAhDiAOIBSgIQ4gDyAPoiACIAMgA6CioCAOoCEOIA4gDaAhDyAPIA2hIQ0gDiANoSENIBEgEqEhEkEAIQBBAiEWQQAhGEEBIRlEAAAAAAAAAAAhF0EAIT9BACEaQQEhPkQAAAAAAADwPyEcRAAAAAAAAAAAISMgAiEdIAQhHiADIR8gAiEgIAUhISAEISIDQCAcIAKiICMgBKKhIg4gDqAhDiAjIAKiIBwgBKKgIQQCQAJAIBlBCm5BCmxBf2ogACIVRw0AIAwgDEEQaiAPIA0gECASIAYgByAIIAkQr4CAgAAMAQsgDCAMQRBqIA8gDSAQIBIgBiAHIAggCRCsgICAAAsgDkQAAAAAAADwP6AhHCAEIASgISMgFUEBaiEAIAwrAxAiBEQAAAACAACgQaIhAiACIAShIQ0gAiANoSECIAQgAqEhDiAEIASiIQ0gAiACoiANoSEPIA8gDiACoiIQoCECIAIgEKAhAiAOIA6iIAQgDCsDGCIkICSgoqAgAqAhEiASIA2gIRAgDCsDACICRAAAAAIAAKBBoiEOIA4gAqEhDyAOIA+hIQ8gAiAPoSERIAIgAqIhDiAPIA+iIA6hIRMgEyARIA+iIhSgIQ8gDyAUoCEPIBEgEaIgAiAMKwMIIiUgJaCioCAPoCERIBEgDqAhDwJAIBAgD6AiE0QAAAAAgIQuQWUNACAKIAQgI6IgAiAcoqAgHCAcoiAjICOioCIFoyIDIAQgHKIgAiAjoqEgBaMiBKBEAAAAYJ6g5j+iIAMgA6IgBCAEoqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIAIACyIBO2vCIBs0MAAAA0lEN3c/jCkiABQf///wNxQYCAgPgDcr4iJ0N1v7+/lJJDo+ncvyAnQ/lEtD6SlZJDAAAAP5S8IgGzQwAAADSUQ3dz+MKSIAFB////A3FBgICA+ANyviInQ3W/v7+UkkOj6dy/ICdD+US0PpKVkkOdhCG/lJIhJwwECwJAIAtEAAAAAAAAAABlDQACQCAAIBpHDQAgJSETIB+aISYgJiAToCEUIBQgE6EhKCAUICihISkgEyApoSEbICYgKKEhKiACISYgIJohKCAoICagIRMgEyAmoSEpIBMgKaEhKyAmICuhISYgKCApoSEoICggJqAgFKAhJiAmIBOgIRQgFCAToSETICogG6AgJqAgE6EhEyATIBSgISYgJCETICGaISggKCAToCEUIBQgE6EhKSAUICmhIRsgEyAboSEqICggKaEhKyAEISggIpohKSApICigIRMgEyAooSEbIBMgG6EhLCAoICyhISggKSAboSEpICkgKKAgFKAhKCAoIBOgIRQgFCAToSETICsgKqAgKKAgE6EhEyATIBSgIRNBACEaIBOaIBMgE0QAAAAAAAAAAGMbICaaICYgJkQAAAAAAAAAAGMboCAXZA0AIAogP7I4AgBDAMB5xCEnDAULICUhEyADmiEmICYgE6AhFCAUIBOhISggFCAooSEpIBMgKaEhGyAmICihISogAiEmIB2aISggKCAmoCETIBMgJqEhKSATICmhISsgJiAroSEmICggKaEhKCAoICagIBSgISYgJiAToCEUIBQgE6EhEyAqIBugICagIBOhIRMgEyAUoCEmICQhEyAFmiEoICggE6AhFCAUIBOhISkgFCApoSEbIBMgG6EhKiAoICmhISsgBCEoIB6aISkgKSAooCETIBMgKKEhGyATIBuhISwgKCAsoSEoICkgG6EhKSApICigIBSgISggKCAToCEUIBQgE6EhEyArICqgICigIBOhIRMgEyAUoCETAkAgE5ogEyATRAAAAAAAAAAAYxsgJpogJiAmRAAAAAAAAAAAYxugIhMgC2YNACAaDQAgFiAYayEaIBUgGGtBAWohPyAEISIgJCEhIAIhICAlIR8gEyEXCyAAID5HDQAgBCEeICQhBSACIR0gJSEDIBYhPiAAIRgLIBAgDaEhDSASIA2hIRIgDyAOoSENIBEgDaEhDSAWQQJqIRYgGUEBaiEZIAEgAEcNAAsLQwDAecQhJyALRAAAAAAAAAAAZQ0BIApBADYCAAwBCyAMIAQ5AxAgDCADOQMIIAwgAjkDACAMIAU5AxgCQCABQQFIDQAgBEQAAAACAACgQaIhDSANIAShIQ4gDSAOoSEOIAQgDqEhDyAEIASiIQ0gDiAOoiANoSEQIBAgDyAOoiIRoCEOIA4gEaAhDiAPIA+iIAQgBSAFoKKgIA6gIREgESANoCEQIBAgDaEhEiACRAAAAAIAAKBBoiENIA0gAqEhDiANIA6hIQ4gAiAOoSEPIAIgAqIhDSAOIA6iIA2hIRMgEyAPIA6iIhSgIQ4gDiAUoCEOIA8gD6IgAiADIAOgoqAgDqAhDiAOIA2gIQ8gDyANoSENIA4gDaEhDSARIBKhIRJBACEAQQIhFkEAIRhBASEZRAAAAAAAAAAAIRdBACE/QQAhGkEBIT5EAAAAAAAA8D8hHEQAAAAAAAAAACEjIAIhHSAEIR4gAyEfIAIhICAFISEgBCEiA0AgHCACoiAjIASioSIOIA6gIQ4gIyACoiAcIASioCEEAkACQCAZQQpuQQpsQX9qIAAiFUcNACAMIAxBEGogDyANIBAgEiAGIAcgCCAJELCAgIAADAELIAwgDEEQaiAPIA0gECASIAYgByAIIAkQrYCAgAALIA5EAAAAAAAA8D+gIRwgBCAEoCEjIBVBAWohACAMKwMQIgREAAAAAgAAoEGiIQIgAiAEoSENIAIgDaEhAiAEIAKhIQ4gBCAEoiENIAIgAqIgDaEhDyAPIA4gAqIiEKAhAiACIBCgIQIgDiAOoiAEIAwrAxgiJCAkoKKgIAKgIRIgEiANoCEQIAwrAwAiAkQAAAACAACgQaIhDiAOIAKhIQ8gDiAPoSEPIAIgD6EhESACIAKiIQ4gDyAPoiAOoSETIBMgESAPoiIUoCEPIA8gFKAhDyARIBGiIAIgDCsDCCIlICWgoqAgD6AhESARIA6gIQ8CQCAQIA+gIhNEAAAAAICELkFlDQAgCiAEICOiIAIgHKKgIBwgHKIgIyAjoqAiBaMiAyAEIByiIAIgI6KhIAWjIgSgRAAAAGCeoOY/oiADIAOiIAQgBKKgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCACAAsiATtrwiAbNDAAAANJRDd3P4wpIgAUH///8DcUGAgID4A3K+IidDdb+/v5SSQ6Pp3L8gJ0P5RLQ+kpWSQwAAAD+UvCIBs0MAAAA0lEN3c/jCkiABQf///wNxQYCAgPgDcr4iJ0N1v7+/lJJDo+ncvyAnQ/lEtD6SlZJDAAAAP5STIScMAwsCQCALRAAAAAAAAAAAZQ0AAkAgACAaRw0AICUhEyAfmiEmICYgE6AhFCAUIBOhISggFCAooSEpIBMgKaEhGyAmICihISogAiEmICCaISggKCAmoCETIBMgJqEhKSATICmhISsgJiAroSEmICggKaEhKCAoICagIBSgISYgJiAToCEUIBQgE6EhEyAqIBugICagIBOhIRMgEyAUoCEmICQhEyAhmiEoICggE6AhFCAUIBOhISkgFCApoSEbIBMgG6EhKiAoICmhISsgBCEoICKaISkgKSAooCETIBMgKKEhGyATIBuhISwgKCAsoSEoICkgG6EhKSApICigIBSgISggKCAToCEUIBQgE6EhEyArICqgICigIBOhIRMgEyAUoCETQQAhGiATmiATIBNEAAAAAAAAAABjGyAmmiAmICZEAAAAAAAAAABjG6AgF2QNACAKID+yOAIAQwDAecQhJwwECyAlIRMgA5ohJiAmIBOgIRQgFCAToSEoIBQgKKEhKSATICmhIRsgJiAooSEqIAIhJiAdmiEoICggJqAhEyATICahISkgEyApoSErICYgK6EhJiAoICmhISggKCAmoCAUoCEmICYgE6AhFCAUIBOhIRMgKiAboCAmoCAToSETIBMgFKAhJiAkIRMgBZohKCAoIBOgIRQgFCAToSEpIBQgKaEhGyATIBuhISogKCApoSErIAQhKCAemiEpICkgKKAhEyATICihIRsgEyAboSEsICggLKEhKCApIBuhISkgKSAooCAUoCEoICggE6AhFCAUIBOhIRMgKyAqoCAooCAToSETIBMgFKAhEwJAIBOaIBMgE0QAAAAAAAAAAGMbICaaICYgJkQAAAAAAAAAAGMboCITIAtmDQAgGg0AIBYgGGshGiAVIBhrQQFqIT8gBCEiICQhISACISAgJSEfIBMhFwsgACA+Rw0AIAQhHiAkIQUgAiEdICUhAyAWIT4gACEYCyAQIA2hIQ0gEiANoSESIA8gDqEhDSARIA2hIQ0gFkECaiEWIBlBAWohGSABIABHDQALC0MAwHnEIScgC0QAAAAAAAAAAGUNACAKQQA2AgALIAxBIGokgICAgAAgJwuYwQEJAX8IfAJ/AXwDfwh8AX0HfAJ/I4CAgIAAQSBrIgwkgICAgAACQAJAAkACQAJAAkACQAJAAkACQAJAAkACQAJAAkACQAJAIABBf2oODwABAgMEBQYHCAkKCwwNDg8LIAwgBDkDECAMIAM5AwggDCACOQMAIAwgBTkDGAJAIAFBAUgNACAERAAAAAIAAKBBoiENIA0gBKEhDiANIA6hIQ4gBCAOoSEPIAQgBKIhDSAOIA6iIA2hIRAgECAPIA6iIhGgIQ4gDiARoCEOIA8gD6IgBCAFIAWgoqAgDqAhECAQIA2gIRIgEiANoSETIAJEAAAAAgAAoEGiIQ0gDSACoSEOIA0gDqEhDiACIA6hIQ8gAiACoiENIA4gDqIgDaEhESARIA8gDqIiFKAhDiAOIBSgIQ4gDyAPoiACIAMgA6CioCAOoCEOIA4gDaAhESARIA2hIQ1BACEVQQAgAWshFiAOIA2hIQ0gECAToSEPQQIhAEEBIQFEAAAAAAAAAAAhF0EAIRhBACEZQQEhGiADIRsgAiEcIAUhHSAEIR4DQCAMIAxBEGogESANIBIgDyAGIAcgCCAJEJ6AgIAAIAwrAxAiD0QAAAACAACgQaIhDSANIA+hIQ4gDSAOoSEOIA8gDqEhECAPIA+iIQ0gDiAOoiANoSERIBEgECAOoiISoCEOIA4gEqAhDiAQIBCiIA8gDCsDGCIfIB+goqAgDqAhFCAUIA2gIRIgDCsDACIQRAAAAAIAAKBBoiEOIA4gEKEhESAOIBGhIREgECARoSETIBAgEKIhDiARIBGiIA6hISAgICATIBGiIiGgIREgESAhoCERIBMgE6IgECAMKwMIIiIgIqCioCARoCETIBMgDqAhEQJAIBIgEaAiIEQAAAAAgIQuQWUNACABskN3c/hCkiAgtrwiAbNDAAAANJRDd3P4wpIgAUH///8DcUGAgID4A3K+IiNDdb+/v5SSQ6Pp3L8gI0P5RLQ+kpWSQwAAAD+UvCIBs0MAAAC0lJIgAUH///8DcUGAgID4A3K+IiNDdb+/P5SSQ6Pp3D8gI0P5RLQ+kpWSISMMEgsCQCALRAAAAAAAAAAAZQ0AAkAgASAZRw0AICIhICAbmiEkICQgIKAhISAhICChISUgISAloSEmICAgJqEhJyAkICWhISggECEkIByaISUgJSAkoCEgICAgJKEhJiAgICahISkgJCApoSEkICUgJqEhJSAlICSgICGgISQgJCAgoCEhICEgIKEhICAoICegICSgICChISAgICAhoCEkIB8hICAdmiElICUgIKAhISAhICChISYgISAmoSEnICAgJ6EhKCAlICahISkgDyElIB6aISYgJiAloCEgICAgJaEhJyAgICehISogJSAqoSElICYgJ6EhJiAmICWgICGgISUgJSAgoCEhICEgIKEhICApICigICWgICChISAgICAhoCEgQQAhGSAgmiAgICBEAAAAAAAAAABjGyAkmiAkICREAAAAAAAAAABjG6AgF2QNACAKIBiyOAIAQwDAecQhIwwTCyAiISAgA5ohJCAkICCgISEgISAgoSElICEgJaEhJiAgICahIScgJCAloSEoIBAhJCACmiElICUgJKAhICAgICShISYgICAmoSEpICQgKaEhJCAlICahISUgJSAkoCAhoCEkICQgIKAhISAhICChISAgKCAnoCAkoCAgoSEgICAgIaAhJCAfISAgBZohJSAlICCgISEgISAgoSEmICEgJqEhJyAgICehISggJSAmoSEpIA8hJSAEmiEmICYgJaAhICAgICWhIScgICAnoSEqICUgKqEhJSAmICehISYgJiAloCAhoCElICUgIKAhISAhICChISAgKSAooCAloCAgoSEgICAgIaAhIAJAICCaICAgIEQAAAAAAAAAAGMbICSaICQgJEQAAAAAAAAAAGMboCIgIAtmDQAgGQ0AIAAgFWshGSABIBVrIRggDyEeIB8hHSAQIRwgIiEbICAhFwsgASAaRw0AIA8hBCAfIQUgECECICIhAyAAIRogASEVCyASIA2hIQ0gFCANoSEPIBEgDqEhDSATIA2hIQ0gAEECaiEAIBYgAUEBaiIBakEBRw0ACwtDAMB5xCEjIAtEAAAAAAAAAABlDQ8gCkEANgIADA8LIAwgBDkDECAMIAM5AwggDCACOQMAIAwgBTkDGAJAIAFBAUgNACAERAAAAAIAAKBBoiENIA0gBKEhDiANIA6hIQ4gBCAOoSEPIAQgBKIhDSAOIA6iIA2hIRAgECAPIA6iIhGgIQ4gDiARoCEOIA8gD6IgBCAFIAWgoqAgDqAhECAQIA2gIRIgEiANoSETIAJEAAAAAgAAoEGiIQ0gDSACoSEOIA0gDqEhDiACIA6hIQ8gAiACoiENIA4gDqIgDaEhESARIA8gDqIiFKAhDiAOIBSgIQ4gDyAPoiACIAMgA6CioCAOoCEOIA4gDaAhESARIA2hIQ1BACEVQQAgAWshFiAOIA2hIQ0gECAToSEPQQIhAEEBIQFEAAAAAAAAAAAhF0EAIRhBACEZQQEhGiADIRsgAiEcIAUhHSAEIR4DQCAMIAxBEGogESANIBIgDyAGIAcgCCAJEJ+AgIAAIAwrAxAiD0QAAAACAACgQaIhDSANIA+hIQ4gDSAOoSEOIA8gDqEhECAPIA+iIQ0gDiAOoiANoSERIBEgECAOoiISoCEOIA4gEqAhDiAQIBCiIA8gDCsDGCIfIB+goqAgDqAhFCAUIA2gIRIgDCsDACIQRAAAAAIAAKBBoiEOIA4gEKEhESAOIBGhIREgECARoSETIBAgEKIhDiARIBGiIA6hISAgICATIBGiIiGgIREgESAhoCERIBMgE6IgECAMKwMIIiIgIqCioCARoCETIBMgDqAhEQJAIBIgEaAiIEQAAAAAgIQuQWUNACABsiAgtrwiAbNDAAAANJRDd3P4wpIgAUH///8DcUGAgID4A3K+IiNDdb+/v5SSQ6Pp3L8gI0P5RLQ+kpWSQwAAAD+UvCIBs0MAAAA0lEN3c/jCkiABQf///wNxQYCAgPgDcr4iI0N1v7+/lJJDo+ncvyAjQ/lEtD6SlZJDnYQhv5SSISMMEQsCQCALRAAAAAAAAAAAZQ0AAkAgASAZRw0AICIhICAbmiEkICQgIKAhISAhICChISUgISAloSEmICAgJqEhJyAkICWhISggECEkIByaISUgJSAkoCEgICAgJKEhJiAgICahISkgJCApoSEkICUgJqEhJSAlICSgICGgISQgJCAgoCEhICEgIKEhICAoICegICSgICChISAgICAhoCEkIB8hICAdmiElICUgIKAhISAhICChISYgISAmoSEnICAgJ6EhKCAlICahISkgDyElIB6aISYgJiAloCEgICAgJaEhJyAgICehISogJSAqoSElICYgJ6EhJiAmICWgICGgISUgJSAgoCEhICEgIKEhICApICigICWgICChISAgICAhoCEgQQAhGSAgmiAgICBEAAAAAAAAAABjGyAkmiAkICREAAAAAAAAAABjG6AgF2QNACAKIBiyOAIAQwDAecQhIwwSCyAiISAgA5ohJCAkICCgISEgISAgoSElICEgJaEhJiAgICahIScgJCAloSEoIBAhJCACmiElICUgJKAhICAgICShISYgICAmoSEpICQgKaEhJCAlICahISUgJSAkoCAhoCEkICQgIKAhISAhICChISAgKCAnoCAkoCAgoSEgICAgIaAhJCAfISAgBZohJSAlICCgISEgISAgoSEmICEgJqEhJyAgICehISggJSAmoSEpIA8hJSAEmiEmICYgJaAhICAgICWhIScgICAnoSEqICUgKqEhJSAmICehISYgJiAloCAhoCElICUgIKAhISAhICChISAgKSAooCAloCAgoSEgICAgIaAhIAJAICCaICAgIEQAAAAAAAAAAGMbICSaICQgJEQAAAAAAAAAAGMboCIgIAtmDQAgGQ0AIAAgFWshGSABIBVrIRggDyEeIB8hHSAQIRwgIiEbICAhFwsgASAaRw0AIA8hBCAfIQUgECECICIhAyAAIRogASEVCyASIA2hIQ0gFCANoSEPIBEgDqEhDSATIA2hIQ0gAEECaiEAIBYgAUEBaiIBakEBRw0ACwtDAMB5xCEjIAtEAAAAAAAAAABlDQ4gCkEANgIADA4LIAwgBDkDECAMIAM5AwggDCACOQMAIAwgBTkDGAJAIAFBAUgNACAERAAAAAIAAKBBoiENIA0gBKEhDiANIA6hIQ4gBCAOoSEPIAQgBKIhDSAOIA6iIA2hIRAgECAPIA6iIhGgIQ4gDiARoCEOIA8gD6IgBCAFIAWgoqAgDqAhECAQIA2gIRIgEiANoSETIAJEAAAAAgAAoEGiIQ0gDSACoSEOIA0gDqEhDiACIA6hIQ8gAiACoiENIA4gDqIgDaEhESARIA8gDqIiFKAhDiAOIBSgIQ4gDyAPoiACIAMgA6CioCAOoCEOIA4gDaAhESARIA2hIQ1BACEVQQAgAWshFiAOIA2hIQ0gECAToSEPQQIhAEEBIQFEAAAAAAAAAAAhF0EAIRhBACEZQQEhGiADIRsgAiEcIAUhHSAEIR4DQCAMIAxBEGogESANIBIgDyAGIAcgCCAJEKCAgIAAIAwrAxAiD0QAAAACAACgQaIhDSANIA+hIQ4gDSAOoSEOIA8gDqEhECAPIA+iIQ0gDiAOoiANoSERIBEgECAOoiISoCEOIA4gEqAhDiAQIBCiIA8gDCsDGCIfIB+goqAgDqAhFCAUIA2gIRIgDCsDACIQRAAAAAIAAKBBoiEOIA4gEKEhESAOIBGhIREgECARoSETIBAgEKIhDiARIBGiIA6hISAgICATIBGiIiGgIREgESAhoCERIBMgE6IgECAMKwMIIiIgIqCioCARoCETIBMgDqAhEQJAIBIgEaAiIEQAAAAAgIQuQWUNACABsiAgtrwiAbNDAAAANJRDd3P4wpIgAUH///8DcUGAgID4A3K+IiNDdb+/v5SSQ6Pp3L8gI0P5RLQ+kpWSQwAAAD+UvCIBs0MAAAA0lEN3c/jCkiABQf///wNxQYCAgPgDcr4iI0N1v7+/lJJDo+ncvyAjQ/lEtD6SlZJDAAAAP5STISMMEAsCQCALRAAAAAAAAAAAZQ0AAkAgASAZRw0AICIhICAbmiEkICQgIKAhISAhICChISUgISAloSEmICAgJqEhJyAkICWhISggECEkIByaISUgJSAkoCEgICAgJKEhJiAgICahISkgJCApoSEkICUgJqEhJSAlICSgICGgISQgJCAgoCEhICEgIKEhICAoICegICSgICChISAgICAhoCEkIB8hICAdmiElICUgIKAhISAhICChISYgISAmoSEnICAgJ6EhKCAlICahISkgDyElIB6aISYgJiAloCEgICAgJaEhJyAgICehISogJSAqoSElICYgJ6EhJiAmICWgICGgISUgJSAgoCEhICEgIKEhICApICigICWgICChISAgICAhoCEgQQAhGSAgmiAgICBEAAAAAAAAAABjGyAkmiAkICREAAAAAAAAAABjG6AgF2QNACAKIBiyOAIAQwDAecQhIwwRCyAiISAgA5ohJCAkICCgISEgISAgoSElICEgJaEhJiAgICahIScgJCAloSEoIBAhJCACmiElICUgJKAhICAgICShISYgICAmoSEpICQgKaEhJCAlICahISUgJSAkoCAhoCEkICQgIKAhISAhICChISAgKCAnoCAkoCAgoSEgICAgIaAhJCAfISAgBZohJSAlICCgISEgISAgoSEmICEgJqEhJyAgICehISggJSAmoSEpIA8hJSAEmiEmICYgJaAhICAgICWhIScgICAnoSEqICUgKqEhJSAmICehISYgJiAloCAhoCElICUgIKAhISAhICChISAgKSAooCAloCAgoSEgICAgIaAhIAJAICCaICAgIEQAAAAAAAAAAGMbICSaICQgJEQAAAAAAAAAAGMboCIgIAtmDQAgGQ0AIAAgFWshGSABIBVrIRggDyEeIB8hHSAQIRwgIiEbICAhFwsgASAaRw0AIA8hBCAfIQUgECECICIhAyAAIRogASEVCyASIA2hIQ0gFCANoSEPIBEgDqEhDSATIA2hIQ0gAEECaiEAIBYgAUEBaiIBakEBRw0ACwtDAMB5xCEjIAtEAAAAAAAAAABlDQ0gCkEANgIADA0LIAwgBDkDECAMIAM5AwggDCACOQMAIAwgBTkDGAJAIAFBAUgNACAERAAAAAIAAKBBoiENIA0gBKEhDiANIA6hIQ4gBCAOoSEPIAQgBKIhDSAOIA6iIA2hIRAgECAPIA6iIhGgIQ4gDiARoCEOIA8gD6IgBCAFIAWgoqAgDqAhECAQIA2gIRIgEiANoSETIAJEAAAAAgAAoEGiIQ0gDSACoSEOIA0gDqEhDiACIA6hIQ8gAiACoiENIA4gDqIgDaEhESARIA8gDqIiFKAhDiAOIBSgIQ4gDyAPoiACIAMgA6CioCAOoCEOIA4gDaAhESARIA2hIQ1BACEVQQAgAWshFiAOIA2hIQ0gECAToSEPQQIhAEEBIQFEAAAAAAAAAAAhF0EAIRhBACEZQQEhGiADIRsgAiEcIAUhHSAEIR4DQCAMIAxBEGogESANIBIgDyAGIAcgCCAJEKGAgIAAIAwrAxAiD0QAAAACAACgQaIhDSANIA+hIQ4gDSAOoSEOIA8gDqEhECAPIA+iIQ0gDiAOoiANoSERIBEgECAOoiISoCEOIA4gEqAhDiAQIBCiIA8gDCsDGCIfIB+goqAgDqAhFCAUIA2gIRIgDCsDACIQRAAAAAIAAKBBoiEOIA4gEKEhESAOIBGhIREgECARoSETIBAgEKIhDiARIBGiIA6hISAgICATIBGiIiGgIREgESAhoCERIBMgE6IgECAMKwMIIiIgIqCioCARoCETIBMgDqAhEQJAIBIgEaAiIEQAAAAAgIQuQWUNACABsiAgtrwiAbNDAAAANJRDd3P4wpIgAUH///8DcUGAgID4A3K+IiNDdb+/v5SSQ6Pp3L8gI0P5RLQ+kpWSQwAAAD+UvCIBs0MAAAA0lEN3c/jCkiABQf///wNxQYCAgPgDcr4iI0N1v7+/lJJDo+ncvyAjQ/lEtD6SlZJDo4HcvpSSISMMDwsCQCALRAAAAAAAAAAAZQ0AAkAgASAZRw0AICIhICAbmiEkICQgIKAhISAhICChISUgISAloSEmICAgJqEhJyAkICWhISggECEkIByaISUgJSAkoCEgICAgJKEhJiAgICahISkgJCApoSEkICUgJqEhJSAlICSgICGgISQgJCAgoCEhICEgIKEhICAoICegICSgICChISAgICAhoCEkIB8hICAdmiElICUgIKAhISAhICChISYgISAmoSEnICAgJ6EhKCAlICahISkgDyElIB6aISYgJiAloCEgICAgJaEhJyAgICehISogJSAqoSElICYgJ6EhJiAmICWgICGgISUgJSAgoCEhICEgIKEhICApICigICWgICChISAgICAhoCEgQQAhGSAgmiAgICBEAAAAAAAAAABjGyAkmiAkICREAAAAAAAAAABjG6AgF2QNACAKIBiyOAIAQwDAecQhIwwQCyAiISAgA5ohJCAkICCgISEgISAgoSElICEgJaEhJiAgICahIScgJCAloSEoIBAhJCACmiElICUgJKAhICAgICShISYgICAmoSEpICQgKaEhJCAlICahISUgJSAkoCAhoCEkICQgIKAhISAhICChISAgKCAnoCAkoCAgoSEgICAgIaAhJCAfISAgBZohJSAlICCgISEgISAgoSEmICEgJqEhJyAgICehISggJSAmoSEpIA8hJSAEmiEmICYgJaAhICAgICWhIScgICAnoSEqICUgKqEhJSAmICehISYgJiAloCAhoCElICUgIKAhISAhICChISAgKSAooCAloCAgoSEgICAgIaAhIAJAICCaICAgIEQAAAAAAAAAAGMbICSaICQgJEQAAAAAAAAAAGMboCIgIAtmDQAgGQ0AIAAgFWshGSABIBVrIRggDyEeIB8hHSAQIRwgIiEbICAhFwsgASAaRw0AIA8hBCAfIQUgECECICIhAyAAIRogASEVCyASIA2hIQ0gFCANoSEPIBEgDqEhDSATIA2hIQ0gAEECaiEAIBYgAUEBaiIBakEBRw0ACwtDAMB5xCEjIAtEAAAAAAAAAABlDQwgCkEANgIADAwLIAwgBDkDECAMIAM5AwggDCACOQMAIAwgBTkDGAJAIAFBAUgNACAERAAAAAIAAKBBoiENIA0gBKEhDiANIA6hIQ4gBCAOoSEPIAQgBKIhDSAOIA6iIA2hIRAgECAPIA6iIhGgIQ4gDiARoCEOIA8gD6IgBCAFIAWgoqAgDqAhECAQIA2gIRIgEiANoSETIAJEAAAAAgAAoEGiIQ0gDSACoSEOIA0gDqEhDiACIA6hIQ8gAiACoiENIA4gDqIgDaEhESARIA8gDqIiFKAhDiAOIBSgIQ4gDyAPoiACIAMgA6CioCAOoCEOIA4gDaAhESARIA2hIQ1BACEVQQAgAWshFiAOIA2hIQ0gECAToSEPQQIhAEEBIQFEAAAAAAAAAAAhF0EAIRhBACEZQQEhGiADIRsgAiEcIAUhHSAEIR4DQCAMIAxBEGogESANIBIgDyAGIAcgCCAJEKKAgIAAIAwrAxAiD0QAAAACAACgQaIhDSANIA+hIQ4gDSAOoSEOIA8gDqEhECAPIA+iIQ0gDiAOoiANoSERIBEgECAOoiISoCEOIA4gEqAhDiAQIBCiIA8gDCsDGCIfIB+goqAgDqAhFCAUIA2gIRIgDCsDACIQRAAAAAIAAKBBoiEOIA4gEKEhESAOIBGhIREgECARoSETIBAgEKIhDiARIBGiIA6hISAgICATIBGiIiGgIREgESAhoCERIBMgE6IgECAMKwMIIiIgIqCioCARoCETIBMgDqAhEQJAIBIgEaAiIEQAAAAAgIQuQWUNACABsiAgtrwiAbNDAAAANJRDd3P4wpIgAUH///8DcUGAgID4A3K+IiNDdb+/v5SSQ6Pp3L8gI0P5RLQ+kpWSQwAAAD+UvCIBs0MAAAA0lEN3c/jCkiABQf///wNxQYCAgPgDcr4iI0N1v7+/lJJDo+ncvyAjQ/lEtD6SlZJDkhHGvpSSISMMDgsCQCALRAAAAAAAAAAAZQ0AAkAgASAZRw0AICIhICAbmiEkICQgIKAhISAhICChISUgISAloSEmICAgJqEhJyAkICWhISggECEkIByaISUgJSAkoCEgICAgJKEhJiAgICahISkgJCApoSEkICUgJqEhJSAlICSgICGgISQgJCAgoCEhICEgIKEhICAoICegICSgICChISAgICAhoCEkIB8hICAdmiElICUgIKAhISAhICChISYgISAmoSEnICAgJ6EhKCAlICahISkgDyElIB6aISYgJiAloCEgICAgJaEhJyAgICehISogJSAqoSElICYgJ6EhJiAmICWgICGgISUgJSAgoCEhICEgIKEhICApICigICWgICChISAgICAhoCEgQQAhGSAgmiAgICBEAAAAAAAAAABjGyAkmiAkICREAAAAAAAAAABjG6AgF2QNACAKIBiyOAIAQwDAecQhIwwPCyAiISAgA5ohJCAkICCgISEgISAgoSElICEgJaEhJiAgICahIScgJCAloSEoIBAhJCACmiElICUgJKAhICAgICShISYgICAmoSEpICQgKaEhJCAlICahISUgJSAkoCAhoCEkICQgIKAhISAhICChISAgKCAnoCAkoCAgoSEgICAgIaAhJCAfISAgBZohJSAlICCgISEgISAgoSEmICEgJqEhJyAgICehISggJSAmoSEpIA8hJSAEmiEmICYgJaAhICAgICWhIScgICAnoSEqICUgKqEhJSAmICehISYgJiAloCAhoCElICUgIKAhISAhICChISAgKSAooCAloCAgoSEgICAgIaAhIAJAICCaICAgIEQAAAAAAAAAAGMbICSaICQgJEQAAAAAAAAAAGMboCIgIAtmDQAgGQ0AIAAgFWshGSABIBVrIRggDyEeIB8hHSAQIRwgIiEbICAhFwsgASAaRw0AIA8hBCAfIQUgECECICIhAyAAIRogASEVCyASIA2hIQ0gFCANoSEPIBEgDqEhDSATIA2hIQ0gAEECaiEAIBYgAUEBaiIBakEBRw0ACwtDAMB5xCEjIAtEAAAAAAAAAABlDQsgCkEANgIADAsLIAwgBDkDECAMIAM5AwggDCACOQMAIAwgBTkDGAJAIAFBAUgNACAERAAAAAIAAKBBoiENIA0gBKEhDiANIA6hIQ4gBCAOoSEPIAQgBKIhDSAOIA6iIA2hIRAgECAPIA6iIhGgIQ4gDiARoCEOIA8gD6IgBCAFIAWgoqAgDqAhECAQIA2gIRIgEiANoSETIAJEAAAAAgAAoEGiIQ0gDSACoSEOIA0gDqEhDiACIA6hIQ8gAiACoiENIA4gDqIgDaEhESARIA8gDqIiFKAhDiAOIBSgIQ4gDyAPoiACIAMgA6CioCAOoCEOIA4gDaAhESARIA2hIQ1BACEVQQAgAWshFiAOIA2hIQ0gECAToSEPQQIhAEEBIQFEAAAAAAAAAAAhF0EAIRhBACEZQQEhGiADIRsgAiEcIAUhHSAEIR4DQCAMIAxBEGogESANIBIgDyAGIAcgCCAJEKOAgIAAIAwrAxAiD0QAAAACAACgQaIhDSANIA+hIQ4gDSAOoSEOIA8gDqEhECAPIA+iIQ0gDiAOoiANoSERIBEgECAOoiISoCEOIA4gEqAhDiAQIBCiIA8gDCsDGCIfIB+goqAgDqAhFCAUIA2gIRIgDCsDACIQRAAAAAIAAKBBoiEOIA4gEKEhESAOIBGhIREgECARoSETIBAgEKIhDiARIBGiIA6hISAgICATIBGiIiGgIREgESAhoCERIBMgE6IgECAMKwMIIiIgIqCioCARoCETIBMgDqAhEQJAIBIgEaAiIEQAAAAAgIQuQWUNACABsiAgtrwiAbNDAAAANJRDd3P4wpIgAUH///8DcUGAgID4A3K+IiNDdb+/v5SSQ6Pp3L8gI0P5RLQ+kpWSQwAAAD+UvCIBs0MAAAA0lEN3c/jCkiABQf///wNxQYCAgPgDcr4iI0N1v7+/lJJDo+ncvyAjQ/lEtD6SlZJDymC2vpSSISMMDQsCQCALRAAAAAAAAAAAZQ0AAkAgASAZRw0AICIhICAbmiEkICQgIKAhISAhICChISUgISAloSEmICAgJqEhJyAkICWhISggECEkIByaISUgJSAkoCEgICAgJKEhJiAgICahISkgJCApoSEkICUgJqEhJSAlICSgICGgISQgJCAgoCEhICEgIKEhICAoICegICSgICChISAgICAhoCEkIB8hICAdmiElICUgIKAhISAhICChISYgISAmoSEnICAgJ6EhKCAlICahISkgDyElIB6aISYgJiAloCEgICAgJaEhJyAgICehISogJSAqoSElICYgJ6EhJiAmICWgICGgISUgJSAgoCEhICEgIKEhICApICigICWgICChISAgICAhoCEgQQAhGSAgmiAgICBEAAAAAAAAAABjGyAkmiAkICREAAAAAAAAAABjG6AgF2QNACAKIBiyOAIAQwDAecQhIwwOCyAiISAgA5ohJCAkICCgISEgISAgoSElICEgJaEhJiAgICahIScgJCAloSEoIBAhJCACmiElICUgJKAhICAgICShISYgICAmoSEpICQgKaEhJCAlICahISUgJSAkoCAhoCEkICQgIKAhISAhICChISAgKCAnoCAkoCAgoSEgICAgIaAhJCAfISAgBZohJSAlICCgISEgISAgoSEmICEgJqEhJyAgICehISggJSAmoSEpIA8hJSAEmiEmICYgJaAhICAgICWhIScgICAnoSEqICUgKqEhJSAmICehISYgJiAloCAhoCElICUgIKAhISAhICChISAgKSAooCAloCAgoSEgICAgIaAhIAJAICCaICAgIEQAAAAAAAAAAGMbICSaICQgJEQAAAAAAAAAAGMboCIgIAtmDQAgGQ0AIAAgFWshGSABIBVrIRggDyEeIB8hHSAQIRwgIiEbICAhFwsgASAaRw0AIA8hBCAfIQUgECECICIhAyAAIRogASEVCyASIA2hIQ0gFCANoSEPIBEgDqEhDSATIA2hIQ0gAEECaiEAIBYgAUEBaiIBakEBRw0ACwtDAMB5xCEjIAtEAAAAAAAAAABlDQogCkEANgIADAoLIAwgBDkDECAMIAM5AwggDCACOQMAIAwgBTkDGAJAIAFBAUgNACAERAAAAAIAAKBBoiENIA0gBKEhDiANIA6hIQ4gBCAOoSEPIAQgBKIhDSAOIA6iIA2hIRAgECAPIA6iIhGgIQ4gDiARoCEOIA8gD6IgBCAFIAWgoqAgDqAhECAQIA2gIRIgEiANoSETIAJEAAAAAgAAoEGiIQ0gDSACoSEOIA0gDqEhDiACIA6hIQ8gAiACoiENIA4gDqIgDaEhESARIA8gDqIiFKAhDiAOIBSgIQ4gDyAPoiACIAMgA6CioCAOoCEOIA4gDaAhESARIA2hIQ1BACEVQQAgAWshFiAOIA2hIQ0gECAToSEPQQIhAEEBIQFEAAAAAAAAAAAhF0EAIRhBACEZQQEhGiADIRsgAiEcIAUhHSAEIR4DQCAMIAxBEGogESANIBIgDyAGIAcgCCAJEKSAgIAAIAwrAxAiD0QAAAACAACgQaIhDSANIA+hIQ4gDSAOoSEOIA8gDqEhECAPIA+iIQ0gDiAOoiANoSERIBEgECAOoiISoCEOIA4gEqAhDiAQIBCiIA8gDCsDGCIfIB+goqAgDqAhFCAUIA2gIRIgDCsDACIQRAAAAAIAAKBBoiEOIA4gEKEhESAOIBGhIREgECARoSETIBAgEKIhDiARIBGiIA6hISAgICATIBGiIiGgIREgESAhoCERIBMgE6IgECAMKwMIIiIgIqCioCARoCETIBMgDqAhEQJAIBIgEaAiIEQAAAAAgIQuQWUNACABskN3c/hCkiAgtrwiAbNDAAAANJRDd3P4wpIgAUH///8DcUGAgID4A3K+IiNDdb+/v5SSQ6Pp3L8gI0P5RLQ+kpWSQwAAAD+UvCIBs0MAAAC0lJIgAUH///8DcUGAgID4A3K+IiNDdb+/P5SSQ6Pp3D8gI0P5RLQ+kpWSISMMDAsCQCALRAAAAAAAAAAAZQ0AAkAgASAZRw0AICIhICAbmiEkICQgIKAhISAhICChISUgISAloSEmICAgJqEhJyAkICWhISggECEkIByaISUgJSAkoCEgICAgJKEhJiAgICahISkgJCApoSEkICUgJqEhJSAlICSgICGgISQgJCAgoCEhICEgIKEhICAoICegICSgICChISAgICAhoCEkIB8hICAdmiElICUgIKAhISAhICChISYgISAmoSEnICAgJ6EhKCAlICahISkgDyElIB6aISYgJiAloCEgICAgJaEhJyAgICehISogJSAqoSElICYgJ6EhJiAmICWgICGgISUgJSAgoCEhICEgIKEhICApICigICWgICChISAgICAhoCEgQQAhGSAgmiAgICBEAAAAAAAAAABjGyAkmiAkICREAAAAAAAAAABjG6AgF2QNACAKIBiyOAIAQwDAecQhIwwNCyAiISAgA5ohJCAkICCgISEgISAgoSElICEgJaEhJiAgICahIScgJCAloSEoIBAhJCACmiElICUgJKAhICAgICShISYgICAmoSEpICQgKaEhJCAlICahISUgJSAkoCAhoCEkICQgIKAhISAhICChISAgKCAnoCAkoCAgoSEgICAgIaAhJCAfISAgBZohJSAlICCgISEgISAgoSEmICEgJqEhJyAgICehISggJSAmoSEpIA8hJSAEmiEmICYgJaAhICAgICWhIScgICAnoSEqICUgKqEhJSAmICehISYgJiAloCAhoCElICUgIKAhISAhICChISAgKSAooCAloCAgoSEgICAgIaAhIAJAICCaICAgIEQAAAAAAAAAAGMbICSaICQgJEQAAAAAAAAAAGMboCIgIAtmDQAgGQ0AIAAgFWshGSABIBVrIRggDyEeIB8hHSAQIRwgIiEbICAhFwsgASAaRw0AIA8hBCAfIQUgECECICIhAyAAIRogASEVCyASIA2hIQ0gFCANoSEPIBEgDqEhDSATIA2hIQ0gAEECaiEAIBYgAUEBaiIBakEBRw0ACwtDAMB5xCEjIAtEAAAAAAAAAABlDQkgCkEANgIADAkLIAwgBDkDECAMIAM5AwggDCACOQMAIAwgBTkDGAJAIAFBAUgNACAERAAAAAIAAKBBoiENIA0gBKEhDiANIA6hIQ4gBCAOoSEPIAQgBKIhDSAOIA6iIA2hIRAgECAPIA6iIhGgIQ4gDiARoCEOIA8gD6IgBCAFIAWgoqAgDqAhECAQIA2gIRIgEiANoSETIAJEAAAAAgAAoEGiIQ0gDSACoSEOIA0gDqEhDiACIA6hIQ8gAiACoiENIA4gDqIgDaEhESARIA8gDqIiFKAhDiAOIBSgIQ4gDyAPoiACIAMgA6CioCAOoCEOIA4gDaAhESARIA2hIQ1BACEVQQAgAWshFiAOIA2hIQ0gECAToSEPQQIhAEEBIQFEAAAAAAAAAAAhF0EAIRhBACEZQQEhGiADIRsgAiEcIAUhHSAEIR4DQCAMIAxBEGogESANIBIgDyAGIAcgCCAJEKWAgIAAIAwrAxAiD0QAAAACAACgQaIhDSANIA+hIQ4gDSAOoSEOIA8gDqEhECAPIA+iIQ0gDiAOoiANoSERIBEgECAOoiISoCEOIA4gEqAhDiAQIBCiIA8gDCsDGCIfIB+goqAgDqAhFCAUIA2gIRIgDCsDACIQRAAAAAIAAKBBoiEOIA4gEKEhESAOIBGhIREgECARoSETIBAgEKIhDiARIBGiIA6hISAgICATIBGiIiGgIREgESAhoCERIBMgE6IgECAMKwMIIiIgIqCioCARoCETIBMgDqAhEQJAIBIgEaAiIEQAAAAAgIQuQWUNACABsiAgtrwiAbNDAAAANJRDd3P4wpIgAUH///8DcUGAgID4A3K+IiNDdb+/v5SSQ6Pp3L8gI0P5RLQ+kpWSQwAAAD+UvCIBs0MAAAA0lEN3c/jCkiABQf///wNxQYCAgPgDcr4iI0N1v7+/lJJDo+ncvyAjQ/lEtD6SlZJDnYQhv5SSISMMCwsCQCALRAAAAAAAAAAAZQ0AAkAgASAZRw0AICIhICAbmiEkICQgIKAhISAhICChISUgISAloSEmICAgJqEhJyAkICWhISggECEkIByaISUgJSAkoCEgICAgJKEhJiAgICahISkgJCApoSEkICUgJqEhJSAlICSgICGgISQgJCAgoCEhICEgIKEhICAoICegICSgICChISAgICAhoCEkIB8hICAdmiElICUgIKAhISAhICChISYgISAmoSEnICAgJ6EhKCAlICahISkgDyElIB6aISYgJiAloCEgICAgJaEhJyAgICehISogJSAqoSElICYgJ6EhJiAmICWgICGgISUgJSAgoCEhICEgIKEhICApICigICWgICChISAgICAhoCEgQQAhGSAgmiAgICBEAAAAAAAAAABjGyAkmiAkICREAAAAAAAAAABjG6AgF2QNACAKIBiyOAIAQwDAecQhIwwMCyAiISAgA5ohJCAkICCgISEgISAgoSElICEgJaEhJiAgICahIScgJCAloSEoIBAhJCACmiElICUgJKAhICAgICShISYgICAmoSEpICQgKaEhJCAlICahISUgJSAkoCAhoCEkICQgIKAhISAhICChISAgKCAnoCAkoCAgoSEgICAgIaAhJCAfISAgBZohJSAlICCgISEgISAgoSEmICEgJqEhJyAgICehISggJSAmoSEpIA8hJSAEmiEmICYgJaAhICAgICWhIScgICAnoSEqICUgKqEhJSAmICehISYgJiAloCAhoCElICUgIKAhISAhICChISAgKSAooCAloCAgoSEgICAgIaAhIAJAICCaICAgIEQAAAAAAAAAAGMbICSaICQgJEQAAAAAAAAAAGMboCIgIAtmDQAgGQ0AIAAgFWshGSABIBVrIRggDyEeIB8hHSAQIRwgIiEbICAhFwsgASAaRw0AIA8hBCAfIQUgECECICIhAyAAIRogASEVCyASIA2hIQ0gFCANoSEPIBEgDqEhDSATIA2hIQ0gAEECaiEAIBYgAUEBaiIBakEBRw0ACwtDAMB5xCEjIAtEAAAAAAAAAABlDQggCkEANgIADAgLIAwgBDkDECAMIAM5AwggDCACOQMAIAwgBTkDGAJAIAFBAUgNACAERAAAAAIAAKBBoiENIA0gBKEhDiANIA6hIQ4gBCAOoSEPIAQgBKIhDSAOIA6iIA2hIRAgECAPIA6iIhGgIQ4gDiARoCEOIA8gD6IgBCAFIAWgoqAgDqAhECAQIA2gIRIgEiANoSETIAJEAAAAAgAAoEGiIQ0gDSACoSEOIA0gDqEhDiACIA6hIQ8gAiACoiENIA4gDqIgDaEhESARIA8gDqIiFKAhDiAOIBSgIQ4gDyAPoiACIAMgA6CioCAOoCEOIA4gDaAhESARIA2hIQ1BACEVQQAgAWshFiAOIA2hIQ0gECAToSEPQQIhAEEBIQFEAAAAAAAAAAAhF0EAIRhBACEZQQEhGiADIRsgAiEcIAUhHSAEIR4DQCAMIAxBEGogESANIBIgDyAGIAcgCCAJEKaAgIAAIAwrAxAiD0QAAAACAACgQaIhDSANIA+hIQ4gDSAOoSEOIA8gDqEhECAPIA+iIQ0gDiAOoiANoSERIBEgECAOoiISoCEOIA4gEqAhDiAQIBCiIA8gDCsDGCIfIB+goqAgDqAhFCAUIA2gIRIgDCsDACIQRAAAAAIAAKBBoiEOIA4gEKEhESAOIBGhIREgECARoSETIBAgEKIhDiARIBGiIA6hISAgICATIBGiIiGgIREgESAhoCERIBMgE6IgECAMKwMIIiIgIqCioCARoCETIBMgDqAhEQJAIBIgEaAiIEQAAAAAgIQuQWUNACABsiAgtrwiAbNDAAAANJRDd3P4wpIgAUH///8DcUGAgID4A3K+IiNDdb+/v5SSQ6Pp3L8gI0P5RLQ+kpWSQwAAAD+UvCIBs0MAAAA0lEN3c/jCkiABQf///wNxQYCAgPgDcr4iI0N1v7+/lJJDo+ncvyAjQ/lEtD6SlZJDAAAAP5STISMMCgsCQCALRAAAAAAAAAAAZQ0AAkAgASAZRw0AICIhICAbmiEkICQgIKAhISAhICChISUgISAloSEmICAgJqEhJyAkICWhISggECEkIByaISUgJSAkoCEgICAgJKEhJiAgICahISkgJCApoSEkICUgJqEhJSAlICSgICGgISQgJCAgoCEhICEgIKEhICAoICegICSgICChISAgICAhoCEkIB8hICAdmiElICUgIKAhISAhICChISYgISAmoSEnICAgJ6EhKCAlICahISkgDyElIB6aISYgJiAloCEgICAgJaEhJyAgICehISogJSAqoSElICYgJ6EhJiAmICWgICGgISUgJSAgoCEhICEgIKEhICApICigICWgICChISAgICAhoCEgQQAhGSAgmiAgICBEAAAAAAAAAABjGyAkmiAkICREAAAAAAAAAABjG6AgF2QNACAKIBiyOAIAQwDAecQhIwwLCyAiISAgA5ohJCAkICCgISEgISAgoSElICEgJaEhJiAgICahIScgJCAloSEoIBAhJCACmiElICUgJKAhICAgICShISYgICAmoSEpICQgKaEhJCAlICahISUgJSAkoCAhoCEkICQgIKAhISAhICChISAgKCAnoCAkoCAgoSEgICAgIaAhJCAfISAgBZohJSAlICCgISEgISAgoSEmICEgJqEhJyAgICehISggJSAmoSEpIA8hJSAEmiEmICYgJaAhICAgICWhIScgICAnoSEqICUgKqEhJSAmICehISYgJiAloCAhoCElICUgIKAhISAhICChISAgKSAooCAloCAgoSEgICAgIaAhIAJAICCaICAgIEQAAAAAAAAAAGMbICSaICQgJEQAAAAAAAAAAGMboCIgIAtmDQAgGQ0AIAAgFWshGSABIBVrIRggDyEeIB8hHSAQIRwgIiEbICAhFwsgASAaRw0AIA8hBCAfIQUgECECICIhAyAAIRogASEVCyASIA2hIQ0gFCANoSEPIBEgDqEhDSATIA2hIQ0gAEECaiEAIBYgAUEBaiIBakEBRw0ACwtDAMB5xCEjIAtEAAAAAAAAAABlDQcgCkEANgIADAcLIAwgBDkDECAMIAM5AwggDCACOQMAIAwgBTkDGAJAIAFBAUgNACAERAAAAAIAAKBBoiENIA0gBKEhDiANIA6hIQ4gBCAOoSEPIAQgBKIhDSAOIA6iIA2hIRAgECAPIA6iIhGgIQ4gDiARoCEOIA8gD6IgBCAFIAWgoqAgDqAhECAQIA2gIRIgEiANoSETIAJEAAAAAgAAoEGiIQ0gDSACoSEOIA0gDqEhDiACIA6hIQ8gAiACoiENIA4gDqIgDaEhESARIA8gDqIiFKAhDiAOIBSgIQ4gDyAPoiACIAMgA6CioCAOoCEOIA4gDaAhESARIA2hIQ1BACEVQQAgAWshFiAOIA2hIQ0gECAToSEPQQIhAEEBIQFEAAAAAAAAAAAhF0EAIRhBACEZQQEhGiADIRsgAiEcIAUhHSAEIR4DQCAMIAxBEGogESANIBIgDyAGIAcgCCAJEKeAgIAAIAwrAxAiD0QAAAACAACgQaIhDSANIA+hIQ4gDSAOoSEOIA8gDqEhECAPIA+iIQ0gDiAOoiANoSERIBEgECAOoiISoCEOIA4gEqAhDiAQIBCiIA8gDCsDGCIfIB+goqAgDqAhFCAUIA2gIRIgDCsDACIQRAAAAAIAAKBBoiEOIA4gEKEhESAOIBGhIREgECARoSETIBAgEKIhDiARIBGiIA6hISAgICATIBGiIiGgIREgESAhoCERIBMgE6IgECAMKwMIIiIgIqCioCARoCETIBMgDqAhEQJAIBIgEaAiIEQAAAAAgIQuQWUNACABskN3c/hCkiAgtrwiAbNDAAAANJRDd3P4wpIgAUH///8DcUGAgID4A3K+IiNDdb+/v5SSQ6Pp3L8gI0P5RLQ+kpWSQwAAAD+UvCIBs0MAAAC0lJIgAUH///8DcUGAgID4A3K+IiNDdb+/P5SSQ6Pp3D8gI0P5RLQ+kpWSISMMCQsCQCALRAAAAAAAAAAAZQ0AAkAgASAZRw0AICIhICAbmiEkICQgIKAhISAhICChISUgISAloSEmICAgJqEhJyAkICWhISggECEkIByaISUgJSAkoCEgICAgJKEhJiAgICahISkgJCApoSEkICUgJqEhJSAlICSgICGgISQgJCAgoCEhICEgIKEhICAoICegICSgICChISAgICAhoCEkIB8hICAdmiElICUgIKAhISAhICChISYgISAmoSEnICAgJ6EhKCAlICahISkgDyElIB6aISYgJiAloCEgICAgJaEhJyAgICehISogJSAqoSElICYgJ6EhJiAmICWgICGgISUgJSAgoCEhICEgIKEhICApICigICWgICChISAgICAhoCEgQQAhGSAgmiAgICBEAAAAAAAAAABjGyAkmiAkICREAAAAAAAAAABjG6AgF2QNACAKIBiyOAIAQwDAecQhIwwKCyAiISAgA5ohJCAkICCgISEgISAgoSElICEgJaEhJiAgICahIScgJCAloSEoIBAhJCACmiElICUgJKAhICAgICShISYgICAmoSEpICQgKaEhJCAlICahISUgJSAkoCAhoCEkICQgIKAhISAhICChISAgKCAnoCAkoCAgoSEgICAgIaAhJCAfISAgBZohJSAlICCgISEgISAgoSEmICEgJqEhJyAgICehISggJSAmoSEpIA8hJSAEmiEmICYgJaAhICAgICWhIScgICAnoSEqICUgKqEhJSAmICehISYgJiAloCAhoCElICUgIKAhISAhICChISAgKSAooCAloCAgoSEgICAgIaAhIAJAICCaICAgIEQAAAAAAAAAAGMbICSaICQgJEQAAAAAAAAAAGMboCIgIAtmDQAgGQ0AIAAgFWshGSABIBVrIRggDyEeIB8hHSAQIRwgIiEbICAhFwsgASAaRw0AIA8hBCAfIQUgECECICIhAyAAIRogASEVCyASIA2hIQ0gFCANoSEPIBEgDqEhDSATIA2hIQ0gAEECaiEAIBYgAUEBaiIBakEBRw0ACwtDAMB5xCEjIAtEAAAAAAAAAABlDQYgCkEANgIADAYLIAwgBZoiJjkDGCAMIASaIic5AxAgDCADmiADIAJEAAAAAAAAAABjIgAbIiU5AwggDCACmiACIAAbIiQ5AwACQCABQQFIDQAgJEQAAAACAACgQaIhAiACICShIQQgAiAEoSEEICQgBKEhAyAkICSiIQIgBCAEoiACoSEFIAUgAyAEoiINoCEEIAQgDaAhBCADIAOiICQgJSAloKKgIASgIQQgBCACoCEOIA4gAqEhAkEAIRVBACABayEWIAQgAqEhAkECIQBBASEBRAAAAAAAAAAAIShBACEYQQAhGUEBIRogJSEpICQhKiAnIRcgJiEbA0AgDCAMQRBqIA4gAiAGIAcgCCAJEKiAgIAAIAwrAwAiBEQAAAACAACgQaIhAiACIAShIQMgAiADoSEDIAQgA6EhBSAEIASiIQIgAyADoiACoSENIA0gBSADoiIOoCEDIAMgDqAhAyAFIAWiIAQgDCsDCCISIBKgoqAgA6AhECAQIAKgIQ4gDCsDECIDRAAAAAIAAKBBoiEFIAUgA6EhDSAFIA2hIQUgAyAFoSEPIAMgA6IhDSAFIAWiIA2hIREgESAPIAWiIhOgIQUgBSAToCEFIA8gD6IgAyAMKwMYIg8gD6CioCAFoCEFIAUgDaAhBQJAIAUgDqAiBUQAAAAAgIQuQWUNACABskN3c/hCkiAFtrwiAbNDAAAANJRDd3P4wpIgAUH///8DcUGAgID4A3K+IiNDdb+/v5SSQ6Pp3L8gI0P5RLQ+kpWSQwAAAD+UvCIBs0MAAAC0lJIgAUH///8DcUGAgID4A3K+IiNDdb+/P5SSQ6Pp3D8gI0P5RLQ+kpWSISMMCAsCQCALRAAAAAAAAAAAZQ0AAkAgASAZRw0AIBIhBSApmiERIBEgBaAhDSANIAWhIRMgDSAToSEUIAUgFKEhICARIBOhISEgBCERICqaIRMgEyARoCEFIAUgEaEhFCAFIBShIR8gESAfoSERIBMgFKEhEyATIBGgIA2gIREgESAFoCENIA0gBaEhBSAhICCgIBGgIAWhIQUgBSANoCERIA8hBSAbmiETIBMgBaAhDSANIAWhIRQgDSAUoSEgIAUgIKEhISATIBShIR8gAyETIBeaIRQgFCAToCEFIAUgE6EhICAFICChISIgEyAioSETIBQgIKEhFCAUIBOgIA2gIRMgEyAFoCENIA0gBaEhBSAfICGgIBOgIAWhIQUgBSANoCEFQQAhGSAFmiAFIAVEAAAAAAAAAABjGyARmiARIBFEAAAAAAAAAABjG6AgKGQNACAKIBiyOAIAQwDAecQhIwwJCyASIQUgJZohESARIAWgIQ0gDSAFoSETIA0gE6EhFCAFIBShISAgESAToSEhIAQhESAkmiETIBMgEaAhBSAFIBGhIRQgBSAUoSEfIBEgH6EhESATIBShIRMgEyARoCANoCERIBEgBaAhDSANIAWhIQUgISAgoCARoCAFoSEFIAUgDaAhESAPIQUgJpohEyATIAWgIQ0gDSAFoSEUIA0gFKEhICAFICChISEgEyAUoSEfIAMhEyAnmiEUIBQgE6AhBSAFIBOhISAgBSAgoSEiIBMgIqEhEyAUICChIRQgFCAToCANoCETIBMgBaAhDSANIAWhIQUgHyAhoCAToCAFoSEFIAUgDaAhBQJAIAWaIAUgBUQAAAAAAAAAAGMbIBGaIBEgEUQAAAAAAAAAAGMboCIFIAtmDQAgGQ0AIAAgFWshGSABIBVrIRggDyEbIAMhFyAEISogEiEpIAUhKAsgASAaRw0AIAMhJyAPISYgBCEkIBIhJSAAIRogASEVCyAOIAKhIQIgECACoSECIABBAmohACAWIAFBAWoiAWpBAUcNAAsLQwDAecQhIyALRAAAAAAAAAAAZQ0FIApBADYCAAwFCyAMIAQ5AxAgDCADOQMIIAwgAjkDACAMIAU5AxgCQCABQQFIDQAgBEQAAAACAACgQaIhDSANIAShIQ4gDSAOoSEOIAQgDqEhDyAEIASiIQ0gDiAOoiANoSEQIBAgDyAOoiIRoCEOIA4gEaAhDiAPIA+iIAQgBSAFoKKgIA6gIRAgECANoCESIBIgDaEhEyACRAAAAAIAAKBBoiENIA0gAqEhDiANIA6hIQ4gAiAOoSEPIAIgAqIhDSAOIA6iIA2hIREgESAPIA6iIhSgIQ4gDiAUoCEOIA8gD6IgAiADIAOgoqAgDqAhDiAOIA2gIREgESANoSENQQAhFUEAIAFrIRYgDiANoSENIBAgE6EhD0ECIQBBASEBRAAAAAAAAAAAIRdBACEYQQAhGUEBIRogAyEbIAIhHCAFIR0gBCEeA0AgDCAMQRBqIBEgDSASIA8gBiAHIAggCRCpgICAACAMKwMQIg9EAAAAAgAAoEGiIQ0gDSAPoSEOIA0gDqEhDiAPIA6hIRAgDyAPoiENIA4gDqIgDaEhESARIBAgDqIiEqAhDiAOIBKgIQ4gECAQoiAPIAwrAxgiHyAfoKKgIA6gIRQgFCANoCESIAwrAwAiEEQAAAACAACgQaIhDiAOIBChIREgDiARoSERIBAgEaEhEyAQIBCiIQ4gESARoiAOoSEgICAgEyARoiIhoCERIBEgIaAhESATIBOiIBAgDCsDCCIiICKgoqAgEaAhEyATIA6gIRECQCASIBGgIiBEAAAAAICELkFlDQAgAbJDd3P4QpIgILa8IgGzQwAAADSUQ3dz+MKSIAFB////A3FBgICA+ANyviIjQ3W/v7+UkkOj6dy/ICND+US0PpKVkkMAAAA/lLwiAbNDAAAAtJSSIAFB////A3FBgICA+ANyviIjQ3W/vz+UkkOj6dw/ICND+US0PpKVkiEjDAcLAkAgC0QAAAAAAAAAAGUNAAJAIAEgGUcNACAiISAgG5ohJCAkICCgISEgISAgoSElICEgJaEhJiAgICahIScgJCAloSEoIBAhJCAcmiElICUgJKAhICAgICShISYgICAmoSEpICQgKaEhJCAlICahISUgJSAkoCAhoCEkICQgIKAhISAhICChISAgKCAnoCAkoCAgoSEgICAgIaAhJCAfISAgHZohJSAlICCgISEgISAgoSEmICEgJqEhJyAgICehISggJSAmoSEpIA8hJSAemiEmICYgJaAhICAgICWhIScgICAnoSEqICUgKqEhJSAmICehISYgJiAloCAhoCElICUgIKAhISAhICChISAgKSAooCAloCAgoSEgICAgIaAhIEEAIRkgIJogICAgRAAAAAAAAAAAYxsgJJogJCAkRAAAAAAAAAAAYxugIBdkDQAgCiAYsjgCAEMAwHnEISMMCAsgIiEgIAOaISQgJCAgoCEhICEgIKEhJSAhICWhISYgICAmoSEnICQgJaEhKCAQISQgApohJSAlICSgISAgICAkoSEmICAgJqEhKSAkICmhISQgJSAmoSElICUgJKAgIaAhJCAkICCgISEgISAgoSEgICggJ6AgJKAgIKEhICAgICGgISQgHyEgIAWaISUgJSAgoCEhICEgIKEhJiAhICahIScgICAnoSEoICUgJqEhKSAPISUgBJohJiAmICWgISAgICAloSEnICAgJ6EhKiAlICqhISUgJiAnoSEmICYgJaAgIaAhJSAlICCgISEgISAgoSEgICkgKKAgJaAgIKEhICAgICGgISACQCAgmiAgICBEAAAAAAAAAABjGyAkmiAkICREAAAAAAAAAABjG6AiICALZg0AIBkNACAAIBVrIRkgASAVayEYIA8hHiAfIR0gECEcICIhGyAgIRcLIAEgGkcNACAPIQQgHyEFIBAhAiAiIQMgACEaIAEhFQsgEiANoSENIBQgDaEhDyARIA6hIQ0gEyANoSENIABBAmohACAWIAFBAWoiAWpBAUcNAAsLQwDAecQhIyALRAAAAAAAAAAAZQ0EIApBADYCAAwECyAMIAQ5AxAgDCADOQMIIAwgAjkDACAMIAU5AxgCQCABQQFIDQAgBEQAAAACAACgQaIhDSANIAShIQ4gDSAOoSEOIAQgDqEhDyAEIASiIQ0gDiAOoiANoSEQIBAgDyAOoiIRoCEOIA4gEaAhDiAPIA+iIAQgBSAFoKKgIA6gIRAgECANoCESIBIgDaEhEyACRAAAAAIAAKBBoiENIA0gAqEhDiANIA6hIQ4gAiAOoSEPIAIgAqIhDSAOIA6iIA2hIREgESAPIA6iIhSgIQ4gDiAUoCEOIA8gD6IgAiADIAOgoqAgDqAhDiAOIA2gIREgESANoSENQQAhFUEAIAFrIRYgDiANoSENIBAgE6EhD0ECIQBBASEBRAAAAAAAAAAAIRdBACEYQQAhGUEBIRogAyEbIAIhHCAFIR0gBCEeA0AgDCAMQRBqIBEgDSASIA8gBiAHIAggCRCqgICAACAMKwMQIg9EAAAAAgAAoEGiIQ0gDSAPoSEOIA0gDqEhDiAPIA6hIRAgDyAPoiENIA4gDqIgDaEhESARIBAgDqIiEqAhDiAOIBKgIQ4gECAQoiAPIAwrAxgiHyAfoKKgIA6gIRQgFCANoCESIAwrAwAiEEQAAAACAACgQaIhDiAOIBChIREgDiARoSERIBAgEaEhEyAQIBCiIQ4gESARoiAOoSEgICAgEyARoiIhoCERIBEgIaAhESATIBOiIBAgDCsDCCIiICKgoqAgEaAhEyATIA6gIRECQCASIBGgIiBEAAAAAICELkFlDQAgAbJDd3P4QpIgILa8IgGzQwAAADSUQ3dz+MKSIAFB////A3FBgICA+ANyviIjQ3W/v7+UkkOj6dy/ICND+US0PpKVkkMAAAA/lLwiAbNDAAAAtJSSIAFB////A3FBgICA+ANyviIjQ3W/vz+UkkOj6dw/ICND+US0PpKVkiEjDAYLAkAgC0QAAAAAAAAAAGUNAAJAIAEgGUcNACAiISAgG5ohJCAkICCgISEgISAgoSElICEgJaEhJiAgICahIScgJCAloSEoIBAhJCAcmiElICUgJKAhICAgICShISYgICAmoSEpICQgKaEhJCAlICahISUgJSAkoCAhoCEkICQgIKAhISAhICChISAgKCAnoCAkoCAgoSEgICAgIaAhJCAfISAgHZohJSAlICCgISEgISAgoSEmICEgJqEhJyAgICehISggJSAmoSEpIA8hJSAemiEmICYgJaAhICAgICWhIScgICAnoSEqICUgKqEhJSAmICehISYgJiAloCAhoCElICUgIKAhISAhICChISAgKSAooCAloCAgoSEgICAgIaAhIEEAIRkgIJogICAgRAAAAAAAAAAAYxsgJJogJCAkRAAAAAAAAAAAYxugIBdkDQAgCiAYsjgCAEMAwHnEISMMBwsgIiEgIAOaISQgJCAgoCEhICEgIKEhJSAhICWhISYgICAmoSEnICQgJaEhKCAQISQgApohJSAlICSgISAgICAkoSEmICAgJqEhKSAkICmhISQgJSAmoSElICUgJKAgIaAhJCAkICCgISEgISAgoSEgICggJ6AgJKAgIKEhICAgICGgISQgHyEgIAWaISUgJSAgoCEhICEgIKEhJiAhICahIScgICAnoSEoICUgJqEhKSAPISUgBJohJiAmICWgISAgICAloSEnICAgJ6EhKiAlICqhISUgJiAnoSEmICYgJaAgIaAhJSAlICCgISEgISAgoSEgICkgKKAgJaAgIKEhICAgICGgISACQCAgmiAgICBEAAAAAAAAAABjGyAkmiAkICREAAAAAAAAAABjG6AiICALZg0AIBkNACAAIBVrIRkgASAVayEYIA8hHiAfIR0gECEcICIhGyAgIRcLIAEgGkcNACAPIQQgHyEFIBAhAiAiIQMgACEaIAEhFQsgEiANoSENIBQgDaEhDyARIA6hIQ0gEyANoSENIABBAmohACAWIAFBAWoiAWpBAUcNAAsLQwDAecQhIyALRAAAAAAAAAAAZQ0DIApBADYCAAwDCyAMIAQ5AxAgDCADOQMIIAwgAjkDACAMIAU5AxgCQCABQQFIDQAgBEQAAAACAACgQaIhDSANIAShIQ4gDSAOoSEOIAQgDqEhDyAEIASiIQ0gDiAOoiANoSEQIBAgDyAOoiIRoCEOIA4gEaAhDiAPIA+iIAQgBSAFoKKgIA6gIRAgECANoCESIBIgDaEhEyACRAAAAAIAAKBBoiENIA0gAqEhDiANIA6hIQ4gAiAOoSEPIAIgAqIhDSAOIA6iIA2hIREgESAPIA6iIhSgIQ4gDiAUoCEOIA8gD6IgAiADIAOgoqAgDqAhDiAOIA2gIREgESANoSENIA4gDaEhDSAQIBOhIQ9BACEAQQIhFkEAIRhBASEZRAAAAAAAAAAAIRdBACErQQAhGkEBISwgAyEbIAIhHCAFIR0gBCEeA0ACQAJAIBlBCm5BCmxBf2ogACIVRw0AIAwgDEEQaiARIA0gEiAPIAYgByAIIAkQpICAgAAMAQsgDCAMQRBqIBEgDSASIA8gBiAHIAggCRCegICAAAsgFUEBaiEAIAwrAxAiD0QAAAACAACgQaIhDSANIA+hIQ4gDSAOoSEOIA8gDqEhECAPIA+iIQ0gDiAOoiANoSERIBEgECAOoiISoCEOIA4gEqAhDiAQIBCiIA8gDCsDGCIfIB+goqAgDqAhFCAUIA2gIRIgDCsDACIQRAAAAAIAAKBBoiEOIA4gEKEhESAOIBGhIREgECARoSETIBAgEKIhDiARIBGiIA6hISAgICATIBGiIiGgIREgESAhoCERIBMgE6IgECAMKwMIIiIgIqCioCARoCETIBMgDqAhEQJAIBIgEaAiIEQAAAAAgIQuQWUNACAAskN3c/hCkiAgtrwiAbNDAAAANJRDd3P4wpIgAUH///8DcUGAgID4A3K+IiNDdb+/v5SSQ6Pp3L8gI0P5RLQ+kpWSQwAAAD+UvCIBs0MAAAC0lJIgAUH///8DcUGAgID4A3K+IiNDdb+/P5SSQ6Pp3D8gI0P5RLQ+kpWSISMMBQsCQCALRAAAAAAAAAAAZQ0AAkAgACAaRw0AICIhICAbmiEkICQgIKAhISAhICChISUgISAloSEmICAgJqEhJyAkICWhISggECEkIByaISUgJSAkoCEgICAgJKEhJiAgICahISkgJCApoSEkICUgJqEhJSAlICSgICGgISQgJCAgoCEhICEgIKEhICAoICegICSgICChISAgICAhoCEkIB8hICAdmiElICUgIKAhISAhICChISYgISAmoSEnICAgJ6EhKCAlICahISkgDyElIB6aISYgJiAloCEgICAgJaEhJyAgICehISogJSAqoSElICYgJ6EhJiAmICWgICGgISUgJSAgoCEhICEgIKEhICApICigICWgICChISAgICAhoCEgQQAhGiAgmiAgICBEAAAAAAAAAABjGyAkmiAkICREAAAAAAAAAABjG6AgF2QNACAKICuyOAIAQwDAecQhIwwGCyAiISAgA5ohJCAkICCgISEgISAgoSElICEgJaEhJiAgICahIScgJCAloSEoIBAhJCACmiElICUgJKAhICAgICShISYgICAmoSEpICQgKaEhJCAlICahISUgJSAkoCAhoCEkICQgIKAhISAhICChISAgKCAnoCAkoCAgoSEgICAgIaAhJCAfISAgBZohJSAlICCgISEgISAgoSEmICEgJqEhJyAgICehISggJSAmoSEpIA8hJSAEmiEmICYgJaAhICAgICWhIScgICAnoSEqICUgKqEhJSAmICehISYgJiAloCAhoCElICUgIKAhISAhICChISAgKSAooCAloCAgoSEgICAgIaAhIAJAICCaICAgIEQAAAAAAAAAAGMbICSaICQgJEQAAAAAAAAAAGMboCIgIAtmDQAgGg0AIBYgGGshGiAVIBhrQQFqISsgDyEeIB8hHSAQIRwgIiEbICAhFwsgACAsRw0AIA8hBCAfIQUgECECICIhAyAWISwgACEYCyASIA2hIQ0gFCANoSEPIBEgDqEhDSATIA2hIQ0gFkECaiEWIBlBAWohGSABIABHDQALC0MAwHnEISMgC0QAAAAAAAAAAGUNAiAKQQA2AgAMAgsgDCAEOQMQIAwgAzkDCCAMIAI5AwAgDCAFOQMYAkAgAUEBSA0AIAREAAAAAgAAoEGiIQ0gDSAEoSEOIA0gDqEhDiAEIA6hIQ8gBCAEoiENIA4gDqIgDaEhECAQIA8gDqIiEaAhDiAOIBGgIQ4gDyAPoiAEIAUgBaCioCAOoCEQIBAgDaAhEiASIA2hIRMgAkQAAAACAACgQaIhDSANIAKhIQ4gDSAOoSEOIAIgDqEhDyACIAKiIQ0gDiAOoiANoSERIBEgDyAOoiIUoCEOIA4gFKAhDiAPIA+iIAIgAyADoKKgIA6gIQ4gDiANoCERIBEgDaEhDSAOIA2hIQ0gECAToSEPQQAhAEECIRZBACEYQQEhGUQAAAAAAAAAACEXQQAhK0EAIRpBASEsIAMhGyACIRwgBSEdIAQhHgNAAkACQCAZQQpuQQpsQX9qIAAiFUcNACAMIAxBEGogESANIBIgDyAGIAcgCCAJEKWAgIAADAELIAwgDEEQaiARIA0gEiAPIAYgByAIIAkQn4CAgAALIBVBAWohACAMKwMQIg9EAAAAAgAAoEGiIQ0gDSAPoSEOIA0gDqEhDiAPIA6hIRAgDyAPoiENIA4gDqIgDaEhESARIBAgDqIiEqAhDiAOIBKgIQ4gECAQoiAPIAwrAxgiHyAfoKKgIA6gIRQgFCANoCESIAwrAwAiEEQAAAACAACgQaIhDiAOIBChIREgDiARoSERIBAgEaEhEyAQIBCiIQ4gESARoiAOoSEgICAgEyARoiIhoCERIBEgIaAhESATIBOiIBAgDCsDCCIiICKgoqAgEaAhEyATIA6gIRECQCASIBGgIiBEAAAAAICELkFlDQAgALIgILa8IgGzQwAAADSUQ3dz+MKSIAFB////A3FBgICA+ANyviIjQ3W/v7+UkkOj6dy/ICND+US0PpKVkkMAAAA/lLwiAbNDAAAANJRDd3P4wpIgAUH///8DcUGAgID4A3K+IiNDdb+/v5SSQ6Pp3L8gI0P5RLQ+kpWSQ52EIb+UkiEjDAQLAkAgC0QAAAAAAAAAAGUNAAJAIAAgGkcNACAiISAgG5ohJCAkICCgISEgISAgoSElICEgJaEhJiAgICahIScgJCAloSEoIBAhJCAcmiElICUgJKAhICAgICShISYgICAmoSEpICQgKaEhJCAlICahISUgJSAkoCAhoCEkICQgIKAhISAhICChISAgKCAnoCAkoCAgoSEgICAgIaAhJCAfISAgHZohJSAlICCgISEgISAgoSEmICEgJqEhJyAgICehISggJSAmoSEpIA8hJSAemiEmICYgJaAhICAgICWhIScgICAnoSEqICUgKqEhJSAmICehISYgJiAloCAhoCElICUgIKAhISAhICChISAgKSAooCAloCAgoSEgICAgIaAhIEEAIRogIJogICAgRAAAAAAAAAAAYxsgJJogJCAkRAAAAAAAAAAAYxugIBdkDQAgCiArsjgCAEMAwHnEISMMBQsgIiEgIAOaISQgJCAgoCEhICEgIKEhJSAhICWhISYgICAmoSEnICQgJaEhKCAQISQgApohJSAlICSgISAgICAkoSEmICAgJqEhKSAkICmhISQgJSAmoSElICUgJKAgIaAhJCAkICCgISEgISAgoSEgICggJ6AgJKAgIKEhICAgICGgISQgHyEgIAWaISUgJSAgoCEhICEgIKEhJiAhICahIScgICAnoSEoICUgJqEhKSAPISUgBJohJiAmICWgISAgICAloSEnICAgJ6EhKiAlICqhISUgJiAnoSEmICYgJaAgIaAhJSAlICCgISEgISAgoSEgICkgKKAgJaAgIKEhICAgICGgISACQCAgmiAgICBEAAAAAAAAAABjGyAkmiAkICREAAAAAAAAAABjG6AiICALZg0AIBoNACAWIBhrIRogFSAYa0EBaiErIA8hHiAfIR0gECEcICIhGyAgIRcLIAAgLEcNACAPIQQgHyEFIBAhAiAiIQMgFiEsIAAhGAsgEiANoSENIBQgDaEhDyARIA6hIQ0gEyANoSENIBZBAmohFiAZQQFqIRkgASAARw0ACwtDAMB5xCEjIAtEAAAAAAAAAABlDQEgCkEANgIADAELIAwgBDkDECAMIAM5AwggDCACOQMAIAwgBTkDGAJAIAFBAUgNACAERAAAAAIAAKBBoiENIA0gBKEhDiANIA6hIQ4gBCAOoSEPIAQgBKIhDSAOIA6iIA2hIRAgECAPIA6iIhGgIQ4gDiARoCEOIA8gD6IgBCAFIAWgoqAgDqAhECAQIA2gIRIgEiANoSETIAJEAAAAAgAAoEGiIQ0gDSACoSEOIA0gDqEhDiACIA6hIQ8gAiACoiENIA4gDqIgDaEhESARIA8gDqIiFKAhDiAOIBSgIQ4gDyAPoiACIAMgA6CioCAOoCEOIA4gDaAhESARIA2hIQ0gDiANoSENIBAgE6EhD0EAIQBBAiEWQQAhGEEBIRlEAAAAAAAAAAAhF0EAIStBACEaQQEhLCADIRsgAiEcIAUhHSAEIR4DQAJAAkAgGUEKbkEKbEF/aiAAIhVHDQAgDCAMQRBqIBEgDSASIA8gBiAHIAggCRCmgICAAAwBCyAMIAxBEGogESANIBIgDyAGIAcgCCAJEKCAgIAACyAVQQFqIQAgDCsDECIPRAAAAAIAAKBBoiENIA0gD6EhDiANIA6hIQ4gDyAOoSEQIA8gD6IhDSAOIA6iIA2hIREgESAQIA6iIhKgIQ4gDiASoCEOIBAgEKIgDyAMKwMYIh8gH6CioCAOoCEUIBQgDaAhEiAMKwMAIhBEAAAAAgAAoEGiIQ4gDiAQoSERIA4gEaEhESAQIBGhIRMgECAQoiEOIBEgEaIgDqEhICAgIBMgEaIiIaAhESARICGgIREgEyAToiAQIAwrAwgiIiAioKKgIBGgIRMgEyAOoCERAkAgEiARoCIgRAAAAACAhC5BZQ0AIACyICC2vCIBs0MAAAA0lEN3c/jCkiABQf///wNxQYCAgPgDcr4iI0N1v7+/lJJDo+ncvyAjQ/lEtD6SlZJDAAAAP5S8IgGzQwAAADSUQ3dz+MKSIAFB////A3FBgICA+ANyviIjQ3W/v7+UkkOj6dy/ICND+US0PpKVkkMAAAA/lJMhIwwDCwJAIAtEAAAAAAAAAABlDQACQCAAIBpHDQAgIiEgIBuaISQgJCAgoCEhICEgIKEhJSAhICWhISYgICAmoSEnICQgJaEhKCAQISQgHJohJSAlICSgISAgICAkoSEmICAgJqEhKSAkICmhISQgJSAmoSElICUgJKAgIaAhJCAkICCgISEgISAgoSEgICggJ6AgJKAgIKEhICAgICGgISQgHyEgIB2aISUgJSAgoCEhICEgIKEhJiAhICahIScgICAnoSEoICUgJqEhKSAPISUgHpohJiAmICWgISAgICAloSEnICAgJ6EhKiAlICqhISUgJiAnoSEmICYgJaAgIaAhJSAlICCgISEgISAgoSEgICkgKKAgJaAgIKEhICAgICGgISBBACEaICCaICAgIEQAAAAAAAAAAGMbICSaICQgJEQAAAAAAAAAAGMboCAXZA0AIAogK7I4AgBDAMB5xCEjDAQLICIhICADmiEkICQgIKAhISAhICChISUgISAloSEmICAgJqEhJyAkICWhISggECEkIAKaISUgJSAkoCEgICAgJKEhJiAgICahISkgJCApoSEkICUgJqEhJSAlICSgICGgISQgJCAgoCEhICEgIKEhICAoICegICSgICChISAgICAhoCEkIB8hICAFmiElICUgIKAhISAhICChISYgISAmoSEnICAgJ6EhKCAlICahISkgDyElIASaISYgJiAloCEgICAgJaEhJyAgICehISogJSAqoSElICYgJ6EhJiAmICWgICGgISUgJSAgoCEhICEgIKEhICApICigICWgICChISAgICAhoCEgAkAgIJogICAgRAAAAAAAAAAAYxsgJJogJCAkRAAAAAAAAAAAYxugIiAgC2YNACAaDQAgFiAYayEaIBUgGGtBAWohKyAPIR4gHyEdIBAhHCAiIRsgICEXCyAAICxHDQAgDyEEIB8hBSAQIQIgIiEDIBYhLCAAIRgLIBIgDaEhDSAUIA2hIQ8gESAOoSENIBMgDaEhDSAWQQJqIRYgGUEBaiEZIAEgAEcNAAsLQwDAecQhIyALRAAAAAAAAAAAZQ0AIApBADYCAAsgDEEgaiSAgICAACAjC9ewAgwDewJ/BXsGfwx9An8FewR/An0DfAF/BHsgBSsDALb9EyAFKwMItv0gASAFKwMQtv0gAiAFKwMYtv0gAyEJIAQrAwC2/RMgBCsDCLb9IAEgBCsDELb9IAIgBCsDGLb9IAMhCgJAAkACQAJAAkACQAJAAkACQAJAAkACQAJAAkACQAJAAkACQCAAQX9qDg8ADw4NDAsKCQgHBgUEAwIBCwJAAkAgAUEBTg0A/Qz/////////////////////IQsMAQtBACEMQQAgAWshDSACKwMAtv0TIAIrAwi2/SABIAIrAxC2/SACIAIrAxi2/SADIg4gDv3mASEPIAMrAwC2/RMgAysDCLb9IAEgAysDELb9IAIgAysDGLb9IAMiECAQ/eYBIREgCLb9EyES/Qz/////////////////////IQtBAiEEQQAhE0EAIRRBACEAQQAhFUEAIRZBACEXQQAhGEMAAAAAIRlDAAAAACEaQwAAAAAhG0MAAAAAIRxDAAAAACEdQwAAAAAhHkMAAAAAIR9DAAAAACEgQwAAAAAhIUMAAAAAISJDAAAAACEjQwAAAAAhJEEAIQNBACElQQEhBUEAIQJBASEmIBAhJyAOISgCQANAIA8gEf3lASEpAkAgC/0MAAAAAAAAAAAAAAAAAAAAACIqICcgKCIoICj95AH95gEgCf3kASInICf95gEiESApIAr95AEiKCAo/eYBIg/95AEiK/0MACR0SQAkdEkAJHRJACR0Sf1E/VIiKf0bACIsICn9GwEiLXIgKf0bAiIuciAp/RsDIi9yRQ0AIAWyQ3dz+EKSITACQCAsRQ0AIAYgMCAr/RsAIiyzQwAAADSUQ3dz+MKSICxB////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkMAAAA/lLwiLLNDAAAAtJSSICxB////A3FBgICA+ANyviIxQ3W/vz+UkkOj6dw/IDFD+US0PpKVkjgCACAHICf9HwC7IjJEAAAAYJ6g9j+iIDIgKP0fALsiM6AiNCA0oiAyIDOhIjIgMqKgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCAAsCQCAtRQ0AIAYgMCAr/RsBIiyzQwAAADSUQ3dz+MKSICxB////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkMAAAA/lLwiLLNDAAAAtJSSICxB////A3FBgICA+ANyviIxQ3W/vz+UkkOj6dw/IDFD+US0PpKVkjgCBCAHICf9HwG7IjJEAAAAYJ6g9j+iIDIgKP0fAbsiM6AiNCA0oiAyIDOhIjIgMqKgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCBAsCQCAuRQ0AIAYgMCAr/RsCIiyzQwAAADSUQ3dz+MKSICxB////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkMAAAA/lLwiLLNDAAAAtJSSICxB////A3FBgICA+ANyviIxQ3W/vz+UkkOj6dw/IDFD+US0PpKVkjgCCCAHICf9HwK7IjJEAAAAYJ6g9j+iIDIgKP0fArsiM6AiNCA0oiAyIDOhIjIgMqKgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCCAsCQCAvRQ0AIAYgMCAr/RsDIiyzQwAAADSUQ3dz+MKSICxB////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkMAAAA/lLwiLLNDAAAAtJSSICxB////A3FBgICA+ANyviIwQ3W/vz+UkkOj6dw/IDBD+US0PpKVkjgCDCAHICf9HwO7IjJEAAAAYJ6g9j+iIDIgKP0fA7siM6AiNCA0oiAyIDOhIjIgMqKgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCDAsgKSAL/VEiC/0bACAL/RsBciAL/RsCciAL/RsDckUNAgsCQCAIRAAAAAAAAAAAZQ0AAkACQCACDQAgACEsQQAhAgwBCwJAIAUgDEcNACACQX9qIQJBACEMIAv9GwBFDQAgISAo/R8AIBmTiyAn/R8AIB2Ti5JdDQAgBkGAgOejfDYCACAHIBWyOAIAQQAhDCALQQD9HAAhCwsCQCAFIBNHDQAgAkF/aiECQQAhEyAL/RsBRQ0AICIgKP0fASAak4sgJ/0fASAek4uSXQ0AIAZBgIDno3w2AgQgByAWsjgCBEEAIRMgC0EA/RwBIQsLAkAgBSAURw0AIAJBf2ohAkEAIRQgC/0bAkUNACAjICj9HwIgG5OLICf9HwIgH5OLkl0NACAGQYCA56N8NgIIIAcgF7I4AghBACEUIAtBAP0cAiELCwJAAkAgBSAARg0AIAAhLAwBCyACQX9qIQJBACEsIAv9GwNFDQAgJCAo/R8DIByTiyAn/R8DICCTi5JdDQAgBkGAgOejfDYCDCAHIBiyOAIMQQAhLCALQQD9HAMhCwsgC/0bACAL/RsBciAL/RsCciAL/RsDckUNAwsCQAJAIAsgKiAnIBD95QH94AEgKCAO/eUB/eAB/eQBIisgEv1D/VIiKf0bACItICn9GwEiLnIgKf0bAiIvciAp/RsDIjVyRQ0AIAQgJWshACAFICVrIQMCQCAtRQ0AIAwNACACQQFqIQIgK/0fACEhICf9HwAhHSAo/R8AIRkgACEMIAMhFQsCQCAuRQ0AIBMNACACQQFqIQIgK/0fASEiICf9HwEhHiAo/R8BIRogACETIAMhFgsCQCAvRQ0AIBQNACACQQFqIQIgK/0fAiEjICf9HwIhHyAo/R8CIRsgACEUIAMhFwsgNUUNACAsDQAgAkEBaiECICv9HwMhJCAn/R8DISAgKP0fAyEcDAELICwhACAYIQMLAkAgBSAmRg0AIAMhGAwBCyADIRggBCEmIAUhJSAnIRAgKCEOCyAEQQJqIQQgBSABTiEDIA0gBUEBaiIFakEBRw0ACwsgA0EBcUUNEQsCQAJAAkAgC/0bAEUNACAGQYCA56N8NgIAAkAgCEQAAAAAAAAAAGRFDQAgB0EANgIAIAv9GwFFDQMgBkGAgOejfDYCBAwCCyAL/RsBRQ0CIAZBgIDno3w2AgQMAgsgC/0bAUUNASAGQYCA56N8NgIEIAhEAAAAAAAAAABlDQELIAdBADYCBAsCQCAL/RsCRQ0AIAZBgIDno3w2AggCQCAIRAAAAAAAAAAAZEUNACAHQQA2AgggC/0bA0UNEiAGQYCA56N8NgIMDBELIAv9GwNFDREgBkGAgOejfDYCDA8LIAv9GwNFDRAgBkGAgOejfDYCDCAIRAAAAAAAAAAAZA0PDBALAkACQCABQQFODQD9DP////////////////////8hCwwBCyACKwMAtv0TIAIrAwi2/SABIAIrAxC2/SACIAIrAxi2/SADIg4gDv3mASEpIAMrAwC2/RMgAysDCLb9IAEgAysDELb9IAIgAysDGLb9IAMiECAQ/eYBIScgCLb9EyES/Qz/////////////////////IQtBACEFQQIhA0EAIQxBACETQQAhFEEAIRhBACEVQQAhFkEAIRdBACEsQwAAAAAhGUMAAAAAIRpDAAAAACEbQwAAAAAhHEMAAAAAIR1DAAAAACEeQwAAAAAhH0MAAAAAISBDAAAAACEhQwAAAAAhIkMAAAAAISNDAAAAACEkQQAhAEEAISVBASEEQQAhDUEBITUgECEPIA4hEQNAAkACQCAEQQpuQQpsQX9qIAUiAkcNACApICf95QEgD/0MAACAQAAAgEAAAIBAAACAQP3mASAR/eYB/eAB/eYBISggJyAp/QwAAMDAAADAwAAAwMAAAMDA/eYB/eQBICf95gEhESApICn95gEhKQwBCyAP/QwAAIBAAACAQAAAgEAAAIBA/eYBICkgJ/3lAf3mASAR/eYBISggKSAn/QwAAMDAAADAwAAAwMAAAMDA/eYB/eQBICn95gEhESAnICf95gEhKQsgAkEBaiEFAkACQCAL/QwAAAAAAAAAAAAAAAAAAAAAIiogKCAJ/eQBIg8gD/3mASInICkgCv3kASAR/eQBIhEgEf3mASIp/eQBIiv9DAAkdEkAJHRJACR0SQAkdEn9RP1SIij9GwAiLSAo/RsBIi5yICj9GwIiL3IgKP0bAyImckUNACAFsiEwAkAgLUUNACAGIDAgK/0bACIts0MAAAA0lEN3c/jCkiAtQf///wNxQYCAgPgDcr4iMUN1v7+/lJJDo+ncvyAxQ/lEtD6SlZJDAAAAP5S8Ii2zQwAAADSUQ3dz+MKSIC1B////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkMAAAA/lJM4AgAgByAP/R8AuyIyRAAAAGCeoPY/oiAyIBH9HwC7IjOgIjQgNKIgMiAzoSIyIDKioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgALAkAgLkUNACAGIDAgK/0bASIts0MAAAA0lEN3c/jCkiAtQf///wNxQYCAgPgDcr4iMUN1v7+/lJJDo+ncvyAxQ/lEtD6SlZJDAAAAP5S8Ii2zQwAAADSUQ3dz+MKSIC1B////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkMAAAA/lJM4AgQgByAP/R8BuyIyRAAAAGCeoPY/oiAyIBH9HwG7IjOgIjQgNKIgMiAzoSIyIDKioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgQLAkAgL0UNACAGIDAgK/0bAiIts0MAAAA0lEN3c/jCkiAtQf///wNxQYCAgPgDcr4iMUN1v7+/lJJDo+ncvyAxQ/lEtD6SlZJDAAAAP5S8Ii2zQwAAADSUQ3dz+MKSIC1B////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkMAAAA/lJM4AgggByAP/R8CuyIyRAAAAGCeoPY/oiAyIBH9HwK7IjOgIjQgNKIgMiAzoSIyIDKioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AggLAkAgJkUNACAGIDAgK/0bAyIts0MAAAA0lEN3c/jCkiAtQf///wNxQYCAgPgDcr4iMUN1v7+/lJJDo+ncvyAxQ/lEtD6SlZJDAAAAP5S8Ii2zQwAAADSUQ3dz+MKSIC1B////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkMAAAA/lJM4AgwgByAP/R8DuyIyRAAAAGCeoPY/oiAyIBH9HwO7IjOgIjQgNKIgMiAzoSIyIDKioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgwLICggC/1RIgv9GwAgC/0bAXIgC/0bAnIgC/0bA3JFDQELAkAgCEQAAAAAAAAAAGUNAAJAAkAgDQ0AIBghLUEAIQ0MAQsCQCAFIAxHDQAgDUF/aiENQQAhDCAL/RsARQ0AICEgEf0fACAZk4sgD/0fACAdk4uSXQ0AIAZBgIDno3w2AgAgByAVsjgCAEEAIQwgC0EA/RwAIQsLAkAgBSATRw0AIA1Bf2ohDUEAIRMgC/0bAUUNACAiIBH9HwEgGpOLIA/9HwEgHpOLkl0NACAGQYCA56N8NgIEIAcgFrI4AgRBACETIAtBAP0cASELCwJAIAUgFEcNACANQX9qIQ1BACEUIAv9GwJFDQAgIyAR/R8CIBuTiyAP/R8CIB+Ti5JdDQAgBkGAgOejfDYCCCAHIBeyOAIIQQAhFCALQQD9HAIhCwsCQAJAIAUgGEYNACAYIS0MAQsgDUF/aiENQQAhLSAL/RsDRQ0AICQgEf0fAyAck4sgD/0fAyAgk4uSXQ0AIAZBgIDno3w2AgwgByAssjgCDEEAIS0gC0EA/RwDIQsLIAv9GwAgC/0bAXIgC/0bAnIgC/0bA3JFDQILAkACQCALICogDyAQ/eUB/eABIBEgDv3lAf3gAf3kASIrIBL9Q/1SIij9GwAiACAo/RsBIi5yICj9GwIiL3IgKP0bAyImckUNACADICVrIRggAiAla0EBaiECAkAgAEUNACAMDQAgDUEBaiENICv9HwAhISAP/R8AIR0gEf0fACEZIBghDCACIRULAkAgLkUNACATDQAgDUEBaiENICv9HwEhIiAP/R8BIR4gEf0fASEaIBghEyACIRYLAkAgL0UNACAUDQAgDUEBaiENICv9HwIhIyAP/R8CIR8gEf0fAiEbIBghFCACIRcLICZFDQAgLQ0AIA1BAWohDSAr/R8DISQgD/0fAyEgIBH9HwMhHAwBCyAtIRggLCECCwJAIAUgNUYNACACISwMAQsgAiEsIAMhNSAFISUgDyEQIBEhDgsgA0ECaiEDIAUgAU4hACAEQQFqIQQgASAFRw0BCwsgAEEBcUUNEAsCQAJAAkAgC/0bAEUNACAGQYCA56N8NgIAAkAgCEQAAAAAAAAAAGRFDQAgB0EANgIAIAv9GwFFDQMgBkGAgOejfDYCBAwCCyAL/RsBRQ0CIAZBgIDno3w2AgQMAgsgC/0bAUUNASAGQYCA56N8NgIEIAhEAAAAAAAAAABlDQELIAdBADYCBAsCQCAL/RsCRQ0AIAZBgIDno3w2AggCQCAIRAAAAAAAAAAAZEUNACAHQQA2AgggC/0bA0UNESAGQYCA56N8NgIMDBALIAv9GwNFDRAgBkGAgOejfDYCDA8LIAv9GwNFDQ8gBkGAgOejfDYCDCAIRAAAAAAAAAAAZQ0PDA4LAkACQCABQQFODQD9DP////////////////////8hCwwBCyACKwMAtv0TIAIrAwi2/SABIAIrAxC2/SACIAIrAxi2/SADIg4gDv3mASERIAMrAwC2/RMgAysDCLb9IAEgAysDELb9IAIgAysDGLb9IAMiECAQ/eYBIQ8gCLb9EyES/Qz/////////////////////IQtBACEFQQIhA0EAIQxBACETQQAhFEEAIRhBACEVQQAhFkEAIRdBACEsQwAAAAAhGUMAAAAAIRpDAAAAACEbQwAAAAAhHEMAAAAAIR1DAAAAACEeQwAAAAAhH0MAAAAAISBDAAAAACEhQwAAAAAhIkMAAAAAISNDAAAAACEkQQAhAEEAISVBASEEQQAhDUEBITUgECEpIA4hKANAIBEhJwJAAkAgBEEKbkEKbEF/aiAFIgJHDQAgJyAP/QwAAEDAAABAwAAAQMAAAEDA/eYB/eQBICj94AH95gEhKCAp/eABISkMAQsgKCAnIA/9DAAAQMAAAEDAAABAwAAAQMD95gH95AH95gEhKAsgAkEBaiEFAkACQCAL/QwAAAAAAAAAAAAAAAAAAAAAIiogJ/0MAABAQAAAQEAAAEBAAABAQP3mASAP/eUBICn95gEgCf3kASIpICn95gEiDyAoIAr95AEiKCAo/eYBIhH95AEiK/0MACR0SQAkdEkAJHRJACR0Sf1E/VIiJ/0bACItICf9GwEiLnIgJ/0bAiIvciAn/RsDIiZyRQ0AIAWyITACQCAtRQ0AIAYgMCAr/RsAIi2zQwAAADSUQ3dz+MKSIC1B////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkMAAAA/lLwiLbNDAAAANJRDd3P4wpIgLUH///8DcUGAgID4A3K+IjFDdb+/v5SSQ6Pp3L8gMUP5RLQ+kpWSQ52EIb+UkjgCACAHICn9HwC7IjJEAAAAYJ6g9j+iIDIgKP0fALsiM6AiNCA0oiAyIDOhIjIgMqKgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCAAsCQCAuRQ0AIAYgMCAr/RsBIi2zQwAAADSUQ3dz+MKSIC1B////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkMAAAA/lLwiLbNDAAAANJRDd3P4wpIgLUH///8DcUGAgID4A3K+IjFDdb+/v5SSQ6Pp3L8gMUP5RLQ+kpWSQ52EIb+UkjgCBCAHICn9HwG7IjJEAAAAYJ6g9j+iIDIgKP0fAbsiM6AiNCA0oiAyIDOhIjIgMqKgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCBAsCQCAvRQ0AIAYgMCAr/RsCIi2zQwAAADSUQ3dz+MKSIC1B////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkMAAAA/lLwiLbNDAAAANJRDd3P4wpIgLUH///8DcUGAgID4A3K+IjFDdb+/v5SSQ6Pp3L8gMUP5RLQ+kpWSQ52EIb+UkjgCCCAHICn9HwK7IjJEAAAAYJ6g9j+iIDIgKP0fArsiM6AiNCA0oiAyIDOhIjIgMqKgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCCAsCQCAmRQ0AIAYgMCAr/RsDIi2zQwAAADSUQ3dz+MKSIC1B////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkMAAAA/lLwiLbNDAAAANJRDd3P4wpIgLUH///8DcUGAgID4A3K+IjFDdb+/v5SSQ6Pp3L8gMUP5RLQ+kpWSQ52EIb+UkjgCDCAHICn9HwO7IjJEAAAAYJ6g9j+iIDIgKP0fA7siM6AiNCA0oiAyIDOhIjIgMqKgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCDAsgJyAL/VEiC/0bACAL/RsBciAL/RsCciAL/RsDckUNAQsCQCAIRAAAAAAAAAAAZQ0AAkACQCANDQAgGCEtQQAhDQwBCwJAIAUgDEcNACANQX9qIQ1BACEMIAv9GwBFDQAgISAo/R8AIBmTiyAp/R8AIB2Ti5JdDQAgBkGAgOejfDYCACAHIBWyOAIAQQAhDCALQQD9HAAhCwsCQCAFIBNHDQAgDUF/aiENQQAhEyAL/RsBRQ0AICIgKP0fASAak4sgKf0fASAek4uSXQ0AIAZBgIDno3w2AgQgByAWsjgCBEEAIRMgC0EA/RwBIQsLAkAgBSAURw0AIA1Bf2ohDUEAIRQgC/0bAkUNACAjICj9HwIgG5OLICn9HwIgH5OLkl0NACAGQYCA56N8NgIIIAcgF7I4AghBACEUIAtBAP0cAiELCwJAAkAgBSAYRg0AIBghLQwBCyANQX9qIQ1BACEtIAv9GwNFDQAgJCAo/R8DIByTiyAp/R8DICCTi5JdDQAgBkGAgOejfDYCDCAHICyyOAIMQQAhLSALQQD9HAMhCwsgC/0bACAL/RsBciAL/RsCciAL/RsDckUNAgsCQAJAIAsgKiApIBD95QH94AEgKCAO/eUB/eAB/eQBIisgEv1D/VIiJ/0bACIAICf9GwEiLnIgJ/0bAiIvciAn/RsDIiZyRQ0AIAMgJWshGCACICVrQQFqIQICQCAARQ0AIAwNACANQQFqIQ0gK/0fACEhICn9HwAhHSAo/R8AIRkgGCEMIAIhFQsCQCAuRQ0AIBMNACANQQFqIQ0gK/0fASEiICn9HwEhHiAo/R8BIRogGCETIAIhFgsCQCAvRQ0AIBQNACANQQFqIQ0gK/0fAiEjICn9HwIhHyAo/R8CIRsgGCEUIAIhFwsgJkUNACAtDQAgDUEBaiENICv9HwMhJCAp/R8DISAgKP0fAyEcDAELIC0hGCAsIQILAkAgBSA1Rg0AIAIhLAwBCyACISwgAyE1IAUhJSApIRAgKCEOCyADQQJqIQMgBSABTiEAIARBAWohBCABIAVHDQELCyAAQQFxRQ0PCwJAAkACQCAL/RsARQ0AIAZBgIDno3w2AgACQCAIRAAAAAAAAAAAZEUNACAHQQA2AgAgC/0bAUUNAyAGQYCA56N8NgIEDAILIAv9GwFFDQIgBkGAgOejfDYCBAwCCyAL/RsBRQ0BIAZBgIDno3w2AgQgCEQAAAAAAAAAAGUNAQsgB0EANgIECwJAIAv9GwJFDQAgBkGAgOejfDYCCAJAIAhEAAAAAAAAAABkRQ0AIAdBADYCCCAL/RsDRQ0QIAZBgIDno3w2AgwMDwsgC/0bA0UNDyAGQYCA56N8NgIMDwsgC/0bA0UNDiAGQYCA56N8NgIMIAhEAAAAAAAAAABkDQ0MDgsCQAJAIAFBAU4NAP0M/////////////////////yELDAELIAIrAwC2/RMgAisDCLb9IAEgAisDELb9IAIgAisDGLb9IAMiDiAO/eYBIQ8gAysDALb9EyADKwMItv0gASADKwMQtv0gAiADKwMYtv0gAyIQIBD95gEhESAItv0TIRL9DP////////////////////8hC0EAIQVBAiEDQQAhDEEAIRNBACEUQQAhGEEAIRVBACEWQQAhF0EAISxDAAAAACEZQwAAAAAhGkMAAAAAIRtDAAAAACEcQwAAAAAhHUMAAAAAIR5DAAAAACEfQwAAAAAhIEMAAAAAISFDAAAAACEiQwAAAAAhI0MAAAAAISRBACEAQQAhJUEBIQRBACENQQEhNSAQISggDiEpAkADQCARIScgBSICQQFqIQUCQCAL/QwAAAAAAAAAAAAAAAAAAAAAIiogKCApICn95AH95gEiKf3gASApIAIgBEEKbkEKbEF/akYbIAn95AEiKCAo/eYBIhEgDyAn/eUBIAr95AEiKSAp/eYBIg/95AEiK/0MACR0SQAkdEkAJHRJACR0Sf1E/VIiJ/0bACItICf9GwEiLnIgJ/0bAiIvciAn/RsDIiZyRQ0AIAWyQ3dz+EKSITACQCAtRQ0AIAYgMCAr/RsAIi2zQwAAADSUQ3dz+MKSIC1B////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkMAAAA/lLwiLbNDAAAAtJSSIC1B////A3FBgICA+ANyviIxQ3W/vz+UkkOj6dw/IDFD+US0PpKVkjgCACAHICj9HwC7IjJEAAAAYJ6g9j+iIDIgKf0fALsiM6AiNCA0oiAyIDOhIjIgMqKgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCAAsCQCAuRQ0AIAYgMCAr/RsBIi2zQwAAADSUQ3dz+MKSIC1B////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkMAAAA/lLwiLbNDAAAAtJSSIC1B////A3FBgICA+ANyviIxQ3W/vz+UkkOj6dw/IDFD+US0PpKVkjgCBCAHICj9HwG7IjJEAAAAYJ6g9j+iIDIgKf0fAbsiM6AiNCA0oiAyIDOhIjIgMqKgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCBAsCQCAvRQ0AIAYgMCAr/RsCIi2zQwAAADSUQ3dz+MKSIC1B////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkMAAAA/lLwiLbNDAAAAtJSSIC1B////A3FBgICA+ANyviIxQ3W/vz+UkkOj6dw/IDFD+US0PpKVkjgCCCAHICj9HwK7IjJEAAAAYJ6g9j+iIDIgKf0fArsiM6AiNCA0oiAyIDOhIjIgMqKgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCCAsCQCAmRQ0AIAYgMCAr/RsDIi2zQwAAADSUQ3dz+MKSIC1B////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkMAAAA/lLwiLbNDAAAAtJSSIC1B////A3FBgICA+ANyviIwQ3W/vz+UkkOj6dw/IDBD+US0PpKVkjgCDCAHICj9HwO7IjJEAAAAYJ6g9j+iIDIgKf0fA7siM6AiNCA0oiAyIDOhIjIgMqKgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCDAsgJyAL/VEiC/0bACAL/RsBciAL/RsCciAL/RsDckUNAgsCQCAIRAAAAAAAAAAAZQ0AAkACQCANDQAgGCEtQQAhDQwBCwJAIAUgDEcNACANQX9qIQ1BACEMIAv9GwBFDQAgISAp/R8AIBmTiyAo/R8AIB2Ti5JdDQAgBkGAgOejfDYCACAHIBWyOAIAQQAhDCALQQD9HAAhCwsCQCAFIBNHDQAgDUF/aiENQQAhEyAL/RsBRQ0AICIgKf0fASAak4sgKP0fASAek4uSXQ0AIAZBgIDno3w2AgQgByAWsjgCBEEAIRMgC0EA/RwBIQsLAkAgBSAURw0AIA1Bf2ohDUEAIRQgC/0bAkUNACAjICn9HwIgG5OLICj9HwIgH5OLkl0NACAGQYCA56N8NgIIIAcgF7I4AghBACEUIAtBAP0cAiELCwJAAkAgBSAYRg0AIBghLQwBCyANQX9qIQ1BACEtIAv9GwNFDQAgJCAp/R8DIByTiyAo/R8DICCTi5JdDQAgBkGAgOejfDYCDCAHICyyOAIMQQAhLSALQQD9HAMhCwsgC/0bACAL/RsBciAL/RsCciAL/RsDckUNAwsCQAJAIAsgKiAoIBD95QH94AEgKSAO/eUB/eAB/eQBIisgEv1D/VIiJ/0bACIAICf9GwEiLnIgJ/0bAiIvciAn/RsDIiZyRQ0AIAMgJWshGCACICVrQQFqIQICQCAARQ0AIAwNACANQQFqIQ0gK/0fACEhICj9HwAhHSAp/R8AIRkgGCEMIAIhFQsCQCAuRQ0AIBMNACANQQFqIQ0gK/0fASEiICj9HwEhHiAp/R8BIRogGCETIAIhFgsCQCAvRQ0AIBQNACANQQFqIQ0gK/0fAiEjICj9HwIhHyAp/R8CIRsgGCEUIAIhFwsgJkUNACAtDQAgDUEBaiENICv9HwMhJCAo/R8DISAgKf0fAyEcDAELIC0hGCAsIQILAkAgBSA1Rg0AIAIhLAwBCyACISwgAyE1IAUhJSAoIRAgKSEOCyADQQJqIQMgBSABTiEAIARBAWohBCABIAVHDQALCyAAQQFxRQ0OCwJAAkACQCAL/RsARQ0AIAZBgIDno3w2AgACQCAIRAAAAAAAAAAAZEUNACAHQQA2AgAgC/0bAUUNAyAGQYCA56N8NgIEDAILIAv9GwFFDQIgBkGAgOejfDYCBAwCCyAL/RsBRQ0BIAZBgIDno3w2AgQgCEQAAAAAAAAAAGUNAQsgB0EANgIECwJAIAv9GwJFDQAgBkGAgOejfDYCCAJAIAhEAAAAAAAAAABkRQ0AIAdBADYCCCAL/RsDRQ0PIAZBgIDno3w2AgwMDgsgC/0bA0UNDiAGQYCA56N8NgIMDwsgC/0bA0UNDSAGQYCA56N8NgIMIAhEAAAAAAAAAABkDQwMDQsCQAJAIAFBAU4NAP0M/////////////////////yELDAELQQAhDEEAIAFrIQ0gAisDALb9EyACKwMItv0gASACKwMQtv0gAiACKwMYtv0gAyIOIA795gEhDyADKwMAtv0TIAMrAwi2/SABIAMrAxC2/SACIAMrAxi2/SADIhAgEP3mASERIAi2/RMhEv0M/////////////////////yELQQIhBEEAIRNBACEUQQAhAEEAIRVBACEWQQAhF0EAIRhDAAAAACEZQwAAAAAhGkMAAAAAIRtDAAAAACEcQwAAAAAhHUMAAAAAIR5DAAAAACEfQwAAAAAhIEMAAAAAISFDAAAAACEiQwAAAAAhI0MAAAAAISRBACEDQQAhJUEBIQVBACECQQEhJiAQIScgDiEoAkADQCAPIBH95QEhKQJAIAv9DAAAAAAAAAAAAAAAAAAAAAAiKiAJICcgKCIoICj95AH95gH95QEiJyAn/eYBIhEgKSAK/eQBIiggKP3mASIP/eQBIiv9DAAkdEkAJHRJACR0SQAkdEn9RP1SIin9GwAiLCAp/RsBIi1yICn9GwIiLnIgKf0bAyIvckUNACAFskN3c/hCkiEwAkAgLEUNACAGIDAgK/0bACIss0MAAAA0lEN3c/jCkiAsQf///wNxQYCAgPgDcr4iMUN1v7+/lJJDo+ncvyAxQ/lEtD6SlZJDAAAAP5S8IiyzQwAAALSUkiAsQf///wNxQYCAgPgDcr4iMUN1v78/lJJDo+ncPyAxQ/lEtD6SlZI4AgAgByAn/R8AuyIyRAAAAGCeoPY/oiAyICj9HwC7IjOgIjQgNKIgMiAzoSIyIDKioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgALAkAgLUUNACAGIDAgK/0bASIss0MAAAA0lEN3c/jCkiAsQf///wNxQYCAgPgDcr4iMUN1v7+/lJJDo+ncvyAxQ/lEtD6SlZJDAAAAP5S8IiyzQwAAALSUkiAsQf///wNxQYCAgPgDcr4iMUN1v78/lJJDo+ncPyAxQ/lEtD6SlZI4AgQgByAn/R8BuyIyRAAAAGCeoPY/oiAyICj9HwG7IjOgIjQgNKIgMiAzoSIyIDKioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgQLAkAgLkUNACAGIDAgK/0bAiIss0MAAAA0lEN3c/jCkiAsQf///wNxQYCAgPgDcr4iMUN1v7+/lJJDo+ncvyAxQ/lEtD6SlZJDAAAAP5S8IiyzQwAAALSUkiAsQf///wNxQYCAgPgDcr4iMUN1v78/lJJDo+ncPyAxQ/lEtD6SlZI4AgggByAn/R8CuyIyRAAAAGCeoPY/oiAyICj9HwK7IjOgIjQgNKIgMiAzoSIyIDKioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AggLAkAgL0UNACAGIDAgK/0bAyIss0MAAAA0lEN3c/jCkiAsQf///wNxQYCAgPgDcr4iMUN1v7+/lJJDo+ncvyAxQ/lEtD6SlZJDAAAAP5S8IiyzQwAAALSUkiAsQf///wNxQYCAgPgDcr4iMEN1v78/lJJDo+ncPyAwQ/lEtD6SlZI4AgwgByAn/R8DuyIyRAAAAGCeoPY/oiAyICj9HwO7IjOgIjQgNKIgMiAzoSIyIDKioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgwLICkgC/1RIgv9GwAgC/0bAXIgC/0bAnIgC/0bA3JFDQILAkAgCEQAAAAAAAAAAGUNAAJAAkAgAg0AIAAhLEEAIQIMAQsCQCAFIAxHDQAgAkF/aiECQQAhDCAL/RsARQ0AICEgKP0fACAZk4sgJ/0fACAdk4uSXQ0AIAZBgIDno3w2AgAgByAVsjgCAEEAIQwgC0EA/RwAIQsLAkAgBSATRw0AIAJBf2ohAkEAIRMgC/0bAUUNACAiICj9HwEgGpOLICf9HwEgHpOLkl0NACAGQYCA56N8NgIEIAcgFrI4AgRBACETIAtBAP0cASELCwJAIAUgFEcNACACQX9qIQJBACEUIAv9GwJFDQAgIyAo/R8CIBuTiyAn/R8CIB+Ti5JdDQAgBkGAgOejfDYCCCAHIBeyOAIIQQAhFCALQQD9HAIhCwsCQAJAIAUgAEYNACAAISwMAQsgAkF/aiECQQAhLCAL/RsDRQ0AICQgKP0fAyAck4sgJ/0fAyAgk4uSXQ0AIAZBgIDno3w2AgwgByAYsjgCDEEAISwgC0EA/RwDIQsLIAv9GwAgC/0bAXIgC/0bAnIgC/0bA3JFDQMLAkACQCALICogJyAQ/eUB/eABICggDv3lAf3gAf3kASIrIBL9Q/1SIin9GwAiLSAp/RsBIi5yICn9GwIiL3IgKf0bAyI1ckUNACAEICVrIQAgBSAlayEDAkAgLUUNACAMDQAgAkEBaiECICv9HwAhISAn/R8AIR0gKP0fACEZIAAhDCADIRULAkAgLkUNACATDQAgAkEBaiECICv9HwEhIiAn/R8BIR4gKP0fASEaIAAhEyADIRYLAkAgL0UNACAUDQAgAkEBaiECICv9HwIhIyAn/R8CIR8gKP0fAiEbIAAhFCADIRcLIDVFDQAgLA0AIAJBAWohAiAr/R8DISQgJ/0fAyEgICj9HwMhHAwBCyAsIQAgGCEDCwJAIAUgJkYNACADIRgMAQsgAyEYIAQhJiAFISUgJyEQICghDgsgBEECaiEEIAUgAU4hAyANIAVBAWoiBWpBAUcNAAsLIANBAXFFDQ0LAkACQAJAIAv9GwBFDQAgBkGAgOejfDYCAAJAIAhEAAAAAAAAAABkRQ0AIAdBADYCACAL/RsBRQ0DIAZBgIDno3w2AgQMAgsgC/0bAUUNAiAGQYCA56N8NgIEDAILIAv9GwFFDQEgBkGAgOejfDYCBCAIRAAAAAAAAAAAZQ0BCyAHQQA2AgQLAkAgC/0bAkUNACAGQYCA56N8NgIIAkAgCEQAAAAAAAAAAGRFDQAgB0EANgIIIAv9GwNFDQ4gBkGAgOejfDYCDAwNCyAL/RsDRQ0NIAZBgIDno3w2AgwPCyAL/RsDRQ0MIAZBgIDno3w2AgwgCEQAAAAAAAAAAGQNCwwMCwJAAkAgAUEBTg0A/Qz/////////////////////IQsMAQtBACEMQQAgAWshDSACKwMAtv0TIAIrAwi2/SABIAIrAxC2/SACIAIrAxi2/SADIg4gDv3mASEPIAMrAwC2/RMgAysDCLb9IAEgAysDELb9IAIgAysDGLb9IAMiECAQ/eYBIREgCLb9EyES/Qz/////////////////////IQtBAiEEQQAhE0EAIRRBACEAQQAhFUEAIRZBACEXQQAhGEMAAAAAIRlDAAAAACEaQwAAAAAhG0MAAAAAIRxDAAAAACEdQwAAAAAhHkMAAAAAIR9DAAAAACEgQwAAAAAhIUMAAAAAISJDAAAAACEjQwAAAAAhJEEAIQNBACElQQEhBUEAIQJBASEmIBAhJyAOISgCQANAIBEgKP3gASIp/eQBISgCQCAL/QwAAAAAAAAAAAAAAAAAAAAAIiogJ/3gASInICkgKf3kAf3mASAn/eUBIAn95AEiJyAn/eYBIhEgCiAP/eQBICj95QEiKCAo/eYBIg/95AEiK/0MACR0SQAkdEkAJHRJACR0Sf1E/VIiKf0bACIsICn9GwEiLXIgKf0bAiIuciAp/RsDIi9yRQ0AIAWyQ3dz+EKSITACQCAsRQ0AIAYgMCAr/RsAIiyzQwAAADSUQ3dz+MKSICxB////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkMAAAA/lLwiLLNDAAAAtJSSICxB////A3FBgICA+ANyviIxQ3W/vz+UkkOj6dw/IDFD+US0PpKVkjgCACAHICf9HwC7IjJEAAAAYJ6g9j+iIDIgKP0fALsiM6AiNCA0oiAyIDOhIjIgMqKgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCAAsCQCAtRQ0AIAYgMCAr/RsBIiyzQwAAADSUQ3dz+MKSICxB////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkMAAAA/lLwiLLNDAAAAtJSSICxB////A3FBgICA+ANyviIxQ3W/vz+UkkOj6dw/IDFD+US0PpKVkjgCBCAHICf9HwG7IjJEAAAAYJ6g9j+iIDIgKP0fAbsiM6AiNCA0oiAyIDOhIjIgMqKgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCBAsCQCAuRQ0AIAYgMCAr/RsCIiyzQwAAADSUQ3dz+MKSICxB////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkMAAAA/lLwiLLNDAAAAtJSSICxB////A3FBgICA+ANyviIxQ3W/vz+UkkOj6dw/IDFD+US0PpKVkjgCCCAHICf9HwK7IjJEAAAAYJ6g9j+iIDIgKP0fArsiM6AiNCA0oiAyIDOhIjIgMqKgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCCAsCQCAvRQ0AIAYgMCAr/RsDIiyzQwAAADSUQ3dz+MKSICxB////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkMAAAA/lLwiLLNDAAAAtJSSICxB////A3FBgICA+ANyviIwQ3W/vz+UkkOj6dw/IDBD+US0PpKVkjgCDCAHICf9HwO7IjJEAAAAYJ6g9j+iIDIgKP0fA7siM6AiNCA0oiAyIDOhIjIgMqKgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCDAsgKSAL/VEiC/0bACAL/RsBciAL/RsCciAL/RsDckUNAgsCQCAIRAAAAAAAAAAAZQ0AAkACQCACDQAgACEsQQAhAgwBCwJAIAUgDEcNACACQX9qIQJBACEMIAv9GwBFDQAgISAo/R8AIBmTiyAn/R8AIB2Ti5JdDQAgBkGAgOejfDYCACAHIBWyOAIAQQAhDCALQQD9HAAhCwsCQCAFIBNHDQAgAkF/aiECQQAhEyAL/RsBRQ0AICIgKP0fASAak4sgJ/0fASAek4uSXQ0AIAZBgIDno3w2AgQgByAWsjgCBEEAIRMgC0EA/RwBIQsLAkAgBSAURw0AIAJBf2ohAkEAIRQgC/0bAkUNACAjICj9HwIgG5OLICf9HwIgH5OLkl0NACAGQYCA56N8NgIIIAcgF7I4AghBACEUIAtBAP0cAiELCwJAAkAgBSAARg0AIAAhLAwBCyACQX9qIQJBACEsIAv9GwNFDQAgJCAo/R8DIByTiyAn/R8DICCTi5JdDQAgBkGAgOejfDYCDCAHIBiyOAIMQQAhLCALQQD9HAMhCwsgC/0bACAL/RsBciAL/RsCciAL/RsDckUNAwsCQAJAIAsgKiAnIBD95QH94AEgKCAO/eUB/eAB/eQBIisgEv1D/VIiKf0bACItICn9GwEiLnIgKf0bAiIvciAp/RsDIjVyRQ0AIAQgJWshACAFICVrIQMCQCAtRQ0AIAwNACACQQFqIQIgK/0fACEhICf9HwAhHSAo/R8AIRkgACEMIAMhFQsCQCAuRQ0AIBMNACACQQFqIQIgK/0fASEiICf9HwEhHiAo/R8BIRogACETIAMhFgsCQCAvRQ0AIBQNACACQQFqIQIgK/0fAiEjICf9HwIhHyAo/R8CIRsgACEUIAMhFwsgNUUNACAsDQAgAkEBaiECICv9HwMhJCAn/R8DISAgKP0fAyEcDAELICwhACAYIQMLAkAgBSAmRg0AIAMhGAwBCyADIRggBCEmIAUhJSAnIRAgKCEOCyAEQQJqIQQgBSABTiEDIA0gBUEBaiIFakEBRw0ACwsgA0EBcUUNDAsCQAJAAkAgC/0bAEUNACAGQYCA56N8NgIAAkAgCEQAAAAAAAAAAGRFDQAgB0EANgIAIAv9GwFFDQMgBkGAgOejfDYCBAwCCyAL/RsBRQ0CIAZBgIDno3w2AgQMAgsgC/0bAUUNASAGQYCA56N8NgIEIAhEAAAAAAAAAABlDQELIAdBADYCBAsCQCAL/RsCRQ0AIAZBgIDno3w2AggCQCAIRAAAAAAAAAAAZEUNACAHQQA2AgggC/0bA0UNDSAGQYCA56N8NgIMDAwLIAv9GwNFDQwgBkGAgOejfDYCDA8LIAv9GwNFDQsgBkGAgOejfDYCDCAIRAAAAAAAAAAAZA0KDAsLAkACQCABQQFODQD9DP////////////////////8hEQwBC0EAIQxBACABayEYIAIrAwC2/RMgAisDCLb9IAEgAisDELb9IAIgAisDGLb9IAMiJyAn/eYBIQ8gCLb9EyEQ/Qz/////////////////////IRFBAiEEQQAhE0EAIRRBACENQQAhFUEAIRZBACEXQQAhLEMAAAAAIRlDAAAAACEaQwAAAAAhG0MAAAAAIRxDAAAAACEdQwAAAAAhHkMAAAAAIR9DAAAAACEgQwAAAAAhIUMAAAAAISJDAAAAACEjQwAAAAAhJEEAIQJBACElQQEhBUEAIQBBASEmIAMrAwC2/RMgAysDCLb9IAEgAysDELb9IAIgAysDGLb9IAP94QEiKyEpICf94AEiDiEoAkADQCAp/QwAAADAAAAAwAAAAMAAAADA/eYBICj95gEhJyAPIAr95AEgKSAp/eYB/eUBIin94AEhKAJAIBH9DAAAAAAAAAAAAAAAAAAAAAAiCyApICn95gEiDyAnIAn95QEiKSAp/eYB/eQBIir9DAAkdEkAJHRJACR0SQAkdEn9RP1SIif9GwAiAyAn/RsBIi1yICf9GwIiLnIgJ/0bAyIvckUNACAFskN3c/hCkiEwAkAgA0UNACAGIDAgKv0bACIDs0MAAAA0lEN3c/jCkiADQf///wNxQYCAgPgDcr4iMUN1v7+/lJJDo+ncvyAxQ/lEtD6SlZJDAAAAP5S8IgOzQwAAALSUkiADQf///wNxQYCAgPgDcr4iMUN1v78/lJJDo+ncPyAxQ/lEtD6SlZI4AgAgByAp/R8AuyIyRAAAAGCeoPY/oiAyICj9HwC7IjOgIjQgNKIgMiAzoSIyIDKioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgALAkAgLUUNACAGIDAgKv0bASIDs0MAAAA0lEN3c/jCkiADQf///wNxQYCAgPgDcr4iMUN1v7+/lJJDo+ncvyAxQ/lEtD6SlZJDAAAAP5S8IgOzQwAAALSUkiADQf///wNxQYCAgPgDcr4iMUN1v78/lJJDo+ncPyAxQ/lEtD6SlZI4AgQgByAp/R8BuyIyRAAAAGCeoPY/oiAyICj9HwG7IjOgIjQgNKIgMiAzoSIyIDKioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgQLAkAgLkUNACAGIDAgKv0bAiIDs0MAAAA0lEN3c/jCkiADQf///wNxQYCAgPgDcr4iMUN1v7+/lJJDo+ncvyAxQ/lEtD6SlZJDAAAAP5S8IgOzQwAAALSUkiADQf///wNxQYCAgPgDcr4iMUN1v78/lJJDo+ncPyAxQ/lEtD6SlZI4AgggByAp/R8CuyIyRAAAAGCeoPY/oiAyICj9HwK7IjOgIjQgNKIgMiAzoSIyIDKioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AggLAkAgL0UNACAGIDAgKv0bAyIDs0MAAAA0lEN3c/jCkiADQf///wNxQYCAgPgDcr4iMUN1v7+/lJJDo+ncvyAxQ/lEtD6SlZJDAAAAP5S8IgOzQwAAALSUkiADQf///wNxQYCAgPgDcr4iMEN1v78/lJJDo+ncPyAwQ/lEtD6SlZI4AgwgByAp/R8DuyIyRAAAAGCeoPY/oiAyICj9HwO7IjOgIjQgNKIgMiAzoSIyIDKioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgwLICcgEf1RIhH9GwAgEf0bAXIgEf0bAnIgEf0bA3JFDQILAkAgCEQAAAAAAAAAAGUNAAJAAkAgAA0AIA0hLUEAIQAMAQsCQCAFIAxHDQAgAEF/aiEAQQAhDCAR/RsARQ0AICEgKP0fACAZk4sgKf0fACAdk4uSXQ0AIAZBgIDno3w2AgAgByAVsjgCAEEAIQwgEUEA/RwAIRELAkAgBSATRw0AIABBf2ohAEEAIRMgEf0bAUUNACAiICj9HwEgGpOLICn9HwEgHpOLkl0NACAGQYCA56N8NgIEIAcgFrI4AgRBACETIBFBAP0cASERCwJAIAUgFEcNACAAQX9qIQBBACEUIBH9GwJFDQAgIyAo/R8CIBuTiyAp/R8CIB+Ti5JdDQAgBkGAgOejfDYCCCAHIBeyOAIIQQAhFCARQQD9HAIhEQsCQAJAIAUgDUYNACANIS0MAQsgAEF/aiEAQQAhLSAR/RsDRQ0AICQgKP0fAyAck4sgKf0fAyAgk4uSXQ0AIAZBgIDno3w2AgwgByAssjgCDEEAIS0gEUEA/RwDIRELIBH9GwAgEf0bAXIgEf0bAnIgEf0bA3JFDQMLAkACQCARIAsgKCAO/eUB/eABICkgK/3lAf3gAf3kASIqIBD9Q/1SIif9GwAiAiAn/RsBIi5yICf9GwIiL3IgJ/0bAyI1ckUNACAEICVrIQ0gBSAlayEDAkAgAkUNACAMDQAgAEEBaiEAICr9HwAhISAp/R8AIR0gKP0fACEZIA0hDCADIRULAkAgLkUNACATDQAgAEEBaiEAICr9HwEhIiAp/R8BIR4gKP0fASEaIA0hEyADIRYLAkAgL0UNACAUDQAgAEEBaiEAICr9HwIhIyAp/R8CIR8gKP0fAiEbIA0hFCADIRcLIDVFDQAgLQ0AIABBAWohACAq/R8DISQgKf0fAyEgICj9HwMhHAwBCyAtIQ0gLCEDCwJAIAUgJkYNACADISwMAQsgAyEsIAQhJiAFISUgKSErICghDgsgBEECaiEEIAUgAU4hAiAYIAVBAWoiBWpBAUcNAAsLIAJBAXFFDQsLAkACQAJAIBH9GwBFDQAgBkGAgOejfDYCAAJAIAhEAAAAAAAAAABkRQ0AIAdBADYCACAR/RsBRQ0DIAZBgIDno3w2AgQMAgsgEf0bAUUNAiAGQYCA56N8NgIEDAILIBH9GwFFDQEgBkGAgOejfDYCBCAIRAAAAAAAAAAAZQ0BCyAHQQA2AgQLAkAgEf0bAkUNACAGQYCA56N8NgIIAkAgCEQAAAAAAAAAAGRFDQAgB0EANgIIIBH9GwNFDQwgBkGAgOejfDYCDAwLCyAR/RsDRQ0LIAZBgIDno3w2AgwPCyAR/RsDRQ0KIAZBgIDno3w2AgwgCEQAAAAAAAAAAGQNCQwKCwJAAkAgAUEBTg0A/Qz/////////////////////IQsMAQtBACEMQQAgAWshDSACKwMAtv0TIAIrAwi2/SABIAIrAxC2/SACIAIrAxi2/SADIg4gDv3mASEPIAMrAwC2/RMgAysDCLb9IAEgAysDELb9IAIgAysDGLb9IAMiECAQ/eYBIREgCLb9EyES/Qz/////////////////////IQtBAiEEQQAhE0EAIRRBACEAQQAhFUEAIRZBACEXQQAhGEMAAAAAIRlDAAAAACEaQwAAAAAhG0MAAAAAIRxDAAAAACEdQwAAAAAhHkMAAAAAIR9DAAAAACEgQwAAAAAhIUMAAAAAISJDAAAAACEjQwAAAAAhJEEAIQNBACElQQEhBUEAIQJBASEmIBAhKCAOISkCQANAICkgKf3kASEnAkAgC/0MAAAAAAAAAAAAAAAAAAAAACIqIAogDyAR/eUB/eAB/eQBIikgKf3mASIPICggJ/3mASAJ/eQBIiggKP3mASIR/eQBIiv9DAAkdEkAJHRJACR0SQAkdEn9RP1SIif9GwAiLCAn/RsBIi1yICf9GwIiLnIgJ/0bAyIvckUNACAFskN3c/hCkiEwAkAgLEUNACAGIDAgK/0bACIss0MAAAA0lEN3c/jCkiAsQf///wNxQYCAgPgDcr4iMUN1v7+/lJJDo+ncvyAxQ/lEtD6SlZJDAAAAP5S8IiyzQwAAALSUkiAsQf///wNxQYCAgPgDcr4iMUN1v78/lJJDo+ncPyAxQ/lEtD6SlZI4AgAgByAo/R8AuyIyRAAAAGCeoPY/oiAyICn9HwC7IjOgIjQgNKIgMiAzoSIyIDKioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgALAkAgLUUNACAGIDAgK/0bASIss0MAAAA0lEN3c/jCkiAsQf///wNxQYCAgPgDcr4iMUN1v7+/lJJDo+ncvyAxQ/lEtD6SlZJDAAAAP5S8IiyzQwAAALSUkiAsQf///wNxQYCAgPgDcr4iMUN1v78/lJJDo+ncPyAxQ/lEtD6SlZI4AgQgByAo/R8BuyIyRAAAAGCeoPY/oiAyICn9HwG7IjOgIjQgNKIgMiAzoSIyIDKioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgQLAkAgLkUNACAGIDAgK/0bAiIss0MAAAA0lEN3c/jCkiAsQf///wNxQYCAgPgDcr4iMUN1v7+/lJJDo+ncvyAxQ/lEtD6SlZJDAAAAP5S8IiyzQwAAALSUkiAsQf///wNxQYCAgPgDcr4iMUN1v78/lJJDo+ncPyAxQ/lEtD6SlZI4AgggByAo/R8CuyIyRAAAAGCeoPY/oiAyICn9HwK7IjOgIjQgNKIgMiAzoSIyIDKioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AggLAkAgL0UNACAGIDAgK/0bAyIss0MAAAA0lEN3c/jCkiAsQf///wNxQYCAgPgDcr4iMUN1v7+/lJJDo+ncvyAxQ/lEtD6SlZJDAAAAP5S8IiyzQwAAALSUkiAsQf///wNxQYCAgPgDcr4iMEN1v78/lJJDo+ncPyAwQ/lEtD6SlZI4AgwgByAo/R8DuyIyRAAAAGCeoPY/oiAyICn9HwO7IjOgIjQgNKIgMiAzoSIyIDKioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgwLICcgC/1RIgv9GwAgC/0bAXIgC/0bAnIgC/0bA3JFDQILAkAgCEQAAAAAAAAAAGUNAAJAAkAgAg0AIAAhLEEAIQIMAQsCQCAFIAxHDQAgAkF/aiECQQAhDCAL/RsARQ0AICEgKf0fACAZk4sgKP0fACAdk4uSXQ0AIAZBgIDno3w2AgAgByAVsjgCAEEAIQwgC0EA/RwAIQsLAkAgBSATRw0AIAJBf2ohAkEAIRMgC/0bAUUNACAiICn9HwEgGpOLICj9HwEgHpOLkl0NACAGQYCA56N8NgIEIAcgFrI4AgRBACETIAtBAP0cASELCwJAIAUgFEcNACACQX9qIQJBACEUIAv9GwJFDQAgIyAp/R8CIBuTiyAo/R8CIB+Ti5JdDQAgBkGAgOejfDYCCCAHIBeyOAIIQQAhFCALQQD9HAIhCwsCQAJAIAUgAEYNACAAISwMAQsgAkF/aiECQQAhLCAL/RsDRQ0AICQgKf0fAyAck4sgKP0fAyAgk4uSXQ0AIAZBgIDno3w2AgwgByAYsjgCDEEAISwgC0EA/RwDIQsLIAv9GwAgC/0bAXIgC/0bAnIgC/0bA3JFDQMLAkACQCALICogKSAO/eUB/eABICggEP3lAf3gAf3kASIrIBL9Q/1SIif9GwAiLSAn/RsBIi5yICf9GwIiL3IgJ/0bAyI1ckUNACAEICVrIQAgBSAlayEDAkAgLUUNACAMDQAgAkEBaiECICv9HwAhISAo/R8AIR0gKf0fACEZIAAhDCADIRULAkAgLkUNACATDQAgAkEBaiECICv9HwEhIiAo/R8BIR4gKf0fASEaIAAhEyADIRYLAkAgL0UNACAUDQAgAkEBaiECICv9HwIhIyAo/R8CIR8gKf0fAiEbIAAhFCADIRcLIDVFDQAgLA0AIAJBAWohAiAr/R8DISQgKP0fAyEgICn9HwMhHAwBCyAsIQAgGCEDCwJAIAUgJkYNACADIRgMAQsgAyEYIAQhJiAFISUgKCEQICkhDgsgBEECaiEEIAUgAU4hAyANIAVBAWoiBWpBAUcNAAsLIANBAXFFDQoLAkACQAJAIAv9GwBFDQAgBkGAgOejfDYCAAJAIAhEAAAAAAAAAABkRQ0AIAdBADYCACAL/RsBRQ0DIAZBgIDno3w2AgQMAgsgC/0bAUUNAiAGQYCA56N8NgIEDAILIAv9GwFFDQEgBkGAgOejfDYCBCAIRAAAAAAAAAAAZQ0BCyAHQQA2AgQLAkAgC/0bAkUNACAGQYCA56N8NgIIAkAgCEQAAAAAAAAAAGRFDQAgB0EANgIIIAv9GwNFDQsgBkGAgOejfDYCDAwKCyAL/RsDRQ0KIAZBgIDno3w2AgwPCyAL/RsDRQ0JIAZBgIDno3w2AgwgCEQAAAAAAAAAAGQNCAwJCwJAAkAgAUEBTg0A/Qz/////////////////////IQsMAQtBACEMQQAgAWshDSACKwMAtv0TIAIrAwi2/SABIAIrAxC2/SACIAIrAxi2/SADIg4gDv3mASERIAMrAwC2/RMgAysDCLb9IAEgAysDELb9IAIgAysDGLb9IAMiECAQ/eYBISkgCLb9EyES/Qz/////////////////////IQtBAiEEQQAhE0EAIRRBACEAQQAhFUEAIRZBACEXQQAhGEMAAAAAIRlDAAAAACEaQwAAAAAhG0MAAAAAIRxDAAAAACEdQwAAAAAhHkMAAAAAIR9DAAAAACEgQwAAAAAhIUMAAAAAISJDAAAAACEjQwAAAAAhJEEAIQNBACElQQEhBUEAIQJBASEmIBAhKCAOIQ8CQANAICkgESIn/QwAAMDAAADAwAAAwMAAAMDA/eYB/eQBICn95gEhEQJAIAv9DAAAAAAAAAAAAAAAAAAAAAAiKiAnICn95QEgKP0MAACAQAAAgEAAAIBAAACAQP3mASAP/eYB/eAB/eYBIAn95AEiKCAo/eYBIikgESAnICf95gEgCv3kAf3kASIPIA/95gEiEf3kASIr/QwAJHRJACR0SQAkdEkAJHRJ/UT9UiIn/RsAIiwgJ/0bASItciAn/RsCIi5yICf9GwMiL3JFDQAgBbIhMAJAICxFDQAgBiAwICv9GwAiLLNDAAAANJRDd3P4wpIgLEH///8DcUGAgID4A3K+IjFDdb+/v5SSQ6Pp3L8gMUP5RLQ+kpWSQwAAAD+UvCIss0MAAAA0lEN3c/jCkiAsQf///wNxQYCAgPgDcr4iMUN1v7+/lJJDo+ncvyAxQ/lEtD6SlZJDAAAAP5STOAIAIAcgKP0fALsiMkQAAABgnqD2P6IgMiAP/R8AuyIzoCI0IDSiIDIgM6EiMiAyoqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIACwJAIC1FDQAgBiAwICv9GwEiLLNDAAAANJRDd3P4wpIgLEH///8DcUGAgID4A3K+IjFDdb+/v5SSQ6Pp3L8gMUP5RLQ+kpWSQwAAAD+UvCIss0MAAAA0lEN3c/jCkiAsQf///wNxQYCAgPgDcr4iMUN1v7+/lJJDo+ncvyAxQ/lEtD6SlZJDAAAAP5STOAIEIAcgKP0fAbsiMkQAAABgnqD2P6IgMiAP/R8BuyIzoCI0IDSiIDIgM6EiMiAyoqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIECwJAIC5FDQAgBiAwICv9GwIiLLNDAAAANJRDd3P4wpIgLEH///8DcUGAgID4A3K+IjFDdb+/v5SSQ6Pp3L8gMUP5RLQ+kpWSQwAAAD+UvCIss0MAAAA0lEN3c/jCkiAsQf///wNxQYCAgPgDcr4iMUN1v7+/lJJDo+ncvyAxQ/lEtD6SlZJDAAAAP5STOAIIIAcgKP0fArsiMkQAAABgnqD2P6IgMiAP/R8CuyIzoCI0IDSiIDIgM6EiMiAyoqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIICwJAIC9FDQAgBiAwICv9GwMiLLNDAAAANJRDd3P4wpIgLEH///8DcUGAgID4A3K+IjFDdb+/v5SSQ6Pp3L8gMUP5RLQ+kpWSQwAAAD+UvCIss0MAAAA0lEN3c/jCkiAsQf///wNxQYCAgPgDcr4iMUN1v7+/lJJDo+ncvyAxQ/lEtD6SlZJDAAAAP5STOAIMIAcgKP0fA7siMkQAAABgnqD2P6IgMiAP/R8DuyIzoCI0IDSiIDIgM6EiMiAyoqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIMCyAnIAv9USIL/RsAIAv9GwFyIAv9GwJyIAv9GwNyRQ0CCwJAIAhEAAAAAAAAAABlDQACQAJAIAINACAAISxBACECDAELAkAgBSAMRw0AIAJBf2ohAkEAIQwgC/0bAEUNACAhIA/9HwAgGZOLICj9HwAgHZOLkl0NACAGQYCA56N8NgIAIAcgFbI4AgBBACEMIAtBAP0cACELCwJAIAUgE0cNACACQX9qIQJBACETIAv9GwFFDQAgIiAP/R8BIBqTiyAo/R8BIB6Ti5JdDQAgBkGAgOejfDYCBCAHIBayOAIEQQAhEyALQQD9HAEhCwsCQCAFIBRHDQAgAkF/aiECQQAhFCAL/RsCRQ0AICMgD/0fAiAbk4sgKP0fAiAfk4uSXQ0AIAZBgIDno3w2AgggByAXsjgCCEEAIRQgC0EA/RwCIQsLAkACQCAFIABGDQAgACEsDAELIAJBf2ohAkEAISwgC/0bA0UNACAkIA/9HwMgHJOLICj9HwMgIJOLkl0NACAGQYCA56N8NgIMIAcgGLI4AgxBACEsIAtBAP0cAyELCyAL/RsAIAv9GwFyIAv9GwJyIAv9GwNyRQ0DCwJAAkAgCyAqICggEP3lAf3gASAPIA795QH94AH95AEiKyAS/UP9UiIn/RsAIi0gJ/0bASIuciAn/RsCIi9yICf9GwMiNXJFDQAgBCAlayEAIAUgJWshAwJAIC1FDQAgDA0AIAJBAWohAiAr/R8AISEgKP0fACEdIA/9HwAhGSAAIQwgAyEVCwJAIC5FDQAgEw0AIAJBAWohAiAr/R8BISIgKP0fASEeIA/9HwEhGiAAIRMgAyEWCwJAIC9FDQAgFA0AIAJBAWohAiAr/R8CISMgKP0fAiEfIA/9HwIhGyAAIRQgAyEXCyA1RQ0AICwNACACQQFqIQIgK/0fAyEkICj9HwMhICAP/R8DIRwMAQsgLCEAIBghAwsCQCAFICZGDQAgAyEYDAELIAMhGCAEISYgBSElICghECAPIQ4LIARBAmohBCAFIAFOIQMgDSAFQQFqIgVqQQFHDQALCyADQQFxRQ0JCwJAAkACQCAL/RsARQ0AIAZBgIDno3w2AgACQCAIRAAAAAAAAAAAZEUNACAHQQA2AgAgC/0bAUUNAyAGQYCA56N8NgIEDAILIAv9GwFFDQIgBkGAgOejfDYCBAwCCyAL/RsBRQ0BIAZBgIDno3w2AgQgCEQAAAAAAAAAAGUNAQsgB0EANgIECwJAIAv9GwJFDQAgBkGAgOejfDYCCAJAIAhEAAAAAAAAAABkRQ0AIAdBADYCCCAL/RsDRQ0KIAZBgIDno3w2AgwMCQsgC/0bA0UNCSAGQYCA56N8NgIMDwsgC/0bA0UNCCAGQYCA56N8NgIMIAhEAAAAAAAAAABkDQcMCAsCQAJAIAFBAU4NAP0M/////////////////////yEqDAELQQAhDEEAIAFrIQ0gAisDALb9EyACKwMItv0gASACKwMQtv0gAiACKwMYtv0gAyIOIA795gEhDyADKwMAtv0TIAMrAwi2/SABIAMrAxC2/SACIAMrAxi2/SADIhAgEP3mASERIAi2/RMhEv0M/////////////////////yEqQQIhBEEAIRNBACEUQQAhAEEAIRVBACEWQQAhF0EAIRhDAAAAACEZQwAAAAAhGkMAAAAAIRtDAAAAACEcQwAAAAAhHUMAAAAAIR5DAAAAACEfQwAAAAAhIEMAAAAAISFDAAAAACEiQwAAAAAhI0MAAAAAISRBACEDQQAhJUEBIQVBACECQQEhJiAQIScgDiEoAkADQCAP/QwAAEBAAABAQAAAQEAAAEBAIin95gEhCwJAICr9DAAAAAAAAAAAAAAAAAAAAAAiKyAPIBEiESAp/eYB/eUBICj94AH95gEgCv3kASIoICj95gEiDyALIBH95QEgJ/3gAf3mASAJ/eQBIicgJ/3mASIR/eQBIgv9DAAkdEkAJHRJACR0SQAkdEn9RP1SIin9GwAiLCAp/RsBIi1yICn9GwIiLnIgKf0bAyIvckUNACAFsiEwAkAgLEUNACAGIDAgC/0bACIss0MAAAA0lEN3c/jCkiAsQf///wNxQYCAgPgDcr4iMUN1v7+/lJJDo+ncvyAxQ/lEtD6SlZJDAAAAP5S8IiyzQwAAADSUQ3dz+MKSICxB////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkOdhCG/lJI4AgAgByAn/R8AuyIyRAAAAGCeoPY/oiAyICj9HwC7IjOgIjQgNKIgMiAzoSIyIDKioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgALAkAgLUUNACAGIDAgC/0bASIss0MAAAA0lEN3c/jCkiAsQf///wNxQYCAgPgDcr4iMUN1v7+/lJJDo+ncvyAxQ/lEtD6SlZJDAAAAP5S8IiyzQwAAADSUQ3dz+MKSICxB////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkOdhCG/lJI4AgQgByAn/R8BuyIyRAAAAGCeoPY/oiAyICj9HwG7IjOgIjQgNKIgMiAzoSIyIDKioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgQLAkAgLkUNACAGIDAgC/0bAiIss0MAAAA0lEN3c/jCkiAsQf///wNxQYCAgPgDcr4iMUN1v7+/lJJDo+ncvyAxQ/lEtD6SlZJDAAAAP5S8IiyzQwAAADSUQ3dz+MKSICxB////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkOdhCG/lJI4AgggByAn/R8CuyIyRAAAAGCeoPY/oiAyICj9HwK7IjOgIjQgNKIgMiAzoSIyIDKioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AggLAkAgL0UNACAGIDAgC/0bAyIss0MAAAA0lEN3c/jCkiAsQf///wNxQYCAgPgDcr4iMUN1v7+/lJJDo+ncvyAxQ/lEtD6SlZJDAAAAP5S8IiyzQwAAADSUQ3dz+MKSICxB////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkOdhCG/lJI4AgwgByAn/R8DuyIyRAAAAGCeoPY/oiAyICj9HwO7IjOgIjQgNKIgMiAzoSIyIDKioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgwLICkgKv1RIir9GwAgKv0bAXIgKv0bAnIgKv0bA3JFDQILAkAgCEQAAAAAAAAAAGUNAAJAAkAgAg0AIAAhLEEAIQIMAQsCQCAFIAxHDQAgAkF/aiECQQAhDCAq/RsARQ0AICEgKP0fACAZk4sgJ/0fACAdk4uSXQ0AIAZBgIDno3w2AgAgByAVsjgCAEEAIQwgKkEA/RwAISoLAkAgBSATRw0AIAJBf2ohAkEAIRMgKv0bAUUNACAiICj9HwEgGpOLICf9HwEgHpOLkl0NACAGQYCA56N8NgIEIAcgFrI4AgRBACETICpBAP0cASEqCwJAIAUgFEcNACACQX9qIQJBACEUICr9GwJFDQAgIyAo/R8CIBuTiyAn/R8CIB+Ti5JdDQAgBkGAgOejfDYCCCAHIBeyOAIIQQAhFCAqQQD9HAIhKgsCQAJAIAUgAEYNACAAISwMAQsgAkF/aiECQQAhLCAq/RsDRQ0AICQgKP0fAyAck4sgJ/0fAyAgk4uSXQ0AIAZBgIDno3w2AgwgByAYsjgCDEEAISwgKkEA/RwDISoLICr9GwAgKv0bAXIgKv0bAnIgKv0bA3JFDQMLAkACQCAqICsgKCAO/eUB/eABICcgEP3lAf3gAf3kASILIBL9Q/1SIin9GwAiLSAp/RsBIi5yICn9GwIiL3IgKf0bAyI1ckUNACAEICVrIQAgBSAlayEDAkAgLUUNACAMDQAgAkEBaiECIAv9HwAhISAn/R8AIR0gKP0fACEZIAAhDCADIRULAkAgLkUNACATDQAgAkEBaiECIAv9HwEhIiAn/R8BIR4gKP0fASEaIAAhEyADIRYLAkAgL0UNACAUDQAgAkEBaiECIAv9HwIhIyAn/R8CIR8gKP0fAiEbIAAhFCADIRcLIDVFDQAgLA0AIAJBAWohAiAL/R8DISQgJ/0fAyEgICj9HwMhHAwBCyAsIQAgGCEDCwJAIAUgJkYNACADIRgMAQsgAyEYIAQhJiAFISUgJyEQICghDgsgBEECaiEEIAUgAU4hAyANIAVBAWoiBWpBAUcNAAsLIANBAXFFDQgLAkACQAJAICr9GwBFDQAgBkGAgOejfDYCAAJAIAhEAAAAAAAAAABkRQ0AIAdBADYCACAq/RsBRQ0DIAZBgIDno3w2AgQMAgsgKv0bAUUNAiAGQYCA56N8NgIEDAILICr9GwFFDQEgBkGAgOejfDYCBCAIRAAAAAAAAAAAZQ0BCyAHQQA2AgQLAkAgKv0bAkUNACAGQYCA56N8NgIIAkAgCEQAAAAAAAAAAGRFDQAgB0EANgIIICr9GwNFDQkgBkGAgOejfDYCDAwICyAq/RsDRQ0IIAZBgIDno3w2AgwPCyAq/RsDRQ0HIAZBgIDno3w2AgwgCEQAAAAAAAAAAGQNBgwHCwJAAkAgAUEBTg0A/Qz/////////////////////IQsMAQtBACEMQQAgAWshDSACKwMAtv0TIAIrAwi2/SABIAIrAxC2/SACIAIrAxi2/SADIg4gDv3mASEPIAMrAwC2/RMgAysDCLb9IAEgAysDELb9IAIgAysDGLb9IAMiECAQ/eYBIREgCLb9EyES/Qz/////////////////////IQtBAiEEQQAhE0EAIRRBACEAQQAhFUEAIRZBACEXQQAhGEMAAAAAIRlDAAAAACEaQwAAAAAhG0MAAAAAIRxDAAAAACEdQwAAAAAhHkMAAAAAIR9DAAAAACEgQwAAAAAhIUMAAAAAISJDAAAAACEjQwAAAAAhJEEAIQNBACElQQEhBUEAIQJBASEmIBAhJyAOISgCQANAIA8gEf3lASEpAkAgC/0MAAAAAAAAAAAAAAAAAAAAACIqIAkgJyAoIiggKP3kAf3mAf3gAf3kASInICf95gEiESApIAr95AEiKCAo/eYBIg/95AEiK/0MACR0SQAkdEkAJHRJACR0Sf1E/VIiKf0bACIsICn9GwEiLXIgKf0bAiIuciAp/RsDIi9yRQ0AIAWyQ3dz+EKSITACQCAsRQ0AIAYgMCAr/RsAIiyzQwAAADSUQ3dz+MKSICxB////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkMAAAA/lLwiLLNDAAAAtJSSICxB////A3FBgICA+ANyviIxQ3W/vz+UkkOj6dw/IDFD+US0PpKVkjgCACAHICf9HwC7IjJEAAAAYJ6g9j+iIDIgKP0fALsiM6AiNCA0oiAyIDOhIjIgMqKgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCAAsCQCAtRQ0AIAYgMCAr/RsBIiyzQwAAADSUQ3dz+MKSICxB////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkMAAAA/lLwiLLNDAAAAtJSSICxB////A3FBgICA+ANyviIxQ3W/vz+UkkOj6dw/IDFD+US0PpKVkjgCBCAHICf9HwG7IjJEAAAAYJ6g9j+iIDIgKP0fAbsiM6AiNCA0oiAyIDOhIjIgMqKgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCBAsCQCAuRQ0AIAYgMCAr/RsCIiyzQwAAADSUQ3dz+MKSICxB////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkMAAAA/lLwiLLNDAAAAtJSSICxB////A3FBgICA+ANyviIxQ3W/vz+UkkOj6dw/IDFD+US0PpKVkjgCCCAHICf9HwK7IjJEAAAAYJ6g9j+iIDIgKP0fArsiM6AiNCA0oiAyIDOhIjIgMqKgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCCAsCQCAvRQ0AIAYgMCAr/RsDIiyzQwAAADSUQ3dz+MKSICxB////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkMAAAA/lLwiLLNDAAAAtJSSICxB////A3FBgICA+ANyviIwQ3W/vz+UkkOj6dw/IDBD+US0PpKVkjgCDCAHICf9HwO7IjJEAAAAYJ6g9j+iIDIgKP0fA7siM6AiNCA0oiAyIDOhIjIgMqKgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCDAsgKSAL/VEiC/0bACAL/RsBciAL/RsCciAL/RsDckUNAgsCQCAIRAAAAAAAAAAAZQ0AAkACQCACDQAgACEsQQAhAgwBCwJAIAUgDEcNACACQX9qIQJBACEMIAv9GwBFDQAgISAo/R8AIBmTiyAn/R8AIB2Ti5JdDQAgBkGAgOejfDYCACAHIBWyOAIAQQAhDCALQQD9HAAhCwsCQCAFIBNHDQAgAkF/aiECQQAhEyAL/RsBRQ0AICIgKP0fASAak4sgJ/0fASAek4uSXQ0AIAZBgIDno3w2AgQgByAWsjgCBEEAIRMgC0EA/RwBIQsLAkAgBSAURw0AIAJBf2ohAkEAIRQgC/0bAkUNACAjICj9HwIgG5OLICf9HwIgH5OLkl0NACAGQYCA56N8NgIIIAcgF7I4AghBACEUIAtBAP0cAiELCwJAAkAgBSAARg0AIAAhLAwBCyACQX9qIQJBACEsIAv9GwNFDQAgJCAo/R8DIByTiyAn/R8DICCTi5JdDQAgBkGAgOejfDYCDCAHIBiyOAIMQQAhLCALQQD9HAMhCwsgC/0bACAL/RsBciAL/RsCciAL/RsDckUNAwsCQAJAIAsgKiAnIBD95QH94AEgKCAO/eUB/eAB/eQBIisgEv1D/VIiKf0bACItICn9GwEiLnIgKf0bAiIvciAp/RsDIjVyRQ0AIAQgJWshACAFICVrIQMCQCAtRQ0AIAwNACACQQFqIQIgK/0fACEhICf9HwAhHSAo/R8AIRkgACEMIAMhFQsCQCAuRQ0AIBMNACACQQFqIQIgK/0fASEiICf9HwEhHiAo/R8BIRogACETIAMhFgsCQCAvRQ0AIBQNACACQQFqIQIgK/0fAiEjICf9HwIhHyAo/R8CIRsgACEUIAMhFwsgNUUNACAsDQAgAkEBaiECICv9HwMhJCAn/R8DISAgKP0fAyEcDAELICwhACAYIQMLAkAgBSAmRg0AIAMhGAwBCyADIRggBCEmIAUhJSAnIRAgKCEOCyAEQQJqIQQgBSABTiEDIA0gBUEBaiIFakEBRw0ACwsgA0EBcUUNBwsCQAJAAkAgC/0bAEUNACAGQYCA56N8NgIAAkAgCEQAAAAAAAAAAGRFDQAgB0EANgIAIAv9GwFFDQMgBkGAgOejfDYCBAwCCyAL/RsBRQ0CIAZBgIDno3w2AgQMAgsgC/0bAUUNASAGQYCA56N8NgIEIAhEAAAAAAAAAABlDQELIAdBADYCBAsCQCAL/RsCRQ0AIAZBgIDno3w2AggCQCAIRAAAAAAAAAAAZEUNACAHQQA2AgggC/0bA0UNCCAGQYCA56N8NgIMDAcLIAv9GwNFDQcgBkGAgOejfDYCDA8LIAv9GwNFDQYgBkGAgOejfDYCDCAIRAAAAAAAAAAAZA0FDAYLAkACQCABQQFODQD9DP////////////////////8hEgwBC0EAIQxBACABayENIAIrAwC2/RMgAisDCLb9IAEgAisDELb9IAIgAisDGLb9IAMiNiA2/eYBISkgAysDALb9EyADKwMItv0gASADKwMQtv0gAiADKwMYtv0gAyI3IDf95gEhESAItv0TITj9DP////////////////////8hEkECIQRBACETQQAhFEEAIQBBACEVQQAhFkEAIRdBACEYQwAAAAAhGUMAAAAAIRpDAAAAACEbQwAAAAAhHEMAAAAAIR1DAAAAACEeQwAAAAAhH0MAAAAAISBDAAAAACEhQwAAAAAhIkMAAAAAISNDAAAAACEkQQAhA0EAISVBASEFQQAhAkEBISYgNyEoIDYhDwJAA0AgKf0MAADgQAAA4EAAAOBAAADgQCIL/eYBISogKf0MAACoQQAAqEEAAKhBAACoQSIr/eYBIQ4CQCAS/QwAAAAAAAAAAAAAAAAAAAAAIjkgKf0MAAAMQgAADEIAAAxCAAAMQiIQ/eYBIBEiJyAL/eYB/eUBICcgJ/3mASIR/eYBICkgJyAr/eYB/eUBICkgKf3mASIL/eYB/eQBIA/95gEgCv3kASIPIA/95gEiKSALICogJyAQ/eYB/eUB/eYBIA4gJ/3lASAR/eYB/eQBICj95gEgCf3kASIoICj95gEiEf3kASIL/QwAJHRJACR0SQAkdEkAJHRJ/UT9UiIn/RsAIiwgJ/0bASItciAn/RsCIi5yICf9GwMiL3JFDQAgBbIhMAJAICxFDQAgBiAwIAv9GwAiLLNDAAAANJRDd3P4wpIgLEH///8DcUGAgID4A3K+IjFDdb+/v5SSQ6Pp3L8gMUP5RLQ+kpWSQwAAAD+UvCIss0MAAAA0lEN3c/jCkiAsQf///wNxQYCAgPgDcr4iMUN1v7+/lJJDo+ncvyAxQ/lEtD6SlZJDymC2vpSSOAIAIAcgKP0fALsiMkQAAABgnqD2P6IgMiAP/R8AuyIzoCI0IDSiIDIgM6EiMiAyoqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIACwJAIC1FDQAgBiAwIAv9GwEiLLNDAAAANJRDd3P4wpIgLEH///8DcUGAgID4A3K+IjFDdb+/v5SSQ6Pp3L8gMUP5RLQ+kpWSQwAAAD+UvCIss0MAAAA0lEN3c/jCkiAsQf///wNxQYCAgPgDcr4iMUN1v7+/lJJDo+ncvyAxQ/lEtD6SlZJDymC2vpSSOAIEIAcgKP0fAbsiMkQAAABgnqD2P6IgMiAP/R8BuyIzoCI0IDSiIDIgM6EiMiAyoqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIECwJAIC5FDQAgBiAwIAv9GwIiLLNDAAAANJRDd3P4wpIgLEH///8DcUGAgID4A3K+IjFDdb+/v5SSQ6Pp3L8gMUP5RLQ+kpWSQwAAAD+UvCIss0MAAAA0lEN3c/jCkiAsQf///wNxQYCAgPgDcr4iMUN1v7+/lJJDo+ncvyAxQ/lEtD6SlZJDymC2vpSSOAIIIAcgKP0fArsiMkQAAABgnqD2P6IgMiAP/R8CuyIzoCI0IDSiIDIgM6EiMiAyoqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIICwJAIC9FDQAgBiAwIAv9GwMiLLNDAAAANJRDd3P4wpIgLEH///8DcUGAgID4A3K+IjFDdb+/v5SSQ6Pp3L8gMUP5RLQ+kpWSQwAAAD+UvCIss0MAAAA0lEN3c/jCkiAsQf///wNxQYCAgPgDcr4iMUN1v7+/lJJDo+ncvyAxQ/lEtD6SlZJDymC2vpSSOAIMIAcgKP0fA7siMkQAAABgnqD2P6IgMiAP/R8DuyIzoCI0IDSiIDIgM6EiMiAyoqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIMCyAnIBL9USIS/RsAIBL9GwFyIBL9GwJyIBL9GwNyRQ0CCwJAIAhEAAAAAAAAAABlDQACQAJAIAINACAAISxBACECDAELAkAgBSAMRw0AIAJBf2ohAkEAIQwgEv0bAEUNACAhIA/9HwAgGZOLICj9HwAgHZOLkl0NACAGQYCA56N8NgIAIAcgFbI4AgBBACEMIBJBAP0cACESCwJAIAUgE0cNACACQX9qIQJBACETIBL9GwFFDQAgIiAP/R8BIBqTiyAo/R8BIB6Ti5JdDQAgBkGAgOejfDYCBCAHIBayOAIEQQAhEyASQQD9HAEhEgsCQCAFIBRHDQAgAkF/aiECQQAhFCAS/RsCRQ0AICMgD/0fAiAbk4sgKP0fAiAfk4uSXQ0AIAZBgIDno3w2AgggByAXsjgCCEEAIRQgEkEA/RwCIRILAkACQCAFIABGDQAgACEsDAELIAJBf2ohAkEAISwgEv0bA0UNACAkIA/9HwMgHJOLICj9HwMgIJOLkl0NACAGQYCA56N8NgIMIAcgGLI4AgxBACEsIBJBAP0cAyESCyAS/RsAIBL9GwFyIBL9GwJyIBL9GwNyRQ0DCwJAAkAgEiA5IA8gNv3lAf3gASAoIDf95QH94AH95AEiCyA4/UP9UiIn/RsAIi0gJ/0bASIuciAn/RsCIi9yICf9GwMiNXJFDQAgBCAlayEAIAUgJWshAwJAIC1FDQAgDA0AIAJBAWohAiAL/R8AISEgKP0fACEdIA/9HwAhGSAAIQwgAyEVCwJAIC5FDQAgEw0AIAJBAWohAiAL/R8BISIgKP0fASEeIA/9HwEhGiAAIRMgAyEWCwJAIC9FDQAgFA0AIAJBAWohAiAL/R8CISMgKP0fAiEfIA/9HwIhGyAAIRQgAyEXCyA1RQ0AICwNACACQQFqIQIgC/0fAyEkICj9HwMhICAP/R8DIRwMAQsgLCEAIBghAwsCQCAFICZGDQAgAyEYDAELIAMhGCAEISYgBSElICghNyAPITYLIARBAmohBCAFIAFOIQMgDSAFQQFqIgVqQQFHDQALCyADQQFxRQ0GCwJAAkACQCAS/RsARQ0AIAZBgIDno3w2AgACQCAIRAAAAAAAAAAAZEUNACAHQQA2AgAgEv0bAUUNAyAGQYCA56N8NgIEDAILIBL9GwFFDQIgBkGAgOejfDYCBAwCCyAS/RsBRQ0BIAZBgIDno3w2AgQgCEQAAAAAAAAAAGUNAQsgB0EANgIECwJAIBL9GwJFDQAgBkGAgOejfDYCCAJAIAhEAAAAAAAAAABkRQ0AIAdBADYCCCAS/RsDRQ0HIAZBgIDno3w2AgwMBgsgEv0bA0UNBiAGQYCA56N8NgIMDwsgEv0bA0UNBSAGQYCA56N8NgIMIAhEAAAAAAAAAABkDQQMBQsCQAJAIAFBAU4NAP0M/////////////////////yEODAELQQAhDEEAIAFrIQ0gAisDALb9EyACKwMItv0gASACKwMQtv0gAiACKwMYtv0gAyISIBL95gEhESADKwMAtv0TIAMrAwi2/SABIAMrAxC2/SACIAMrAxi2/SADIjkgOf3mASEpIAi2/RMhNv0M/////////////////////yEOQQIhBEEAIRNBACEUQQAhAEEAIRVBACEWQQAhF0EAIRhDAAAAACEZQwAAAAAhGkMAAAAAIRtDAAAAACEcQwAAAAAhHUMAAAAAIR5DAAAAACEfQwAAAAAhIEMAAAAAISFDAAAAACEiQwAAAAAhI0MAAAAAISRBACEDQQAhJUEBIQVBACECQQEhJiA5ISggEiEPAkADQCARIicgJ/3mASIR/QwAAHBBAABwQQAAcEEAAHBBIir95gEgKSAp/eYBIgv95AEgKf3mASErAkAgDv0MAAAAAAAAAAAAAAAAAAAAACIQIA8gKP3mASARIAv95AH9DAAAwEAAAMBAAADAQAAAwED95gEgKf0MAACgwQAAoMEAAKDBAACgwf3mASAn/eYB/eQB/eYBIAn95AEiKCAo/eYBIikgCiAr/eUBIAsgKv3mASAR/eQBICf95gH95AEiDyAP/eYBIhH95AEiC/0MACR0SQAkdEkAJHRJACR0Sf1E/VIiJ/0bACIsICf9GwEiLXIgJ/0bAiIuciAn/RsDIi9yRQ0AIAWyITACQCAsRQ0AIAYgMCAL/RsAIiyzQwAAADSUQ3dz+MKSICxB////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkMAAAA/lLwiLLNDAAAANJRDd3P4wpIgLEH///8DcUGAgID4A3K+IjFDdb+/v5SSQ6Pp3L8gMUP5RLQ+kpWSQ5IRxr6UkjgCACAHICj9HwC7IjJEAAAAYJ6g9j+iIDIgD/0fALsiM6AiNCA0oiAyIDOhIjIgMqKgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCAAsCQCAtRQ0AIAYgMCAL/RsBIiyzQwAAADSUQ3dz+MKSICxB////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkMAAAA/lLwiLLNDAAAANJRDd3P4wpIgLEH///8DcUGAgID4A3K+IjFDdb+/v5SSQ6Pp3L8gMUP5RLQ+kpWSQ5IRxr6UkjgCBCAHICj9HwG7IjJEAAAAYJ6g9j+iIDIgD/0fAbsiM6AiNCA0oiAyIDOhIjIgMqKgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCBAsCQCAuRQ0AIAYgMCAL/RsCIiyzQwAAADSUQ3dz+MKSICxB////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkMAAAA/lLwiLLNDAAAANJRDd3P4wpIgLEH///8DcUGAgID4A3K+IjFDdb+/v5SSQ6Pp3L8gMUP5RLQ+kpWSQ5IRxr6UkjgCCCAHICj9HwK7IjJEAAAAYJ6g9j+iIDIgD/0fArsiM6AiNCA0oiAyIDOhIjIgMqKgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCCAsCQCAvRQ0AIAYgMCAL/RsDIiyzQwAAADSUQ3dz+MKSICxB////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkMAAAA/lLwiLLNDAAAANJRDd3P4wpIgLEH///8DcUGAgID4A3K+IjFDdb+/v5SSQ6Pp3L8gMUP5RLQ+kpWSQ5IRxr6UkjgCDCAHICj9HwO7IjJEAAAAYJ6g9j+iIDIgD/0fA7siM6AiNCA0oiAyIDOhIjIgMqKgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCDAsgJyAO/VEiDv0bACAO/RsBciAO/RsCciAO/RsDckUNAgsCQCAIRAAAAAAAAAAAZQ0AAkACQCACDQAgACEsQQAhAgwBCwJAIAUgDEcNACACQX9qIQJBACEMIA79GwBFDQAgISAP/R8AIBmTiyAo/R8AIB2Ti5JdDQAgBkGAgOejfDYCACAHIBWyOAIAQQAhDCAOQQD9HAAhDgsCQCAFIBNHDQAgAkF/aiECQQAhEyAO/RsBRQ0AICIgD/0fASAak4sgKP0fASAek4uSXQ0AIAZBgIDno3w2AgQgByAWsjgCBEEAIRMgDkEA/RwBIQ4LAkAgBSAURw0AIAJBf2ohAkEAIRQgDv0bAkUNACAjIA/9HwIgG5OLICj9HwIgH5OLkl0NACAGQYCA56N8NgIIIAcgF7I4AghBACEUIA5BAP0cAiEOCwJAAkAgBSAARg0AIAAhLAwBCyACQX9qIQJBACEsIA79GwNFDQAgJCAP/R8DIByTiyAo/R8DICCTi5JdDQAgBkGAgOejfDYCDCAHIBiyOAIMQQAhLCAOQQD9HAMhDgsgDv0bACAO/RsBciAO/RsCciAO/RsDckUNAwsCQAJAIA4gECAPIBL95QH94AEgKCA5/eUB/eAB/eQBIgsgNv1D/VIiJ/0bACItICf9GwEiLnIgJ/0bAiIvciAn/RsDIjVyRQ0AIAQgJWshACAFICVrIQMCQCAtRQ0AIAwNACACQQFqIQIgC/0fACEhICj9HwAhHSAP/R8AIRkgACEMIAMhFQsCQCAuRQ0AIBMNACACQQFqIQIgC/0fASEiICj9HwEhHiAP/R8BIRogACETIAMhFgsCQCAvRQ0AIBQNACACQQFqIQIgC/0fAiEjICj9HwIhHyAP/R8CIRsgACEUIAMhFwsgNUUNACAsDQAgAkEBaiECIAv9HwMhJCAo/R8DISAgD/0fAyEcDAELICwhACAYIQMLAkAgBSAmRg0AIAMhGAwBCyADIRggBCEmIAUhJSAoITkgDyESCyAEQQJqIQQgBSABTiEDIA0gBUEBaiIFakEBRw0ACwsgA0EBcUUNBQsCQAJAAkAgDv0bAEUNACAGQYCA56N8NgIAAkAgCEQAAAAAAAAAAGRFDQAgB0EANgIAIA79GwFFDQMgBkGAgOejfDYCBAwCCyAO/RsBRQ0CIAZBgIDno3w2AgQMAgsgDv0bAUUNASAGQYCA56N8NgIEIAhEAAAAAAAAAABlDQELIAdBADYCBAsCQCAO/RsCRQ0AIAZBgIDno3w2AggCQCAIRAAAAAAAAAAAZEUNACAHQQA2AgggDv0bA0UNBiAGQYCA56N8NgIMDAULIA79GwNFDQUgBkGAgOejfDYCDA8LIA79GwNFDQQgBkGAgOejfDYCDCAIRAAAAAAAAAAAZA0DDAQLAkACQCABQQFODQD9DP////////////////////8hKwwBC0EAIQxBACABayENIAIrAwC2/RMgAisDCLb9IAEgAisDELb9IAIgAisDGLb9IAMiECAQ/eYBIREgAysDALb9EyADKwMItv0gASADKwMQtv0gAiADKwMYtv0gAyISIBL95gEhKSAItv0TITn9DP////////////////////8hK0ECIQRBACETQQAhFEEAIQBBACEVQQAhFkEAIRdBACEYQwAAAAAhGUMAAAAAIRpDAAAAACEbQwAAAAAhHEMAAAAAIR1DAAAAACEeQwAAAAAhH0MAAAAAISBDAAAAACEhQwAAAAAhIkMAAAAAISNDAAAAACEkQQAhA0EAISVBASEFQQAhAkEBISYgEiEoIBAhDwJAA0ACQCAr/QwAAAAAAAAAAAAAAAAAAAAAIg4gESIn/QwAAKBAAACgQAAAoEAAAKBAIhH95gEgKf0MAAAgQQAAIEEAACBBAAAgQf3mASIL/eUBICf95gEgKSAp/eYBIir95AEgKP3mASAJ/eQBIiggKP3mASIpICcgC/3lASAn/eYBICogEf3mAf3kASAP/eYBIAr95AEiDyAP/eYBIhH95AEiC/0MACR0SQAkdEkAJHRJACR0Sf1E/VIiJ/0bACIsICf9GwEiLXIgJ/0bAiIuciAn/RsDIi9yRQ0AIAWyITACQCAsRQ0AIAYgMCAL/RsAIiyzQwAAADSUQ3dz+MKSICxB////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkMAAAA/lLwiLLNDAAAANJRDd3P4wpIgLEH///8DcUGAgID4A3K+IjFDdb+/v5SSQ6Pp3L8gMUP5RLQ+kpWSQ6OB3L6UkjgCACAHICj9HwC7IjJEAAAAYJ6g9j+iIDIgD/0fALsiM6AiNCA0oiAyIDOhIjIgMqKgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCAAsCQCAtRQ0AIAYgMCAL/RsBIiyzQwAAADSUQ3dz+MKSICxB////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkMAAAA/lLwiLLNDAAAANJRDd3P4wpIgLEH///8DcUGAgID4A3K+IjFDdb+/v5SSQ6Pp3L8gMUP5RLQ+kpWSQ6OB3L6UkjgCBCAHICj9HwG7IjJEAAAAYJ6g9j+iIDIgD/0fAbsiM6AiNCA0oiAyIDOhIjIgMqKgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCBAsCQCAuRQ0AIAYgMCAL/RsCIiyzQwAAADSUQ3dz+MKSICxB////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkMAAAA/lLwiLLNDAAAANJRDd3P4wpIgLEH///8DcUGAgID4A3K+IjFDdb+/v5SSQ6Pp3L8gMUP5RLQ+kpWSQ6OB3L6UkjgCCCAHICj9HwK7IjJEAAAAYJ6g9j+iIDIgD/0fArsiM6AiNCA0oiAyIDOhIjIgMqKgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCCAsCQCAvRQ0AIAYgMCAL/RsDIiyzQwAAADSUQ3dz+MKSICxB////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkMAAAA/lLwiLLNDAAAANJRDd3P4wpIgLEH///8DcUGAgID4A3K+IjFDdb+/v5SSQ6Pp3L8gMUP5RLQ+kpWSQ6OB3L6UkjgCDCAHICj9HwO7IjJEAAAAYJ6g9j+iIDIgD/0fA7siM6AiNCA0oiAyIDOhIjIgMqKgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCDAsgJyAr/VEiK/0bACAr/RsBciAr/RsCciAr/RsDckUNAgsCQCAIRAAAAAAAAAAAZQ0AAkACQCACDQAgACEsQQAhAgwBCwJAIAUgDEcNACACQX9qIQJBACEMICv9GwBFDQAgISAP/R8AIBmTiyAo/R8AIB2Ti5JdDQAgBkGAgOejfDYCACAHIBWyOAIAQQAhDCArQQD9HAAhKwsCQCAFIBNHDQAgAkF/aiECQQAhEyAr/RsBRQ0AICIgD/0fASAak4sgKP0fASAek4uSXQ0AIAZBgIDno3w2AgQgByAWsjgCBEEAIRMgK0EA/RwBISsLAkAgBSAURw0AIAJBf2ohAkEAIRQgK/0bAkUNACAjIA/9HwIgG5OLICj9HwIgH5OLkl0NACAGQYCA56N8NgIIIAcgF7I4AghBACEUICtBAP0cAiErCwJAAkAgBSAARg0AIAAhLAwBCyACQX9qIQJBACEsICv9GwNFDQAgJCAP/R8DIByTiyAo/R8DICCTi5JdDQAgBkGAgOejfDYCDCAHIBiyOAIMQQAhLCArQQD9HAMhKwsgK/0bACAr/RsBciAr/RsCciAr/RsDckUNAwsCQAJAICsgDiAoIBL95QH94AEgDyAQ/eUB/eAB/eQBIgsgOf1D/VIiJ/0bACItICf9GwEiLnIgJ/0bAiIvciAn/RsDIjVyRQ0AIAQgJWshACAFICVrIQMCQCAtRQ0AIAwNACACQQFqIQIgC/0fACEhICj9HwAhHSAP/R8AIRkgACEMIAMhFQsCQCAuRQ0AIBMNACACQQFqIQIgC/0fASEiICj9HwEhHiAP/R8BIRogACETIAMhFgsCQCAvRQ0AIBQNACACQQFqIQIgC/0fAiEjICj9HwIhHyAP/R8CIRsgACEUIAMhFwsgNUUNACAsDQAgAkEBaiECIAv9HwMhJCAo/R8DISAgD/0fAyEcDAELICwhACAYIQMLAkAgBSAmRg0AIAMhGAwBCyADIRggBCEmIAUhJSAoIRIgDyEQCyAEQQJqIQQgBSABTiEDIA0gBUEBaiIFakEBRw0ACwsgA0EBcUUNBAsCQAJAAkAgK/0bAEUNACAGQYCA56N8NgIAAkAgCEQAAAAAAAAAAGRFDQAgB0EANgIAICv9GwFFDQMgBkGAgOejfDYCBAwCCyAr/RsBRQ0CIAZBgIDno3w2AgQMAgsgK/0bAUUNASAGQYCA56N8NgIEIAhEAAAAAAAAAABlDQELIAdBADYCBAsCQCAr/RsCRQ0AIAZBgIDno3w2AggCQCAIRAAAAAAAAAAAZEUNACAHQQA2AgggK/0bA0UNBSAGQYCA56N8NgIMDAQLICv9GwNFDQQgBkGAgOejfDYCDA8LICv9GwNFDQMgBkGAgOejfDYCDCAIRAAAAAAAAAAAZA0CDAMLAkACQCABQQFODQD9DP////////////////////8hKwwBC0EAIQxBACABayENIAIrAwC2/RMgAisDCLb9IAEgAisDELb9IAIgAisDGLb9IAMiECAQ/eYBIREgAysDALb9EyADKwMItv0gASADKwMQtv0gAiADKwMYtv0gAyISIBL95gEhKSAItv0TITn9DP////////////////////8hK0ECIQRBACETQQAhFEEAIQBBACEVQQAhFkEAIRdBACEYQwAAAAAhGUMAAAAAIRpDAAAAACEbQwAAAAAhHEMAAAAAIR1DAAAAACEeQwAAAAAhH0MAAAAAISBDAAAAACEhQwAAAAAhIkMAAAAAISNDAAAAACEkQQAhA0EAISVBASEFQQAhAkEBISYgEiEoIBAhDwJAA0AgKSAp/eYBIQsgKf0MAADAwAAAwMAAAMDAAADAwP3mASEqAkAgK/0MAAAAAAAAAAAAAAAAAAAAACIOICj9DAAAgEAAAIBAAACAQAAAgED95gEgESInICn95QH95gEgD/3mASAJ/eQBIiggKP3mASIpIAsgCv3kASAnICr95AEgJ/3mAf3kASIPIA/95gEiEf3kASIL/QwAJHRJACR0SQAkdEkAJHRJ/UT9UiIn/RsAIiwgJ/0bASItciAn/RsCIi5yICf9GwMiL3JFDQAgBbIhMAJAICxFDQAgBiAwIAv9GwAiLLNDAAAANJRDd3P4wpIgLEH///8DcUGAgID4A3K+IjFDdb+/v5SSQ6Pp3L8gMUP5RLQ+kpWSQwAAAD+UvCIss0MAAAA0lEN3c/jCkiAsQf///wNxQYCAgPgDcr4iMUN1v7+/lJJDo+ncvyAxQ/lEtD6SlZJDAAAAP5STOAIAIAcgKP0fALsiMkQAAABgnqD2P6IgMiAP/R8AuyIzoCI0IDSiIDIgM6EiMiAyoqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIACwJAIC1FDQAgBiAwIAv9GwEiLLNDAAAANJRDd3P4wpIgLEH///8DcUGAgID4A3K+IjFDdb+/v5SSQ6Pp3L8gMUP5RLQ+kpWSQwAAAD+UvCIss0MAAAA0lEN3c/jCkiAsQf///wNxQYCAgPgDcr4iMUN1v7+/lJJDo+ncvyAxQ/lEtD6SlZJDAAAAP5STOAIEIAcgKP0fAbsiMkQAAABgnqD2P6IgMiAP/R8BuyIzoCI0IDSiIDIgM6EiMiAyoqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIECwJAIC5FDQAgBiAwIAv9GwIiLLNDAAAANJRDd3P4wpIgLEH///8DcUGAgID4A3K+IjFDdb+/v5SSQ6Pp3L8gMUP5RLQ+kpWSQwAAAD+UvCIss0MAAAA0lEN3c/jCkiAsQf///wNxQYCAgPgDcr4iMUN1v7+/lJJDo+ncvyAxQ/lEtD6SlZJDAAAAP5STOAIIIAcgKP0fArsiMkQAAABgnqD2P6IgMiAP/R8CuyIzoCI0IDSiIDIgM6EiMiAyoqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIICwJAIC9FDQAgBiAwIAv9GwMiLLNDAAAANJRDd3P4wpIgLEH///8DcUGAgID4A3K+IjFDdb+/v5SSQ6Pp3L8gMUP5RLQ+kpWSQwAAAD+UvCIss0MAAAA0lEN3c/jCkiAsQf///wNxQYCAgPgDcr4iMUN1v7+/lJJDo+ncvyAxQ/lEtD6SlZJDAAAAP5STOAIMIAcgKP0fA7siMkQAAABgnqD2P6IgMiAP/R8DuyIzoCI0IDSiIDIgM6EiMiAyoqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIMCyAnICv9USIr/RsAICv9GwFyICv9GwJyICv9GwNyRQ0CCwJAIAhEAAAAAAAAAABlDQACQAJAIAINACAAISxBACECDAELAkAgBSAMRw0AIAJBf2ohAkEAIQwgK/0bAEUNACAhIA/9HwAgGZOLICj9HwAgHZOLkl0NACAGQYCA56N8NgIAIAcgFbI4AgBBACEMICtBAP0cACErCwJAIAUgE0cNACACQX9qIQJBACETICv9GwFFDQAgIiAP/R8BIBqTiyAo/R8BIB6Ti5JdDQAgBkGAgOejfDYCBCAHIBayOAIEQQAhEyArQQD9HAEhKwsCQCAFIBRHDQAgAkF/aiECQQAhFCAr/RsCRQ0AICMgD/0fAiAbk4sgKP0fAiAfk4uSXQ0AIAZBgIDno3w2AgggByAXsjgCCEEAIRQgK0EA/RwCISsLAkACQCAFIABGDQAgACEsDAELIAJBf2ohAkEAISwgK/0bA0UNACAkIA/9HwMgHJOLICj9HwMgIJOLkl0NACAGQYCA56N8NgIMIAcgGLI4AgxBACEsICtBAP0cAyErCyAr/RsAICv9GwFyICv9GwJyICv9GwNyRQ0DCwJAAkAgKyAOICggEv3lAf3gASAPIBD95QH94AH95AEiCyA5/UP9UiIn/RsAIi0gJ/0bASIuciAn/RsCIi9yICf9GwMiNXJFDQAgBCAlayEAIAUgJWshAwJAIC1FDQAgDA0AIAJBAWohAiAL/R8AISEgKP0fACEdIA/9HwAhGSAAIQwgAyEVCwJAIC5FDQAgEw0AIAJBAWohAiAL/R8BISIgKP0fASEeIA/9HwEhGiAAIRMgAyEWCwJAIC9FDQAgFA0AIAJBAWohAiAL/R8CISMgKP0fAiEfIA/9HwIhGyAAIRQgAyEXCyA1RQ0AICwNACACQQFqIQIgC/0fAyEkICj9HwMhICAP/R8DIRwMAQsgLCEAIBghAwsCQCAFICZGDQAgAyEYDAELIAMhGCAEISYgBSElICghEiAPIRALIARBAmohBCAFIAFOIQMgDSAFQQFqIgVqQQFHDQALCyADQQFxRQ0DCwJAAkACQCAr/RsARQ0AIAZBgIDno3w2AgACQCAIRAAAAAAAAAAAZEUNACAHQQA2AgAgK/0bAUUNAyAGQYCA56N8NgIEDAILICv9GwFFDQIgBkGAgOejfDYCBAwCCyAr/RsBRQ0BIAZBgIDno3w2AgQgCEQAAAAAAAAAAGUNAQsgB0EANgIECwJAICv9GwJFDQAgBkGAgOejfDYCCAJAIAhEAAAAAAAAAABkRQ0AIAdBADYCCCAr/RsDRQ0EIAZBgIDno3w2AgwMAwsgK/0bA0UNAyAGQYCA56N8NgIMDwsgK/0bA0UNAiAGQYCA56N8NgIMIAhEAAAAAAAAAABkDQEMAgsCQAJAIAFBAU4NAP0M/////////////////////yEqDAELQQAhDEEAIAFrIQ0gAisDALb9EyACKwMItv0gASACKwMQtv0gAiACKwMYtv0gAyIOIA795gEhDyADKwMAtv0TIAMrAwi2/SABIAMrAxC2/SACIAMrAxi2/SADIhAgEP3mASERIAi2/RMhEv0M/////////////////////yEqQQIhBEEAIRNBACEUQQAhAEEAIRVBACEWQQAhF0EAIRhDAAAAACEZQwAAAAAhGkMAAAAAIRtDAAAAACEcQwAAAAAhHUMAAAAAIR5DAAAAACEfQwAAAAAhIEMAAAAAISFDAAAAACEiQwAAAAAhI0MAAAAAISRBACEDQQAhJUEBIQVBACECQQEhJiAQIScgDiEoAkADQCAP/QwAAEBAAABAQAAAQEAAAEBAIin95gEhCwJAICr9DAAAAAAAAAAAAAAAAAAAAAAiKyAoIA8gESIRICn95gH95QH95gEgCv3kASIoICj95gEiDyALIBH95QEgJ/3mASAJ/eQBIicgJ/3mASIR/eQBIgv9DAAkdEkAJHRJACR0SQAkdEn9RP1SIin9GwAiLCAp/RsBIi1yICn9GwIiLnIgKf0bAyIvckUNACAFsiEwAkAgLEUNACAGIDAgC/0bACIss0MAAAA0lEN3c/jCkiAsQf///wNxQYCAgPgDcr4iMUN1v7+/lJJDo+ncvyAxQ/lEtD6SlZJDAAAAP5S8IiyzQwAAADSUQ3dz+MKSICxB////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkOdhCG/lJI4AgAgByAn/R8AuyIyRAAAAGCeoPY/oiAyICj9HwC7IjOgIjQgNKIgMiAzoSIyIDKioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgALAkAgLUUNACAGIDAgC/0bASIss0MAAAA0lEN3c/jCkiAsQf///wNxQYCAgPgDcr4iMUN1v7+/lJJDo+ncvyAxQ/lEtD6SlZJDAAAAP5S8IiyzQwAAADSUQ3dz+MKSICxB////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkOdhCG/lJI4AgQgByAn/R8BuyIyRAAAAGCeoPY/oiAyICj9HwG7IjOgIjQgNKIgMiAzoSIyIDKioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgQLAkAgLkUNACAGIDAgC/0bAiIss0MAAAA0lEN3c/jCkiAsQf///wNxQYCAgPgDcr4iMUN1v7+/lJJDo+ncvyAxQ/lEtD6SlZJDAAAAP5S8IiyzQwAAADSUQ3dz+MKSICxB////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkOdhCG/lJI4AgggByAn/R8CuyIyRAAAAGCeoPY/oiAyICj9HwK7IjOgIjQgNKIgMiAzoSIyIDKioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AggLAkAgL0UNACAGIDAgC/0bAyIss0MAAAA0lEN3c/jCkiAsQf///wNxQYCAgPgDcr4iMUN1v7+/lJJDo+ncvyAxQ/lEtD6SlZJDAAAAP5S8IiyzQwAAADSUQ3dz+MKSICxB////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkOdhCG/lJI4AgwgByAn/R8DuyIyRAAAAGCeoPY/oiAyICj9HwO7IjOgIjQgNKIgMiAzoSIyIDKioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgwLICkgKv1RIir9GwAgKv0bAXIgKv0bAnIgKv0bA3JFDQILAkAgCEQAAAAAAAAAAGUNAAJAAkAgAg0AIAAhLEEAIQIMAQsCQCAFIAxHDQAgAkF/aiECQQAhDCAq/RsARQ0AICEgKP0fACAZk4sgJ/0fACAdk4uSXQ0AIAZBgIDno3w2AgAgByAVsjgCAEEAIQwgKkEA/RwAISoLAkAgBSATRw0AIAJBf2ohAkEAIRMgKv0bAUUNACAiICj9HwEgGpOLICf9HwEgHpOLkl0NACAGQYCA56N8NgIEIAcgFrI4AgRBACETICpBAP0cASEqCwJAIAUgFEcNACACQX9qIQJBACEUICr9GwJFDQAgIyAo/R8CIBuTiyAn/R8CIB+Ti5JdDQAgBkGAgOejfDYCCCAHIBeyOAIIQQAhFCAqQQD9HAIhKgsCQAJAIAUgAEYNACAAISwMAQsgAkF/aiECQQAhLCAq/RsDRQ0AICQgKP0fAyAck4sgJ/0fAyAgk4uSXQ0AIAZBgIDno3w2AgwgByAYsjgCDEEAISwgKkEA/RwDISoLICr9GwAgKv0bAXIgKv0bAnIgKv0bA3JFDQMLAkACQCAqICsgKCAO/eUB/eABICcgEP3lAf3gAf3kASILIBL9Q/1SIin9GwAiLSAp/RsBIi5yICn9GwIiL3IgKf0bAyI1ckUNACAEICVrIQAgBSAlayEDAkAgLUUNACAMDQAgAkEBaiECIAv9HwAhISAn/R8AIR0gKP0fACEZIAAhDCADIRULAkAgLkUNACATDQAgAkEBaiECIAv9HwEhIiAn/R8BIR4gKP0fASEaIAAhEyADIRYLAkAgL0UNACAUDQAgAkEBaiECIAv9HwIhIyAn/R8CIR8gKP0fAiEbIAAhFCADIRcLIDVFDQAgLA0AIAJBAWohAiAL/R8DISQgJ/0fAyEgICj9HwMhHAwBCyAsIQAgGCEDCwJAIAUgJkYNACADIRgMAQsgAyEYIAQhJiAFISUgJyEQICghDgsgBEECaiEEIAUgAU4hAyANIAVBAWoiBWpBAUcNAAsLIANBAXFFDQILAkACQAJAICr9GwBFDQAgBkGAgOejfDYCAAJAIAhEAAAAAAAAAABkRQ0AIAdBADYCACAq/RsBRQ0DIAZBgIDno3w2AgQMAgsgKv0bAUUNAiAGQYCA56N8NgIEDAILICr9GwFFDQEgBkGAgOejfDYCBCAIRAAAAAAAAAAAZQ0BCyAHQQA2AgQLAkAgKv0bAkUNACAGQYCA56N8NgIIAkAgCEQAAAAAAAAAAGRFDQAgB0EANgIIICr9GwNFDQMgBkGAgOejfDYCDAwCCyAq/RsDRQ0CIAZBgIDno3w2AgwPCyAq/RsDRQ0BIAZBgIDno3w2AgwgCEQAAAAAAAAAAGRFDQELIAdBADYCDAsLyNUCDAN7An8GewZ/DH0Cfwd7BH8CfQZ8AX8EeyAFKwMAtv0TIAUrAwi2/SABIAUrAxC2/SACIAUrAxi2/SADIQkgBCsDALb9EyAEKwMItv0gASAEKwMQtv0gAiAEKwMYtv0gAyEKAkACQAJAAkACQAJAAkACQAJAAkACQAJAAkACQAJAAkACQAJAIABBf2oODwAPDg0MCwoJCAcGBQQDAgELAkACQCABQQFODQD9DP////////////////////8hCwwBC0EAIQxBACABayENIAIrAwC2/RMgAisDCLb9IAEgAisDELb9IAIgAisDGLb9IAMiDiAO/eYBIQ8gAysDALb9EyADKwMItv0gASADKwMQtv0gAiADKwMYtv0gAyIQIBD95gEhESAItv0TIRL9DAAAAAAAAAAAAAAAAAAAAAAhE/0M/////////////////////yELQQIhBEEAIRRBACEVQQAhAEEAIRZBACEXQQAhGEEAIRlDAAAAACEaQwAAAAAhG0MAAAAAIRxDAAAAACEdQwAAAAAhHkMAAAAAIR9DAAAAACEgQwAAAAAhIUMAAAAAISJDAAAAACEjQwAAAAAhJEMAAAAAISVBACEDQQAhJkEBIQVBACECQQEhJ/0MAACAPwAAgD8AAIA/AACAPyIoISkgECEqIA4hKwJAA0AgDyAR/eUBIQ8gKyIsICkiK/3mASAqIiogE/3mAf3lASIpICn95AEgKP3kASEpICwgE/3mASAqICv95gH95AEiKyAr/eQBIRMCQCAL/QwAAAAAAAAAAAAAAAAAAAAAIi0gKiAsICz95AH95gEgCf3kASIqICr95gEiESAPIAr95AEiKyAr/eYBIg/95AEiLv0MACR0SQAkdEkAJHRJACR0Sf1E/VIiLP0bACIvICz9GwEiMHIgLP0bAiIxciAs/RsDIjJyRQ0AIAWyQ3dz+EKSITMCQCAvRQ0AIAYgMyAu/RsAIi+zQwAAADSUQ3dz+MKSIC9B////A3FBgICA+ANyviI0Q3W/v7+UkkOj6dy/IDRD+US0PpKVkkMAAAA/lLwiL7NDAAAAtJSSIC9B////A3FBgICA+ANyviI0Q3W/vz+UkkOj6dw/IDRD+US0PpKVkjgCACAHIBP9HwC7IjUgKv0fALsiNqIgKf0fALsiNyAr/R8AuyI4oqAgNSA1oiA3IDeioCI5oyI6IDcgNqIgNSA4oqEgOaMiNaBEAAAAYJ6g5j+iIDogOqIgNSA1oqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIACwJAIDBFDQAgBiAzIC79GwEiL7NDAAAANJRDd3P4wpIgL0H///8DcUGAgID4A3K+IjRDdb+/v5SSQ6Pp3L8gNEP5RLQ+kpWSQwAAAD+UvCIvs0MAAAC0lJIgL0H///8DcUGAgID4A3K+IjRDdb+/P5SSQ6Pp3D8gNEP5RLQ+kpWSOAIEIAcgE/0fAbsiNSAq/R8BuyI2oiAp/R8BuyI3ICv9HwG7IjiioCA1IDWiIDcgN6KgIjmjIjogNyA2oiA1IDiioSA5oyI1oEQAAABgnqDmP6IgOiA6oiA1IDWioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgQLAkAgMUUNACAGIDMgLv0bAiIvs0MAAAA0lEN3c/jCkiAvQf///wNxQYCAgPgDcr4iNEN1v7+/lJJDo+ncvyA0Q/lEtD6SlZJDAAAAP5S8Ii+zQwAAALSUkiAvQf///wNxQYCAgPgDcr4iNEN1v78/lJJDo+ncPyA0Q/lEtD6SlZI4AgggByAT/R8CuyI1ICr9HwK7IjaiICn9HwK7IjcgK/0fArsiOKKgIDUgNaIgNyA3oqAiOaMiOiA3IDaiIDUgOKKhIDmjIjWgRAAAAGCeoOY/oiA6IDqiIDUgNaKgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCCAsCQCAyRQ0AIAYgMyAu/RsDIi+zQwAAADSUQ3dz+MKSIC9B////A3FBgICA+ANyviI0Q3W/v7+UkkOj6dy/IDRD+US0PpKVkkMAAAA/lLwiL7NDAAAAtJSSIC9B////A3FBgICA+ANyviIzQ3W/vz+UkkOj6dw/IDND+US0PpKVkjgCDCAHIBP9HwO7IjUgKv0fA7siNqIgKf0fA7siNyAr/R8DuyI4oqAgNSA1oiA3IDeioCI5oyI6IDcgNqIgNSA4oqEgOaMiNaBEAAAAYJ6g5j+iIDogOqIgNSA1oqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIMCyAsIAv9USIL/RsAIAv9GwFyIAv9GwJyIAv9GwNyRQ0CCwJAIAhEAAAAAAAAAABlDQACQAJAIAINACAAIS9BACECDAELAkAgBSAMRw0AIAJBf2ohAkEAIQwgC/0bAEUNACAiICv9HwAgGpOLICr9HwAgHpOLkl0NACAGQYCA56N8NgIAIAcgFrI4AgBBACEMIAtBAP0cACELCwJAIAUgFEcNACACQX9qIQJBACEUIAv9GwFFDQAgIyAr/R8BIBuTiyAq/R8BIB+Ti5JdDQAgBkGAgOejfDYCBCAHIBeyOAIEQQAhFCALQQD9HAEhCwsCQCAFIBVHDQAgAkF/aiECQQAhFSAL/RsCRQ0AICQgK/0fAiAck4sgKv0fAiAgk4uSXQ0AIAZBgIDno3w2AgggByAYsjgCCEEAIRUgC0EA/RwCIQsLAkACQCAFIABGDQAgACEvDAELIAJBf2ohAkEAIS8gC/0bA0UNACAlICv9HwMgHZOLICr9HwMgIZOLkl0NACAGQYCA56N8NgIMIAcgGbI4AgxBACEvIAtBAP0cAyELCyAL/RsAIAv9GwFyIAv9GwJyIAv9GwNyRQ0DCwJAAkAgCyAtICogEP3lAf3gASArIA795QH94AH95AEiLiAS/UP9UiIs/RsAIjAgLP0bASIxciAs/RsCIjJyICz9GwMiO3JFDQAgBCAmayEAIAUgJmshAwJAIDBFDQAgDA0AIAJBAWohAiAu/R8AISIgKv0fACEeICv9HwAhGiAAIQwgAyEWCwJAIDFFDQAgFA0AIAJBAWohAiAu/R8BISMgKv0fASEfICv9HwEhGyAAIRQgAyEXCwJAIDJFDQAgFQ0AIAJBAWohAiAu/R8CISQgKv0fAiEgICv9HwIhHCAAIRUgAyEYCyA7RQ0AIC8NACACQQFqIQIgLv0fAyElICr9HwMhISAr/R8DIR0MAQsgLyEAIBkhAwsCQCAFICdGDQAgAyEZDAELIAMhGSAEIScgBSEmICohECArIQ4LIARBAmohBCAFIAFOIQMgDSAFQQFqIgVqQQFHDQALCyADQQFxRQ0RCwJAAkACQCAL/RsARQ0AIAZBgIDno3w2AgACQCAIRAAAAAAAAAAAZEUNACAHQQA2AgAgC/0bAUUNAyAGQYCA56N8NgIEDAILIAv9GwFFDQIgBkGAgOejfDYCBAwCCyAL/RsBRQ0BIAZBgIDno3w2AgQgCEQAAAAAAAAAAGUNAQsgB0EANgIECwJAIAv9GwJFDQAgBkGAgOejfDYCCAJAIAhEAAAAAAAAAABkRQ0AIAdBADYCCCAL/RsDRQ0SIAZBgIDno3w2AgwMEQsgC/0bA0UNESAGQYCA56N8NgIMDwsgC/0bA0UNECAGQYCA56N8NgIMIAhEAAAAAAAAAABkDQ8MEAsCQAJAIAFBAU4NAP0M/////////////////////yEtDAELIAIrAwC2/RMgAisDCLb9IAEgAisDELb9IAIgAisDGLb9IAMiDiAO/eYBISsgAysDALb9EyADKwMItv0gASADKwMQtv0gAiADKwMYtv0gAyIQIBD95gEhEyAItv0TIRL9DAAAAAAAAAAAAAAAAAAAAAAhD/0M/////////////////////yEtQQAhBUECIQNBACEMQQAhFEEAIRVBACEZQQAhFkEAIRdBACEYQQAhL0MAAAAAIRpDAAAAACEbQwAAAAAhHEMAAAAAIR1DAAAAACEeQwAAAAAhH0MAAAAAISBDAAAAACEhQwAAAAAhIkMAAAAAISNDAAAAACEkQwAAAAAhJUEAIQBBACEmQQEhBEEAIQ1BASE7/QwAAIA/AACAPwAAgD8AAIA/IighESAQISwgDiEqA0AgKiAR/eYBICwgD/3mAf3lASIpICn95AEhCyAqIA/95gEgLCAR/eYB/eQBISkCQAJAIARBCm5BCmxBf2ogBSICRw0AICsgE/3lASAs/QwAAIBAAACAQAAAgEAAAIBA/eYBICr95gH94AH95gEhLCATICv9DAAAwMAAAMDAAADAwAAAwMD95gH95AEgE/3mASEqICsgK/3mASErDAELICz9DAAAgEAAAIBAAACAQAAAgED95gEgKyAT/eUB/eYBICr95gEhLCArIBP9DAAAwMAAAMDAAADAwAAAwMD95gH95AEgK/3mASEqIBMgE/3mASErCyALICj95AEhESApICn95AEhDyACQQFqIQUCQAJAIC39DAAAAAAAAAAAAAAAAAAAAAAiCyAsIAn95AEiLCAs/eYBIhMgKyAK/eQBICr95AEiKiAq/eYBIiv95AEiLv0MACR0SQAkdEkAJHRJACR0Sf1E/VIiKf0bACIwICn9GwEiMXIgKf0bAiIyciAp/RsDIidyRQ0AIAWyITMCQCAwRQ0AIAYgMyAu/RsAIjCzQwAAADSUQ3dz+MKSIDBB////A3FBgICA+ANyviI0Q3W/v7+UkkOj6dy/IDRD+US0PpKVkkMAAAA/lLwiMLNDAAAANJRDd3P4wpIgMEH///8DcUGAgID4A3K+IjRDdb+/v5SSQ6Pp3L8gNEP5RLQ+kpWSQwAAAD+UkzgCACAHIA/9HwC7IjUgLP0fALsiNqIgEf0fALsiNyAq/R8AuyI4oqAgNSA1oiA3IDeioCI5oyI6IDcgNqIgNSA4oqEgOaMiNaBEAAAAYJ6g5j+iIDogOqIgNSA1oqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIACwJAIDFFDQAgBiAzIC79GwEiMLNDAAAANJRDd3P4wpIgMEH///8DcUGAgID4A3K+IjRDdb+/v5SSQ6Pp3L8gNEP5RLQ+kpWSQwAAAD+UvCIws0MAAAA0lEN3c/jCkiAwQf///wNxQYCAgPgDcr4iNEN1v7+/lJJDo+ncvyA0Q/lEtD6SlZJDAAAAP5STOAIEIAcgD/0fAbsiNSAs/R8BuyI2oiAR/R8BuyI3ICr9HwG7IjiioCA1IDWiIDcgN6KgIjmjIjogNyA2oiA1IDiioSA5oyI1oEQAAABgnqDmP6IgOiA6oiA1IDWioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgQLAkAgMkUNACAGIDMgLv0bAiIws0MAAAA0lEN3c/jCkiAwQf///wNxQYCAgPgDcr4iNEN1v7+/lJJDo+ncvyA0Q/lEtD6SlZJDAAAAP5S8IjCzQwAAADSUQ3dz+MKSIDBB////A3FBgICA+ANyviI0Q3W/v7+UkkOj6dy/IDRD+US0PpKVkkMAAAA/lJM4AgggByAP/R8CuyI1ICz9HwK7IjaiIBH9HwK7IjcgKv0fArsiOKKgIDUgNaIgNyA3oqAiOaMiOiA3IDaiIDUgOKKhIDmjIjWgRAAAAGCeoOY/oiA6IDqiIDUgNaKgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCCAsCQCAnRQ0AIAYgMyAu/RsDIjCzQwAAADSUQ3dz+MKSIDBB////A3FBgICA+ANyviI0Q3W/v7+UkkOj6dy/IDRD+US0PpKVkkMAAAA/lLwiMLNDAAAANJRDd3P4wpIgMEH///8DcUGAgID4A3K+IjRDdb+/v5SSQ6Pp3L8gNEP5RLQ+kpWSQwAAAD+UkzgCDCAHIA/9HwO7IjUgLP0fA7siNqIgEf0fA7siNyAq/R8DuyI4oqAgNSA1oiA3IDeioCI5oyI6IDcgNqIgNSA4oqEgOaMiNaBEAAAAYJ6g5j+iIDogOqIgNSA1oqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIMCyApIC39USIt/RsAIC39GwFyIC39GwJyIC39GwNyRQ0BCwJAIAhEAAAAAAAAAABlDQACQAJAIA0NACAZITBBACENDAELAkAgBSAMRw0AIA1Bf2ohDUEAIQwgLf0bAEUNACAiICr9HwAgGpOLICz9HwAgHpOLkl0NACAGQYCA56N8NgIAIAcgFrI4AgBBACEMIC1BAP0cACEtCwJAIAUgFEcNACANQX9qIQ1BACEUIC39GwFFDQAgIyAq/R8BIBuTiyAs/R8BIB+Ti5JdDQAgBkGAgOejfDYCBCAHIBeyOAIEQQAhFCAtQQD9HAEhLQsCQCAFIBVHDQAgDUF/aiENQQAhFSAt/RsCRQ0AICQgKv0fAiAck4sgLP0fAiAgk4uSXQ0AIAZBgIDno3w2AgggByAYsjgCCEEAIRUgLUEA/RwCIS0LAkACQCAFIBlGDQAgGSEwDAELIA1Bf2ohDUEAITAgLf0bA0UNACAlICr9HwMgHZOLICz9HwMgIZOLkl0NACAGQYCA56N8NgIMIAcgL7I4AgxBACEwIC1BAP0cAyEtCyAt/RsAIC39GwFyIC39GwJyIC39GwNyRQ0CCwJAAkAgLSALICwgEP3lAf3gASAqIA795QH94AH95AEiLiAS/UP9UiIp/RsAIgAgKf0bASIxciAp/RsCIjJyICn9GwMiJ3JFDQAgAyAmayEZIAIgJmtBAWohAgJAIABFDQAgDA0AIA1BAWohDSAu/R8AISIgLP0fACEeICr9HwAhGiAZIQwgAiEWCwJAIDFFDQAgFA0AIA1BAWohDSAu/R8BISMgLP0fASEfICr9HwEhGyAZIRQgAiEXCwJAIDJFDQAgFQ0AIA1BAWohDSAu/R8CISQgLP0fAiEgICr9HwIhHCAZIRUgAiEYCyAnRQ0AIDANACANQQFqIQ0gLv0fAyElICz9HwMhISAq/R8DIR0MAQsgMCEZIC8hAgsCQCAFIDtGDQAgAiEvDAELIAIhLyADITsgBSEmICwhECAqIQ4LIANBAmohAyAFIAFOIQAgBEEBaiEEIAEgBUcNAQsLIABBAXFFDRALAkACQAJAIC39GwBFDQAgBkGAgOejfDYCAAJAIAhEAAAAAAAAAABkRQ0AIAdBADYCACAt/RsBRQ0DIAZBgIDno3w2AgQMAgsgLf0bAUUNAiAGQYCA56N8NgIEDAILIC39GwFFDQEgBkGAgOejfDYCBCAIRAAAAAAAAAAAZQ0BCyAHQQA2AgQLAkAgLf0bAkUNACAGQYCA56N8NgIIAkAgCEQAAAAAAAAAAGRFDQAgB0EANgIIIC39GwNFDREgBkGAgOejfDYCDAwQCyAt/RsDRQ0QIAZBgIDno3w2AgwPCyAt/RsDRQ0PIAZBgIDno3w2AgwgCEQAAAAAAAAAAGUNDwwOCwJAAkAgAUEBTg0A/Qz/////////////////////IS0MAQsgAisDALb9EyACKwMItv0gASACKwMQtv0gAiACKwMYtv0gAyIOIA795gEhESADKwMAtv0TIAMrAwi2/SABIAMrAxC2/SACIAMrAxi2/SADIhAgEP3mASEPIAi2/RMhEv0MAAAAAAAAAAAAAAAAAAAAACET/Qz/////////////////////IS1BACEFQQIhA0EAIQxBACEUQQAhFUEAIRlBACEWQQAhF0EAIRhBACEvQwAAAAAhGkMAAAAAIRtDAAAAACEcQwAAAAAhHUMAAAAAIR5DAAAAACEfQwAAAAAhIEMAAAAAISFDAAAAACEiQwAAAAAhI0MAAAAAISRDAAAAACElQQAhAEEAISZBASEEQQAhDUEBITv9DAAAgD8AAIA/AACAPwAAgD8iKCEpIBAhLCAOISoDQCARIREgKiAp/eYBICwgE/3mAf3lASIrICv95AEhCyAqIBP95gEgLCAp/eYB/eQBISsCQAJAIARBCm5BCmxBf2ogBSICRw0AIBEgD/0MAABAwAAAQMAAAEDAAABAwP3mAf3kASAq/eAB/eYBISogLP3gASEsDAELICogESAP/QwAAEDAAABAwAAAQMAAAEDA/eYB/eQB/eYBISoLIAsgKP3kASEpICsgK/3kASETIAJBAWohBQJAAkAgLf0MAAAAAAAAAAAAAAAAAAAAACILICwgEf0MAABAQAAAQEAAAEBAAABAQP3mASAP/eUB/eYBIAn95AEiLCAs/eYBIg8gKiAK/eQBIiogKv3mASIR/eQBIi79DAAkdEkAJHRJACR0SQAkdEn9RP1SIiv9GwAiMCAr/RsBIjFyICv9GwIiMnIgK/0bAyInckUNACAFsiEzAkAgMEUNACAGIDMgLv0bACIws0MAAAA0lEN3c/jCkiAwQf///wNxQYCAgPgDcr4iNEN1v7+/lJJDo+ncvyA0Q/lEtD6SlZJDAAAAP5S8IjCzQwAAADSUQ3dz+MKSIDBB////A3FBgICA+ANyviI0Q3W/v7+UkkOj6dy/IDRD+US0PpKVkkOdhCG/lJI4AgAgByAT/R8AuyI1ICz9HwC7IjaiICn9HwC7IjcgKv0fALsiOKKgIDUgNaIgNyA3oqAiOaMiOiA3IDaiIDUgOKKhIDmjIjWgRAAAAGCeoOY/oiA6IDqiIDUgNaKgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCAAsCQCAxRQ0AIAYgMyAu/RsBIjCzQwAAADSUQ3dz+MKSIDBB////A3FBgICA+ANyviI0Q3W/v7+UkkOj6dy/IDRD+US0PpKVkkMAAAA/lLwiMLNDAAAANJRDd3P4wpIgMEH///8DcUGAgID4A3K+IjRDdb+/v5SSQ6Pp3L8gNEP5RLQ+kpWSQ52EIb+UkjgCBCAHIBP9HwG7IjUgLP0fAbsiNqIgKf0fAbsiNyAq/R8BuyI4oqAgNSA1oiA3IDeioCI5oyI6IDcgNqIgNSA4oqEgOaMiNaBEAAAAYJ6g5j+iIDogOqIgNSA1oqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIECwJAIDJFDQAgBiAzIC79GwIiMLNDAAAANJRDd3P4wpIgMEH///8DcUGAgID4A3K+IjRDdb+/v5SSQ6Pp3L8gNEP5RLQ+kpWSQwAAAD+UvCIws0MAAAA0lEN3c/jCkiAwQf///wNxQYCAgPgDcr4iNEN1v7+/lJJDo+ncvyA0Q/lEtD6SlZJDnYQhv5SSOAIIIAcgE/0fArsiNSAs/R8CuyI2oiAp/R8CuyI3ICr9HwK7IjiioCA1IDWiIDcgN6KgIjmjIjogNyA2oiA1IDiioSA5oyI1oEQAAABgnqDmP6IgOiA6oiA1IDWioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AggLAkAgJ0UNACAGIDMgLv0bAyIws0MAAAA0lEN3c/jCkiAwQf///wNxQYCAgPgDcr4iNEN1v7+/lJJDo+ncvyA0Q/lEtD6SlZJDAAAAP5S8IjCzQwAAADSUQ3dz+MKSIDBB////A3FBgICA+ANyviI0Q3W/v7+UkkOj6dy/IDRD+US0PpKVkkOdhCG/lJI4AgwgByAT/R8DuyI1ICz9HwO7IjaiICn9HwO7IjcgKv0fA7siOKKgIDUgNaIgNyA3oqAiOaMiOiA3IDaiIDUgOKKhIDmjIjWgRAAAAGCeoOY/oiA6IDqiIDUgNaKgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCDAsgKyAt/VEiLf0bACAt/RsBciAt/RsCciAt/RsDckUNAQsCQCAIRAAAAAAAAAAAZQ0AAkACQCANDQAgGSEwQQAhDQwBCwJAIAUgDEcNACANQX9qIQ1BACEMIC39GwBFDQAgIiAq/R8AIBqTiyAs/R8AIB6Ti5JdDQAgBkGAgOejfDYCACAHIBayOAIAQQAhDCAtQQD9HAAhLQsCQCAFIBRHDQAgDUF/aiENQQAhFCAt/RsBRQ0AICMgKv0fASAbk4sgLP0fASAfk4uSXQ0AIAZBgIDno3w2AgQgByAXsjgCBEEAIRQgLUEA/RwBIS0LAkAgBSAVRw0AIA1Bf2ohDUEAIRUgLf0bAkUNACAkICr9HwIgHJOLICz9HwIgIJOLkl0NACAGQYCA56N8NgIIIAcgGLI4AghBACEVIC1BAP0cAiEtCwJAAkAgBSAZRg0AIBkhMAwBCyANQX9qIQ1BACEwIC39GwNFDQAgJSAq/R8DIB2TiyAs/R8DICGTi5JdDQAgBkGAgOejfDYCDCAHIC+yOAIMQQAhMCAtQQD9HAMhLQsgLf0bACAt/RsBciAt/RsCciAt/RsDckUNAgsCQAJAIC0gCyAsIBD95QH94AEgKiAO/eUB/eAB/eQBIi4gEv1D/VIiK/0bACIAICv9GwEiMXIgK/0bAiIyciAr/RsDIidyRQ0AIAMgJmshGSACICZrQQFqIQICQCAARQ0AIAwNACANQQFqIQ0gLv0fACEiICz9HwAhHiAq/R8AIRogGSEMIAIhFgsCQCAxRQ0AIBQNACANQQFqIQ0gLv0fASEjICz9HwEhHyAq/R8BIRsgGSEUIAIhFwsCQCAyRQ0AIBUNACANQQFqIQ0gLv0fAiEkICz9HwIhICAq/R8CIRwgGSEVIAIhGAsgJ0UNACAwDQAgDUEBaiENIC79HwMhJSAs/R8DISEgKv0fAyEdDAELIDAhGSAvIQILAkAgBSA7Rg0AIAIhLwwBCyACIS8gAyE7IAUhJiAsIRAgKiEOCyADQQJqIQMgBSABTiEAIARBAWohBCABIAVHDQELCyAAQQFxRQ0PCwJAAkACQCAt/RsARQ0AIAZBgIDno3w2AgACQCAIRAAAAAAAAAAAZEUNACAHQQA2AgAgLf0bAUUNAyAGQYCA56N8NgIEDAILIC39GwFFDQIgBkGAgOejfDYCBAwCCyAt/RsBRQ0BIAZBgIDno3w2AgQgCEQAAAAAAAAAAGUNAQsgB0EANgIECwJAIC39GwJFDQAgBkGAgOejfDYCCAJAIAhEAAAAAAAAAABkRQ0AIAdBADYCCCAt/RsDRQ0QIAZBgIDno3w2AgwMDwsgLf0bA0UNDyAGQYCA56N8NgIMDwsgLf0bA0UNDiAGQYCA56N8NgIMIAhEAAAAAAAAAABkDQ0MDgsCQAJAIAFBAU4NAP0M/////////////////////yEtDAELIAIrAwC2/RMgAisDCLb9IAEgAisDELb9IAIgAisDGLb9IAMiDiAO/eYBIQ8gAysDALb9EyADKwMItv0gASADKwMQtv0gAiADKwMYtv0gAyIQIBD95gEhESAItv0TIRL9DAAAAAAAAAAAAAAAAAAAAAAhE/0M/////////////////////yEtQQAhBUECIQNBACEMQQAhFEEAIRVBACEZQQAhFkEAIRdBACEYQQAhL0MAAAAAIRpDAAAAACEbQwAAAAAhHEMAAAAAIR1DAAAAACEeQwAAAAAhH0MAAAAAISBDAAAAACEhQwAAAAAhIkMAAAAAISNDAAAAACEkQwAAAAAhJUEAIQBBACEmQQEhBEEAIQ1BASE7/QwAAIA/AACAPwAAgD8AAIA/Ii4hKSAQISogDiErAkADQCARIQsgKyIsICkiK/3mASAqIiogE/3mAf3lASIpICn95AEgLv3kASEpICwgE/3mASAqICv95gH95AEiKyAr/eQBIRMgBSICQQFqIQUCQCAt/QwAAAAAAAAAAAAAAAAAAAAAIiggKiAsICz95AH95gEiLP3gASAsIAIgBEEKbkEKbEF/akYbIAn95AEiKiAq/eYBIhEgDyAL/eUBIAr95AEiKyAr/eYBIg/95AEiC/0MACR0SQAkdEkAJHRJACR0Sf1E/VIiLP0bACIwICz9GwEiMXIgLP0bAiIyciAs/RsDIidyRQ0AIAWyQ3dz+EKSITMCQCAwRQ0AIAYgMyAL/RsAIjCzQwAAADSUQ3dz+MKSIDBB////A3FBgICA+ANyviI0Q3W/v7+UkkOj6dy/IDRD+US0PpKVkkMAAAA/lLwiMLNDAAAAtJSSIDBB////A3FBgICA+ANyviI0Q3W/vz+UkkOj6dw/IDRD+US0PpKVkjgCACAHIBP9HwC7IjUgKv0fALsiNqIgKf0fALsiNyAr/R8AuyI4oqAgNSA1oiA3IDeioCI5oyI6IDcgNqIgNSA4oqEgOaMiNaBEAAAAYJ6g5j+iIDogOqIgNSA1oqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIACwJAIDFFDQAgBiAzIAv9GwEiMLNDAAAANJRDd3P4wpIgMEH///8DcUGAgID4A3K+IjRDdb+/v5SSQ6Pp3L8gNEP5RLQ+kpWSQwAAAD+UvCIws0MAAAC0lJIgMEH///8DcUGAgID4A3K+IjRDdb+/P5SSQ6Pp3D8gNEP5RLQ+kpWSOAIEIAcgE/0fAbsiNSAq/R8BuyI2oiAp/R8BuyI3ICv9HwG7IjiioCA1IDWiIDcgN6KgIjmjIjogNyA2oiA1IDiioSA5oyI1oEQAAABgnqDmP6IgOiA6oiA1IDWioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgQLAkAgMkUNACAGIDMgC/0bAiIws0MAAAA0lEN3c/jCkiAwQf///wNxQYCAgPgDcr4iNEN1v7+/lJJDo+ncvyA0Q/lEtD6SlZJDAAAAP5S8IjCzQwAAALSUkiAwQf///wNxQYCAgPgDcr4iNEN1v78/lJJDo+ncPyA0Q/lEtD6SlZI4AgggByAT/R8CuyI1ICr9HwK7IjaiICn9HwK7IjcgK/0fArsiOKKgIDUgNaIgNyA3oqAiOaMiOiA3IDaiIDUgOKKhIDmjIjWgRAAAAGCeoOY/oiA6IDqiIDUgNaKgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCCAsCQCAnRQ0AIAYgMyAL/RsDIjCzQwAAADSUQ3dz+MKSIDBB////A3FBgICA+ANyviI0Q3W/v7+UkkOj6dy/IDRD+US0PpKVkkMAAAA/lLwiMLNDAAAAtJSSIDBB////A3FBgICA+ANyviIzQ3W/vz+UkkOj6dw/IDND+US0PpKVkjgCDCAHIBP9HwO7IjUgKv0fA7siNqIgKf0fA7siNyAr/R8DuyI4oqAgNSA1oiA3IDeioCI5oyI6IDcgNqIgNSA4oqEgOaMiNaBEAAAAYJ6g5j+iIDogOqIgNSA1oqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIMCyAsIC39USIt/RsAIC39GwFyIC39GwJyIC39GwNyRQ0CCwJAIAhEAAAAAAAAAABlDQACQAJAIA0NACAZITBBACENDAELAkAgBSAMRw0AIA1Bf2ohDUEAIQwgLf0bAEUNACAiICv9HwAgGpOLICr9HwAgHpOLkl0NACAGQYCA56N8NgIAIAcgFrI4AgBBACEMIC1BAP0cACEtCwJAIAUgFEcNACANQX9qIQ1BACEUIC39GwFFDQAgIyAr/R8BIBuTiyAq/R8BIB+Ti5JdDQAgBkGAgOejfDYCBCAHIBeyOAIEQQAhFCAtQQD9HAEhLQsCQCAFIBVHDQAgDUF/aiENQQAhFSAt/RsCRQ0AICQgK/0fAiAck4sgKv0fAiAgk4uSXQ0AIAZBgIDno3w2AgggByAYsjgCCEEAIRUgLUEA/RwCIS0LAkACQCAFIBlGDQAgGSEwDAELIA1Bf2ohDUEAITAgLf0bA0UNACAlICv9HwMgHZOLICr9HwMgIZOLkl0NACAGQYCA56N8NgIMIAcgL7I4AgxBACEwIC1BAP0cAyEtCyAt/RsAIC39GwFyIC39GwJyIC39GwNyRQ0DCwJAAkAgLSAoICogEP3lAf3gASArIA795QH94AH95AEiCyAS/UP9UiIs/RsAIgAgLP0bASIxciAs/RsCIjJyICz9GwMiJ3JFDQAgAyAmayEZIAIgJmtBAWohAgJAIABFDQAgDA0AIA1BAWohDSAL/R8AISIgKv0fACEeICv9HwAhGiAZIQwgAiEWCwJAIDFFDQAgFA0AIA1BAWohDSAL/R8BISMgKv0fASEfICv9HwEhGyAZIRQgAiEXCwJAIDJFDQAgFQ0AIA1BAWohDSAL/R8CISQgKv0fAiEgICv9HwIhHCAZIRUgAiEYCyAnRQ0AIDANACANQQFqIQ0gC/0fAyElICr9HwMhISAr/R8DIR0MAQsgMCEZIC8hAgsCQCAFIDtGDQAgAiEvDAELIAIhLyADITsgBSEmICohECArIQ4LIANBAmohAyAFIAFOIQAgBEEBaiEEIAEgBUcNAAsLIABBAXFFDQ4LAkACQAJAIC39GwBFDQAgBkGAgOejfDYCAAJAIAhEAAAAAAAAAABkRQ0AIAdBADYCACAt/RsBRQ0DIAZBgIDno3w2AgQMAgsgLf0bAUUNAiAGQYCA56N8NgIEDAILIC39GwFFDQEgBkGAgOejfDYCBCAIRAAAAAAAAAAAZQ0BCyAHQQA2AgQLAkAgLf0bAkUNACAGQYCA56N8NgIIAkAgCEQAAAAAAAAAAGRFDQAgB0EANgIIIC39GwNFDQ8gBkGAgOejfDYCDAwOCyAt/RsDRQ0OIAZBgIDno3w2AgwPCyAt/RsDRQ0NIAZBgIDno3w2AgwgCEQAAAAAAAAAAGQNDAwNCwJAAkAgAUEBTg0A/Qz/////////////////////IQsMAQtBACEMQQAgAWshDSACKwMAtv0TIAIrAwi2/SABIAIrAxC2/SACIAIrAxi2/SADIg4gDv3mASEPIAMrAwC2/RMgAysDCLb9IAEgAysDELb9IAIgAysDGLb9IAMiECAQ/eYBIREgCLb9EyES/QwAAAAAAAAAAAAAAAAAAAAAIRP9DP////////////////////8hC0ECIQRBACEUQQAhFUEAIQBBACEWQQAhF0EAIRhBACEZQwAAAAAhGkMAAAAAIRtDAAAAACEcQwAAAAAhHUMAAAAAIR5DAAAAACEfQwAAAAAhIEMAAAAAISFDAAAAACEiQwAAAAAhI0MAAAAAISRDAAAAACElQQAhA0EAISZBASEFQQAhAkEBISf9DAAAgD8AAIA/AACAPwAAgD8iKCEpIBAhKiAOISsCQANAIA8gEf3lASEPICsiLCApIiv95gEgKiIqIBP95gH95QEiKSAp/eQBICj95AEhKSAsIBP95gEgKiAr/eYB/eQBIisgK/3kASETAkAgC/0MAAAAAAAAAAAAAAAAAAAAACItIAkgKiAsICz95AH95gH95QEiKiAq/eYBIhEgDyAK/eQBIisgK/3mASIP/eQBIi79DAAkdEkAJHRJACR0SQAkdEn9RP1SIiz9GwAiLyAs/RsBIjByICz9GwIiMXIgLP0bAyIyckUNACAFskN3c/hCkiEzAkAgL0UNACAGIDMgLv0bACIvs0MAAAA0lEN3c/jCkiAvQf///wNxQYCAgPgDcr4iNEN1v7+/lJJDo+ncvyA0Q/lEtD6SlZJDAAAAP5S8Ii+zQwAAALSUkiAvQf///wNxQYCAgPgDcr4iNEN1v78/lJJDo+ncPyA0Q/lEtD6SlZI4AgAgByAT/R8AuyI1ICr9HwC7IjaiICn9HwC7IjcgK/0fALsiOKKgIDUgNaIgNyA3oqAiOaMiOiA3IDaiIDUgOKKhIDmjIjWgRAAAAGCeoOY/oiA6IDqiIDUgNaKgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCAAsCQCAwRQ0AIAYgMyAu/RsBIi+zQwAAADSUQ3dz+MKSIC9B////A3FBgICA+ANyviI0Q3W/v7+UkkOj6dy/IDRD+US0PpKVkkMAAAA/lLwiL7NDAAAAtJSSIC9B////A3FBgICA+ANyviI0Q3W/vz+UkkOj6dw/IDRD+US0PpKVkjgCBCAHIBP9HwG7IjUgKv0fAbsiNqIgKf0fAbsiNyAr/R8BuyI4oqAgNSA1oiA3IDeioCI5oyI6IDcgNqIgNSA4oqEgOaMiNaBEAAAAYJ6g5j+iIDogOqIgNSA1oqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIECwJAIDFFDQAgBiAzIC79GwIiL7NDAAAANJRDd3P4wpIgL0H///8DcUGAgID4A3K+IjRDdb+/v5SSQ6Pp3L8gNEP5RLQ+kpWSQwAAAD+UvCIvs0MAAAC0lJIgL0H///8DcUGAgID4A3K+IjRDdb+/P5SSQ6Pp3D8gNEP5RLQ+kpWSOAIIIAcgE/0fArsiNSAq/R8CuyI2oiAp/R8CuyI3ICv9HwK7IjiioCA1IDWiIDcgN6KgIjmjIjogNyA2oiA1IDiioSA5oyI1oEQAAABgnqDmP6IgOiA6oiA1IDWioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AggLAkAgMkUNACAGIDMgLv0bAyIvs0MAAAA0lEN3c/jCkiAvQf///wNxQYCAgPgDcr4iNEN1v7+/lJJDo+ncvyA0Q/lEtD6SlZJDAAAAP5S8Ii+zQwAAALSUkiAvQf///wNxQYCAgPgDcr4iM0N1v78/lJJDo+ncPyAzQ/lEtD6SlZI4AgwgByAT/R8DuyI1ICr9HwO7IjaiICn9HwO7IjcgK/0fA7siOKKgIDUgNaIgNyA3oqAiOaMiOiA3IDaiIDUgOKKhIDmjIjWgRAAAAGCeoOY/oiA6IDqiIDUgNaKgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCDAsgLCAL/VEiC/0bACAL/RsBciAL/RsCciAL/RsDckUNAgsCQCAIRAAAAAAAAAAAZQ0AAkACQCACDQAgACEvQQAhAgwBCwJAIAUgDEcNACACQX9qIQJBACEMIAv9GwBFDQAgIiAr/R8AIBqTiyAq/R8AIB6Ti5JdDQAgBkGAgOejfDYCACAHIBayOAIAQQAhDCALQQD9HAAhCwsCQCAFIBRHDQAgAkF/aiECQQAhFCAL/RsBRQ0AICMgK/0fASAbk4sgKv0fASAfk4uSXQ0AIAZBgIDno3w2AgQgByAXsjgCBEEAIRQgC0EA/RwBIQsLAkAgBSAVRw0AIAJBf2ohAkEAIRUgC/0bAkUNACAkICv9HwIgHJOLICr9HwIgIJOLkl0NACAGQYCA56N8NgIIIAcgGLI4AghBACEVIAtBAP0cAiELCwJAAkAgBSAARg0AIAAhLwwBCyACQX9qIQJBACEvIAv9GwNFDQAgJSAr/R8DIB2TiyAq/R8DICGTi5JdDQAgBkGAgOejfDYCDCAHIBmyOAIMQQAhLyALQQD9HAMhCwsgC/0bACAL/RsBciAL/RsCciAL/RsDckUNAwsCQAJAIAsgLSAqIBD95QH94AEgKyAO/eUB/eAB/eQBIi4gEv1D/VIiLP0bACIwICz9GwEiMXIgLP0bAiIyciAs/RsDIjtyRQ0AIAQgJmshACAFICZrIQMCQCAwRQ0AIAwNACACQQFqIQIgLv0fACEiICr9HwAhHiAr/R8AIRogACEMIAMhFgsCQCAxRQ0AIBQNACACQQFqIQIgLv0fASEjICr9HwEhHyAr/R8BIRsgACEUIAMhFwsCQCAyRQ0AIBUNACACQQFqIQIgLv0fAiEkICr9HwIhICAr/R8CIRwgACEVIAMhGAsgO0UNACAvDQAgAkEBaiECIC79HwMhJSAq/R8DISEgK/0fAyEdDAELIC8hACAZIQMLAkAgBSAnRg0AIAMhGQwBCyADIRkgBCEnIAUhJiAqIRAgKyEOCyAEQQJqIQQgBSABTiEDIA0gBUEBaiIFakEBRw0ACwsgA0EBcUUNDQsCQAJAAkAgC/0bAEUNACAGQYCA56N8NgIAAkAgCEQAAAAAAAAAAGRFDQAgB0EANgIAIAv9GwFFDQMgBkGAgOejfDYCBAwCCyAL/RsBRQ0CIAZBgIDno3w2AgQMAgsgC/0bAUUNASAGQYCA56N8NgIEIAhEAAAAAAAAAABlDQELIAdBADYCBAsCQCAL/RsCRQ0AIAZBgIDno3w2AggCQCAIRAAAAAAAAAAAZEUNACAHQQA2AgggC/0bA0UNDiAGQYCA56N8NgIMDA0LIAv9GwNFDQ0gBkGAgOejfDYCDA8LIAv9GwNFDQwgBkGAgOejfDYCDCAIRAAAAAAAAAAAZA0LDAwLAkACQCABQQFODQD9DP////////////////////8hLQwBC0EAIQxBACABayENIAIrAwC2/RMgAisDCLb9IAEgAisDELb9IAIgAisDGLb9IAMiDiAO/eYBIQ8gAysDALb9EyADKwMItv0gASADKwMQtv0gAiADKwMYtv0gAyIQIBD95gEhESAItv0TIRL9DAAAAAAAAAAAAAAAAAAAAAAhE/0M/////////////////////yEtQQIhBEEAIRRBACEVQQAhAEEAIRZBACEXQQAhGEEAIRlDAAAAACEaQwAAAAAhG0MAAAAAIRxDAAAAACEdQwAAAAAhHkMAAAAAIR9DAAAAACEgQwAAAAAhIUMAAAAAISJDAAAAACEjQwAAAAAhJEMAAAAAISVBACEDQQAhJkEBIQVBACECQQEhJ/0MAACAPwAAgD8AAIA/AACAPyIuISkgECEqIA4hKwJAA0AgESArIiz94AEiK/3kASELICwgKSIR/eYBICoiKiAT/eYB/eUBIikgKf3kASAu/eQBISkgLCAT/eYBICogEf3mAf3kASIsICz95AEhEwJAIC39DAAAAAAAAAAAAAAAAAAAAAAiKCAq/eABIiwgKyAr/eQB/eYBICz95QEgCf3kASIqICr95gEiESAKIA/95AEgC/3lASIrICv95gEiD/3kASIL/QwAJHRJACR0SQAkdEkAJHRJ/UT9UiIs/RsAIi8gLP0bASIwciAs/RsCIjFyICz9GwMiMnJFDQAgBbJDd3P4QpIhMwJAIC9FDQAgBiAzIAv9GwAiL7NDAAAANJRDd3P4wpIgL0H///8DcUGAgID4A3K+IjRDdb+/v5SSQ6Pp3L8gNEP5RLQ+kpWSQwAAAD+UvCIvs0MAAAC0lJIgL0H///8DcUGAgID4A3K+IjRDdb+/P5SSQ6Pp3D8gNEP5RLQ+kpWSOAIAIAcgE/0fALsiNSAq/R8AuyI2oiAp/R8AuyI3ICv9HwC7IjiioCA1IDWiIDcgN6KgIjmjIjogNyA2oiA1IDiioSA5oyI1oEQAAABgnqDmP6IgOiA6oiA1IDWioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgALAkAgMEUNACAGIDMgC/0bASIvs0MAAAA0lEN3c/jCkiAvQf///wNxQYCAgPgDcr4iNEN1v7+/lJJDo+ncvyA0Q/lEtD6SlZJDAAAAP5S8Ii+zQwAAALSUkiAvQf///wNxQYCAgPgDcr4iNEN1v78/lJJDo+ncPyA0Q/lEtD6SlZI4AgQgByAT/R8BuyI1ICr9HwG7IjaiICn9HwG7IjcgK/0fAbsiOKKgIDUgNaIgNyA3oqAiOaMiOiA3IDaiIDUgOKKhIDmjIjWgRAAAAGCeoOY/oiA6IDqiIDUgNaKgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCBAsCQCAxRQ0AIAYgMyAL/RsCIi+zQwAAADSUQ3dz+MKSIC9B////A3FBgICA+ANyviI0Q3W/v7+UkkOj6dy/IDRD+US0PpKVkkMAAAA/lLwiL7NDAAAAtJSSIC9B////A3FBgICA+ANyviI0Q3W/vz+UkkOj6dw/IDRD+US0PpKVkjgCCCAHIBP9HwK7IjUgKv0fArsiNqIgKf0fArsiNyAr/R8CuyI4oqAgNSA1oiA3IDeioCI5oyI6IDcgNqIgNSA4oqEgOaMiNaBEAAAAYJ6g5j+iIDogOqIgNSA1oqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIICwJAIDJFDQAgBiAzIAv9GwMiL7NDAAAANJRDd3P4wpIgL0H///8DcUGAgID4A3K+IjRDdb+/v5SSQ6Pp3L8gNEP5RLQ+kpWSQwAAAD+UvCIvs0MAAAC0lJIgL0H///8DcUGAgID4A3K+IjNDdb+/P5SSQ6Pp3D8gM0P5RLQ+kpWSOAIMIAcgE/0fA7siNSAq/R8DuyI2oiAp/R8DuyI3ICv9HwO7IjiioCA1IDWiIDcgN6KgIjmjIjogNyA2oiA1IDiioSA5oyI1oEQAAABgnqDmP6IgOiA6oiA1IDWioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgwLICwgLf1RIi39GwAgLf0bAXIgLf0bAnIgLf0bA3JFDQILAkAgCEQAAAAAAAAAAGUNAAJAAkAgAg0AIAAhL0EAIQIMAQsCQCAFIAxHDQAgAkF/aiECQQAhDCAt/RsARQ0AICIgK/0fACAak4sgKv0fACAek4uSXQ0AIAZBgIDno3w2AgAgByAWsjgCAEEAIQwgLUEA/RwAIS0LAkAgBSAURw0AIAJBf2ohAkEAIRQgLf0bAUUNACAjICv9HwEgG5OLICr9HwEgH5OLkl0NACAGQYCA56N8NgIEIAcgF7I4AgRBACEUIC1BAP0cASEtCwJAIAUgFUcNACACQX9qIQJBACEVIC39GwJFDQAgJCAr/R8CIByTiyAq/R8CICCTi5JdDQAgBkGAgOejfDYCCCAHIBiyOAIIQQAhFSAtQQD9HAIhLQsCQAJAIAUgAEYNACAAIS8MAQsgAkF/aiECQQAhLyAt/RsDRQ0AICUgK/0fAyAdk4sgKv0fAyAhk4uSXQ0AIAZBgIDno3w2AgwgByAZsjgCDEEAIS8gLUEA/RwDIS0LIC39GwAgLf0bAXIgLf0bAnIgLf0bA3JFDQMLAkACQCAtICggKiAQ/eUB/eABICsgDv3lAf3gAf3kASILIBL9Q/1SIiz9GwAiMCAs/RsBIjFyICz9GwIiMnIgLP0bAyI7ckUNACAEICZrIQAgBSAmayEDAkAgMEUNACAMDQAgAkEBaiECIAv9HwAhIiAq/R8AIR4gK/0fACEaIAAhDCADIRYLAkAgMUUNACAUDQAgAkEBaiECIAv9HwEhIyAq/R8BIR8gK/0fASEbIAAhFCADIRcLAkAgMkUNACAVDQAgAkEBaiECIAv9HwIhJCAq/R8CISAgK/0fAiEcIAAhFSADIRgLIDtFDQAgLw0AIAJBAWohAiAL/R8DISUgKv0fAyEhICv9HwMhHQwBCyAvIQAgGSEDCwJAIAUgJ0YNACADIRkMAQsgAyEZIAQhJyAFISYgKiEQICshDgsgBEECaiEEIAUgAU4hAyANIAVBAWoiBWpBAUcNAAsLIANBAXFFDQwLAkACQAJAIC39GwBFDQAgBkGAgOejfDYCAAJAIAhEAAAAAAAAAABkRQ0AIAdBADYCACAt/RsBRQ0DIAZBgIDno3w2AgQMAgsgLf0bAUUNAiAGQYCA56N8NgIEDAILIC39GwFFDQEgBkGAgOejfDYCBCAIRAAAAAAAAAAAZQ0BCyAHQQA2AgQLAkAgLf0bAkUNACAGQYCA56N8NgIIAkAgCEQAAAAAAAAAAGRFDQAgB0EANgIIIC39GwNFDQ0gBkGAgOejfDYCDAwMCyAt/RsDRQ0MIAZBgIDno3w2AgwPCyAt/RsDRQ0LIAZBgIDno3w2AgwgCEQAAAAAAAAAAGQNCgwLCwJAAkAgAUEBTg0A/Qz/////////////////////IQsMAQtBACEMQQAgAWshGSACKwMAtv0TIAIrAwi2/SABIAIrAxC2/SACIAIrAxi2/SADIiwgLP3mASEPIAi2/RMhEP0MAAAAAAAAAAAAAAAAAAAAACET/Qz/////////////////////IQtBAiEEQQAhFEEAIRVBACENQQAhFkEAIRdBACEYQQAhL0MAAAAAIRpDAAAAACEbQwAAAAAhHEMAAAAAIR1DAAAAACEeQwAAAAAhH0MAAAAAISBDAAAAACEhQwAAAAAhIkMAAAAAISNDAAAAACEkQwAAAAAhJUEAIQJBACEmQQEhBUEAIQBBASEn/QwAAIA/AACAPwAAgD8AAIA/Ii0hKSADKwMAtv0TIAMrAwi2/SABIAMrAxC2/SACIAMrAxi2/SAD/eEBIi4hKyAs/eABIg4hKgJAA0AgKyIs/QwAAADAAAAAwAAAAMAAAADA/eYBICr95gEhKyApIhEgKv3mASAsIBP95gH95QEiKSAp/eQBIC395AEhKSATICr95gEgLCAR/eYB/eQBIiogKv3kASETIA8gCv3kASAsICz95gH95QEiLP3gASEqAkAgC/0MAAAAAAAAAAAAAAAAAAAAACIRICwgLP3mASIPICsgCf3lASIrICv95gH95AEiKP0MACR0SQAkdEkAJHRJACR0Sf1E/VIiLP0bACIDICz9GwEiMHIgLP0bAiIxciAs/RsDIjJyRQ0AIAWyQ3dz+EKSITMCQCADRQ0AIAYgMyAo/RsAIgOzQwAAADSUQ3dz+MKSIANB////A3FBgICA+ANyviI0Q3W/v7+UkkOj6dy/IDRD+US0PpKVkkMAAAA/lLwiA7NDAAAAtJSSIANB////A3FBgICA+ANyviI0Q3W/vz+UkkOj6dw/IDRD+US0PpKVkjgCACAHIBP9HwC7IjUgK/0fALsiNqIgKf0fALsiNyAq/R8AuyI4oqAgNSA1oiA3IDeioCI5oyI6IDcgNqIgNSA4oqEgOaMiNaBEAAAAYJ6g5j+iIDogOqIgNSA1oqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIACwJAIDBFDQAgBiAzICj9GwEiA7NDAAAANJRDd3P4wpIgA0H///8DcUGAgID4A3K+IjRDdb+/v5SSQ6Pp3L8gNEP5RLQ+kpWSQwAAAD+UvCIDs0MAAAC0lJIgA0H///8DcUGAgID4A3K+IjRDdb+/P5SSQ6Pp3D8gNEP5RLQ+kpWSOAIEIAcgE/0fAbsiNSAr/R8BuyI2oiAp/R8BuyI3ICr9HwG7IjiioCA1IDWiIDcgN6KgIjmjIjogNyA2oiA1IDiioSA5oyI1oEQAAABgnqDmP6IgOiA6oiA1IDWioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgQLAkAgMUUNACAGIDMgKP0bAiIDs0MAAAA0lEN3c/jCkiADQf///wNxQYCAgPgDcr4iNEN1v7+/lJJDo+ncvyA0Q/lEtD6SlZJDAAAAP5S8IgOzQwAAALSUkiADQf///wNxQYCAgPgDcr4iNEN1v78/lJJDo+ncPyA0Q/lEtD6SlZI4AgggByAT/R8CuyI1ICv9HwK7IjaiICn9HwK7IjcgKv0fArsiOKKgIDUgNaIgNyA3oqAiOaMiOiA3IDaiIDUgOKKhIDmjIjWgRAAAAGCeoOY/oiA6IDqiIDUgNaKgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCCAsCQCAyRQ0AIAYgMyAo/RsDIgOzQwAAADSUQ3dz+MKSIANB////A3FBgICA+ANyviI0Q3W/v7+UkkOj6dy/IDRD+US0PpKVkkMAAAA/lLwiA7NDAAAAtJSSIANB////A3FBgICA+ANyviIzQ3W/vz+UkkOj6dw/IDND+US0PpKVkjgCDCAHIBP9HwO7IjUgK/0fA7siNqIgKf0fA7siNyAq/R8DuyI4oqAgNSA1oiA3IDeioCI5oyI6IDcgNqIgNSA4oqEgOaMiNaBEAAAAYJ6g5j+iIDogOqIgNSA1oqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIMCyAsIAv9USIL/RsAIAv9GwFyIAv9GwJyIAv9GwNyRQ0CCwJAIAhEAAAAAAAAAABlDQACQAJAIAANACANITBBACEADAELAkAgBSAMRw0AIABBf2ohAEEAIQwgC/0bAEUNACAiICr9HwAgGpOLICv9HwAgHpOLkl0NACAGQYCA56N8NgIAIAcgFrI4AgBBACEMIAtBAP0cACELCwJAIAUgFEcNACAAQX9qIQBBACEUIAv9GwFFDQAgIyAq/R8BIBuTiyAr/R8BIB+Ti5JdDQAgBkGAgOejfDYCBCAHIBeyOAIEQQAhFCALQQD9HAEhCwsCQCAFIBVHDQAgAEF/aiEAQQAhFSAL/RsCRQ0AICQgKv0fAiAck4sgK/0fAiAgk4uSXQ0AIAZBgIDno3w2AgggByAYsjgCCEEAIRUgC0EA/RwCIQsLAkACQCAFIA1GDQAgDSEwDAELIABBf2ohAEEAITAgC/0bA0UNACAlICr9HwMgHZOLICv9HwMgIZOLkl0NACAGQYCA56N8NgIMIAcgL7I4AgxBACEwIAtBAP0cAyELCyAL/RsAIAv9GwFyIAv9GwJyIAv9GwNyRQ0DCwJAAkAgCyARICogDv3lAf3gASArIC795QH94AH95AEiKCAQ/UP9UiIs/RsAIgIgLP0bASIxciAs/RsCIjJyICz9GwMiO3JFDQAgBCAmayENIAUgJmshAwJAIAJFDQAgDA0AIABBAWohACAo/R8AISIgK/0fACEeICr9HwAhGiANIQwgAyEWCwJAIDFFDQAgFA0AIABBAWohACAo/R8BISMgK/0fASEfICr9HwEhGyANIRQgAyEXCwJAIDJFDQAgFQ0AIABBAWohACAo/R8CISQgK/0fAiEgICr9HwIhHCANIRUgAyEYCyA7RQ0AIDANACAAQQFqIQAgKP0fAyElICv9HwMhISAq/R8DIR0MAQsgMCENIC8hAwsCQCAFICdGDQAgAyEvDAELIAMhLyAEIScgBSEmICshLiAqIQ4LIARBAmohBCAFIAFOIQIgGSAFQQFqIgVqQQFHDQALCyACQQFxRQ0LCwJAAkACQCAL/RsARQ0AIAZBgIDno3w2AgACQCAIRAAAAAAAAAAAZEUNACAHQQA2AgAgC/0bAUUNAyAGQYCA56N8NgIEDAILIAv9GwFFDQIgBkGAgOejfDYCBAwCCyAL/RsBRQ0BIAZBgIDno3w2AgQgCEQAAAAAAAAAAGUNAQsgB0EANgIECwJAIAv9GwJFDQAgBkGAgOejfDYCCAJAIAhEAAAAAAAAAABkRQ0AIAdBADYCCCAL/RsDRQ0MIAZBgIDno3w2AgwMCwsgC/0bA0UNCyAGQYCA56N8NgIMDwsgC/0bA0UNCiAGQYCA56N8NgIMIAhEAAAAAAAAAABkDQkMCgsCQAJAIAFBAU4NAP0M/////////////////////yELDAELQQAhDEEAIAFrIQ0gAisDALb9EyACKwMItv0gASACKwMQtv0gAiACKwMYtv0gAyIOIA795gEhDyADKwMAtv0TIAMrAwi2/SABIAMrAxC2/SACIAMrAxi2/SADIhAgEP3mASERIAi2/RMhEv0MAAAAAAAAAAAAAAAAAAAAACET/Qz/////////////////////IQtBAiEEQQAhFEEAIRVBACEAQQAhFkEAIRdBACEYQQAhGUMAAAAAIRpDAAAAACEbQwAAAAAhHEMAAAAAIR1DAAAAACEeQwAAAAAhH0MAAAAAISBDAAAAACEhQwAAAAAhIkMAAAAAISNDAAAAACEkQwAAAAAhJUEAIQNBACEmQQEhBUEAIQJBASEn/QwAAIA/AACAPwAAgD8AAIA/IighKSAQISogDiErAkADQCArIiwgKSIr/eYBICoiKiAT/eYB/eUBIikgKf3kASAo/eQBISkgLCAT/eYBICogK/3mAf3kASIrICv95AEhEwJAIAv9DAAAAAAAAAAAAAAAAAAAAAAiLSAKIA8gEf3lAf3gAf3kASIrICv95gEiDyAqICwgLP3kAf3mASAJ/eQBIiogKv3mASIR/eQBIi79DAAkdEkAJHRJACR0SQAkdEn9RP1SIiz9GwAiLyAs/RsBIjByICz9GwIiMXIgLP0bAyIyckUNACAFskN3c/hCkiEzAkAgL0UNACAGIDMgLv0bACIvs0MAAAA0lEN3c/jCkiAvQf///wNxQYCAgPgDcr4iNEN1v7+/lJJDo+ncvyA0Q/lEtD6SlZJDAAAAP5S8Ii+zQwAAALSUkiAvQf///wNxQYCAgPgDcr4iNEN1v78/lJJDo+ncPyA0Q/lEtD6SlZI4AgAgByAT/R8AuyI1ICr9HwC7IjaiICn9HwC7IjcgK/0fALsiOKKgIDUgNaIgNyA3oqAiOaMiOiA3IDaiIDUgOKKhIDmjIjWgRAAAAGCeoOY/oiA6IDqiIDUgNaKgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCAAsCQCAwRQ0AIAYgMyAu/RsBIi+zQwAAADSUQ3dz+MKSIC9B////A3FBgICA+ANyviI0Q3W/v7+UkkOj6dy/IDRD+US0PpKVkkMAAAA/lLwiL7NDAAAAtJSSIC9B////A3FBgICA+ANyviI0Q3W/vz+UkkOj6dw/IDRD+US0PpKVkjgCBCAHIBP9HwG7IjUgKv0fAbsiNqIgKf0fAbsiNyAr/R8BuyI4oqAgNSA1oiA3IDeioCI5oyI6IDcgNqIgNSA4oqEgOaMiNaBEAAAAYJ6g5j+iIDogOqIgNSA1oqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIECwJAIDFFDQAgBiAzIC79GwIiL7NDAAAANJRDd3P4wpIgL0H///8DcUGAgID4A3K+IjRDdb+/v5SSQ6Pp3L8gNEP5RLQ+kpWSQwAAAD+UvCIvs0MAAAC0lJIgL0H///8DcUGAgID4A3K+IjRDdb+/P5SSQ6Pp3D8gNEP5RLQ+kpWSOAIIIAcgE/0fArsiNSAq/R8CuyI2oiAp/R8CuyI3ICv9HwK7IjiioCA1IDWiIDcgN6KgIjmjIjogNyA2oiA1IDiioSA5oyI1oEQAAABgnqDmP6IgOiA6oiA1IDWioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AggLAkAgMkUNACAGIDMgLv0bAyIvs0MAAAA0lEN3c/jCkiAvQf///wNxQYCAgPgDcr4iNEN1v7+/lJJDo+ncvyA0Q/lEtD6SlZJDAAAAP5S8Ii+zQwAAALSUkiAvQf///wNxQYCAgPgDcr4iM0N1v78/lJJDo+ncPyAzQ/lEtD6SlZI4AgwgByAT/R8DuyI1ICr9HwO7IjaiICn9HwO7IjcgK/0fA7siOKKgIDUgNaIgNyA3oqAiOaMiOiA3IDaiIDUgOKKhIDmjIjWgRAAAAGCeoOY/oiA6IDqiIDUgNaKgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCDAsgLCAL/VEiC/0bACAL/RsBciAL/RsCciAL/RsDckUNAgsCQCAIRAAAAAAAAAAAZQ0AAkACQCACDQAgACEvQQAhAgwBCwJAIAUgDEcNACACQX9qIQJBACEMIAv9GwBFDQAgIiAr/R8AIBqTiyAq/R8AIB6Ti5JdDQAgBkGAgOejfDYCACAHIBayOAIAQQAhDCALQQD9HAAhCwsCQCAFIBRHDQAgAkF/aiECQQAhFCAL/RsBRQ0AICMgK/0fASAbk4sgKv0fASAfk4uSXQ0AIAZBgIDno3w2AgQgByAXsjgCBEEAIRQgC0EA/RwBIQsLAkAgBSAVRw0AIAJBf2ohAkEAIRUgC/0bAkUNACAkICv9HwIgHJOLICr9HwIgIJOLkl0NACAGQYCA56N8NgIIIAcgGLI4AghBACEVIAtBAP0cAiELCwJAAkAgBSAARg0AIAAhLwwBCyACQX9qIQJBACEvIAv9GwNFDQAgJSAr/R8DIB2TiyAq/R8DICGTi5JdDQAgBkGAgOejfDYCDCAHIBmyOAIMQQAhLyALQQD9HAMhCwsgC/0bACAL/RsBciAL/RsCciAL/RsDckUNAwsCQAJAIAsgLSArIA795QH94AEgKiAQ/eUB/eAB/eQBIi4gEv1D/VIiLP0bACIwICz9GwEiMXIgLP0bAiIyciAs/RsDIjtyRQ0AIAQgJmshACAFICZrIQMCQCAwRQ0AIAwNACACQQFqIQIgLv0fACEiICr9HwAhHiAr/R8AIRogACEMIAMhFgsCQCAxRQ0AIBQNACACQQFqIQIgLv0fASEjICr9HwEhHyAr/R8BIRsgACEUIAMhFwsCQCAyRQ0AIBUNACACQQFqIQIgLv0fAiEkICr9HwIhICAr/R8CIRwgACEVIAMhGAsgO0UNACAvDQAgAkEBaiECIC79HwMhJSAq/R8DISEgK/0fAyEdDAELIC8hACAZIQMLAkAgBSAnRg0AIAMhGQwBCyADIRkgBCEnIAUhJiAqIRAgKyEOCyAEQQJqIQQgBSABTiEDIA0gBUEBaiIFakEBRw0ACwsgA0EBcUUNCgsCQAJAAkAgC/0bAEUNACAGQYCA56N8NgIAAkAgCEQAAAAAAAAAAGRFDQAgB0EANgIAIAv9GwFFDQMgBkGAgOejfDYCBAwCCyAL/RsBRQ0CIAZBgIDno3w2AgQMAgsgC/0bAUUNASAGQYCA56N8NgIEIAhEAAAAAAAAAABlDQELIAdBADYCBAsCQCAL/RsCRQ0AIAZBgIDno3w2AggCQCAIRAAAAAAAAAAAZEUNACAHQQA2AgggC/0bA0UNCyAGQYCA56N8NgIMDAoLIAv9GwNFDQogBkGAgOejfDYCDA8LIAv9GwNFDQkgBkGAgOejfDYCDCAIRAAAAAAAAAAAZA0IDAkLAkACQCABQQFODQD9DP////////////////////8hDgwBC0EAIQxBACABayENIAIrAwC2/RMgAisDCLb9IAEgAisDELb9IAIgAisDGLb9IAMiEiAS/eYBIREgAysDALb9EyADKwMItv0gASADKwMQtv0gAiADKwMYtv0gAyI8IDz95gEhLCAItv0TIT39DAAAAAAAAAAAAAAAAAAAAAAhKf0M/////////////////////yEOQQIhBEEAIRRBACEVQQAhAEEAIRZBACEXQQAhGEEAIRlDAAAAACEaQwAAAAAhG0MAAAAAIRxDAAAAACEdQwAAAAAhHkMAAAAAIR9DAAAAACEgQwAAAAAhIUMAAAAAISJDAAAAACEjQwAAAAAhJEMAAAAAISVBACEDQQAhJkEBIQVBACECQQEhJ/0MAACAPwAAgD8AAIA/AACAPyIQIQ8gPCErIBIhEwJAA0AgLCARIir9DAAAwMAAAMDAAADAwAAAwMD95gH95AEgLP3mASERIBMiEyAp/eYBICsiKyAP/eYB/eQBIgsgKiAs/eUBIi39DAAAgEAAAIBAAACAQAAAgEAiKP3mASIu/eYBIBMgK/3mASIs/QwAAABBAAAAQQAAAEEAAABB/eYBIBMgD/3mASArICn95gH95QEiK/3mAf3kASEpICsgLv3mASAQ/eQBICz9DAAAAMEAAADBAAAAwQAAAMH95gEgC/3mAf3kASEPAkAgDv0MAAAAAAAAAAAAAAAAAAAAACILIC0gLCAo/eYB/eAB/eYBIAn95AEiKyAr/eYBIiwgESAqICr95gEgCv3kAf3kASITIBP95gEiEf3kASIt/QwAJHRJACR0SQAkdEkAJHRJ/UT9UiIq/RsAIi8gKv0bASIwciAq/RsCIjFyICr9GwMiMnJFDQAgBbIhMwJAIC9FDQAgBiAzIC39GwAiL7NDAAAANJRDd3P4wpIgL0H///8DcUGAgID4A3K+IjRDdb+/v5SSQ6Pp3L8gNEP5RLQ+kpWSQwAAAD+UvCIvs0MAAAA0lEN3c/jCkiAvQf///wNxQYCAgPgDcr4iNEN1v7+/lJJDo+ncvyA0Q/lEtD6SlZJDAAAAP5STOAIAIAcgKf0fALsiNSAr/R8AuyI2oiAP/R8AuyI3IBP9HwC7IjiioCA1IDWiIDcgN6KgIjmjIjogNyA2oiA1IDiioSA5oyI1oEQAAABgnqDmP6IgOiA6oiA1IDWioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgALAkAgMEUNACAGIDMgLf0bASIvs0MAAAA0lEN3c/jCkiAvQf///wNxQYCAgPgDcr4iNEN1v7+/lJJDo+ncvyA0Q/lEtD6SlZJDAAAAP5S8Ii+zQwAAADSUQ3dz+MKSIC9B////A3FBgICA+ANyviI0Q3W/v7+UkkOj6dy/IDRD+US0PpKVkkMAAAA/lJM4AgQgByAp/R8BuyI1ICv9HwG7IjaiIA/9HwG7IjcgE/0fAbsiOKKgIDUgNaIgNyA3oqAiOaMiOiA3IDaiIDUgOKKhIDmjIjWgRAAAAGCeoOY/oiA6IDqiIDUgNaKgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCBAsCQCAxRQ0AIAYgMyAt/RsCIi+zQwAAADSUQ3dz+MKSIC9B////A3FBgICA+ANyviI0Q3W/v7+UkkOj6dy/IDRD+US0PpKVkkMAAAA/lLwiL7NDAAAANJRDd3P4wpIgL0H///8DcUGAgID4A3K+IjRDdb+/v5SSQ6Pp3L8gNEP5RLQ+kpWSQwAAAD+UkzgCCCAHICn9HwK7IjUgK/0fArsiNqIgD/0fArsiNyAT/R8CuyI4oqAgNSA1oiA3IDeioCI5oyI6IDcgNqIgNSA4oqEgOaMiNaBEAAAAYJ6g5j+iIDogOqIgNSA1oqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIICwJAIDJFDQAgBiAzIC39GwMiL7NDAAAANJRDd3P4wpIgL0H///8DcUGAgID4A3K+IjRDdb+/v5SSQ6Pp3L8gNEP5RLQ+kpWSQwAAAD+UvCIvs0MAAAA0lEN3c/jCkiAvQf///wNxQYCAgPgDcr4iNEN1v7+/lJJDo+ncvyA0Q/lEtD6SlZJDAAAAP5STOAIMIAcgKf0fA7siNSAr/R8DuyI2oiAP/R8DuyI3IBP9HwO7IjiioCA1IDWiIDcgN6KgIjmjIjogNyA2oiA1IDiioSA5oyI1oEQAAABgnqDmP6IgOiA6oiA1IDWioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgwLICogDv1RIg79GwAgDv0bAXIgDv0bAnIgDv0bA3JFDQILAkAgCEQAAAAAAAAAAGUNAAJAAkAgAg0AIAAhL0EAIQIMAQsCQCAFIAxHDQAgAkF/aiECQQAhDCAO/RsARQ0AICIgE/0fACAak4sgK/0fACAek4uSXQ0AIAZBgIDno3w2AgAgByAWsjgCAEEAIQwgDkEA/RwAIQ4LAkAgBSAURw0AIAJBf2ohAkEAIRQgDv0bAUUNACAjIBP9HwEgG5OLICv9HwEgH5OLkl0NACAGQYCA56N8NgIEIAcgF7I4AgRBACEUIA5BAP0cASEOCwJAIAUgFUcNACACQX9qIQJBACEVIA79GwJFDQAgJCAT/R8CIByTiyAr/R8CICCTi5JdDQAgBkGAgOejfDYCCCAHIBiyOAIIQQAhFSAOQQD9HAIhDgsCQAJAIAUgAEYNACAAIS8MAQsgAkF/aiECQQAhLyAO/RsDRQ0AICUgE/0fAyAdk4sgK/0fAyAhk4uSXQ0AIAZBgIDno3w2AgwgByAZsjgCDEEAIS8gDkEA/RwDIQ4LIA79GwAgDv0bAXIgDv0bAnIgDv0bA3JFDQMLAkACQCAOIAsgKyA8/eUB/eABIBMgEv3lAf3gAf3kASItID39Q/1SIir9GwAiMCAq/RsBIjFyICr9GwIiMnIgKv0bAyI7ckUNACAEICZrIQAgBSAmayEDAkAgMEUNACAMDQAgAkEBaiECIC39HwAhIiAr/R8AIR4gE/0fACEaIAAhDCADIRYLAkAgMUUNACAUDQAgAkEBaiECIC39HwEhIyAr/R8BIR8gE/0fASEbIAAhFCADIRcLAkAgMkUNACAVDQAgAkEBaiECIC39HwIhJCAr/R8CISAgE/0fAiEcIAAhFSADIRgLIDtFDQAgLw0AIAJBAWohAiAt/R8DISUgK/0fAyEhIBP9HwMhHQwBCyAvIQAgGSEDCwJAIAUgJ0YNACADIRkMAQsgAyEZIAQhJyAFISYgKyE8IBMhEgsgBEECaiEEIAUgAU4hAyANIAVBAWoiBWpBAUcNAAsLIANBAXFFDQkLAkACQAJAIA79GwBFDQAgBkGAgOejfDYCAAJAIAhEAAAAAAAAAABkRQ0AIAdBADYCACAO/RsBRQ0DIAZBgIDno3w2AgQMAgsgDv0bAUUNAiAGQYCA56N8NgIEDAILIA79GwFFDQEgBkGAgOejfDYCBCAIRAAAAAAAAAAAZQ0BCyAHQQA2AgQLAkAgDv0bAkUNACAGQYCA56N8NgIIAkAgCEQAAAAAAAAAAGRFDQAgB0EANgIIIA79GwNFDQogBkGAgOejfDYCDAwJCyAO/RsDRQ0JIAZBgIDno3w2AgwPCyAO/RsDRQ0IIAZBgIDno3w2AgwgCEQAAAAAAAAAAGQNBwwICwJAAkAgAUEBTg0A/Qz/////////////////////IS4MAQtBACEMQQAgAWshDSACKwMAtv0TIAIrAwi2/SABIAIrAxC2/SACIAIrAxi2/SADIhAgEP3mASELIAMrAwC2/RMgAysDCLb9IAEgAysDELb9IAIgAysDGLb9IAMiEiAS/eYBIQ8gCLb9EyE8/QwAAAAAAAAAAAAAAAAAAAAAIRH9DP////////////////////8hLkECIQRBACEUQQAhFUEAIQBBACEWQQAhF0EAIRhBACEZQwAAAAAhGkMAAAAAIRtDAAAAACEcQwAAAAAhHUMAAAAAIR5DAAAAACEfQwAAAAAhIEMAAAAAISFDAAAAACEiQwAAAAAhI0MAAAAAISRDAAAAACElQQAhA0EAISZBASEFQQAhAkEBISf9DAAAgD8AAIA/AACAPwAAgD8iDiETIBIhKiAQISsCQANAICoiLSArIiogKv3kAf3mASIrIBP95gEgCyIpIA8iD/3lASILIBEiKP3mAf3kAf0MAABAQAAAQEAAAEBAAABAQCIs/eYBIREgCyAT/eYBICsgKP3mAf3lASAs/eYBIA795AEhEwJAIC79DAAAAAAAAAAAAAAAAAAAAAAiKCApIA8gLP3mAf3lASAq/eAB/eYBIAr95AEiKyAr/eYBIgsgKSAs/eYBIA/95QEgLf3gAf3mASAJ/eQBIiogKv3mASIP/eQBIin9DAAkdEkAJHRJACR0SQAkdEn9RP1SIiz9GwAiLyAs/RsBIjByICz9GwIiMXIgLP0bAyIyckUNACAFsiEzAkAgL0UNACAGIDMgKf0bACIvs0MAAAA0lEN3c/jCkiAvQf///wNxQYCAgPgDcr4iNEN1v7+/lJJDo+ncvyA0Q/lEtD6SlZJDAAAAP5S8Ii+zQwAAADSUQ3dz+MKSIC9B////A3FBgICA+ANyviI0Q3W/v7+UkkOj6dy/IDRD+US0PpKVkkOdhCG/lJI4AgAgByAR/R8AuyI1ICr9HwC7IjaiIBP9HwC7IjcgK/0fALsiOKKgIDUgNaIgNyA3oqAiOaMiOiA3IDaiIDUgOKKhIDmjIjWgRAAAAGCeoOY/oiA6IDqiIDUgNaKgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCAAsCQCAwRQ0AIAYgMyAp/RsBIi+zQwAAADSUQ3dz+MKSIC9B////A3FBgICA+ANyviI0Q3W/v7+UkkOj6dy/IDRD+US0PpKVkkMAAAA/lLwiL7NDAAAANJRDd3P4wpIgL0H///8DcUGAgID4A3K+IjRDdb+/v5SSQ6Pp3L8gNEP5RLQ+kpWSQ52EIb+UkjgCBCAHIBH9HwG7IjUgKv0fAbsiNqIgE/0fAbsiNyAr/R8BuyI4oqAgNSA1oiA3IDeioCI5oyI6IDcgNqIgNSA4oqEgOaMiNaBEAAAAYJ6g5j+iIDogOqIgNSA1oqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIECwJAIDFFDQAgBiAzICn9GwIiL7NDAAAANJRDd3P4wpIgL0H///8DcUGAgID4A3K+IjRDdb+/v5SSQ6Pp3L8gNEP5RLQ+kpWSQwAAAD+UvCIvs0MAAAA0lEN3c/jCkiAvQf///wNxQYCAgPgDcr4iNEN1v7+/lJJDo+ncvyA0Q/lEtD6SlZJDnYQhv5SSOAIIIAcgEf0fArsiNSAq/R8CuyI2oiAT/R8CuyI3ICv9HwK7IjiioCA1IDWiIDcgN6KgIjmjIjogNyA2oiA1IDiioSA5oyI1oEQAAABgnqDmP6IgOiA6oiA1IDWioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AggLAkAgMkUNACAGIDMgKf0bAyIvs0MAAAA0lEN3c/jCkiAvQf///wNxQYCAgPgDcr4iNEN1v7+/lJJDo+ncvyA0Q/lEtD6SlZJDAAAAP5S8Ii+zQwAAADSUQ3dz+MKSIC9B////A3FBgICA+ANyviI0Q3W/v7+UkkOj6dy/IDRD+US0PpKVkkOdhCG/lJI4AgwgByAR/R8DuyI1ICr9HwO7IjaiIBP9HwO7IjcgK/0fA7siOKKgIDUgNaIgNyA3oqAiOaMiOiA3IDaiIDUgOKKhIDmjIjWgRAAAAGCeoOY/oiA6IDqiIDUgNaKgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCDAsgLCAu/VEiLv0bACAu/RsBciAu/RsCciAu/RsDckUNAgsCQCAIRAAAAAAAAAAAZQ0AAkACQCACDQAgACEvQQAhAgwBCwJAIAUgDEcNACACQX9qIQJBACEMIC79GwBFDQAgIiAr/R8AIBqTiyAq/R8AIB6Ti5JdDQAgBkGAgOejfDYCACAHIBayOAIAQQAhDCAuQQD9HAAhLgsCQCAFIBRHDQAgAkF/aiECQQAhFCAu/RsBRQ0AICMgK/0fASAbk4sgKv0fASAfk4uSXQ0AIAZBgIDno3w2AgQgByAXsjgCBEEAIRQgLkEA/RwBIS4LAkAgBSAVRw0AIAJBf2ohAkEAIRUgLv0bAkUNACAkICv9HwIgHJOLICr9HwIgIJOLkl0NACAGQYCA56N8NgIIIAcgGLI4AghBACEVIC5BAP0cAiEuCwJAAkAgBSAARg0AIAAhLwwBCyACQX9qIQJBACEvIC79GwNFDQAgJSAr/R8DIB2TiyAq/R8DICGTi5JdDQAgBkGAgOejfDYCDCAHIBmyOAIMQQAhLyAuQQD9HAMhLgsgLv0bACAu/RsBciAu/RsCciAu/RsDckUNAwsCQAJAIC4gKCArIBD95QH94AEgKiAS/eUB/eAB/eQBIikgPP1D/VIiLP0bACIwICz9GwEiMXIgLP0bAiIyciAs/RsDIjtyRQ0AIAQgJmshACAFICZrIQMCQCAwRQ0AIAwNACACQQFqIQIgKf0fACEiICr9HwAhHiAr/R8AIRogACEMIAMhFgsCQCAxRQ0AIBQNACACQQFqIQIgKf0fASEjICr9HwEhHyAr/R8BIRsgACEUIAMhFwsCQCAyRQ0AIBUNACACQQFqIQIgKf0fAiEkICr9HwIhICAr/R8CIRwgACEVIAMhGAsgO0UNACAvDQAgAkEBaiECICn9HwMhJSAq/R8DISEgK/0fAyEdDAELIC8hACAZIQMLAkAgBSAnRg0AIAMhGQwBCyADIRkgBCEnIAUhJiAqIRIgKyEQCyAEQQJqIQQgBSABTiEDIA0gBUEBaiIFakEBRw0ACwsgA0EBcUUNCAsCQAJAAkAgLv0bAEUNACAGQYCA56N8NgIAAkAgCEQAAAAAAAAAAGRFDQAgB0EANgIAIC79GwFFDQMgBkGAgOejfDYCBAwCCyAu/RsBRQ0CIAZBgIDno3w2AgQMAgsgLv0bAUUNASAGQYCA56N8NgIEIAhEAAAAAAAAAABlDQELIAdBADYCBAsCQCAu/RsCRQ0AIAZBgIDno3w2AggCQCAIRAAAAAAAAAAAZEUNACAHQQA2AgggLv0bA0UNCSAGQYCA56N8NgIMDAgLIC79GwNFDQggBkGAgOejfDYCDA8LIC79GwNFDQcgBkGAgOejfDYCDCAIRAAAAAAAAAAAZA0GDAcLAkACQCABQQFODQD9DP////////////////////8hCwwBC0EAIQxBACABayENIAIrAwC2/RMgAisDCLb9IAEgAisDELb9IAIgAisDGLb9IAMiDiAO/eYBIQ8gAysDALb9EyADKwMItv0gASADKwMQtv0gAiADKwMYtv0gAyIQIBD95gEhESAItv0TIRL9DAAAAAAAAAAAAAAAAAAAAAAhE/0M/////////////////////yELQQIhBEEAIRRBACEVQQAhAEEAIRZBACEXQQAhGEEAIRlDAAAAACEaQwAAAAAhG0MAAAAAIRxDAAAAACEdQwAAAAAhHkMAAAAAIR9DAAAAACEgQwAAAAAhIUMAAAAAISJDAAAAACEjQwAAAAAhJEMAAAAAISVBACEDQQAhJkEBIQVBACECQQEhJ/0MAACAPwAAgD8AAIA/AACAPyIoISkgECEqIA4hKwJAA0AgDyAR/eUBIQ8gKyIsICkiK/3mASAqIiogE/3mAf3lASIpICn95AEgKP3kASEpICwgE/3mASAqICv95gH95AEiKyAr/eQBIRMCQCAL/QwAAAAAAAAAAAAAAAAAAAAAIi0gCSAqICwgLP3kAf3mAf3gAf3kASIqICr95gEiESAPIAr95AEiKyAr/eYBIg/95AEiLv0MACR0SQAkdEkAJHRJACR0Sf1E/VIiLP0bACIvICz9GwEiMHIgLP0bAiIxciAs/RsDIjJyRQ0AIAWyQ3dz+EKSITMCQCAvRQ0AIAYgMyAu/RsAIi+zQwAAADSUQ3dz+MKSIC9B////A3FBgICA+ANyviI0Q3W/v7+UkkOj6dy/IDRD+US0PpKVkkMAAAA/lLwiL7NDAAAAtJSSIC9B////A3FBgICA+ANyviI0Q3W/vz+UkkOj6dw/IDRD+US0PpKVkjgCACAHIBP9HwC7IjUgKv0fALsiNqIgKf0fALsiNyAr/R8AuyI4oqAgNSA1oiA3IDeioCI5oyI6IDcgNqIgNSA4oqEgOaMiNaBEAAAAYJ6g5j+iIDogOqIgNSA1oqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIACwJAIDBFDQAgBiAzIC79GwEiL7NDAAAANJRDd3P4wpIgL0H///8DcUGAgID4A3K+IjRDdb+/v5SSQ6Pp3L8gNEP5RLQ+kpWSQwAAAD+UvCIvs0MAAAC0lJIgL0H///8DcUGAgID4A3K+IjRDdb+/P5SSQ6Pp3D8gNEP5RLQ+kpWSOAIEIAcgE/0fAbsiNSAq/R8BuyI2oiAp/R8BuyI3ICv9HwG7IjiioCA1IDWiIDcgN6KgIjmjIjogNyA2oiA1IDiioSA5oyI1oEQAAABgnqDmP6IgOiA6oiA1IDWioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgQLAkAgMUUNACAGIDMgLv0bAiIvs0MAAAA0lEN3c/jCkiAvQf///wNxQYCAgPgDcr4iNEN1v7+/lJJDo+ncvyA0Q/lEtD6SlZJDAAAAP5S8Ii+zQwAAALSUkiAvQf///wNxQYCAgPgDcr4iNEN1v78/lJJDo+ncPyA0Q/lEtD6SlZI4AgggByAT/R8CuyI1ICr9HwK7IjaiICn9HwK7IjcgK/0fArsiOKKgIDUgNaIgNyA3oqAiOaMiOiA3IDaiIDUgOKKhIDmjIjWgRAAAAGCeoOY/oiA6IDqiIDUgNaKgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCCAsCQCAyRQ0AIAYgMyAu/RsDIi+zQwAAADSUQ3dz+MKSIC9B////A3FBgICA+ANyviI0Q3W/v7+UkkOj6dy/IDRD+US0PpKVkkMAAAA/lLwiL7NDAAAAtJSSIC9B////A3FBgICA+ANyviIzQ3W/vz+UkkOj6dw/IDND+US0PpKVkjgCDCAHIBP9HwO7IjUgKv0fA7siNqIgKf0fA7siNyAr/R8DuyI4oqAgNSA1oiA3IDeioCI5oyI6IDcgNqIgNSA4oqEgOaMiNaBEAAAAYJ6g5j+iIDogOqIgNSA1oqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIMCyAsIAv9USIL/RsAIAv9GwFyIAv9GwJyIAv9GwNyRQ0CCwJAIAhEAAAAAAAAAABlDQACQAJAIAINACAAIS9BACECDAELAkAgBSAMRw0AIAJBf2ohAkEAIQwgC/0bAEUNACAiICv9HwAgGpOLICr9HwAgHpOLkl0NACAGQYCA56N8NgIAIAcgFrI4AgBBACEMIAtBAP0cACELCwJAIAUgFEcNACACQX9qIQJBACEUIAv9GwFFDQAgIyAr/R8BIBuTiyAq/R8BIB+Ti5JdDQAgBkGAgOejfDYCBCAHIBeyOAIEQQAhFCALQQD9HAEhCwsCQCAFIBVHDQAgAkF/aiECQQAhFSAL/RsCRQ0AICQgK/0fAiAck4sgKv0fAiAgk4uSXQ0AIAZBgIDno3w2AgggByAYsjgCCEEAIRUgC0EA/RwCIQsLAkACQCAFIABGDQAgACEvDAELIAJBf2ohAkEAIS8gC/0bA0UNACAlICv9HwMgHZOLICr9HwMgIZOLkl0NACAGQYCA56N8NgIMIAcgGbI4AgxBACEvIAtBAP0cAyELCyAL/RsAIAv9GwFyIAv9GwJyIAv9GwNyRQ0DCwJAAkAgCyAtICogEP3lAf3gASArIA795QH94AH95AEiLiAS/UP9UiIs/RsAIjAgLP0bASIxciAs/RsCIjJyICz9GwMiO3JFDQAgBCAmayEAIAUgJmshAwJAIDBFDQAgDA0AIAJBAWohAiAu/R8AISIgKv0fACEeICv9HwAhGiAAIQwgAyEWCwJAIDFFDQAgFA0AIAJBAWohAiAu/R8BISMgKv0fASEfICv9HwEhGyAAIRQgAyEXCwJAIDJFDQAgFQ0AIAJBAWohAiAu/R8CISQgKv0fAiEgICv9HwIhHCAAIRUgAyEYCyA7RQ0AIC8NACACQQFqIQIgLv0fAyElICr9HwMhISAr/R8DIR0MAQsgLyEAIBkhAwsCQCAFICdGDQAgAyEZDAELIAMhGSAEIScgBSEmICohECArIQ4LIARBAmohBCAFIAFOIQMgDSAFQQFqIgVqQQFHDQALCyADQQFxRQ0HCwJAAkACQCAL/RsARQ0AIAZBgIDno3w2AgACQCAIRAAAAAAAAAAAZEUNACAHQQA2AgAgC/0bAUUNAyAGQYCA56N8NgIEDAILIAv9GwFFDQIgBkGAgOejfDYCBAwCCyAL/RsBRQ0BIAZBgIDno3w2AgQgCEQAAAAAAAAAAGUNAQsgB0EANgIECwJAIAv9GwJFDQAgBkGAgOejfDYCCAJAIAhEAAAAAAAAAABkRQ0AIAdBADYCCCAL/RsDRQ0IIAZBgIDno3w2AgwMBwsgC/0bA0UNByAGQYCA56N8NgIMDwsgC/0bA0UNBiAGQYCA56N8NgIMIAhEAAAAAAAAAABkDQUMBgsCQAJAIAFBAU4NAP0M/////////////////////yEQDAELQQAhDEEAIAFrIQ0gAisDALb9EyACKwMItv0gASACKwMQtv0gAiACKwMYtv0gAyI9ID395gEhLCADKwMAtv0TIAMrAwi2/SABIAMrAxC2/SACIAMrAxi2/SADIj4gPv3mASERIAi2/RMhP/0MAAAAAAAAAAAAAAAAAAAAACEp/Qz/////////////////////IRBBAiEEQQAhFEEAIRVBACEAQQAhFkEAIRdBACEYQQAhGUMAAAAAIRpDAAAAACEbQwAAAAAhHEMAAAAAIR1DAAAAACEeQwAAAAAhH0MAAAAAISBDAAAAACEhQwAAAAAhIkMAAAAAISNDAAAAACEkQwAAAAAhJUEAIQNBACEmQQEhBUEAIQJBASEn/QwAAIA/AACAPwAAgD8AAIA/IjwhDyA+ISsgPSETAkADQCAs/QwAAOBAAADgQAAA4EAAAOBAIgv95gEhLSAs/QwAAKhBAACoQQAAqEEAAKhBIij95gEhLiATIhMgDyIq/eYBICsiKyAp/eYB/eUBIg8gD/3kASA8/eQBIQ8gEyAp/eYBICsgKv3mAf3kASIqICr95AEhKQJAIBD9DAAAAAAAAAAAAAAAAAAAAAAiEiAs/QwAAAxCAAAMQgAADEIAAAxCIg795gEgESIqIAv95gH95QEgKiAq/eYBIhH95gEgLCAqICj95gH95QEgLCAs/eYBIgv95gH95AEgE/3mASAK/eQBIhMgE/3mASIsIAsgLSAqIA795gH95QH95gEgLiAq/eUBIBH95gH95AEgK/3mASAJ/eQBIisgK/3mASIR/eQBIgv9DAAkdEkAJHRJACR0SQAkdEn9RP1SIir9GwAiLyAq/RsBIjByICr9GwIiMXIgKv0bAyIyckUNACAFsiEzAkAgL0UNACAGIDMgC/0bACIvs0MAAAA0lEN3c/jCkiAvQf///wNxQYCAgPgDcr4iNEN1v7+/lJJDo+ncvyA0Q/lEtD6SlZJDAAAAP5S8Ii+zQwAAADSUQ3dz+MKSIC9B////A3FBgICA+ANyviI0Q3W/v7+UkkOj6dy/IDRD+US0PpKVkkPKYLa+lJI4AgAgByAp/R8AuyI1ICv9HwC7IjaiIA/9HwC7IjcgE/0fALsiOKKgIDUgNaIgNyA3oqAiOaMiOiA3IDaiIDUgOKKhIDmjIjWgRAAAAGCeoOY/oiA6IDqiIDUgNaKgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCAAsCQCAwRQ0AIAYgMyAL/RsBIi+zQwAAADSUQ3dz+MKSIC9B////A3FBgICA+ANyviI0Q3W/v7+UkkOj6dy/IDRD+US0PpKVkkMAAAA/lLwiL7NDAAAANJRDd3P4wpIgL0H///8DcUGAgID4A3K+IjRDdb+/v5SSQ6Pp3L8gNEP5RLQ+kpWSQ8pgtr6UkjgCBCAHICn9HwG7IjUgK/0fAbsiNqIgD/0fAbsiNyAT/R8BuyI4oqAgNSA1oiA3IDeioCI5oyI6IDcgNqIgNSA4oqEgOaMiNaBEAAAAYJ6g5j+iIDogOqIgNSA1oqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIECwJAIDFFDQAgBiAzIAv9GwIiL7NDAAAANJRDd3P4wpIgL0H///8DcUGAgID4A3K+IjRDdb+/v5SSQ6Pp3L8gNEP5RLQ+kpWSQwAAAD+UvCIvs0MAAAA0lEN3c/jCkiAvQf///wNxQYCAgPgDcr4iNEN1v7+/lJJDo+ncvyA0Q/lEtD6SlZJDymC2vpSSOAIIIAcgKf0fArsiNSAr/R8CuyI2oiAP/R8CuyI3IBP9HwK7IjiioCA1IDWiIDcgN6KgIjmjIjogNyA2oiA1IDiioSA5oyI1oEQAAABgnqDmP6IgOiA6oiA1IDWioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AggLAkAgMkUNACAGIDMgC/0bAyIvs0MAAAA0lEN3c/jCkiAvQf///wNxQYCAgPgDcr4iNEN1v7+/lJJDo+ncvyA0Q/lEtD6SlZJDAAAAP5S8Ii+zQwAAADSUQ3dz+MKSIC9B////A3FBgICA+ANyviI0Q3W/v7+UkkOj6dy/IDRD+US0PpKVkkPKYLa+lJI4AgwgByAp/R8DuyI1ICv9HwO7IjaiIA/9HwO7IjcgE/0fA7siOKKgIDUgNaIgNyA3oqAiOaMiOiA3IDaiIDUgOKKhIDmjIjWgRAAAAGCeoOY/oiA6IDqiIDUgNaKgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCDAsgKiAQ/VEiEP0bACAQ/RsBciAQ/RsCciAQ/RsDckUNAgsCQCAIRAAAAAAAAAAAZQ0AAkACQCACDQAgACEvQQAhAgwBCwJAIAUgDEcNACACQX9qIQJBACEMIBD9GwBFDQAgIiAT/R8AIBqTiyAr/R8AIB6Ti5JdDQAgBkGAgOejfDYCACAHIBayOAIAQQAhDCAQQQD9HAAhEAsCQCAFIBRHDQAgAkF/aiECQQAhFCAQ/RsBRQ0AICMgE/0fASAbk4sgK/0fASAfk4uSXQ0AIAZBgIDno3w2AgQgByAXsjgCBEEAIRQgEEEA/RwBIRALAkAgBSAVRw0AIAJBf2ohAkEAIRUgEP0bAkUNACAkIBP9HwIgHJOLICv9HwIgIJOLkl0NACAGQYCA56N8NgIIIAcgGLI4AghBACEVIBBBAP0cAiEQCwJAAkAgBSAARg0AIAAhLwwBCyACQX9qIQJBACEvIBD9GwNFDQAgJSAT/R8DIB2TiyAr/R8DICGTi5JdDQAgBkGAgOejfDYCDCAHIBmyOAIMQQAhLyAQQQD9HAMhEAsgEP0bACAQ/RsBciAQ/RsCciAQ/RsDckUNAwsCQAJAIBAgEiATID395QH94AEgKyA+/eUB/eAB/eQBIgsgP/1D/VIiKv0bACIwICr9GwEiMXIgKv0bAiIyciAq/RsDIjtyRQ0AIAQgJmshACAFICZrIQMCQCAwRQ0AIAwNACACQQFqIQIgC/0fACEiICv9HwAhHiAT/R8AIRogACEMIAMhFgsCQCAxRQ0AIBQNACACQQFqIQIgC/0fASEjICv9HwEhHyAT/R8BIRsgACEUIAMhFwsCQCAyRQ0AIBUNACACQQFqIQIgC/0fAiEkICv9HwIhICAT/R8CIRwgACEVIAMhGAsgO0UNACAvDQAgAkEBaiECIAv9HwMhJSAr/R8DISEgE/0fAyEdDAELIC8hACAZIQMLAkAgBSAnRg0AIAMhGQwBCyADIRkgBCEnIAUhJiArIT4gEyE9CyAEQQJqIQQgBSABTiEDIA0gBUEBaiIFakEBRw0ACwsgA0EBcUUNBgsCQAJAAkAgEP0bAEUNACAGQYCA56N8NgIAAkAgCEQAAAAAAAAAAGRFDQAgB0EANgIAIBD9GwFFDQMgBkGAgOejfDYCBAwCCyAQ/RsBRQ0CIAZBgIDno3w2AgQMAgsgEP0bAUUNASAGQYCA56N8NgIEIAhEAAAAAAAAAABlDQELIAdBADYCBAsCQCAQ/RsCRQ0AIAZBgIDno3w2AggCQCAIRAAAAAAAAAAAZEUNACAHQQA2AgggEP0bA0UNByAGQYCA56N8NgIMDAYLIBD9GwNFDQYgBkGAgOejfDYCDA8LIBD9GwNFDQUgBkGAgOejfDYCDCAIRAAAAAAAAAAAZA0EDAULAkACQCABQQFODQD9DP////////////////////8hDgwBC0EAIQxBACABayENIAIrAwC2/RMgAisDCLb9IAEgAisDELb9IAIgAisDGLb9IAMiEiAS/eYBIQ8gAysDALb9EyADKwMItv0gASADKwMQtv0gAiADKwMYtv0gAyI8IDz95gEhLCAItv0TIT39DAAAAAAAAAAAAAAAAAAAAAAhKf0M/////////////////////yEOQQIhBEEAIRRBACEVQQAhAEEAIRZBACEXQQAhGEEAIRlDAAAAACEaQwAAAAAhG0MAAAAAIRxDAAAAACEdQwAAAAAhHkMAAAAAIR9DAAAAACEgQwAAAAAhIUMAAAAAISJDAAAAACEjQwAAAAAhJEMAAAAAISVBACEDQQAhJkEBIQVBACECQQEhJ/0MAACAPwAAgD8AAIA/AACAPyIQIQsgPCErIBIhEwJAA0AgDyIqICr95gEiD/0MAABwQQAAcEEAAHBBAABwQSIt/eYBICwgLP3mASIR/eQBICz95gEhKCATIhMgCyIu/eYBICsiKyAp/eYB/eUBIgsgC/3kASAQ/eQBIQsgEyAp/eYBICsgLv3mAf3kASIpICn95AEhKQJAIA79DAAAAAAAAAAAAAAAAAAAAAAiLiATICv95gEgDyAR/eQB/QwAAMBAAADAQAAAwEAAAMBA/eYBICz9DAAAoMEAAKDBAACgwQAAoMH95gEgKv3mAf3kAf3mASAJ/eQBIisgK/3mASIsIAogKP3lASARIC395gEgD/3kASAq/eYB/eQBIhMgE/3mASIP/eQBIhH9DAAkdEkAJHRJACR0SQAkdEn9RP1SIir9GwAiLyAq/RsBIjByICr9GwIiMXIgKv0bAyIyckUNACAFsiEzAkAgL0UNACAGIDMgEf0bACIvs0MAAAA0lEN3c/jCkiAvQf///wNxQYCAgPgDcr4iNEN1v7+/lJJDo+ncvyA0Q/lEtD6SlZJDAAAAP5S8Ii+zQwAAADSUQ3dz+MKSIC9B////A3FBgICA+ANyviI0Q3W/v7+UkkOj6dy/IDRD+US0PpKVkkOSEca+lJI4AgAgByAp/R8AuyI1ICv9HwC7IjaiIAv9HwC7IjcgE/0fALsiOKKgIDUgNaIgNyA3oqAiOaMiOiA3IDaiIDUgOKKhIDmjIjWgRAAAAGCeoOY/oiA6IDqiIDUgNaKgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCAAsCQCAwRQ0AIAYgMyAR/RsBIi+zQwAAADSUQ3dz+MKSIC9B////A3FBgICA+ANyviI0Q3W/v7+UkkOj6dy/IDRD+US0PpKVkkMAAAA/lLwiL7NDAAAANJRDd3P4wpIgL0H///8DcUGAgID4A3K+IjRDdb+/v5SSQ6Pp3L8gNEP5RLQ+kpWSQ5IRxr6UkjgCBCAHICn9HwG7IjUgK/0fAbsiNqIgC/0fAbsiNyAT/R8BuyI4oqAgNSA1oiA3IDeioCI5oyI6IDcgNqIgNSA4oqEgOaMiNaBEAAAAYJ6g5j+iIDogOqIgNSA1oqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIECwJAIDFFDQAgBiAzIBH9GwIiL7NDAAAANJRDd3P4wpIgL0H///8DcUGAgID4A3K+IjRDdb+/v5SSQ6Pp3L8gNEP5RLQ+kpWSQwAAAD+UvCIvs0MAAAA0lEN3c/jCkiAvQf///wNxQYCAgPgDcr4iNEN1v7+/lJJDo+ncvyA0Q/lEtD6SlZJDkhHGvpSSOAIIIAcgKf0fArsiNSAr/R8CuyI2oiAL/R8CuyI3IBP9HwK7IjiioCA1IDWiIDcgN6KgIjmjIjogNyA2oiA1IDiioSA5oyI1oEQAAABgnqDmP6IgOiA6oiA1IDWioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AggLAkAgMkUNACAGIDMgEf0bAyIvs0MAAAA0lEN3c/jCkiAvQf///wNxQYCAgPgDcr4iNEN1v7+/lJJDo+ncvyA0Q/lEtD6SlZJDAAAAP5S8Ii+zQwAAADSUQ3dz+MKSIC9B////A3FBgICA+ANyviI0Q3W/v7+UkkOj6dy/IDRD+US0PpKVkkOSEca+lJI4AgwgByAp/R8DuyI1ICv9HwO7IjaiIAv9HwO7IjcgE/0fA7siOKKgIDUgNaIgNyA3oqAiOaMiOiA3IDaiIDUgOKKhIDmjIjWgRAAAAGCeoOY/oiA6IDqiIDUgNaKgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCDAsgKiAO/VEiDv0bACAO/RsBciAO/RsCciAO/RsDckUNAgsCQCAIRAAAAAAAAAAAZQ0AAkACQCACDQAgACEvQQAhAgwBCwJAIAUgDEcNACACQX9qIQJBACEMIA79GwBFDQAgIiAT/R8AIBqTiyAr/R8AIB6Ti5JdDQAgBkGAgOejfDYCACAHIBayOAIAQQAhDCAOQQD9HAAhDgsCQCAFIBRHDQAgAkF/aiECQQAhFCAO/RsBRQ0AICMgE/0fASAbk4sgK/0fASAfk4uSXQ0AIAZBgIDno3w2AgQgByAXsjgCBEEAIRQgDkEA/RwBIQ4LAkAgBSAVRw0AIAJBf2ohAkEAIRUgDv0bAkUNACAkIBP9HwIgHJOLICv9HwIgIJOLkl0NACAGQYCA56N8NgIIIAcgGLI4AghBACEVIA5BAP0cAiEOCwJAAkAgBSAARg0AIAAhLwwBCyACQX9qIQJBACEvIA79GwNFDQAgJSAT/R8DIB2TiyAr/R8DICGTi5JdDQAgBkGAgOejfDYCDCAHIBmyOAIMQQAhLyAOQQD9HAMhDgsgDv0bACAO/RsBciAO/RsCciAO/RsDckUNAwsCQAJAIA4gLiATIBL95QH94AEgKyA8/eUB/eAB/eQBIhEgPf1D/VIiKv0bACIwICr9GwEiMXIgKv0bAiIyciAq/RsDIjtyRQ0AIAQgJmshACAFICZrIQMCQCAwRQ0AIAwNACACQQFqIQIgEf0fACEiICv9HwAhHiAT/R8AIRogACEMIAMhFgsCQCAxRQ0AIBQNACACQQFqIQIgEf0fASEjICv9HwEhHyAT/R8BIRsgACEUIAMhFwsCQCAyRQ0AIBUNACACQQFqIQIgEf0fAiEkICv9HwIhICAT/R8CIRwgACEVIAMhGAsgO0UNACAvDQAgAkEBaiECIBH9HwMhJSAr/R8DISEgE/0fAyEdDAELIC8hACAZIQMLAkAgBSAnRg0AIAMhGQwBCyADIRkgBCEnIAUhJiArITwgEyESCyAEQQJqIQQgBSABTiEDIA0gBUEBaiIFakEBRw0ACwsgA0EBcUUNBQsCQAJAAkAgDv0bAEUNACAGQYCA56N8NgIAAkAgCEQAAAAAAAAAAGRFDQAgB0EANgIAIA79GwFFDQMgBkGAgOejfDYCBAwCCyAO/RsBRQ0CIAZBgIDno3w2AgQMAgsgDv0bAUUNASAGQYCA56N8NgIEIAhEAAAAAAAAAABlDQELIAdBADYCBAsCQCAO/RsCRQ0AIAZBgIDno3w2AggCQCAIRAAAAAAAAAAAZEUNACAHQQA2AgggDv0bA0UNBiAGQYCA56N8NgIMDAULIA79GwNFDQUgBkGAgOejfDYCDA8LIA79GwNFDQQgBkGAgOejfDYCDCAIRAAAAAAAAAAAZA0DDAQLAkACQCABQQFODQD9DP////////////////////8hLgwBC0EAIQxBACABayENIAIrAwC2/RMgAisDCLb9IAEgAisDELb9IAIgAisDGLb9IAMiECAQ/eYBIQ8gAysDALb9EyADKwMItv0gASADKwMQtv0gAiADKwMYtv0gAyISIBL95gEhKiAItv0TITz9DAAAAAAAAAAAAAAAAAAAAAAhEf0M/////////////////////yEuQQIhBEEAIRRBACEVQQAhAEEAIRZBACEXQQAhGEEAIRlDAAAAACEaQwAAAAAhG0MAAAAAIRxDAAAAACEdQwAAAAAhHkMAAAAAIR9DAAAAACEgQwAAAAAhIUMAAAAAISJDAAAAACEjQwAAAAAhJEMAAAAAISVBACEDQQAhJkEBIQVBACECQQEhJ/0MAACAPwAAgD8AAIA/AACAPyIOISkgEiErIBAhEwJAA0AgKiIqIA8iLP0MAADAwAAAwMAAAMDAAADAwP3mAf3kASAq/eYBICwgLP3mAf3kAf0MAACgQAAAoEAAAKBAAACgQCIP/eYBIgsgESIt/eYBICsiK/0MAACgQQAAoEEAAKBBAACgQf3mASAsICr95QH95gEgEyIT/eYBIiggKf3mAf3kASERIA4gKCAt/eYB/eUBIAsgKf3mAf3kASEpAkAgLv0MAAAAAAAAAAAAAAAAAAAAACIoICwgD/3mASAq/QwAACBBAAAgQQAAIEEAACBB/eYBIgv95QEgLP3mASAqICr95gEiLf3kASAr/eYBIAn95AEiKyAr/eYBIiogLCAL/eUBICz95gEgLSAP/eYB/eQBIBP95gEgCv3kASITIBP95gEiD/3kASIL/QwAJHRJACR0SQAkdEkAJHRJ/UT9UiIs/RsAIi8gLP0bASIwciAs/RsCIjFyICz9GwMiMnJFDQAgBbIhMwJAIC9FDQAgBiAzIAv9GwAiL7NDAAAANJRDd3P4wpIgL0H///8DcUGAgID4A3K+IjRDdb+/v5SSQ6Pp3L8gNEP5RLQ+kpWSQwAAAD+UvCIvs0MAAAA0lEN3c/jCkiAvQf///wNxQYCAgPgDcr4iNEN1v7+/lJJDo+ncvyA0Q/lEtD6SlZJDo4HcvpSSOAIAIAcgEf0fALsiNSAr/R8AuyI2oiAp/R8AuyI3IBP9HwC7IjiioCA1IDWiIDcgN6KgIjmjIjogNyA2oiA1IDiioSA5oyI1oEQAAABgnqDmP6IgOiA6oiA1IDWioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgALAkAgMEUNACAGIDMgC/0bASIvs0MAAAA0lEN3c/jCkiAvQf///wNxQYCAgPgDcr4iNEN1v7+/lJJDo+ncvyA0Q/lEtD6SlZJDAAAAP5S8Ii+zQwAAADSUQ3dz+MKSIC9B////A3FBgICA+ANyviI0Q3W/v7+UkkOj6dy/IDRD+US0PpKVkkOjgdy+lJI4AgQgByAR/R8BuyI1ICv9HwG7IjaiICn9HwG7IjcgE/0fAbsiOKKgIDUgNaIgNyA3oqAiOaMiOiA3IDaiIDUgOKKhIDmjIjWgRAAAAGCeoOY/oiA6IDqiIDUgNaKgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCBAsCQCAxRQ0AIAYgMyAL/RsCIi+zQwAAADSUQ3dz+MKSIC9B////A3FBgICA+ANyviI0Q3W/v7+UkkOj6dy/IDRD+US0PpKVkkMAAAA/lLwiL7NDAAAANJRDd3P4wpIgL0H///8DcUGAgID4A3K+IjRDdb+/v5SSQ6Pp3L8gNEP5RLQ+kpWSQ6OB3L6UkjgCCCAHIBH9HwK7IjUgK/0fArsiNqIgKf0fArsiNyAT/R8CuyI4oqAgNSA1oiA3IDeioCI5oyI6IDcgNqIgNSA4oqEgOaMiNaBEAAAAYJ6g5j+iIDogOqIgNSA1oqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIICwJAIDJFDQAgBiAzIAv9GwMiL7NDAAAANJRDd3P4wpIgL0H///8DcUGAgID4A3K+IjRDdb+/v5SSQ6Pp3L8gNEP5RLQ+kpWSQwAAAD+UvCIvs0MAAAA0lEN3c/jCkiAvQf///wNxQYCAgPgDcr4iNEN1v7+/lJJDo+ncvyA0Q/lEtD6SlZJDo4HcvpSSOAIMIAcgEf0fA7siNSAr/R8DuyI2oiAp/R8DuyI3IBP9HwO7IjiioCA1IDWiIDcgN6KgIjmjIjogNyA2oiA1IDiioSA5oyI1oEQAAABgnqDmP6IgOiA6oiA1IDWioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgwLICwgLv1RIi79GwAgLv0bAXIgLv0bAnIgLv0bA3JFDQILAkAgCEQAAAAAAAAAAGUNAAJAAkAgAg0AIAAhL0EAIQIMAQsCQCAFIAxHDQAgAkF/aiECQQAhDCAu/RsARQ0AICIgE/0fACAak4sgK/0fACAek4uSXQ0AIAZBgIDno3w2AgAgByAWsjgCAEEAIQwgLkEA/RwAIS4LAkAgBSAURw0AIAJBf2ohAkEAIRQgLv0bAUUNACAjIBP9HwEgG5OLICv9HwEgH5OLkl0NACAGQYCA56N8NgIEIAcgF7I4AgRBACEUIC5BAP0cASEuCwJAIAUgFUcNACACQX9qIQJBACEVIC79GwJFDQAgJCAT/R8CIByTiyAr/R8CICCTi5JdDQAgBkGAgOejfDYCCCAHIBiyOAIIQQAhFSAuQQD9HAIhLgsCQAJAIAUgAEYNACAAIS8MAQsgAkF/aiECQQAhLyAu/RsDRQ0AICUgE/0fAyAdk4sgK/0fAyAhk4uSXQ0AIAZBgIDno3w2AgwgByAZsjgCDEEAIS8gLkEA/RwDIS4LIC79GwAgLv0bAXIgLv0bAnIgLv0bA3JFDQMLAkACQCAuICggKyAS/eUB/eABIBMgEP3lAf3gAf3kASILIDz9Q/1SIiz9GwAiMCAs/RsBIjFyICz9GwIiMnIgLP0bAyI7ckUNACAEICZrIQAgBSAmayEDAkAgMEUNACAMDQAgAkEBaiECIAv9HwAhIiAr/R8AIR4gE/0fACEaIAAhDCADIRYLAkAgMUUNACAUDQAgAkEBaiECIAv9HwEhIyAr/R8BIR8gE/0fASEbIAAhFCADIRcLAkAgMkUNACAVDQAgAkEBaiECIAv9HwIhJCAr/R8CISAgE/0fAiEcIAAhFSADIRgLIDtFDQAgLw0AIAJBAWohAiAL/R8DISUgK/0fAyEhIBP9HwMhHQwBCyAvIQAgGSEDCwJAIAUgJ0YNACADIRkMAQsgAyEZIAQhJyAFISYgKyESIBMhEAsgBEECaiEEIAUgAU4hAyANIAVBAWoiBWpBAUcNAAsLIANBAXFFDQQLAkACQAJAIC79GwBFDQAgBkGAgOejfDYCAAJAIAhEAAAAAAAAAABkRQ0AIAdBADYCACAu/RsBRQ0DIAZBgIDno3w2AgQMAgsgLv0bAUUNAiAGQYCA56N8NgIEDAILIC79GwFFDQEgBkGAgOejfDYCBCAIRAAAAAAAAAAAZQ0BCyAHQQA2AgQLAkAgLv0bAkUNACAGQYCA56N8NgIIAkAgCEQAAAAAAAAAAGRFDQAgB0EANgIIIC79GwNFDQUgBkGAgOejfDYCDAwECyAu/RsDRQ0EIAZBgIDno3w2AgwPCyAu/RsDRQ0DIAZBgIDno3w2AgwgCEQAAAAAAAAAAGQNAgwDCwJAAkAgAUEBTg0A/Qz/////////////////////IS4MAQtBACEMQQAgAWshDSACKwMAtv0TIAIrAwi2/SABIAIrAxC2/SACIAIrAxi2/SADIhAgEP3mASERIAMrAwC2/RMgAysDCLb9IAEgAysDELb9IAIgAysDGLb9IAMiEiAS/eYBISwgCLb9EyE8/QwAAAAAAAAAAAAAAAAAAAAAISn9DP////////////////////8hLkECIQRBACEUQQAhFUEAIQBBACEWQQAhF0EAIRhBACEZQwAAAAAhGkMAAAAAIRtDAAAAACEcQwAAAAAhHUMAAAAAIR5DAAAAACEfQwAAAAAhIEMAAAAAISFDAAAAACEiQwAAAAAhI0MAAAAAISRDAAAAACElQQAhA0EAISZBASEFQQAhAkEBISf9DAAAgD8AAIA/AACAPwAAgD8iDiEPIBIhKyAQIRMCQANAICwgLP3mASELICz9DAAAwMAAAMDAAADAwAAAwMD95gEhLSATIiogKf3mASArIisgD/3mAf3kASIoIBEiEyAs/eUB/QwAAIBAAACAQAAAgEAAAIBA/eYBIiz95gEgKiAr/eYBIhH9DAAAAEEAAABBAAAAQQAAAEH95gEgKiAP/eYBICsgKf3mAf3lASIq/eYB/eQBISkgKiAs/eYBIA795AEgEf0MAAAAwQAAAMEAAADBAAAAwf3mASAo/eYB/eQBIQ8CQCAu/QwAAAAAAAAAAAAAAAAAAAAAIiggLCAR/eYBIAn95AEiKyAr/eYBIiwgCyAK/eQBIBMgLf3kASAT/eYB/eQBIhMgE/3mASIR/eQBIgv9DAAkdEkAJHRJACR0SQAkdEn9RP1SIir9GwAiLyAq/RsBIjByICr9GwIiMXIgKv0bAyIyckUNACAFsiEzAkAgL0UNACAGIDMgC/0bACIvs0MAAAA0lEN3c/jCkiAvQf///wNxQYCAgPgDcr4iNEN1v7+/lJJDo+ncvyA0Q/lEtD6SlZJDAAAAP5S8Ii+zQwAAADSUQ3dz+MKSIC9B////A3FBgICA+ANyviI0Q3W/v7+UkkOj6dy/IDRD+US0PpKVkkMAAAA/lJM4AgAgByAp/R8AuyI1ICv9HwC7IjaiIA/9HwC7IjcgE/0fALsiOKKgIDUgNaIgNyA3oqAiOaMiOiA3IDaiIDUgOKKhIDmjIjWgRAAAAGCeoOY/oiA6IDqiIDUgNaKgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCAAsCQCAwRQ0AIAYgMyAL/RsBIi+zQwAAADSUQ3dz+MKSIC9B////A3FBgICA+ANyviI0Q3W/v7+UkkOj6dy/IDRD+US0PpKVkkMAAAA/lLwiL7NDAAAANJRDd3P4wpIgL0H///8DcUGAgID4A3K+IjRDdb+/v5SSQ6Pp3L8gNEP5RLQ+kpWSQwAAAD+UkzgCBCAHICn9HwG7IjUgK/0fAbsiNqIgD/0fAbsiNyAT/R8BuyI4oqAgNSA1oiA3IDeioCI5oyI6IDcgNqIgNSA4oqEgOaMiNaBEAAAAYJ6g5j+iIDogOqIgNSA1oqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIECwJAIDFFDQAgBiAzIAv9GwIiL7NDAAAANJRDd3P4wpIgL0H///8DcUGAgID4A3K+IjRDdb+/v5SSQ6Pp3L8gNEP5RLQ+kpWSQwAAAD+UvCIvs0MAAAA0lEN3c/jCkiAvQf///wNxQYCAgPgDcr4iNEN1v7+/lJJDo+ncvyA0Q/lEtD6SlZJDAAAAP5STOAIIIAcgKf0fArsiNSAr/R8CuyI2oiAP/R8CuyI3IBP9HwK7IjiioCA1IDWiIDcgN6KgIjmjIjogNyA2oiA1IDiioSA5oyI1oEQAAABgnqDmP6IgOiA6oiA1IDWioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AggLAkAgMkUNACAGIDMgC/0bAyIvs0MAAAA0lEN3c/jCkiAvQf///wNxQYCAgPgDcr4iNEN1v7+/lJJDo+ncvyA0Q/lEtD6SlZJDAAAAP5S8Ii+zQwAAADSUQ3dz+MKSIC9B////A3FBgICA+ANyviI0Q3W/v7+UkkOj6dy/IDRD+US0PpKVkkMAAAA/lJM4AgwgByAp/R8DuyI1ICv9HwO7IjaiIA/9HwO7IjcgE/0fA7siOKKgIDUgNaIgNyA3oqAiOaMiOiA3IDaiIDUgOKKhIDmjIjWgRAAAAGCeoOY/oiA6IDqiIDUgNaKgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCDAsgKiAu/VEiLv0bACAu/RsBciAu/RsCciAu/RsDckUNAgsCQCAIRAAAAAAAAAAAZQ0AAkACQCACDQAgACEvQQAhAgwBCwJAIAUgDEcNACACQX9qIQJBACEMIC79GwBFDQAgIiAT/R8AIBqTiyAr/R8AIB6Ti5JdDQAgBkGAgOejfDYCACAHIBayOAIAQQAhDCAuQQD9HAAhLgsCQCAFIBRHDQAgAkF/aiECQQAhFCAu/RsBRQ0AICMgE/0fASAbk4sgK/0fASAfk4uSXQ0AIAZBgIDno3w2AgQgByAXsjgCBEEAIRQgLkEA/RwBIS4LAkAgBSAVRw0AIAJBf2ohAkEAIRUgLv0bAkUNACAkIBP9HwIgHJOLICv9HwIgIJOLkl0NACAGQYCA56N8NgIIIAcgGLI4AghBACEVIC5BAP0cAiEuCwJAAkAgBSAARg0AIAAhLwwBCyACQX9qIQJBACEvIC79GwNFDQAgJSAT/R8DIB2TiyAr/R8DICGTi5JdDQAgBkGAgOejfDYCDCAHIBmyOAIMQQAhLyAuQQD9HAMhLgsgLv0bACAu/RsBciAu/RsCciAu/RsDckUNAwsCQAJAIC4gKCArIBL95QH94AEgEyAQ/eUB/eAB/eQBIgsgPP1D/VIiKv0bACIwICr9GwEiMXIgKv0bAiIyciAq/RsDIjtyRQ0AIAQgJmshACAFICZrIQMCQCAwRQ0AIAwNACACQQFqIQIgC/0fACEiICv9HwAhHiAT/R8AIRogACEMIAMhFgsCQCAxRQ0AIBQNACACQQFqIQIgC/0fASEjICv9HwEhHyAT/R8BIRsgACEUIAMhFwsCQCAyRQ0AIBUNACACQQFqIQIgC/0fAiEkICv9HwIhICAT/R8CIRwgACEVIAMhGAsgO0UNACAvDQAgAkEBaiECIAv9HwMhJSAr/R8DISEgE/0fAyEdDAELIC8hACAZIQMLAkAgBSAnRg0AIAMhGQwBCyADIRkgBCEnIAUhJiArIRIgEyEQCyAEQQJqIQQgBSABTiEDIA0gBUEBaiIFakEBRw0ACwsgA0EBcUUNAwsCQAJAAkAgLv0bAEUNACAGQYCA56N8NgIAAkAgCEQAAAAAAAAAAGRFDQAgB0EANgIAIC79GwFFDQMgBkGAgOejfDYCBAwCCyAu/RsBRQ0CIAZBgIDno3w2AgQMAgsgLv0bAUUNASAGQYCA56N8NgIEIAhEAAAAAAAAAABlDQELIAdBADYCBAsCQCAu/RsCRQ0AIAZBgIDno3w2AggCQCAIRAAAAAAAAAAAZEUNACAHQQA2AgggLv0bA0UNBCAGQYCA56N8NgIMDAMLIC79GwNFDQMgBkGAgOejfDYCDA8LIC79GwNFDQIgBkGAgOejfDYCDCAIRAAAAAAAAAAAZA0BDAILAkACQCABQQFODQD9DP////////////////////8hLgwBC0EAIQxBACABayENIAIrAwC2/RMgAisDCLb9IAEgAisDELb9IAIgAisDGLb9IAMiECAQ/eYBIQsgAysDALb9EyADKwMItv0gASADKwMQtv0gAiADKwMYtv0gAyISIBL95gEhDyAItv0TITz9DAAAAAAAAAAAAAAAAAAAAAAhEf0M/////////////////////yEuQQIhBEEAIRRBACEVQQAhAEEAIRZBACEXQQAhGEEAIRlDAAAAACEaQwAAAAAhG0MAAAAAIRxDAAAAACEdQwAAAAAhHkMAAAAAIR9DAAAAACEgQwAAAAAhIUMAAAAAISJDAAAAACEjQwAAAAAhJEMAAAAAISVBACEDQQAhJkEBIQVBACECQQEhJ/0MAACAPwAAgD8AAIA/AACAPyIOIRMgEiEqIBAhKwJAA0AgKiItICsiKiAq/eQB/eYBIisgE/3mASALIikgDyIP/eUBIgsgESIo/eYB/eQB/QwAAEBAAABAQAAAQEAAAEBAIiz95gEhESALIBP95gEgKyAo/eYB/eUBICz95gEgDv3kASETAkAgLv0MAAAAAAAAAAAAAAAAAAAAACIoICogKSAPICz95gH95QH95gEgCv3kASIrICv95gEiCyApICz95gEgD/3lASAt/eYBIAn95AEiKiAq/eYBIg/95AEiKf0MACR0SQAkdEkAJHRJACR0Sf1E/VIiLP0bACIvICz9GwEiMHIgLP0bAiIxciAs/RsDIjJyRQ0AIAWyITMCQCAvRQ0AIAYgMyAp/RsAIi+zQwAAADSUQ3dz+MKSIC9B////A3FBgICA+ANyviI0Q3W/v7+UkkOj6dy/IDRD+US0PpKVkkMAAAA/lLwiL7NDAAAANJRDd3P4wpIgL0H///8DcUGAgID4A3K+IjRDdb+/v5SSQ6Pp3L8gNEP5RLQ+kpWSQ52EIb+UkjgCACAHIBH9HwC7IjUgKv0fALsiNqIgE/0fALsiNyAr/R8AuyI4oqAgNSA1oiA3IDeioCI5oyI6IDcgNqIgNSA4oqEgOaMiNaBEAAAAYJ6g5j+iIDogOqIgNSA1oqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIACwJAIDBFDQAgBiAzICn9GwEiL7NDAAAANJRDd3P4wpIgL0H///8DcUGAgID4A3K+IjRDdb+/v5SSQ6Pp3L8gNEP5RLQ+kpWSQwAAAD+UvCIvs0MAAAA0lEN3c/jCkiAvQf///wNxQYCAgPgDcr4iNEN1v7+/lJJDo+ncvyA0Q/lEtD6SlZJDnYQhv5SSOAIEIAcgEf0fAbsiNSAq/R8BuyI2oiAT/R8BuyI3ICv9HwG7IjiioCA1IDWiIDcgN6KgIjmjIjogNyA2oiA1IDiioSA5oyI1oEQAAABgnqDmP6IgOiA6oiA1IDWioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgQLAkAgMUUNACAGIDMgKf0bAiIvs0MAAAA0lEN3c/jCkiAvQf///wNxQYCAgPgDcr4iNEN1v7+/lJJDo+ncvyA0Q/lEtD6SlZJDAAAAP5S8Ii+zQwAAADSUQ3dz+MKSIC9B////A3FBgICA+ANyviI0Q3W/v7+UkkOj6dy/IDRD+US0PpKVkkOdhCG/lJI4AgggByAR/R8CuyI1ICr9HwK7IjaiIBP9HwK7IjcgK/0fArsiOKKgIDUgNaIgNyA3oqAiOaMiOiA3IDaiIDUgOKKhIDmjIjWgRAAAAGCeoOY/oiA6IDqiIDUgNaKgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCCAsCQCAyRQ0AIAYgMyAp/RsDIi+zQwAAADSUQ3dz+MKSIC9B////A3FBgICA+ANyviI0Q3W/v7+UkkOj6dy/IDRD+US0PpKVkkMAAAA/lLwiL7NDAAAANJRDd3P4wpIgL0H///8DcUGAgID4A3K+IjRDdb+/v5SSQ6Pp3L8gNEP5RLQ+kpWSQ52EIb+UkjgCDCAHIBH9HwO7IjUgKv0fA7siNqIgE/0fA7siNyAr/R8DuyI4oqAgNSA1oiA3IDeioCI5oyI6IDcgNqIgNSA4oqEgOaMiNaBEAAAAYJ6g5j+iIDogOqIgNSA1oqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIMCyAsIC79USIu/RsAIC79GwFyIC79GwJyIC79GwNyRQ0CCwJAIAhEAAAAAAAAAABlDQACQAJAIAINACAAIS9BACECDAELAkAgBSAMRw0AIAJBf2ohAkEAIQwgLv0bAEUNACAiICv9HwAgGpOLICr9HwAgHpOLkl0NACAGQYCA56N8NgIAIAcgFrI4AgBBACEMIC5BAP0cACEuCwJAIAUgFEcNACACQX9qIQJBACEUIC79GwFFDQAgIyAr/R8BIBuTiyAq/R8BIB+Ti5JdDQAgBkGAgOejfDYCBCAHIBeyOAIEQQAhFCAuQQD9HAEhLgsCQCAFIBVHDQAgAkF/aiECQQAhFSAu/RsCRQ0AICQgK/0fAiAck4sgKv0fAiAgk4uSXQ0AIAZBgIDno3w2AgggByAYsjgCCEEAIRUgLkEA/RwCIS4LAkACQCAFIABGDQAgACEvDAELIAJBf2ohAkEAIS8gLv0bA0UNACAlICv9HwMgHZOLICr9HwMgIZOLkl0NACAGQYCA56N8NgIMIAcgGbI4AgxBACEvIC5BAP0cAyEuCyAu/RsAIC79GwFyIC79GwJyIC79GwNyRQ0DCwJAAkAgLiAoICsgEP3lAf3gASAqIBL95QH94AH95AEiKSA8/UP9UiIs/RsAIjAgLP0bASIxciAs/RsCIjJyICz9GwMiO3JFDQAgBCAmayEAIAUgJmshAwJAIDBFDQAgDA0AIAJBAWohAiAp/R8AISIgKv0fACEeICv9HwAhGiAAIQwgAyEWCwJAIDFFDQAgFA0AIAJBAWohAiAp/R8BISMgKv0fASEfICv9HwEhGyAAIRQgAyEXCwJAIDJFDQAgFQ0AIAJBAWohAiAp/R8CISQgKv0fAiEgICv9HwIhHCAAIRUgAyEYCyA7RQ0AIC8NACACQQFqIQIgKf0fAyElICr9HwMhISAr/R8DIR0MAQsgLyEAIBkhAwsCQCAFICdGDQAgAyEZDAELIAMhGSAEIScgBSEmICohEiArIRALIARBAmohBCAFIAFOIQMgDSAFQQFqIgVqQQFHDQALCyADQQFxRQ0CCwJAAkACQCAu/RsARQ0AIAZBgIDno3w2AgACQCAIRAAAAAAAAAAAZEUNACAHQQA2AgAgLv0bAUUNAyAGQYCA56N8NgIEDAILIC79GwFFDQIgBkGAgOejfDYCBAwCCyAu/RsBRQ0BIAZBgIDno3w2AgQgCEQAAAAAAAAAAGUNAQsgB0EANgIECwJAIC79GwJFDQAgBkGAgOejfDYCCAJAIAhEAAAAAAAAAABkRQ0AIAdBADYCCCAu/RsDRQ0DIAZBgIDno3w2AgwMAgsgLv0bA0UNAiAGQYCA56N8NgIMDwsgLv0bA0UNASAGQYCA56N8NgIMIAhEAAAAAAAAAABkRQ0BCyAHQQA2AgwLC5OLAgwDewJ/BXsBfQZ/C30CfwV7BH8CfQF/BHsgBSsDALb9EyAFKwMItv0gASAFKwMQtv0gAiAFKwMYtv0gAyEJIAQrAwC2/RMgBCsDCLb9IAEgBCsDELb9IAIgBCsDGLb9IAMhCgJAAkACQAJAAkACQAJAAkACQAJAAkACQAJAAkACQAJAAkACQCAAQX9qDg8ADw4NDAsKCQgHBgUEAwIBCwJAAkAgAUEBTg0A/Qz/////////////////////IQsMAQtBACEMQQAgAWshDSACKwMAtv0TIAIrAwi2/SABIAIrAxC2/SACIAIrAxi2/SADIg4gDv3mASEPIAMrAwC2/RMgAysDCLb9IAEgAysDELb9IAIgAysDGLb9IAMiECAQ/eYBIREgCLb9EyES/Qz/////////////////////IQtDAAAAACETQQIhBEEAIRRBACEVQQAhAEEAIRZBACEXQQAhGEEAIRlDAAAAACEaQwAAAAAhG0MAAAAAIRxDAAAAACEdQwAAAAAhHkMAAAAAIR9DAAAAACEgQwAAAAAhIUMAAAAAISJDAAAAACEjQwAAAAAhJEEAIQNBACElQQEhBUEAIQJBASEmIBAhJyAOISgCQANAIA8gEf3lASEpAkAgC/0MAAAAAAAAAAAAAAAAAAAAACIqICcgKCIoICj95AH95gEgCf3kASInICf95gEiESApIAr95AEiKCAo/eYBIg/95AEiK/0MACR0SQAkdEkAJHRJACR0Sf1E/VIiKf0bACIsICn9GwEiLXIgKf0bAiIuciAp/RsDIi9yRQ0AIAWyQ3dz+EKSITACQCAsRQ0AIAYgMCAr/RsAIiyzQwAAADSUQ3dz+MKSICxB////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkMAAAA/lLwiLLNDAAAAtJSSICxB////A3FBgICA+ANyviIxQ3W/vz+UkkOj6dw/IDFD+US0PpKVkjgCAAsCQCAtRQ0AIAYgMCAr/RsBIiyzQwAAADSUQ3dz+MKSICxB////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkMAAAA/lLwiLLNDAAAAtJSSICxB////A3FBgICA+ANyviIxQ3W/vz+UkkOj6dw/IDFD+US0PpKVkjgCBAsCQCAuRQ0AIAYgMCAr/RsCIiyzQwAAADSUQ3dz+MKSICxB////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkMAAAA/lLwiLLNDAAAAtJSSICxB////A3FBgICA+ANyviIxQ3W/vz+UkkOj6dw/IDFD+US0PpKVkjgCCAsCQCAvRQ0AIAYgMCAr/RsDIiyzQwAAADSUQ3dz+MKSICxB////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkMAAAA/lLwiLLNDAAAAtJSSICxB////A3FBgICA+ANyviIwQ3W/vz+UkkOj6dw/IDBD+US0PpKVkjgCDAsgKSAL/VEiC/0bACAL/RsBciAL/RsCciAL/RsDckUNAgsCQCAIRAAAAAAAAAAAZQ0AAkACQCACDQAgACEsQQAhAgwBCwJAIAUgDEcNACACQX9qIQJBACEMIAv9GwBFDQAgISAo/R8AIBOTiyAn/R8AIB2Ti5JdDQAgBkGAgOejfDYCACAHIBayOAIAQQAhDCALQQD9HAAhCwsCQCAFIBRHDQAgAkF/aiECQQAhFCAL/RsBRQ0AICIgKP0fASAak4sgJ/0fASAek4uSXQ0AIAZBgIDno3w2AgQgByAXsjgCBEEAIRQgC0EA/RwBIQsLAkAgBSAVRw0AIAJBf2ohAkEAIRUgC/0bAkUNACAjICj9HwIgG5OLICf9HwIgH5OLkl0NACAGQYCA56N8NgIIIAcgGLI4AghBACEVIAtBAP0cAiELCwJAAkAgBSAARg0AIAAhLAwBCyACQX9qIQJBACEsIAv9GwNFDQAgJCAo/R8DIByTiyAn/R8DICCTi5JdDQAgBkGAgOejfDYCDCAHIBmyOAIMQQAhLCALQQD9HAMhCwsgC/0bACAL/RsBciAL/RsCciAL/RsDckUNAwsCQAJAIAsgKiAnIBD95QH94AEgKCAO/eUB/eAB/eQBIisgEv1D/VIiKf0bACItICn9GwEiLnIgKf0bAiIvciAp/RsDIjJyRQ0AIAQgJWshACAFICVrIQMCQCAtRQ0AIAwNACACQQFqIQIgK/0fACEhICf9HwAhHSAo/R8AIRMgACEMIAMhFgsCQCAuRQ0AIBQNACACQQFqIQIgK/0fASEiICf9HwEhHiAo/R8BIRogACEUIAMhFwsCQCAvRQ0AIBUNACACQQFqIQIgK/0fAiEjICf9HwIhHyAo/R8CIRsgACEVIAMhGAsgMkUNACAsDQAgAkEBaiECICv9HwMhJCAn/R8DISAgKP0fAyEcDAELICwhACAZIQMLAkAgBSAmRg0AIAMhGQwBCyADIRkgBCEmIAUhJSAnIRAgKCEOCyAEQQJqIQQgBSABTiEDIA0gBUEBaiIFakEBRw0ACwsgA0EBcUUNEQsCQAJAAkAgC/0bAEUNACAGQYCA56N8NgIAAkAgCEQAAAAAAAAAAGRFDQAgB0EANgIAIAv9GwFFDQMgBkGAgOejfDYCBAwCCyAL/RsBRQ0CIAZBgIDno3w2AgQMAgsgC/0bAUUNASAGQYCA56N8NgIEIAhEAAAAAAAAAABlDQELIAdBADYCBAsCQCAL/RsCRQ0AIAZBgIDno3w2AggCQCAIRAAAAAAAAAAAZEUNACAHQQA2AgggC/0bA0UNEiAGQYCA56N8NgIMDBELIAv9GwNFDREgBkGAgOejfDYCDA8LIAv9GwNFDRAgBkGAgOejfDYCDCAIRAAAAAAAAAAAZA0PDBALAkACQCABQQFODQD9DP////////////////////8hCwwBCyACKwMAtv0TIAIrAwi2/SABIAIrAxC2/SACIAIrAxi2/SADIg4gDv3mASEpIAMrAwC2/RMgAysDCLb9IAEgAysDELb9IAIgAysDGLb9IAMiECAQ/eYBIScgCLb9EyES/Qz/////////////////////IQtBACEFQwAAAAAhE0ECIQNBACEMQQAhFEEAIRVBACEZQQAhFkEAIRdBACEYQQAhLEMAAAAAIRpDAAAAACEbQwAAAAAhHEMAAAAAIR1DAAAAACEeQwAAAAAhH0MAAAAAISBDAAAAACEhQwAAAAAhIkMAAAAAISNDAAAAACEkQQAhAEEAISVBASEEQQAhDUEBITIgECEPIA4hEQNAAkACQCAEQQpuQQpsQX9qIAUiAkcNACApICf95QEgD/0MAACAQAAAgEAAAIBAAACAQP3mASAR/eYB/eAB/eYBISggJyAp/QwAAMDAAADAwAAAwMAAAMDA/eYB/eQBICf95gEhESApICn95gEhKQwBCyAP/QwAAIBAAACAQAAAgEAAAIBA/eYBICkgJ/3lAf3mASAR/eYBISggKSAn/QwAAMDAAADAwAAAwMAAAMDA/eYB/eQBICn95gEhESAnICf95gEhKQsgAkEBaiEFAkACQCAL/QwAAAAAAAAAAAAAAAAAAAAAIiogKCAJ/eQBIg8gD/3mASInICkgCv3kASAR/eQBIhEgEf3mASIp/eQBIiv9DAAkdEkAJHRJACR0SQAkdEn9RP1SIij9GwAiLSAo/RsBIi5yICj9GwIiL3IgKP0bAyImckUNACAFsiEwAkAgLUUNACAGIDAgK/0bACIts0MAAAA0lEN3c/jCkiAtQf///wNxQYCAgPgDcr4iMUN1v7+/lJJDo+ncvyAxQ/lEtD6SlZJDAAAAP5S8Ii2zQwAAADSUQ3dz+MKSIC1B////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkMAAAA/lJM4AgALAkAgLkUNACAGIDAgK/0bASIts0MAAAA0lEN3c/jCkiAtQf///wNxQYCAgPgDcr4iMUN1v7+/lJJDo+ncvyAxQ/lEtD6SlZJDAAAAP5S8Ii2zQwAAADSUQ3dz+MKSIC1B////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkMAAAA/lJM4AgQLAkAgL0UNACAGIDAgK/0bAiIts0MAAAA0lEN3c/jCkiAtQf///wNxQYCAgPgDcr4iMUN1v7+/lJJDo+ncvyAxQ/lEtD6SlZJDAAAAP5S8Ii2zQwAAADSUQ3dz+MKSIC1B////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkMAAAA/lJM4AggLAkAgJkUNACAGIDAgK/0bAyIts0MAAAA0lEN3c/jCkiAtQf///wNxQYCAgPgDcr4iMUN1v7+/lJJDo+ncvyAxQ/lEtD6SlZJDAAAAP5S8Ii2zQwAAADSUQ3dz+MKSIC1B////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkMAAAA/lJM4AgwLICggC/1RIgv9GwAgC/0bAXIgC/0bAnIgC/0bA3JFDQELAkAgCEQAAAAAAAAAAGUNAAJAAkAgDQ0AIBkhLUEAIQ0MAQsCQCAFIAxHDQAgDUF/aiENQQAhDCAL/RsARQ0AICEgEf0fACATk4sgD/0fACAdk4uSXQ0AIAZBgIDno3w2AgAgByAWsjgCAEEAIQwgC0EA/RwAIQsLAkAgBSAURw0AIA1Bf2ohDUEAIRQgC/0bAUUNACAiIBH9HwEgGpOLIA/9HwEgHpOLkl0NACAGQYCA56N8NgIEIAcgF7I4AgRBACEUIAtBAP0cASELCwJAIAUgFUcNACANQX9qIQ1BACEVIAv9GwJFDQAgIyAR/R8CIBuTiyAP/R8CIB+Ti5JdDQAgBkGAgOejfDYCCCAHIBiyOAIIQQAhFSALQQD9HAIhCwsCQAJAIAUgGUYNACAZIS0MAQsgDUF/aiENQQAhLSAL/RsDRQ0AICQgEf0fAyAck4sgD/0fAyAgk4uSXQ0AIAZBgIDno3w2AgwgByAssjgCDEEAIS0gC0EA/RwDIQsLIAv9GwAgC/0bAXIgC/0bAnIgC/0bA3JFDQILAkACQCALICogDyAQ/eUB/eABIBEgDv3lAf3gAf3kASIrIBL9Q/1SIij9GwAiACAo/RsBIi5yICj9GwIiL3IgKP0bAyImckUNACADICVrIRkgAiAla0EBaiECAkAgAEUNACAMDQAgDUEBaiENICv9HwAhISAP/R8AIR0gEf0fACETIBkhDCACIRYLAkAgLkUNACAUDQAgDUEBaiENICv9HwEhIiAP/R8BIR4gEf0fASEaIBkhFCACIRcLAkAgL0UNACAVDQAgDUEBaiENICv9HwIhIyAP/R8CIR8gEf0fAiEbIBkhFSACIRgLICZFDQAgLQ0AIA1BAWohDSAr/R8DISQgD/0fAyEgIBH9HwMhHAwBCyAtIRkgLCECCwJAIAUgMkYNACACISwMAQsgAiEsIAMhMiAFISUgDyEQIBEhDgsgA0ECaiEDIAUgAU4hACAEQQFqIQQgASAFRw0BCwsgAEEBcUUNEAsCQAJAAkAgC/0bAEUNACAGQYCA56N8NgIAAkAgCEQAAAAAAAAAAGRFDQAgB0EANgIAIAv9GwFFDQMgBkGAgOejfDYCBAwCCyAL/RsBRQ0CIAZBgIDno3w2AgQMAgsgC/0bAUUNASAGQYCA56N8NgIEIAhEAAAAAAAAAABlDQELIAdBADYCBAsCQCAL/RsCRQ0AIAZBgIDno3w2AggCQCAIRAAAAAAAAAAAZEUNACAHQQA2AgggC/0bA0UNESAGQYCA56N8NgIMDBALIAv9GwNFDRAgBkGAgOejfDYCDA8LIAv9GwNFDQ8gBkGAgOejfDYCDCAIRAAAAAAAAAAAZQ0PDA4LAkACQCABQQFODQD9DP////////////////////8hCwwBCyACKwMAtv0TIAIrAwi2/SABIAIrAxC2/SACIAIrAxi2/SADIg4gDv3mASERIAMrAwC2/RMgAysDCLb9IAEgAysDELb9IAIgAysDGLb9IAMiECAQ/eYBIQ8gCLb9EyES/Qz/////////////////////IQtBACEFQwAAAAAhE0ECIQNBACEMQQAhFEEAIRVBACEZQQAhFkEAIRdBACEYQQAhLEMAAAAAIRpDAAAAACEbQwAAAAAhHEMAAAAAIR1DAAAAACEeQwAAAAAhH0MAAAAAISBDAAAAACEhQwAAAAAhIkMAAAAAISNDAAAAACEkQQAhAEEAISVBASEEQQAhDUEBITIgECEpIA4hKANAIBEhJwJAAkAgBEEKbkEKbEF/aiAFIgJHDQAgJyAP/QwAAEDAAABAwAAAQMAAAEDA/eYB/eQBICj94AH95gEhKCAp/eABISkMAQsgKCAnIA/9DAAAQMAAAEDAAABAwAAAQMD95gH95AH95gEhKAsgAkEBaiEFAkACQCAL/QwAAAAAAAAAAAAAAAAAAAAAIiogJ/0MAABAQAAAQEAAAEBAAABAQP3mASAP/eUBICn95gEgCf3kASIpICn95gEiDyAoIAr95AEiKCAo/eYBIhH95AEiK/0MACR0SQAkdEkAJHRJACR0Sf1E/VIiJ/0bACItICf9GwEiLnIgJ/0bAiIvciAn/RsDIiZyRQ0AIAWyITACQCAtRQ0AIAYgMCAr/RsAIi2zQwAAADSUQ3dz+MKSIC1B////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkMAAAA/lLwiLbNDAAAANJRDd3P4wpIgLUH///8DcUGAgID4A3K+IjFDdb+/v5SSQ6Pp3L8gMUP5RLQ+kpWSQ52EIb+UkjgCAAsCQCAuRQ0AIAYgMCAr/RsBIi2zQwAAADSUQ3dz+MKSIC1B////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkMAAAA/lLwiLbNDAAAANJRDd3P4wpIgLUH///8DcUGAgID4A3K+IjFDdb+/v5SSQ6Pp3L8gMUP5RLQ+kpWSQ52EIb+UkjgCBAsCQCAvRQ0AIAYgMCAr/RsCIi2zQwAAADSUQ3dz+MKSIC1B////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkMAAAA/lLwiLbNDAAAANJRDd3P4wpIgLUH///8DcUGAgID4A3K+IjFDdb+/v5SSQ6Pp3L8gMUP5RLQ+kpWSQ52EIb+UkjgCCAsCQCAmRQ0AIAYgMCAr/RsDIi2zQwAAADSUQ3dz+MKSIC1B////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkMAAAA/lLwiLbNDAAAANJRDd3P4wpIgLUH///8DcUGAgID4A3K+IjFDdb+/v5SSQ6Pp3L8gMUP5RLQ+kpWSQ52EIb+UkjgCDAsgJyAL/VEiC/0bACAL/RsBciAL/RsCciAL/RsDckUNAQsCQCAIRAAAAAAAAAAAZQ0AAkACQCANDQAgGSEtQQAhDQwBCwJAIAUgDEcNACANQX9qIQ1BACEMIAv9GwBFDQAgISAo/R8AIBOTiyAp/R8AIB2Ti5JdDQAgBkGAgOejfDYCACAHIBayOAIAQQAhDCALQQD9HAAhCwsCQCAFIBRHDQAgDUF/aiENQQAhFCAL/RsBRQ0AICIgKP0fASAak4sgKf0fASAek4uSXQ0AIAZBgIDno3w2AgQgByAXsjgCBEEAIRQgC0EA/RwBIQsLAkAgBSAVRw0AIA1Bf2ohDUEAIRUgC/0bAkUNACAjICj9HwIgG5OLICn9HwIgH5OLkl0NACAGQYCA56N8NgIIIAcgGLI4AghBACEVIAtBAP0cAiELCwJAAkAgBSAZRg0AIBkhLQwBCyANQX9qIQ1BACEtIAv9GwNFDQAgJCAo/R8DIByTiyAp/R8DICCTi5JdDQAgBkGAgOejfDYCDCAHICyyOAIMQQAhLSALQQD9HAMhCwsgC/0bACAL/RsBciAL/RsCciAL/RsDckUNAgsCQAJAIAsgKiApIBD95QH94AEgKCAO/eUB/eAB/eQBIisgEv1D/VIiJ/0bACIAICf9GwEiLnIgJ/0bAiIvciAn/RsDIiZyRQ0AIAMgJWshGSACICVrQQFqIQICQCAARQ0AIAwNACANQQFqIQ0gK/0fACEhICn9HwAhHSAo/R8AIRMgGSEMIAIhFgsCQCAuRQ0AIBQNACANQQFqIQ0gK/0fASEiICn9HwEhHiAo/R8BIRogGSEUIAIhFwsCQCAvRQ0AIBUNACANQQFqIQ0gK/0fAiEjICn9HwIhHyAo/R8CIRsgGSEVIAIhGAsgJkUNACAtDQAgDUEBaiENICv9HwMhJCAp/R8DISAgKP0fAyEcDAELIC0hGSAsIQILAkAgBSAyRg0AIAIhLAwBCyACISwgAyEyIAUhJSApIRAgKCEOCyADQQJqIQMgBSABTiEAIARBAWohBCABIAVHDQELCyAAQQFxRQ0PCwJAAkACQCAL/RsARQ0AIAZBgIDno3w2AgACQCAIRAAAAAAAAAAAZEUNACAHQQA2AgAgC/0bAUUNAyAGQYCA56N8NgIEDAILIAv9GwFFDQIgBkGAgOejfDYCBAwCCyAL/RsBRQ0BIAZBgIDno3w2AgQgCEQAAAAAAAAAAGUNAQsgB0EANgIECwJAIAv9GwJFDQAgBkGAgOejfDYCCAJAIAhEAAAAAAAAAABkRQ0AIAdBADYCCCAL/RsDRQ0QIAZBgIDno3w2AgwMDwsgC/0bA0UNDyAGQYCA56N8NgIMDwsgC/0bA0UNDiAGQYCA56N8NgIMIAhEAAAAAAAAAABkDQ0MDgsCQAJAIAFBAU4NAP0M/////////////////////yELDAELIAIrAwC2/RMgAisDCLb9IAEgAisDELb9IAIgAisDGLb9IAMiDiAO/eYBIQ8gAysDALb9EyADKwMItv0gASADKwMQtv0gAiADKwMYtv0gAyIQIBD95gEhESAItv0TIRL9DP////////////////////8hC0EAIQVDAAAAACETQQIhA0EAIQxBACEUQQAhFUEAIRlBACEWQQAhF0EAIRhBACEsQwAAAAAhGkMAAAAAIRtDAAAAACEcQwAAAAAhHUMAAAAAIR5DAAAAACEfQwAAAAAhIEMAAAAAISFDAAAAACEiQwAAAAAhI0MAAAAAISRBACEAQQAhJUEBIQRBACENQQEhMiAQISggDiEpAkADQCARIScgBSICQQFqIQUCQCAL/QwAAAAAAAAAAAAAAAAAAAAAIiogKCApICn95AH95gEiKf3gASApIAIgBEEKbkEKbEF/akYbIAn95AEiKCAo/eYBIhEgDyAn/eUBIAr95AEiKSAp/eYBIg/95AEiK/0MACR0SQAkdEkAJHRJACR0Sf1E/VIiJ/0bACItICf9GwEiLnIgJ/0bAiIvciAn/RsDIiZyRQ0AIAWyQ3dz+EKSITACQCAtRQ0AIAYgMCAr/RsAIi2zQwAAADSUQ3dz+MKSIC1B////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkMAAAA/lLwiLbNDAAAAtJSSIC1B////A3FBgICA+ANyviIxQ3W/vz+UkkOj6dw/IDFD+US0PpKVkjgCAAsCQCAuRQ0AIAYgMCAr/RsBIi2zQwAAADSUQ3dz+MKSIC1B////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkMAAAA/lLwiLbNDAAAAtJSSIC1B////A3FBgICA+ANyviIxQ3W/vz+UkkOj6dw/IDFD+US0PpKVkjgCBAsCQCAvRQ0AIAYgMCAr/RsCIi2zQwAAADSUQ3dz+MKSIC1B////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkMAAAA/lLwiLbNDAAAAtJSSIC1B////A3FBgICA+ANyviIxQ3W/vz+UkkOj6dw/IDFD+US0PpKVkjgCCAsCQCAmRQ0AIAYgMCAr/RsDIi2zQwAAADSUQ3dz+MKSIC1B////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkMAAAA/lLwiLbNDAAAAtJSSIC1B////A3FBgICA+ANyviIwQ3W/vz+UkkOj6dw/IDBD+US0PpKVkjgCDAsgJyAL/VEiC/0bACAL/RsBciAL/RsCciAL/RsDckUNAgsCQCAIRAAAAAAAAAAAZQ0AAkACQCANDQAgGSEtQQAhDQwBCwJAIAUgDEcNACANQX9qIQ1BACEMIAv9GwBFDQAgISAp/R8AIBOTiyAo/R8AIB2Ti5JdDQAgBkGAgOejfDYCACAHIBayOAIAQQAhDCALQQD9HAAhCwsCQCAFIBRHDQAgDUF/aiENQQAhFCAL/RsBRQ0AICIgKf0fASAak4sgKP0fASAek4uSXQ0AIAZBgIDno3w2AgQgByAXsjgCBEEAIRQgC0EA/RwBIQsLAkAgBSAVRw0AIA1Bf2ohDUEAIRUgC/0bAkUNACAjICn9HwIgG5OLICj9HwIgH5OLkl0NACAGQYCA56N8NgIIIAcgGLI4AghBACEVIAtBAP0cAiELCwJAAkAgBSAZRg0AIBkhLQwBCyANQX9qIQ1BACEtIAv9GwNFDQAgJCAp/R8DIByTiyAo/R8DICCTi5JdDQAgBkGAgOejfDYCDCAHICyyOAIMQQAhLSALQQD9HAMhCwsgC/0bACAL/RsBciAL/RsCciAL/RsDckUNAwsCQAJAIAsgKiAoIBD95QH94AEgKSAO/eUB/eAB/eQBIisgEv1D/VIiJ/0bACIAICf9GwEiLnIgJ/0bAiIvciAn/RsDIiZyRQ0AIAMgJWshGSACICVrQQFqIQICQCAARQ0AIAwNACANQQFqIQ0gK/0fACEhICj9HwAhHSAp/R8AIRMgGSEMIAIhFgsCQCAuRQ0AIBQNACANQQFqIQ0gK/0fASEiICj9HwEhHiAp/R8BIRogGSEUIAIhFwsCQCAvRQ0AIBUNACANQQFqIQ0gK/0fAiEjICj9HwIhHyAp/R8CIRsgGSEVIAIhGAsgJkUNACAtDQAgDUEBaiENICv9HwMhJCAo/R8DISAgKf0fAyEcDAELIC0hGSAsIQILAkAgBSAyRg0AIAIhLAwBCyACISwgAyEyIAUhJSAoIRAgKSEOCyADQQJqIQMgBSABTiEAIARBAWohBCABIAVHDQALCyAAQQFxRQ0OCwJAAkACQCAL/RsARQ0AIAZBgIDno3w2AgACQCAIRAAAAAAAAAAAZEUNACAHQQA2AgAgC/0bAUUNAyAGQYCA56N8NgIEDAILIAv9GwFFDQIgBkGAgOejfDYCBAwCCyAL/RsBRQ0BIAZBgIDno3w2AgQgCEQAAAAAAAAAAGUNAQsgB0EANgIECwJAIAv9GwJFDQAgBkGAgOejfDYCCAJAIAhEAAAAAAAAAABkRQ0AIAdBADYCCCAL/RsDRQ0PIAZBgIDno3w2AgwMDgsgC/0bA0UNDiAGQYCA56N8NgIMDwsgC/0bA0UNDSAGQYCA56N8NgIMIAhEAAAAAAAAAABkDQwMDQsCQAJAIAFBAU4NAP0M/////////////////////yELDAELQQAhDEEAIAFrIQ0gAisDALb9EyACKwMItv0gASACKwMQtv0gAiACKwMYtv0gAyIOIA795gEhDyADKwMAtv0TIAMrAwi2/SABIAMrAxC2/SACIAMrAxi2/SADIhAgEP3mASERIAi2/RMhEv0M/////////////////////yELQwAAAAAhE0ECIQRBACEUQQAhFUEAIQBBACEWQQAhF0EAIRhBACEZQwAAAAAhGkMAAAAAIRtDAAAAACEcQwAAAAAhHUMAAAAAIR5DAAAAACEfQwAAAAAhIEMAAAAAISFDAAAAACEiQwAAAAAhI0MAAAAAISRBACEDQQAhJUEBIQVBACECQQEhJiAQIScgDiEoAkADQCAPIBH95QEhKQJAIAv9DAAAAAAAAAAAAAAAAAAAAAAiKiAJICcgKCIoICj95AH95gH95QEiJyAn/eYBIhEgKSAK/eQBIiggKP3mASIP/eQBIiv9DAAkdEkAJHRJACR0SQAkdEn9RP1SIin9GwAiLCAp/RsBIi1yICn9GwIiLnIgKf0bAyIvckUNACAFskN3c/hCkiEwAkAgLEUNACAGIDAgK/0bACIss0MAAAA0lEN3c/jCkiAsQf///wNxQYCAgPgDcr4iMUN1v7+/lJJDo+ncvyAxQ/lEtD6SlZJDAAAAP5S8IiyzQwAAALSUkiAsQf///wNxQYCAgPgDcr4iMUN1v78/lJJDo+ncPyAxQ/lEtD6SlZI4AgALAkAgLUUNACAGIDAgK/0bASIss0MAAAA0lEN3c/jCkiAsQf///wNxQYCAgPgDcr4iMUN1v7+/lJJDo+ncvyAxQ/lEtD6SlZJDAAAAP5S8IiyzQwAAALSUkiAsQf///wNxQYCAgPgDcr4iMUN1v78/lJJDo+ncPyAxQ/lEtD6SlZI4AgQLAkAgLkUNACAGIDAgK/0bAiIss0MAAAA0lEN3c/jCkiAsQf///wNxQYCAgPgDcr4iMUN1v7+/lJJDo+ncvyAxQ/lEtD6SlZJDAAAAP5S8IiyzQwAAALSUkiAsQf///wNxQYCAgPgDcr4iMUN1v78/lJJDo+ncPyAxQ/lEtD6SlZI4AggLAkAgL0UNACAGIDAgK/0bAyIss0MAAAA0lEN3c/jCkiAsQf///wNxQYCAgPgDcr4iMUN1v7+/lJJDo+ncvyAxQ/lEtD6SlZJDAAAAP5S8IiyzQwAAALSUkiAsQf///wNxQYCAgPgDcr4iMEN1v78/lJJDo+ncPyAwQ/lEtD6SlZI4AgwLICkgC/1RIgv9GwAgC/0bAXIgC/0bAnIgC/0bA3JFDQILAkAgCEQAAAAAAAAAAGUNAAJAAkAgAg0AIAAhLEEAIQIMAQsCQCAFIAxHDQAgAkF/aiECQQAhDCAL/RsARQ0AICEgKP0fACATk4sgJ/0fACAdk4uSXQ0AIAZBgIDno3w2AgAgByAWsjgCAEEAIQwgC0EA/RwAIQsLAkAgBSAURw0AIAJBf2ohAkEAIRQgC/0bAUUNACAiICj9HwEgGpOLICf9HwEgHpOLkl0NACAGQYCA56N8NgIEIAcgF7I4AgRBACEUIAtBAP0cASELCwJAIAUgFUcNACACQX9qIQJBACEVIAv9GwJFDQAgIyAo/R8CIBuTiyAn/R8CIB+Ti5JdDQAgBkGAgOejfDYCCCAHIBiyOAIIQQAhFSALQQD9HAIhCwsCQAJAIAUgAEYNACAAISwMAQsgAkF/aiECQQAhLCAL/RsDRQ0AICQgKP0fAyAck4sgJ/0fAyAgk4uSXQ0AIAZBgIDno3w2AgwgByAZsjgCDEEAISwgC0EA/RwDIQsLIAv9GwAgC/0bAXIgC/0bAnIgC/0bA3JFDQMLAkACQCALICogJyAQ/eUB/eABICggDv3lAf3gAf3kASIrIBL9Q/1SIin9GwAiLSAp/RsBIi5yICn9GwIiL3IgKf0bAyIyckUNACAEICVrIQAgBSAlayEDAkAgLUUNACAMDQAgAkEBaiECICv9HwAhISAn/R8AIR0gKP0fACETIAAhDCADIRYLAkAgLkUNACAUDQAgAkEBaiECICv9HwEhIiAn/R8BIR4gKP0fASEaIAAhFCADIRcLAkAgL0UNACAVDQAgAkEBaiECICv9HwIhIyAn/R8CIR8gKP0fAiEbIAAhFSADIRgLIDJFDQAgLA0AIAJBAWohAiAr/R8DISQgJ/0fAyEgICj9HwMhHAwBCyAsIQAgGSEDCwJAIAUgJkYNACADIRkMAQsgAyEZIAQhJiAFISUgJyEQICghDgsgBEECaiEEIAUgAU4hAyANIAVBAWoiBWpBAUcNAAsLIANBAXFFDQ0LAkACQAJAIAv9GwBFDQAgBkGAgOejfDYCAAJAIAhEAAAAAAAAAABkRQ0AIAdBADYCACAL/RsBRQ0DIAZBgIDno3w2AgQMAgsgC/0bAUUNAiAGQYCA56N8NgIEDAILIAv9GwFFDQEgBkGAgOejfDYCBCAIRAAAAAAAAAAAZQ0BCyAHQQA2AgQLAkAgC/0bAkUNACAGQYCA56N8NgIIAkAgCEQAAAAAAAAAAGRFDQAgB0EANgIIIAv9GwNFDQ4gBkGAgOejfDYCDAwNCyAL/RsDRQ0NIAZBgIDno3w2AgwPCyAL/RsDRQ0MIAZBgIDno3w2AgwgCEQAAAAAAAAAAGQNCwwMCwJAAkAgAUEBTg0A/Qz/////////////////////IQsMAQtBACEMQQAgAWshDSACKwMAtv0TIAIrAwi2/SABIAIrAxC2/SACIAIrAxi2/SADIg4gDv3mASEPIAMrAwC2/RMgAysDCLb9IAEgAysDELb9IAIgAysDGLb9IAMiECAQ/eYBIREgCLb9EyES/Qz/////////////////////IQtDAAAAACETQQIhBEEAIRRBACEVQQAhAEEAIRZBACEXQQAhGEEAIRlDAAAAACEaQwAAAAAhG0MAAAAAIRxDAAAAACEdQwAAAAAhHkMAAAAAIR9DAAAAACEgQwAAAAAhIUMAAAAAISJDAAAAACEjQwAAAAAhJEEAIQNBACElQQEhBUEAIQJBASEmIBAhJyAOISgCQANAIBEgKP3gASIp/eQBISgCQCAL/QwAAAAAAAAAAAAAAAAAAAAAIiogJ/3gASInICkgKf3kAf3mASAn/eUBIAn95AEiJyAn/eYBIhEgCiAP/eQBICj95QEiKCAo/eYBIg/95AEiK/0MACR0SQAkdEkAJHRJACR0Sf1E/VIiKf0bACIsICn9GwEiLXIgKf0bAiIuciAp/RsDIi9yRQ0AIAWyQ3dz+EKSITACQCAsRQ0AIAYgMCAr/RsAIiyzQwAAADSUQ3dz+MKSICxB////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkMAAAA/lLwiLLNDAAAAtJSSICxB////A3FBgICA+ANyviIxQ3W/vz+UkkOj6dw/IDFD+US0PpKVkjgCAAsCQCAtRQ0AIAYgMCAr/RsBIiyzQwAAADSUQ3dz+MKSICxB////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkMAAAA/lLwiLLNDAAAAtJSSICxB////A3FBgICA+ANyviIxQ3W/vz+UkkOj6dw/IDFD+US0PpKVkjgCBAsCQCAuRQ0AIAYgMCAr/RsCIiyzQwAAADSUQ3dz+MKSICxB////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkMAAAA/lLwiLLNDAAAAtJSSICxB////A3FBgICA+ANyviIxQ3W/vz+UkkOj6dw/IDFD+US0PpKVkjgCCAsCQCAvRQ0AIAYgMCAr/RsDIiyzQwAAADSUQ3dz+MKSICxB////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkMAAAA/lLwiLLNDAAAAtJSSICxB////A3FBgICA+ANyviIwQ3W/vz+UkkOj6dw/IDBD+US0PpKVkjgCDAsgKSAL/VEiC/0bACAL/RsBciAL/RsCciAL/RsDckUNAgsCQCAIRAAAAAAAAAAAZQ0AAkACQCACDQAgACEsQQAhAgwBCwJAIAUgDEcNACACQX9qIQJBACEMIAv9GwBFDQAgISAo/R8AIBOTiyAn/R8AIB2Ti5JdDQAgBkGAgOejfDYCACAHIBayOAIAQQAhDCALQQD9HAAhCwsCQCAFIBRHDQAgAkF/aiECQQAhFCAL/RsBRQ0AICIgKP0fASAak4sgJ/0fASAek4uSXQ0AIAZBgIDno3w2AgQgByAXsjgCBEEAIRQgC0EA/RwBIQsLAkAgBSAVRw0AIAJBf2ohAkEAIRUgC/0bAkUNACAjICj9HwIgG5OLICf9HwIgH5OLkl0NACAGQYCA56N8NgIIIAcgGLI4AghBACEVIAtBAP0cAiELCwJAAkAgBSAARg0AIAAhLAwBCyACQX9qIQJBACEsIAv9GwNFDQAgJCAo/R8DIByTiyAn/R8DICCTi5JdDQAgBkGAgOejfDYCDCAHIBmyOAIMQQAhLCALQQD9HAMhCwsgC/0bACAL/RsBciAL/RsCciAL/RsDckUNAwsCQAJAIAsgKiAnIBD95QH94AEgKCAO/eUB/eAB/eQBIisgEv1D/VIiKf0bACItICn9GwEiLnIgKf0bAiIvciAp/RsDIjJyRQ0AIAQgJWshACAFICVrIQMCQCAtRQ0AIAwNACACQQFqIQIgK/0fACEhICf9HwAhHSAo/R8AIRMgACEMIAMhFgsCQCAuRQ0AIBQNACACQQFqIQIgK/0fASEiICf9HwEhHiAo/R8BIRogACEUIAMhFwsCQCAvRQ0AIBUNACACQQFqIQIgK/0fAiEjICf9HwIhHyAo/R8CIRsgACEVIAMhGAsgMkUNACAsDQAgAkEBaiECICv9HwMhJCAn/R8DISAgKP0fAyEcDAELICwhACAZIQMLAkAgBSAmRg0AIAMhGQwBCyADIRkgBCEmIAUhJSAnIRAgKCEOCyAEQQJqIQQgBSABTiEDIA0gBUEBaiIFakEBRw0ACwsgA0EBcUUNDAsCQAJAAkAgC/0bAEUNACAGQYCA56N8NgIAAkAgCEQAAAAAAAAAAGRFDQAgB0EANgIAIAv9GwFFDQMgBkGAgOejfDYCBAwCCyAL/RsBRQ0CIAZBgIDno3w2AgQMAgsgC/0bAUUNASAGQYCA56N8NgIEIAhEAAAAAAAAAABlDQELIAdBADYCBAsCQCAL/RsCRQ0AIAZBgIDno3w2AggCQCAIRAAAAAAAAAAAZEUNACAHQQA2AgggC/0bA0UNDSAGQYCA56N8NgIMDAwLIAv9GwNFDQwgBkGAgOejfDYCDA8LIAv9GwNFDQsgBkGAgOejfDYCDCAIRAAAAAAAAAAAZA0KDAsLAkACQCABQQFODQD9DP////////////////////8hEQwBC0EAIQxBACABayEZIAIrAwC2/RMgAisDCLb9IAEgAisDELb9IAIgAisDGLb9IAMiJyAn/eYBIQ8gCLb9EyEQ/Qz/////////////////////IRFDAAAAACETQQIhBEEAIRRBACEVQQAhDUEAIRZBACEXQQAhGEEAISxDAAAAACEaQwAAAAAhG0MAAAAAIRxDAAAAACEdQwAAAAAhHkMAAAAAIR9DAAAAACEgQwAAAAAhIUMAAAAAISJDAAAAACEjQwAAAAAhJEEAIQJBACElQQEhBUEAIQBBASEmIAMrAwC2/RMgAysDCLb9IAEgAysDELb9IAIgAysDGLb9IAP94QEiKyEpICf94AEiDiEnAkADQAJAIBH9DAAAAAAAAAAAAAAAAAAAAAAiCyAPIAr95AEgKSAp/eYB/eUBIiggKP3mASIPICn9DAAAAMAAAADAAAAAwAAAAMD95gEgJ/3mASAJ/eUBIikgKf3mAf3kASIq/QwAJHRJACR0SQAkdEkAJHRJ/UT9UiIn/RsAIgMgJ/0bASItciAn/RsCIi5yICf9GwMiL3JFDQAgBbJDd3P4QpIhMAJAIANFDQAgBiAwICr9GwAiA7NDAAAANJRDd3P4wpIgA0H///8DcUGAgID4A3K+IjFDdb+/v5SSQ6Pp3L8gMUP5RLQ+kpWSQwAAAD+UvCIDs0MAAAC0lJIgA0H///8DcUGAgID4A3K+IjFDdb+/P5SSQ6Pp3D8gMUP5RLQ+kpWSOAIACwJAIC1FDQAgBiAwICr9GwEiA7NDAAAANJRDd3P4wpIgA0H///8DcUGAgID4A3K+IjFDdb+/v5SSQ6Pp3L8gMUP5RLQ+kpWSQwAAAD+UvCIDs0MAAAC0lJIgA0H///8DcUGAgID4A3K+IjFDdb+/P5SSQ6Pp3D8gMUP5RLQ+kpWSOAIECwJAIC5FDQAgBiAwICr9GwIiA7NDAAAANJRDd3P4wpIgA0H///8DcUGAgID4A3K+IjFDdb+/v5SSQ6Pp3L8gMUP5RLQ+kpWSQwAAAD+UvCIDs0MAAAC0lJIgA0H///8DcUGAgID4A3K+IjFDdb+/P5SSQ6Pp3D8gMUP5RLQ+kpWSOAIICwJAIC9FDQAgBiAwICr9GwMiA7NDAAAANJRDd3P4wpIgA0H///8DcUGAgID4A3K+IjFDdb+/v5SSQ6Pp3L8gMUP5RLQ+kpWSQwAAAD+UvCIDs0MAAAC0lJIgA0H///8DcUGAgID4A3K+IjBDdb+/P5SSQ6Pp3D8gMEP5RLQ+kpWSOAIMCyAnIBH9USIR/RsAIBH9GwFyIBH9GwJyIBH9GwNyRQ0CCyAo/eABIScCQCAIRAAAAAAAAAAAZQ0AAkACQCAADQAgDSEtQQAhAAwBCwJAIAUgDEcNACAAQX9qIQBBACEMIBH9GwBFDQAgISAn/R8AIBOTiyAp/R8AIB2Ti5JdDQAgBkGAgOejfDYCACAHIBayOAIAQQAhDCARQQD9HAAhEQsCQCAFIBRHDQAgAEF/aiEAQQAhFCAR/RsBRQ0AICIgJ/0fASAak4sgKf0fASAek4uSXQ0AIAZBgIDno3w2AgQgByAXsjgCBEEAIRQgEUEA/RwBIRELAkAgBSAVRw0AIABBf2ohAEEAIRUgEf0bAkUNACAjICf9HwIgG5OLICn9HwIgH5OLkl0NACAGQYCA56N8NgIIIAcgGLI4AghBACEVIBFBAP0cAiERCwJAAkAgBSANRg0AIA0hLQwBCyAAQX9qIQBBACEtIBH9GwNFDQAgJCAn/R8DIByTiyAp/R8DICCTi5JdDQAgBkGAgOejfDYCDCAHICyyOAIMQQAhLSARQQD9HAMhEQsgEf0bACAR/RsBciAR/RsCciAR/RsDckUNAwsCQAJAIBEgCyAnIA795QH94AEgKSAr/eUB/eAB/eQBIiogEP1D/VIiKP0bACICICj9GwEiLnIgKP0bAiIvciAo/RsDIjJyRQ0AIAQgJWshDSAFICVrIQMCQCACRQ0AIAwNACAAQQFqIQAgKv0fACEhICn9HwAhHSAn/R8AIRMgDSEMIAMhFgsCQCAuRQ0AIBQNACAAQQFqIQAgKv0fASEiICn9HwEhHiAn/R8BIRogDSEUIAMhFwsCQCAvRQ0AIBUNACAAQQFqIQAgKv0fAiEjICn9HwIhHyAn/R8CIRsgDSEVIAMhGAsgMkUNACAtDQAgAEEBaiEAICr9HwMhJCAp/R8DISAgJ/0fAyEcDAELIC0hDSAsIQMLAkAgBSAmRg0AIAMhLAwBCyADISwgBCEmIAUhJSApISsgJyEOCyAEQQJqIQQgBSABTiECIBkgBUEBaiIFakEBRw0ACwsgAkEBcUUNCwsCQAJAAkAgEf0bAEUNACAGQYCA56N8NgIAAkAgCEQAAAAAAAAAAGRFDQAgB0EANgIAIBH9GwFFDQMgBkGAgOejfDYCBAwCCyAR/RsBRQ0CIAZBgIDno3w2AgQMAgsgEf0bAUUNASAGQYCA56N8NgIEIAhEAAAAAAAAAABlDQELIAdBADYCBAsCQCAR/RsCRQ0AIAZBgIDno3w2AggCQCAIRAAAAAAAAAAAZEUNACAHQQA2AgggEf0bA0UNDCAGQYCA56N8NgIMDAsLIBH9GwNFDQsgBkGAgOejfDYCDA8LIBH9GwNFDQogBkGAgOejfDYCDCAIRAAAAAAAAAAAZA0JDAoLAkACQCABQQFODQD9DP////////////////////8hCwwBC0EAIQxBACABayENIAIrAwC2/RMgAisDCLb9IAEgAisDELb9IAIgAisDGLb9IAMiDiAO/eYBIQ8gAysDALb9EyADKwMItv0gASADKwMQtv0gAiADKwMYtv0gAyIQIBD95gEhESAItv0TIRL9DP////////////////////8hC0MAAAAAIRNBAiEEQQAhFEEAIRVBACEAQQAhFkEAIRdBACEYQQAhGUMAAAAAIRpDAAAAACEbQwAAAAAhHEMAAAAAIR1DAAAAACEeQwAAAAAhH0MAAAAAISBDAAAAACEhQwAAAAAhIkMAAAAAISNDAAAAACEkQQAhA0EAISVBASEFQQAhAkEBISYgECEoIA4hKQJAA0AgKSAp/eQBIScCQCAL/QwAAAAAAAAAAAAAAAAAAAAAIiogCiAPIBH95QH94AH95AEiKSAp/eYBIg8gKCAn/eYBIAn95AEiKCAo/eYBIhH95AEiK/0MACR0SQAkdEkAJHRJACR0Sf1E/VIiJ/0bACIsICf9GwEiLXIgJ/0bAiIuciAn/RsDIi9yRQ0AIAWyQ3dz+EKSITACQCAsRQ0AIAYgMCAr/RsAIiyzQwAAADSUQ3dz+MKSICxB////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkMAAAA/lLwiLLNDAAAAtJSSICxB////A3FBgICA+ANyviIxQ3W/vz+UkkOj6dw/IDFD+US0PpKVkjgCAAsCQCAtRQ0AIAYgMCAr/RsBIiyzQwAAADSUQ3dz+MKSICxB////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkMAAAA/lLwiLLNDAAAAtJSSICxB////A3FBgICA+ANyviIxQ3W/vz+UkkOj6dw/IDFD+US0PpKVkjgCBAsCQCAuRQ0AIAYgMCAr/RsCIiyzQwAAADSUQ3dz+MKSICxB////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkMAAAA/lLwiLLNDAAAAtJSSICxB////A3FBgICA+ANyviIxQ3W/vz+UkkOj6dw/IDFD+US0PpKVkjgCCAsCQCAvRQ0AIAYgMCAr/RsDIiyzQwAAADSUQ3dz+MKSICxB////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkMAAAA/lLwiLLNDAAAAtJSSICxB////A3FBgICA+ANyviIwQ3W/vz+UkkOj6dw/IDBD+US0PpKVkjgCDAsgJyAL/VEiC/0bACAL/RsBciAL/RsCciAL/RsDckUNAgsCQCAIRAAAAAAAAAAAZQ0AAkACQCACDQAgACEsQQAhAgwBCwJAIAUgDEcNACACQX9qIQJBACEMIAv9GwBFDQAgISAp/R8AIBOTiyAo/R8AIB2Ti5JdDQAgBkGAgOejfDYCACAHIBayOAIAQQAhDCALQQD9HAAhCwsCQCAFIBRHDQAgAkF/aiECQQAhFCAL/RsBRQ0AICIgKf0fASAak4sgKP0fASAek4uSXQ0AIAZBgIDno3w2AgQgByAXsjgCBEEAIRQgC0EA/RwBIQsLAkAgBSAVRw0AIAJBf2ohAkEAIRUgC/0bAkUNACAjICn9HwIgG5OLICj9HwIgH5OLkl0NACAGQYCA56N8NgIIIAcgGLI4AghBACEVIAtBAP0cAiELCwJAAkAgBSAARg0AIAAhLAwBCyACQX9qIQJBACEsIAv9GwNFDQAgJCAp/R8DIByTiyAo/R8DICCTi5JdDQAgBkGAgOejfDYCDCAHIBmyOAIMQQAhLCALQQD9HAMhCwsgC/0bACAL/RsBciAL/RsCciAL/RsDckUNAwsCQAJAIAsgKiApIA795QH94AEgKCAQ/eUB/eAB/eQBIisgEv1D/VIiJ/0bACItICf9GwEiLnIgJ/0bAiIvciAn/RsDIjJyRQ0AIAQgJWshACAFICVrIQMCQCAtRQ0AIAwNACACQQFqIQIgK/0fACEhICj9HwAhHSAp/R8AIRMgACEMIAMhFgsCQCAuRQ0AIBQNACACQQFqIQIgK/0fASEiICj9HwEhHiAp/R8BIRogACEUIAMhFwsCQCAvRQ0AIBUNACACQQFqIQIgK/0fAiEjICj9HwIhHyAp/R8CIRsgACEVIAMhGAsgMkUNACAsDQAgAkEBaiECICv9HwMhJCAo/R8DISAgKf0fAyEcDAELICwhACAZIQMLAkAgBSAmRg0AIAMhGQwBCyADIRkgBCEmIAUhJSAoIRAgKSEOCyAEQQJqIQQgBSABTiEDIA0gBUEBaiIFakEBRw0ACwsgA0EBcUUNCgsCQAJAAkAgC/0bAEUNACAGQYCA56N8NgIAAkAgCEQAAAAAAAAAAGRFDQAgB0EANgIAIAv9GwFFDQMgBkGAgOejfDYCBAwCCyAL/RsBRQ0CIAZBgIDno3w2AgQMAgsgC/0bAUUNASAGQYCA56N8NgIEIAhEAAAAAAAAAABlDQELIAdBADYCBAsCQCAL/RsCRQ0AIAZBgIDno3w2AggCQCAIRAAAAAAAAAAAZEUNACAHQQA2AgggC/0bA0UNCyAGQYCA56N8NgIMDAoLIAv9GwNFDQogBkGAgOejfDYCDA8LIAv9GwNFDQkgBkGAgOejfDYCDCAIRAAAAAAAAAAAZA0IDAkLAkACQCABQQFODQD9DP////////////////////8hCwwBC0EAIQxBACABayENIAIrAwC2/RMgAisDCLb9IAEgAisDELb9IAIgAisDGLb9IAMiDiAO/eYBIREgAysDALb9EyADKwMItv0gASADKwMQtv0gAiADKwMYtv0gAyIQIBD95gEhKSAItv0TIRL9DP////////////////////8hC0MAAAAAIRNBAiEEQQAhFEEAIRVBACEAQQAhFkEAIRdBACEYQQAhGUMAAAAAIRpDAAAAACEbQwAAAAAhHEMAAAAAIR1DAAAAACEeQwAAAAAhH0MAAAAAISBDAAAAACEhQwAAAAAhIkMAAAAAISNDAAAAACEkQQAhA0EAISVBASEFQQAhAkEBISYgECEoIA4hDwJAA0AgKSARIif9DAAAwMAAAMDAAADAwAAAwMD95gH95AEgKf3mASERAkAgC/0MAAAAAAAAAAAAAAAAAAAAACIqICcgKf3lASAo/QwAAIBAAACAQAAAgEAAAIBA/eYBIA/95gH94AH95gEgCf3kASIoICj95gEiKSARICcgJ/3mASAK/eQB/eQBIg8gD/3mASIR/eQBIiv9DAAkdEkAJHRJACR0SQAkdEn9RP1SIif9GwAiLCAn/RsBIi1yICf9GwIiLnIgJ/0bAyIvckUNACAFsiEwAkAgLEUNACAGIDAgK/0bACIss0MAAAA0lEN3c/jCkiAsQf///wNxQYCAgPgDcr4iMUN1v7+/lJJDo+ncvyAxQ/lEtD6SlZJDAAAAP5S8IiyzQwAAADSUQ3dz+MKSICxB////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkMAAAA/lJM4AgALAkAgLUUNACAGIDAgK/0bASIss0MAAAA0lEN3c/jCkiAsQf///wNxQYCAgPgDcr4iMUN1v7+/lJJDo+ncvyAxQ/lEtD6SlZJDAAAAP5S8IiyzQwAAADSUQ3dz+MKSICxB////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkMAAAA/lJM4AgQLAkAgLkUNACAGIDAgK/0bAiIss0MAAAA0lEN3c/jCkiAsQf///wNxQYCAgPgDcr4iMUN1v7+/lJJDo+ncvyAxQ/lEtD6SlZJDAAAAP5S8IiyzQwAAADSUQ3dz+MKSICxB////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkMAAAA/lJM4AggLAkAgL0UNACAGIDAgK/0bAyIss0MAAAA0lEN3c/jCkiAsQf///wNxQYCAgPgDcr4iMUN1v7+/lJJDo+ncvyAxQ/lEtD6SlZJDAAAAP5S8IiyzQwAAADSUQ3dz+MKSICxB////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkMAAAA/lJM4AgwLICcgC/1RIgv9GwAgC/0bAXIgC/0bAnIgC/0bA3JFDQILAkAgCEQAAAAAAAAAAGUNAAJAAkAgAg0AIAAhLEEAIQIMAQsCQCAFIAxHDQAgAkF/aiECQQAhDCAL/RsARQ0AICEgD/0fACATk4sgKP0fACAdk4uSXQ0AIAZBgIDno3w2AgAgByAWsjgCAEEAIQwgC0EA/RwAIQsLAkAgBSAURw0AIAJBf2ohAkEAIRQgC/0bAUUNACAiIA/9HwEgGpOLICj9HwEgHpOLkl0NACAGQYCA56N8NgIEIAcgF7I4AgRBACEUIAtBAP0cASELCwJAIAUgFUcNACACQX9qIQJBACEVIAv9GwJFDQAgIyAP/R8CIBuTiyAo/R8CIB+Ti5JdDQAgBkGAgOejfDYCCCAHIBiyOAIIQQAhFSALQQD9HAIhCwsCQAJAIAUgAEYNACAAISwMAQsgAkF/aiECQQAhLCAL/RsDRQ0AICQgD/0fAyAck4sgKP0fAyAgk4uSXQ0AIAZBgIDno3w2AgwgByAZsjgCDEEAISwgC0EA/RwDIQsLIAv9GwAgC/0bAXIgC/0bAnIgC/0bA3JFDQMLAkACQCALICogKCAQ/eUB/eABIA8gDv3lAf3gAf3kASIrIBL9Q/1SIif9GwAiLSAn/RsBIi5yICf9GwIiL3IgJ/0bAyIyckUNACAEICVrIQAgBSAlayEDAkAgLUUNACAMDQAgAkEBaiECICv9HwAhISAo/R8AIR0gD/0fACETIAAhDCADIRYLAkAgLkUNACAUDQAgAkEBaiECICv9HwEhIiAo/R8BIR4gD/0fASEaIAAhFCADIRcLAkAgL0UNACAVDQAgAkEBaiECICv9HwIhIyAo/R8CIR8gD/0fAiEbIAAhFSADIRgLIDJFDQAgLA0AIAJBAWohAiAr/R8DISQgKP0fAyEgIA/9HwMhHAwBCyAsIQAgGSEDCwJAIAUgJkYNACADIRkMAQsgAyEZIAQhJiAFISUgKCEQIA8hDgsgBEECaiEEIAUgAU4hAyANIAVBAWoiBWpBAUcNAAsLIANBAXFFDQkLAkACQAJAIAv9GwBFDQAgBkGAgOejfDYCAAJAIAhEAAAAAAAAAABkRQ0AIAdBADYCACAL/RsBRQ0DIAZBgIDno3w2AgQMAgsgC/0bAUUNAiAGQYCA56N8NgIEDAILIAv9GwFFDQEgBkGAgOejfDYCBCAIRAAAAAAAAAAAZQ0BCyAHQQA2AgQLAkAgC/0bAkUNACAGQYCA56N8NgIIAkAgCEQAAAAAAAAAAGRFDQAgB0EANgIIIAv9GwNFDQogBkGAgOejfDYCDAwJCyAL/RsDRQ0JIAZBgIDno3w2AgwPCyAL/RsDRQ0IIAZBgIDno3w2AgwgCEQAAAAAAAAAAGQNBwwICwJAAkAgAUEBTg0A/Qz/////////////////////ISoMAQtBACEMQQAgAWshDSACKwMAtv0TIAIrAwi2/SABIAIrAxC2/SACIAIrAxi2/SADIg4gDv3mASEPIAMrAwC2/RMgAysDCLb9IAEgAysDELb9IAIgAysDGLb9IAMiECAQ/eYBIREgCLb9EyES/Qz/////////////////////ISpDAAAAACETQQIhBEEAIRRBACEVQQAhAEEAIRZBACEXQQAhGEEAIRlDAAAAACEaQwAAAAAhG0MAAAAAIRxDAAAAACEdQwAAAAAhHkMAAAAAIR9DAAAAACEgQwAAAAAhIUMAAAAAISJDAAAAACEjQwAAAAAhJEEAIQNBACElQQEhBUEAIQJBASEmIBAhJyAOISgCQANAIA/9DAAAQEAAAEBAAABAQAAAQEAiKf3mASELAkAgKv0MAAAAAAAAAAAAAAAAAAAAACIrIA8gESIRICn95gH95QEgKP3gAf3mASAK/eQBIiggKP3mASIPIAsgEf3lASAn/eAB/eYBIAn95AEiJyAn/eYBIhH95AEiC/0MACR0SQAkdEkAJHRJACR0Sf1E/VIiKf0bACIsICn9GwEiLXIgKf0bAiIuciAp/RsDIi9yRQ0AIAWyITACQCAsRQ0AIAYgMCAL/RsAIiyzQwAAADSUQ3dz+MKSICxB////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkMAAAA/lLwiLLNDAAAANJRDd3P4wpIgLEH///8DcUGAgID4A3K+IjFDdb+/v5SSQ6Pp3L8gMUP5RLQ+kpWSQ52EIb+UkjgCAAsCQCAtRQ0AIAYgMCAL/RsBIiyzQwAAADSUQ3dz+MKSICxB////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkMAAAA/lLwiLLNDAAAANJRDd3P4wpIgLEH///8DcUGAgID4A3K+IjFDdb+/v5SSQ6Pp3L8gMUP5RLQ+kpWSQ52EIb+UkjgCBAsCQCAuRQ0AIAYgMCAL/RsCIiyzQwAAADSUQ3dz+MKSICxB////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkMAAAA/lLwiLLNDAAAANJRDd3P4wpIgLEH///8DcUGAgID4A3K+IjFDdb+/v5SSQ6Pp3L8gMUP5RLQ+kpWSQ52EIb+UkjgCCAsCQCAvRQ0AIAYgMCAL/RsDIiyzQwAAADSUQ3dz+MKSICxB////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkMAAAA/lLwiLLNDAAAANJRDd3P4wpIgLEH///8DcUGAgID4A3K+IjFDdb+/v5SSQ6Pp3L8gMUP5RLQ+kpWSQ52EIb+UkjgCDAsgKSAq/VEiKv0bACAq/RsBciAq/RsCciAq/RsDckUNAgsCQCAIRAAAAAAAAAAAZQ0AAkACQCACDQAgACEsQQAhAgwBCwJAIAUgDEcNACACQX9qIQJBACEMICr9GwBFDQAgISAo/R8AIBOTiyAn/R8AIB2Ti5JdDQAgBkGAgOejfDYCACAHIBayOAIAQQAhDCAqQQD9HAAhKgsCQCAFIBRHDQAgAkF/aiECQQAhFCAq/RsBRQ0AICIgKP0fASAak4sgJ/0fASAek4uSXQ0AIAZBgIDno3w2AgQgByAXsjgCBEEAIRQgKkEA/RwBISoLAkAgBSAVRw0AIAJBf2ohAkEAIRUgKv0bAkUNACAjICj9HwIgG5OLICf9HwIgH5OLkl0NACAGQYCA56N8NgIIIAcgGLI4AghBACEVICpBAP0cAiEqCwJAAkAgBSAARg0AIAAhLAwBCyACQX9qIQJBACEsICr9GwNFDQAgJCAo/R8DIByTiyAn/R8DICCTi5JdDQAgBkGAgOejfDYCDCAHIBmyOAIMQQAhLCAqQQD9HAMhKgsgKv0bACAq/RsBciAq/RsCciAq/RsDckUNAwsCQAJAICogKyAoIA795QH94AEgJyAQ/eUB/eAB/eQBIgsgEv1D/VIiKf0bACItICn9GwEiLnIgKf0bAiIvciAp/RsDIjJyRQ0AIAQgJWshACAFICVrIQMCQCAtRQ0AIAwNACACQQFqIQIgC/0fACEhICf9HwAhHSAo/R8AIRMgACEMIAMhFgsCQCAuRQ0AIBQNACACQQFqIQIgC/0fASEiICf9HwEhHiAo/R8BIRogACEUIAMhFwsCQCAvRQ0AIBUNACACQQFqIQIgC/0fAiEjICf9HwIhHyAo/R8CIRsgACEVIAMhGAsgMkUNACAsDQAgAkEBaiECIAv9HwMhJCAn/R8DISAgKP0fAyEcDAELICwhACAZIQMLAkAgBSAmRg0AIAMhGQwBCyADIRkgBCEmIAUhJSAnIRAgKCEOCyAEQQJqIQQgBSABTiEDIA0gBUEBaiIFakEBRw0ACwsgA0EBcUUNCAsCQAJAAkAgKv0bAEUNACAGQYCA56N8NgIAAkAgCEQAAAAAAAAAAGRFDQAgB0EANgIAICr9GwFFDQMgBkGAgOejfDYCBAwCCyAq/RsBRQ0CIAZBgIDno3w2AgQMAgsgKv0bAUUNASAGQYCA56N8NgIEIAhEAAAAAAAAAABlDQELIAdBADYCBAsCQCAq/RsCRQ0AIAZBgIDno3w2AggCQCAIRAAAAAAAAAAAZEUNACAHQQA2AgggKv0bA0UNCSAGQYCA56N8NgIMDAgLICr9GwNFDQggBkGAgOejfDYCDA8LICr9GwNFDQcgBkGAgOejfDYCDCAIRAAAAAAAAAAAZA0GDAcLAkACQCABQQFODQD9DP////////////////////8hCwwBC0EAIQxBACABayENIAIrAwC2/RMgAisDCLb9IAEgAisDELb9IAIgAisDGLb9IAMiDiAO/eYBIQ8gAysDALb9EyADKwMItv0gASADKwMQtv0gAiADKwMYtv0gAyIQIBD95gEhESAItv0TIRL9DP////////////////////8hC0MAAAAAIRNBAiEEQQAhFEEAIRVBACEAQQAhFkEAIRdBACEYQQAhGUMAAAAAIRpDAAAAACEbQwAAAAAhHEMAAAAAIR1DAAAAACEeQwAAAAAhH0MAAAAAISBDAAAAACEhQwAAAAAhIkMAAAAAISNDAAAAACEkQQAhA0EAISVBASEFQQAhAkEBISYgECEnIA4hKAJAA0AgDyAR/eUBISkCQCAL/QwAAAAAAAAAAAAAAAAAAAAAIiogCSAnICgiKCAo/eQB/eYB/eAB/eQBIicgJ/3mASIRICkgCv3kASIoICj95gEiD/3kASIr/QwAJHRJACR0SQAkdEkAJHRJ/UT9UiIp/RsAIiwgKf0bASItciAp/RsCIi5yICn9GwMiL3JFDQAgBbJDd3P4QpIhMAJAICxFDQAgBiAwICv9GwAiLLNDAAAANJRDd3P4wpIgLEH///8DcUGAgID4A3K+IjFDdb+/v5SSQ6Pp3L8gMUP5RLQ+kpWSQwAAAD+UvCIss0MAAAC0lJIgLEH///8DcUGAgID4A3K+IjFDdb+/P5SSQ6Pp3D8gMUP5RLQ+kpWSOAIACwJAIC1FDQAgBiAwICv9GwEiLLNDAAAANJRDd3P4wpIgLEH///8DcUGAgID4A3K+IjFDdb+/v5SSQ6Pp3L8gMUP5RLQ+kpWSQwAAAD+UvCIss0MAAAC0lJIgLEH///8DcUGAgID4A3K+IjFDdb+/P5SSQ6Pp3D8gMUP5RLQ+kpWSOAIECwJAIC5FDQAgBiAwICv9GwIiLLNDAAAANJRDd3P4wpIgLEH///8DcUGAgID4A3K+IjFDdb+/v5SSQ6Pp3L8gMUP5RLQ+kpWSQwAAAD+UvCIss0MAAAC0lJIgLEH///8DcUGAgID4A3K+IjFDdb+/P5SSQ6Pp3D8gMUP5RLQ+kpWSOAIICwJAIC9FDQAgBiAwICv9GwMiLLNDAAAANJRDd3P4wpIgLEH///8DcUGAgID4A3K+IjFDdb+/v5SSQ6Pp3L8gMUP5RLQ+kpWSQwAAAD+UvCIss0MAAAC0lJIgLEH///8DcUGAgID4A3K+IjBDdb+/P5SSQ6Pp3D8gMEP5RLQ+kpWSOAIMCyApIAv9USIL/RsAIAv9GwFyIAv9GwJyIAv9GwNyRQ0CCwJAIAhEAAAAAAAAAABlDQACQAJAIAINACAAISxBACECDAELAkAgBSAMRw0AIAJBf2ohAkEAIQwgC/0bAEUNACAhICj9HwAgE5OLICf9HwAgHZOLkl0NACAGQYCA56N8NgIAIAcgFrI4AgBBACEMIAtBAP0cACELCwJAIAUgFEcNACACQX9qIQJBACEUIAv9GwFFDQAgIiAo/R8BIBqTiyAn/R8BIB6Ti5JdDQAgBkGAgOejfDYCBCAHIBeyOAIEQQAhFCALQQD9HAEhCwsCQCAFIBVHDQAgAkF/aiECQQAhFSAL/RsCRQ0AICMgKP0fAiAbk4sgJ/0fAiAfk4uSXQ0AIAZBgIDno3w2AgggByAYsjgCCEEAIRUgC0EA/RwCIQsLAkACQCAFIABGDQAgACEsDAELIAJBf2ohAkEAISwgC/0bA0UNACAkICj9HwMgHJOLICf9HwMgIJOLkl0NACAGQYCA56N8NgIMIAcgGbI4AgxBACEsIAtBAP0cAyELCyAL/RsAIAv9GwFyIAv9GwJyIAv9GwNyRQ0DCwJAAkAgCyAqICcgEP3lAf3gASAoIA795QH94AH95AEiKyAS/UP9UiIp/RsAIi0gKf0bASIuciAp/RsCIi9yICn9GwMiMnJFDQAgBCAlayEAIAUgJWshAwJAIC1FDQAgDA0AIAJBAWohAiAr/R8AISEgJ/0fACEdICj9HwAhEyAAIQwgAyEWCwJAIC5FDQAgFA0AIAJBAWohAiAr/R8BISIgJ/0fASEeICj9HwEhGiAAIRQgAyEXCwJAIC9FDQAgFQ0AIAJBAWohAiAr/R8CISMgJ/0fAiEfICj9HwIhGyAAIRUgAyEYCyAyRQ0AICwNACACQQFqIQIgK/0fAyEkICf9HwMhICAo/R8DIRwMAQsgLCEAIBkhAwsCQCAFICZGDQAgAyEZDAELIAMhGSAEISYgBSElICchECAoIQ4LIARBAmohBCAFIAFOIQMgDSAFQQFqIgVqQQFHDQALCyADQQFxRQ0HCwJAAkACQCAL/RsARQ0AIAZBgIDno3w2AgACQCAIRAAAAAAAAAAAZEUNACAHQQA2AgAgC/0bAUUNAyAGQYCA56N8NgIEDAILIAv9GwFFDQIgBkGAgOejfDYCBAwCCyAL/RsBRQ0BIAZBgIDno3w2AgQgCEQAAAAAAAAAAGUNAQsgB0EANgIECwJAIAv9GwJFDQAgBkGAgOejfDYCCAJAIAhEAAAAAAAAAABkRQ0AIAdBADYCCCAL/RsDRQ0IIAZBgIDno3w2AgwMBwsgC/0bA0UNByAGQYCA56N8NgIMDwsgC/0bA0UNBiAGQYCA56N8NgIMIAhEAAAAAAAAAABkDQUMBgsCQAJAIAFBAU4NAP0M/////////////////////yESDAELQQAhDEEAIAFrIQ0gAisDALb9EyACKwMItv0gASACKwMQtv0gAiACKwMYtv0gAyIzIDP95gEhKSADKwMAtv0TIAMrAwi2/SABIAMrAxC2/SACIAMrAxi2/SADIjQgNP3mASERIAi2/RMhNf0M/////////////////////yESQwAAAAAhE0ECIQRBACEUQQAhFUEAIQBBACEWQQAhF0EAIRhBACEZQwAAAAAhGkMAAAAAIRtDAAAAACEcQwAAAAAhHUMAAAAAIR5DAAAAACEfQwAAAAAhIEMAAAAAISFDAAAAACEiQwAAAAAhI0MAAAAAISRBACEDQQAhJUEBIQVBACECQQEhJiA0ISggMyEPAkADQCAp/QwAAOBAAADgQAAA4EAAAOBAIgv95gEhKiAp/QwAAKhBAACoQQAAqEEAAKhBIiv95gEhDgJAIBL9DAAAAAAAAAAAAAAAAAAAAAAiNiAp/QwAAAxCAAAMQgAADEIAAAxCIhD95gEgESInIAv95gH95QEgJyAn/eYBIhH95gEgKSAnICv95gH95QEgKSAp/eYBIgv95gH95AEgD/3mASAK/eQBIg8gD/3mASIpIAsgKiAnIBD95gH95QH95gEgDiAn/eUBIBH95gH95AEgKP3mASAJ/eQBIiggKP3mASIR/eQBIgv9DAAkdEkAJHRJACR0SQAkdEn9RP1SIif9GwAiLCAn/RsBIi1yICf9GwIiLnIgJ/0bAyIvckUNACAFsiEwAkAgLEUNACAGIDAgC/0bACIss0MAAAA0lEN3c/jCkiAsQf///wNxQYCAgPgDcr4iMUN1v7+/lJJDo+ncvyAxQ/lEtD6SlZJDAAAAP5S8IiyzQwAAADSUQ3dz+MKSICxB////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkPKYLa+lJI4AgALAkAgLUUNACAGIDAgC/0bASIss0MAAAA0lEN3c/jCkiAsQf///wNxQYCAgPgDcr4iMUN1v7+/lJJDo+ncvyAxQ/lEtD6SlZJDAAAAP5S8IiyzQwAAADSUQ3dz+MKSICxB////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkPKYLa+lJI4AgQLAkAgLkUNACAGIDAgC/0bAiIss0MAAAA0lEN3c/jCkiAsQf///wNxQYCAgPgDcr4iMUN1v7+/lJJDo+ncvyAxQ/lEtD6SlZJDAAAAP5S8IiyzQwAAADSUQ3dz+MKSICxB////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkPKYLa+lJI4AggLAkAgL0UNACAGIDAgC/0bAyIss0MAAAA0lEN3c/jCkiAsQf///wNxQYCAgPgDcr4iMUN1v7+/lJJDo+ncvyAxQ/lEtD6SlZJDAAAAP5S8IiyzQwAAADSUQ3dz+MKSICxB////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkPKYLa+lJI4AgwLICcgEv1RIhL9GwAgEv0bAXIgEv0bAnIgEv0bA3JFDQILAkAgCEQAAAAAAAAAAGUNAAJAAkAgAg0AIAAhLEEAIQIMAQsCQCAFIAxHDQAgAkF/aiECQQAhDCAS/RsARQ0AICEgD/0fACATk4sgKP0fACAdk4uSXQ0AIAZBgIDno3w2AgAgByAWsjgCAEEAIQwgEkEA/RwAIRILAkAgBSAURw0AIAJBf2ohAkEAIRQgEv0bAUUNACAiIA/9HwEgGpOLICj9HwEgHpOLkl0NACAGQYCA56N8NgIEIAcgF7I4AgRBACEUIBJBAP0cASESCwJAIAUgFUcNACACQX9qIQJBACEVIBL9GwJFDQAgIyAP/R8CIBuTiyAo/R8CIB+Ti5JdDQAgBkGAgOejfDYCCCAHIBiyOAIIQQAhFSASQQD9HAIhEgsCQAJAIAUgAEYNACAAISwMAQsgAkF/aiECQQAhLCAS/RsDRQ0AICQgD/0fAyAck4sgKP0fAyAgk4uSXQ0AIAZBgIDno3w2AgwgByAZsjgCDEEAISwgEkEA/RwDIRILIBL9GwAgEv0bAXIgEv0bAnIgEv0bA3JFDQMLAkACQCASIDYgDyAz/eUB/eABICggNP3lAf3gAf3kASILIDX9Q/1SIif9GwAiLSAn/RsBIi5yICf9GwIiL3IgJ/0bAyIyckUNACAEICVrIQAgBSAlayEDAkAgLUUNACAMDQAgAkEBaiECIAv9HwAhISAo/R8AIR0gD/0fACETIAAhDCADIRYLAkAgLkUNACAUDQAgAkEBaiECIAv9HwEhIiAo/R8BIR4gD/0fASEaIAAhFCADIRcLAkAgL0UNACAVDQAgAkEBaiECIAv9HwIhIyAo/R8CIR8gD/0fAiEbIAAhFSADIRgLIDJFDQAgLA0AIAJBAWohAiAL/R8DISQgKP0fAyEgIA/9HwMhHAwBCyAsIQAgGSEDCwJAIAUgJkYNACADIRkMAQsgAyEZIAQhJiAFISUgKCE0IA8hMwsgBEECaiEEIAUgAU4hAyANIAVBAWoiBWpBAUcNAAsLIANBAXFFDQYLAkACQAJAIBL9GwBFDQAgBkGAgOejfDYCAAJAIAhEAAAAAAAAAABkRQ0AIAdBADYCACAS/RsBRQ0DIAZBgIDno3w2AgQMAgsgEv0bAUUNAiAGQYCA56N8NgIEDAILIBL9GwFFDQEgBkGAgOejfDYCBCAIRAAAAAAAAAAAZQ0BCyAHQQA2AgQLAkAgEv0bAkUNACAGQYCA56N8NgIIAkAgCEQAAAAAAAAAAGRFDQAgB0EANgIIIBL9GwNFDQcgBkGAgOejfDYCDAwGCyAS/RsDRQ0GIAZBgIDno3w2AgwPCyAS/RsDRQ0FIAZBgIDno3w2AgwgCEQAAAAAAAAAAGQNBAwFCwJAAkAgAUEBTg0A/Qz/////////////////////IQ4MAQtBACEMQQAgAWshDSACKwMAtv0TIAIrAwi2/SABIAIrAxC2/SACIAIrAxi2/SADIhIgEv3mASERIAMrAwC2/RMgAysDCLb9IAEgAysDELb9IAIgAysDGLb9IAMiNiA2/eYBISkgCLb9EyEz/Qz/////////////////////IQ5DAAAAACETQQIhBEEAIRRBACEVQQAhAEEAIRZBACEXQQAhGEEAIRlDAAAAACEaQwAAAAAhG0MAAAAAIRxDAAAAACEdQwAAAAAhHkMAAAAAIR9DAAAAACEgQwAAAAAhIUMAAAAAISJDAAAAACEjQwAAAAAhJEEAIQNBACElQQEhBUEAIQJBASEmIDYhKCASIQ8CQANAIBEiJyAn/eYBIhH9DAAAcEEAAHBBAABwQQAAcEEiKv3mASApICn95gEiC/3kASAp/eYBISsCQCAO/QwAAAAAAAAAAAAAAAAAAAAAIhAgDyAo/eYBIBEgC/3kAf0MAADAQAAAwEAAAMBAAADAQP3mASAp/QwAAKDBAACgwQAAoMEAAKDB/eYBICf95gH95AH95gEgCf3kASIoICj95gEiKSAKICv95QEgCyAq/eYBIBH95AEgJ/3mAf3kASIPIA/95gEiEf3kASIL/QwAJHRJACR0SQAkdEkAJHRJ/UT9UiIn/RsAIiwgJ/0bASItciAn/RsCIi5yICf9GwMiL3JFDQAgBbIhMAJAICxFDQAgBiAwIAv9GwAiLLNDAAAANJRDd3P4wpIgLEH///8DcUGAgID4A3K+IjFDdb+/v5SSQ6Pp3L8gMUP5RLQ+kpWSQwAAAD+UvCIss0MAAAA0lEN3c/jCkiAsQf///wNxQYCAgPgDcr4iMUN1v7+/lJJDo+ncvyAxQ/lEtD6SlZJDkhHGvpSSOAIACwJAIC1FDQAgBiAwIAv9GwEiLLNDAAAANJRDd3P4wpIgLEH///8DcUGAgID4A3K+IjFDdb+/v5SSQ6Pp3L8gMUP5RLQ+kpWSQwAAAD+UvCIss0MAAAA0lEN3c/jCkiAsQf///wNxQYCAgPgDcr4iMUN1v7+/lJJDo+ncvyAxQ/lEtD6SlZJDkhHGvpSSOAIECwJAIC5FDQAgBiAwIAv9GwIiLLNDAAAANJRDd3P4wpIgLEH///8DcUGAgID4A3K+IjFDdb+/v5SSQ6Pp3L8gMUP5RLQ+kpWSQwAAAD+UvCIss0MAAAA0lEN3c/jCkiAsQf///wNxQYCAgPgDcr4iMUN1v7+/lJJDo+ncvyAxQ/lEtD6SlZJDkhHGvpSSOAIICwJAIC9FDQAgBiAwIAv9GwMiLLNDAAAANJRDd3P4wpIgLEH///8DcUGAgID4A3K+IjFDdb+/v5SSQ6Pp3L8gMUP5RLQ+kpWSQwAAAD+UvCIss0MAAAA0lEN3c/jCkiAsQf///wNxQYCAgPgDcr4iMUN1v7+/lJJDo+ncvyAxQ/lEtD6SlZJDkhHGvpSSOAIMCyAnIA79USIO/RsAIA79GwFyIA79GwJyIA79GwNyRQ0CCwJAIAhEAAAAAAAAAABlDQACQAJAIAINACAAISxBACECDAELAkAgBSAMRw0AIAJBf2ohAkEAIQwgDv0bAEUNACAhIA/9HwAgE5OLICj9HwAgHZOLkl0NACAGQYCA56N8NgIAIAcgFrI4AgBBACEMIA5BAP0cACEOCwJAIAUgFEcNACACQX9qIQJBACEUIA79GwFFDQAgIiAP/R8BIBqTiyAo/R8BIB6Ti5JdDQAgBkGAgOejfDYCBCAHIBeyOAIEQQAhFCAOQQD9HAEhDgsCQCAFIBVHDQAgAkF/aiECQQAhFSAO/RsCRQ0AICMgD/0fAiAbk4sgKP0fAiAfk4uSXQ0AIAZBgIDno3w2AgggByAYsjgCCEEAIRUgDkEA/RwCIQ4LAkACQCAFIABGDQAgACEsDAELIAJBf2ohAkEAISwgDv0bA0UNACAkIA/9HwMgHJOLICj9HwMgIJOLkl0NACAGQYCA56N8NgIMIAcgGbI4AgxBACEsIA5BAP0cAyEOCyAO/RsAIA79GwFyIA79GwJyIA79GwNyRQ0DCwJAAkAgDiAQIA8gEv3lAf3gASAoIDb95QH94AH95AEiCyAz/UP9UiIn/RsAIi0gJ/0bASIuciAn/RsCIi9yICf9GwMiMnJFDQAgBCAlayEAIAUgJWshAwJAIC1FDQAgDA0AIAJBAWohAiAL/R8AISEgKP0fACEdIA/9HwAhEyAAIQwgAyEWCwJAIC5FDQAgFA0AIAJBAWohAiAL/R8BISIgKP0fASEeIA/9HwEhGiAAIRQgAyEXCwJAIC9FDQAgFQ0AIAJBAWohAiAL/R8CISMgKP0fAiEfIA/9HwIhGyAAIRUgAyEYCyAyRQ0AICwNACACQQFqIQIgC/0fAyEkICj9HwMhICAP/R8DIRwMAQsgLCEAIBkhAwsCQCAFICZGDQAgAyEZDAELIAMhGSAEISYgBSElICghNiAPIRILIARBAmohBCAFIAFOIQMgDSAFQQFqIgVqQQFHDQALCyADQQFxRQ0FCwJAAkACQCAO/RsARQ0AIAZBgIDno3w2AgACQCAIRAAAAAAAAAAAZEUNACAHQQA2AgAgDv0bAUUNAyAGQYCA56N8NgIEDAILIA79GwFFDQIgBkGAgOejfDYCBAwCCyAO/RsBRQ0BIAZBgIDno3w2AgQgCEQAAAAAAAAAAGUNAQsgB0EANgIECwJAIA79GwJFDQAgBkGAgOejfDYCCAJAIAhEAAAAAAAAAABkRQ0AIAdBADYCCCAO/RsDRQ0GIAZBgIDno3w2AgwMBQsgDv0bA0UNBSAGQYCA56N8NgIMDwsgDv0bA0UNBCAGQYCA56N8NgIMIAhEAAAAAAAAAABkDQMMBAsCQAJAIAFBAU4NAP0M/////////////////////yErDAELQQAhDEEAIAFrIQ0gAisDALb9EyACKwMItv0gASACKwMQtv0gAiACKwMYtv0gAyIQIBD95gEhESADKwMAtv0TIAMrAwi2/SABIAMrAxC2/SACIAMrAxi2/SADIhIgEv3mASEpIAi2/RMhNv0M/////////////////////yErQwAAAAAhE0ECIQRBACEUQQAhFUEAIQBBACEWQQAhF0EAIRhBACEZQwAAAAAhGkMAAAAAIRtDAAAAACEcQwAAAAAhHUMAAAAAIR5DAAAAACEfQwAAAAAhIEMAAAAAISFDAAAAACEiQwAAAAAhI0MAAAAAISRBACEDQQAhJUEBIQVBACECQQEhJiASISggECEPAkADQAJAICv9DAAAAAAAAAAAAAAAAAAAAAAiDiARIif9DAAAoEAAAKBAAACgQAAAoEAiEf3mASAp/QwAACBBAAAgQQAAIEEAACBB/eYBIgv95QEgJ/3mASApICn95gEiKv3kASAo/eYBIAn95AEiKCAo/eYBIikgJyAL/eUBICf95gEgKiAR/eYB/eQBIA/95gEgCv3kASIPIA/95gEiEf3kASIL/QwAJHRJACR0SQAkdEkAJHRJ/UT9UiIn/RsAIiwgJ/0bASItciAn/RsCIi5yICf9GwMiL3JFDQAgBbIhMAJAICxFDQAgBiAwIAv9GwAiLLNDAAAANJRDd3P4wpIgLEH///8DcUGAgID4A3K+IjFDdb+/v5SSQ6Pp3L8gMUP5RLQ+kpWSQwAAAD+UvCIss0MAAAA0lEN3c/jCkiAsQf///wNxQYCAgPgDcr4iMUN1v7+/lJJDo+ncvyAxQ/lEtD6SlZJDo4HcvpSSOAIACwJAIC1FDQAgBiAwIAv9GwEiLLNDAAAANJRDd3P4wpIgLEH///8DcUGAgID4A3K+IjFDdb+/v5SSQ6Pp3L8gMUP5RLQ+kpWSQwAAAD+UvCIss0MAAAA0lEN3c/jCkiAsQf///wNxQYCAgPgDcr4iMUN1v7+/lJJDo+ncvyAxQ/lEtD6SlZJDo4HcvpSSOAIECwJAIC5FDQAgBiAwIAv9GwIiLLNDAAAANJRDd3P4wpIgLEH///8DcUGAgID4A3K+IjFDdb+/v5SSQ6Pp3L8gMUP5RLQ+kpWSQwAAAD+UvCIss0MAAAA0lEN3c/jCkiAsQf///wNxQYCAgPgDcr4iMUN1v7+/lJJDo+ncvyAxQ/lEtD6SlZJDo4HcvpSSOAIICwJAIC9FDQAgBiAwIAv9GwMiLLNDAAAANJRDd3P4wpIgLEH///8DcUGAgID4A3K+IjFDdb+/v5SSQ6Pp3L8gMUP5RLQ+kpWSQwAAAD+UvCIss0MAAAA0lEN3c/jCkiAsQf///wNxQYCAgPgDcr4iMUN1v7+/lJJDo+ncvyAxQ/lEtD6SlZJDo4HcvpSSOAIMCyAnICv9USIr/RsAICv9GwFyICv9GwJyICv9GwNyRQ0CCwJAIAhEAAAAAAAAAABlDQACQAJAIAINACAAISxBACECDAELAkAgBSAMRw0AIAJBf2ohAkEAIQwgK/0bAEUNACAhIA/9HwAgE5OLICj9HwAgHZOLkl0NACAGQYCA56N8NgIAIAcgFrI4AgBBACEMICtBAP0cACErCwJAIAUgFEcNACACQX9qIQJBACEUICv9GwFFDQAgIiAP/R8BIBqTiyAo/R8BIB6Ti5JdDQAgBkGAgOejfDYCBCAHIBeyOAIEQQAhFCArQQD9HAEhKwsCQCAFIBVHDQAgAkF/aiECQQAhFSAr/RsCRQ0AICMgD/0fAiAbk4sgKP0fAiAfk4uSXQ0AIAZBgIDno3w2AgggByAYsjgCCEEAIRUgK0EA/RwCISsLAkACQCAFIABGDQAgACEsDAELIAJBf2ohAkEAISwgK/0bA0UNACAkIA/9HwMgHJOLICj9HwMgIJOLkl0NACAGQYCA56N8NgIMIAcgGbI4AgxBACEsICtBAP0cAyErCyAr/RsAICv9GwFyICv9GwJyICv9GwNyRQ0DCwJAAkAgKyAOICggEv3lAf3gASAPIBD95QH94AH95AEiCyA2/UP9UiIn/RsAIi0gJ/0bASIuciAn/RsCIi9yICf9GwMiMnJFDQAgBCAlayEAIAUgJWshAwJAIC1FDQAgDA0AIAJBAWohAiAL/R8AISEgKP0fACEdIA/9HwAhEyAAIQwgAyEWCwJAIC5FDQAgFA0AIAJBAWohAiAL/R8BISIgKP0fASEeIA/9HwEhGiAAIRQgAyEXCwJAIC9FDQAgFQ0AIAJBAWohAiAL/R8CISMgKP0fAiEfIA/9HwIhGyAAIRUgAyEYCyAyRQ0AICwNACACQQFqIQIgC/0fAyEkICj9HwMhICAP/R8DIRwMAQsgLCEAIBkhAwsCQCAFICZGDQAgAyEZDAELIAMhGSAEISYgBSElICghEiAPIRALIARBAmohBCAFIAFOIQMgDSAFQQFqIgVqQQFHDQALCyADQQFxRQ0ECwJAAkACQCAr/RsARQ0AIAZBgIDno3w2AgACQCAIRAAAAAAAAAAAZEUNACAHQQA2AgAgK/0bAUUNAyAGQYCA56N8NgIEDAILICv9GwFFDQIgBkGAgOejfDYCBAwCCyAr/RsBRQ0BIAZBgIDno3w2AgQgCEQAAAAAAAAAAGUNAQsgB0EANgIECwJAICv9GwJFDQAgBkGAgOejfDYCCAJAIAhEAAAAAAAAAABkRQ0AIAdBADYCCCAr/RsDRQ0FIAZBgIDno3w2AgwMBAsgK/0bA0UNBCAGQYCA56N8NgIMDwsgK/0bA0UNAyAGQYCA56N8NgIMIAhEAAAAAAAAAABkDQIMAwsCQAJAIAFBAU4NAP0M/////////////////////yErDAELQQAhDEEAIAFrIQ0gAisDALb9EyACKwMItv0gASACKwMQtv0gAiACKwMYtv0gAyIQIBD95gEhESADKwMAtv0TIAMrAwi2/SABIAMrAxC2/SACIAMrAxi2/SADIhIgEv3mASEpIAi2/RMhNv0M/////////////////////yErQwAAAAAhE0ECIQRBACEUQQAhFUEAIQBBACEWQQAhF0EAIRhBACEZQwAAAAAhGkMAAAAAIRtDAAAAACEcQwAAAAAhHUMAAAAAIR5DAAAAACEfQwAAAAAhIEMAAAAAISFDAAAAACEiQwAAAAAhI0MAAAAAISRBACEDQQAhJUEBIQVBACECQQEhJiASISggECEPAkADQCApICn95gEhCyAp/QwAAMDAAADAwAAAwMAAAMDA/eYBISoCQCAr/QwAAAAAAAAAAAAAAAAAAAAAIg4gKP0MAACAQAAAgEAAAIBAAACAQP3mASARIicgKf3lAf3mASAP/eYBIAn95AEiKCAo/eYBIikgCyAK/eQBICcgKv3kASAn/eYB/eQBIg8gD/3mASIR/eQBIgv9DAAkdEkAJHRJACR0SQAkdEn9RP1SIif9GwAiLCAn/RsBIi1yICf9GwIiLnIgJ/0bAyIvckUNACAFsiEwAkAgLEUNACAGIDAgC/0bACIss0MAAAA0lEN3c/jCkiAsQf///wNxQYCAgPgDcr4iMUN1v7+/lJJDo+ncvyAxQ/lEtD6SlZJDAAAAP5S8IiyzQwAAADSUQ3dz+MKSICxB////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkMAAAA/lJM4AgALAkAgLUUNACAGIDAgC/0bASIss0MAAAA0lEN3c/jCkiAsQf///wNxQYCAgPgDcr4iMUN1v7+/lJJDo+ncvyAxQ/lEtD6SlZJDAAAAP5S8IiyzQwAAADSUQ3dz+MKSICxB////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkMAAAA/lJM4AgQLAkAgLkUNACAGIDAgC/0bAiIss0MAAAA0lEN3c/jCkiAsQf///wNxQYCAgPgDcr4iMUN1v7+/lJJDo+ncvyAxQ/lEtD6SlZJDAAAAP5S8IiyzQwAAADSUQ3dz+MKSICxB////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkMAAAA/lJM4AggLAkAgL0UNACAGIDAgC/0bAyIss0MAAAA0lEN3c/jCkiAsQf///wNxQYCAgPgDcr4iMUN1v7+/lJJDo+ncvyAxQ/lEtD6SlZJDAAAAP5S8IiyzQwAAADSUQ3dz+MKSICxB////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkMAAAA/lJM4AgwLICcgK/1RIiv9GwAgK/0bAXIgK/0bAnIgK/0bA3JFDQILAkAgCEQAAAAAAAAAAGUNAAJAAkAgAg0AIAAhLEEAIQIMAQsCQCAFIAxHDQAgAkF/aiECQQAhDCAr/RsARQ0AICEgD/0fACATk4sgKP0fACAdk4uSXQ0AIAZBgIDno3w2AgAgByAWsjgCAEEAIQwgK0EA/RwAISsLAkAgBSAURw0AIAJBf2ohAkEAIRQgK/0bAUUNACAiIA/9HwEgGpOLICj9HwEgHpOLkl0NACAGQYCA56N8NgIEIAcgF7I4AgRBACEUICtBAP0cASErCwJAIAUgFUcNACACQX9qIQJBACEVICv9GwJFDQAgIyAP/R8CIBuTiyAo/R8CIB+Ti5JdDQAgBkGAgOejfDYCCCAHIBiyOAIIQQAhFSArQQD9HAIhKwsCQAJAIAUgAEYNACAAISwMAQsgAkF/aiECQQAhLCAr/RsDRQ0AICQgD/0fAyAck4sgKP0fAyAgk4uSXQ0AIAZBgIDno3w2AgwgByAZsjgCDEEAISwgK0EA/RwDISsLICv9GwAgK/0bAXIgK/0bAnIgK/0bA3JFDQMLAkACQCArIA4gKCAS/eUB/eABIA8gEP3lAf3gAf3kASILIDb9Q/1SIif9GwAiLSAn/RsBIi5yICf9GwIiL3IgJ/0bAyIyckUNACAEICVrIQAgBSAlayEDAkAgLUUNACAMDQAgAkEBaiECIAv9HwAhISAo/R8AIR0gD/0fACETIAAhDCADIRYLAkAgLkUNACAUDQAgAkEBaiECIAv9HwEhIiAo/R8BIR4gD/0fASEaIAAhFCADIRcLAkAgL0UNACAVDQAgAkEBaiECIAv9HwIhIyAo/R8CIR8gD/0fAiEbIAAhFSADIRgLIDJFDQAgLA0AIAJBAWohAiAL/R8DISQgKP0fAyEgIA/9HwMhHAwBCyAsIQAgGSEDCwJAIAUgJkYNACADIRkMAQsgAyEZIAQhJiAFISUgKCESIA8hEAsgBEECaiEEIAUgAU4hAyANIAVBAWoiBWpBAUcNAAsLIANBAXFFDQMLAkACQAJAICv9GwBFDQAgBkGAgOejfDYCAAJAIAhEAAAAAAAAAABkRQ0AIAdBADYCACAr/RsBRQ0DIAZBgIDno3w2AgQMAgsgK/0bAUUNAiAGQYCA56N8NgIEDAILICv9GwFFDQEgBkGAgOejfDYCBCAIRAAAAAAAAAAAZQ0BCyAHQQA2AgQLAkAgK/0bAkUNACAGQYCA56N8NgIIAkAgCEQAAAAAAAAAAGRFDQAgB0EANgIIICv9GwNFDQQgBkGAgOejfDYCDAwDCyAr/RsDRQ0DIAZBgIDno3w2AgwPCyAr/RsDRQ0CIAZBgIDno3w2AgwgCEQAAAAAAAAAAGQNAQwCCwJAAkAgAUEBTg0A/Qz/////////////////////ISoMAQtBACEMQQAgAWshDSACKwMAtv0TIAIrAwi2/SABIAIrAxC2/SACIAIrAxi2/SADIg4gDv3mASEPIAMrAwC2/RMgAysDCLb9IAEgAysDELb9IAIgAysDGLb9IAMiECAQ/eYBIREgCLb9EyES/Qz/////////////////////ISpDAAAAACETQQIhBEEAIRRBACEVQQAhAEEAIRZBACEXQQAhGEEAIRlDAAAAACEaQwAAAAAhG0MAAAAAIRxDAAAAACEdQwAAAAAhHkMAAAAAIR9DAAAAACEgQwAAAAAhIUMAAAAAISJDAAAAACEjQwAAAAAhJEEAIQNBACElQQEhBUEAIQJBASEmIBAhJyAOISgCQANAIA/9DAAAQEAAAEBAAABAQAAAQEAiKf3mASELAkAgKv0MAAAAAAAAAAAAAAAAAAAAACIrICggDyARIhEgKf3mAf3lAf3mASAK/eQBIiggKP3mASIPIAsgEf3lASAn/eYBIAn95AEiJyAn/eYBIhH95AEiC/0MACR0SQAkdEkAJHRJACR0Sf1E/VIiKf0bACIsICn9GwEiLXIgKf0bAiIuciAp/RsDIi9yRQ0AIAWyITACQCAsRQ0AIAYgMCAL/RsAIiyzQwAAADSUQ3dz+MKSICxB////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkMAAAA/lLwiLLNDAAAANJRDd3P4wpIgLEH///8DcUGAgID4A3K+IjFDdb+/v5SSQ6Pp3L8gMUP5RLQ+kpWSQ52EIb+UkjgCAAsCQCAtRQ0AIAYgMCAL/RsBIiyzQwAAADSUQ3dz+MKSICxB////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkMAAAA/lLwiLLNDAAAANJRDd3P4wpIgLEH///8DcUGAgID4A3K+IjFDdb+/v5SSQ6Pp3L8gMUP5RLQ+kpWSQ52EIb+UkjgCBAsCQCAuRQ0AIAYgMCAL/RsCIiyzQwAAADSUQ3dz+MKSICxB////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkMAAAA/lLwiLLNDAAAANJRDd3P4wpIgLEH///8DcUGAgID4A3K+IjFDdb+/v5SSQ6Pp3L8gMUP5RLQ+kpWSQ52EIb+UkjgCCAsCQCAvRQ0AIAYgMCAL/RsDIiyzQwAAADSUQ3dz+MKSICxB////A3FBgICA+ANyviIxQ3W/v7+UkkOj6dy/IDFD+US0PpKVkkMAAAA/lLwiLLNDAAAANJRDd3P4wpIgLEH///8DcUGAgID4A3K+IjFDdb+/v5SSQ6Pp3L8gMUP5RLQ+kpWSQ52EIb+UkjgCDAsgKSAq/VEiKv0bACAq/RsBciAq/RsCciAq/RsDckUNAgsCQCAIRAAAAAAAAAAAZQ0AAkACQCACDQAgACEsQQAhAgwBCwJAIAUgDEcNACACQX9qIQJBACEMICr9GwBFDQAgISAo/R8AIBOTiyAn/R8AIB2Ti5JdDQAgBkGAgOejfDYCACAHIBayOAIAQQAhDCAqQQD9HAAhKgsCQCAFIBRHDQAgAkF/aiECQQAhFCAq/RsBRQ0AICIgKP0fASAak4sgJ/0fASAek4uSXQ0AIAZBgIDno3w2AgQgByAXsjgCBEEAIRQgKkEA/RwBISoLAkAgBSAVRw0AIAJBf2ohAkEAIRUgKv0bAkUNACAjICj9HwIgG5OLICf9HwIgH5OLkl0NACAGQYCA56N8NgIIIAcgGLI4AghBACEVICpBAP0cAiEqCwJAAkAgBSAARg0AIAAhLAwBCyACQX9qIQJBACEsICr9GwNFDQAgJCAo/R8DIByTiyAn/R8DICCTi5JdDQAgBkGAgOejfDYCDCAHIBmyOAIMQQAhLCAqQQD9HAMhKgsgKv0bACAq/RsBciAq/RsCciAq/RsDckUNAwsCQAJAICogKyAoIA795QH94AEgJyAQ/eUB/eAB/eQBIgsgEv1D/VIiKf0bACItICn9GwEiLnIgKf0bAiIvciAp/RsDIjJyRQ0AIAQgJWshACAFICVrIQMCQCAtRQ0AIAwNACACQQFqIQIgC/0fACEhICf9HwAhHSAo/R8AIRMgACEMIAMhFgsCQCAuRQ0AIBQNACACQQFqIQIgC/0fASEiICf9HwEhHiAo/R8BIRogACEUIAMhFwsCQCAvRQ0AIBUNACACQQFqIQIgC/0fAiEjICf9HwIhHyAo/R8CIRsgACEVIAMhGAsgMkUNACAsDQAgAkEBaiECIAv9HwMhJCAn/R8DISAgKP0fAyEcDAELICwhACAZIQMLAkAgBSAmRg0AIAMhGQwBCyADIRkgBCEmIAUhJSAnIRAgKCEOCyAEQQJqIQQgBSABTiEDIA0gBUEBaiIFakEBRw0ACwsgA0EBcUUNAgsCQAJAAkAgKv0bAEUNACAGQYCA56N8NgIAAkAgCEQAAAAAAAAAAGRFDQAgB0EANgIAICr9GwFFDQMgBkGAgOejfDYCBAwCCyAq/RsBRQ0CIAZBgIDno3w2AgQMAgsgKv0bAUUNASAGQYCA56N8NgIEIAhEAAAAAAAAAABlDQELIAdBADYCBAsCQCAq/RsCRQ0AIAZBgIDno3w2AggCQCAIRAAAAAAAAAAAZEUNACAHQQA2AgggKv0bA0UNAyAGQYCA56N8NgIMDAILICr9GwNFDQIgBkGAgOejfDYCDA8LICr9GwNFDQEgBkGAgOejfDYCDCAIRAAAAAAAAAAAZEUNAQsgB0EANgIMCwuGzwEOA3sCfwZ7An8GfAJ/B3sCfgF9AX8BfQZ8AX8EeyAFQQhqIAX9XQMA/VcDAAEhCSAEQQhqIAT9XQMA/VcDAAEhCgJAAkACQAJAAkACQAJAAkACQAJAAkACQAJAAkACQAJAAkACQAJAAkACQCAAQX9qDg8ADw4NDAsKCQgHBgUEAwIBCwJAAkAgAUEBTg0A/Qz/////////////////////IQsMAQtBACEMQQAgAWshDSACQQhqIAL9XQMA/VcDAAEiDiAO/fIBIQ8gA0EIaiAD/V0DAP1XAwABIhAgEP3yASERIAj9FCES/QwAAAAAAAAAAAAAAAAAAAAAIRP9DP////////////////////8hC0ECIQRBACEAQQAhFEEAIRVEAAAAAAAAAAAhFkQAAAAAAAAAACEXRAAAAAAAAAAAIRhEAAAAAAAAAAAhGUQAAAAAAAAAACEaRAAAAAAAAAAAIRtBACEDQQAhHEEBIQVBACECQQEhHf0MAAAAAAAA8D8AAAAAAADwPyIeIR8gECEgIA4hIQJAA0AgDyAR/fEBIQ8gISIhIB8iEf3yASAgIiAgE/3yAf3xASIfIB/98AEgHv3wASEfICEgE/3yASAgIBH98gH98AEiEyAT/fABIRMCQCAL/QwAAAAAAAAAAAAAAAAAAAAAIiIgICAhICH98AH98gEgCf3wASIgICD98gEiESAPIAr98AEiISAh/fIBIg/98AEiI/0MAAAAAICELkEAAAAAgIQuQf1K/VIiJP0dACIlICT9HQEiJoRQDQAgBbJDd3P4QpIhJwJAICVQDQAgBiAnICP9IQC2vCIos0MAAAA0lEN3c/jCkiAoQf///wNxQYCAgPgDcr4iKUN1v7+/lJJDo+ncvyApQ/lEtD6SlZJDAAAAP5S8IiizQwAAALSUkiAoQf///wNxQYCAgPgDcr4iKUN1v78/lJJDo+ncPyApQ/lEtD6SlZI4AgAgByAT/SEAIiogIP0hACIroiAf/SEAIiwgIf0hACItoqAgKiAqoiAsICyioCIuoyIvICwgK6IgKiAtoqEgLqMiKqBEAAAAYJ6g5j+iIC8gL6IgKiAqoqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIACwJAICZQDQAgBiAnICP9IQG2vCIos0MAAAA0lEN3c/jCkiAoQf///wNxQYCAgPgDcr4iKUN1v7+/lJJDo+ncvyApQ/lEtD6SlZJDAAAAP5S8IiizQwAAALSUkiAoQf///wNxQYCAgPgDcr4iJ0N1v78/lJJDo+ncPyAnQ/lEtD6SlZI4AgQgByAT/SEBIiogIP0hASIroiAf/SEBIiwgIf0hASItoqAgKiAqoiAsICyioCIuoyIvICwgK6IgKiAtoqEgLqMiKqBEAAAAYJ6g5j+iIC8gL6IgKiAqoqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIECyAkIAv9USIL/R0AIAv9HQGEUA0CCwJAIAhEAAAAAAAAAABlDQACQAJAIAINACAAIShBACECDAELAkAgBSAMRw0AIAJBf2ohAkEAIQwgC/0dAFANACAh/SEAIBahmSAg/SEAIBihmaAgGmQNACAGQYCA56N8NgIAIAcgFLI4AgAgC0IA/R4AIQsLAkACQCAFIABGDQAgACEoDAELIAJBf2ohAkEAISggC/0dAVANACAh/SEBIBehmSAg/SEBIBmhmaAgG2QNACAGQYCA56N8NgIEIAcgFbI4AgQgC0IA/R4BIQsLIAv9HQAgC/0dAYRQDQMLAkACQCALICIgICAQ/fEB/ewBICEgDv3xAf3sAf3wASIjIBL9Sf1SIiT9HQAiJSAk/R0BIiaEUA0AIAQgHGshACAFIBxrIQMCQCAlUA0AIAwNACACQQFqIQIgI/0hACEaICD9IQAhGCAh/SEAIRYgACEMIAMhFAsgJlANACAoDQAgAkEBaiECICP9IQEhGyAg/SEBIRkgIf0hASEXDAELICghACAVIQMLAkAgBSAdRg0AIAMhFQwBCyADIRUgBCEdIAUhHCAgIRAgISEOCyAEQQJqIQQgBSABTiEDIA0gBUEBaiIFakEBRw0ACwsgA0EBcUUNFAsCQCAL/R0AUA0AIAZBgIDno3w2AgACQCAIRAAAAAAAAAAAZEUNACAHQQA2AgAgC/0dAVBFDREMFQsgC/0dAVANFAwSCyAL/R0BUA0TIAZBgIDno3w2AgQgCEQAAAAAAAAAAGQNEAwTCwJAAkAgAUEBTg0A/Qz/////////////////////IQsMAQsgAkEIaiAC/V0DAP1XAwABIg4gDv3yASETIANBCGogA/1dAwD9VwMAASIQIBD98gEhHyAI/RQhEv0MAAAAAAAAAAAAAAAAAAAAACEP/Qz/////////////////////IQtBACEFQQIhA0EAIRRBACEVQQAhMEEAIShEAAAAAAAAAAAhFkQAAAAAAAAAACEXRAAAAAAAAAAAIRhEAAAAAAAAAAAhGUQAAAAAAAAAACEaRAAAAAAAAAAAIRtBACEAQQAhDEEBIQRBACENQQEhHP0MAAAAAAAA8D8AAAAAAADwPyIeIREgECEhIA4hIANAICAgEf3yASAhIA/98gH98QEiJCAk/fABISQgICAP/fIBICEgEf3yAf3wASEPAkACQCAEQQpuQQpsQX9qIAUiAkcNACATIB/98QEgIf0MAAAAAAAAEEAAAAAAAAAQQP3yASAg/fIB/ewB/fIBISEgHyAT/QwAAAAAAAAYwAAAAAAAABjA/fIB/fABIB/98gEhICATIBP98gEhEwwBCyAh/QwAAAAAAAAQQAAAAAAAABBA/fIBIBMgH/3xAf3yASAg/fIBISEgEyAf/QwAAAAAAAAYwAAAAAAAABjA/fIB/fABIBP98gEhICAfIB/98gEhEwsgJCAe/fABIREgDyAP/fABIQ8gAkEBaiEFAkACQCAL/QwAAAAAAAAAAAAAAAAAAAAAIiIgISAJ/fABIiEgIf3yASIfIBMgCv3wASAg/fABIiAgIP3yASIT/fABIiP9DAAAAACAhC5BAAAAAICELkH9Sv1SIiT9HQAiJSAk/R0BIiaEUA0AIAWyIScCQCAlUA0AIAYgJyAj/SEAtrwiHbNDAAAANJRDd3P4wpIgHUH///8DcUGAgID4A3K+IilDdb+/v5SSQ6Pp3L8gKUP5RLQ+kpWSQwAAAD+UvCIds0MAAAA0lEN3c/jCkiAdQf///wNxQYCAgPgDcr4iKUN1v7+/lJJDo+ncvyApQ/lEtD6SlZJDAAAAP5STOAIAIAcgD/0hACIqICH9IQAiK6IgEf0hACIsICD9IQAiLaKgICogKqIgLCAsoqAiLqMiLyAsICuiICogLaKhIC6jIiqgRAAAAGCeoOY/oiAvIC+iICogKqKgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCAAsCQCAmUA0AIAYgJyAj/SEBtrwiHbNDAAAANJRDd3P4wpIgHUH///8DcUGAgID4A3K+IilDdb+/v5SSQ6Pp3L8gKUP5RLQ+kpWSQwAAAD+UvCIds0MAAAA0lEN3c/jCkiAdQf///wNxQYCAgPgDcr4iKUN1v7+/lJJDo+ncvyApQ/lEtD6SlZJDAAAAP5STOAIEIAcgD/0hASIqICH9IQEiK6IgEf0hASIsICD9IQEiLaKgICogKqIgLCAsoqAiLqMiLyAsICuiICogLaKhIC6jIiqgRAAAAGCeoOY/oiAvIC+iICogKqKgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCBAsgJCAL/VEiC/0dACAL/R0BhFANAQsCQCAIRAAAAAAAAAAAZQ0AAkACQCANDQAgFSEdQQAhDQwBCwJAIAUgFEcNACANQX9qIQ1BACEUIAv9HQBQDQAgIP0hACAWoZkgIf0hACAYoZmgIBpkDQAgBkGAgOejfDYCACAHIDCyOAIAIAtCAP0eACELCwJAAkAgBSAVRg0AIBUhHQwBCyANQX9qIQ1BACEdIAv9HQFQDQAgIP0hASAXoZkgIf0hASAZoZmgIBtkDQAgBkGAgOejfDYCBCAHICiyOAIEIAtCAP0eASELCyAL/R0AIAv9HQGEUA0CCwJAAkAgCyAiICEgEP3xAf3sASAgIA798QH97AH98AEiIyAS/Un9UiIk/R0AIiUgJP0dASImhFANACADIAxrIRUgAiAMa0EBaiECAkAgJVANACAUDQAgDUEBaiENICP9IQAhGiAh/SEAIRggIP0hACEWIBUhFCACITALICZQDQAgHQ0AIA1BAWohDSAj/SEBIRsgIf0hASEZICD9IQEhFwwBCyAdIRUgKCECCwJAIAUgHEYNACACISgMAQsgAiEoIAMhHCAFIQwgISEQICAhDgsgA0ECaiEDIAUgAU4hACAEQQFqIQQgASAFRw0BCwsgAEEBcUUNEwsCQCAL/R0AUA0AIAZBgIDno3w2AgACQCAIRAAAAAAAAAAAZEUNACAHQQA2AgAgC/0dAVBFDRAMFAsgC/0dAVBFDREMEwsgC/0dAVANEiAGQYCA56N8NgIEIAhEAAAAAAAAAABkRQ0SDA8LAkACQCABQQFODQD9DP////////////////////8hCwwBCyACQQhqIAL9XQMA/VcDAAEiDiAO/fIBIREgA0EIaiAD/V0DAP1XAwABIhAgEP3yASEPIAj9FCES/QwAAAAAAAAAAAAAAAAAAAAAIRP9DP////////////////////8hC0EAIQVBAiEDQQAhFEEAIRVBACEwQQAhKEQAAAAAAAAAACEWRAAAAAAAAAAAIRdEAAAAAAAAAAAhGEQAAAAAAAAAACEZRAAAAAAAAAAAIRpEAAAAAAAAAAAhG0EAIQBBACEMQQEhBEEAIQ1BASEc/QwAAAAAAADwPwAAAAAAAPA/Ih4hHyAQISEgDiEgA0AgESERICAgH/3yASAhIBP98gH98QEiJCAk/fABISQgICAT/fIBICEgH/3yAf3wASETAkACQCAEQQpuQQpsQX9qIAUiAkcNACARIA/9DAAAAAAAAAjAAAAAAAAACMD98gH98AEgIP3sAf3yASEgICH97AEhIQwBCyAgIBEgD/0MAAAAAAAACMAAAAAAAAAIwP3yAf3wAf3yASEgCyAkIB798AEhHyATIBP98AEhEyACQQFqIQUCQAJAIAv9DAAAAAAAAAAAAAAAAAAAAAAiIiAhIBH9DAAAAAAAAAhAAAAAAAAACED98gEgD/3xAf3yASAJ/fABIiEgIf3yASIPICAgCv3wASIgICD98gEiEf3wASIj/QwAAAAAgIQuQQAAAACAhC5B/Ur9UiIk/R0AIiUgJP0dASImhFANACAFsiEnAkAgJVANACAGICcgI/0hALa8Ih2zQwAAADSUQ3dz+MKSIB1B////A3FBgICA+ANyviIpQ3W/v7+UkkOj6dy/IClD+US0PpKVkkMAAAA/lLwiHbNDAAAANJRDd3P4wpIgHUH///8DcUGAgID4A3K+IilDdb+/v5SSQ6Pp3L8gKUP5RLQ+kpWSQ52EIb+UkjgCACAHIBP9IQAiKiAh/SEAIiuiIB/9IQAiLCAg/SEAIi2ioCAqICqiICwgLKKgIi6jIi8gLCAroiAqIC2ioSAuoyIqoEQAAABgnqDmP6IgLyAvoiAqICqioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgALAkAgJlANACAGICcgI/0hAba8Ih2zQwAAADSUQ3dz+MKSIB1B////A3FBgICA+ANyviIpQ3W/v7+UkkOj6dy/IClD+US0PpKVkkMAAAA/lLwiHbNDAAAANJRDd3P4wpIgHUH///8DcUGAgID4A3K+IilDdb+/v5SSQ6Pp3L8gKUP5RLQ+kpWSQ52EIb+UkjgCBCAHIBP9IQEiKiAh/SEBIiuiIB/9IQEiLCAg/SEBIi2ioCAqICqiICwgLKKgIi6jIi8gLCAroiAqIC2ioSAuoyIqoEQAAABgnqDmP6IgLyAvoiAqICqioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgQLICQgC/1RIgv9HQAgC/0dAYRQDQELAkAgCEQAAAAAAAAAAGUNAAJAAkAgDQ0AIBUhHUEAIQ0MAQsCQCAFIBRHDQAgDUF/aiENQQAhFCAL/R0AUA0AICD9IQAgFqGZICH9IQAgGKGZoCAaZA0AIAZBgIDno3w2AgAgByAwsjgCACALQgD9HgAhCwsCQAJAIAUgFUYNACAVIR0MAQsgDUF/aiENQQAhHSAL/R0BUA0AICD9IQEgF6GZICH9IQEgGaGZoCAbZA0AIAZBgIDno3w2AgQgByAosjgCBCALQgD9HgEhCwsgC/0dACAL/R0BhFANAgsCQAJAIAsgIiAhIBD98QH97AEgICAO/fEB/ewB/fABIiMgEv1J/VIiJP0dACIlICT9HQEiJoRQDQAgAyAMayEVIAIgDGtBAWohAgJAICVQDQAgFA0AIA1BAWohDSAj/SEAIRogIf0hACEYICD9IQAhFiAVIRQgAiEwCyAmUA0AIB0NACANQQFqIQ0gI/0hASEbICH9IQEhGSAg/SEBIRcMAQsgHSEVICghAgsCQCAFIBxGDQAgAiEoDAELIAIhKCADIRwgBSEMICEhECAgIQ4LIANBAmohAyAFIAFOIQAgBEEBaiEEIAEgBUcNAQsLIABBAXFFDRILAkAgC/0dAFANACAGQYCA56N8NgIAAkAgCEQAAAAAAAAAAGRFDQAgB0EANgIAIAv9HQFQDRMMDwsgC/0dAVBFDRAMEgsgC/0dAVANESAGQYCA56N8NgIEIAhEAAAAAAAAAABkDQ4MEQsCQAJAIAFBAU4NAP0M/////////////////////yELDAELIAJBCGogAv1dAwD9VwMAASIOIA798gEhDyADQQhqIAP9XQMA/VcDAAEiECAQ/fIBIREgCP0UIRL9DAAAAAAAAAAAAAAAAAAAAAAhE/0M/////////////////////yELQQAhBUECIQNBACEUQQAhFUEAITBBACEoRAAAAAAAAAAAIRZEAAAAAAAAAAAhF0QAAAAAAAAAACEYRAAAAAAAAAAAIRlEAAAAAAAAAAAhGkQAAAAAAAAAACEbQQAhAEEAIQxBASEEQQAhDUEBIRz9DAAAAAAAAPA/AAAAAAAA8D8iHiEfIBAhICAOISECQANAIBEhJCAhIiEgHyIR/fIBICAiICAT/fIB/fEBIh8gH/3wASAe/fABIR8gISAT/fIBICAgEf3yAf3wASITIBP98AEhEyAFIgJBAWohBQJAIAv9DAAAAAAAAAAAAAAAAAAAAAAiIiAgICEgIf3wAf3yASIh/ewBICEgAiAEQQpuQQpsQX9qRhsgCf3wASIgICD98gEiESAPICT98QEgCv3wASIhICH98gEiD/3wASIj/QwAAAAAgIQuQQAAAACAhC5B/Ur9UiIk/R0AIiUgJP0dASImhFANACAFskN3c/hCkiEnAkAgJVANACAGICcgI/0hALa8Ih2zQwAAADSUQ3dz+MKSIB1B////A3FBgICA+ANyviIpQ3W/v7+UkkOj6dy/IClD+US0PpKVkkMAAAA/lLwiHbNDAAAAtJSSIB1B////A3FBgICA+ANyviIpQ3W/vz+UkkOj6dw/IClD+US0PpKVkjgCACAHIBP9IQAiKiAg/SEAIiuiIB/9IQAiLCAh/SEAIi2ioCAqICqiICwgLKKgIi6jIi8gLCAroiAqIC2ioSAuoyIqoEQAAABgnqDmP6IgLyAvoiAqICqioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgALAkAgJlANACAGICcgI/0hAba8Ih2zQwAAADSUQ3dz+MKSIB1B////A3FBgICA+ANyviIpQ3W/v7+UkkOj6dy/IClD+US0PpKVkkMAAAA/lLwiHbNDAAAAtJSSIB1B////A3FBgICA+ANyviInQ3W/vz+UkkOj6dw/ICdD+US0PpKVkjgCBCAHIBP9IQEiKiAg/SEBIiuiIB/9IQEiLCAh/SEBIi2ioCAqICqiICwgLKKgIi6jIi8gLCAroiAqIC2ioSAuoyIqoEQAAABgnqDmP6IgLyAvoiAqICqioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgQLICQgC/1RIgv9HQAgC/0dAYRQDQILAkAgCEQAAAAAAAAAAGUNAAJAAkAgDQ0AIBUhHUEAIQ0MAQsCQCAFIBRHDQAgDUF/aiENQQAhFCAL/R0AUA0AICH9IQAgFqGZICD9IQAgGKGZoCAaZA0AIAZBgIDno3w2AgAgByAwsjgCACALQgD9HgAhCwsCQAJAIAUgFUYNACAVIR0MAQsgDUF/aiENQQAhHSAL/R0BUA0AICH9IQEgF6GZICD9IQEgGaGZoCAbZA0AIAZBgIDno3w2AgQgByAosjgCBCALQgD9HgEhCwsgC/0dACAL/R0BhFANAwsCQAJAIAsgIiAgIBD98QH97AEgISAO/fEB/ewB/fABIiMgEv1J/VIiJP0dACIlICT9HQEiJoRQDQAgAyAMayEVIAIgDGtBAWohAgJAICVQDQAgFA0AIA1BAWohDSAj/SEAIRogIP0hACEYICH9IQAhFiAVIRQgAiEwCyAmUA0AIB0NACANQQFqIQ0gI/0hASEbICD9IQEhGSAh/SEBIRcMAQsgHSEVICghAgsCQCAFIBxGDQAgAiEoDAELIAIhKCADIRwgBSEMICAhECAhIQ4LIANBAmohAyAFIAFOIQAgBEEBaiEEIAEgBUcNAAsLIABBAXFFDRELAkAgC/0dAFANACAGQYCA56N8NgIAAkAgCEQAAAAAAAAAAGRFDQAgB0EANgIAIAv9HQFQRQ0ODBILIAv9HQFQRQ0PDBELIAv9HQFQDRAgBkGAgOejfDYCBCAIRAAAAAAAAAAAZA0NDBALAkACQCABQQFODQD9DP////////////////////8hCwwBC0EAIQxBACABayENIAJBCGogAv1dAwD9VwMAASIOIA798gEhDyADQQhqIAP9XQMA/VcDAAEiECAQ/fIBIREgCP0UIRL9DAAAAAAAAAAAAAAAAAAAAAAhE/0M/////////////////////yELQQIhBEEAIQBBACEUQQAhFUQAAAAAAAAAACEWRAAAAAAAAAAAIRdEAAAAAAAAAAAhGEQAAAAAAAAAACEZRAAAAAAAAAAAIRpEAAAAAAAAAAAhG0EAIQNBACEcQQEhBUEAIQJBASEd/QwAAAAAAADwPwAAAAAAAPA/Ih4hHyAQISAgDiEhAkADQCAPIBH98QEhDyAhIiEgHyIR/fIBICAiICAT/fIB/fEBIh8gH/3wASAe/fABIR8gISAT/fIBICAgEf3yAf3wASITIBP98AEhEwJAIAv9DAAAAAAAAAAAAAAAAAAAAAAiIiAJICAgISAh/fAB/fIB/fEBIiAgIP3yASIRIA8gCv3wASIhICH98gEiD/3wASIj/QwAAAAAgIQuQQAAAACAhC5B/Ur9UiIk/R0AIiUgJP0dASImhFANACAFskN3c/hCkiEnAkAgJVANACAGICcgI/0hALa8IiizQwAAADSUQ3dz+MKSIChB////A3FBgICA+ANyviIpQ3W/v7+UkkOj6dy/IClD+US0PpKVkkMAAAA/lLwiKLNDAAAAtJSSIChB////A3FBgICA+ANyviIpQ3W/vz+UkkOj6dw/IClD+US0PpKVkjgCACAHIBP9IQAiKiAg/SEAIiuiIB/9IQAiLCAh/SEAIi2ioCAqICqiICwgLKKgIi6jIi8gLCAroiAqIC2ioSAuoyIqoEQAAABgnqDmP6IgLyAvoiAqICqioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgALAkAgJlANACAGICcgI/0hAba8IiizQwAAADSUQ3dz+MKSIChB////A3FBgICA+ANyviIpQ3W/v7+UkkOj6dy/IClD+US0PpKVkkMAAAA/lLwiKLNDAAAAtJSSIChB////A3FBgICA+ANyviInQ3W/vz+UkkOj6dw/ICdD+US0PpKVkjgCBCAHIBP9IQEiKiAg/SEBIiuiIB/9IQEiLCAh/SEBIi2ioCAqICqiICwgLKKgIi6jIi8gLCAroiAqIC2ioSAuoyIqoEQAAABgnqDmP6IgLyAvoiAqICqioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgQLICQgC/1RIgv9HQAgC/0dAYRQDQILAkAgCEQAAAAAAAAAAGUNAAJAAkAgAg0AIAAhKEEAIQIMAQsCQCAFIAxHDQAgAkF/aiECQQAhDCAL/R0AUA0AICH9IQAgFqGZICD9IQAgGKGZoCAaZA0AIAZBgIDno3w2AgAgByAUsjgCACALQgD9HgAhCwsCQAJAIAUgAEYNACAAISgMAQsgAkF/aiECQQAhKCAL/R0BUA0AICH9IQEgF6GZICD9IQEgGaGZoCAbZA0AIAZBgIDno3w2AgQgByAVsjgCBCALQgD9HgEhCwsgC/0dACAL/R0BhFANAwsCQAJAIAsgIiAgIBD98QH97AEgISAO/fEB/ewB/fABIiMgEv1J/VIiJP0dACIlICT9HQEiJoRQDQAgBCAcayEAIAUgHGshAwJAICVQDQAgDA0AIAJBAWohAiAj/SEAIRogIP0hACEYICH9IQAhFiAAIQwgAyEUCyAmUA0AICgNACACQQFqIQIgI/0hASEbICD9IQEhGSAh/SEBIRcMAQsgKCEAIBUhAwsCQCAFIB1GDQAgAyEVDAELIAMhFSAEIR0gBSEcICAhECAhIQ4LIARBAmohBCAFIAFOIQMgDSAFQQFqIgVqQQFHDQALCyADQQFxRQ0QCwJAIAv9HQBQDQAgBkGAgOejfDYCAAJAIAhEAAAAAAAAAABkRQ0AIAdBADYCACAL/R0BUEUNDQwRCyAL/R0BUEUNDgwQCyAL/R0BUA0PIAZBgIDno3w2AgQgCEQAAAAAAAAAAGQNDAwPCwJAAkAgAUEBTg0A/Qz/////////////////////ISIMAQtBACEMQQAgAWshDSACQQhqIAL9XQMA/VcDAAEiDiAO/fIBIREgA0EIaiAD/V0DAP1XAwABIhAgEP3yASEkIAj9FCES/QwAAAAAAAAAAAAAAAAAAAAAIRP9DP////////////////////8hIkECIQRBACEAQQAhFEEAIRVEAAAAAAAAAAAhFkQAAAAAAAAAACEXRAAAAAAAAAAAIRhEAAAAAAAAAAAhGUQAAAAAAAAAACEaRAAAAAAAAAAAIRtBACEDQQAhHEEBIQVBACECQQEhHf0MAAAAAAAA8D8AAAAAAADwPyIjIQ8gECEhIA4hIAJAA0AgJCAgIiD97AEiH/3wASELICAgDyIk/fIBICEiISAT/fIB/fEBIg8gD/3wASAj/fABIQ8gICAT/fIBICEgJP3yAf3wASIgICD98AEhEwJAICL9DAAAAAAAAAAAAAAAAAAAAAAiHiAh/ewBIiEgHyAf/fAB/fIBICH98QEgCf3wASIhICH98gEiJCAKIBH98AEgC/3xASIgICD98gEiEf3wASIL/QwAAAAAgIQuQQAAAACAhC5B/Ur9UiIf/R0AIiUgH/0dASImhFANACAFskN3c/hCkiEnAkAgJVANACAGICcgC/0hALa8IiizQwAAADSUQ3dz+MKSIChB////A3FBgICA+ANyviIpQ3W/v7+UkkOj6dy/IClD+US0PpKVkkMAAAA/lLwiKLNDAAAAtJSSIChB////A3FBgICA+ANyviIpQ3W/vz+UkkOj6dw/IClD+US0PpKVkjgCACAHIBP9IQAiKiAh/SEAIiuiIA/9IQAiLCAg/SEAIi2ioCAqICqiICwgLKKgIi6jIi8gLCAroiAqIC2ioSAuoyIqoEQAAABgnqDmP6IgLyAvoiAqICqioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgALAkAgJlANACAGICcgC/0hAba8IiizQwAAADSUQ3dz+MKSIChB////A3FBgICA+ANyviIpQ3W/v7+UkkOj6dy/IClD+US0PpKVkkMAAAA/lLwiKLNDAAAAtJSSIChB////A3FBgICA+ANyviInQ3W/vz+UkkOj6dw/ICdD+US0PpKVkjgCBCAHIBP9IQEiKiAh/SEBIiuiIA/9IQEiLCAg/SEBIi2ioCAqICqiICwgLKKgIi6jIi8gLCAroiAqIC2ioSAuoyIqoEQAAABgnqDmP6IgLyAvoiAqICqioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgQLIB8gIv1RIiL9HQAgIv0dAYRQDQILAkAgCEQAAAAAAAAAAGUNAAJAAkAgAg0AIAAhKEEAIQIMAQsCQCAFIAxHDQAgAkF/aiECQQAhDCAi/R0AUA0AICD9IQAgFqGZICH9IQAgGKGZoCAaZA0AIAZBgIDno3w2AgAgByAUsjgCACAiQgD9HgAhIgsCQAJAIAUgAEYNACAAISgMAQsgAkF/aiECQQAhKCAi/R0BUA0AICD9IQEgF6GZICH9IQEgGaGZoCAbZA0AIAZBgIDno3w2AgQgByAVsjgCBCAiQgD9HgEhIgsgIv0dACAi/R0BhFANAwsCQAJAICIgHiAhIBD98QH97AEgICAO/fEB/ewB/fABIgsgEv1J/VIiH/0dACIlIB/9HQEiJoRQDQAgBCAcayEAIAUgHGshAwJAICVQDQAgDA0AIAJBAWohAiAL/SEAIRogIf0hACEYICD9IQAhFiAAIQwgAyEUCyAmUA0AICgNACACQQFqIQIgC/0hASEbICH9IQEhGSAg/SEBIRcMAQsgKCEAIBUhAwsCQCAFIB1GDQAgAyEVDAELIAMhFSAEIR0gBSEcICEhECAgIQ4LIARBAmohBCAFIAFOIQMgDSAFQQFqIgVqQQFHDQALCyADQQFxRQ0PCwJAICL9HQBQDQAgBkGAgOejfDYCAAJAIAhEAAAAAAAAAABkRQ0AIAdBADYCACAi/R0BUEUNDAwQCyAi/R0BUEUNDQwPCyAi/R0BUA0OIAZBgIDno3w2AgQgCEQAAAAAAAAAAGQNCwwOCwJAAkAgAUEBTg0A/Qz/////////////////////IQsMAQtBACEUQQAgAWshFSACQQhqIAL9XQMA/VcDAAEiICAg/fIBIQ8gCP0UIRD9DAAAAAAAAAAAAAAAAAAAAAAhE/0M/////////////////////yELQQIhBEEAIQ1BACEwQQAhKEQAAAAAAAAAACEWRAAAAAAAAAAAIRdEAAAAAAAAAAAhGEQAAAAAAAAAACEZRAAAAAAAAAAAIRpEAAAAAAAAAAAhG0EAIQJBACEMQQEhBUEAIQBBASEc/QwAAAAAAADwPwAAAAAAAPA/IiIhHyADQQhqIAP9XQMA/VcDAAH97QEiIyEhICD97AEiDiEgAkADQCAhIiH9DAAAAAAAAADAAAAAAAAAAMD98gEgIP3yASERIB8iJCAg/fIBICEgE/3yAf3xASIfIB/98AEgIv3wASEfIBMgIP3yASAhICT98gH98AEiICAg/fABIRMgDyAK/fABICEgIf3yAf3xASIh/ewBISACQCAL/QwAAAAAAAAAAAAAAAAAAAAAIiQgISAh/fIBIg8gESAJ/fEBIiEgIf3yAf3wASIe/QwAAAAAgIQuQQAAAACAhC5B/Ur9UiIR/R0AIiUgEf0dASImhFANACAFskN3c/hCkiEnAkAgJVANACAGICcgHv0hALa8IgOzQwAAADSUQ3dz+MKSIANB////A3FBgICA+ANyviIpQ3W/v7+UkkOj6dy/IClD+US0PpKVkkMAAAA/lLwiA7NDAAAAtJSSIANB////A3FBgICA+ANyviIpQ3W/vz+UkkOj6dw/IClD+US0PpKVkjgCACAHIBP9IQAiKiAh/SEAIiuiIB/9IQAiLCAg/SEAIi2ioCAqICqiICwgLKKgIi6jIi8gLCAroiAqIC2ioSAuoyIqoEQAAABgnqDmP6IgLyAvoiAqICqioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgALAkAgJlANACAGICcgHv0hAba8IgOzQwAAADSUQ3dz+MKSIANB////A3FBgICA+ANyviIpQ3W/v7+UkkOj6dy/IClD+US0PpKVkkMAAAA/lLwiA7NDAAAAtJSSIANB////A3FBgICA+ANyviInQ3W/vz+UkkOj6dw/ICdD+US0PpKVkjgCBCAHIBP9IQEiKiAh/SEBIiuiIB/9IQEiLCAg/SEBIi2ioCAqICqiICwgLKKgIi6jIi8gLCAroiAqIC2ioSAuoyIqoEQAAABgnqDmP6IgLyAvoiAqICqioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgQLIBEgC/1RIgv9HQAgC/0dAYRQDQILAkAgCEQAAAAAAAAAAGUNAAJAAkAgAA0AIA0hHUEAIQAMAQsCQCAFIBRHDQAgAEF/aiEAQQAhFCAL/R0AUA0AICD9IQAgFqGZICH9IQAgGKGZoCAaZA0AIAZBgIDno3w2AgAgByAwsjgCACALQgD9HgAhCwsCQAJAIAUgDUYNACANIR0MAQsgAEF/aiEAQQAhHSAL/R0BUA0AICD9IQEgF6GZICH9IQEgGaGZoCAbZA0AIAZBgIDno3w2AgQgByAosjgCBCALQgD9HgEhCwsgC/0dACAL/R0BhFANAwsCQAJAIAsgJCAgIA798QH97AEgISAj/fEB/ewB/fABIh4gEP1J/VIiEf0dACIlIBH9HQEiJoRQDQAgBCAMayENIAUgDGshAwJAICVQDQAgFA0AIABBAWohACAe/SEAIRogIf0hACEYICD9IQAhFiANIRQgAyEwCyAmUA0AIB0NACAAQQFqIQAgHv0hASEbICH9IQEhGSAg/SEBIRcMAQsgHSENICghAwsCQCAFIBxGDQAgAyEoDAELIAMhKCAEIRwgBSEMICEhIyAgIQ4LIARBAmohBCAFIAFOIQIgFSAFQQFqIgVqQQFHDQALCyACQQFxRQ0OCwJAIAv9HQBQDQAgBkGAgOejfDYCAAJAIAhEAAAAAAAAAABkRQ0AIAdBADYCACAL/R0BUEUNCwwPCyAL/R0BUEUNDAwOCyAL/R0BUA0NIAZBgIDno3w2AgQgCEQAAAAAAAAAAGQNCgwNCwJAAkAgAUEBTg0A/Qz/////////////////////IQsMAQtBACEMQQAgAWshDSACQQhqIAL9XQMA/VcDAAEiDiAO/fIBIREgA0EIaiAD/V0DAP1XAwABIhAgEP3yASEkIAj9FCES/QwAAAAAAAAAAAAAAAAAAAAAIR/9DP////////////////////8hC0ECIQRBACEAQQAhFEEAIRVEAAAAAAAAAAAhFkQAAAAAAAAAACEXRAAAAAAAAAAAIRhEAAAAAAAAAAAhGUQAAAAAAAAAACEaRAAAAAAAAAAAIRtBACEDQQAhHEEBIQVBACECQQEhHf0MAAAAAAAA8D8AAAAAAADwPyIeIQ8gECEgIA4hEwJAA0AgEyIhIA8iE/3yASAgIiAgH/3yAf3xASIPIA/98AEgHv3wASEPICEgH/3yASAgIBP98gH98AEiEyAT/fABIR8CQCAL/QwAAAAAAAAAAAAAAAAAAAAAIiIgCiARICT98QH97AH98AEiEyAT/fIBIhEgICAhICH98AH98gEgCf3wASIgICD98gEiJP3wASIj/QwAAAAAgIQuQQAAAACAhC5B/Ur9UiIh/R0AIiUgIf0dASImhFANACAFskN3c/hCkiEnAkAgJVANACAGICcgI/0hALa8IiizQwAAADSUQ3dz+MKSIChB////A3FBgICA+ANyviIpQ3W/v7+UkkOj6dy/IClD+US0PpKVkkMAAAA/lLwiKLNDAAAAtJSSIChB////A3FBgICA+ANyviIpQ3W/vz+UkkOj6dw/IClD+US0PpKVkjgCACAHIB/9IQAiKiAg/SEAIiuiIA/9IQAiLCAT/SEAIi2ioCAqICqiICwgLKKgIi6jIi8gLCAroiAqIC2ioSAuoyIqoEQAAABgnqDmP6IgLyAvoiAqICqioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgALAkAgJlANACAGICcgI/0hAba8IiizQwAAADSUQ3dz+MKSIChB////A3FBgICA+ANyviIpQ3W/v7+UkkOj6dy/IClD+US0PpKVkkMAAAA/lLwiKLNDAAAAtJSSIChB////A3FBgICA+ANyviInQ3W/vz+UkkOj6dw/ICdD+US0PpKVkjgCBCAHIB/9IQEiKiAg/SEBIiuiIA/9IQEiLCAT/SEBIi2ioCAqICqiICwgLKKgIi6jIi8gLCAroiAqIC2ioSAuoyIqoEQAAABgnqDmP6IgLyAvoiAqICqioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgQLICEgC/1RIgv9HQAgC/0dAYRQDQILAkAgCEQAAAAAAAAAAGUNAAJAAkAgAg0AIAAhKEEAIQIMAQsCQCAFIAxHDQAgAkF/aiECQQAhDCAL/R0AUA0AIBP9IQAgFqGZICD9IQAgGKGZoCAaZA0AIAZBgIDno3w2AgAgByAUsjgCACALQgD9HgAhCwsCQAJAIAUgAEYNACAAISgMAQsgAkF/aiECQQAhKCAL/R0BUA0AIBP9IQEgF6GZICD9IQEgGaGZoCAbZA0AIAZBgIDno3w2AgQgByAVsjgCBCALQgD9HgEhCwsgC/0dACAL/R0BhFANAwsCQAJAIAsgIiATIA798QH97AEgICAQ/fEB/ewB/fABIiMgEv1J/VIiIf0dACIlICH9HQEiJoRQDQAgBCAcayEAIAUgHGshAwJAICVQDQAgDA0AIAJBAWohAiAj/SEAIRogIP0hACEYIBP9IQAhFiAAIQwgAyEUCyAmUA0AICgNACACQQFqIQIgI/0hASEbICD9IQEhGSAT/SEBIRcMAQsgKCEAIBUhAwsCQCAFIB1GDQAgAyEVDAELIAMhFSAEIR0gBSEcICAhECATIQ4LIARBAmohBCAFIAFOIQMgDSAFQQFqIgVqQQFHDQALCyADQQFxRQ0NCwJAIAv9HQBQDQAgBkGAgOejfDYCAAJAIAhEAAAAAAAAAABkRQ0AIAdBADYCACAL/R0BUEUNCgwOCyAL/R0BUEUNCwwNCyAL/R0BUA0MIAZBgIDno3w2AgQgCEQAAAAAAAAAAGQNCQwMCwJAAkAgAUEBTg0A/Qz/////////////////////IQ4MAQtBACEMQQAgAWshDSACQQhqIAL9XQMA/VcDAAEiEiAS/fIBISAgA0EIaiAD/V0DAP1XAwABIjEgMf3yASEhIAj9FCEy/QwAAAAAAAAAAAAAAAAAAAAAIQ/9DP////////////////////8hDkECIQRBACEAQQAhFEEAIRVEAAAAAAAAAAAhFkQAAAAAAAAAACEXRAAAAAAAAAAAIRhEAAAAAAAAAAAhGUQAAAAAAAAAACEaRAAAAAAAAAAAIRtBACEDQQAhHEEBIQVBACECQQEhHf0MAAAAAAAA8D8AAAAAAADwPyIQIREgMSETIBIhHwJAA0AgISAgIiD9DAAAAAAAABjAAAAAAAAAGMD98gH98AEgIf3yASEkIB8iHyAP/fIBIBMiEyAR/fIB/fABIgsgICAh/fEBIiL9DAAAAAAAABBAAAAAAAAAEEAiHv3yASIj/fIBIB8gE/3yASIh/QwAAAAAAAAgQAAAAAAAACBA/fIBIB8gEf3yASATIA/98gH98QEiE/3yAf3wASEPIBMgI/3yASAQ/fABICH9DAAAAAAAACDAAAAAAAAAIMD98gEgC/3yAf3wASERAkAgDv0MAAAAAAAAAAAAAAAAAAAAACILICIgISAe/fIB/ewB/fIBIAn98AEiEyAT/fIBIiEgJCAgICD98gEgCv3wAf3wASIfIB/98gEiIP3wASIi/QwAAAAAgIQuQQAAAACAhC5B/Ur9UiIk/R0AIiUgJP0dASImhFANACAFsiEnAkAgJVANACAGICcgIv0hALa8IiizQwAAADSUQ3dz+MKSIChB////A3FBgICA+ANyviIpQ3W/v7+UkkOj6dy/IClD+US0PpKVkkMAAAA/lLwiKLNDAAAANJRDd3P4wpIgKEH///8DcUGAgID4A3K+IilDdb+/v5SSQ6Pp3L8gKUP5RLQ+kpWSQwAAAD+UkzgCACAHIA/9IQAiKiAT/SEAIiuiIBH9IQAiLCAf/SEAIi2ioCAqICqiICwgLKKgIi6jIi8gLCAroiAqIC2ioSAuoyIqoEQAAABgnqDmP6IgLyAvoiAqICqioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgALAkAgJlANACAGICcgIv0hAba8IiizQwAAADSUQ3dz+MKSIChB////A3FBgICA+ANyviIpQ3W/v7+UkkOj6dy/IClD+US0PpKVkkMAAAA/lLwiKLNDAAAANJRDd3P4wpIgKEH///8DcUGAgID4A3K+IilDdb+/v5SSQ6Pp3L8gKUP5RLQ+kpWSQwAAAD+UkzgCBCAHIA/9IQEiKiAT/SEBIiuiIBH9IQEiLCAf/SEBIi2ioCAqICqiICwgLKKgIi6jIi8gLCAroiAqIC2ioSAuoyIqoEQAAABgnqDmP6IgLyAvoiAqICqioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgQLICQgDv1RIg79HQAgDv0dAYRQDQILAkAgCEQAAAAAAAAAAGUNAAJAAkAgAg0AIAAhKEEAIQIMAQsCQCAFIAxHDQAgAkF/aiECQQAhDCAO/R0AUA0AIB/9IQAgFqGZIBP9IQAgGKGZoCAaZA0AIAZBgIDno3w2AgAgByAUsjgCACAOQgD9HgAhDgsCQAJAIAUgAEYNACAAISgMAQsgAkF/aiECQQAhKCAO/R0BUA0AIB/9IQEgF6GZIBP9IQEgGaGZoCAbZA0AIAZBgIDno3w2AgQgByAVsjgCBCAOQgD9HgEhDgsgDv0dACAO/R0BhFANAwsCQAJAIA4gCyATIDH98QH97AEgHyAS/fEB/ewB/fABIiIgMv1J/VIiJP0dACIlICT9HQEiJoRQDQAgBCAcayEAIAUgHGshAwJAICVQDQAgDA0AIAJBAWohAiAi/SEAIRogE/0hACEYIB/9IQAhFiAAIQwgAyEUCyAmUA0AICgNACACQQFqIQIgIv0hASEbIBP9IQEhGSAf/SEBIRcMAQsgKCEAIBUhAwsCQCAFIB1GDQAgAyEVDAELIAMhFSAEIR0gBSEcIBMhMSAfIRILIARBAmohBCAFIAFOIQMgDSAFQQFqIgVqQQFHDQALCyADQQFxRQ0MCwJAIA79HQBQDQAgBkGAgOejfDYCAAJAIAhEAAAAAAAAAABkRQ0AIAdBADYCACAO/R0BUEUNCQwNCyAO/R0BUEUNCgwMCyAO/R0BUA0LIAZBgIDno3w2AgQgCEQAAAAAAAAAAGQNCAwLCwJAAkAgAUEBTg0A/Qz/////////////////////ISMMAQtBACEMQQAgAWshDSACQQhqIAL9XQMA/VcDAAEiECAQ/fIBISQgA0EIaiAD/V0DAP1XAwABIhIgEv3yASEPIAj9FCEx/QwAAAAAAAAAAAAAAAAAAAAAIRH9DP////////////////////8hI0ECIQRBACEAQQAhFEEAIRVEAAAAAAAAAAAhFkQAAAAAAAAAACEXRAAAAAAAAAAAIRhEAAAAAAAAAAAhGUQAAAAAAAAAACEaRAAAAAAAAAAAIRtBACEDQQAhHEEBIQVBACECQQEhHf0MAAAAAAAA8D8AAAAAAADwPyIOIRMgEiEhIBAhIAJAA0AgISILICAiICAg/fAB/fIBIiIgE/3yASAkIh8gDyIP/fEBIiQgESIe/fIB/fAB/QwAAAAAAAAIQAAAAAAAAAhAIiH98gEhESAkIBP98gEgIiAe/fIB/fEBICH98gEgDv3wASETAkAgI/0MAAAAAAAAAAAAAAAAAAAAACIiIB8gDyAh/fIB/fEBICD97AH98gEgCv3wASIgICD98gEiJCAfICH98gEgD/3xASAL/ewB/fIBIAn98AEiISAh/fIBIg/98AEiC/0MAAAAAICELkEAAAAAgIQuQf1K/VIiH/0dACIlIB/9HQEiJoRQDQAgBbIhJwJAICVQDQAgBiAnIAv9IQC2vCIos0MAAAA0lEN3c/jCkiAoQf///wNxQYCAgPgDcr4iKUN1v7+/lJJDo+ncvyApQ/lEtD6SlZJDAAAAP5S8IiizQwAAADSUQ3dz+MKSIChB////A3FBgICA+ANyviIpQ3W/v7+UkkOj6dy/IClD+US0PpKVkkOdhCG/lJI4AgAgByAR/SEAIiogIf0hACIroiAT/SEAIiwgIP0hACItoqAgKiAqoiAsICyioCIuoyIvICwgK6IgKiAtoqEgLqMiKqBEAAAAYJ6g5j+iIC8gL6IgKiAqoqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIACwJAICZQDQAgBiAnIAv9IQG2vCIos0MAAAA0lEN3c/jCkiAoQf///wNxQYCAgPgDcr4iKUN1v7+/lJJDo+ncvyApQ/lEtD6SlZJDAAAAP5S8IiizQwAAADSUQ3dz+MKSIChB////A3FBgICA+ANyviIpQ3W/v7+UkkOj6dy/IClD+US0PpKVkkOdhCG/lJI4AgQgByAR/SEBIiogIf0hASIroiAT/SEBIiwgIP0hASItoqAgKiAqoiAsICyioCIuoyIvICwgK6IgKiAtoqEgLqMiKqBEAAAAYJ6g5j+iIC8gL6IgKiAqoqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIECyAfICP9USIj/R0AICP9HQGEUA0CCwJAIAhEAAAAAAAAAABlDQACQAJAIAINACAAIShBACECDAELAkAgBSAMRw0AIAJBf2ohAkEAIQwgI/0dAFANACAg/SEAIBahmSAh/SEAIBihmaAgGmQNACAGQYCA56N8NgIAIAcgFLI4AgAgI0IA/R4AISMLAkACQCAFIABGDQAgACEoDAELIAJBf2ohAkEAISggI/0dAVANACAg/SEBIBehmSAh/SEBIBmhmaAgG2QNACAGQYCA56N8NgIEIAcgFbI4AgQgI0IA/R4BISMLICP9HQAgI/0dAYRQDQMLAkACQCAjICIgICAQ/fEB/ewBICEgEv3xAf3sAf3wASILIDH9Sf1SIh/9HQAiJSAf/R0BIiaEUA0AIAQgHGshACAFIBxrIQMCQCAlUA0AIAwNACACQQFqIQIgC/0hACEaICH9IQAhGCAg/SEAIRYgACEMIAMhFAsgJlANACAoDQAgAkEBaiECIAv9IQEhGyAh/SEBIRkgIP0hASEXDAELICghACAVIQMLAkAgBSAdRg0AIAMhFQwBCyADIRUgBCEdIAUhHCAhIRIgICEQCyAEQQJqIQQgBSABTiEDIA0gBUEBaiIFakEBRw0ACwsgA0EBcUUNCwsCQCAj/R0AUA0AIAZBgIDno3w2AgACQCAIRAAAAAAAAAAAZEUNACAHQQA2AgAgI/0dAVBFDQgMDAsgI/0dAVBFDQkMCwsgI/0dAVANCiAGQYCA56N8NgIEIAhEAAAAAAAAAABkDQcMCgsCQAJAIAFBAU4NAP0M/////////////////////yELDAELQQAhDEEAIAFrIQ0gAkEIaiAC/V0DAP1XAwABIg4gDv3yASEPIANBCGogA/1dAwD9VwMAASIQIBD98gEhESAI/RQhEv0MAAAAAAAAAAAAAAAAAAAAACET/Qz/////////////////////IQtBAiEEQQAhAEEAIRRBACEVRAAAAAAAAAAAIRZEAAAAAAAAAAAhF0QAAAAAAAAAACEYRAAAAAAAAAAAIRlEAAAAAAAAAAAhGkQAAAAAAAAAACEbQQAhA0EAIRxBASEFQQAhAkEBIR39DAAAAAAAAPA/AAAAAAAA8D8iHiEfIBAhICAOISECQANAIA8gEf3xASEPICEiISAfIhH98gEgICIgIBP98gH98QEiHyAf/fABIB798AEhHyAhIBP98gEgICAR/fIB/fABIhMgE/3wASETAkAgC/0MAAAAAAAAAAAAAAAAAAAAACIiIAkgICAhICH98AH98gH97AH98AEiICAg/fIBIhEgDyAK/fABIiEgIf3yASIP/fABIiP9DAAAAACAhC5BAAAAAICELkH9Sv1SIiT9HQAiJSAk/R0BIiaEUA0AIAWyQ3dz+EKSIScCQCAlUA0AIAYgJyAj/SEAtrwiKLNDAAAANJRDd3P4wpIgKEH///8DcUGAgID4A3K+IilDdb+/v5SSQ6Pp3L8gKUP5RLQ+kpWSQwAAAD+UvCIos0MAAAC0lJIgKEH///8DcUGAgID4A3K+IilDdb+/P5SSQ6Pp3D8gKUP5RLQ+kpWSOAIAIAcgE/0hACIqICD9IQAiK6IgH/0hACIsICH9IQAiLaKgICogKqIgLCAsoqAiLqMiLyAsICuiICogLaKhIC6jIiqgRAAAAGCeoOY/oiAvIC+iICogKqKgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCAAsCQCAmUA0AIAYgJyAj/SEBtrwiKLNDAAAANJRDd3P4wpIgKEH///8DcUGAgID4A3K+IilDdb+/v5SSQ6Pp3L8gKUP5RLQ+kpWSQwAAAD+UvCIos0MAAAC0lJIgKEH///8DcUGAgID4A3K+IidDdb+/P5SSQ6Pp3D8gJ0P5RLQ+kpWSOAIEIAcgE/0hASIqICD9IQEiK6IgH/0hASIsICH9IQEiLaKgICogKqIgLCAsoqAiLqMiLyAsICuiICogLaKhIC6jIiqgRAAAAGCeoOY/oiAvIC+iICogKqKgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCBAsgJCAL/VEiC/0dACAL/R0BhFANAgsCQCAIRAAAAAAAAAAAZQ0AAkACQCACDQAgACEoQQAhAgwBCwJAIAUgDEcNACACQX9qIQJBACEMIAv9HQBQDQAgIf0hACAWoZkgIP0hACAYoZmgIBpkDQAgBkGAgOejfDYCACAHIBSyOAIAIAtCAP0eACELCwJAAkAgBSAARg0AIAAhKAwBCyACQX9qIQJBACEoIAv9HQFQDQAgIf0hASAXoZkgIP0hASAZoZmgIBtkDQAgBkGAgOejfDYCBCAHIBWyOAIEIAtCAP0eASELCyAL/R0AIAv9HQGEUA0DCwJAAkAgCyAiICAgEP3xAf3sASAhIA798QH97AH98AEiIyAS/Un9UiIk/R0AIiUgJP0dASImhFANACAEIBxrIQAgBSAcayEDAkAgJVANACAMDQAgAkEBaiECICP9IQAhGiAg/SEAIRggIf0hACEWIAAhDCADIRQLICZQDQAgKA0AIAJBAWohAiAj/SEBIRsgIP0hASEZICH9IQEhFwwBCyAoIQAgFSEDCwJAIAUgHUYNACADIRUMAQsgAyEVIAQhHSAFIRwgICEQICEhDgsgBEECaiEEIAUgAU4hAyANIAVBAWoiBWpBAUcNAAsLIANBAXFFDQoLAkAgC/0dAFANACAGQYCA56N8NgIAAkAgCEQAAAAAAAAAAGRFDQAgB0EANgIAIAv9HQFQRQ0HDAsLIAv9HQFQRQ0IDAoLIAv9HQFQDQkgBkGAgOejfDYCBCAIRAAAAAAAAAAAZA0GDAkLAkACQCABQQFODQD9DP////////////////////8hEAwBC0EAIQxBACABayENIAJBCGogAv1dAwD9VwMAASIyIDL98gEhISADQQhqIAP9XQMA/VcDAAEiMyAz/fIBISQgCP0UITT9DAAAAAAAAAAAAAAAAAAAAAAhH/0M/////////////////////yEQQQIhBEEAIQBBACEUQQAhFUQAAAAAAAAAACEWRAAAAAAAAAAAIRdEAAAAAAAAAAAhGEQAAAAAAAAAACEZRAAAAAAAAAAAIRpEAAAAAAAAAAAhG0EAIQNBACEcQQEhBUEAIQJBASEd/QwAAAAAAADwPwAAAAAAAPA/IjEhESAzISAgMiETAkADQCAh/QwAAAAAAAAcQAAAAAAAABxAIgv98gEhIiAh/QwAAAAAAAA1QAAAAAAAADVAIh798gEhIyATIhMgESIO/fIBICAiDyAf/fIB/fEBIiAgIP3wASAx/fABIREgEyAf/fIBIA8gDv3yAf3wASIgICD98AEhHwJAIBD9DAAAAAAAAAAAAAAAAAAAAAAiEiAh/QwAAAAAAIBBQAAAAAAAgEFAIg798gEgJCIgIAv98gH98QEgICAg/fIBIiT98gEgISAgIB798gH98QEgISAh/fIBIgv98gH98AEgE/3yASAK/fABIhMgE/3yASIhIAsgIiAgIA798gH98QH98gEgIyAg/fEBICT98gH98AEgD/3yASAJ/fABIiAgIP3yASIk/fABIgv9DAAAAACAhC5BAAAAAICELkH9Sv1SIg/9HQAiJSAP/R0BIiaEUA0AIAWyIScCQCAlUA0AIAYgJyAL/SEAtrwiKLNDAAAANJRDd3P4wpIgKEH///8DcUGAgID4A3K+IilDdb+/v5SSQ6Pp3L8gKUP5RLQ+kpWSQwAAAD+UvCIos0MAAAA0lEN3c/jCkiAoQf///wNxQYCAgPgDcr4iKUN1v7+/lJJDo+ncvyApQ/lEtD6SlZJDymC2vpSSOAIAIAcgH/0hACIqICD9IQAiK6IgEf0hACIsIBP9IQAiLaKgICogKqIgLCAsoqAiLqMiLyAsICuiICogLaKhIC6jIiqgRAAAAGCeoOY/oiAvIC+iICogKqKgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCAAsCQCAmUA0AIAYgJyAL/SEBtrwiKLNDAAAANJRDd3P4wpIgKEH///8DcUGAgID4A3K+IilDdb+/v5SSQ6Pp3L8gKUP5RLQ+kpWSQwAAAD+UvCIos0MAAAA0lEN3c/jCkiAoQf///wNxQYCAgPgDcr4iKUN1v7+/lJJDo+ncvyApQ/lEtD6SlZJDymC2vpSSOAIEIAcgH/0hASIqICD9IQEiK6IgEf0hASIsIBP9IQEiLaKgICogKqIgLCAsoqAiLqMiLyAsICuiICogLaKhIC6jIiqgRAAAAGCeoOY/oiAvIC+iICogKqKgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCBAsgDyAQ/VEiEP0dACAQ/R0BhFANAgsCQCAIRAAAAAAAAAAAZQ0AAkACQCACDQAgACEoQQAhAgwBCwJAIAUgDEcNACACQX9qIQJBACEMIBD9HQBQDQAgE/0hACAWoZkgIP0hACAYoZmgIBpkDQAgBkGAgOejfDYCACAHIBSyOAIAIBBCAP0eACEQCwJAAkAgBSAARg0AIAAhKAwBCyACQX9qIQJBACEoIBD9HQFQDQAgE/0hASAXoZkgIP0hASAZoZmgIBtkDQAgBkGAgOejfDYCBCAHIBWyOAIEIBBCAP0eASEQCyAQ/R0AIBD9HQGEUA0DCwJAAkAgECASIBMgMv3xAf3sASAgIDP98QH97AH98AEiCyA0/Un9UiIP/R0AIiUgD/0dASImhFANACAEIBxrIQAgBSAcayEDAkAgJVANACAMDQAgAkEBaiECIAv9IQAhGiAg/SEAIRggE/0hACEWIAAhDCADIRQLICZQDQAgKA0AIAJBAWohAiAL/SEBIRsgIP0hASEZIBP9IQEhFwwBCyAoIQAgFSEDCwJAIAUgHUYNACADIRUMAQsgAyEVIAQhHSAFIRwgICEzIBMhMgsgBEECaiEEIAUgAU4hAyANIAVBAWoiBWpBAUcNAAsLIANBAXFFDQkLAkAgEP0dAFANACAGQYCA56N8NgIAAkAgCEQAAAAAAAAAAGRFDQAgB0EANgIAIBD9HQFQRQ0GDAoLIBD9HQFQRQ0HDAkLIBD9HQFQDQggBkGAgOejfDYCBCAIRAAAAAAAAAAAZA0FDAgLAkACQCABQQFODQD9DP////////////////////8hDgwBC0EAIQxBACABayENIAJBCGogAv1dAwD9VwMAASISIBL98gEhICADQQhqIAP9XQMA/VcDAAEiMSAx/fIBISEgCP0UITL9DAAAAAAAAAAAAAAAAAAAAAAhD/0M/////////////////////yEOQQIhBEEAIQBBACEUQQAhFUQAAAAAAAAAACEWRAAAAAAAAAAAIRdEAAAAAAAAAAAhGEQAAAAAAAAAACEZRAAAAAAAAAAAIRpEAAAAAAAAAAAhG0EAIQNBACEcQQEhBUEAIQJBASEd/QwAAAAAAADwPwAAAAAAAPA/IhAhCyAxIRMgEiEfAkADQCAgIiAgIP3yASIR/QwAAAAAAAAuQAAAAAAAAC5AIiL98gEgISAh/fIBIiT98AEgIf3yASEeIB8iHyALIiP98gEgEyITIA/98gH98QEiCyAL/fABIBD98AEhCyAfIA/98gEgEyAj/fIB/fABIg8gD/3wASEPAkAgDv0MAAAAAAAAAAAAAAAAAAAAACIjIB8gE/3yASARICT98AH9DAAAAAAAABhAAAAAAAAAGED98gEgIf0MAAAAAAAANMAAAAAAAAA0wP3yASAg/fIB/fAB/fIBIAn98AEiEyAT/fIBIiEgCiAe/fEBICQgIv3yASAR/fABICD98gH98AEiHyAf/fIBIiD98AEiJP0MAAAAAICELkEAAAAAgIQuQf1K/VIiEf0dACIlIBH9HQEiJoRQDQAgBbIhJwJAICVQDQAgBiAnICT9IQC2vCIos0MAAAA0lEN3c/jCkiAoQf///wNxQYCAgPgDcr4iKUN1v7+/lJJDo+ncvyApQ/lEtD6SlZJDAAAAP5S8IiizQwAAADSUQ3dz+MKSIChB////A3FBgICA+ANyviIpQ3W/v7+UkkOj6dy/IClD+US0PpKVkkOSEca+lJI4AgAgByAP/SEAIiogE/0hACIroiAL/SEAIiwgH/0hACItoqAgKiAqoiAsICyioCIuoyIvICwgK6IgKiAtoqEgLqMiKqBEAAAAYJ6g5j+iIC8gL6IgKiAqoqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIACwJAICZQDQAgBiAnICT9IQG2vCIos0MAAAA0lEN3c/jCkiAoQf///wNxQYCAgPgDcr4iKUN1v7+/lJJDo+ncvyApQ/lEtD6SlZJDAAAAP5S8IiizQwAAADSUQ3dz+MKSIChB////A3FBgICA+ANyviIpQ3W/v7+UkkOj6dy/IClD+US0PpKVkkOSEca+lJI4AgQgByAP/SEBIiogE/0hASIroiAL/SEBIiwgH/0hASItoqAgKiAqoiAsICyioCIuoyIvICwgK6IgKiAtoqEgLqMiKqBEAAAAYJ6g5j+iIC8gL6IgKiAqoqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIECyARIA79USIO/R0AIA79HQGEUA0CCwJAIAhEAAAAAAAAAABlDQACQAJAIAINACAAIShBACECDAELAkAgBSAMRw0AIAJBf2ohAkEAIQwgDv0dAFANACAf/SEAIBahmSAT/SEAIBihmaAgGmQNACAGQYCA56N8NgIAIAcgFLI4AgAgDkIA/R4AIQ4LAkACQCAFIABGDQAgACEoDAELIAJBf2ohAkEAISggDv0dAVANACAf/SEBIBehmSAT/SEBIBmhmaAgG2QNACAGQYCA56N8NgIEIAcgFbI4AgQgDkIA/R4BIQ4LIA79HQAgDv0dAYRQDQMLAkACQCAOICMgHyAS/fEB/ewBIBMgMf3xAf3sAf3wASIkIDL9Sf1SIhH9HQAiJSAR/R0BIiaEUA0AIAQgHGshACAFIBxrIQMCQCAlUA0AIAwNACACQQFqIQIgJP0hACEaIBP9IQAhGCAf/SEAIRYgACEMIAMhFAsgJlANACAoDQAgAkEBaiECICT9IQEhGyAT/SEBIRkgH/0hASEXDAELICghACAVIQMLAkAgBSAdRg0AIAMhFQwBCyADIRUgBCEdIAUhHCATITEgHyESCyAEQQJqIQQgBSABTiEDIA0gBUEBaiIFakEBRw0ACwsgA0EBcUUNCAsCQCAO/R0AUA0AIAZBgIDno3w2AgACQCAIRAAAAAAAAAAAZEUNACAHQQA2AgAgDv0dAVBFDQUMCQsgDv0dAVBFDQYMCAsgDv0dAVANByAGQYCA56N8NgIEIAhEAAAAAAAAAABkDQQMBwsCQAJAIAFBAU4NAP0M/////////////////////yEjDAELQQAhDEEAIAFrIQ0gAkEIaiAC/V0DAP1XAwABIhAgEP3yASEhIANBCGogA/1dAwD9VwMAASISIBL98gEhICAI/RQhMf0MAAAAAAAAAAAAAAAAAAAAACEk/Qz/////////////////////ISNBAiEEQQAhAEEAIRRBACEVRAAAAAAAAAAAIRZEAAAAAAAAAAAhF0QAAAAAAAAAACEYRAAAAAAAAAAAIRlEAAAAAAAAAAAhGkQAAAAAAAAAACEbQQAhA0EAIRxBASEFQQAhAkEBIR39DAAAAAAAAPA/AAAAAAAA8D8iDiEPIBIhEyAQIR8CQANAICAiICAhIiH9DAAAAAAAABjAAAAAAAAAGMD98gH98AEgIP3yASAhICH98gH98AH9DAAAAAAAABRAAAAAAAAAFEAiEf3yASILICQiIv3yASATIhP9DAAAAAAAADRAAAAAAAAANED98gEgISAg/fEB/fIBIB8iH/3yASIeIA/98gH98AEhJCAOIB4gIv3yAf3xASALIA/98gH98AEhDwJAICP9DAAAAAAAAAAAAAAAAAAAAAAiHiAhIBH98gEgIP0MAAAAAAAAJEAAAAAAAAAkQP3yASIL/fEBICH98gEgICAg/fIBIiL98AEgE/3yASAJ/fABIhMgE/3yASIgICEgC/3xASAh/fIBICIgEf3yAf3wASAf/fIBIAr98AEiHyAf/fIBIiH98AEiC/0MAAAAAICELkEAAAAAgIQuQf1K/VIiEf0dACIlIBH9HQEiJoRQDQAgBbIhJwJAICVQDQAgBiAnIAv9IQC2vCIos0MAAAA0lEN3c/jCkiAoQf///wNxQYCAgPgDcr4iKUN1v7+/lJJDo+ncvyApQ/lEtD6SlZJDAAAAP5S8IiizQwAAADSUQ3dz+MKSIChB////A3FBgICA+ANyviIpQ3W/v7+UkkOj6dy/IClD+US0PpKVkkOjgdy+lJI4AgAgByAk/SEAIiogE/0hACIroiAP/SEAIiwgH/0hACItoqAgKiAqoiAsICyioCIuoyIvICwgK6IgKiAtoqEgLqMiKqBEAAAAYJ6g5j+iIC8gL6IgKiAqoqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIACwJAICZQDQAgBiAnIAv9IQG2vCIos0MAAAA0lEN3c/jCkiAoQf///wNxQYCAgPgDcr4iKUN1v7+/lJJDo+ncvyApQ/lEtD6SlZJDAAAAP5S8IiizQwAAADSUQ3dz+MKSIChB////A3FBgICA+ANyviIpQ3W/v7+UkkOj6dy/IClD+US0PpKVkkOjgdy+lJI4AgQgByAk/SEBIiogE/0hASIroiAP/SEBIiwgH/0hASItoqAgKiAqoiAsICyioCIuoyIvICwgK6IgKiAtoqEgLqMiKqBEAAAAYJ6g5j+iIC8gL6IgKiAqoqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIECyARICP9USIj/R0AICP9HQGEUA0CCwJAIAhEAAAAAAAAAABlDQACQAJAIAINACAAIShBACECDAELAkAgBSAMRw0AIAJBf2ohAkEAIQwgI/0dAFANACAf/SEAIBahmSAT/SEAIBihmaAgGmQNACAGQYCA56N8NgIAIAcgFLI4AgAgI0IA/R4AISMLAkACQCAFIABGDQAgACEoDAELIAJBf2ohAkEAISggI/0dAVANACAf/SEBIBehmSAT/SEBIBmhmaAgG2QNACAGQYCA56N8NgIEIAcgFbI4AgQgI0IA/R4BISMLICP9HQAgI/0dAYRQDQMLAkACQCAjIB4gEyAS/fEB/ewBIB8gEP3xAf3sAf3wASILIDH9Sf1SIhH9HQAiJSAR/R0BIiaEUA0AIAQgHGshACAFIBxrIQMCQCAlUA0AIAwNACACQQFqIQIgC/0hACEaIBP9IQAhGCAf/SEAIRYgACEMIAMhFAsgJlANACAoDQAgAkEBaiECIAv9IQEhGyAT/SEBIRkgH/0hASEXDAELICghACAVIQMLAkAgBSAdRg0AIAMhFQwBCyADIRUgBCEdIAUhHCATIRIgHyEQCyAEQQJqIQQgBSABTiEDIA0gBUEBaiIFakEBRw0ACwsgA0EBcUUNBwsCQCAj/R0AUA0AIAZBgIDno3w2AgACQCAIRAAAAAAAAAAAZEUNACAHQQA2AgAgI/0dAVBFDQQMCAsgI/0dAVBFDQUMBwsgI/0dAVANBiAGQYCA56N8NgIEIAhEAAAAAAAAAABkDQMMBgsCQAJAIAFBAU4NAP0M/////////////////////yEjDAELQQAhDEEAIAFrIQ0gAkEIaiAC/V0DAP1XAwABIhAgEP3yASERIANBCGogA/1dAwD9VwMAASISIBL98gEhISAI/RQhMf0MAAAAAAAAAAAAAAAAAAAAACEf/Qz/////////////////////ISNBAiEEQQAhAEEAIRRBACEVRAAAAAAAAAAAIRZEAAAAAAAAAAAhF0QAAAAAAAAAACEYRAAAAAAAAAAAIRlEAAAAAAAAAAAhGkQAAAAAAAAAACEbQQAhA0EAIRxBASEFQQAhAkEBIR39DAAAAAAAAPA/AAAAAAAA8D8iDiEPIBIhICAQIRMCQANAICEgIf3yASELICH9DAAAAAAAABjAAAAAAAAAGMD98gEhIiATIhMgH/3yASAgIiAgD/3yAf3wASIeIBEiESAh/fEB/QwAAAAAAAAQQAAAAAAAABBA/fIBIiH98gEgEyAg/fIBIiT9DAAAAAAAACBAAAAAAAAAIED98gEgEyAP/fIBICAgH/3yAf3xASIg/fIB/fABIR8gICAh/fIBIA798AEgJP0MAAAAAAAAIMAAAAAAAAAgwP3yASAe/fIB/fABIQ8CQCAj/QwAAAAAAAAAAAAAAAAAAAAAIh4gISAk/fIBIAn98AEiICAg/fIBIiEgCyAK/fABIBEgIv3wASAR/fIB/fABIhMgE/3yASIR/fABIgv9DAAAAACAhC5BAAAAAICELkH9Sv1SIiT9HQAiJSAk/R0BIiaEUA0AIAWyIScCQCAlUA0AIAYgJyAL/SEAtrwiKLNDAAAANJRDd3P4wpIgKEH///8DcUGAgID4A3K+IilDdb+/v5SSQ6Pp3L8gKUP5RLQ+kpWSQwAAAD+UvCIos0MAAAA0lEN3c/jCkiAoQf///wNxQYCAgPgDcr4iKUN1v7+/lJJDo+ncvyApQ/lEtD6SlZJDAAAAP5STOAIAIAcgH/0hACIqICD9IQAiK6IgD/0hACIsIBP9IQAiLaKgICogKqIgLCAsoqAiLqMiLyAsICuiICogLaKhIC6jIiqgRAAAAGCeoOY/oiAvIC+iICogKqKgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCAAsCQCAmUA0AIAYgJyAL/SEBtrwiKLNDAAAANJRDd3P4wpIgKEH///8DcUGAgID4A3K+IilDdb+/v5SSQ6Pp3L8gKUP5RLQ+kpWSQwAAAD+UvCIos0MAAAA0lEN3c/jCkiAoQf///wNxQYCAgPgDcr4iKUN1v7+/lJJDo+ncvyApQ/lEtD6SlZJDAAAAP5STOAIEIAcgH/0hASIqICD9IQEiK6IgD/0hASIsIBP9IQEiLaKgICogKqIgLCAsoqAiLqMiLyAsICuiICogLaKhIC6jIiqgRAAAAGCeoOY/oiAvIC+iICogKqKgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCBAsgJCAj/VEiI/0dACAj/R0BhFANAgsCQCAIRAAAAAAAAAAAZQ0AAkACQCACDQAgACEoQQAhAgwBCwJAIAUgDEcNACACQX9qIQJBACEMICP9HQBQDQAgE/0hACAWoZkgIP0hACAYoZmgIBpkDQAgBkGAgOejfDYCACAHIBSyOAIAICNCAP0eACEjCwJAAkAgBSAARg0AIAAhKAwBCyACQX9qIQJBACEoICP9HQFQDQAgE/0hASAXoZkgIP0hASAZoZmgIBtkDQAgBkGAgOejfDYCBCAHIBWyOAIEICNCAP0eASEjCyAj/R0AICP9HQGEUA0DCwJAAkAgIyAeICAgEv3xAf3sASATIBD98QH97AH98AEiCyAx/Un9UiIk/R0AIiUgJP0dASImhFANACAEIBxrIQAgBSAcayEDAkAgJVANACAMDQAgAkEBaiECIAv9IQAhGiAg/SEAIRggE/0hACEWIAAhDCADIRQLICZQDQAgKA0AIAJBAWohAiAL/SEBIRsgIP0hASEZIBP9IQEhFwwBCyAoIQAgFSEDCwJAIAUgHUYNACADIRUMAQsgAyEVIAQhHSAFIRwgICESIBMhEAsgBEECaiEEIAUgAU4hAyANIAVBAWoiBWpBAUcNAAsLIANBAXFFDQYLAkAgI/0dAFANACAGQYCA56N8NgIAAkAgCEQAAAAAAAAAAGRFDQAgB0EANgIAICP9HQFQRQ0DDAcLICP9HQFQRQ0EDAYLICP9HQFQDQUgBkGAgOejfDYCBCAIRAAAAAAAAAAAZA0CDAULAkACQCABQQFODQD9DP////////////////////8hIwwBC0EAIQxBACABayENIAJBCGogAv1dAwD9VwMAASIQIBD98gEhJCADQQhqIAP9XQMA/VcDAAEiEiAS/fIBIQ8gCP0UITH9DAAAAAAAAAAAAAAAAAAAAAAhEf0M/////////////////////yEjQQIhBEEAIQBBACEUQQAhFUQAAAAAAAAAACEWRAAAAAAAAAAAIRdEAAAAAAAAAAAhGEQAAAAAAAAAACEZRAAAAAAAAAAAIRpEAAAAAAAAAAAhG0EAIQNBACEcQQEhBUEAIQJBASEd/QwAAAAAAADwPwAAAAAAAPA/Ig4hEyASISEgECEgAkADQCAhIgsgICIgICD98AH98gEiIiAT/fIBICQiHyAPIg/98QEiJCARIh798gH98AH9DAAAAAAAAAhAAAAAAAAACEAiIf3yASERICQgE/3yASAiIB798gH98QEgIf3yASAO/fABIRMCQCAj/QwAAAAAAAAAAAAAAAAAAAAAIiIgICAfIA8gIf3yAf3xAf3yASAK/fABIiAgIP3yASIkIB8gIf3yASAP/fEBIAv98gEgCf3wASIhICH98gEiD/3wASIL/QwAAAAAgIQuQQAAAACAhC5B/Ur9UiIf/R0AIiUgH/0dASImhFANACAFsiEnAkAgJVANACAGICcgC/0hALa8IiizQwAAADSUQ3dz+MKSIChB////A3FBgICA+ANyviIpQ3W/v7+UkkOj6dy/IClD+US0PpKVkkMAAAA/lLwiKLNDAAAANJRDd3P4wpIgKEH///8DcUGAgID4A3K+IilDdb+/v5SSQ6Pp3L8gKUP5RLQ+kpWSQ52EIb+UkjgCACAHIBH9IQAiKiAh/SEAIiuiIBP9IQAiLCAg/SEAIi2ioCAqICqiICwgLKKgIi6jIi8gLCAroiAqIC2ioSAuoyIqoEQAAABgnqDmP6IgLyAvoiAqICqioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgALAkAgJlANACAGICcgC/0hAba8IiizQwAAADSUQ3dz+MKSIChB////A3FBgICA+ANyviIpQ3W/v7+UkkOj6dy/IClD+US0PpKVkkMAAAA/lLwiKLNDAAAANJRDd3P4wpIgKEH///8DcUGAgID4A3K+IilDdb+/v5SSQ6Pp3L8gKUP5RLQ+kpWSQ52EIb+UkjgCBCAHIBH9IQEiKiAh/SEBIiuiIBP9IQEiLCAg/SEBIi2ioCAqICqiICwgLKKgIi6jIi8gLCAroiAqIC2ioSAuoyIqoEQAAABgnqDmP6IgLyAvoiAqICqioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgQLIB8gI/1RIiP9HQAgI/0dAYRQDQILAkAgCEQAAAAAAAAAAGUNAAJAAkAgAg0AIAAhKEEAIQIMAQsCQCAFIAxHDQAgAkF/aiECQQAhDCAj/R0AUA0AICD9IQAgFqGZICH9IQAgGKGZoCAaZA0AIAZBgIDno3w2AgAgByAUsjgCACAjQgD9HgAhIwsCQAJAIAUgAEYNACAAISgMAQsgAkF/aiECQQAhKCAj/R0BUA0AICD9IQEgF6GZICH9IQEgGaGZoCAbZA0AIAZBgIDno3w2AgQgByAVsjgCBCAjQgD9HgEhIwsgI/0dACAj/R0BhFANAwsCQAJAICMgIiAgIBD98QH97AEgISAS/fEB/ewB/fABIgsgMf1J/VIiH/0dACIlIB/9HQEiJoRQDQAgBCAcayEAIAUgHGshAwJAICVQDQAgDA0AIAJBAWohAiAL/SEAIRogIf0hACEYICD9IQAhFiAAIQwgAyEUCyAmUA0AICgNACACQQFqIQIgC/0hASEbICH9IQEhGSAg/SEBIRcMAQsgKCEAIBUhAwsCQCAFIB1GDQAgAyEVDAELIAMhFSAEIR0gBSEcICEhEiAgIRALIARBAmohBCAFIAFOIQMgDSAFQQFqIgVqQQFHDQALCyADQQFxRQ0FCwJAICP9HQBQDQAgBkGAgOejfDYCAAJAIAhEAAAAAAAAAABkRQ0AIAdBADYCACAj/R0BUEUNAgwGCyAj/R0BUEUNAwwFCyAj/R0BUA0EIAZBgIDno3w2AgQgCEQAAAAAAAAAAGQNAQwECyAGQYCA56N8NgIEC0MAAAAAIScMAQtDAMB5xCEnIAYhBwsgByAnOAIECwuvowENA3sCfwV7An8GfAJ/BXsCfgF9AX8BfQF/A3sgBUEIaiAF/V0DAP1XAwABIQkgBEEIaiAE/V0DAP1XAwABIQoCQAJAAkACQAJAAkACQAJAAkACQAJAAkACQAJAAkACQAJAAkACQAJAAkAgAEF/ag4PAA8ODQwLCgkIBwYFBAMCAQsCQAJAIAFBAU4NAP0M/////////////////////yELDAELQQAhDEEAIAFrIQ0gAkEIaiAC/V0DAP1XAwABIg4gDv3yASEPIANBCGogA/1dAwD9VwMAASIQIBD98gEhESAI/RQhEv0M/////////////////////yELQQIhBEEAIQBBACETQQAhFEQAAAAAAAAAACEVRAAAAAAAAAAAIRZEAAAAAAAAAAAhF0QAAAAAAAAAACEYRAAAAAAAAAAAIRlEAAAAAAAAAAAhGkEAIQNBACEbQQEhBUEAIQJBASEcIBAhHSAOIR4CQANAIA8gEf3xASEPAkAgC/0MAAAAAAAAAAAAAAAAAAAAACIfIB0gHiIeIB798AH98gEgCf3wASIdIB398gEiESAPIAr98AEiHiAe/fIBIg/98AEiIP0MAAAAAICELkEAAAAAgIQuQf1K/VIiIf0dACIiICH9HQEiI4RQDQAgBbJDd3P4QpIhJAJAICJQDQAgBiAkICD9IQC2vCIls0MAAAA0lEN3c/jCkiAlQf///wNxQYCAgPgDcr4iJkN1v7+/lJJDo+ncvyAmQ/lEtD6SlZJDAAAAP5S8IiWzQwAAALSUkiAlQf///wNxQYCAgPgDcr4iJkN1v78/lJJDo+ncPyAmQ/lEtD6SlZI4AgALAkAgI1ANACAGICQgIP0hAba8IiWzQwAAADSUQ3dz+MKSICVB////A3FBgICA+ANyviImQ3W/v7+UkkOj6dy/ICZD+US0PpKVkkMAAAA/lLwiJbNDAAAAtJSSICVB////A3FBgICA+ANyviIkQ3W/vz+UkkOj6dw/ICRD+US0PpKVkjgCBAsgISAL/VEiC/0dACAL/R0BhFANAgsCQCAIRAAAAAAAAAAAZQ0AAkACQCACDQAgACElQQAhAgwBCwJAIAUgDEcNACACQX9qIQJBACEMIAv9HQBQDQAgHv0hACAVoZkgHf0hACAXoZmgIBlkDQAgBkGAgOejfDYCACAHIBOyOAIAIAtCAP0eACELCwJAAkAgBSAARg0AIAAhJQwBCyACQX9qIQJBACElIAv9HQFQDQAgHv0hASAWoZkgHf0hASAYoZmgIBpkDQAgBkGAgOejfDYCBCAHIBSyOAIEIAtCAP0eASELCyAL/R0AIAv9HQGEUA0DCwJAAkAgCyAfIB0gEP3xAf3sASAeIA798QH97AH98AEiICAS/Un9UiIh/R0AIiIgIf0dASIjhFANACAEIBtrIQAgBSAbayEDAkAgIlANACAMDQAgAkEBaiECICD9IQAhGSAd/SEAIRcgHv0hACEVIAAhDCADIRMLICNQDQAgJQ0AIAJBAWohAiAg/SEBIRogHf0hASEYIB79IQEhFgwBCyAlIQAgFCEDCwJAIAUgHEYNACADIRQMAQsgAyEUIAQhHCAFIRsgHSEQIB4hDgsgBEECaiEEIAUgAU4hAyANIAVBAWoiBWpBAUcNAAsLIANBAXFFDRQLAkAgC/0dAFANACAGQYCA56N8NgIAAkAgCEQAAAAAAAAAAGRFDQAgB0EANgIAIAv9HQFQRQ0RDBULIAv9HQFQDRQMEgsgC/0dAVANEyAGQYCA56N8NgIEIAhEAAAAAAAAAABkDRAMEwsCQAJAIAFBAU4NAP0M/////////////////////yELDAELIAJBCGogAv1dAwD9VwMAASIOIA798gEhHSADQQhqIAP9XQMA/VcDAAEiECAQ/fIBIR4gCP0UIRL9DP////////////////////8hC0EAIQVBAiEDQQAhE0EAIRRBACEnQQAhJUQAAAAAAAAAACEVRAAAAAAAAAAAIRZEAAAAAAAAAAAhF0QAAAAAAAAAACEYRAAAAAAAAAAAIRlEAAAAAAAAAAAhGkEAIQBBACEMQQEhBEEAIQ1BASEbIBAhDyAOIREDQAJAAkAgBEEKbkEKbEF/aiAFIgJHDQAgHSAe/fEBIA/9DAAAAAAAABBAAAAAAAAAEED98gEgEf3yAf3sAf3yASEPIB4gHf0MAAAAAAAAGMAAAAAAAAAYwP3yAf3wASAe/fIBIREgHSAd/fIBIR0MAQsgD/0MAAAAAAAAEEAAAAAAAAAQQP3yASAdIB798QH98gEgEf3yASEPIB0gHv0MAAAAAAAAGMAAAAAAAAAYwP3yAf3wASAd/fIBIREgHiAe/fIBIR0LIAJBAWohBQJAAkAgC/0MAAAAAAAAAAAAAAAAAAAAACIfIA8gCf3wASIPIA/98gEiHiAdIAr98AEgEf3wASIRIBH98gEiHf3wASIg/QwAAAAAgIQuQQAAAACAhC5B/Ur9UiIh/R0AIiIgIf0dASIjhFANACAFsiEkAkAgIlANACAGICQgIP0hALa8IhyzQwAAADSUQ3dz+MKSIBxB////A3FBgICA+ANyviImQ3W/v7+UkkOj6dy/ICZD+US0PpKVkkMAAAA/lLwiHLNDAAAANJRDd3P4wpIgHEH///8DcUGAgID4A3K+IiZDdb+/v5SSQ6Pp3L8gJkP5RLQ+kpWSQwAAAD+UkzgCAAsCQCAjUA0AIAYgJCAg/SEBtrwiHLNDAAAANJRDd3P4wpIgHEH///8DcUGAgID4A3K+IiZDdb+/v5SSQ6Pp3L8gJkP5RLQ+kpWSQwAAAD+UvCIcs0MAAAA0lEN3c/jCkiAcQf///wNxQYCAgPgDcr4iJkN1v7+/lJJDo+ncvyAmQ/lEtD6SlZJDAAAAP5STOAIECyAhIAv9USIL/R0AIAv9HQGEUA0BCwJAIAhEAAAAAAAAAABlDQACQAJAIA0NACAUIRxBACENDAELAkAgBSATRw0AIA1Bf2ohDUEAIRMgC/0dAFANACAR/SEAIBWhmSAP/SEAIBehmaAgGWQNACAGQYCA56N8NgIAIAcgJ7I4AgAgC0IA/R4AIQsLAkACQCAFIBRGDQAgFCEcDAELIA1Bf2ohDUEAIRwgC/0dAVANACAR/SEBIBahmSAP/SEBIBihmaAgGmQNACAGQYCA56N8NgIEIAcgJbI4AgQgC0IA/R4BIQsLIAv9HQAgC/0dAYRQDQILAkACQCALIB8gDyAQ/fEB/ewBIBEgDv3xAf3sAf3wASIgIBL9Sf1SIiH9HQAiIiAh/R0BIiOEUA0AIAMgDGshFCACIAxrQQFqIQICQCAiUA0AIBMNACANQQFqIQ0gIP0hACEZIA/9IQAhFyAR/SEAIRUgFCETIAIhJwsgI1ANACAcDQAgDUEBaiENICD9IQEhGiAP/SEBIRggEf0hASEWDAELIBwhFCAlIQILAkAgBSAbRg0AIAIhJQwBCyACISUgAyEbIAUhDCAPIRAgESEOCyADQQJqIQMgBSABTiEAIARBAWohBCABIAVHDQELCyAAQQFxRQ0TCwJAIAv9HQBQDQAgBkGAgOejfDYCAAJAIAhEAAAAAAAAAABkRQ0AIAdBADYCACAL/R0BUEUNEAwUCyAL/R0BUEUNEQwTCyAL/R0BUA0SIAZBgIDno3w2AgQgCEQAAAAAAAAAAGRFDRIMDwsCQAJAIAFBAU4NAP0M/////////////////////yELDAELIAJBCGogAv1dAwD9VwMAASIOIA798gEhESADQQhqIAP9XQMA/VcDAAEiECAQ/fIBIQ8gCP0UIRL9DP////////////////////8hC0EAIQVBAiEDQQAhE0EAIRRBACEnQQAhJUQAAAAAAAAAACEVRAAAAAAAAAAAIRZEAAAAAAAAAAAhF0QAAAAAAAAAACEYRAAAAAAAAAAAIRlEAAAAAAAAAAAhGkEAIQBBACEMQQEhBEEAIQ1BASEbIBAhHSAOIR4DQCARIRECQAJAIARBCm5BCmxBf2ogBSICRw0AIBEgD/0MAAAAAAAACMAAAAAAAAAIwP3yAf3wASAe/ewB/fIBIR4gHf3sASEdDAELIB4gESAP/QwAAAAAAAAIwAAAAAAAAAjA/fIB/fAB/fIBIR4LIAJBAWohBQJAAkAgC/0MAAAAAAAAAAAAAAAAAAAAACIfIBH9DAAAAAAAAAhAAAAAAAAACED98gEgD/3xASAd/fIBIAn98AEiHSAd/fIBIg8gHiAK/fABIh4gHv3yASIR/fABIiD9DAAAAACAhC5BAAAAAICELkH9Sv1SIiH9HQAiIiAh/R0BIiOEUA0AIAWyISQCQCAiUA0AIAYgJCAg/SEAtrwiHLNDAAAANJRDd3P4wpIgHEH///8DcUGAgID4A3K+IiZDdb+/v5SSQ6Pp3L8gJkP5RLQ+kpWSQwAAAD+UvCIcs0MAAAA0lEN3c/jCkiAcQf///wNxQYCAgPgDcr4iJkN1v7+/lJJDo+ncvyAmQ/lEtD6SlZJDnYQhv5SSOAIACwJAICNQDQAgBiAkICD9IQG2vCIcs0MAAAA0lEN3c/jCkiAcQf///wNxQYCAgPgDcr4iJkN1v7+/lJJDo+ncvyAmQ/lEtD6SlZJDAAAAP5S8IhyzQwAAADSUQ3dz+MKSIBxB////A3FBgICA+ANyviImQ3W/v7+UkkOj6dy/ICZD+US0PpKVkkOdhCG/lJI4AgQLICEgC/1RIgv9HQAgC/0dAYRQDQELAkAgCEQAAAAAAAAAAGUNAAJAAkAgDQ0AIBQhHEEAIQ0MAQsCQCAFIBNHDQAgDUF/aiENQQAhEyAL/R0AUA0AIB79IQAgFaGZIB39IQAgF6GZoCAZZA0AIAZBgIDno3w2AgAgByAnsjgCACALQgD9HgAhCwsCQAJAIAUgFEYNACAUIRwMAQsgDUF/aiENQQAhHCAL/R0BUA0AIB79IQEgFqGZIB39IQEgGKGZoCAaZA0AIAZBgIDno3w2AgQgByAlsjgCBCALQgD9HgEhCwsgC/0dACAL/R0BhFANAgsCQAJAIAsgHyAdIBD98QH97AEgHiAO/fEB/ewB/fABIiAgEv1J/VIiIf0dACIiICH9HQEiI4RQDQAgAyAMayEUIAIgDGtBAWohAgJAICJQDQAgEw0AIA1BAWohDSAg/SEAIRkgHf0hACEXIB79IQAhFSAUIRMgAiEnCyAjUA0AIBwNACANQQFqIQ0gIP0hASEaIB39IQEhGCAe/SEBIRYMAQsgHCEUICUhAgsCQCAFIBtGDQAgAiElDAELIAIhJSADIRsgBSEMIB0hECAeIQ4LIANBAmohAyAFIAFOIQAgBEEBaiEEIAEgBUcNAQsLIABBAXFFDRILAkAgC/0dAFANACAGQYCA56N8NgIAAkAgCEQAAAAAAAAAAGRFDQAgB0EANgIAIAv9HQFQDRMMDwsgC/0dAVBFDRAMEgsgC/0dAVANESAGQYCA56N8NgIEIAhEAAAAAAAAAABkDQ4MEQsCQAJAIAFBAU4NAP0M/////////////////////yELDAELIAJBCGogAv1dAwD9VwMAASIOIA798gEhDyADQQhqIAP9XQMA/VcDAAEiECAQ/fIBIREgCP0UIRL9DP////////////////////8hC0EAIQVBAiEDQQAhE0EAIRRBACEnQQAhJUQAAAAAAAAAACEVRAAAAAAAAAAAIRZEAAAAAAAAAAAhF0QAAAAAAAAAACEYRAAAAAAAAAAAIRlEAAAAAAAAAAAhGkEAIQBBACEMQQEhBEEAIQ1BASEbIBAhHiAOIR0CQANAIBEhISAFIgJBAWohBQJAIAv9DAAAAAAAAAAAAAAAAAAAAAAiHyAeIB0gHf3wAf3yASId/ewBIB0gAiAEQQpuQQpsQX9qRhsgCf3wASIeIB798gEiESAPICH98QEgCv3wASIdIB398gEiD/3wASIg/QwAAAAAgIQuQQAAAACAhC5B/Ur9UiIh/R0AIiIgIf0dASIjhFANACAFskN3c/hCkiEkAkAgIlANACAGICQgIP0hALa8IhyzQwAAADSUQ3dz+MKSIBxB////A3FBgICA+ANyviImQ3W/v7+UkkOj6dy/ICZD+US0PpKVkkMAAAA/lLwiHLNDAAAAtJSSIBxB////A3FBgICA+ANyviImQ3W/vz+UkkOj6dw/ICZD+US0PpKVkjgCAAsCQCAjUA0AIAYgJCAg/SEBtrwiHLNDAAAANJRDd3P4wpIgHEH///8DcUGAgID4A3K+IiZDdb+/v5SSQ6Pp3L8gJkP5RLQ+kpWSQwAAAD+UvCIcs0MAAAC0lJIgHEH///8DcUGAgID4A3K+IiRDdb+/P5SSQ6Pp3D8gJEP5RLQ+kpWSOAIECyAhIAv9USIL/R0AIAv9HQGEUA0CCwJAIAhEAAAAAAAAAABlDQACQAJAIA0NACAUIRxBACENDAELAkAgBSATRw0AIA1Bf2ohDUEAIRMgC/0dAFANACAd/SEAIBWhmSAe/SEAIBehmaAgGWQNACAGQYCA56N8NgIAIAcgJ7I4AgAgC0IA/R4AIQsLAkACQCAFIBRGDQAgFCEcDAELIA1Bf2ohDUEAIRwgC/0dAVANACAd/SEBIBahmSAe/SEBIBihmaAgGmQNACAGQYCA56N8NgIEIAcgJbI4AgQgC0IA/R4BIQsLIAv9HQAgC/0dAYRQDQMLAkACQCALIB8gHiAQ/fEB/ewBIB0gDv3xAf3sAf3wASIgIBL9Sf1SIiH9HQAiIiAh/R0BIiOEUA0AIAMgDGshFCACIAxrQQFqIQICQCAiUA0AIBMNACANQQFqIQ0gIP0hACEZIB79IQAhFyAd/SEAIRUgFCETIAIhJwsgI1ANACAcDQAgDUEBaiENICD9IQEhGiAe/SEBIRggHf0hASEWDAELIBwhFCAlIQILAkAgBSAbRg0AIAIhJQwBCyACISUgAyEbIAUhDCAeIRAgHSEOCyADQQJqIQMgBSABTiEAIARBAWohBCABIAVHDQALCyAAQQFxRQ0RCwJAIAv9HQBQDQAgBkGAgOejfDYCAAJAIAhEAAAAAAAAAABkRQ0AIAdBADYCACAL/R0BUEUNDgwSCyAL/R0BUEUNDwwRCyAL/R0BUA0QIAZBgIDno3w2AgQgCEQAAAAAAAAAAGQNDQwQCwJAAkAgAUEBTg0A/Qz/////////////////////IQsMAQtBACEMQQAgAWshDSACQQhqIAL9XQMA/VcDAAEiDiAO/fIBIQ8gA0EIaiAD/V0DAP1XAwABIhAgEP3yASERIAj9FCES/Qz/////////////////////IQtBAiEEQQAhAEEAIRNBACEURAAAAAAAAAAAIRVEAAAAAAAAAAAhFkQAAAAAAAAAACEXRAAAAAAAAAAAIRhEAAAAAAAAAAAhGUQAAAAAAAAAACEaQQAhA0EAIRtBASEFQQAhAkEBIRwgECEdIA4hHgJAA0AgDyAR/fEBIQ8CQCAL/QwAAAAAAAAAAAAAAAAAAAAAIh8gCSAdIB4iHiAe/fAB/fIB/fEBIh0gHf3yASIRIA8gCv3wASIeIB798gEiD/3wASIg/QwAAAAAgIQuQQAAAACAhC5B/Ur9UiIh/R0AIiIgIf0dASIjhFANACAFskN3c/hCkiEkAkAgIlANACAGICQgIP0hALa8IiWzQwAAADSUQ3dz+MKSICVB////A3FBgICA+ANyviImQ3W/v7+UkkOj6dy/ICZD+US0PpKVkkMAAAA/lLwiJbNDAAAAtJSSICVB////A3FBgICA+ANyviImQ3W/vz+UkkOj6dw/ICZD+US0PpKVkjgCAAsCQCAjUA0AIAYgJCAg/SEBtrwiJbNDAAAANJRDd3P4wpIgJUH///8DcUGAgID4A3K+IiZDdb+/v5SSQ6Pp3L8gJkP5RLQ+kpWSQwAAAD+UvCIls0MAAAC0lJIgJUH///8DcUGAgID4A3K+IiRDdb+/P5SSQ6Pp3D8gJEP5RLQ+kpWSOAIECyAhIAv9USIL/R0AIAv9HQGEUA0CCwJAIAhEAAAAAAAAAABlDQACQAJAIAINACAAISVBACECDAELAkAgBSAMRw0AIAJBf2ohAkEAIQwgC/0dAFANACAe/SEAIBWhmSAd/SEAIBehmaAgGWQNACAGQYCA56N8NgIAIAcgE7I4AgAgC0IA/R4AIQsLAkACQCAFIABGDQAgACElDAELIAJBf2ohAkEAISUgC/0dAVANACAe/SEBIBahmSAd/SEBIBihmaAgGmQNACAGQYCA56N8NgIEIAcgFLI4AgQgC0IA/R4BIQsLIAv9HQAgC/0dAYRQDQMLAkACQCALIB8gHSAQ/fEB/ewBIB4gDv3xAf3sAf3wASIgIBL9Sf1SIiH9HQAiIiAh/R0BIiOEUA0AIAQgG2shACAFIBtrIQMCQCAiUA0AIAwNACACQQFqIQIgIP0hACEZIB39IQAhFyAe/SEAIRUgACEMIAMhEwsgI1ANACAlDQAgAkEBaiECICD9IQEhGiAd/SEBIRggHv0hASEWDAELICUhACAUIQMLAkAgBSAcRg0AIAMhFAwBCyADIRQgBCEcIAUhGyAdIRAgHiEOCyAEQQJqIQQgBSABTiEDIA0gBUEBaiIFakEBRw0ACwsgA0EBcUUNEAsCQCAL/R0AUA0AIAZBgIDno3w2AgACQCAIRAAAAAAAAAAAZEUNACAHQQA2AgAgC/0dAVBFDQ0MEQsgC/0dAVBFDQ4MEAsgC/0dAVANDyAGQYCA56N8NgIEIAhEAAAAAAAAAABkDQwMDwsCQAJAIAFBAU4NAP0M/////////////////////yELDAELQQAhDEEAIAFrIQ0gAkEIaiAC/V0DAP1XAwABIg4gDv3yASEPIANBCGogA/1dAwD9VwMAASIQIBD98gEhESAI/RQhEv0M/////////////////////yELQQIhBEEAIQBBACETQQAhFEQAAAAAAAAAACEVRAAAAAAAAAAAIRZEAAAAAAAAAAAhF0QAAAAAAAAAACEYRAAAAAAAAAAAIRlEAAAAAAAAAAAhGkEAIQNBACEbQQEhBUEAIQJBASEcIBAhHSAOIR4CQANAIBEgHv3sASIe/fABISECQCAL/QwAAAAAAAAAAAAAAAAAAAAAIh8gHf3sASIdIB4gHv3wAf3yASAd/fEBIAn98AEiHSAd/fIBIhEgCiAP/fABICH98QEiHiAe/fIBIg/98AEiIP0MAAAAAICELkEAAAAAgIQuQf1K/VIiIf0dACIiICH9HQEiI4RQDQAgBbJDd3P4QpIhJAJAICJQDQAgBiAkICD9IQC2vCIls0MAAAA0lEN3c/jCkiAlQf///wNxQYCAgPgDcr4iJkN1v7+/lJJDo+ncvyAmQ/lEtD6SlZJDAAAAP5S8IiWzQwAAALSUkiAlQf///wNxQYCAgPgDcr4iJkN1v78/lJJDo+ncPyAmQ/lEtD6SlZI4AgALAkAgI1ANACAGICQgIP0hAba8IiWzQwAAADSUQ3dz+MKSICVB////A3FBgICA+ANyviImQ3W/v7+UkkOj6dy/ICZD+US0PpKVkkMAAAA/lLwiJbNDAAAAtJSSICVB////A3FBgICA+ANyviIkQ3W/vz+UkkOj6dw/ICRD+US0PpKVkjgCBAsgISAL/VEiC/0dACAL/R0BhFANAgsCQCAIRAAAAAAAAAAAZQ0AAkACQCACDQAgACElQQAhAgwBCwJAIAUgDEcNACACQX9qIQJBACEMIAv9HQBQDQAgHv0hACAVoZkgHf0hACAXoZmgIBlkDQAgBkGAgOejfDYCACAHIBOyOAIAIAtCAP0eACELCwJAAkAgBSAARg0AIAAhJQwBCyACQX9qIQJBACElIAv9HQFQDQAgHv0hASAWoZkgHf0hASAYoZmgIBpkDQAgBkGAgOejfDYCBCAHIBSyOAIEIAtCAP0eASELCyAL/R0AIAv9HQGEUA0DCwJAAkAgCyAfIB0gEP3xAf3sASAeIA798QH97AH98AEiICAS/Un9UiIh/R0AIiIgIf0dASIjhFANACAEIBtrIQAgBSAbayEDAkAgIlANACAMDQAgAkEBaiECICD9IQAhGSAd/SEAIRcgHv0hACEVIAAhDCADIRMLICNQDQAgJQ0AIAJBAWohAiAg/SEBIRogHf0hASEYIB79IQEhFgwBCyAlIQAgFCEDCwJAIAUgHEYNACADIRQMAQsgAyEUIAQhHCAFIRsgHSEQIB4hDgsgBEECaiEEIAUgAU4hAyANIAVBAWoiBWpBAUcNAAsLIANBAXFFDQ8LAkAgC/0dAFANACAGQYCA56N8NgIAAkAgCEQAAAAAAAAAAGRFDQAgB0EANgIAIAv9HQFQRQ0MDBALIAv9HQFQRQ0NDA8LIAv9HQFQDQ4gBkGAgOejfDYCBCAIRAAAAAAAAAAAZA0LDA4LAkACQCABQQFODQD9DP////////////////////8hIQwBC0EAIRNBACABayEUIAJBCGogAv1dAwD9VwMAASIeIB798gEhESAI/RQhEP0M/////////////////////yEhQQIhBEEAIQ1BACEnQQAhJUQAAAAAAAAAACEVRAAAAAAAAAAAIRZEAAAAAAAAAAAhF0QAAAAAAAAAACEYRAAAAAAAAAAAIRlEAAAAAAAAAAAhGkEAIQJBACEMQQEhBUEAIQBBASEbIANBCGogA/1dAwD9VwMAAf3tASIgIR0gHv3sASIOIQ8CQANAAkAgIf0MAAAAAAAAAAAAAAAAAAAAACILIBEgCv3wASAdIB398gH98QEiHiAe/fIBIhEgHf0MAAAAAAAAAMAAAAAAAAAAwP3yASAP/fIBIAn98QEiHSAd/fIB/fABIh/9DAAAAACAhC5BAAAAAICELkH9Sv1SIg/9HQAiIiAP/R0BIiOEUA0AIAWyQ3dz+EKSISQCQCAiUA0AIAYgJCAf/SEAtrwiA7NDAAAANJRDd3P4wpIgA0H///8DcUGAgID4A3K+IiZDdb+/v5SSQ6Pp3L8gJkP5RLQ+kpWSQwAAAD+UvCIDs0MAAAC0lJIgA0H///8DcUGAgID4A3K+IiZDdb+/P5SSQ6Pp3D8gJkP5RLQ+kpWSOAIACwJAICNQDQAgBiAkIB/9IQG2vCIDs0MAAAA0lEN3c/jCkiADQf///wNxQYCAgPgDcr4iJkN1v7+/lJJDo+ncvyAmQ/lEtD6SlZJDAAAAP5S8IgOzQwAAALSUkiADQf///wNxQYCAgPgDcr4iJEN1v78/lJJDo+ncPyAkQ/lEtD6SlZI4AgQLIA8gIf1RIiH9HQAgIf0dAYRQDQILIB797AEhDwJAIAhEAAAAAAAAAABlDQACQAJAIAANACANIRxBACEADAELAkAgBSATRw0AIABBf2ohAEEAIRMgIf0dAFANACAP/SEAIBWhmSAd/SEAIBehmaAgGWQNACAGQYCA56N8NgIAIAcgJ7I4AgAgIUIA/R4AISELAkACQCAFIA1GDQAgDSEcDAELIABBf2ohAEEAIRwgIf0dAVANACAP/SEBIBahmSAd/SEBIBihmaAgGmQNACAGQYCA56N8NgIEIAcgJbI4AgQgIUIA/R4BISELICH9HQAgIf0dAYRQDQMLAkACQCAhIAsgDyAO/fEB/ewBIB0gIP3xAf3sAf3wASIfIBD9Sf1SIh79HQAiIiAe/R0BIiOEUA0AIAQgDGshDSAFIAxrIQMCQCAiUA0AIBMNACAAQQFqIQAgH/0hACEZIB39IQAhFyAP/SEAIRUgDSETIAMhJwsgI1ANACAcDQAgAEEBaiEAIB/9IQEhGiAd/SEBIRggD/0hASEWDAELIBwhDSAlIQMLAkAgBSAbRg0AIAMhJQwBCyADISUgBCEbIAUhDCAdISAgDyEOCyAEQQJqIQQgBSABTiECIBQgBUEBaiIFakEBRw0ACwsgAkEBcUUNDgsCQCAh/R0AUA0AIAZBgIDno3w2AgACQCAIRAAAAAAAAAAAZEUNACAHQQA2AgAgIf0dAVBFDQsMDwsgIf0dAVBFDQwMDgsgIf0dAVANDSAGQYCA56N8NgIEIAhEAAAAAAAAAABkDQoMDQsCQAJAIAFBAU4NAP0M/////////////////////yELDAELQQAhDEEAIAFrIQ0gAkEIaiAC/V0DAP1XAwABIg4gDv3yASEPIANBCGogA/1dAwD9VwMAASIQIBD98gEhESAI/RQhEv0M/////////////////////yELQQIhBEEAIQBBACETQQAhFEQAAAAAAAAAACEVRAAAAAAAAAAAIRZEAAAAAAAAAAAhF0QAAAAAAAAAACEYRAAAAAAAAAAAIRlEAAAAAAAAAAAhGkEAIQNBACEbQQEhBUEAIQJBASEcIBAhHiAOIR0CQANAIB0gHf3wASEhAkAgC/0MAAAAAAAAAAAAAAAAAAAAACIfIAogDyAR/fEB/ewB/fABIh0gHf3yASIPIB4gIf3yASAJ/fABIh4gHv3yASIR/fABIiD9DAAAAACAhC5BAAAAAICELkH9Sv1SIiH9HQAiIiAh/R0BIiOEUA0AIAWyQ3dz+EKSISQCQCAiUA0AIAYgJCAg/SEAtrwiJbNDAAAANJRDd3P4wpIgJUH///8DcUGAgID4A3K+IiZDdb+/v5SSQ6Pp3L8gJkP5RLQ+kpWSQwAAAD+UvCIls0MAAAC0lJIgJUH///8DcUGAgID4A3K+IiZDdb+/P5SSQ6Pp3D8gJkP5RLQ+kpWSOAIACwJAICNQDQAgBiAkICD9IQG2vCIls0MAAAA0lEN3c/jCkiAlQf///wNxQYCAgPgDcr4iJkN1v7+/lJJDo+ncvyAmQ/lEtD6SlZJDAAAAP5S8IiWzQwAAALSUkiAlQf///wNxQYCAgPgDcr4iJEN1v78/lJJDo+ncPyAkQ/lEtD6SlZI4AgQLICEgC/1RIgv9HQAgC/0dAYRQDQILAkAgCEQAAAAAAAAAAGUNAAJAAkAgAg0AIAAhJUEAIQIMAQsCQCAFIAxHDQAgAkF/aiECQQAhDCAL/R0AUA0AIB39IQAgFaGZIB79IQAgF6GZoCAZZA0AIAZBgIDno3w2AgAgByATsjgCACALQgD9HgAhCwsCQAJAIAUgAEYNACAAISUMAQsgAkF/aiECQQAhJSAL/R0BUA0AIB39IQEgFqGZIB79IQEgGKGZoCAaZA0AIAZBgIDno3w2AgQgByAUsjgCBCALQgD9HgEhCwsgC/0dACAL/R0BhFANAwsCQAJAIAsgHyAdIA798QH97AEgHiAQ/fEB/ewB/fABIiAgEv1J/VIiIf0dACIiICH9HQEiI4RQDQAgBCAbayEAIAUgG2shAwJAICJQDQAgDA0AIAJBAWohAiAg/SEAIRkgHv0hACEXIB39IQAhFSAAIQwgAyETCyAjUA0AICUNACACQQFqIQIgIP0hASEaIB79IQEhGCAd/SEBIRYMAQsgJSEAIBQhAwsCQCAFIBxGDQAgAyEUDAELIAMhFCAEIRwgBSEbIB4hECAdIQ4LIARBAmohBCAFIAFOIQMgDSAFQQFqIgVqQQFHDQALCyADQQFxRQ0NCwJAIAv9HQBQDQAgBkGAgOejfDYCAAJAIAhEAAAAAAAAAABkRQ0AIAdBADYCACAL/R0BUEUNCgwOCyAL/R0BUEUNCwwNCyAL/R0BUA0MIAZBgIDno3w2AgQgCEQAAAAAAAAAAGQNCQwMCwJAAkAgAUEBTg0A/Qz/////////////////////IQsMAQtBACEMQQAgAWshDSACQQhqIAL9XQMA/VcDAAEiDiAO/fIBIR4gA0EIaiAD/V0DAP1XAwABIhAgEP3yASEdIAj9FCES/Qz/////////////////////IQtBAiEEQQAhAEEAIRNBACEURAAAAAAAAAAAIRVEAAAAAAAAAAAhFkQAAAAAAAAAACEXRAAAAAAAAAAAIRhEAAAAAAAAAAAhGUQAAAAAAAAAACEaQQAhA0EAIRtBASEFQQAhAkEBIRwgECEPIA4hEQJAA0AgHSAeIh79DAAAAAAAABjAAAAAAAAAGMD98gH98AEgHf3yASEhAkAgC/0MAAAAAAAAAAAAAAAAAAAAACIfIB4gHf3xASAP/QwAAAAAAAAQQAAAAAAAABBA/fIBIBH98gH97AH98gEgCf3wASIPIA/98gEiHSAhIB4gHv3yASAK/fAB/fABIhEgEf3yASIe/fABIiD9DAAAAACAhC5BAAAAAICELkH9Sv1SIiH9HQAiIiAh/R0BIiOEUA0AIAWyISQCQCAiUA0AIAYgJCAg/SEAtrwiJbNDAAAANJRDd3P4wpIgJUH///8DcUGAgID4A3K+IiZDdb+/v5SSQ6Pp3L8gJkP5RLQ+kpWSQwAAAD+UvCIls0MAAAA0lEN3c/jCkiAlQf///wNxQYCAgPgDcr4iJkN1v7+/lJJDo+ncvyAmQ/lEtD6SlZJDAAAAP5STOAIACwJAICNQDQAgBiAkICD9IQG2vCIls0MAAAA0lEN3c/jCkiAlQf///wNxQYCAgPgDcr4iJkN1v7+/lJJDo+ncvyAmQ/lEtD6SlZJDAAAAP5S8IiWzQwAAADSUQ3dz+MKSICVB////A3FBgICA+ANyviImQ3W/v7+UkkOj6dy/ICZD+US0PpKVkkMAAAA/lJM4AgQLICEgC/1RIgv9HQAgC/0dAYRQDQILAkAgCEQAAAAAAAAAAGUNAAJAAkAgAg0AIAAhJUEAIQIMAQsCQCAFIAxHDQAgAkF/aiECQQAhDCAL/R0AUA0AIBH9IQAgFaGZIA/9IQAgF6GZoCAZZA0AIAZBgIDno3w2AgAgByATsjgCACALQgD9HgAhCwsCQAJAIAUgAEYNACAAISUMAQsgAkF/aiECQQAhJSAL/R0BUA0AIBH9IQEgFqGZIA/9IQEgGKGZoCAaZA0AIAZBgIDno3w2AgQgByAUsjgCBCALQgD9HgEhCwsgC/0dACAL/R0BhFANAwsCQAJAIAsgHyAPIBD98QH97AEgESAO/fEB/ewB/fABIiAgEv1J/VIiIf0dACIiICH9HQEiI4RQDQAgBCAbayEAIAUgG2shAwJAICJQDQAgDA0AIAJBAWohAiAg/SEAIRkgD/0hACEXIBH9IQAhFSAAIQwgAyETCyAjUA0AICUNACACQQFqIQIgIP0hASEaIA/9IQEhGCAR/SEBIRYMAQsgJSEAIBQhAwsCQCAFIBxGDQAgAyEUDAELIAMhFCAEIRwgBSEbIA8hECARIQ4LIARBAmohBCAFIAFOIQMgDSAFQQFqIgVqQQFHDQALCyADQQFxRQ0MCwJAIAv9HQBQDQAgBkGAgOejfDYCAAJAIAhEAAAAAAAAAABkRQ0AIAdBADYCACAL/R0BUEUNCQwNCyAL/R0BUEUNCgwMCyAL/R0BUA0LIAZBgIDno3w2AgQgCEQAAAAAAAAAAGQNCAwLCwJAAkAgAUEBTg0A/Qz/////////////////////IR8MAQtBACEMQQAgAWshDSACQQhqIAL9XQMA/VcDAAEiDiAO/fIBIQ8gA0EIaiAD/V0DAP1XAwABIhAgEP3yASERIAj9FCES/Qz/////////////////////IR9BAiEEQQAhAEEAIRNBACEURAAAAAAAAAAAIRVEAAAAAAAAAAAhFkQAAAAAAAAAACEXRAAAAAAAAAAAIRhEAAAAAAAAAAAhGUQAAAAAAAAAACEaQQAhA0EAIRtBASEFQQAhAkEBIRwgECEdIA4hHgJAA0AgD/0MAAAAAAAACEAAAAAAAAAIQCIh/fIBIQsCQCAf/QwAAAAAAAAAAAAAAAAAAAAAIiAgDyARIhEgIf3yAf3xASAe/ewB/fIBIAr98AEiHiAe/fIBIg8gCyAR/fEBIB397AH98gEgCf3wASIdIB398gEiEf3wASIL/QwAAAAAgIQuQQAAAACAhC5B/Ur9UiIh/R0AIiIgIf0dASIjhFANACAFsiEkAkAgIlANACAGICQgC/0hALa8IiWzQwAAADSUQ3dz+MKSICVB////A3FBgICA+ANyviImQ3W/v7+UkkOj6dy/ICZD+US0PpKVkkMAAAA/lLwiJbNDAAAANJRDd3P4wpIgJUH///8DcUGAgID4A3K+IiZDdb+/v5SSQ6Pp3L8gJkP5RLQ+kpWSQ52EIb+UkjgCAAsCQCAjUA0AIAYgJCAL/SEBtrwiJbNDAAAANJRDd3P4wpIgJUH///8DcUGAgID4A3K+IiZDdb+/v5SSQ6Pp3L8gJkP5RLQ+kpWSQwAAAD+UvCIls0MAAAA0lEN3c/jCkiAlQf///wNxQYCAgPgDcr4iJkN1v7+/lJJDo+ncvyAmQ/lEtD6SlZJDnYQhv5SSOAIECyAhIB/9USIf/R0AIB/9HQGEUA0CCwJAIAhEAAAAAAAAAABlDQACQAJAIAINACAAISVBACECDAELAkAgBSAMRw0AIAJBf2ohAkEAIQwgH/0dAFANACAe/SEAIBWhmSAd/SEAIBehmaAgGWQNACAGQYCA56N8NgIAIAcgE7I4AgAgH0IA/R4AIR8LAkACQCAFIABGDQAgACElDAELIAJBf2ohAkEAISUgH/0dAVANACAe/SEBIBahmSAd/SEBIBihmaAgGmQNACAGQYCA56N8NgIEIAcgFLI4AgQgH0IA/R4BIR8LIB/9HQAgH/0dAYRQDQMLAkACQCAfICAgHiAO/fEB/ewBIB0gEP3xAf3sAf3wASILIBL9Sf1SIiH9HQAiIiAh/R0BIiOEUA0AIAQgG2shACAFIBtrIQMCQCAiUA0AIAwNACACQQFqIQIgC/0hACEZIB39IQAhFyAe/SEAIRUgACEMIAMhEwsgI1ANACAlDQAgAkEBaiECIAv9IQEhGiAd/SEBIRggHv0hASEWDAELICUhACAUIQMLAkAgBSAcRg0AIAMhFAwBCyADIRQgBCEcIAUhGyAdIRAgHiEOCyAEQQJqIQQgBSABTiEDIA0gBUEBaiIFakEBRw0ACwsgA0EBcUUNCwsCQCAf/R0AUA0AIAZBgIDno3w2AgACQCAIRAAAAAAAAAAAZEUNACAHQQA2AgAgH/0dAVBFDQgMDAsgH/0dAVBFDQkMCwsgH/0dAVANCiAGQYCA56N8NgIEIAhEAAAAAAAAAABkDQcMCgsCQAJAIAFBAU4NAP0M/////////////////////yELDAELQQAhDEEAIAFrIQ0gAkEIaiAC/V0DAP1XAwABIg4gDv3yASEPIANBCGogA/1dAwD9VwMAASIQIBD98gEhESAI/RQhEv0M/////////////////////yELQQIhBEEAIQBBACETQQAhFEQAAAAAAAAAACEVRAAAAAAAAAAAIRZEAAAAAAAAAAAhF0QAAAAAAAAAACEYRAAAAAAAAAAAIRlEAAAAAAAAAAAhGkEAIQNBACEbQQEhBUEAIQJBASEcIBAhHSAOIR4CQANAIA8gEf3xASEPAkAgC/0MAAAAAAAAAAAAAAAAAAAAACIfIAkgHSAeIh4gHv3wAf3yAf3sAf3wASIdIB398gEiESAPIAr98AEiHiAe/fIBIg/98AEiIP0MAAAAAICELkEAAAAAgIQuQf1K/VIiIf0dACIiICH9HQEiI4RQDQAgBbJDd3P4QpIhJAJAICJQDQAgBiAkICD9IQC2vCIls0MAAAA0lEN3c/jCkiAlQf///wNxQYCAgPgDcr4iJkN1v7+/lJJDo+ncvyAmQ/lEtD6SlZJDAAAAP5S8IiWzQwAAALSUkiAlQf///wNxQYCAgPgDcr4iJkN1v78/lJJDo+ncPyAmQ/lEtD6SlZI4AgALAkAgI1ANACAGICQgIP0hAba8IiWzQwAAADSUQ3dz+MKSICVB////A3FBgICA+ANyviImQ3W/v7+UkkOj6dy/ICZD+US0PpKVkkMAAAA/lLwiJbNDAAAAtJSSICVB////A3FBgICA+ANyviIkQ3W/vz+UkkOj6dw/ICRD+US0PpKVkjgCBAsgISAL/VEiC/0dACAL/R0BhFANAgsCQCAIRAAAAAAAAAAAZQ0AAkACQCACDQAgACElQQAhAgwBCwJAIAUgDEcNACACQX9qIQJBACEMIAv9HQBQDQAgHv0hACAVoZkgHf0hACAXoZmgIBlkDQAgBkGAgOejfDYCACAHIBOyOAIAIAtCAP0eACELCwJAAkAgBSAARg0AIAAhJQwBCyACQX9qIQJBACElIAv9HQFQDQAgHv0hASAWoZkgHf0hASAYoZmgIBpkDQAgBkGAgOejfDYCBCAHIBSyOAIEIAtCAP0eASELCyAL/R0AIAv9HQGEUA0DCwJAAkAgCyAfIB0gEP3xAf3sASAeIA798QH97AH98AEiICAS/Un9UiIh/R0AIiIgIf0dASIjhFANACAEIBtrIQAgBSAbayEDAkAgIlANACAMDQAgAkEBaiECICD9IQAhGSAd/SEAIRcgHv0hACEVIAAhDCADIRMLICNQDQAgJQ0AIAJBAWohAiAg/SEBIRogHf0hASEYIB79IQEhFgwBCyAlIQAgFCEDCwJAIAUgHEYNACADIRQMAQsgAyEUIAQhHCAFIRsgHSEQIB4hDgsgBEECaiEEIAUgAU4hAyANIAVBAWoiBWpBAUcNAAsLIANBAXFFDQoLAkAgC/0dAFANACAGQYCA56N8NgIAAkAgCEQAAAAAAAAAAGRFDQAgB0EANgIAIAv9HQFQRQ0HDAsLIAv9HQFQRQ0IDAoLIAv9HQFQDQkgBkGAgOejfDYCBCAIRAAAAAAAAAAAZA0GDAkLAkACQCABQQFODQD9DP////////////////////8hEAwBC0EAIQxBACABayENIAJBCGogAv1dAwD9VwMAASIoICj98gEhHSADQQhqIAP9XQMA/VcDAAEiKSAp/fIBIR4gCP0UISr9DP////////////////////8hEEECIQRBACEAQQAhE0EAIRREAAAAAAAAAAAhFUQAAAAAAAAAACEWRAAAAAAAAAAAIRdEAAAAAAAAAAAhGEQAAAAAAAAAACEZRAAAAAAAAAAAIRpBACEDQQAhG0EBIQVBACECQQEhHCApIQ8gKCERAkADQCAd/QwAAAAAAAAcQAAAAAAAABxAIiH98gEhCyAd/QwAAAAAAAA1QAAAAAAAADVAIh/98gEhIAJAIBD9DAAAAAAAAAAAAAAAAAAAAAAiEiAd/QwAAAAAAIBBQAAAAAAAgEFAIg798gEgHiIeICH98gH98QEgHiAe/fIBIiH98gEgHSAeIB/98gH98QEgHSAd/fIBIh/98gH98AEgEf3yASAK/fABIhEgEf3yASIdIB8gCyAeIA798gH98QH98gEgICAe/fEBICH98gH98AEgD/3yASAJ/fABIg8gD/3yASIe/fABIgv9DAAAAACAhC5BAAAAAICELkH9Sv1SIiH9HQAiIiAh/R0BIiOEUA0AIAWyISQCQCAiUA0AIAYgJCAL/SEAtrwiJbNDAAAANJRDd3P4wpIgJUH///8DcUGAgID4A3K+IiZDdb+/v5SSQ6Pp3L8gJkP5RLQ+kpWSQwAAAD+UvCIls0MAAAA0lEN3c/jCkiAlQf///wNxQYCAgPgDcr4iJkN1v7+/lJJDo+ncvyAmQ/lEtD6SlZJDymC2vpSSOAIACwJAICNQDQAgBiAkIAv9IQG2vCIls0MAAAA0lEN3c/jCkiAlQf///wNxQYCAgPgDcr4iJkN1v7+/lJJDo+ncvyAmQ/lEtD6SlZJDAAAAP5S8IiWzQwAAADSUQ3dz+MKSICVB////A3FBgICA+ANyviImQ3W/v7+UkkOj6dy/ICZD+US0PpKVkkPKYLa+lJI4AgQLICEgEP1RIhD9HQAgEP0dAYRQDQILAkAgCEQAAAAAAAAAAGUNAAJAAkAgAg0AIAAhJUEAIQIMAQsCQCAFIAxHDQAgAkF/aiECQQAhDCAQ/R0AUA0AIBH9IQAgFaGZIA/9IQAgF6GZoCAZZA0AIAZBgIDno3w2AgAgByATsjgCACAQQgD9HgAhEAsCQAJAIAUgAEYNACAAISUMAQsgAkF/aiECQQAhJSAQ/R0BUA0AIBH9IQEgFqGZIA/9IQEgGKGZoCAaZA0AIAZBgIDno3w2AgQgByAUsjgCBCAQQgD9HgEhEAsgEP0dACAQ/R0BhFANAwsCQAJAIBAgEiARICj98QH97AEgDyAp/fEB/ewB/fABIgsgKv1J/VIiIf0dACIiICH9HQEiI4RQDQAgBCAbayEAIAUgG2shAwJAICJQDQAgDA0AIAJBAWohAiAL/SEAIRkgD/0hACEXIBH9IQAhFSAAIQwgAyETCyAjUA0AICUNACACQQFqIQIgC/0hASEaIA/9IQEhGCAR/SEBIRYMAQsgJSEAIBQhAwsCQCAFIBxGDQAgAyEUDAELIAMhFCAEIRwgBSEbIA8hKSARISgLIARBAmohBCAFIAFOIQMgDSAFQQFqIgVqQQFHDQALCyADQQFxRQ0JCwJAIBD9HQBQDQAgBkGAgOejfDYCAAJAIAhEAAAAAAAAAABkRQ0AIAdBADYCACAQ/R0BUEUNBgwKCyAQ/R0BUEUNBwwJCyAQ/R0BUA0IIAZBgIDno3w2AgQgCEQAAAAAAAAAAGQNBQwICwJAAkAgAUEBTg0A/Qz/////////////////////IQ4MAQtBACEMQQAgAWshDSACQQhqIAL9XQMA/VcDAAEiEiAS/fIBIR4gA0EIaiAD/V0DAP1XAwABIiggKP3yASEdIAj9FCEp/Qz/////////////////////IQ5BAiEEQQAhAEEAIRNBACEURAAAAAAAAAAAIRVEAAAAAAAAAAAhFkQAAAAAAAAAACEXRAAAAAAAAAAAIRhEAAAAAAAAAAAhGUQAAAAAAAAAACEaQQAhA0EAIRtBASEFQQAhAkEBIRwgKCEPIBIhEQJAA0AgHiIeIB798gEiIf0MAAAAAAAALkAAAAAAAAAuQCIf/fIBIB0gHf3yASIL/fABIB398gEhIAJAIA79DAAAAAAAAAAAAAAAAAAAAAAiECARIA/98gEgISAL/fAB/QwAAAAAAAAYQAAAAAAAABhA/fIBIB39DAAAAAAAADTAAAAAAAAANMD98gEgHv3yAf3wAf3yASAJ/fABIg8gD/3yASIdIAogIP3xASALIB/98gEgIf3wASAe/fIB/fABIhEgEf3yASIe/fABIgv9DAAAAACAhC5BAAAAAICELkH9Sv1SIiH9HQAiIiAh/R0BIiOEUA0AIAWyISQCQCAiUA0AIAYgJCAL/SEAtrwiJbNDAAAANJRDd3P4wpIgJUH///8DcUGAgID4A3K+IiZDdb+/v5SSQ6Pp3L8gJkP5RLQ+kpWSQwAAAD+UvCIls0MAAAA0lEN3c/jCkiAlQf///wNxQYCAgPgDcr4iJkN1v7+/lJJDo+ncvyAmQ/lEtD6SlZJDkhHGvpSSOAIACwJAICNQDQAgBiAkIAv9IQG2vCIls0MAAAA0lEN3c/jCkiAlQf///wNxQYCAgPgDcr4iJkN1v7+/lJJDo+ncvyAmQ/lEtD6SlZJDAAAAP5S8IiWzQwAAADSUQ3dz+MKSICVB////A3FBgICA+ANyviImQ3W/v7+UkkOj6dy/ICZD+US0PpKVkkOSEca+lJI4AgQLICEgDv1RIg79HQAgDv0dAYRQDQILAkAgCEQAAAAAAAAAAGUNAAJAAkAgAg0AIAAhJUEAIQIMAQsCQCAFIAxHDQAgAkF/aiECQQAhDCAO/R0AUA0AIBH9IQAgFaGZIA/9IQAgF6GZoCAZZA0AIAZBgIDno3w2AgAgByATsjgCACAOQgD9HgAhDgsCQAJAIAUgAEYNACAAISUMAQsgAkF/aiECQQAhJSAO/R0BUA0AIBH9IQEgFqGZIA/9IQEgGKGZoCAaZA0AIAZBgIDno3w2AgQgByAUsjgCBCAOQgD9HgEhDgsgDv0dACAO/R0BhFANAwsCQAJAIA4gECARIBL98QH97AEgDyAo/fEB/ewB/fABIgsgKf1J/VIiIf0dACIiICH9HQEiI4RQDQAgBCAbayEAIAUgG2shAwJAICJQDQAgDA0AIAJBAWohAiAL/SEAIRkgD/0hACEXIBH9IQAhFSAAIQwgAyETCyAjUA0AICUNACACQQFqIQIgC/0hASEaIA/9IQEhGCAR/SEBIRYMAQsgJSEAIBQhAwsCQCAFIBxGDQAgAyEUDAELIAMhFCAEIRwgBSEbIA8hKCARIRILIARBAmohBCAFIAFOIQMgDSAFQQFqIgVqQQFHDQALCyADQQFxRQ0ICwJAIA79HQBQDQAgBkGAgOejfDYCAAJAIAhEAAAAAAAAAABkRQ0AIAdBADYCACAO/R0BUEUNBQwJCyAO/R0BUEUNBgwICyAO/R0BUA0HIAZBgIDno3w2AgQgCEQAAAAAAAAAAGQNBAwHCwJAAkAgAUEBTg0A/Qz/////////////////////ISAMAQtBACEMQQAgAWshDSACQQhqIAL9XQMA/VcDAAEiECAQ/fIBIR4gA0EIaiAD/V0DAP1XAwABIhIgEv3yASEdIAj9FCEo/Qz/////////////////////ISBBAiEEQQAhAEEAIRNBACEURAAAAAAAAAAAIRVEAAAAAAAAAAAhFkQAAAAAAAAAACEXRAAAAAAAAAAAIRhEAAAAAAAAAAAhGUQAAAAAAAAAACEaQQAhA0EAIRtBASEFQQAhAkEBIRwgEiEPIBAhEQJAA0ACQCAg/QwAAAAAAAAAAAAAAAAAAAAAIg4gHiIe/QwAAAAAAAAUQAAAAAAAABRAIiH98gEgHf0MAAAAAAAAJEAAAAAAAAAkQP3yASIL/fEBIB798gEgHSAd/fIBIh/98AEgD/3yASAJ/fABIg8gD/3yASIdIB4gC/3xASAe/fIBIB8gIf3yAf3wASAR/fIBIAr98AEiESAR/fIBIh798AEiC/0MAAAAAICELkEAAAAAgIQuQf1K/VIiIf0dACIiICH9HQEiI4RQDQAgBbIhJAJAICJQDQAgBiAkIAv9IQC2vCIls0MAAAA0lEN3c/jCkiAlQf///wNxQYCAgPgDcr4iJkN1v7+/lJJDo+ncvyAmQ/lEtD6SlZJDAAAAP5S8IiWzQwAAADSUQ3dz+MKSICVB////A3FBgICA+ANyviImQ3W/v7+UkkOj6dy/ICZD+US0PpKVkkOjgdy+lJI4AgALAkAgI1ANACAGICQgC/0hAba8IiWzQwAAADSUQ3dz+MKSICVB////A3FBgICA+ANyviImQ3W/v7+UkkOj6dy/ICZD+US0PpKVkkMAAAA/lLwiJbNDAAAANJRDd3P4wpIgJUH///8DcUGAgID4A3K+IiZDdb+/v5SSQ6Pp3L8gJkP5RLQ+kpWSQ6OB3L6UkjgCBAsgISAg/VEiIP0dACAg/R0BhFANAgsCQCAIRAAAAAAAAAAAZQ0AAkACQCACDQAgACElQQAhAgwBCwJAIAUgDEcNACACQX9qIQJBACEMICD9HQBQDQAgEf0hACAVoZkgD/0hACAXoZmgIBlkDQAgBkGAgOejfDYCACAHIBOyOAIAICBCAP0eACEgCwJAAkAgBSAARg0AIAAhJQwBCyACQX9qIQJBACElICD9HQFQDQAgEf0hASAWoZkgD/0hASAYoZmgIBpkDQAgBkGAgOejfDYCBCAHIBSyOAIEICBCAP0eASEgCyAg/R0AICD9HQGEUA0DCwJAAkAgICAOIA8gEv3xAf3sASARIBD98QH97AH98AEiCyAo/Un9UiIh/R0AIiIgIf0dASIjhFANACAEIBtrIQAgBSAbayEDAkAgIlANACAMDQAgAkEBaiECIAv9IQAhGSAP/SEAIRcgEf0hACEVIAAhDCADIRMLICNQDQAgJQ0AIAJBAWohAiAL/SEBIRogD/0hASEYIBH9IQEhFgwBCyAlIQAgFCEDCwJAIAUgHEYNACADIRQMAQsgAyEUIAQhHCAFIRsgDyESIBEhEAsgBEECaiEEIAUgAU4hAyANIAVBAWoiBWpBAUcNAAsLIANBAXFFDQcLAkAgIP0dAFANACAGQYCA56N8NgIAAkAgCEQAAAAAAAAAAGRFDQAgB0EANgIAICD9HQFQRQ0EDAgLICD9HQFQRQ0FDAcLICD9HQFQDQYgBkGAgOejfDYCBCAIRAAAAAAAAAAAZA0DDAYLAkACQCABQQFODQD9DP////////////////////8hHwwBC0EAIQxBACABayENIAJBCGogAv1dAwD9VwMAASIOIA798gEhESADQQhqIAP9XQMA/VcDAAEiECAQ/fIBIR0gCP0UIRL9DP////////////////////8hH0ECIQRBACEAQQAhE0EAIRREAAAAAAAAAAAhFUQAAAAAAAAAACEWRAAAAAAAAAAAIRdEAAAAAAAAAAAhGEQAAAAAAAAAACEZRAAAAAAAAAAAIRpBACEDQQAhG0EBIQVBACECQQEhHCAQIR4gDiEPAkADQCAdIB398gEhISAd/QwAAAAAAAAYwAAAAAAAABjA/fIBIQsCQCAf/QwAAAAAAAAAAAAAAAAAAAAAIiAgHv0MAAAAAAAAEEAAAAAAAAAQQP3yASARIhEgHf3xAf3yASAP/fIBIAn98AEiHiAe/fIBIh0gISAK/fABIBEgC/3wASAR/fIB/fABIg8gD/3yASIR/fABIgv9DAAAAACAhC5BAAAAAICELkH9Sv1SIiH9HQAiIiAh/R0BIiOEUA0AIAWyISQCQCAiUA0AIAYgJCAL/SEAtrwiJbNDAAAANJRDd3P4wpIgJUH///8DcUGAgID4A3K+IiZDdb+/v5SSQ6Pp3L8gJkP5RLQ+kpWSQwAAAD+UvCIls0MAAAA0lEN3c/jCkiAlQf///wNxQYCAgPgDcr4iJkN1v7+/lJJDo+ncvyAmQ/lEtD6SlZJDAAAAP5STOAIACwJAICNQDQAgBiAkIAv9IQG2vCIls0MAAAA0lEN3c/jCkiAlQf///wNxQYCAgPgDcr4iJkN1v7+/lJJDo+ncvyAmQ/lEtD6SlZJDAAAAP5S8IiWzQwAAADSUQ3dz+MKSICVB////A3FBgICA+ANyviImQ3W/v7+UkkOj6dy/ICZD+US0PpKVkkMAAAA/lJM4AgQLICEgH/1RIh/9HQAgH/0dAYRQDQILAkAgCEQAAAAAAAAAAGUNAAJAAkAgAg0AIAAhJUEAIQIMAQsCQCAFIAxHDQAgAkF/aiECQQAhDCAf/R0AUA0AIA/9IQAgFaGZIB79IQAgF6GZoCAZZA0AIAZBgIDno3w2AgAgByATsjgCACAfQgD9HgAhHwsCQAJAIAUgAEYNACAAISUMAQsgAkF/aiECQQAhJSAf/R0BUA0AIA/9IQEgFqGZIB79IQEgGKGZoCAaZA0AIAZBgIDno3w2AgQgByAUsjgCBCAfQgD9HgEhHwsgH/0dACAf/R0BhFANAwsCQAJAIB8gICAeIBD98QH97AEgDyAO/fEB/ewB/fABIgsgEv1J/VIiIf0dACIiICH9HQEiI4RQDQAgBCAbayEAIAUgG2shAwJAICJQDQAgDA0AIAJBAWohAiAL/SEAIRkgHv0hACEXIA/9IQAhFSAAIQwgAyETCyAjUA0AICUNACACQQFqIQIgC/0hASEaIB79IQEhGCAP/SEBIRYMAQsgJSEAIBQhAwsCQCAFIBxGDQAgAyEUDAELIAMhFCAEIRwgBSEbIB4hECAPIQ4LIARBAmohBCAFIAFOIQMgDSAFQQFqIgVqQQFHDQALCyADQQFxRQ0GCwJAIB/9HQBQDQAgBkGAgOejfDYCAAJAIAhEAAAAAAAAAABkRQ0AIAdBADYCACAf/R0BUEUNAwwHCyAf/R0BUEUNBAwGCyAf/R0BUA0FIAZBgIDno3w2AgQgCEQAAAAAAAAAAGQNAgwFCwJAAkAgAUEBTg0A/Qz/////////////////////IR8MAQtBACEMQQAgAWshDSACQQhqIAL9XQMA/VcDAAEiDiAO/fIBIQ8gA0EIaiAD/V0DAP1XAwABIhAgEP3yASERIAj9FCES/Qz/////////////////////IR9BAiEEQQAhAEEAIRNBACEURAAAAAAAAAAAIRVEAAAAAAAAAAAhFkQAAAAAAAAAACEXRAAAAAAAAAAAIRhEAAAAAAAAAAAhGUQAAAAAAAAAACEaQQAhA0EAIRtBASEFQQAhAkEBIRwgECEdIA4hHgJAA0AgD/0MAAAAAAAACEAAAAAAAAAIQCIh/fIBIQsCQCAf/QwAAAAAAAAAAAAAAAAAAAAAIiAgHiAPIBEiESAh/fIB/fEB/fIBIAr98AEiHiAe/fIBIg8gCyAR/fEBIB398gEgCf3wASIdIB398gEiEf3wASIL/QwAAAAAgIQuQQAAAACAhC5B/Ur9UiIh/R0AIiIgIf0dASIjhFANACAFsiEkAkAgIlANACAGICQgC/0hALa8IiWzQwAAADSUQ3dz+MKSICVB////A3FBgICA+ANyviImQ3W/v7+UkkOj6dy/ICZD+US0PpKVkkMAAAA/lLwiJbNDAAAANJRDd3P4wpIgJUH///8DcUGAgID4A3K+IiZDdb+/v5SSQ6Pp3L8gJkP5RLQ+kpWSQ52EIb+UkjgCAAsCQCAjUA0AIAYgJCAL/SEBtrwiJbNDAAAANJRDd3P4wpIgJUH///8DcUGAgID4A3K+IiZDdb+/v5SSQ6Pp3L8gJkP5RLQ+kpWSQwAAAD+UvCIls0MAAAA0lEN3c/jCkiAlQf///wNxQYCAgPgDcr4iJkN1v7+/lJJDo+ncvyAmQ/lEtD6SlZJDnYQhv5SSOAIECyAhIB/9USIf/R0AIB/9HQGEUA0CCwJAIAhEAAAAAAAAAABlDQACQAJAIAINACAAISVBACECDAELAkAgBSAMRw0AIAJBf2ohAkEAIQwgH/0dAFANACAe/SEAIBWhmSAd/SEAIBehmaAgGWQNACAGQYCA56N8NgIAIAcgE7I4AgAgH0IA/R4AIR8LAkACQCAFIABGDQAgACElDAELIAJBf2ohAkEAISUgH/0dAVANACAe/SEBIBahmSAd/SEBIBihmaAgGmQNACAGQYCA56N8NgIEIAcgFLI4AgQgH0IA/R4BIR8LIB/9HQAgH/0dAYRQDQMLAkACQCAfICAgHiAO/fEB/ewBIB0gEP3xAf3sAf3wASILIBL9Sf1SIiH9HQAiIiAh/R0BIiOEUA0AIAQgG2shACAFIBtrIQMCQCAiUA0AIAwNACACQQFqIQIgC/0hACEZIB39IQAhFyAe/SEAIRUgACEMIAMhEwsgI1ANACAlDQAgAkEBaiECIAv9IQEhGiAd/SEBIRggHv0hASEWDAELICUhACAUIQMLAkAgBSAcRg0AIAMhFAwBCyADIRQgBCEcIAUhGyAdIRAgHiEOCyAEQQJqIQQgBSABTiEDIA0gBUEBaiIFakEBRw0ACwsgA0EBcUUNBQsCQCAf/R0AUA0AIAZBgIDno3w2AgACQCAIRAAAAAAAAAAAZEUNACAHQQA2AgAgH/0dAVBFDQIMBgsgH/0dAVBFDQMMBQsgH/0dAVANBCAGQYCA56N8NgIEIAhEAAAAAAAAAABkDQEMBAsgBkGAgOejfDYCBAtDAAAAACEkDAELQwDAecQhJCAGIQcLIAcgJDgCBAsL1bUBDgN7An8FewJ/BnwCfwV7An4BfQF/AX0DfAF/A3sgBUEIaiAF/V0DAP1XAwABIQkgBEEIaiAE/V0DAP1XAwABIQoCQAJAAkACQAJAAkACQAJAAkACQAJAAkACQAJAAkACQAJAAkACQAJAAkAgAEF/ag4PAA8ODQwLCgkIBwYFBAMCAQsCQAJAIAFBAU4NAP0M/////////////////////yELDAELQQAhDEEAIAFrIQ0gAkEIaiAC/V0DAP1XAwABIg4gDv3yASEPIANBCGogA/1dAwD9VwMAASIQIBD98gEhESAI/RQhEv0M/////////////////////yELQQIhBEEAIQBBACETQQAhFEQAAAAAAAAAACEVRAAAAAAAAAAAIRZEAAAAAAAAAAAhF0QAAAAAAAAAACEYRAAAAAAAAAAAIRlEAAAAAAAAAAAhGkEAIQNBACEbQQEhBUEAIQJBASEcIBAhHSAOIR4CQANAIA8gEf3xASEPAkAgC/0MAAAAAAAAAAAAAAAAAAAAACIfIB0gHiIeIB798AH98gEgCf3wASIdIB398gEiESAPIAr98AEiHiAe/fIBIg/98AEiIP0MAAAAAICELkEAAAAAgIQuQf1K/VIiIf0dACIiICH9HQEiI4RQDQAgBbJDd3P4QpIhJAJAICJQDQAgBiAkICD9IQC2vCIls0MAAAA0lEN3c/jCkiAlQf///wNxQYCAgPgDcr4iJkN1v7+/lJJDo+ncvyAmQ/lEtD6SlZJDAAAAP5S8IiWzQwAAALSUkiAlQf///wNxQYCAgPgDcr4iJkN1v78/lJJDo+ncPyAmQ/lEtD6SlZI4AgAgByAd/SEAIidEAAAAYJ6g9j+iICcgHv0hACIooCIpICmiICcgKKEiJyAnoqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIACwJAICNQDQAgBiAkICD9IQG2vCIls0MAAAA0lEN3c/jCkiAlQf///wNxQYCAgPgDcr4iJkN1v7+/lJJDo+ncvyAmQ/lEtD6SlZJDAAAAP5S8IiWzQwAAALSUkiAlQf///wNxQYCAgPgDcr4iJEN1v78/lJJDo+ncPyAkQ/lEtD6SlZI4AgQgByAd/SEBIidEAAAAYJ6g9j+iICcgHv0hASIooCIpICmiICcgKKEiJyAnoqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIECyAhIAv9USIL/R0AIAv9HQGEUA0CCwJAIAhEAAAAAAAAAABlDQACQAJAIAINACAAISVBACECDAELAkAgBSAMRw0AIAJBf2ohAkEAIQwgC/0dAFANACAe/SEAIBWhmSAd/SEAIBehmaAgGWQNACAGQYCA56N8NgIAIAcgE7I4AgAgC0IA/R4AIQsLAkACQCAFIABGDQAgACElDAELIAJBf2ohAkEAISUgC/0dAVANACAe/SEBIBahmSAd/SEBIBihmaAgGmQNACAGQYCA56N8NgIEIAcgFLI4AgQgC0IA/R4BIQsLIAv9HQAgC/0dAYRQDQMLAkACQCALIB8gHSAQ/fEB/ewBIB4gDv3xAf3sAf3wASIgIBL9Sf1SIiH9HQAiIiAh/R0BIiOEUA0AIAQgG2shACAFIBtrIQMCQCAiUA0AIAwNACACQQFqIQIgIP0hACEZIB39IQAhFyAe/SEAIRUgACEMIAMhEwsgI1ANACAlDQAgAkEBaiECICD9IQEhGiAd/SEBIRggHv0hASEWDAELICUhACAUIQMLAkAgBSAcRg0AIAMhFAwBCyADIRQgBCEcIAUhGyAdIRAgHiEOCyAEQQJqIQQgBSABTiEDIA0gBUEBaiIFakEBRw0ACwsgA0EBcUUNFAsCQCAL/R0AUA0AIAZBgIDno3w2AgACQCAIRAAAAAAAAAAAZEUNACAHQQA2AgAgC/0dAVBFDREMFQsgC/0dAVANFAwSCyAL/R0BUA0TIAZBgIDno3w2AgQgCEQAAAAAAAAAAGQNEAwTCwJAAkAgAUEBTg0A/Qz/////////////////////IQsMAQsgAkEIaiAC/V0DAP1XAwABIg4gDv3yASEdIANBCGogA/1dAwD9VwMAASIQIBD98gEhHiAI/RQhEv0M/////////////////////yELQQAhBUECIQNBACETQQAhFEEAISpBACElRAAAAAAAAAAAIRVEAAAAAAAAAAAhFkQAAAAAAAAAACEXRAAAAAAAAAAAIRhEAAAAAAAAAAAhGUQAAAAAAAAAACEaQQAhAEEAIQxBASEEQQAhDUEBIRsgECEPIA4hEQNAAkACQCAEQQpuQQpsQX9qIAUiAkcNACAdIB798QEgD/0MAAAAAAAAEEAAAAAAAAAQQP3yASAR/fIB/ewB/fIBIQ8gHiAd/QwAAAAAAAAYwAAAAAAAABjA/fIB/fABIB798gEhESAdIB398gEhHQwBCyAP/QwAAAAAAAAQQAAAAAAAABBA/fIBIB0gHv3xAf3yASAR/fIBIQ8gHSAe/QwAAAAAAAAYwAAAAAAAABjA/fIB/fABIB398gEhESAeIB798gEhHQsgAkEBaiEFAkACQCAL/QwAAAAAAAAAAAAAAAAAAAAAIh8gDyAJ/fABIg8gD/3yASIeIB0gCv3wASAR/fABIhEgEf3yASId/fABIiD9DAAAAACAhC5BAAAAAICELkH9Sv1SIiH9HQAiIiAh/R0BIiOEUA0AIAWyISQCQCAiUA0AIAYgJCAg/SEAtrwiHLNDAAAANJRDd3P4wpIgHEH///8DcUGAgID4A3K+IiZDdb+/v5SSQ6Pp3L8gJkP5RLQ+kpWSQwAAAD+UvCIcs0MAAAA0lEN3c/jCkiAcQf///wNxQYCAgPgDcr4iJkN1v7+/lJJDo+ncvyAmQ/lEtD6SlZJDAAAAP5STOAIAIAcgD/0hACInRAAAAGCeoPY/oiAnIBH9IQAiKKAiKSApoiAnICihIicgJ6Kgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCAAsCQCAjUA0AIAYgJCAg/SEBtrwiHLNDAAAANJRDd3P4wpIgHEH///8DcUGAgID4A3K+IiZDdb+/v5SSQ6Pp3L8gJkP5RLQ+kpWSQwAAAD+UvCIcs0MAAAA0lEN3c/jCkiAcQf///wNxQYCAgPgDcr4iJkN1v7+/lJJDo+ncvyAmQ/lEtD6SlZJDAAAAP5STOAIEIAcgD/0hASInRAAAAGCeoPY/oiAnIBH9IQEiKKAiKSApoiAnICihIicgJ6Kgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCBAsgISAL/VEiC/0dACAL/R0BhFANAQsCQCAIRAAAAAAAAAAAZQ0AAkACQCANDQAgFCEcQQAhDQwBCwJAIAUgE0cNACANQX9qIQ1BACETIAv9HQBQDQAgEf0hACAVoZkgD/0hACAXoZmgIBlkDQAgBkGAgOejfDYCACAHICqyOAIAIAtCAP0eACELCwJAAkAgBSAURg0AIBQhHAwBCyANQX9qIQ1BACEcIAv9HQFQDQAgEf0hASAWoZkgD/0hASAYoZmgIBpkDQAgBkGAgOejfDYCBCAHICWyOAIEIAtCAP0eASELCyAL/R0AIAv9HQGEUA0CCwJAAkAgCyAfIA8gEP3xAf3sASARIA798QH97AH98AEiICAS/Un9UiIh/R0AIiIgIf0dASIjhFANACADIAxrIRQgAiAMa0EBaiECAkAgIlANACATDQAgDUEBaiENICD9IQAhGSAP/SEAIRcgEf0hACEVIBQhEyACISoLICNQDQAgHA0AIA1BAWohDSAg/SEBIRogD/0hASEYIBH9IQEhFgwBCyAcIRQgJSECCwJAIAUgG0YNACACISUMAQsgAiElIAMhGyAFIQwgDyEQIBEhDgsgA0ECaiEDIAUgAU4hACAEQQFqIQQgASAFRw0BCwsgAEEBcUUNEwsCQCAL/R0AUA0AIAZBgIDno3w2AgACQCAIRAAAAAAAAAAAZEUNACAHQQA2AgAgC/0dAVBFDRAMFAsgC/0dAVBFDREMEwsgC/0dAVANEiAGQYCA56N8NgIEIAhEAAAAAAAAAABkRQ0SDA8LAkACQCABQQFODQD9DP////////////////////8hCwwBCyACQQhqIAL9XQMA/VcDAAEiDiAO/fIBIREgA0EIaiAD/V0DAP1XAwABIhAgEP3yASEPIAj9FCES/Qz/////////////////////IQtBACEFQQIhA0EAIRNBACEUQQAhKkEAISVEAAAAAAAAAAAhFUQAAAAAAAAAACEWRAAAAAAAAAAAIRdEAAAAAAAAAAAhGEQAAAAAAAAAACEZRAAAAAAAAAAAIRpBACEAQQAhDEEBIQRBACENQQEhGyAQIR0gDiEeA0AgESERAkACQCAEQQpuQQpsQX9qIAUiAkcNACARIA/9DAAAAAAAAAjAAAAAAAAACMD98gH98AEgHv3sAf3yASEeIB397AEhHQwBCyAeIBEgD/0MAAAAAAAACMAAAAAAAAAIwP3yAf3wAf3yASEeCyACQQFqIQUCQAJAIAv9DAAAAAAAAAAAAAAAAAAAAAAiHyAR/QwAAAAAAAAIQAAAAAAAAAhA/fIBIA/98QEgHf3yASAJ/fABIh0gHf3yASIPIB4gCv3wASIeIB798gEiEf3wASIg/QwAAAAAgIQuQQAAAACAhC5B/Ur9UiIh/R0AIiIgIf0dASIjhFANACAFsiEkAkAgIlANACAGICQgIP0hALa8IhyzQwAAADSUQ3dz+MKSIBxB////A3FBgICA+ANyviImQ3W/v7+UkkOj6dy/ICZD+US0PpKVkkMAAAA/lLwiHLNDAAAANJRDd3P4wpIgHEH///8DcUGAgID4A3K+IiZDdb+/v5SSQ6Pp3L8gJkP5RLQ+kpWSQ52EIb+UkjgCACAHIB39IQAiJ0QAAABgnqD2P6IgJyAe/SEAIiigIikgKaIgJyAooSInICeioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgALAkAgI1ANACAGICQgIP0hAba8IhyzQwAAADSUQ3dz+MKSIBxB////A3FBgICA+ANyviImQ3W/v7+UkkOj6dy/ICZD+US0PpKVkkMAAAA/lLwiHLNDAAAANJRDd3P4wpIgHEH///8DcUGAgID4A3K+IiZDdb+/v5SSQ6Pp3L8gJkP5RLQ+kpWSQ52EIb+UkjgCBCAHIB39IQEiJ0QAAABgnqD2P6IgJyAe/SEBIiigIikgKaIgJyAooSInICeioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgQLICEgC/1RIgv9HQAgC/0dAYRQDQELAkAgCEQAAAAAAAAAAGUNAAJAAkAgDQ0AIBQhHEEAIQ0MAQsCQCAFIBNHDQAgDUF/aiENQQAhEyAL/R0AUA0AIB79IQAgFaGZIB39IQAgF6GZoCAZZA0AIAZBgIDno3w2AgAgByAqsjgCACALQgD9HgAhCwsCQAJAIAUgFEYNACAUIRwMAQsgDUF/aiENQQAhHCAL/R0BUA0AIB79IQEgFqGZIB39IQEgGKGZoCAaZA0AIAZBgIDno3w2AgQgByAlsjgCBCALQgD9HgEhCwsgC/0dACAL/R0BhFANAgsCQAJAIAsgHyAdIBD98QH97AEgHiAO/fEB/ewB/fABIiAgEv1J/VIiIf0dACIiICH9HQEiI4RQDQAgAyAMayEUIAIgDGtBAWohAgJAICJQDQAgEw0AIA1BAWohDSAg/SEAIRkgHf0hACEXIB79IQAhFSAUIRMgAiEqCyAjUA0AIBwNACANQQFqIQ0gIP0hASEaIB39IQEhGCAe/SEBIRYMAQsgHCEUICUhAgsCQCAFIBtGDQAgAiElDAELIAIhJSADIRsgBSEMIB0hECAeIQ4LIANBAmohAyAFIAFOIQAgBEEBaiEEIAEgBUcNAQsLIABBAXFFDRILAkAgC/0dAFANACAGQYCA56N8NgIAAkAgCEQAAAAAAAAAAGRFDQAgB0EANgIAIAv9HQFQDRMMDwsgC/0dAVBFDRAMEgsgC/0dAVANESAGQYCA56N8NgIEIAhEAAAAAAAAAABkDQ4MEQsCQAJAIAFBAU4NAP0M/////////////////////yELDAELIAJBCGogAv1dAwD9VwMAASIOIA798gEhDyADQQhqIAP9XQMA/VcDAAEiECAQ/fIBIREgCP0UIRL9DP////////////////////8hC0EAIQVBAiEDQQAhE0EAIRRBACEqQQAhJUQAAAAAAAAAACEVRAAAAAAAAAAAIRZEAAAAAAAAAAAhF0QAAAAAAAAAACEYRAAAAAAAAAAAIRlEAAAAAAAAAAAhGkEAIQBBACEMQQEhBEEAIQ1BASEbIBAhHiAOIR0CQANAIBEhISAFIgJBAWohBQJAIAv9DAAAAAAAAAAAAAAAAAAAAAAiHyAeIB0gHf3wAf3yASId/ewBIB0gAiAEQQpuQQpsQX9qRhsgCf3wASIeIB798gEiESAPICH98QEgCv3wASIdIB398gEiD/3wASIg/QwAAAAAgIQuQQAAAACAhC5B/Ur9UiIh/R0AIiIgIf0dASIjhFANACAFskN3c/hCkiEkAkAgIlANACAGICQgIP0hALa8IhyzQwAAADSUQ3dz+MKSIBxB////A3FBgICA+ANyviImQ3W/v7+UkkOj6dy/ICZD+US0PpKVkkMAAAA/lLwiHLNDAAAAtJSSIBxB////A3FBgICA+ANyviImQ3W/vz+UkkOj6dw/ICZD+US0PpKVkjgCACAHIB79IQAiJ0QAAABgnqD2P6IgJyAd/SEAIiigIikgKaIgJyAooSInICeioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgALAkAgI1ANACAGICQgIP0hAba8IhyzQwAAADSUQ3dz+MKSIBxB////A3FBgICA+ANyviImQ3W/v7+UkkOj6dy/ICZD+US0PpKVkkMAAAA/lLwiHLNDAAAAtJSSIBxB////A3FBgICA+ANyviIkQ3W/vz+UkkOj6dw/ICRD+US0PpKVkjgCBCAHIB79IQEiJ0QAAABgnqD2P6IgJyAd/SEBIiigIikgKaIgJyAooSInICeioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgQLICEgC/1RIgv9HQAgC/0dAYRQDQILAkAgCEQAAAAAAAAAAGUNAAJAAkAgDQ0AIBQhHEEAIQ0MAQsCQCAFIBNHDQAgDUF/aiENQQAhEyAL/R0AUA0AIB39IQAgFaGZIB79IQAgF6GZoCAZZA0AIAZBgIDno3w2AgAgByAqsjgCACALQgD9HgAhCwsCQAJAIAUgFEYNACAUIRwMAQsgDUF/aiENQQAhHCAL/R0BUA0AIB39IQEgFqGZIB79IQEgGKGZoCAaZA0AIAZBgIDno3w2AgQgByAlsjgCBCALQgD9HgEhCwsgC/0dACAL/R0BhFANAwsCQAJAIAsgHyAeIBD98QH97AEgHSAO/fEB/ewB/fABIiAgEv1J/VIiIf0dACIiICH9HQEiI4RQDQAgAyAMayEUIAIgDGtBAWohAgJAICJQDQAgEw0AIA1BAWohDSAg/SEAIRkgHv0hACEXIB39IQAhFSAUIRMgAiEqCyAjUA0AIBwNACANQQFqIQ0gIP0hASEaIB79IQEhGCAd/SEBIRYMAQsgHCEUICUhAgsCQCAFIBtGDQAgAiElDAELIAIhJSADIRsgBSEMIB4hECAdIQ4LIANBAmohAyAFIAFOIQAgBEEBaiEEIAEgBUcNAAsLIABBAXFFDRELAkAgC/0dAFANACAGQYCA56N8NgIAAkAgCEQAAAAAAAAAAGRFDQAgB0EANgIAIAv9HQFQRQ0ODBILIAv9HQFQRQ0PDBELIAv9HQFQDRAgBkGAgOejfDYCBCAIRAAAAAAAAAAAZA0NDBALAkACQCABQQFODQD9DP////////////////////8hCwwBC0EAIQxBACABayENIAJBCGogAv1dAwD9VwMAASIOIA798gEhDyADQQhqIAP9XQMA/VcDAAEiECAQ/fIBIREgCP0UIRL9DP////////////////////8hC0ECIQRBACEAQQAhE0EAIRREAAAAAAAAAAAhFUQAAAAAAAAAACEWRAAAAAAAAAAAIRdEAAAAAAAAAAAhGEQAAAAAAAAAACEZRAAAAAAAAAAAIRpBACEDQQAhG0EBIQVBACECQQEhHCAQIR0gDiEeAkADQCAPIBH98QEhDwJAIAv9DAAAAAAAAAAAAAAAAAAAAAAiHyAJIB0gHiIeIB798AH98gH98QEiHSAd/fIBIhEgDyAK/fABIh4gHv3yASIP/fABIiD9DAAAAACAhC5BAAAAAICELkH9Sv1SIiH9HQAiIiAh/R0BIiOEUA0AIAWyQ3dz+EKSISQCQCAiUA0AIAYgJCAg/SEAtrwiJbNDAAAANJRDd3P4wpIgJUH///8DcUGAgID4A3K+IiZDdb+/v5SSQ6Pp3L8gJkP5RLQ+kpWSQwAAAD+UvCIls0MAAAC0lJIgJUH///8DcUGAgID4A3K+IiZDdb+/P5SSQ6Pp3D8gJkP5RLQ+kpWSOAIAIAcgHf0hACInRAAAAGCeoPY/oiAnIB79IQAiKKAiKSApoiAnICihIicgJ6Kgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCAAsCQCAjUA0AIAYgJCAg/SEBtrwiJbNDAAAANJRDd3P4wpIgJUH///8DcUGAgID4A3K+IiZDdb+/v5SSQ6Pp3L8gJkP5RLQ+kpWSQwAAAD+UvCIls0MAAAC0lJIgJUH///8DcUGAgID4A3K+IiRDdb+/P5SSQ6Pp3D8gJEP5RLQ+kpWSOAIEIAcgHf0hASInRAAAAGCeoPY/oiAnIB79IQEiKKAiKSApoiAnICihIicgJ6Kgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCBAsgISAL/VEiC/0dACAL/R0BhFANAgsCQCAIRAAAAAAAAAAAZQ0AAkACQCACDQAgACElQQAhAgwBCwJAIAUgDEcNACACQX9qIQJBACEMIAv9HQBQDQAgHv0hACAVoZkgHf0hACAXoZmgIBlkDQAgBkGAgOejfDYCACAHIBOyOAIAIAtCAP0eACELCwJAAkAgBSAARg0AIAAhJQwBCyACQX9qIQJBACElIAv9HQFQDQAgHv0hASAWoZkgHf0hASAYoZmgIBpkDQAgBkGAgOejfDYCBCAHIBSyOAIEIAtCAP0eASELCyAL/R0AIAv9HQGEUA0DCwJAAkAgCyAfIB0gEP3xAf3sASAeIA798QH97AH98AEiICAS/Un9UiIh/R0AIiIgIf0dASIjhFANACAEIBtrIQAgBSAbayEDAkAgIlANACAMDQAgAkEBaiECICD9IQAhGSAd/SEAIRcgHv0hACEVIAAhDCADIRMLICNQDQAgJQ0AIAJBAWohAiAg/SEBIRogHf0hASEYIB79IQEhFgwBCyAlIQAgFCEDCwJAIAUgHEYNACADIRQMAQsgAyEUIAQhHCAFIRsgHSEQIB4hDgsgBEECaiEEIAUgAU4hAyANIAVBAWoiBWpBAUcNAAsLIANBAXFFDRALAkAgC/0dAFANACAGQYCA56N8NgIAAkAgCEQAAAAAAAAAAGRFDQAgB0EANgIAIAv9HQFQRQ0NDBELIAv9HQFQRQ0ODBALIAv9HQFQDQ8gBkGAgOejfDYCBCAIRAAAAAAAAAAAZA0MDA8LAkACQCABQQFODQD9DP////////////////////8hCwwBC0EAIQxBACABayENIAJBCGogAv1dAwD9VwMAASIOIA798gEhDyADQQhqIAP9XQMA/VcDAAEiECAQ/fIBIREgCP0UIRL9DP////////////////////8hC0ECIQRBACEAQQAhE0EAIRREAAAAAAAAAAAhFUQAAAAAAAAAACEWRAAAAAAAAAAAIRdEAAAAAAAAAAAhGEQAAAAAAAAAACEZRAAAAAAAAAAAIRpBACEDQQAhG0EBIQVBACECQQEhHCAQIR0gDiEeAkADQCARIB797AEiHv3wASEhAkAgC/0MAAAAAAAAAAAAAAAAAAAAACIfIB397AEiHSAeIB798AH98gEgHf3xASAJ/fABIh0gHf3yASIRIAogD/3wASAh/fEBIh4gHv3yASIP/fABIiD9DAAAAACAhC5BAAAAAICELkH9Sv1SIiH9HQAiIiAh/R0BIiOEUA0AIAWyQ3dz+EKSISQCQCAiUA0AIAYgJCAg/SEAtrwiJbNDAAAANJRDd3P4wpIgJUH///8DcUGAgID4A3K+IiZDdb+/v5SSQ6Pp3L8gJkP5RLQ+kpWSQwAAAD+UvCIls0MAAAC0lJIgJUH///8DcUGAgID4A3K+IiZDdb+/P5SSQ6Pp3D8gJkP5RLQ+kpWSOAIAIAcgHf0hACInRAAAAGCeoPY/oiAnIB79IQAiKKAiKSApoiAnICihIicgJ6Kgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCAAsCQCAjUA0AIAYgJCAg/SEBtrwiJbNDAAAANJRDd3P4wpIgJUH///8DcUGAgID4A3K+IiZDdb+/v5SSQ6Pp3L8gJkP5RLQ+kpWSQwAAAD+UvCIls0MAAAC0lJIgJUH///8DcUGAgID4A3K+IiRDdb+/P5SSQ6Pp3D8gJEP5RLQ+kpWSOAIEIAcgHf0hASInRAAAAGCeoPY/oiAnIB79IQEiKKAiKSApoiAnICihIicgJ6Kgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCBAsgISAL/VEiC/0dACAL/R0BhFANAgsCQCAIRAAAAAAAAAAAZQ0AAkACQCACDQAgACElQQAhAgwBCwJAIAUgDEcNACACQX9qIQJBACEMIAv9HQBQDQAgHv0hACAVoZkgHf0hACAXoZmgIBlkDQAgBkGAgOejfDYCACAHIBOyOAIAIAtCAP0eACELCwJAAkAgBSAARg0AIAAhJQwBCyACQX9qIQJBACElIAv9HQFQDQAgHv0hASAWoZkgHf0hASAYoZmgIBpkDQAgBkGAgOejfDYCBCAHIBSyOAIEIAtCAP0eASELCyAL/R0AIAv9HQGEUA0DCwJAAkAgCyAfIB0gEP3xAf3sASAeIA798QH97AH98AEiICAS/Un9UiIh/R0AIiIgIf0dASIjhFANACAEIBtrIQAgBSAbayEDAkAgIlANACAMDQAgAkEBaiECICD9IQAhGSAd/SEAIRcgHv0hACEVIAAhDCADIRMLICNQDQAgJQ0AIAJBAWohAiAg/SEBIRogHf0hASEYIB79IQEhFgwBCyAlIQAgFCEDCwJAIAUgHEYNACADIRQMAQsgAyEUIAQhHCAFIRsgHSEQIB4hDgsgBEECaiEEIAUgAU4hAyANIAVBAWoiBWpBAUcNAAsLIANBAXFFDQ8LAkAgC/0dAFANACAGQYCA56N8NgIAAkAgCEQAAAAAAAAAAGRFDQAgB0EANgIAIAv9HQFQRQ0MDBALIAv9HQFQRQ0NDA8LIAv9HQFQDQ4gBkGAgOejfDYCBCAIRAAAAAAAAAAAZA0LDA4LAkACQCABQQFODQD9DP////////////////////8hIQwBC0EAIRNBACABayEUIAJBCGogAv1dAwD9VwMAASIeIB798gEhDyAI/RQhEP0M/////////////////////yEhQQIhBEEAIQ1BACEqQQAhJUQAAAAAAAAAACEVRAAAAAAAAAAAIRZEAAAAAAAAAAAhF0QAAAAAAAAAACEYRAAAAAAAAAAAIRlEAAAAAAAAAAAhGkEAIQJBACEMQQEhBUEAIQBBASEbIANBCGogA/1dAwD9VwMAAf3tASIgIR0gHv3sASIOIR4CQANAIB39DAAAAAAAAADAAAAAAAAAAMD98gEgHv3yASERIA8gCv3wASAdIB398gH98QEiHf3sASEeAkAgIf0MAAAAAAAAAAAAAAAAAAAAACILIB0gHf3yASIPIBEgCf3xASIdIB398gH98AEiH/0MAAAAAICELkEAAAAAgIQuQf1K/VIiEf0dACIiIBH9HQEiI4RQDQAgBbJDd3P4QpIhJAJAICJQDQAgBiAkIB/9IQC2vCIDs0MAAAA0lEN3c/jCkiADQf///wNxQYCAgPgDcr4iJkN1v7+/lJJDo+ncvyAmQ/lEtD6SlZJDAAAAP5S8IgOzQwAAALSUkiADQf///wNxQYCAgPgDcr4iJkN1v78/lJJDo+ncPyAmQ/lEtD6SlZI4AgAgByAd/SEAIidEAAAAYJ6g9j+iICcgHv0hACIooCIpICmiICcgKKEiJyAnoqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIACwJAICNQDQAgBiAkIB/9IQG2vCIDs0MAAAA0lEN3c/jCkiADQf///wNxQYCAgPgDcr4iJkN1v7+/lJJDo+ncvyAmQ/lEtD6SlZJDAAAAP5S8IgOzQwAAALSUkiADQf///wNxQYCAgPgDcr4iJEN1v78/lJJDo+ncPyAkQ/lEtD6SlZI4AgQgByAd/SEBIidEAAAAYJ6g9j+iICcgHv0hASIooCIpICmiICcgKKEiJyAnoqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIECyARICH9USIh/R0AICH9HQGEUA0CCwJAIAhEAAAAAAAAAABlDQACQAJAIAANACANIRxBACEADAELAkAgBSATRw0AIABBf2ohAEEAIRMgIf0dAFANACAe/SEAIBWhmSAd/SEAIBehmaAgGWQNACAGQYCA56N8NgIAIAcgKrI4AgAgIUIA/R4AISELAkACQCAFIA1GDQAgDSEcDAELIABBf2ohAEEAIRwgIf0dAVANACAe/SEBIBahmSAd/SEBIBihmaAgGmQNACAGQYCA56N8NgIEIAcgJbI4AgQgIUIA/R4BISELICH9HQAgIf0dAYRQDQMLAkACQCAhIAsgHiAO/fEB/ewBIB0gIP3xAf3sAf3wASIfIBD9Sf1SIhH9HQAiIiAR/R0BIiOEUA0AIAQgDGshDSAFIAxrIQMCQCAiUA0AIBMNACAAQQFqIQAgH/0hACEZIB39IQAhFyAe/SEAIRUgDSETIAMhKgsgI1ANACAcDQAgAEEBaiEAIB/9IQEhGiAd/SEBIRggHv0hASEWDAELIBwhDSAlIQMLAkAgBSAbRg0AIAMhJQwBCyADISUgBCEbIAUhDCAdISAgHiEOCyAEQQJqIQQgBSABTiECIBQgBUEBaiIFakEBRw0ACwsgAkEBcUUNDgsCQCAh/R0AUA0AIAZBgIDno3w2AgACQCAIRAAAAAAAAAAAZEUNACAHQQA2AgAgIf0dAVBFDQsMDwsgIf0dAVBFDQwMDgsgIf0dAVANDSAGQYCA56N8NgIEIAhEAAAAAAAAAABkDQoMDQsCQAJAIAFBAU4NAP0M/////////////////////yELDAELQQAhDEEAIAFrIQ0gAkEIaiAC/V0DAP1XAwABIg4gDv3yASEPIANBCGogA/1dAwD9VwMAASIQIBD98gEhESAI/RQhEv0M/////////////////////yELQQIhBEEAIQBBACETQQAhFEQAAAAAAAAAACEVRAAAAAAAAAAAIRZEAAAAAAAAAAAhF0QAAAAAAAAAACEYRAAAAAAAAAAAIRlEAAAAAAAAAAAhGkEAIQNBACEbQQEhBUEAIQJBASEcIBAhHiAOIR0CQANAIB0gHf3wASEhAkAgC/0MAAAAAAAAAAAAAAAAAAAAACIfIAogDyAR/fEB/ewB/fABIh0gHf3yASIPIB4gIf3yASAJ/fABIh4gHv3yASIR/fABIiD9DAAAAACAhC5BAAAAAICELkH9Sv1SIiH9HQAiIiAh/R0BIiOEUA0AIAWyQ3dz+EKSISQCQCAiUA0AIAYgJCAg/SEAtrwiJbNDAAAANJRDd3P4wpIgJUH///8DcUGAgID4A3K+IiZDdb+/v5SSQ6Pp3L8gJkP5RLQ+kpWSQwAAAD+UvCIls0MAAAC0lJIgJUH///8DcUGAgID4A3K+IiZDdb+/P5SSQ6Pp3D8gJkP5RLQ+kpWSOAIAIAcgHv0hACInRAAAAGCeoPY/oiAnIB39IQAiKKAiKSApoiAnICihIicgJ6Kgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCAAsCQCAjUA0AIAYgJCAg/SEBtrwiJbNDAAAANJRDd3P4wpIgJUH///8DcUGAgID4A3K+IiZDdb+/v5SSQ6Pp3L8gJkP5RLQ+kpWSQwAAAD+UvCIls0MAAAC0lJIgJUH///8DcUGAgID4A3K+IiRDdb+/P5SSQ6Pp3D8gJEP5RLQ+kpWSOAIEIAcgHv0hASInRAAAAGCeoPY/oiAnIB39IQEiKKAiKSApoiAnICihIicgJ6Kgn6NEAAAAAAAA+D+gtkMAAAAAl0PNzMw+lDgCBAsgISAL/VEiC/0dACAL/R0BhFANAgsCQCAIRAAAAAAAAAAAZQ0AAkACQCACDQAgACElQQAhAgwBCwJAIAUgDEcNACACQX9qIQJBACEMIAv9HQBQDQAgHf0hACAVoZkgHv0hACAXoZmgIBlkDQAgBkGAgOejfDYCACAHIBOyOAIAIAtCAP0eACELCwJAAkAgBSAARg0AIAAhJQwBCyACQX9qIQJBACElIAv9HQFQDQAgHf0hASAWoZkgHv0hASAYoZmgIBpkDQAgBkGAgOejfDYCBCAHIBSyOAIEIAtCAP0eASELCyAL/R0AIAv9HQGEUA0DCwJAAkAgCyAfIB0gDv3xAf3sASAeIBD98QH97AH98AEiICAS/Un9UiIh/R0AIiIgIf0dASIjhFANACAEIBtrIQAgBSAbayEDAkAgIlANACAMDQAgAkEBaiECICD9IQAhGSAe/SEAIRcgHf0hACEVIAAhDCADIRMLICNQDQAgJQ0AIAJBAWohAiAg/SEBIRogHv0hASEYIB39IQEhFgwBCyAlIQAgFCEDCwJAIAUgHEYNACADIRQMAQsgAyEUIAQhHCAFIRsgHiEQIB0hDgsgBEECaiEEIAUgAU4hAyANIAVBAWoiBWpBAUcNAAsLIANBAXFFDQ0LAkAgC/0dAFANACAGQYCA56N8NgIAAkAgCEQAAAAAAAAAAGRFDQAgB0EANgIAIAv9HQFQRQ0KDA4LIAv9HQFQRQ0LDA0LIAv9HQFQDQwgBkGAgOejfDYCBCAIRAAAAAAAAAAAZA0JDAwLAkACQCABQQFODQD9DP////////////////////8hCwwBC0EAIQxBACABayENIAJBCGogAv1dAwD9VwMAASIOIA798gEhHiADQQhqIAP9XQMA/VcDAAEiECAQ/fIBIR0gCP0UIRL9DP////////////////////8hC0ECIQRBACEAQQAhE0EAIRREAAAAAAAAAAAhFUQAAAAAAAAAACEWRAAAAAAAAAAAIRdEAAAAAAAAAAAhGEQAAAAAAAAAACEZRAAAAAAAAAAAIRpBACEDQQAhG0EBIQVBACECQQEhHCAQIQ8gDiERAkADQCAdIB4iHv0MAAAAAAAAGMAAAAAAAAAYwP3yAf3wASAd/fIBISECQCAL/QwAAAAAAAAAAAAAAAAAAAAAIh8gHiAd/fEBIA/9DAAAAAAAABBAAAAAAAAAEED98gEgEf3yAf3sAf3yASAJ/fABIg8gD/3yASIdICEgHiAe/fIBIAr98AH98AEiESAR/fIBIh798AEiIP0MAAAAAICELkEAAAAAgIQuQf1K/VIiIf0dACIiICH9HQEiI4RQDQAgBbIhJAJAICJQDQAgBiAkICD9IQC2vCIls0MAAAA0lEN3c/jCkiAlQf///wNxQYCAgPgDcr4iJkN1v7+/lJJDo+ncvyAmQ/lEtD6SlZJDAAAAP5S8IiWzQwAAADSUQ3dz+MKSICVB////A3FBgICA+ANyviImQ3W/v7+UkkOj6dy/ICZD+US0PpKVkkMAAAA/lJM4AgAgByAP/SEAIidEAAAAYJ6g9j+iICcgEf0hACIooCIpICmiICcgKKEiJyAnoqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIACwJAICNQDQAgBiAkICD9IQG2vCIls0MAAAA0lEN3c/jCkiAlQf///wNxQYCAgPgDcr4iJkN1v7+/lJJDo+ncvyAmQ/lEtD6SlZJDAAAAP5S8IiWzQwAAADSUQ3dz+MKSICVB////A3FBgICA+ANyviImQ3W/v7+UkkOj6dy/ICZD+US0PpKVkkMAAAA/lJM4AgQgByAP/SEBIidEAAAAYJ6g9j+iICcgEf0hASIooCIpICmiICcgKKEiJyAnoqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIECyAhIAv9USIL/R0AIAv9HQGEUA0CCwJAIAhEAAAAAAAAAABlDQACQAJAIAINACAAISVBACECDAELAkAgBSAMRw0AIAJBf2ohAkEAIQwgC/0dAFANACAR/SEAIBWhmSAP/SEAIBehmaAgGWQNACAGQYCA56N8NgIAIAcgE7I4AgAgC0IA/R4AIQsLAkACQCAFIABGDQAgACElDAELIAJBf2ohAkEAISUgC/0dAVANACAR/SEBIBahmSAP/SEBIBihmaAgGmQNACAGQYCA56N8NgIEIAcgFLI4AgQgC0IA/R4BIQsLIAv9HQAgC/0dAYRQDQMLAkACQCALIB8gDyAQ/fEB/ewBIBEgDv3xAf3sAf3wASIgIBL9Sf1SIiH9HQAiIiAh/R0BIiOEUA0AIAQgG2shACAFIBtrIQMCQCAiUA0AIAwNACACQQFqIQIgIP0hACEZIA/9IQAhFyAR/SEAIRUgACEMIAMhEwsgI1ANACAlDQAgAkEBaiECICD9IQEhGiAP/SEBIRggEf0hASEWDAELICUhACAUIQMLAkAgBSAcRg0AIAMhFAwBCyADIRQgBCEcIAUhGyAPIRAgESEOCyAEQQJqIQQgBSABTiEDIA0gBUEBaiIFakEBRw0ACwsgA0EBcUUNDAsCQCAL/R0AUA0AIAZBgIDno3w2AgACQCAIRAAAAAAAAAAAZEUNACAHQQA2AgAgC/0dAVBFDQkMDQsgC/0dAVBFDQoMDAsgC/0dAVANCyAGQYCA56N8NgIEIAhEAAAAAAAAAABkDQgMCwsCQAJAIAFBAU4NAP0M/////////////////////yEfDAELQQAhDEEAIAFrIQ0gAkEIaiAC/V0DAP1XAwABIg4gDv3yASEPIANBCGogA/1dAwD9VwMAASIQIBD98gEhESAI/RQhEv0M/////////////////////yEfQQIhBEEAIQBBACETQQAhFEQAAAAAAAAAACEVRAAAAAAAAAAAIRZEAAAAAAAAAAAhF0QAAAAAAAAAACEYRAAAAAAAAAAAIRlEAAAAAAAAAAAhGkEAIQNBACEbQQEhBUEAIQJBASEcIBAhHSAOIR4CQANAIA/9DAAAAAAAAAhAAAAAAAAACEAiIf3yASELAkAgH/0MAAAAAAAAAAAAAAAAAAAAACIgIA8gESIRICH98gH98QEgHv3sAf3yASAK/fABIh4gHv3yASIPIAsgEf3xASAd/ewB/fIBIAn98AEiHSAd/fIBIhH98AEiC/0MAAAAAICELkEAAAAAgIQuQf1K/VIiIf0dACIiICH9HQEiI4RQDQAgBbIhJAJAICJQDQAgBiAkIAv9IQC2vCIls0MAAAA0lEN3c/jCkiAlQf///wNxQYCAgPgDcr4iJkN1v7+/lJJDo+ncvyAmQ/lEtD6SlZJDAAAAP5S8IiWzQwAAADSUQ3dz+MKSICVB////A3FBgICA+ANyviImQ3W/v7+UkkOj6dy/ICZD+US0PpKVkkOdhCG/lJI4AgAgByAd/SEAIidEAAAAYJ6g9j+iICcgHv0hACIooCIpICmiICcgKKEiJyAnoqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIACwJAICNQDQAgBiAkIAv9IQG2vCIls0MAAAA0lEN3c/jCkiAlQf///wNxQYCAgPgDcr4iJkN1v7+/lJJDo+ncvyAmQ/lEtD6SlZJDAAAAP5S8IiWzQwAAADSUQ3dz+MKSICVB////A3FBgICA+ANyviImQ3W/v7+UkkOj6dy/ICZD+US0PpKVkkOdhCG/lJI4AgQgByAd/SEBIidEAAAAYJ6g9j+iICcgHv0hASIooCIpICmiICcgKKEiJyAnoqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIECyAhIB/9USIf/R0AIB/9HQGEUA0CCwJAIAhEAAAAAAAAAABlDQACQAJAIAINACAAISVBACECDAELAkAgBSAMRw0AIAJBf2ohAkEAIQwgH/0dAFANACAe/SEAIBWhmSAd/SEAIBehmaAgGWQNACAGQYCA56N8NgIAIAcgE7I4AgAgH0IA/R4AIR8LAkACQCAFIABGDQAgACElDAELIAJBf2ohAkEAISUgH/0dAVANACAe/SEBIBahmSAd/SEBIBihmaAgGmQNACAGQYCA56N8NgIEIAcgFLI4AgQgH0IA/R4BIR8LIB/9HQAgH/0dAYRQDQMLAkACQCAfICAgHiAO/fEB/ewBIB0gEP3xAf3sAf3wASILIBL9Sf1SIiH9HQAiIiAh/R0BIiOEUA0AIAQgG2shACAFIBtrIQMCQCAiUA0AIAwNACACQQFqIQIgC/0hACEZIB39IQAhFyAe/SEAIRUgACEMIAMhEwsgI1ANACAlDQAgAkEBaiECIAv9IQEhGiAd/SEBIRggHv0hASEWDAELICUhACAUIQMLAkAgBSAcRg0AIAMhFAwBCyADIRQgBCEcIAUhGyAdIRAgHiEOCyAEQQJqIQQgBSABTiEDIA0gBUEBaiIFakEBRw0ACwsgA0EBcUUNCwsCQCAf/R0AUA0AIAZBgIDno3w2AgACQCAIRAAAAAAAAAAAZEUNACAHQQA2AgAgH/0dAVBFDQgMDAsgH/0dAVBFDQkMCwsgH/0dAVANCiAGQYCA56N8NgIEIAhEAAAAAAAAAABkDQcMCgsCQAJAIAFBAU4NAP0M/////////////////////yELDAELQQAhDEEAIAFrIQ0gAkEIaiAC/V0DAP1XAwABIg4gDv3yASEPIANBCGogA/1dAwD9VwMAASIQIBD98gEhESAI/RQhEv0M/////////////////////yELQQIhBEEAIQBBACETQQAhFEQAAAAAAAAAACEVRAAAAAAAAAAAIRZEAAAAAAAAAAAhF0QAAAAAAAAAACEYRAAAAAAAAAAAIRlEAAAAAAAAAAAhGkEAIQNBACEbQQEhBUEAIQJBASEcIBAhHSAOIR4CQANAIA8gEf3xASEPAkAgC/0MAAAAAAAAAAAAAAAAAAAAACIfIAkgHSAeIh4gHv3wAf3yAf3sAf3wASIdIB398gEiESAPIAr98AEiHiAe/fIBIg/98AEiIP0MAAAAAICELkEAAAAAgIQuQf1K/VIiIf0dACIiICH9HQEiI4RQDQAgBbJDd3P4QpIhJAJAICJQDQAgBiAkICD9IQC2vCIls0MAAAA0lEN3c/jCkiAlQf///wNxQYCAgPgDcr4iJkN1v7+/lJJDo+ncvyAmQ/lEtD6SlZJDAAAAP5S8IiWzQwAAALSUkiAlQf///wNxQYCAgPgDcr4iJkN1v78/lJJDo+ncPyAmQ/lEtD6SlZI4AgAgByAd/SEAIidEAAAAYJ6g9j+iICcgHv0hACIooCIpICmiICcgKKEiJyAnoqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIACwJAICNQDQAgBiAkICD9IQG2vCIls0MAAAA0lEN3c/jCkiAlQf///wNxQYCAgPgDcr4iJkN1v7+/lJJDo+ncvyAmQ/lEtD6SlZJDAAAAP5S8IiWzQwAAALSUkiAlQf///wNxQYCAgPgDcr4iJEN1v78/lJJDo+ncPyAkQ/lEtD6SlZI4AgQgByAd/SEBIidEAAAAYJ6g9j+iICcgHv0hASIooCIpICmiICcgKKEiJyAnoqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIECyAhIAv9USIL/R0AIAv9HQGEUA0CCwJAIAhEAAAAAAAAAABlDQACQAJAIAINACAAISVBACECDAELAkAgBSAMRw0AIAJBf2ohAkEAIQwgC/0dAFANACAe/SEAIBWhmSAd/SEAIBehmaAgGWQNACAGQYCA56N8NgIAIAcgE7I4AgAgC0IA/R4AIQsLAkACQCAFIABGDQAgACElDAELIAJBf2ohAkEAISUgC/0dAVANACAe/SEBIBahmSAd/SEBIBihmaAgGmQNACAGQYCA56N8NgIEIAcgFLI4AgQgC0IA/R4BIQsLIAv9HQAgC/0dAYRQDQMLAkACQCALIB8gHSAQ/fEB/ewBIB4gDv3xAf3sAf3wASIgIBL9Sf1SIiH9HQAiIiAh/R0BIiOEUA0AIAQgG2shACAFIBtrIQMCQCAiUA0AIAwNACACQQFqIQIgIP0hACEZIB39IQAhFyAe/SEAIRUgACEMIAMhEwsgI1ANACAlDQAgAkEBaiECICD9IQEhGiAd/SEBIRggHv0hASEWDAELICUhACAUIQMLAkAgBSAcRg0AIAMhFAwBCyADIRQgBCEcIAUhGyAdIRAgHiEOCyAEQQJqIQQgBSABTiEDIA0gBUEBaiIFakEBRw0ACwsgA0EBcUUNCgsCQCAL/R0AUA0AIAZBgIDno3w2AgACQCAIRAAAAAAAAAAAZEUNACAHQQA2AgAgC/0dAVBFDQcMCwsgC/0dAVBFDQgMCgsgC/0dAVANCSAGQYCA56N8NgIEIAhEAAAAAAAAAABkDQYMCQsCQAJAIAFBAU4NAP0M/////////////////////yEQDAELQQAhDEEAIAFrIQ0gAkEIaiAC/V0DAP1XAwABIisgK/3yASEdIANBCGogA/1dAwD9VwMAASIsICz98gEhHiAI/RQhLf0M/////////////////////yEQQQIhBEEAIQBBACETQQAhFEQAAAAAAAAAACEVRAAAAAAAAAAAIRZEAAAAAAAAAAAhF0QAAAAAAAAAACEYRAAAAAAAAAAAIRlEAAAAAAAAAAAhGkEAIQNBACEbQQEhBUEAIQJBASEcICwhDyArIRECQANAIB39DAAAAAAAABxAAAAAAAAAHEAiIf3yASELIB39DAAAAAAAADVAAAAAAAAANUAiH/3yASEgAkAgEP0MAAAAAAAAAAAAAAAAAAAAACISIB39DAAAAAAAgEFAAAAAAACAQUAiDv3yASAeIh4gIf3yAf3xASAeIB798gEiIf3yASAdIB4gH/3yAf3xASAdIB398gEiH/3yAf3wASAR/fIBIAr98AEiESAR/fIBIh0gHyALIB4gDv3yAf3xAf3yASAgIB798QEgIf3yAf3wASAP/fIBIAn98AEiDyAP/fIBIh798AEiC/0MAAAAAICELkEAAAAAgIQuQf1K/VIiIf0dACIiICH9HQEiI4RQDQAgBbIhJAJAICJQDQAgBiAkIAv9IQC2vCIls0MAAAA0lEN3c/jCkiAlQf///wNxQYCAgPgDcr4iJkN1v7+/lJJDo+ncvyAmQ/lEtD6SlZJDAAAAP5S8IiWzQwAAADSUQ3dz+MKSICVB////A3FBgICA+ANyviImQ3W/v7+UkkOj6dy/ICZD+US0PpKVkkPKYLa+lJI4AgAgByAP/SEAIidEAAAAYJ6g9j+iICcgEf0hACIooCIpICmiICcgKKEiJyAnoqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIACwJAICNQDQAgBiAkIAv9IQG2vCIls0MAAAA0lEN3c/jCkiAlQf///wNxQYCAgPgDcr4iJkN1v7+/lJJDo+ncvyAmQ/lEtD6SlZJDAAAAP5S8IiWzQwAAADSUQ3dz+MKSICVB////A3FBgICA+ANyviImQ3W/v7+UkkOj6dy/ICZD+US0PpKVkkPKYLa+lJI4AgQgByAP/SEBIidEAAAAYJ6g9j+iICcgEf0hASIooCIpICmiICcgKKEiJyAnoqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIECyAhIBD9USIQ/R0AIBD9HQGEUA0CCwJAIAhEAAAAAAAAAABlDQACQAJAIAINACAAISVBACECDAELAkAgBSAMRw0AIAJBf2ohAkEAIQwgEP0dAFANACAR/SEAIBWhmSAP/SEAIBehmaAgGWQNACAGQYCA56N8NgIAIAcgE7I4AgAgEEIA/R4AIRALAkACQCAFIABGDQAgACElDAELIAJBf2ohAkEAISUgEP0dAVANACAR/SEBIBahmSAP/SEBIBihmaAgGmQNACAGQYCA56N8NgIEIAcgFLI4AgQgEEIA/R4BIRALIBD9HQAgEP0dAYRQDQMLAkACQCAQIBIgESAr/fEB/ewBIA8gLP3xAf3sAf3wASILIC39Sf1SIiH9HQAiIiAh/R0BIiOEUA0AIAQgG2shACAFIBtrIQMCQCAiUA0AIAwNACACQQFqIQIgC/0hACEZIA/9IQAhFyAR/SEAIRUgACEMIAMhEwsgI1ANACAlDQAgAkEBaiECIAv9IQEhGiAP/SEBIRggEf0hASEWDAELICUhACAUIQMLAkAgBSAcRg0AIAMhFAwBCyADIRQgBCEcIAUhGyAPISwgESErCyAEQQJqIQQgBSABTiEDIA0gBUEBaiIFakEBRw0ACwsgA0EBcUUNCQsCQCAQ/R0AUA0AIAZBgIDno3w2AgACQCAIRAAAAAAAAAAAZEUNACAHQQA2AgAgEP0dAVBFDQYMCgsgEP0dAVBFDQcMCQsgEP0dAVANCCAGQYCA56N8NgIEIAhEAAAAAAAAAABkDQUMCAsCQAJAIAFBAU4NAP0M/////////////////////yEODAELQQAhDEEAIAFrIQ0gAkEIaiAC/V0DAP1XAwABIhIgEv3yASEeIANBCGogA/1dAwD9VwMAASIrICv98gEhHSAI/RQhLP0M/////////////////////yEOQQIhBEEAIQBBACETQQAhFEQAAAAAAAAAACEVRAAAAAAAAAAAIRZEAAAAAAAAAAAhF0QAAAAAAAAAACEYRAAAAAAAAAAAIRlEAAAAAAAAAAAhGkEAIQNBACEbQQEhBUEAIQJBASEcICshDyASIRECQANAIB4iHiAe/fIBIiH9DAAAAAAAAC5AAAAAAAAALkAiH/3yASAdIB398gEiC/3wASAd/fIBISACQCAO/QwAAAAAAAAAAAAAAAAAAAAAIhAgESAP/fIBICEgC/3wAf0MAAAAAAAAGEAAAAAAAAAYQP3yASAd/QwAAAAAAAA0wAAAAAAAADTA/fIBIB798gH98AH98gEgCf3wASIPIA/98gEiHSAKICD98QEgCyAf/fIBICH98AEgHv3yAf3wASIRIBH98gEiHv3wASIL/QwAAAAAgIQuQQAAAACAhC5B/Ur9UiIh/R0AIiIgIf0dASIjhFANACAFsiEkAkAgIlANACAGICQgC/0hALa8IiWzQwAAADSUQ3dz+MKSICVB////A3FBgICA+ANyviImQ3W/v7+UkkOj6dy/ICZD+US0PpKVkkMAAAA/lLwiJbNDAAAANJRDd3P4wpIgJUH///8DcUGAgID4A3K+IiZDdb+/v5SSQ6Pp3L8gJkP5RLQ+kpWSQ5IRxr6UkjgCACAHIA/9IQAiJ0QAAABgnqD2P6IgJyAR/SEAIiigIikgKaIgJyAooSInICeioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgALAkAgI1ANACAGICQgC/0hAba8IiWzQwAAADSUQ3dz+MKSICVB////A3FBgICA+ANyviImQ3W/v7+UkkOj6dy/ICZD+US0PpKVkkMAAAA/lLwiJbNDAAAANJRDd3P4wpIgJUH///8DcUGAgID4A3K+IiZDdb+/v5SSQ6Pp3L8gJkP5RLQ+kpWSQ5IRxr6UkjgCBCAHIA/9IQEiJ0QAAABgnqD2P6IgJyAR/SEBIiigIikgKaIgJyAooSInICeioJ+jRAAAAAAAAPg/oLZDAAAAAJdDzczMPpQ4AgQLICEgDv1RIg79HQAgDv0dAYRQDQILAkAgCEQAAAAAAAAAAGUNAAJAAkAgAg0AIAAhJUEAIQIMAQsCQCAFIAxHDQAgAkF/aiECQQAhDCAO/R0AUA0AIBH9IQAgFaGZIA/9IQAgF6GZoCAZZA0AIAZBgIDno3w2AgAgByATsjgCACAOQgD9HgAhDgsCQAJAIAUgAEYNACAAISUMAQsgAkF/aiECQQAhJSAO/R0BUA0AIBH9IQEgFqGZIA/9IQEgGKGZoCAaZA0AIAZBgIDno3w2AgQgByAUsjgCBCAOQgD9HgEhDgsgDv0dACAO/R0BhFANAwsCQAJAIA4gECARIBL98QH97AEgDyAr/fEB/ewB/fABIgsgLP1J/VIiIf0dACIiICH9HQEiI4RQDQAgBCAbayEAIAUgG2shAwJAICJQDQAgDA0AIAJBAWohAiAL/SEAIRkgD/0hACEXIBH9IQAhFSAAIQwgAyETCyAjUA0AICUNACACQQFqIQIgC/0hASEaIA/9IQEhGCAR/SEBIRYMAQsgJSEAIBQhAwsCQCAFIBxGDQAgAyEUDAELIAMhFCAEIRwgBSEbIA8hKyARIRILIARBAmohBCAFIAFOIQMgDSAFQQFqIgVqQQFHDQALCyADQQFxRQ0ICwJAIA79HQBQDQAgBkGAgOejfDYCAAJAIAhEAAAAAAAAAABkRQ0AIAdBADYCACAO/R0BUEUNBQwJCyAO/R0BUEUNBgwICyAO/R0BUA0HIAZBgIDno3w2AgQgCEQAAAAAAAAAAGQNBAwHCwJAAkAgAUEBTg0A/Qz/////////////////////ISAMAQtBACEMQQAgAWshDSACQQhqIAL9XQMA/VcDAAEiECAQ/fIBIR4gA0EIaiAD/V0DAP1XAwABIhIgEv3yASEdIAj9FCEr/Qz/////////////////////ISBBAiEEQQAhAEEAIRNBACEURAAAAAAAAAAAIRVEAAAAAAAAAAAhFkQAAAAAAAAAACEXRAAAAAAAAAAAIRhEAAAAAAAAAAAhGUQAAAAAAAAAACEaQQAhA0EAIRtBASEFQQAhAkEBIRwgEiEPIBAhEQJAA0ACQCAg/QwAAAAAAAAAAAAAAAAAAAAAIg4gHiIe/QwAAAAAAAAUQAAAAAAAABRAIiH98gEgHf0MAAAAAAAAJEAAAAAAAAAkQP3yASIL/fEBIB798gEgHSAd/fIBIh/98AEgD/3yASAJ/fABIg8gD/3yASIdIB4gC/3xASAe/fIBIB8gIf3yAf3wASAR/fIBIAr98AEiESAR/fIBIh798AEiC/0MAAAAAICELkEAAAAAgIQuQf1K/VIiIf0dACIiICH9HQEiI4RQDQAgBbIhJAJAICJQDQAgBiAkIAv9IQC2vCIls0MAAAA0lEN3c/jCkiAlQf///wNxQYCAgPgDcr4iJkN1v7+/lJJDo+ncvyAmQ/lEtD6SlZJDAAAAP5S8IiWzQwAAADSUQ3dz+MKSICVB////A3FBgICA+ANyviImQ3W/v7+UkkOj6dy/ICZD+US0PpKVkkOjgdy+lJI4AgAgByAP/SEAIidEAAAAYJ6g9j+iICcgEf0hACIooCIpICmiICcgKKEiJyAnoqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIACwJAICNQDQAgBiAkIAv9IQG2vCIls0MAAAA0lEN3c/jCkiAlQf///wNxQYCAgPgDcr4iJkN1v7+/lJJDo+ncvyAmQ/lEtD6SlZJDAAAAP5S8IiWzQwAAADSUQ3dz+MKSICVB////A3FBgICA+ANyviImQ3W/v7+UkkOj6dy/ICZD+US0PpKVkkOjgdy+lJI4AgQgByAP/SEBIidEAAAAYJ6g9j+iICcgEf0hASIooCIpICmiICcgKKEiJyAnoqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIECyAhICD9USIg/R0AICD9HQGEUA0CCwJAIAhEAAAAAAAAAABlDQACQAJAIAINACAAISVBACECDAELAkAgBSAMRw0AIAJBf2ohAkEAIQwgIP0dAFANACAR/SEAIBWhmSAP/SEAIBehmaAgGWQNACAGQYCA56N8NgIAIAcgE7I4AgAgIEIA/R4AISALAkACQCAFIABGDQAgACElDAELIAJBf2ohAkEAISUgIP0dAVANACAR/SEBIBahmSAP/SEBIBihmaAgGmQNACAGQYCA56N8NgIEIAcgFLI4AgQgIEIA/R4BISALICD9HQAgIP0dAYRQDQMLAkACQCAgIA4gDyAS/fEB/ewBIBEgEP3xAf3sAf3wASILICv9Sf1SIiH9HQAiIiAh/R0BIiOEUA0AIAQgG2shACAFIBtrIQMCQCAiUA0AIAwNACACQQFqIQIgC/0hACEZIA/9IQAhFyAR/SEAIRUgACEMIAMhEwsgI1ANACAlDQAgAkEBaiECIAv9IQEhGiAP/SEBIRggEf0hASEWDAELICUhACAUIQMLAkAgBSAcRg0AIAMhFAwBCyADIRQgBCEcIAUhGyAPIRIgESEQCyAEQQJqIQQgBSABTiEDIA0gBUEBaiIFakEBRw0ACwsgA0EBcUUNBwsCQCAg/R0AUA0AIAZBgIDno3w2AgACQCAIRAAAAAAAAAAAZEUNACAHQQA2AgAgIP0dAVBFDQQMCAsgIP0dAVBFDQUMBwsgIP0dAVANBiAGQYCA56N8NgIEIAhEAAAAAAAAAABkDQMMBgsCQAJAIAFBAU4NAP0M/////////////////////yEfDAELQQAhDEEAIAFrIQ0gAkEIaiAC/V0DAP1XAwABIg4gDv3yASERIANBCGogA/1dAwD9VwMAASIQIBD98gEhHSAI/RQhEv0M/////////////////////yEfQQIhBEEAIQBBACETQQAhFEQAAAAAAAAAACEVRAAAAAAAAAAAIRZEAAAAAAAAAAAhF0QAAAAAAAAAACEYRAAAAAAAAAAAIRlEAAAAAAAAAAAhGkEAIQNBACEbQQEhBUEAIQJBASEcIBAhHiAOIQ8CQANAIB0gHf3yASEhIB39DAAAAAAAABjAAAAAAAAAGMD98gEhCwJAIB/9DAAAAAAAAAAAAAAAAAAAAAAiICAe/QwAAAAAAAAQQAAAAAAAABBA/fIBIBEiESAd/fEB/fIBIA/98gEgCf3wASIeIB798gEiHSAhIAr98AEgESAL/fABIBH98gH98AEiDyAP/fIBIhH98AEiC/0MAAAAAICELkEAAAAAgIQuQf1K/VIiIf0dACIiICH9HQEiI4RQDQAgBbIhJAJAICJQDQAgBiAkIAv9IQC2vCIls0MAAAA0lEN3c/jCkiAlQf///wNxQYCAgPgDcr4iJkN1v7+/lJJDo+ncvyAmQ/lEtD6SlZJDAAAAP5S8IiWzQwAAADSUQ3dz+MKSICVB////A3FBgICA+ANyviImQ3W/v7+UkkOj6dy/ICZD+US0PpKVkkMAAAA/lJM4AgAgByAe/SEAIidEAAAAYJ6g9j+iICcgD/0hACIooCIpICmiICcgKKEiJyAnoqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIACwJAICNQDQAgBiAkIAv9IQG2vCIls0MAAAA0lEN3c/jCkiAlQf///wNxQYCAgPgDcr4iJkN1v7+/lJJDo+ncvyAmQ/lEtD6SlZJDAAAAP5S8IiWzQwAAADSUQ3dz+MKSICVB////A3FBgICA+ANyviImQ3W/v7+UkkOj6dy/ICZD+US0PpKVkkMAAAA/lJM4AgQgByAe/SEBIidEAAAAYJ6g9j+iICcgD/0hASIooCIpICmiICcgKKEiJyAnoqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIECyAhIB/9USIf/R0AIB/9HQGEUA0CCwJAIAhEAAAAAAAAAABlDQACQAJAIAINACAAISVBACECDAELAkAgBSAMRw0AIAJBf2ohAkEAIQwgH/0dAFANACAP/SEAIBWhmSAe/SEAIBehmaAgGWQNACAGQYCA56N8NgIAIAcgE7I4AgAgH0IA/R4AIR8LAkACQCAFIABGDQAgACElDAELIAJBf2ohAkEAISUgH/0dAVANACAP/SEBIBahmSAe/SEBIBihmaAgGmQNACAGQYCA56N8NgIEIAcgFLI4AgQgH0IA/R4BIR8LIB/9HQAgH/0dAYRQDQMLAkACQCAfICAgHiAQ/fEB/ewBIA8gDv3xAf3sAf3wASILIBL9Sf1SIiH9HQAiIiAh/R0BIiOEUA0AIAQgG2shACAFIBtrIQMCQCAiUA0AIAwNACACQQFqIQIgC/0hACEZIB79IQAhFyAP/SEAIRUgACEMIAMhEwsgI1ANACAlDQAgAkEBaiECIAv9IQEhGiAe/SEBIRggD/0hASEWDAELICUhACAUIQMLAkAgBSAcRg0AIAMhFAwBCyADIRQgBCEcIAUhGyAeIRAgDyEOCyAEQQJqIQQgBSABTiEDIA0gBUEBaiIFakEBRw0ACwsgA0EBcUUNBgsCQCAf/R0AUA0AIAZBgIDno3w2AgACQCAIRAAAAAAAAAAAZEUNACAHQQA2AgAgH/0dAVBFDQMMBwsgH/0dAVBFDQQMBgsgH/0dAVANBSAGQYCA56N8NgIEIAhEAAAAAAAAAABkDQIMBQsCQAJAIAFBAU4NAP0M/////////////////////yEfDAELQQAhDEEAIAFrIQ0gAkEIaiAC/V0DAP1XAwABIg4gDv3yASEPIANBCGogA/1dAwD9VwMAASIQIBD98gEhESAI/RQhEv0M/////////////////////yEfQQIhBEEAIQBBACETQQAhFEQAAAAAAAAAACEVRAAAAAAAAAAAIRZEAAAAAAAAAAAhF0QAAAAAAAAAACEYRAAAAAAAAAAAIRlEAAAAAAAAAAAhGkEAIQNBACEbQQEhBUEAIQJBASEcIBAhHSAOIR4CQANAIA/9DAAAAAAAAAhAAAAAAAAACEAiIf3yASELAkAgH/0MAAAAAAAAAAAAAAAAAAAAACIgIB4gDyARIhEgIf3yAf3xAf3yASAK/fABIh4gHv3yASIPIAsgEf3xASAd/fIBIAn98AEiHSAd/fIBIhH98AEiC/0MAAAAAICELkEAAAAAgIQuQf1K/VIiIf0dACIiICH9HQEiI4RQDQAgBbIhJAJAICJQDQAgBiAkIAv9IQC2vCIls0MAAAA0lEN3c/jCkiAlQf///wNxQYCAgPgDcr4iJkN1v7+/lJJDo+ncvyAmQ/lEtD6SlZJDAAAAP5S8IiWzQwAAADSUQ3dz+MKSICVB////A3FBgICA+ANyviImQ3W/v7+UkkOj6dy/ICZD+US0PpKVkkOdhCG/lJI4AgAgByAd/SEAIidEAAAAYJ6g9j+iICcgHv0hACIooCIpICmiICcgKKEiJyAnoqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIACwJAICNQDQAgBiAkIAv9IQG2vCIls0MAAAA0lEN3c/jCkiAlQf///wNxQYCAgPgDcr4iJkN1v7+/lJJDo+ncvyAmQ/lEtD6SlZJDAAAAP5S8IiWzQwAAADSUQ3dz+MKSICVB////A3FBgICA+ANyviImQ3W/v7+UkkOj6dy/ICZD+US0PpKVkkOdhCG/lJI4AgQgByAd/SEBIidEAAAAYJ6g9j+iICcgHv0hASIooCIpICmiICcgKKEiJyAnoqCfo0QAAAAAAAD4P6C2QwAAAACXQ83MzD6UOAIECyAhIB/9USIf/R0AIB/9HQGEUA0CCwJAIAhEAAAAAAAAAABlDQACQAJAIAINACAAISVBACECDAELAkAgBSAMRw0AIAJBf2ohAkEAIQwgH/0dAFANACAe/SEAIBWhmSAd/SEAIBehmaAgGWQNACAGQYCA56N8NgIAIAcgE7I4AgAgH0IA/R4AIR8LAkACQCAFIABGDQAgACElDAELIAJBf2ohAkEAISUgH/0dAVANACAe/SEBIBahmSAd/SEBIBihmaAgGmQNACAGQYCA56N8NgIEIAcgFLI4AgQgH0IA/R4BIR8LIB/9HQAgH/0dAYRQDQMLAkACQCAfICAgHiAO/fEB/ewBIB0gEP3xAf3sAf3wASILIBL9Sf1SIiH9HQAiIiAh/R0BIiOEUA0AIAQgG2shACAFIBtrIQMCQCAiUA0AIAwNACACQQFqIQIgC/0hACEZIB39IQAhFyAe/SEAIRUgACEMIAMhEwsgI1ANACAlDQAgAkEBaiECIAv9IQEhGiAd/SEBIRggHv0hASEWDAELICUhACAUIQMLAkAgBSAcRg0AIAMhFAwBCyADIRQgBCEcIAUhGyAdIRAgHiEOCyAEQQJqIQQgBSABTiEDIA0gBUEBaiIFakEBRw0ACwsgA0EBcUUNBQsCQCAf/R0AUA0AIAZBgIDno3w2AgACQCAIRAAAAAAAAAAAZEUNACAHQQA2AgAgH/0dAVBFDQIMBgsgH/0dAVBFDQMMBQsgH/0dAVANBCAGQYCA56N8NgIEIAhEAAAAAAAAAABkDQEMBAsgBkGAgOejfDYCBAtDAAAAACEkDAELQwDAecQhJCAGIQcLIAcgJDgCBAsL4QUBCnwgACsDACIKRAAAAAIAAKBBoiELIAsgCqEhDCALIAyhIQsgCiALoSENRAAAAAIAALBBIQwgDEQAAAAAAAAAwKAhDiAMIA6hIQwgCiAKoCEKIAsgDKIgCqEhDiAOIA0gDKKgIQ5EAAAAAAAAAEAgDKEhDCAOIAsgDKKgIQsgDSAMoiAAKwMIIgwgDKCgIAugIQ4gDiAKoCELIAsgCqEhDyALRAAAAAIAAKBBoiEKIAogC6EhDCAKIAyhIQwgCyAMoSEQIAErAwAiEUQAAAACAACgQaIhCiAKIBGhIQ0gCiANoSENIBEgDaEhEiARIAuiIQogDSAMoiAKoSETIBMgEiAMoqAhDCAMIA0gEKKgIQwgASsDCCALoiARIA4gD6GioCASIBCioCAMoCEMIAwgCqAhCyALIAqhIQogDCAKoSEKIAkgCqAhDCAMIAqhIQ0gCSANoSEJIAwgDaEhDSAKIA2hIQ4gCCALoCEKIAogC6EhDSAIIA2hIQggCiANoSENIAsgDaEhCyAIIAugIAygIQwgDCAKoCELIAsgCqEhCiAJIA6gIAygIAqhIQogCiALoCEMIAEgDDkDACAMIAuhIQsgASAKIAuhOQMIIAWaIQsgCyADoCEKIAogA6EhDCAKIAyhIQ0gAyANoSENIAsgDKEhCSAEmiEDIAMgAqAhCyALIAKhIQwgCyAMoSEIIAIgCKEhAiADIAyhIQMgAyACoCAKoCEDIAMgC6AhCiAKIAuhIQsgCSANoCADoCALoSEDIAMgCqAhCyALIAqhIQogAyAKoSEKIAcgCqAhAyADIAqhIQIgByACoSEMIAMgAqEhAiAKIAKhIQ0gBiALoCEKIAogC6EhAiAGIAKhIQkgCiACoSECIAsgAqEhCyAJIAugIAOgIQMgAyAKoCELIAsgCqEhCiAMIA2gIAOgIAqhIQogCiALoCEDIAAgAzkDACADIAuhIQsgACAKIAuhOQMIC4cJAQx8IAREAAAAAgAAoEGiIQogCiAEoSELIAogC6EhCyAEIAuhIQxEAAAAAwAAuEEhCiAKRAAAAAAAAAjAoCENIAogDaEhDSAERAAAAAAAAAhAoiEKIAsgDaIgCqEhDiAOIAwgDaKgIQ9EAAAAAAAACEAgDaEhDiAPIAsgDqKgIQsgDCAOoiAFRAAAAAAAAAhAoqAgC6AhCyALIAqgIQwgDCAKoSEKIAogC6EhDyADIQogDyAKoCELIAsgCqEhECAPIBChIREgCyAQoSEPIAogD6EhEiAMmiEPIAIhDCAPIAygIQogCiAMoSEQIA8gEKEhDyAKIBChIRAgDCAQoSEMIA8gDKAgC6AhDCAMIAqgIQsgCyAKoSEKIBEgEqAgDKAgCqEhECAQIAugIQogCiALoSETIApEAAAAAgAAoEGiIQsgCyAKoSEMIAsgDKEhDCAKIAyhIREgACsDACISRAAAAAIAAKBBoiELIAsgEqEhDyALIA+hIQ8gEiAPoSEUIBIgCqIhCyAMIA+iIAuhIRUgFSARIA+ioCEPIA8gDCAUoqAhDCAAKwMIIAqiIBAgE6EgEqKgIBEgFKKgIAygIQwgDCALoCEKIAogC6EhCyAMIAuhIQsgByALoCEMIAwgC6EhDyAHIA+hIQcgDCAPoSEPIAsgD6EhECAGIAqgIQsgCyAKoSEPIAYgD6EhBiALIA+hIQ8gCiAPoSEKIAYgCqAgDKAhDCAMIAugIQogCiALoSELIAcgEKAgDKAgC6EhCyALIAqgIQwgACAMOQMAIAwgCqEhCiAAIAsgCqE5AwggAkQAAAACAACgQaIhCiAKIAKhIQsgCiALoSEKIAIgCqEhDCACRAAAAAAAAAhAoiELIAogDaIgC6EhAiACIAwgDaKgIQ0gDSAKIA6ioCEKIAwgDqIgA0QAAAAAAAAIQKKgIAqgIQ0gDSALoCEKIAogC6EhCyANIAuhIQsgBZohDiAOIAugIQ0gDSALoSECIA4gAqEhDCANIAKhIQ4gCyAOoSECIASaIQ4gDiAKoCELIAsgCqEhBCAOIAShIQ4gCyAEoSEEIAogBKEhCiAOIAqgIA2gIQogCiALoCENIA0gC6EhCyAMIAKgIAqgIAuhIQQgBCANoCEKIAogDaEhByAKRAAAAAIAAKBBoiELIAsgCqEhDSALIA2hIQ0gCiANoSECIAErAwAiDEQAAAACAACgQaIhCyALIAyhIQ4gCyAOoSEOIAwgDqEhDyAMIAqiIQsgDSAOoiALoSEGIAYgAiAOoqAhDiAOIA0gD6KgIQ0gASsDCCAKoiAEIAehIAyioCACIA+ioCANoCENIA0gC6AhCiAKIAuhIQsgDSALoSELIAkgC6AhDSANIAuhIQ4gCSAOoSEEIA0gDqEhDiALIA6hIQIgCCAKoCELIAsgCqEhDiAIIA6hIQwgCyAOoSEOIAogDqEhCiAMIAqgIA2gIQ0gDSALoCEKIAogC6EhCyAEIAKgIA2gIAuhIQsgCyAKoCENIAEgDTkDACANIAqhIQogASALIAqhOQMIC64NARF8IAJEAAAAAgAAoEGiIQogCiACoSELIAogC6EhDCAAKwMAIg1EAAAAAgAAoEGiIQogCiANoSELIAogC6EhDiANIA6hIQ8gDSACoiELIA4gDKIgC6EhCiAKIA8gDKKgIQogAiAMoSEQIAogDiAQoqAhCiAAKwMIIhEgAqIgDSADoqAgDyAQoqAgCqAhEiASIAugIQogCiALoSETIApEAAAAAgAAoEGiIQsgCyAKoSEUIAsgFKEhFCAKIBShIRUgASsDACIWRAAAAAIAAKBBoiELIAsgFqEhFyALIBehIRcgFiAXoSEYIBYgCqIhCyAXIBSiIAuhIRkgGSAYIBSioCEUIBQgFyAVoqAhFCABKwMIIhogCqIgFiASIBOhoqAgGCAVoqAgFKAhCiAKIAugIRQgFCALoSELIAogC6EhFSAERAAAAAIAAKBBoiEKIAogBKEhCyAKIAuhIQogBCAKoSELIAQgDaIhEiAKIA6iIBKhIRMgEyALIA6ioCEOIA4gCiAPoqAhDiAFIA2iIAQgEaKgIAsgD6KgIA6gIQ8gDyASoCEOIA4gEqEhGSAORAAAAAIAAKBBoiESIBIgDqEhDSASIA2hIQ0gDiANoSETIA4gFqIhEiANIBeiIBKhIREgESANIBiioCENIA0gEyAXoqAhFyAPIBmhIBaiIA4gGqKgIBMgGKKgIBegIQ4gDiASoCENIA0gEqEhFyAXIA6hIQ4gDiAVoCEXIBcgFaEhEiAXIBKhIQ8gFSAPoSEPIA4gEqEhFiANmiESIBIgFKAhDiAOIBShIQ0gDiANoSEYIBQgGKEhFCASIA2hIRIgEiAUoCAXoCEXIBcgDqAhFCAUIA6hIQ4gFiAPoCAXoCAOoSESIBIgFKAhDiAOIBShIRYgDkQAAAACAACgQaIhFCAUIA6hIRcgFCAXoSEUIA4gFKEhDUQAAAACAADAQSEXIBdEAAAAAAAAEMCgIQ8gFyAPoSEXRAAAAAAAABBAIBehIQ8gDkQAAAAAAAAQQKIhDiAUIBeiIA6hIRggGCANIBeioCEXIBcgFCAPoqAhFCANIA+iIBIgFqFEAAAAAAAAEECioCAUoCEXIBcgDqAhFCAUIA6hIQ4gFyAOoSEOIAkgDqAhFyAXIA6hIRIgCSASoSENIBcgEqEhEiAOIBKhIQ8gCCAUoCEOIA4gFKEhEiAIIBKhIRYgDiASoSESIBQgEqEhFCAWIBSgIBegIRcgFyAOoCEUIBQgDqEhDiANIA+gIBegIA6hIQ4gDiAUoCEXIAEgFzkDACAXIBShIRQgASAOIBShOQMIRAAAAAMAAMhBIRQgFEQAAAAAAAAYwKAhDiAUIA6hIQ4gBEQAAAAAAAAYQKIhFCAKIA6iIBShIRcgFyALIA6ioCEXRAAAAAAAABhAIA6hIQ4gFyAKIA6ioCEXIAsgDqIgBUQAAAAAAAAYQKKgIBegIQ4gDiAUoCEXIBcgFKEhFCAUIA6hIRIgAyEUIBIgFKAhDiAOIBShIQ0gEiANoSEPIA4gDaEhEiAUIBKhIRYgF5ohEiACIRcgEiAXoCEUIBQgF6EhDSASIA2hIRIgFCANoSENIBcgDaEhFyASIBegIA6gIRcgFyAUoCEOIA4gFKEhFCAPIBagIBegIBShIRIgEiAOoCEUIBQgDqEhDyAURAAAAAIAAKBBoiEOIA4gFKEhFyAOIBehIRcgFCAXoSENIBQgAqIhDiAXIAyiIA6hIRYgFiANIAyioCEMIAwgFyAQoqAhDCASIA+hIAKiIBQgA6KgIA0gEKKgIAygIRQgFCAOoCECIAIgDqEhDiAUIA6hIQ4gBCAEoiEUIAogCqIgFKEhDCAMIAsgCqIiF6AhCiAKIBegIQogCyALoiAEIAUgBaCioCAKoCEKIAogFKAhBCAEIBShIQsgCiALoSEKIAogDqAhCyALIA6hIRQgCiAUoSEMIAsgFKEhCiAOIAqhIQ4gBCACoCEKIAogAqEhFCAEIBShIQQgCiAUoSEUIAIgFKEhAiAEIAKgIAugIQsgCyAKoCEEIAQgCqEhCiAMIA6gIAugIAqhIQsgCyAEoCEKIAogBKEhBCALIAShIQQgByAEoCELIAsgBKEhAiAHIAKhIRQgCyACoSECIAQgAqEhDiAGIAqgIQQgBCAKoSECIAYgAqEhDCAEIAKhIQIgCiACoSEKIAwgCqAgC6AhCyALIASgIQogCiAEoSEEIBQgDqAgC6AgBKEhBCAEIAqgIQsgACALOQMAIAsgCqEhCiAAIAQgCqE5AwgL1g4BEHwgAkQAAAACAACgQaIhCiAKIAKhIQsgCiALoSEKIAIgCqEhC0QAAIACAADEQSEMIAxEAAAAAAAAFMCgIQ0gDCANoSEOIAJEAAAAAAAAFECiIQ0gCiAOoiANoSEMIAwgCyAOoqAhDEQAAAAAAAAUQCAOoSEPIAwgCiAPoqAhDCALIA+iIANEAAAAAAAAFECioCAMoCEQIBAgDaAhDCAMIA2hIQ0gECANoSERIAREAAAAAgAAoEGiIQ0gDSAEoSEQIA0gEKEhDSAEIA2hIRJEAACAAgAA1EEhECAQRAAAAAAAACTAoCETIBAgE6EhEyAERAAAAAAAACRAoiEQIBMgDaIgEKEhFCAUIBMgEqKgIRREAAAAAAAAJEAgE6EhEyAUIBMgDaKgIRQgEyASoiAFRAAAAAAAACRAoqAgFKAhEyATIBCgIRQgFCAQoSEQIBAgE6EhEyATIBGgIRUgFSARoSEQIBUgEKEhFiARIBahIRYgEyAQoSEXIBSaIRQgFCAMoCEQIBAgDKEhESAQIBGhIRggDCAYoSEMIBQgEaEhESARIAygIBWgIQwgDCAQoCERIBEgEKEhECAXIBagIAygIBChIRUgFSARoCEMIAwgEaEhFyAMRAAAAAIAAKBBoiEQIBAgDKEhESAQIBGhIREgDCARoSEWIAwgAqIhECARIAqiIBChIRggGCAWIAqioCEYIBggESALoqAhESAVIBehIAKiIAwgA6KgIBYgC6KgIBGgIREgESAQoCEMIAwgEKEhECARIBChIREgBCAEoiEQIA0gDaIgEKEhFSAVIBIgDaIiFqAhDSANIBagIQ0gEiASoiAEIAUgBaCioCANoCEEIAQgEKAhDSANIBChIRAgBCAQoSIZIRAgECARoCEEIAQgEaEhEiAQIBKhIRUgBCASoSEQIBEgEKEhFiANIRIgEiAMoCEQIBAgDKEhESASIBGhIRIgECARoSERIAwgEaEhDCASIAygIASgIQwgDCAQoCEEIAQgEKEhECAVIBagIAygIBChIREgESAEoCEMIAwgBKEhFyAMRAAAAAIAAKBBoiEQIBAgDKEhBCAQIAShIQQgDCAEoSEVIAErAwAiFkQAAAACAACgQaIhECAQIBahIRIgECASoSESIBYgEqEhBSAWIAyiIRAgBCASoiAQoSEYIBggFSASoqAhEiASIAQgBaKgIQQgASsDCCAMoiARIBehIBaioCAVIAWioCAEoCEEIAQgEKAhDCAMIBChIRAgBCAQoSEQIAkgEKAhBCAEIBChIRIgCSASoSERIAQgEqEhEiAQIBKhIRUgCCAMoCEQIBAgDKEhEiAIIBKhIQkgECASoSESIAwgEqEhDCAJIAygIASgIQQgBCAQoCEMIAwgEKEhECARIBWgIASgIBChIRAgECAMoCEEIAEgBDkDACAEIAyhIQwgASAQIAyhOQMIIAMhDCATIAygIRAgECAMoSEEIBMgBKEhESAQIAShIQQgDCAEoSETIAIhBCAUIASgIQwgDCAEoSESIBQgEqEhFCAMIBKhIRIgBCASoSEEIBQgBKAgEKAhBCAEIAygIRAgECAMoSEMIBEgE6AgBKAgDKEhEiASIBCgIQwgDCAQoSETIAxEAAAAAgAAoEGiIRAgECAMoSEEIBAgBKEhBCAMIAShIREgDCACoiEQIAQgCqIgEKEhFCAUIBEgCqKgIQogCiAEIAuioCEKIBIgE6EgAqIgDCADoqAgESALoqAgCqAhCiAKIBCgIQIgAiAQoSELIAogC6EhDCANRAAAAAIAAKBBoiEKIAogDaEhCyAKIAuhIQsgDSALoSEQIA1EAAAAAAAAFECiIQogCyAOoiAKoSENIA0gECAOoqAhDSANIAsgD6KgIQsgECAPoiAZRAAAAAAAABRAoqAgC6AhDSANIAqgIQsgCyAKoSEKIA0gCqEhCiAKIAygIQ0gDSAMoSEQIAogEKEhBCANIBChIQogDCAKoSEQIAsgAqAhCiAKIAKhIQwgCyAMoSELIAogDKEhDCACIAyhIQIgCyACoCANoCECIAIgCqAhCyALIAqhIQogBCAQoCACoCAKoSENIA0gC6AhAiACIAuhIRIgAkQAAAACAACgQaIhCiAKIAKhIQsgCiALoSELIAIgC6EhECAAKwMAIgREAAAAAgAAoEGiIQogCiAEoSEMIAogDKEhDCAEIAyhIQ4gBCACoiEKIAsgDKIgCqEhESARIBAgDKKgIQwgDCALIA6ioCELIAArAwggAqIgDSASoSAEoqAgECAOoqAgC6AhCyALIAqgIQIgAiAKoSEKIAsgCqEhCiAHIAqgIQsgCyAKoSEMIAcgDKEhDSALIAyhIQwgCiAMoSEQIAYgAqAhCiAKIAKhIQwgBiAMoSEEIAogDKEhDCACIAyhIQIgBCACoCALoCELIAsgCqAhAiACIAqhIQogDSAQoCALoCAKoSEKIAogAqAhCyAAIAs5AwAgCyACoSECIAAgCiACoTkDCAvcEgEYfCACRAAAAAIAAKBBoiEKIAogAqEhCyAKIAuhIQogAiAKoSEMIAIgAqIhCyAKIAqiIAuhIQ0gDSAMIAqiIg6gIQ0gDSAOoCENIAwgDKIgAiADIAOgoqAgDaAhDSANIAugIQ4gDiALoSELIA0gC6EiDyEQIAREAAAAAgAAoEGiIQsgCyAEoSENIAsgDaEhCyAEIAuhIQ0gBCAEoiERIAsgC6IgEaEhEiASIA0gC6IiE6AhEiASIBOgIRIgDSANoiAEIAUgBaCioCASoCETIBMgEaAhEiASIBGhIREgEyARoSIUIRUgFSAQoCEWIBYgEKEhESAWIBGhIRMgECAToSEXIBUgEaEhGCAOIREgEiEZIBkgEaAhEyATIBGhIRogEyAaoSEbIBEgG6EhGyAZIBqhIRogGiAboCAWoCEaIBogE6AhFiAWIBOhIRMgGCAXoCAaoCAToSEYIBggFqAhEyATIBahIRwgE0QAAAACAACgQaIhFiAWIBOhIRogFiAaoSEaIBMgGqEhG0QAAAADAADIQSEWIBZEAAAAAAAAGMCgIRcgFiAXoSEXRAAAAAAAABhAIBehIR0gE0QAAAAAAAAYQKIhFiAaIBeiIBahIRMgEyAbIBeioCETIBMgGiAdoqAhEyAbIB2iIBggHKFEAAAAAAAAGECioCAToCEaIBogFqAhEyATIBahIRYgGiAWoSEXRAAAgAIAAORBIRYgFkQAAAAAAAA0wKAhGiAWIBqhIRYgAkQAAAAAAAA0QKIhGiAWIAqiIBqhIRggGCAWIAyioCEYRAAAAAAAADRAIBahIRYgGCAWIAqioCEYIBYgDKIgA0QAAAAAAAA0QKKgIBigIRsgGyAaoCEWIBYgGqEhHCAWRAAAAAIAAKBBoiEaIBogFqEhGCAaIBihIRggFiAYoSEdIBYgBKIhGiAYIAuiIBqhIR4gHiAYIA2ioCEYIBggHSALoqAhGCAbIByhIASiIBYgBaKgIB0gDaKgIBigIRYgFiAaoCEYIBggGqEhGiAaIBahIRYgFiAXoCEaIBogF6EhGyAWIBuhIR0gGiAboSEWIBcgFqEhGyAYmiEXIBcgE6AhFiAWIBOhIRggFyAYoSEXIBYgGKEhGCATIBihIRMgFyAToCAaoCETIBMgFqAhGiAaIBahIRYgHSAboCAToCAWoSEbIBsgGqAhEyATIBqhIR8gACsDACIYRAAAAAIAAKBBoiEWIBYgGKEhGiAWIBqhIRYgASsDACIdRAAAAAIAAKBBoiEaIBogHaEhFyAaIBehIRcgHSAXoSEcIB0gGKIhGiAXIBaiIBqhIR4gHiAcIBaioCEeIBggFqEhFiAeIBcgFqKgIRcgASsDCCAYoiAdIAArAwiioCAcIBaioCAXoCEdIB0gGqAhFiAWIBqhISAgE0QAAAACAACgQaIhGiAaIBOhIRcgGiAXoSEXIBMgF6EhHCAWRAAAAAIAAKBBoiEaIBogFqEhGCAaIBihIRggFiAYoSEeIBMgFqIhGiAXIBiiIBqhISEgISAcIBiioCEYIBggFyAeoqAhFyAbIB+hIBaiIBMgHSAgoaKgIBwgHqKgIBegIRYgFiAaoCETIBMgGqEhGiAWIBqhIRYgCSAWoCEaIBogFqEhFyAJIBehIRggGiAXoSEXIBYgF6EhCSAIIBOgIRYgFiAToSEXIAggF6EhCCAWIBehIRcgEyAXoSETIAggE6AgGqAhGiAaIBagIRMgEyAWoSEWIBggCaAgGqAgFqEhFiAWIBOgIRogASAaOQMAIBogE6EhEyABIBYgE6E5AwggEkQAAAACAACgQaIhEyATIBKhIRYgEyAWoSEWIBIgFqEhF0QAAMADAADeQSETIBNEAAAAAAAALsCgIRogEyAaoSETRAAAAAAAAC5AIBOhIRogEkQAAAAAAAAuQKIhEiAWIBOiIBKhIRggGCAXIBOioCEYIBggFiAaoqAhFiAXIBqiIBREAAAAAAAALkCioCAWoCEXIBcgEqAhFiAWIBKhIRIgFyASoSEXIBcgEKAhEiASIBChIRggFyAYoSEJIBIgGKEhFyAQIBehIRggFiARoCEQIBAgEaEhFyAWIBehIRYgECAXoSEXIBEgF6EhESAWIBGgIBKgIREgESAQoCESIBIgEKEhECAJIBigIBGgIBChIRYgFiASoCEQIBAgEqEhGCAQRAAAAAIAAKBBoiESIBIgEKEhESASIBGhIREgECARoSEXIAIgEKIhEiARIAqiIBKhIQkgCSAXIAqioCEKIAogESAMoqAhCiADIBCiIBYgGKEgAqKgIBcgDKKgIAqgIQIgAiASoCEKIAogEqEhDCACIAyhIRAgDkQAAAACAACgQaIhAiACIA6hIQwgAiAMoSECIA4gAqEhEiAORAAAAAAAAC5AoiEMIAIgE6IgDKEhDiAOIBIgE6KgIQ4gDiACIBqioCECIBIgGqIgD0QAAAAAAAAuQKKgIAKgIQ4gDiAMoCECIAIgDKEhDCAOIAyhIQwgDCAVoCEOIA4gDKEhEiAVIBKhIREgDiASoSESIAwgEqEhEyACIBmgIQwgDCACoSESIBkgEqEhFiAMIBKhIRIgAiASoSECIBYgAqAgDqAhAiACIAygIQ4gDiAMoSEMIBEgE6AgAqAgDKEhEiASIA6gIQIgAiAOoSETIAJEAAAAAgAAoEGiIQwgDCACoSEOIAwgDqEhDiACIA6hIREgBCACoiEMIA4gC6IgDKEhFiAWIBEgC6KgIQsgCyAOIA2ioCELIAUgAqIgEiAToSAEoqAgESANoqAgC6AhBCAEIAygIQIgAiAMoSELIAsgBKEhBCAEIBCgIQsgCyAQoSEMIAsgDKEhDSAQIA2hIQ0gBCAMoSEOIAKaIQIgAiAKoCEEIAQgCqEhDCAEIAyhIRAgCiAQoSEKIAIgDKEhAiACIAqgIAugIQsgCyAEoCEKIAogBKEhBCAOIA2gIAugIAShIQsgCyAKoCEEIAQgCqEhCiALIAqhIQogByAKoCELIAsgCqEhAiAHIAKhIQwgCyACoSECIAogAqEhDSAGIASgIQogCiAEoSECIAYgAqEhDiAKIAKhIQIgBCACoSEEIA4gBKAgC6AhCyALIAqgIQQgBCAKoSEKIAwgDaAgC6AgCqEhCiAKIASgIQsgACALOQMAIAsgBKEhBCAAIAogBKE5AwgL4xUBHHwgAkQAAAACAACgQaIhCiAKIAKhIQsgCiALoSEKIAIgCqEhDEQAADACAIDxQSELIAtEAAAAAACAQcCgIQ0gCyANoSEOIAJEAAAAAACAQUCiIQsgDiAKoiALoSENIA0gDiAMoqAhDUQAAAAAAIBBQCAOoSEPIA0gDyAKoqAhDSAPIAyiIANEAAAAAACAQUCioCANoCENIA0gC6AhECAQIAuhIQsgDSALoSERIAREAAAAAgAAoEGiIQsgCyAEoSENIAsgDaEhCyAEIAuhIQ1EAACAAwAAzEEhEiASRAAAAAAAABzAoCETIBIgE6EhFCAERAAAAAAAABxAoiESIBQgC6IgEqEhEyATIBQgDaKgIRNEAAAAAAAAHEAgFKEhFSATIBUgC6KgIRMgFSANoiAFRAAAAAAAABxAoqAgE6AhEyATIBKgIRYgFiASoSESIBIgE6EhEiASIBGgIRMgEyARoSEXIBMgF6EhGCARIBihIRggEiAXoSEXIBaaIREgESAQoCESIBIgEKEhFiASIBahIRkgECAZoSEQIBEgFqEhESARIBCgIBOgIREgESASoCEQIBAgEqEhEiAXIBigIBGgIBKhIRcgFyAQoCESIBIgEKEhGiAEIASiIREgCyALoiARoSEQIBAgDSALoiIToCEQIBAgE6AhECANIA2iIAQgBSAFoKKgIBCgIRggGCARoCEQIBAgEaEhGyASRAAAAAIAAKBBoiERIBEgEqEhEyARIBOhIRMgEiAToSEZIBBEAAAAAgAAoEGiIREgESAQoSEWIBEgFqEhFiAQIBahIRwgEiAQoiERIBMgFqIgEaEhHSAdIBkgFqKgIR0gHSATIByioCETIBcgGqEgEKIgEiAYIBuhIh6ioCAZIByioCAToCESIBIgEaAhFyAXIBGhIREgEiARoSEfRAAAoAIAAOVBIRIgEkQAAAAAAAA1wKAhESASIBGhIRggBEQAAAAAAAA1QKIhEiAYIAuiIBKhIREgESAYIA2ioCERRAAAAAAAADVAIBihIRogESAaIAuioCERIBogDaIgBUQAAAAAAAA1QKKgIBGgIREgESASoCETIBMgEqEhEiASIBGhIRkgAyESIBkgEqAhESARIBKhIRsgGSAboSEdIBEgG6EhGSASIBmhISAgE5ohGSACIRMgGSAToCESIBIgE6EhGyAZIBuhIRkgEiAboSEbIBMgG6EhEyAZIBOgIBGgIREgESASoCETIBMgEqEhEiAdICCgIBGgIBKhISAgICAToCERIBEgE6EhISACIAKiIRMgCiAKoiAToSESIBIgDCAKoiIZoCESIBIgGaAhEiAMIAyiIAIgAyADoKKgIBKgISIgIiAToCESIBIgE6EhIyARRAAAAAIAAKBBoiETIBMgEaEhGSATIBmhIR0gESAdoSEkIBJEAAAAAgAAoEGiIRMgEyASoSEZIBMgGaEhGSASIBmhIRsgESASoiETIB0gGaIgE6EhJSAlICQgGaKgISUgJSAdIBuioCEdICAgIaEgEqIgESAiICOhIiWioCAkIBuioCAdoCEdIB0gE6AhESARIBOhIRMgHSAToSETIB8gE6AhHSAdIBOhISAgHyAgoSEiIB0gIKEhHyATIB+hISAgFyARoCETIBMgEaEhHyAXIB+hIRcgEyAfoSEfIBEgH6EhESAXIBGgIB2gIREgESAToCEXIBcgE6EhEyAiICCgIBGgIBOhIR8gHyAXoCERIBEgF6EhISARRAAAAAIAAKBBoiETIBMgEaEhFyATIBehIRcgESAXoSEgIAArAwAiIkQAAAACAACgQaIhEyATICKhIR0gEyAdoSEdICIgHaEhJCAiIBGiIRMgFyAdoiAToSEjICMgICAdoqAhHSAdIBcgJKKgIRcgACsDCCARoiAfICGhICKioCAgICSioCAXoCEXIBcgE6AhESARIBOhIRMgFyAToSETIAcgE6AhFyAXIBOhIR0gByAdoSEHIBcgHaEhHSATIB2hIR8gBiARoCETIBMgEaEhHSAGIB2hIQYgEyAdoSEdIBEgHaEhESAGIBGgIBegIRcgFyAToCERIBEgE6EhEyAHIB+gIBegIBOhIRMgEyARoCEXIAAgFzkDACAXIBGhIREgACATIBGhOQMIIAJEAAAAAAAAHECiIRMgCiAUoiAToSERIBEgDCAUoqAhESARIAogFaKgIREgDCAVoiADRAAAAAAAABxAoqAgEaAhFCAUIBOgIREgESAToSETIBQgE6EhFCAERAAAAAAAgEFAoiETIAsgDqIgE6EhFyAXIA0gDqKgIQ4gDiALIA+ioCELIA0gD6IgBUQAAAAAAIBBQKKgIAugIQsgCyAToCEOIA4gE6EhDSANIAuhIQsgCyAUoCENIA0gFKEhEyANIBOhIRcgFCAXoSEUIAsgE6EhFyAOmiETIBMgEaAhCyALIBGhIQ4gCyAOoSEPIBEgD6EhESATIA6hIRMgEyARoCANoCERIBEgC6AhDSANIAuhIQsgFyAUoCARoCALoSETIBMgDaAhCyALIA2hIRQgC0QAAAACAACgQaIhDSANIAuhIREgDSARoSERIAsgEaEhDiALIBKiIQ0gESAZoiANoSEXIBcgDiAZoqAhFyAXIBEgG6KgIREgEyAUoSASoiALICWioCAOIBuioCARoCESIBIgDaAhCyALIA2hIQ0gEiANoSESIAJEAAAAAAAANUCiIQ0gCiAYoiANoSECIAIgDCAYoqAhAiACIAogGqKgIQogDCAaoiADRAAAAAAAADVAoqAgCqAhDCAMIA2gIQogCiANoSENIAwgDaEhDCAFmiECIAIgDKAhDSANIAyhIREgAiARoSETIA0gEaEhAiAMIAKhIREgBJohAiACIAqgIQwgDCAKoSEEIAIgBKEhAiAMIAShIQQgCiAEoSEKIAIgCqAgDaAhCiAKIAygIQ0gDSAMoSEMIBMgEaAgCqAgDKEhAiACIA2gIQogCiANoSERIApEAAAAAgAAoEGiIQwgDCAKoSENIAwgDaEhDSAKIA2hIQQgCiAQoiEMIA0gFqIgDKEhEyATIAQgFqKgIRMgEyANIByioCENIAIgEaEgEKIgCiAeoqAgBCAcoqAgDaAhCiAKIAygIQ0gDSAMoSEMIAogDKEhCiAKIBKgIQwgDCASoSECIAogAqEhBCAMIAKhIQogEiAKoSEQIA0gC6AhCiAKIAuhIQIgDSACoSENIAogAqEhAiALIAKhIQsgDSALoCAMoCEMIAwgCqAhCyALIAqhIQogBCAQoCAMoCAKoSECIAIgC6AhCiAKIAuhIREgCkQAAAACAACgQaIhCyALIAqhIQwgCyAMoSEMIAogDKEhBCABKwMAIhBEAAAAAgAAoEGiIQsgCyAQoSENIAsgDaEhDSAQIA2hIRIgECAKoiELIAwgDaIgC6EhEyATIAQgDaKgIQ0gDSAMIBKioCEMIAErAwggCqIgAiARoSAQoqAgBCASoqAgDKAhDCAMIAugIQogCiALoSELIAwgC6EhCyAJIAugIQwgDCALoSENIAkgDaEhAiAMIA2hIQ0gCyANoSEEIAggCqAhCyALIAqhIQ0gCCANoSEQIAsgDaEhDSAKIA2hIQogECAKoCAMoCEMIAwgC6AhCiAKIAuhIQsgAiAEoCAMoCALoSELIAsgCqAhDCABIAw5AwAgDCAKoSEKIAEgCyAKoTkDCAuBBgIKfAF/IAArAwAiCkQAAAACAACgQaIhCyALIAqhIQwgCyAMoSELIAogC6EhDUQAAAACAACwQSEMIAxEAAAAAAAAAMCgIQ4gDCAOoSEMIAogCqAhCiALIAyiIAqhIQ4gDiANIAyioCEORAAAAAAAAABAIAyhIQwgDiALIAyioCELIA0gDKIgACsDCCIMIAygoCALoCEOIA4gCqAhCyALIAqhIQ8gC0QAAAACAACgQaIhCiAKIAuhIQwgCiAMoSEMIAsgDKEhECABKwMAIhFEAAAAAgAAoEGiIQogCiARoSENIAogDaEhDSARIA2hIRIgESALoiEKIA0gDKIgCqEhEyATIBIgDKKgIQwgDCANIBCioCEMIAErAwggC6IgESAOIA+hoqAgEiAQoqAgDKAhDCAMIAqgIQsgCyAKoSEKIAwgCqEiCpogCiALRAAAAAAAAAAAYyIUGyEKIAkgCqAhDCAMIAqhIQ0gCSANoSEJIAwgDaEhDSAKIA2hIQ4gC5ogCyAUGyEKIAggCqAhCyALIAqhIQ0gCCANoSEIIAsgDaEhDSAKIA2hIQogCCAKoCAMoCEMIAwgC6AhCiAKIAuhIQsgCSAOoCAMoCALoSELIAsgCqAhDCABIAw5AwAgDCAKoSEKIAEgCyAKoTkDCCAFmiELIAsgA6AhCiAKIAOhIQwgCiAMoSENIAMgDaEhDSALIAyhIQkgBJohAyADIAKgIQsgCyACoSEMIAsgDKEhCCACIAihIQIgAyAMoSEDIAMgAqAgCqAhAyADIAugIQogCiALoSELIAkgDaAgA6AgC6EhAyADIAqgIQsgCyAKoSEKIAMgCqEhCiAHIAqgIQMgAyAKoSECIAcgAqEhDCADIAKhIQIgCiACoSENIAYgC6AhCiAKIAuhIQIgBiACoSEJIAogAqEhAiALIAKhIQsgCSALoCADoCEDIAMgCqAhCyALIAqhIQogDCANoCADoCAKoSEKIAogC6AhAyAAIAM5AwAgAyALoSELIAAgCiALoTkDCAvDCQMKfAF/AnwgBEQAAAACAACgQaIhCiAKIAShIQsgCiALoSELIAQgC6EhDEQAAAADAAC4QSEKIApEAAAAAAAACMCgIQ0gCiANoSENIAREAAAAAAAACECiIQogCyANoiAKoSEOIA4gDCANoqAhD0QAAAAAAAAIQCANoSEOIA8gCyAOoqAhCyAMIA6iIAVEAAAAAAAACECioCALoCELIAsgCqAhDCAMIAqhIQogCiALoSEPIAMhCiAPIAqgIQsgCyAKoSEQIA8gEKEhESALIBChIQ8gCiAPoSESIAyaIQ8gAiEMIA8gDKAhCiAKIAyhIRAgDyAQoSEPIAogEKEhECAMIBChIQwgDyAMoCALoCEMIAwgCqAhCyALIAqhIQogESASoCAMoCAKoSEQIBAgC6AhCiAKIAuhIRMgCkQAAAACAACgQaIhCyALIAqhIQwgCyAMoSEMIAogDKEhESAAKwMAIguaIAsgC0QAAAAAAAAAAGMiFBsiEkQAAAACAACgQaIhCyALIBKhIQ8gCyAPoSEPIBIgD6EhFSAKIBKiIQsgDCAPoiALoSEWIBYgESAPoqAhDyAPIAwgFaKgIQwgECAToSASoiAKIAArAwgiD5ogDyAUG6KgIBEgFaKgIAygIQwgDCALoCEKIAogC6EhCyAMIAuhIQsgByALoCEMIAwgC6EhDyAHIA+hIQcgDCAPoSEPIAsgD6EhECAGIAqgIQsgCyAKoSEPIAYgD6EhBiALIA+hIQ8gCiAPoSEKIAYgCqAgDKAhDCAMIAugIQogCiALoSELIAcgEKAgDKAgC6EhCyALIAqgIQwgACAMOQMAIAwgCqEhCiAAIAsgCqE5AwggAkQAAAACAACgQaIhCiAKIAKhIQsgCiALoSEKIAIgCqEhDCACRAAAAAAAAAhAoiELIAogDaIgC6EhAiACIAwgDaKgIQ0gDSAKIA6ioCEKIAwgDqIgA0QAAAAAAAAIQKKgIAqgIQ0gDSALoCEKIAogC6EhCyANIAuhIQsgBZohDiAOIAugIQ0gDSALoSECIA4gAqEhDCANIAKhIQ4gCyAOoSECIASaIQ4gDiAKoCELIAsgCqEhBCAOIAShIQ4gCyAEoSEEIAogBKEhCiAOIAqgIA2gIQogCiALoCENIA0gC6EhCyAMIAKgIAqgIAuhIQQgBCANoCEKIAogDaEhByAKRAAAAAIAAKBBoiELIAsgCqEhDSALIA2hIQ0gCiANoSECIAErAwAiC5ogCyALRAAAAAAAAAAAYyIAGyIMRAAAAAIAAKBBoiELIAsgDKEhDiALIA6hIQ4gDCAOoSEPIAogDKIhCyANIA6iIAuhIQYgBiACIA6ioCEOIA4gDSAPoqAhDSAEIAehIAyiIAogASsDCCIOmiAOIAAboqAgAiAPoqAgDaAhDSANIAugIQogCiALoSELIA0gC6EhCyAJIAugIQ0gDSALoSEOIAkgDqEhBCANIA6hIQ4gCyAOoSECIAggCqAhCyALIAqhIQ4gCCAOoSEMIAsgDqEhDiAKIA6hIQogDCAKoCANoCENIA0gC6AhCiAKIAuhIQsgBCACoCANoCALoSELIAsgCqAhDSABIA05AwAgDSAKoSEKIAEgCyAKoTkDCAv7DAMLfAF/AXwgACsDACIKRAAAAAIAAKBBoiELIAsgCqEhDCALIAyhIQsgCiALoSENRAAAAAIAAMBBIQwgDEQAAAAAAAAQwKAhDiAMIA6hIQ4gCkQAAAAAAAAQQKIhDCALIA6iIAyhIQogCiANIA6ioCEKRAAAAAAAABBAIA6hIQ4gCiALIA6ioCELIA0gDqIgACsDCEQAAAAAAAAQQKKgIAugIQogCiAMoCELIAsgDKEhDyALRAAAAAIAAKBBoiEMIAwgC6EhDiAMIA6hIQ4gCyAOoSEQIAErAwAiEUQAAAACAACgQaIhDCAMIBGhIQ0gDCANoSENIBEgDaEhEiARIAuiIQwgDSAOoiAMoSETIBMgEiAOoqAhDiAOIA0gEKKgIQ4gASsDCCALoiARIAogD6GioCASIBCioCAOoCEQIBAgDKAhDSADIQsgBZohCiAKIAugIQ4gDiALoSERIA4gEaEhEiALIBKhIQ8gCiARoSETIAIhCiAEmiERIBEgCqAhCyALIAqhIRIgCyASoSEUIAogFKEhCiARIBKhIREgESAKoCAOoCEKIAogC6AhDiAOIAuhIQsgEyAPoCAKoCALoSEKIAogDqAhCyALIA6hIRMgDSAMoSEUIA2aIA0gDUQAAAAAAAAAAGMiFRsiEUQAAAACAACgQaIhDCAMIBGhIQ4gDCAOoSEOIBEgDqEhEiALRAAAAAIAAKBBoiEMIAwgC6EhDSAMIA2hIQ0gCyANoSEPIAsgEaIhDCANIA6iIAyhIRYgFiAPIA6ioCEOIA4gDSASoqAhDiAKIBOhIBGiIAsgECAUoSINmiANIBUboqAgDyASoqAgDqAhDiAOIAygIQsgCyAMoSEMIA4gDKEhDCAJIAygIQ4gDiAMoSENIAkgDaEhCiAOIA2hIQ0gDCANoSEJIAggC6AhDCAMIAuhIQ0gCCANoSEIIAwgDaEhDSALIA2hIQsgCCALoCAOoCEOIA4gDKAhCyALIAyhIQwgCiAJoCAOoCAMoSEMIAwgC6AhDiABIA45AwAgDiALoSELIAEgDCALoTkDCCACRAAAAAIAAKBBoiELIAsgAqEhDCALIAyhIQsgAiALoSENRAAAAAMAAMhBIQwgDEQAAAAAAAAYwKAhDiAMIA6hIQwgAkQAAAAAAAAYQKIhDiAMIAuiIA6hIQogCiAMIA2ioCEKRAAAAAAAABhAIAyhIQwgCiAMIAuioCEKIAwgDaIgA0QAAAAAAAAYQKKgIAqgIRAgECAOoCEMIAwgDqEhEiAMRAAAAAIAAKBBoiEOIA4gDKEhCiAOIAqhIQggDCAIoSERIAREAAAAAgAAoEGiIQ4gDiAEoSEKIA4gCqEhDiAEIA6hIQogBCAMoiEJIA4gCKIgCaEhDyAPIAogCKKgIQggCCAOIBGioCEIIAUgDKIgBCAQIBKhoqAgCiARoqAgCKAhDCAMIAmgIQggCCAJoSEJIAkgDKEhCSACIAKiIQwgCyALoiAMoSEQIBAgDSALoiIRoCELIAsgEaAhCyANIA2iIAIgAyADoKKgIAugIQsgCyAMoCECIAIgDKEhDCALIAyhIQsgCSALoCEMIAwgC6EhDSAJIA2hIQMgDCANoSENIAsgDaEhECAImiENIA0gAqAhCyALIAKhIQkgDSAJoSENIAsgCaEhCSACIAmhIQIgDSACoCAMoCECIAIgC6AhDCAMIAuhIQsgAyAQoCACoCALoSELIAsgDKAhAiACIAyhIQwgCyAMoSENIAQgBKIhCyAOIA6iIAuhIQwgDCAKIA6iIg6gIQwgDCAOoCEMIAogCqIgBCAFIAWgoqAgDKAhBCAEIAugIQwgDCALoSELIAQgC6EhBCAEIA2gIQsgCyANoSEOIAQgDqEhCiALIA6hIQQgDSAEoSENIAwgAqAhBCAEIAKhIQ4gDCAOoSEMIAQgDqEhDiACIA6hIQIgDCACoCALoCELIAsgBKAhAiACIAShIQQgCiANoCALoCAEoSELIAsgAqAhBCAEIAKhIQIgCyACoSECIAcgAqAhCyALIAKhIQwgByAMoSEOIAsgDKEhDCACIAyhIQ0gBiAEoCECIAIgBKEhDCAGIAyhIQogAiAMoSEMIAQgDKEhBCAKIASgIAugIQsgCyACoCEEIAQgAqEhAiAOIA2gIAugIAKhIQIgAiAEoCELIAAgCzkDACALIAShIQQgACACIAShOQMIC/8FAQp8IAArAwAiCkQAAAACAACgQaIhCyALIAqhIQwgCyAMoSELIAogC6EhDUQAAAACAACwQSEMIAxEAAAAAAAAAMCgIQ4gDCAOoSEMIAogCqAhCiALIAyiIAqhIQ4gDiANIAyioCEORAAAAAAAAABAIAyhIQwgDiALIAyioCELIA0gDKIgACsDCCIMIAygoCALoCEOIA4gCqAhCyALIAqhIQ8gC0QAAAACAACgQaIhCiAKIAuhIQwgCiAMoSEMIAsgDKEhECABKwMAIhFEAAAAAgAAoEGiIQogCiARoSENIAogDaEhDSARIA2hIRIgESALoiEKIA0gDKIgCqEhEyATIBIgDKKgIQwgDCANIBCioCEMIAErAwggC6IgESAOIA+hoqAgEiAQoqAgDKAhDCAMIAqgIQsgCyAKoSEKIAwgCqEhCiAJIAqgIQwgDCAKoSENIAkgDaEhCSAMIA2hIQ0gCiANoSEOIAggC6AhCiAKIAuhIQ0gCCANoSEIIAogDaEhDSALIA2hIQsgCCALoCAMoCEMIAwgCqAhCyALIAqhIQogCSAOoCAMoCAKoSEKIAogC6AhDCABIAw5AwAgDCALoSELIAEgCiALoTkDCCAFmiELIAsgA6AhCiAKIAOhIQwgCiAMoSENIAMgDaEhDSALIAyhIQkgBJohAyADIAKgIQsgCyACoSEMIAsgDKEhCCACIAihIQIgAyAMoSEDIAMgAqAgCqAhAyADIAugIQogCiALoSELIAkgDaAgA6AgC6EhAyADIAqgIQsgCyAKoSEKIAMgCqEiCpogCiALRAAAAAAAAAAAYyIBGyEKIAcgCqAhAyADIAqhIQIgByACoSEMIAMgAqEhAiAKIAKhIQ0gC5ogCyABGyEKIAYgCqAhCyALIAqhIQIgBiACoSEJIAsgAqEhAiAKIAKhIQogCSAKoCADoCEDIAMgC6AhCiAKIAuhIQsgDCANoCADoCALoSELIAsgCqAhAyAAIAM5AwAgAyAKoSEKIAAgCyAKoTkDCAvZBgIJfAF/IAErAwAiCEQAAAACAACgQaIhCSAJIAihIQogCSAKoSEJIAggCaEhCyAIIAiiIQogCSAJoiAKoSEMIAwgCyAJoiINoCEMIAwgDaAhDCALIAuiIAggASsDCCIOIA6goqAgDKAhDCAMIAqgIQ0gDSAKoSEKIAogDKEhCiAKIAOgIQwgDCADoSEPIAogD6EhECAMIA+hIQogAyAKoSEPIA2aIQMgAyACoCEKIAogAqEhDSADIA2hIQMgCiANoSENIAIgDaEhAiADIAKgIAygIQIgAiAKoCEDIAMgCqEhCiAQIA+gIAKgIAqhIQIgAiADoCEKIAogA6EhAyACIAOhIQMgBSADoCECIAIgA6EhDCAFIAyhIQUgAiAMoSEMIAMgDKEhDSAEIAqgIQMgAyAKoSEMIAQgDKEhBCADIAyhIQwgCiAMoSEKIAQgCqAgAqAhAiACIAOgIQogCiADoSEDIAUgDaAgAqAgA6EhDCAMIAqgIQMgACsDACECIAAgA5ogAyADRAAAAAAAAAAAYyIRGzkDACADIAqhIQogACsDCCENIAAgDCAKoSIKmiAKIBEbOQMIIAJEAAAAAgAAoEGiIQogCiACoSEDIAogA6EhCiACIAqhIQVEAAAAAgAAsEEhAyADRAAAAAAAAADAoCEMIAMgDKEhDCACIAKgIQMgCiAMoiADoSECIAIgBSAMoqAhBEQAAAAAAAAAQCAMoSECIAQgCiACoqAhCiAFIAKiIA0gDaCgIAqgIQwgDCADoCEKIAogA6EhBCAKRAAAAAIAAKBBoiEDIAMgCqEhAiADIAKhIQIgCiACoSEFIAggCqIhAyAJIAKiIAOhIQ0gDSALIAKioCECIAIgCSAFoqAhCSAOIAqiIAggDCAEoaKgIAsgBaKgIAmgIQkgCSADoCEIIAggA6EhCiAKIAmhIQkgB5ohAyADIAmgIQogCiAJoSELIAMgC6EhAiAKIAuhIQMgCSADoSEMIAiaIQMgBpohCCAIIAOgIQkgCSADoSELIAggC6EhCCAJIAuhIQsgAyALoSEDIAggA6AgCqAhAyADIAmgIQogCiAJoSEJIAIgDKAgA6AgCaEhCSAJIAqgIQMgASADOQMAIAMgCqEhCiABIAkgCqE5AwgL3QgEAXsCfAF/BXwgACAA/QADACIK/e0BIAogCv0hAEQAAAAAAAAAAGP9EUE//csBQT/9zAH9Uv0LAwAgASABKwMIIguaIAsgASsDACIMRAAAAAAAAAAAYyINGyIOOQMIIAEgDJogDCANGyILOQMAIAWaIQUgBSADoCEMIAwgA6EhDyAMIA+hIRAgAyAQoSEQIAUgD6EhESAEmiEFIAUgAqAhAyADIAKhIQ8gAyAPoSEEIAIgBKEhAiAFIA+hIQUgBSACoCAMoCEMIAwgA6AhAiACIAOhIQMgESAQoCAMoCADoSEMIAwgAqAhAyADIAKhIQIgDCACoSECIAArAwgiEpohBSAFIAKgIQwgDCACoSEPIAUgD6EhESAMIA+hIQUgAiAFoSEEIAArAwAiBZohDyAPIAOgIQIgAiADoSEQIA8gEKEhDyACIBChIRAgAyAQoSEDIA8gA6AgDKAhAyADIAKgIQwgDCACoSECIBEgBKAgA6AgAqEhAiACIAygIQMgAyAMoSEMIAIgDKEhAiAHIAKgIQwgDCACoSEPIAcgD6EhECAMIA+hIQcgAiAHoSEPIAYgA6AhAiACIAOhIQcgBiAHoSEGIAIgB6EhByADIAehIQMgBiADoCAMoCEMIAwgAqAhAyADIAKhIQIgECAPoCAMoCACoSECIAIgA6AhDCAAIAw5AwAgDCADoSEDIAAgAiADoTkDCCAFRAAAAAIAAKBBoiEDIAMgBaEhAiADIAKhIQMgBSADoSEHRAAAAAIAALBBIQIgAkQAAAAAAAAAwKAhDCACIAyhIQwgBSAFoCECIAMgDKIgAqEhBSAFIAcgDKKgIQVEAAAAAAAAAEAgDKEhDCAFIAMgDKKgIQMgByAMoiASIBKgoCADoCEHIAcgAqAhAyADIAKhIRAgA0QAAAACAACgQaIhAiACIAOhIQwgAiAMoSEMIAMgDKEhBiALRAAAAAIAAKBBoiECIAIgC6EhBSACIAWhIQUgCyAFoSEPIAsgA6IhAiAFIAyiIAKhIREgESAPIAyioCEMIAwgBSAGoqAhDCAOIAOiIAsgByAQoaKgIA8gBqKgIAygIQwgDCACoCEDIAMgAqEhAiAMIAKhIQIgASsDCJohCyALIAKgIQwgDCACoSEFIAsgBaEhByAMIAWhIQsgAiALoSEGIAErAwCaIQsgCyADoCECIAIgA6EhBSALIAWhIQsgAiAFoSEFIAMgBaEhAyALIAOgIAygIQMgAyACoCEMIAwgAqEhAiAHIAagIAOgIAKhIQIgAiAMoCEDIAMgDKEhDCACIAyhIQIgCSACoCEMIAwgAqEhCyAJIAuhIQUgDCALoSELIAIgC6EhByAIIAOgIQIgAiADoSELIAggC6EhBiACIAuhIQsgAyALoSEDIAYgA6AgDKAhDCAMIAKgIQMgAyACoSECIAUgB6AgDKAgAqEhAiACIAOgIQwgASAMOQMAIAwgA6EhAyABIAIgA6E5AwgL6AUBCnwgACsDACIKRAAAAAIAAKBBoiELIAsgCqEhDCALIAyhIQsgCiALoSENRAAAAAIAALDBIQwgDEQAAAAAAAAAQKAhDiAMIA6hIQ4gCkQAAAAAAAAAwKIhDCALIA6iIAyhIQogCiANIA6ioCEKRAAAAAAAAADAIA6hIQ4gCiALIA6ioCELIA0gDqIgACsDCCIOIA6goSALoCEKIAogDKAhCyALIAyhIQ8gC0QAAAACAACgQaIhDCAMIAuhIQ4gDCAOoSEOIAsgDqEhECABKwMAIhFEAAAAAgAAoEGiIQwgDCARoSENIAwgDaEhDSARIA2hIRIgESALoiEMIA0gDqIgDKEhEyATIBIgDqKgIQ4gDiANIBCioCEOIAErAwggC6IgESAKIA+hoqAgEiAQoqAgDqAhDiAOIAygIQsgCyAMoSEMIA4gDKEhDCAJIAygIQ4gDiAMoSENIAkgDaEhCSAOIA2hIQ0gDCANoSEKIAggC6AhDCAMIAuhIQ0gCCANoSEIIAwgDaEhDSALIA2hIQsgCCALoCAOoCEOIA4gDKAhCyALIAyhIQwgCSAKoCAOoCAMoSEMIAwgC6AhDiABIA45AwAgDiALoSELIAEgDCALoTkDCCAFmiELIAsgA6AhDCAMIAOhIQ4gDCAOoSENIAMgDaEhDSALIA6hIQkgBJohAyADIAKgIQsgCyACoSEOIAsgDqEhCCACIAihIQIgAyAOoSEDIAMgAqAgDKAhAyADIAugIQwgDCALoSELIAkgDaAgA6AgC6EhAyADIAygIQsgCyAMoSEMIAMgDKEhDCAHIAygIQMgAyAMoSECIAcgAqEhDiADIAKhIQIgDCACoSENIAYgC6AhDCAMIAuhIQIgBiACoSEJIAwgAqEhAiALIAKhIQsgCSALoCADoCEDIAMgDKAhCyALIAyhIQwgDiANoCADoCAMoSEMIAwgC6AhAyAAIAM5AwAgAyALoSELIAAgDCALoTkDCAvhBQEKfCAAKwMAIgpEAAAAAgAAoEGiIQsgCyAKoSEMIAsgDKEhCyAKIAuhIQ1EAAAAAgAAsEEhDCAMRAAAAAAAAADAoCEOIAwgDqEhDCAKIAqgIQogCyAMoiAKoSEOIA4gDSAMoqAhDkQAAAAAAAAAQCAMoSEMIA4gCyAMoqAhCyANIAyiIAArAwgiDCAMoKAgC6AhDiAOIAqgIQsgCyAKoSEPIAtEAAAAAgAAoEGiIQogCiALoSEMIAogDKEhDCALIAyhIRAgASsDACIRRAAAAAIAAKBBoiEKIAogEaEhDSAKIA2hIQ0gESANoSESIBEgC6IhCiANIAyiIAqhIRMgEyASIAyioCEMIAwgDSAQoqAhDCABKwMIIAuiIBEgDiAPoaKgIBIgEKKgIAygIQwgDCAKoCELIAsgCqEhCiAMIAqhIQogCSAKoCEMIAwgCqEhDSAJIA2hIQkgDCANoSENIAogDaEhDiAIIAugIQogCiALoSENIAggDaEhCCAKIA2hIQ0gCyANoSELIAggC6AgDKAhDCAMIAqgIQsgCyAKoSEKIAkgDqAgDKAgCqEhCiAKIAugIQwgASAMOQMAIAwgC6EhCyABIAogC6E5AwggBZohCyALIAOgIQogCiADoSEMIAogDKEhDSADIA2hIQ0gCyAMoSEJIASaIQMgAyACoCELIAsgAqEhDCALIAyhIQggAiAIoSECIAMgDKEhAyADIAKgIAqgIQMgAyALoCEKIAogC6EhCyAJIA2gIAOgIAuhIQMgAyAKoCELIAsgCqEhCiADIAqhIQogByAKoCEDIAMgCqEhAiAHIAKhIQwgAyACoSECIAogAqEhDSAGIAugIQogCiALoSECIAYgAqEhCSAKIAKhIQIgCyACoSELIAkgC6AgA6AhAyADIAqgIQsgCyAKoSEKIAwgDaAgA6AgCqEhCiAKIAugIQMgACADOQMAIAMgC6EhCyAAIAogC6E5AwgLhwkBDHwgBEQAAAACAACgQaIhCiAKIAShIQsgCiALoSELIAQgC6EhDEQAAAADAAC4QSEKIApEAAAAAAAACMCgIQ0gCiANoSENIAREAAAAAAAACECiIQogCyANoiAKoSEOIA4gDCANoqAhD0QAAAAAAAAIQCANoSEOIA8gCyAOoqAhCyAMIA6iIAVEAAAAAAAACECioCALoCELIAsgCqAhDCAMIAqhIQogCiALoSEPIAMhCiAPIAqgIQsgCyAKoSEQIA8gEKEhESALIBChIQ8gCiAPoSESIAyaIQ8gAiEMIA8gDKAhCiAKIAyhIRAgDyAQoSEPIAogEKEhECAMIBChIQwgDyAMoCALoCEMIAwgCqAhCyALIAqhIQogESASoCAMoCAKoSEQIBAgC6AhCiAKIAuhIRMgCkQAAAACAACgQaIhCyALIAqhIQwgCyAMoSEMIAogDKEhESAAKwMAIhJEAAAAAgAAoEGiIQsgCyASoSEPIAsgD6EhDyASIA+hIRQgEiAKoiELIAwgD6IgC6EhFSAVIBEgD6KgIQ8gDyAMIBSioCEMIAArAwggCqIgECAToSASoqAgESAUoqAgDKAhDCAMIAugIQogCiALoSELIAwgC6EhCyAHIAugIQwgDCALoSEPIAcgD6EhByAMIA+hIQ8gCyAPoSEQIAYgCqAhCyALIAqhIQ8gBiAPoSEGIAsgD6EhDyAKIA+hIQogBiAKoCAMoCEMIAwgC6AhCiAKIAuhIQsgByAQoCAMoCALoSELIAsgCqAhDCAAIAw5AwAgDCAKoSEKIAAgCyAKoTkDCCACRAAAAAIAAKBBoiEKIAogAqEhCyAKIAuhIQogAiAKoSEMIAJEAAAAAAAACECiIQsgCiANoiALoSECIAIgDCANoqAhDSANIAogDqKgIQogDCAOoiADRAAAAAAAAAhAoqAgCqAhDSANIAugIQogCiALoSELIA0gC6EhCyAFmiEOIA4gC6AhDSANIAuhIQIgDiACoSEMIA0gAqEhDiALIA6hIQIgBJohDiAOIAqgIQsgCyAKoSEEIA4gBKEhDiALIAShIQQgCiAEoSEKIA4gCqAgDaAhCiAKIAugIQ0gDSALoSELIAwgAqAgCqAgC6EhBCAEIA2gIQogCiANoSEHIApEAAAAAgAAoEGiIQsgCyAKoSENIAsgDaEhDSAKIA2hIQIgASsDACIMRAAAAAIAAKBBoiELIAsgDKEhDiALIA6hIQ4gDCAOoSEPIAwgCqIhCyANIA6iIAuhIQYgBiACIA6ioCEOIA4gDSAPoqAhDSABKwMIIAqiIAQgB6EgDKKgIAIgD6KgIA2gIQ0gDSALoCEKIAogC6EhCyANIAuhIQsgCSALoCENIA0gC6EhDiAJIA6hIQQgDSAOoSEOIAsgDqEhAiAIIAqgIQsgCyAKoSEOIAggDqEhDCALIA6hIQ4gCiAOoSEKIAwgCqAgDaAhDSANIAugIQogCiALoSELIAQgAqAgDaAgC6EhCyALIAqgIQ0gASANOQMAIA0gCqEhCiABIAsgCqE5AwgLrg0BEXwgACsDACIKRAAAAAIAAKBBoiELIAsgCqEhDCALIAyhIQ0gASsDACIORAAAAAIAAKBBoiELIAsgDqEhDCALIAyhIQ8gDiAPoSEQIA4gCqIhDCAPIA2iIAyhIQsgCyAQIA2ioCELIAogDaEhESALIA8gEaKgIQsgASsDCCISIAqiIA4gACsDCCIToqAgECARoqAgC6AhFCAUIAygIQsgCyAMoSEVIAtEAAAAAgAAoEGiIQwgDCALoSEWIAwgFqEhFiALIBahIRcgAkQAAAACAACgQaIhDCAMIAKhIRggDCAYoSEYIAIgGKEhGSACIAuiIQwgFiAYoiAMoSEaIBogFyAYoqAhGiAaIBYgGaKgIRYgAyALoiAUIBWhIAKioCAXIBmioCAWoCELIAsgDKAhFiAWIAyhIQwgCyAMoSEXIAREAAAAAgAAoEGiIQsgCyAEoSEMIAsgDKEhCyAEIAuhIQwgBCAKoiEUIAsgDaIgFKEhFSAVIAwgDaKgIQ0gDSALIBGioCENIAUgCqIgBCAToqAgDCARoqAgDaAhESARIBSgIQ0gDSAUoSEaIA1EAAAAAgAAoEGiIRQgFCANoSEKIBQgCqEhCiANIAqhIRUgDSAOoiEUIAogD6IgFKEhEyATIAogEKKgIQogCiAVIA+ioCEPIBEgGqEgDqIgDSASoqAgFSAQoqAgD6AhDSANIBSgIQogCiAUoSEPIA8gDaEhDSANIBegIQ8gDyAXoSEUIA8gFKEhDiAXIA6hIQ4gDSAUoSEQIAqaIRQgFCAWoCENIA0gFqEhCiANIAqhIREgFiARoSEWIBQgCqEhFCAUIBagIA+gIQ8gDyANoCEWIBYgDaEhDSAQIA6gIA+gIA2hIRQgFCAWoCENIA0gFqEhECANRAAAAAIAAKBBoiEWIBYgDaEhDyAWIA+hIRYgDSAWoSEKRAAAAAIAAMBBIQ8gD0QAAAAAAAAQwKAhDiAPIA6hIQ9EAAAAAAAAEEAgD6EhDiANRAAAAAAAABBAoiENIBYgD6IgDaEhESARIAogD6KgIQ8gDyAWIA6ioCEWIAogDqIgFCAQoUQAAAAAAAAQQKKgIBagIQ8gDyANoCEWIBYgDaEhDSAPIA2hIQ0gCSANoCEPIA8gDaEhFCAJIBShIQogDyAUoSEUIA0gFKEhDiAIIBagIQ0gDSAWoSEUIAggFKEhECANIBShIRQgFiAUoSEWIBAgFqAgD6AhDyAPIA2gIRYgFiANoSENIAogDqAgD6AgDaEhDSANIBagIQ8gASAPOQMAIA8gFqEhFiABIA0gFqE5AwhEAAAAAwAAyEEhFiAWRAAAAAAAABjAoCENIBYgDaEhDSAERAAAAAAAABhAoiEWIAsgDaIgFqEhDyAPIAwgDaKgIQ9EAAAAAAAAGEAgDaEhDSAPIAsgDaKgIQ8gDCANoiAFRAAAAAAAABhAoqAgD6AhDSANIBagIQ8gDyAWoSEWIBYgDaEhFCADIRYgFCAWoCENIA0gFqEhCiAUIAqhIQ4gDSAKoSEUIBYgFKEhECAPmiEUIAIhDyAUIA+gIRYgFiAPoSEKIBQgCqEhFCAWIAqhIQogDyAKoSEPIBQgD6AgDaAhDyAPIBagIQ0gDSAWoSEWIA4gEKAgD6AgFqEhFCAUIA2gIRYgFiANoSEOIBZEAAAAAgAAoEGiIQ0gDSAWoSEPIA0gD6EhDyAWIA+hIQogFiACoiENIA8gGKIgDaEhECAQIAogGKKgIRggGCAPIBmioCEPIBQgDqEgAqIgFiADoqAgCiAZoqAgD6AhFiAWIA2gIQIgAiANoSENIBYgDaEhDSAEIASiIRYgCyALoiAWoSEPIA8gDCALoiIYoCELIAsgGKAhCyAMIAyiIAQgBSAFoKKgIAugIQsgCyAWoCEEIAQgFqEhDCALIAyhIQsgCyANoCEMIAwgDaEhFiALIBahIQ8gDCAWoSELIA0gC6EhDSAEIAKgIQsgCyACoSEWIAQgFqEhBCALIBahIRYgAiAWoSECIAQgAqAgDKAhDCAMIAugIQQgBCALoSELIA8gDaAgDKAgC6EhDCAMIASgIQsgCyAEoSEEIAwgBKEhBCAHIASgIQwgDCAEoSECIAcgAqEhFiAMIAKhIQIgBCACoSENIAYgC6AhBCAEIAuhIQIgBiACoSEPIAQgAqEhAiALIAKhIQsgDyALoCAMoCEMIAwgBKAhCyALIAShIQQgFiANoCAMoCAEoSEEIAQgC6AhDCAAIAw5AwAgDCALoSELIAAgBCALoTkDCAuBBgIKfAF/IAArAwAiCkQAAAACAACgQaIhCyALIAqhIQwgCyAMoSELIAogC6EhDUQAAAACAACwQSEMIAxEAAAAAAAAAMCgIQ4gDCAOoSEMIAogCqAhCiALIAyiIAqhIQ4gDiANIAyioCEORAAAAAAAAABAIAyhIQwgDiALIAyioCELIA0gDKIgACsDCCIMIAygoCALoCEOIA4gCqAhCyALIAqhIQ8gC0QAAAACAACgQaIhCiAKIAuhIQwgCiAMoSEMIAsgDKEhECABKwMAIhFEAAAAAgAAoEGiIQogCiARoSENIAogDaEhDSARIA2hIRIgESALoiEKIA0gDKIgCqEhEyATIBIgDKKgIQwgDCANIBCioCEMIAErAwggC6IgESAOIA+hoqAgEiAQoqAgDKAhDCAMIAqgIQsgCyAKoSEKIAwgCqEiCpogCiALRAAAAAAAAAAAYyIUGyEKIAkgCqAhDCAMIAqhIQ0gCSANoSEJIAwgDaEhDSAKIA2hIQ4gC5ogCyAUGyEKIAggCqAhCyALIAqhIQ0gCCANoSEIIAsgDaEhDSAKIA2hIQogCCAKoCAMoCEMIAwgC6AhCiAKIAuhIQsgCSAOoCAMoCALoSELIAsgCqAhDCABIAw5AwAgDCAKoSEKIAEgCyAKoTkDCCAFmiELIAsgA6AhCiAKIAOhIQwgCiAMoSENIAMgDaEhDSALIAyhIQkgBJohAyADIAKgIQsgCyACoSEMIAsgDKEhCCACIAihIQIgAyAMoSEDIAMgAqAgCqAhAyADIAugIQogCiALoSELIAkgDaAgA6AgC6EhAyADIAqgIQsgCyAKoSEKIAMgCqEhCiAHIAqgIQMgAyAKoSECIAcgAqEhDCADIAKhIQIgCiACoSENIAYgC6AhCiAKIAuhIQIgBiACoSEJIAogAqEhAiALIAKhIQsgCSALoCADoCEDIAMgCqAhCyALIAqhIQogDCANoCADoCAKoSEKIAogC6AhAyAAIAM5AwAgAyALoSELIAAgCiALoTkDCAvDCQMKfAF/AnwgBEQAAAACAACgQaIhCiAKIAShIQsgCiALoSELIAQgC6EhDEQAAAADAAC4QSEKIApEAAAAAAAACMCgIQ0gCiANoSENIAREAAAAAAAACECiIQogCyANoiAKoSEOIA4gDCANoqAhD0QAAAAAAAAIQCANoSEOIA8gCyAOoqAhCyAMIA6iIAVEAAAAAAAACECioCALoCELIAsgCqAhDCAMIAqhIQogCiALoSEPIAMhCiAPIAqgIQsgCyAKoSEQIA8gEKEhESALIBChIQ8gCiAPoSESIAyaIQ8gAiEMIA8gDKAhCiAKIAyhIRAgDyAQoSEPIAogEKEhECAMIBChIQwgDyAMoCALoCEMIAwgCqAhCyALIAqhIQogESASoCAMoCAKoSEQIBAgC6AhCiAKIAuhIRMgCkQAAAACAACgQaIhCyALIAqhIQwgCyAMoSEMIAogDKEhESAAKwMAIguaIAsgC0QAAAAAAAAAAGMiFBsiEkQAAAACAACgQaIhCyALIBKhIQ8gCyAPoSEPIBIgD6EhFSAKIBKiIQsgDCAPoiALoSEWIBYgESAPoqAhDyAPIAwgFaKgIQwgECAToSASoiAKIAArAwgiD5ogDyAUG6KgIBEgFaKgIAygIQwgDCALoCEKIAogC6EhCyAMIAuhIQsgByALoCEMIAwgC6EhDyAHIA+hIQcgDCAPoSEPIAsgD6EhECAGIAqgIQsgCyAKoSEPIAYgD6EhBiALIA+hIQ8gCiAPoSEKIAYgCqAgDKAhDCAMIAugIQogCiALoSELIAcgEKAgDKAgC6EhCyALIAqgIQwgACAMOQMAIAwgCqEhCiAAIAsgCqE5AwggAkQAAAACAACgQaIhCiAKIAKhIQsgCiALoSEKIAIgCqEhDCACRAAAAAAAAAhAoiELIAogDaIgC6EhAiACIAwgDaKgIQ0gDSAKIA6ioCEKIAwgDqIgA0QAAAAAAAAIQKKgIAqgIQ0gDSALoCEKIAogC6EhCyANIAuhIQsgBZohDiAOIAugIQ0gDSALoSECIA4gAqEhDCANIAKhIQ4gCyAOoSECIASaIQ4gDiAKoCELIAsgCqEhBCAOIAShIQ4gCyAEoSEEIAogBKEhCiAOIAqgIA2gIQogCiALoCENIA0gC6EhCyAMIAKgIAqgIAuhIQQgBCANoCEKIAogDaEhByAKRAAAAAIAAKBBoiELIAsgCqEhDSALIA2hIQ0gCiANoSECIAErAwAiC5ogCyALRAAAAAAAAAAAYyIAGyIMRAAAAAIAAKBBoiELIAsgDKEhDiALIA6hIQ4gDCAOoSEPIAogDKIhCyANIA6iIAuhIQYgBiACIA6ioCEOIA4gDSAPoqAhDSAEIAehIAyiIAogASsDCCIOmiAOIAAboqAgAiAPoqAgDaAhDSANIAugIQogCiALoSELIA0gC6EhCyAJIAugIQ0gDSALoSEOIAkgDqEhBCANIA6hIQ4gCyAOoSECIAggCqAhCyALIAqhIQ4gCCAOoSEMIAsgDqEhDiAKIA6hIQogDCAKoCANoCENIA0gC6AhCiAKIAuhIQsgBCACoCANoCALoSELIAsgCqAhDSABIA05AwAgDSAKoSEKIAEgCyAKoTkDCAv7DAMLfAF/AXwgACsDACIKRAAAAAIAAKBBoiELIAsgCqEhDCALIAyhIQsgCiALoSENRAAAAAIAAMBBIQwgDEQAAAAAAAAQwKAhDiAMIA6hIQ4gCkQAAAAAAAAQQKIhDCALIA6iIAyhIQogCiANIA6ioCEKRAAAAAAAABBAIA6hIQ4gCiALIA6ioCELIA0gDqIgACsDCEQAAAAAAAAQQKKgIAugIQogCiAMoCELIAsgDKEhDyALRAAAAAIAAKBBoiEMIAwgC6EhDiAMIA6hIQ4gCyAOoSEQIAErAwAiEUQAAAACAACgQaIhDCAMIBGhIQ0gDCANoSENIBEgDaEhEiARIAuiIQwgDSAOoiAMoSETIBMgEiAOoqAhDiAOIA0gEKKgIQ4gASsDCCALoiARIAogD6GioCASIBCioCAOoCEQIBAgDKAhDSADIQsgBZohCiAKIAugIQ4gDiALoSERIA4gEaEhEiALIBKhIQ8gCiARoSETIAIhCiAEmiERIBEgCqAhCyALIAqhIRIgCyASoSEUIAogFKEhCiARIBKhIREgESAKoCAOoCEKIAogC6AhDiAOIAuhIQsgEyAPoCAKoCALoSEKIAogDqAhCyALIA6hIRMgDSAMoSEUIA2aIA0gDUQAAAAAAAAAAGMiFRsiEUQAAAACAACgQaIhDCAMIBGhIQ4gDCAOoSEOIBEgDqEhEiALRAAAAAIAAKBBoiEMIAwgC6EhDSAMIA2hIQ0gCyANoSEPIAsgEaIhDCANIA6iIAyhIRYgFiAPIA6ioCEOIA4gDSASoqAhDiAKIBOhIBGiIAsgECAUoSINmiANIBUboqAgDyASoqAgDqAhDiAOIAygIQsgCyAMoSEMIA4gDKEhDCAJIAygIQ4gDiAMoSENIAkgDaEhCiAOIA2hIQ0gDCANoSEJIAggC6AhDCAMIAuhIQ0gCCANoSEIIAwgDaEhDSALIA2hIQsgCCALoCAOoCEOIA4gDKAhCyALIAyhIQwgCiAJoCAOoCAMoSEMIAwgC6AhDiABIA45AwAgDiALoSELIAEgDCALoTkDCCACRAAAAAIAAKBBoiELIAsgAqEhDCALIAyhIQsgAiALoSENRAAAAAMAAMhBIQwgDEQAAAAAAAAYwKAhDiAMIA6hIQwgAkQAAAAAAAAYQKIhDiAMIAuiIA6hIQogCiAMIA2ioCEKRAAAAAAAABhAIAyhIQwgCiAMIAuioCEKIAwgDaIgA0QAAAAAAAAYQKKgIAqgIRAgECAOoCEMIAwgDqEhEiAMRAAAAAIAAKBBoiEOIA4gDKEhCiAOIAqhIQggDCAIoSERIAREAAAAAgAAoEGiIQ4gDiAEoSEKIA4gCqEhDiAEIA6hIQogBCAMoiEJIA4gCKIgCaEhDyAPIAogCKKgIQggCCAOIBGioCEIIAUgDKIgBCAQIBKhoqAgCiARoqAgCKAhDCAMIAmgIQggCCAJoSEJIAkgDKEhCSACIAKiIQwgCyALoiAMoSEQIBAgDSALoiIRoCELIAsgEaAhCyANIA2iIAIgAyADoKKgIAugIQsgCyAMoCECIAIgDKEhDCALIAyhIQsgCSALoCEMIAwgC6EhDSAJIA2hIQMgDCANoSENIAsgDaEhECAImiENIA0gAqAhCyALIAKhIQkgDSAJoSENIAsgCaEhCSACIAmhIQIgDSACoCAMoCECIAIgC6AhDCAMIAuhIQsgAyAQoCACoCALoSELIAsgDKAhAiACIAyhIQwgCyAMoSENIAQgBKIhCyAOIA6iIAuhIQwgDCAKIA6iIg6gIQwgDCAOoCEMIAogCqIgBCAFIAWgoqAgDKAhBCAEIAugIQwgDCALoSELIAQgC6EhBCAEIA2gIQsgCyANoSEOIAQgDqEhCiALIA6hIQQgDSAEoSENIAwgAqAhBCAEIAKhIQ4gDCAOoSEMIAQgDqEhDiACIA6hIQIgDCACoCALoCELIAsgBKAhAiACIAShIQQgCiANoCALoCAEoSELIAsgAqAhBCAEIAKhIQIgCyACoSECIAcgAqAhCyALIAKhIQwgByAMoSEOIAsgDKEhDCACIAyhIQ0gBiAEoCECIAIgBKEhDCAGIAyhIQogAiAMoSEMIAQgDKEhBCAKIASgIAugIQsgCyACoCEEIAQgAqEhAiAOIA2gIAugIAKhIQIgAiAEoCELIAAgCzkDACALIAShIQQgACACIAShOQMICwt+AQAjAQt4AAAAAAAAAAAAAAAAAAAAAAAAAAAAAOA/HDOQRad54j+Lco35oijkP2yBbBFSZuU/o9GVsMpc5j+TpPfk+iLnPwMAAAADAAAAAwAAAAMAAAADAAAAAwAAAAMAAAADAAAAAgAAAAIAAAADAAAAAgAAAAIAAAADAAAA";
 var w,
   h,
   colorDataStart,
@@ -412,7 +427,11 @@ var w,
   dataBits,
   paletteData,
   colorArray,
-  pixelItem;
+  pixelItem,
+  seriesItem,
+  rangeItem,
+  accumulateItem,
+  paletteVersionItem;
 
 // Notes for the welcome popup
 if (isSafari) {
@@ -454,6 +473,8 @@ function FakeWorker() {
   this.handleRender = null;
   this._mainThreadOnMessage = null;
   this._isSetup = false;
+  this.memoryBase = 0;
+  this.stackPointer = 0;
   this.wasmFileName = unsharedWASMData;
 }
 
@@ -478,6 +499,8 @@ FakeWorker.prototype.postMessage = function (data) {
 
   if (data.mem != null) {
     this.memory = data.mem; // Expects a WebAssembly.Memory object
+    this.memoryBase = data.memoryBase;
+    this.stackPointer = data.stackPointer;
 
     if (!this._isSetup) {
       this.setupWorker();
@@ -523,6 +546,12 @@ FakeWorker.prototype.setupWorker = function () {
     // Use the provided WASM file name
     env: {
       memory: this.memory,
+      __memory_base: this.memoryBase,
+      __table_base: 0,
+      __stack_pointer: new WebAssembly.Global(
+        { value: "i32", mutable: true },
+        this.stackPointer,
+      ),
     },
   })
     .then((result) => {
@@ -562,13 +591,6 @@ FakeWorker.prototype.grow = function (pages) {
   }
 };
 
-function messageWebWorkersObject(message) {
-  for (var i = 0; i < webWorkers.length; i++) {
-    message.id = i;
-    webWorkers[i].postMessage(message);
-  }
-}
-
 function messageWebWorker(i, message) {
   webWorkers[i].postMessage(message);
 }
@@ -734,12 +756,19 @@ var resizeW, resizeH;
 var imageData, imageDataBuffer;
 
 // To ensure that the site works properly, make sure this value is a multiple of 8 if you want to change it.
-const paletteStart = 65536 + 32; // Atomic counter, limb counter, job ID, palette data, then a blank for SIMD alignment
+const shadingStart = 32; // The shading table (see writeShadingLUT()) comes right after the header
+const paletteStart = shadingStart + 65536; // Atomic counter, limb counter, job ID, palette data, then a blank for SIMD alignment
 const paletteBytes = 100000;
 const decimalStart = paletteBytes + paletteStart; // Used for Decimal values
-const dataStart = decimalStart + 4096;
+const tileCostStart = decimalStart + 4096; // Block scores for ?tiles
+const workerRangeStart = tileCostStart + 1048576; // Block ranges for ?stealing
+const paletteLUTStart = workerRangeStart + 2048; // The palette version (see writePalette()), then the lookup table fractal.cpp builds from the palette
+const staticDataStart = paletteLUTStart + 32 + 2097152; // Constants the compiler put in memory, passed to the module as __memory_base
+const stackStart = staticDataStart + 4096; // The stack of each worker's instance of the module, passed as __stack_pointer (see Mem::WorkerStacks in fractal.h)
+const stackBytes = 32768;
+const dataStart = stackStart + maxWorkers * stackBytes;
 const defaultCost = 200000;
-var wasmLength = pixels * 12 + dataStart;
+var wasmLength = pixels * 16 + dataStart;
 var webWorkers = [];
 var workersDone = 0;
 var calculationDiff = 1;
@@ -795,8 +824,7 @@ function setupWebWorkers(amount) {
         if (++workersDone === workerCount) {
           workersDone = 0;
           resizeHandler();
-          panX = (-w * 0.5 - 0.5) * zoom - 0.74999;
-          panY = (-h * 0.5 - 0.5) * zoom + 1e-5;
+          setPan((-w * 0.5 - 0.5) * zoom - 0.74999, (-h * 0.5 - 0.5) * zoom + 1e-5);
           update();
           setTimeout(() => {
             welcome.style.opacity = 1;
@@ -902,7 +930,16 @@ function setupWebWorkers(amount) {
 // })
 
 setupWebWorkers(workerCount);
-messageWebWorkersObject({ mem: memory });
+writeShadingLUT(memory, shadingStart);
+for (let i = 0; i < workerCount; i++) {
+  // Stacks grow down, so a worker starts at the end of its own.
+  messageWebWorker(i, {
+    id: i,
+    mem: memory,
+    memoryBase: staticDataStart,
+    stackPointer: stackStart + (i + 1) * stackBytes,
+  });
+}
 
 // Firefox is weird about resizing
 // justSwitched = false
@@ -952,6 +989,10 @@ document.addEventListener("keydown", function (e) {
           switchCategory();
         } else if (code === 90) {
           switchAliasMode();
+        } else if (code === 187 || code === 61) {
+          zoomKey(0.5);
+        } else if (code === 189 || code === 173) {
+          zoomKey(2);
         }
       } else if (code === 67) {
         changeFractal(fractalType === 1 ? 16 : fractalType - 1);
@@ -966,6 +1007,16 @@ document.addEventListener("keydown", function (e) {
   }
 });
 
+// Zooms by a factor of 2 around the cursor (or the middle of the screen), which keeps some of the data.
+function zoomKey(factor) {
+  var inside = currentX >= 0 && currentY >= 0 && currentX < w && currentY < h;
+  updateZoom(
+    factor,
+    inside ? currentX : Math.floor(w * 0.5),
+    inside ? currentY : Math.floor(h * 0.5),
+  );
+}
+
 function toggleBreakdown() {
   pixelBreakdown = !pixelBreakdown;
   colorButton(12, pixelBreakdown);
@@ -995,18 +1046,43 @@ function resizeHandler() {
       Math.ceil(innerHeight) + "px";
 
   colorDataStart = pixels * 8 + dataStart;
-  wasmLength = pixels * 4 + colorDataStart;
+  wasmLength = pixels * 8 + colorDataStart; // The colors, then the palette positions render() saves
+  referenceStart = Math.ceil(wasmLength / 8) * 8;
+  referenceStale = true;
   expandMemory(wasmLength);
+  createMemoryViews();
+  writePalette();
+}
+
+// The workers rebuild their palette lookup table (Mem::PaletteLUT) when the version changes, so it has to change whenever the palette does.
+function writePalette() {
+  paletteData.set(palette);
+  paletteVersionItem[0]++; // Mem::PaletteVersion
+  positionSpeed = -1; // Palettes too long for the lookup table don't save positions
+}
 
+function createMemoryViews() {
   pixelItem = getMemory(1, 0, 32);
+  seriesItem = getMemory(1, 16, 32);
+  rangeItem = getMemory(1, 24, 32);
+  accumulateItem = getMemory(1, 28, 32);
+  paletteVersionItem = getMemory(1, paletteLUTStart, 32);
   paletteData = getMemory(paletteBytes * 0.25, paletteStart, 32);
-  paletteData.set(palette);
   dataArray = getMemory(pixels * 2, dataStart, -32);
   colorBytes = getMemory(pixels * 4, colorDataStart, -8); // In the WebAssembly script, it actually is 32-bit, but for getting this to render to the canvas, we pretend it's 8-bit and it works out.
   colorArray = getMemory(pixels, colorDataStart, 32);
   dataBits = getMemory((wasmLength - dataStart) * 0.25, dataStart, 32);
 }
 
+// Grows the memory if needed, remaking the views if the old buffer was replaced.
+function ensureMemory(finalByte) {
+  var oldBuffer = buffer;
+  expandMemory(finalByte);
+  if (buffer !== oldBuffer) {
+    createMemoryViews();
+  }
+}
+
 function expandMemory(finalByte) {
   try {
     var byteLength = buffer.byteLength;
@@ -1025,6 +1101,157 @@ function expandMemory(finalByte) {
 var zoom = 0.004;
 var iterations = 1000;
 
+// Deep zoom support: the position is also tracked as a fixed-point BigInt with as many fractional bits as a Decimal in decimal.cpp, which run() uses for perturbation past perturbationZoom.
+const perturbationZoom = Math.pow(2, -48); // Same as PERTURBATION_ZOOM in fractal.h
+const decimalLimbs = 30;
+const decimalBits = BigInt(decimalLimbs * 64);
+const decimalBytes = 256;
+var bigPanX = 0n;
+var bigPanY = 0n;
+var referenceStart = 0;
+var referenceStale = true;
+var referenceX = 0n;
+var referenceY = 0n;
+var referenceZoom = 0;
+
+// Same as Mem::blaStart and Mem::accumulationStart in fractal.h: the reference orbit (iterations + 2 points) is followed by room for the whole BLA table (about 2 entries per iteration), then the RUN_ACCUMULATE sums.
+const referencePointBytes = 16;
+const blaBytes = 40; // sizeof(BLA) in fractal.cpp
+function blaStart() {
+  return referenceStart + (iterations + 2) * referencePointBytes;
+}
+
+function accumulationStart() {
+  return blaStart() + (iterations + 1) * 2 * blaBytes;
+}
+
+// Same as limbsNeeded in fractal.h: the Decimal limbs the reference orbit is calculated with at this zoom.
+function limbsNeeded(zoom) {
+  var limbs = 2;
+  for (
+    var scale = 1;
+    zoom < scale && limbs < decimalLimbs;
+    scale *= Math.pow(2, -64)
+  ) {
+    limbs++;
+  }
+  return limbs;
+}
+
+// Converts a double to a fixed-point BigInt without losing any bits.
+function toBig(value) {
+  if (value === 0 || !isFinite(value)) {
+    return 0n;
+  }
+  var view = new DataView(new ArrayBuffer(8));
+  view.setFloat64(0, value);
+  var high = view.getUint32(0);
+  var exponent = (high >>> 20) & 0x7ff;
+  var mantissa = (BigInt(high & 0xfffff) << 32n) | BigInt(view.getUint32(4));
+  if (exponent === 0) {
+    exponent = 1; // Subnormal number
+  } else {
+    mantissa |= 1n << 52n;
+  }
+  var shift = BigInt(exponent - 1075) + decimalBits;
+  var result = shift >= 0n ? mantissa << shift : mantissa >> -shift;
+  return value < 0 ? -result : result;
+}
+
+// Converts a fixed-point BigInt to the nearest double.
+function fromBig(value) {
+  var negative = value < 0n;
+  if (negative) {
+    value = -value;
+  }
+  var shift = Math.max(0, value.toString(16).length * 4 - 64);
+  // Split the power of two so it can't overflow or underflow on its own.
+  var result =
+    Number(value >> BigInt(shift)) *
+    Math.pow(2, shift - 960) *
+    Math.pow(2, 960 - Number(decimalBits));
+  return negative ? -result : result;
+}
+
+// Prints a fixed-point BigInt with the given amount of decimal places.
+function bigToString(value, digits) {
+  var sign = value < 0n ? "-" : "";
+  if (value < 0n) {
+    value = -value;
+  }
+  var scaled =
+    (value * 10n ** BigInt(digits) + (1n << (decimalBits - 1n))) >>
+    decimalBits;
+  var str = scaled.toString().padStart(digits + 1, "0");
+  return sign + str.slice(0, -digits) + "." + str.slice(-digits);
+}
+
+// Parses a decimal string (like "-0.75" or "1.5e-20") into a fixed-point BigInt, or returns null if it isn't a finite number.
+function bigFromString(str) {
+  var match = str.match(/^(-?)(\d*)\.?(\d*)(?:[eE]([+-]?\d+))?$/);
+  if (!match || !(match[2] || match[3]) || !isFinite(parseFloat(str))) {
+    return null;
+  }
+  var result = BigInt(match[2] + match[3] || "0") << decimalBits;
+  var exponent = (match[4] ? +match[4] : 0) - match[3].length;
+  result =
+    exponent >= 0
+      ? result * 10n ** BigInt(exponent)
+      : result / 10n ** BigInt(-exponent);
+  return match[1] ? -result : result;
+}
+
+function setPan(x, y) {
+  bigPanX = typeof x === "bigint" ? x : toBig(x);
+  bigPanY = typeof y === "bigint" ? y : toBig(y);
+  panX = fromBig(bigPanX);
+  panY = fromBig(bigPanY);
+}
+
+function movePan(dx, dy) {
+  setPan(bigPanX + toBig(dx), bigPanY + toBig(dy));
+}
+
+// Writes a fixed-point BigInt into a Decimal slot (sign, integer, then fractional limbs).
+function writeDecimal(slot, value) {
+  var limbs = getMemory(2 + decimalLimbs, decimalStart + slot * decimalBytes, 64);
+  limbs[0] = value < 0n ? 1n : 0n;
+  if (value < 0n) {
+    value = -value;
+  }
+  for (var i = decimalLimbs + 1; i > 0; i--) {
+    limbs[i] = BigInt.asUintN(64, value);
+    value >>= 64n;
+  }
+}
+
+// Sends the precise position to run() for perturbation. The reference orbit (at the center) and its BLA table are only recalculated when something other than the pan changes, or once the screen moves far enough from the reference that the BLA table (built for offsets of up to one screen diagonal) would stop being valid.
+function prepareReference() {
+  ensureMemory(accumulationStart()); // Reference orbit, then the BLA table
+  var centerX = bigPanX + toBig(w * 0.5 * zoom);
+  var centerY = bigPanY + toBig(h * 0.5 * zoom);
+  var diagonal = zoom * Math.sqrt(w * w + h * h);
+  if (
+    zoom > referenceZoom ||
+    limbsNeeded(zoom) > limbsNeeded(referenceZoom) ||
+    Math.hypot(fromBig(centerX - referenceX), fromBig(centerY - referenceY)) >
+      diagonal * 0.5
+  ) {
+    referenceStale = true;
+  }
+  if (referenceStale) {
+    writeDecimal(0, centerX);
+    writeDecimal(1, centerY);
+    referenceX = centerX;
+    referenceY = centerY;
+    referenceZoom = zoom;
+    getMemory(1, 4, 32)[0] = 0; // Mem::ReferenceState, marked as stale
+    referenceStale = false;
+  }
+  writeDecimal(2, bigPanX);
+  writeDecimal(3, bigPanY);
+}
+
 function getMemory(size, offset, type) {
   if (type === -8) {
     return new Uint8ClampedArray(buffer, offset, size);
@@ -1178,6 +1405,43 @@ var frames = 0;
 var originalPixel = 0;
 var diffX = 0;
 var diffY = 0;
+// Whether the runAntialias pass has been started for the current screen
+var antialiased = false;
+// runAccumulate passes started for the current screen
+var accumulated = 0;
+// The speed render() last saved the palette positions of the pixels with, so flowing the colors doesn't need to work them out again; -1 once the iterations or palette have changed since.
+var positionSpeed = -1;
+// A zoom by a whole number factor (the old zoom over the new one, or its inverse) around (reprojectX, reprojectY) that update() still has to move the data for; 0 if there isn't one.
+var reprojectRatio = 0;
+var reprojectX = 0;
+var reprojectY = 0;
+
+// Moves the data to where it is after zooming by a whole number factor around the pixel (x, y), which stays where it is. Zooming in by n keeps one in every n x n pixels; zooming out keeps the middle 1/n of the screen, and everything else is left at 0 for the workers to calculate.
+function reprojectData(ratio, x, y) {
+  var newData = new Float32Array(pixels * 2);
+  // New pixels per old pixel, and the other way around
+  var step = ratio > 1 ? Math.round(ratio) : 1;
+  var scale = ratio > 1 ? 1 : Math.round(1 / ratio);
+  var startX = ((x % step) + step) % step;
+  var startY = ((y % step) + step) % step;
+  for (var j = startY; j < h; j += step) {
+    var oldY = y + ((j - y) / step) * scale;
+    if (oldY < 0 || oldY >= h) {
+      continue;
+    }
+    for (var i = startX; i < w; i += step) {
+      var oldX = x + ((i - x) / step) * scale;
+      if (oldX >= 0 && oldX < w) {
+        var oldPixel = oldY * w + oldX;
+        newData[j * w + i] = dataArray[oldPixel];
+        if (shadingEffect !== 0) {
+          newData[pixels + j * w + i] = dataArray[pixels + oldPixel];
+        }
+      }
+    }
+  }
+  dataArray.set(newData);
+}
 
 function update() {
   if (needResize) {
@@ -1234,13 +1498,20 @@ function update() {
     percent.textContent = "";
     hideTime = -1;
   }
+  // Zooms come before any panning since then (see updateZoom()).
+  if (reprojectRatio !== 0) {
+    reprojectData(reprojectRatio, reprojectX, reprojectY);
+    reprojectRatio = 0;
+    unfinished = true;
+    rerender = true;
+  }
+
   // Handle the panning by shifting pixels
   if (diffX !== 0 || diffY !== 0) {
     zoomX -= diffX * zoomM;
     zoomY -= diffY * zoomM;
     doZoom = true;
-    panX -= diffX * zoom;
-    panY -= diffY * zoom;
+    movePan(-diffX * zoom, -diffY * zoom);
 
     // A fresh buffer to hold the shifted data
     var newData = new Float32Array(pixels * 2);
@@ -1311,7 +1582,10 @@ function update() {
   }
 
   if (unfinished || rehandle) {
-    hideTime = Infinity;
+    if (accumulated === 0) {
+      hideTime = Infinity;
+    }
+    positionSpeed = -1;
     originalPixel = pixel;
     if (rehandle) {
       // Simple trick for clearing everything; since there is no data, the WASM will recalculate everything.
@@ -1319,12 +1593,18 @@ function update() {
       setPixel(0);
       rehandle = false;
       rerender = false;
+      referenceStale = true;
     } else if (rerender) {
       // Instead of instantly resetting the pixel, it's important to let all the workers finish their tasks to prevent desyncs.
       setPixel(0);
       colorArray.fill(0);
       rerender = false;
     }
+    if (zoom < perturbationZoom) {
+      prepareReference();
+    } else if (runFlags & runSeries) {
+      ensureMemory(referenceStart + 128); // The Series struct in fractal.cpp
+    }
     for (var t = 0; t < workerCount; t++) {
       messageWebWorker(t, [
         1,
@@ -1344,8 +1624,37 @@ function update() {
         flowAmount,
         juliaX,
         juliaY,
+        accumulated !== 0
+          ? runFlags | runAccumulate
+          : antialiased
+            ? runFlags | runAntialias
+            : runFlags,
+        t,
+        workerCount,
       ]); // Message the parameters to be passed into each worker.
     }
+  } else if (antialias && !antialiased && flowRate === 0 && !needRender) {
+    // The screen is done, so go over it once more to add samples to its edges. (Not with setPixel(0), which would also throw away the series approximation.)
+    antialiased = true;
+    pixel = pixelItem[0] = 0;
+    unfinished = true;
+    requestAnimationFrame(update);
+  } else if (
+    accumulate &&
+    accumulated < accumulateLimit &&
+    flowRate === 0 &&
+    !needRender
+  ) {
+    // The view is still, so add another sample to every pixel. The sums (4 per pixel, like Mem::accumulationStart in fractal.h) start over with the screen, since setPixel(0) resets accumulated.
+    if (accumulated === 0) {
+      ensureMemory(accumulationStart() + pixels * 16);
+      getMemory(pixels * 4, accumulationStart(), 32).fill(0);
+    }
+    accumulateItem[0] = accumulated; // Mem::AccumulatePasses
+    accumulated++;
+    pixel = pixelItem[0] = 0;
+    unfinished = true;
+    requestAnimationFrame(update);
   } else {
     line.removeAttribute("style");
     if (flowRate !== 0) {
@@ -1369,7 +1678,9 @@ function update() {
         shadingEffect,
         speed,
         flowAmount,
+        positionSpeed === speed ? 1 : 0,
       ];
+      positionSpeed = speed;
       for (let i = 0; i < workerCount; i++) {
         messageWebWorker(i, renderCommand);
       }
@@ -1412,7 +1723,10 @@ function completeRender(animatedMode) {
       updateOutputImage();
     }
     var mainDiff = Math.max(time - mainTime, 1);
-    if (unfinished) {
+    if (accumulated !== 0) {
+      // The screen was already done, so the accumulation passes don't show their progress.
+      line.removeAttribute("style");
+    } else if (unfinished) {
       // 30 FPS is the goal by default, but this can be changed by the user.
       fps = 0.9 * fps + 100 / calculationDiff;
       var ratio = pixel / pixels;
@@ -1592,6 +1906,12 @@ function redo() {
 
 function setPixel(num) {
   pixel = pixelItem[0] = num;
+  if (num === 0) {
+    seriesItem[0] = 0; // Mem::SeriesState, since the screen changed
+    rangeItem[0] = 0; // Mem::RangeState
+    antialiased = false;
+    accumulated = 0;
+  }
 }
 
 function updateOutputImage() {
@@ -1651,11 +1971,9 @@ function updateZoom(factor, x, y) {
   if (factor === 1) {
     return;
   }
-  var pointX = panX + x * zoom;
-  var pointY = panY + y * zoom;
+  var oldZoom = zoom;
   zoom *= factor;
-  panX = pointX - x * zoom;
-  panY = pointY - y * zoom;
+  movePan(x * (oldZoom - zoom), y * (oldZoom - zoom));
   if (!isSafari) {
     var newTime = Date.now();
     if (zx !== x || zy !== y || newTime - zoomTime > 1000) {
@@ -1673,7 +1991,26 @@ function updateZoom(factor, x, y) {
   zoomX = x * (1 - zoomM);
   zoomY = y * (1 - zoomM);
   doZoom = true;
-  redo();
+  // Whole number factors around a pixel keep some of the data; anything else (or more than one zoom before the next update) starts over.
+  var ratio = oldZoom / zoom;
+  var whole = ratio > 1 ? ratio : 1 / ratio;
+  if (
+    !rehandle &&
+    reprojectRatio === 0 &&
+    diffX === 0 &&
+    diffY === 0 &&
+    Math.abs(whole - Math.round(whole)) < 1e-9 &&
+    Number.isInteger(x) &&
+    Number.isInteger(y)
+  ) {
+    reprojectRatio = ratio;
+    reprojectX = x;
+    reprojectY = y;
+    mainTime = performance.now();
+  } else {
+    reprojectRatio = 0;
+    redo();
+  }
 }
 
 function clearBack() {
@@ -1704,7 +2041,7 @@ function closeMenu() {
 function resetLocation() {
   flowAmount = 0;
   zoom = 0.004;
-  panX =
+  var x =
     (-w * 0.5 - 0.5) * zoom +
     1e-5 -
     (fractalType === 1 || fractalType === 10 || fractalType === 14
@@ -1717,10 +2054,11 @@ function resetLocation() {
         : fractalType === 8
           ? 0.2
           : 0);
-  panY =
+  var y =
     (-h * 0.5 - 0.5) * zoom +
     1e-5 +
     (fractalType === 7 ? -0.4 : fractalType === 8 ? 0.25 : 0);
+  setPan(x, y);
   clearBack();
 }
 
@@ -1761,7 +2099,7 @@ function switchPalette() {
   palette = palettes[paletteID];
   interior = interiors[paletteID];
   paletteLen = palette.length - 1;
-  paletteData.set(palette);
+  writePalette();
   requestRender();
 }
 
@@ -1774,7 +2112,7 @@ function customizePalette() {
     paletteLen = palette.length - 1;
     interior = palette.pop() ^ 0xff000000;
     palette.push(palette[0]);
-    paletteData.set(palette);
+    writePalette();
     clearBack();
     retry();
   }
@@ -2080,12 +2418,20 @@ function setIterations(amount) {
 
 function saveLocation() {
   var str;
+  // Deep zooms need more digits than a double can give.
+  var locationX = panX;
+  var locationY = panY;
+  if (zoom < perturbationZoom) {
+    var digits = Math.ceil(-Math.log10(zoom)) + 6;
+    locationX = bigToString(bigPanX, digits);
+    locationY = bigToString(bigPanY, digits);
+  }
   if (juliaMode) {
     str =
       "X: " +
-      panX +
+      locationX +
       " Y: " +
-      panY +
+      locationY +
       " Zoom: " +
       zoom * w +
       " Type: " +
@@ -2099,9 +2445,9 @@ function saveLocation() {
   } else {
     str =
       "X: " +
-      panX +
+      locationX +
       " Y: " +
-      panY +
+      locationY +
       " Zoom: " +
       zoom * w +
       " Type: " +
@@ -2126,8 +2472,8 @@ function importLocation() {
 
   // Extract values from the named groups.
   var groups = match.groups;
-  var a = parseFloat(groups.panX);
-  var b = parseFloat(groups.panY);
+  var a = bigFromString(groups.panX);
+  var b = bigFromString(groups.panY);
   var c = parseFloat(groups.zoom);
   var fName = groups.fractalName;
   var sName = groups.shadingName;
@@ -2146,8 +2492,8 @@ function importLocation() {
 
   // Do a quick validation on the parsed values
   if (
-    isFinite(a) &&
-    isFinite(b) &&
+    a !== null &&
+    b !== null &&
     isFinite(c) &&
     c > 0 &&
     d !== -1 &&
@@ -2156,15 +2502,14 @@ function importLocation() {
   ) {
     // Check if an update is actually needed before triggering a full redo.
     if (
-      panX !== a ||
-      panY !== b ||
+      bigPanX !== a ||
+      bigPanY !== b ||
       zoom * w !== c ||
       fractalType !== d ||
       shadingEffect !== e ||
       (isJulia && (juliaX !== f || juliaY !== g))
     ) {
-      panX = a;
-      panY = b;
+      setPan(a, b);
       zoom = c / w;
       fractalType = d;
       shadingEffect = e;
@@ -0,0 +1,955 @@
+/*
+A native (non-browser) driver for fractal.cpp and decimal.cpp, for rendering
+images to disk and benchmarking the kernels without a browser. It does what
+main.js and the workers do: it sets up the memory regions, starts one thread
+per worker that calls run() until it returns -1 (the same atomic counter
+protocol), then does the same with render().
+
+Images are rendered in horizontal bands, each one its own run() with its own
+reference orbit, so the memory used only depends on the width and the band
+height and not on the height of the image.
+
+Build it with the "Build Native Renderer (Linux)" task in tasks.json, which
+compiles all three files with -DNATIVE (see MEMORY_BASE in fractal.cpp). The
+memory layout and the run() flags are shared with fractal.cpp through
+fractal.h.
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <climits>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "fractal.h"
+
+extern "C" {
+// Where the memory regions of fractal.cpp start (0 in WASM).
+uintptr_t memoryBase;
+
+int run(int type, int w, int h, double posX, double posY, double zoom, int max,
+        int iterations, int paletteLen, uint32_t interiorColor, int renderMode,
+        int darkenEffect, float speed, float flowAmount, double data1,
+        double data2, int flags, int worker, int workers);
+void render(int pixels, int paletteLen, uint32_t interiorColor, int renderMode,
+            int darkenEffect, float speed, float flowAmount, int cached);
+void add(const uint64_t *value1, const uint64_t *value2, uint64_t *output);
+void subtract(const uint64_t *value1, const uint64_t *value2,
+              uint64_t *output);
+double toDouble(const uint64_t *value);
+void fromDouble(double value, uint64_t *output);
+}
+
+// The most colors PaletteData has room for (same as in main.js)
+constexpr int MAX_PALETTE = 24999;
+// Default memory for the per-pixel data of a band
+constexpr int64_t BAND_BYTES = 256 << 20;
+
+// The last palette in main.js
+static const uint32_t defaultPalette[] = {
+    0xc8c8ff, 0x4cdbff, 0x0692d7, 0x122c91, 0x371663, 0x600d39,
+    0x8a030f, 0xbf2600, 0xfb6200, 0xffc9a6, 0x000000};
+
+// FORMAT_STREAM is RGB bytes without a header (for -o -, like ffmpeg's
+// rawvideo with rgb24)
+enum Format { FORMAT_PPM, FORMAT_PNG, FORMAT_RAW, FORMAT_STREAM };
+
+struct Options {
+  int type = 1;
+  int w = 1920;
+  int h = 1080;
+  const char *x = "-0.5";
+  const char *y = "0";
+  double width = 3.0; // Of the view, in the complex plane
+  int iterations = 1000;
+  std::vector<uint32_t> palette;
+  uint32_t interior = 0xff000000;
+  int renderMode = 0;
+  int shading = 0;
+  float speed = 1.0f;
+  float flow = 0.0f;
+  double juliaX = 0.0;
+  double juliaY = 0.0;
+  int flags = 0;
+  bool antialias = false;
+  int accumulate = 0; // RUN_ACCUMULATE passes
+  int cycle = 0;      // Extra render() calls with the colors flowing
+  int threads = 0; // 0 for all of them
+  int band = 0;    // Rows per band, 0 for BAND_BYTES worth
+  int tile = 0;    // Size of square tiles, 0 for bands
+  int repeat = 1;
+  const char *output = nullptr;
+  Format format = FORMAT_PPM;
+  // The end of a zoom video, which starts at x, y and width
+  const char *toX = nullptr;
+  const char *toY = nullptr;
+  double toWidth = 0.0;
+  double factor = 2.0; // Zoom between frames
+};
+
+static void usage() {
+  fprintf(stderr,
+          "Usage: fractal-native [options]\n"
+          "  -type N          fractal type (negative for its Julia set, "
+          "default 1)\n"
+          "  -size WxH        image size (default 1920x1080)\n"
+          "  -center X Y      center of the view, exact to any number of "
+          "digits\n"
+          "                   (default -0.5 0)\n"
+          "  -width W         width of the view (default 3)\n"
+          "  -julia X Y       Julia set constant\n"
+          "  -iterations N    maximum iterations (default 1000)\n"
+          "  -palette C,C,... palette as hex colors, written like the ones in "
+          "main.js\n"
+          "  -interior C      interior color, like interiors in main.js "
+          "(default ff000000)\n"
+          "  -mode N          render mode (default 0)\n"
+          "  -shading N       shading effect (0-3, default 0)\n"
+          "  -speed S         color speed (default 1)\n"
+          "  -flow F          palette flow offset (default 0)\n"
+          "  -flags N         RUN_ flags from fractal.h (default 0)\n"
+          "  -antialias       add samples to the pixels that stand out from "
+          "a neighbor\n"
+          "  -accumulate N    add N more samples to every pixel, each pass "
+          "shifted by a\n"
+          "                   different fraction of a pixel\n"
+          "  -cycle N         time N more colorings with the palette flowing\n"
+          "  -threads N       worker threads (default: all cores)\n"
+          "  -band N          rows rendered at once (default: 256MB worth)\n"
+          "  -tile N          render NxN tiles instead of bands of rows, for "
+          "images of\n"
+          "                   any size in the same memory\n"
+          "  -repeat N        render N times and report each time\n"
+          "  -o FILE          write the image (.ppm, .png or .raw), or RGB "
+          "bytes to\n"
+          "                   stdout with -o -\n"
+          "  -format F        ppm, png or raw (iterations, then shading, as "
+          "floats)\n"
+          "Zoom videos:\n"
+          "  -to X Y W        render frames from the center and width above "
+          "to these\n"
+          "  -factor F        zoom between frames (default 2); whole numbers "
+          "reuse a\n"
+          "                   pixel out of every FxF from the frame before\n"
+          "  -o FILE          with a printf pattern like frame%%05d.png, or -o "
+          "- for\n"
+          "                   one RGB stream\n");
+}
+
+// Parses a decimal number (optionally with an exponent, like toBig in
+// main.js) into a Decimal, exact down to the last fractional limb.
+static bool parseDecimal(const char *text, uint64_t *out) {
+  const char *p = text;
+  const bool negative = *p == '-';
+  if (*p == '-' || *p == '+') {
+    p++;
+  }
+  std::string digits;
+  long exponent = 0;
+  bool point = false;
+  for (; *p != '\0' && *p != 'e' && *p != 'E'; p++) {
+    if (*p == '.' && !point) {
+      point = true;
+    } else if (*p >= '0' && *p <= '9') {
+      digits += *p;
+      exponent -= point;
+    } else {
+      return false;
+    }
+  }
+  if (*p != '\0') {
+    char *end;
+    exponent += strtol(p + 1, &end, 10);
+    if (*end != '\0') {
+      return false;
+    }
+  }
+  if (digits.empty() || exponent > 100 || exponent < -100000) {
+    return false;
+  }
+
+  std::string integer;
+  std::string fraction;
+  const long length = (long)digits.size();
+  if (exponent >= 0) {
+    integer = digits + std::string(exponent, '0');
+  } else if (-exponent >= length) {
+    fraction = std::string(-exponent - length, '0') + digits;
+  } else {
+    integer = digits.substr(0, length + exponent);
+    fraction = digits.substr(length + exponent);
+  }
+  uint64_t whole = 0;
+  for (char c : integer) {
+    if (whole > (UINT64_MAX - 9) / 10) {
+      return false;
+    }
+    whole = whole * 10 + (c - '0');
+  }
+
+  // The fraction in base 10^9, most significant first. Multiplying it by 2^64
+  // moves the next limb out the top.
+  fraction.resize((fraction.size() + 8) / 9 * 9, '0');
+  std::vector<uint32_t> chunks;
+  for (size_t k = 0; k < fraction.size(); k += 9) {
+    chunks.push_back((uint32_t)std::stoul(fraction.substr(k, 9)));
+  }
+  out[0] = negative ? 1 : 0;
+  out[1] = whole;
+  for (int limb = 2; limb < DECIMAL_LIMBS; limb++) {
+    unsigned __int128 carry = 0;
+    for (size_t k = chunks.size(); k-- > 0;) {
+      const unsigned __int128 value = ((unsigned __int128)chunks[k] << 64) +
+                                      carry;
+      chunks[k] = (uint32_t)(value % 1000000000);
+      carry = value / 1000000000;
+    }
+    out[limb] = (uint64_t)carry;
+  }
+  return true;
+}
+
+static bool parsePalette(const char *text, std::vector<uint32_t> &palette) {
+  palette.clear();
+  const char *p = text;
+  while (*p != '\0') {
+    char *end;
+    palette.push_back((uint32_t)strtoul(p, &end, 16));
+    if (end == p || (*end != ',' && *end != '\0')) {
+      return false;
+    }
+    p = *end == ',' ? end + 1 : end;
+  }
+  return palette.size() >= 2 && palette.size() <= MAX_PALETTE;
+}
+
+static bool parseOptions(int argc, char **argv, Options &o) {
+  bool format = false;
+  for (int k = 1; k < argc; k++) {
+    const char *a = argv[k];
+    const int left = argc - k - 1;
+    if (!strcmp(a, "-type") && left >= 1) {
+      o.type = atoi(argv[++k]);
+    } else if (!strcmp(a, "-size") && left >= 1) {
+      if (sscanf(argv[++k], "%dx%d", &o.w, &o.h) != 2) {
+        return false;
+      }
+    } else if (!strcmp(a, "-center") && left >= 2) {
+      o.x = argv[++k];
+      o.y = argv[++k];
+    } else if (!strcmp(a, "-width") && left >= 1) {
+      o.width = atof(argv[++k]);
+    } else if (!strcmp(a, "-julia") && left >= 2) {
+      o.juliaX = atof(argv[++k]);
+      o.juliaY = atof(argv[++k]);
+    } else if (!strcmp(a, "-iterations") && left >= 1) {
+      o.iterations = atoi(argv[++k]);
+    } else if (!strcmp(a, "-palette") && left >= 1) {
+      if (!parsePalette(argv[++k], o.palette)) {
+        return false;
+      }
+    } else if (!strcmp(a, "-interior") && left >= 1) {
+      o.interior = (uint32_t)strtoul(argv[++k], nullptr, 16);
+    } else if (!strcmp(a, "-mode") && left >= 1) {
+      o.renderMode = atoi(argv[++k]);
+    } else if (!strcmp(a, "-shading") && left >= 1) {
+      o.shading = atoi(argv[++k]);
+    } else if (!strcmp(a, "-speed") && left >= 1) {
+      o.speed = (float)atof(argv[++k]);
+    } else if (!strcmp(a, "-flow") && left >= 1) {
+      o.flow = (float)atof(argv[++k]);
+    } else if (!strcmp(a, "-flags") && left >= 1) {
+      o.flags = atoi(argv[++k]);
+    } else if (!strcmp(a, "-antialias")) {
+      o.antialias = true;
+    } else if (!strcmp(a, "-accumulate") && left >= 1) {
+      o.accumulate = atoi(argv[++k]);
+    } else if (!strcmp(a, "-cycle") && left >= 1) {
+      o.cycle = atoi(argv[++k]);
+    } else if (!strcmp(a, "-threads") && left >= 1) {
+      o.threads = atoi(argv[++k]);
+    } else if (!strcmp(a, "-band") && left >= 1) {
+      o.band = atoi(argv[++k]);
+    } else if (!strcmp(a, "-tile") && left >= 1) {
+      o.tile = atoi(argv[++k]);
+    } else if (!strcmp(a, "-repeat") && left >= 1) {
+      o.repeat = atoi(argv[++k]);
+    } else if (!strcmp(a, "-o") && left >= 1) {
+      o.output = argv[++k];
+    } else if (!strcmp(a, "-to") && left >= 3) {
+      o.toX = argv[++k];
+      o.toY = argv[++k];
+      o.toWidth = atof(argv[++k]);
+    } else if (!strcmp(a, "-factor") && left >= 1) {
+      o.factor = atof(argv[++k]);
+    } else if (!strcmp(a, "-format") && left >= 1) {
+      const char *f = argv[++k];
+      o.format = !strcmp(f, "png")   ? FORMAT_PNG
+                 : !strcmp(f, "raw") ? FORMAT_RAW
+                                     : FORMAT_PPM;
+      format = true;
+    } else {
+      return false;
+    }
+  }
+  if (o.output != nullptr && !strcmp(o.output, "-")) {
+    o.format = FORMAT_STREAM;
+  } else if (o.output != nullptr && !format) {
+    const char *dot = strrchr(o.output, '.');
+    if (dot != nullptr && !strcmp(dot, ".png")) {
+      o.format = FORMAT_PNG;
+    } else if (dot != nullptr && !strcmp(dot, ".raw")) {
+      o.format = FORMAT_RAW;
+    }
+  }
+  if (o.palette.empty()) {
+    o.palette.assign(std::begin(defaultPalette), std::end(defaultPalette));
+  }
+  if (o.toX != nullptr && (o.toWidth <= 0.0 || o.toWidth >= o.width ||
+                           o.factor <= 1.0 || o.tile > 0 || o.band > 0)) {
+    return false;
+  }
+  if (o.format == FORMAT_STREAM && o.tile > 0) {
+    return false; // The tiles wouldn't come in order
+  }
+  return o.w > 0 && o.h > 0 && o.iterations > 0 && o.repeat > 0 &&
+         o.band >= 0 && o.tile >= 0 && o.width > 0.0;
+}
+
+// -----
+// Output files! Tiles can finish in any order, so every format is laid out
+// with fixed offsets and each tile is written in place as soon as it's done.
+
+static void writeBigEndian(unsigned char *out, uint32_t value) {
+  out[0] = value >> 24;
+  out[1] = value >> 16;
+  out[2] = value >> 8;
+  out[3] = value;
+}
+
+static uint32_t crc32(uint32_t crc, const unsigned char *data, size_t size) {
+  static uint32_t table[256];
+  if (table[1] == 0) {
+    for (uint32_t n = 0; n < 256; n++) {
+      uint32_t c = n;
+      for (int k = 0; k < 8; k++) {
+        c = (c & 1) ? 0xedb88320 ^ (c >> 1) : c >> 1;
+      }
+      table[n] = c;
+    }
+  }
+  crc = ~crc;
+  for (size_t k = 0; k < size; k++) {
+    crc = table[(crc ^ data[k]) & 255] ^ (crc >> 8);
+  }
+  return ~crc;
+}
+
+static void writeChunk(FILE *file, const char *type,
+                       const std::vector<unsigned char> &data) {
+  unsigned char header[8];
+  writeBigEndian(header, (uint32_t)data.size());
+  memcpy(header + 4, type, 4);
+  fwrite(header, 1, 8, file);
+  fwrite(data.data(), 1, data.size(), file);
+  uint32_t crc = crc32(0, header + 4, 4);
+  crc = crc32(crc, data.data(), data.size());
+  unsigned char footer[4];
+  writeBigEndian(footer, crc);
+  fwrite(footer, 1, 4, file);
+}
+
+// PNG rows are stored deflate blocks (so no libraries are needed), each row
+// in its own IDAT chunk. That puts every pixel at a known offset; the
+// checksums, which need the rows in order, get filled in by end().
+constexpr int64_t STORED_BLOCK = 65535;
+
+struct Output {
+  FILE *file;
+  Format format;
+  int64_t w;
+  int64_t h;
+  int64_t header; // Bytes before the first pixel (or PNG row)
+
+  int64_t rowBytes() const { return w * 3 + 1; } // With the filter byte
+  int64_t rowChunk() const {
+    const int64_t blocks = (rowBytes() + STORED_BLOCK - 1) / STORED_BLOCK;
+    return 12 + rowBytes() + blocks * 5;
+  }
+
+  void begin() {
+    if (format == FORMAT_PPM) {
+      header = fprintf(file, "P6\n%lld %lld\n255\n", (long long)w,
+                       (long long)h);
+    } else if (format == FORMAT_PNG) {
+      static const unsigned char signature[8] = {0x89, 'P',  'N',  'G',
+                                                 '\r', '\n', 0x1a, '\n'};
+      fwrite(signature, 1, 8, file);
+      std::vector<unsigned char> ihdr(13);
+      writeBigEndian(ihdr.data(), (uint32_t)w);
+      writeBigEndian(ihdr.data() + 4, (uint32_t)h);
+      ihdr[8] = 8; // Bits per channel
+      ihdr[9] = 2; // RGB
+      writeChunk(file, "IHDR", ihdr);
+      writeChunk(file, "IDAT", {0x78, 0x01}); // The zlib header
+      header = 8 + 25 + 14;
+    } else {
+      header = 0;
+    }
+  }
+
+  // Writes the RGB bytes for pixel x and on of row y.
+  void writeRGB(int64_t y, int64_t x, const unsigned char *rgb, int64_t size) {
+    if (format == FORMAT_STREAM) {
+      fwrite(rgb, 1, size, file); // Everything comes in order
+      return;
+    }
+    if (format == FORMAT_PPM) {
+      fseeko(file, header + (y * w + x) * 3, SEEK_SET);
+      fwrite(rgb, 1, size, file);
+      return;
+    }
+    // Skip over the headers of the stored blocks.
+    const int64_t row = header + y * rowChunk() + 8;
+    for (int64_t i = 1 + x * 3; size > 0;) {
+      const int64_t block = i / STORED_BLOCK;
+      const int64_t run = std::min(size, (block + 1) * STORED_BLOCK - i);
+      fseeko(file, row + i + (block + 1) * 5, SEEK_SET);
+      fwrite(rgb, 1, run, file);
+      rgb += run;
+      size -= run;
+      i += run;
+    }
+  }
+
+  // Writes a tile at (x0, y0) from its colors and iteration data.
+  void writeTile(int64_t x0, int64_t y0, int tw, int th, const uint32_t *colors,
+                 const float *iters, const float *shading) {
+    if (format == FORMAT_RAW) {
+      // Iterations for the whole image, then shading, like in memory.
+      for (int y = 0; y < th; y++) {
+        const int64_t i = (y0 + y) * w + x0;
+        fseeko(file, i * 4, SEEK_SET);
+        fwrite(iters + (int64_t)y * tw, 4, tw, file);
+        fseeko(file, (w * h + i) * 4, SEEK_SET);
+        fwrite(shading + (int64_t)y * tw, 4, tw, file);
+      }
+      return;
+    }
+    // The colors are RGBA bytes, like the canvas uses them.
+    std::vector<unsigned char> rgb((size_t)tw * 3);
+    for (int y = 0; y < th; y++) {
+      for (int x = 0; x < tw; x++) {
+        const uint32_t c = colors[(int64_t)y * tw + x];
+        rgb[x * 3] = c & 255;
+        rgb[x * 3 + 1] = (c >> 8) & 255;
+        rgb[x * 3 + 2] = (c >> 16) & 255;
+      }
+      writeRGB(y0 + y, x0, rgb.data(), tw * 3);
+    }
+  }
+
+  // Fills in the PNG block headers and checksums a row at a time, then ends
+  // the zlib stream.
+  void end() {
+    if (format != FORMAT_PNG) {
+      return;
+    }
+    const int64_t size = rowChunk();
+    std::vector<unsigned char> chunk(size);
+    uint32_t adlerA = 1;
+    uint32_t adlerB = 0;
+    for (int64_t y = 0; y < h; y++) {
+      const int64_t start = header + y * size;
+      std::fill(chunk.begin(), chunk.end(), 0);
+      fseeko(file, start, SEEK_SET);
+      if (fread(chunk.data(), 1, size, file) == 0 && ferror(file)) {
+        return;
+      }
+      writeBigEndian(chunk.data(), (uint32_t)(size - 12));
+      memcpy(chunk.data() + 4, "IDAT", 4);
+      chunk[8 + 5] = 0; // No filter
+      unsigned char *out = chunk.data() + 8;
+      for (int64_t i = 0; i < rowBytes(); i += STORED_BLOCK) {
+        const uint32_t length =
+            (uint32_t)std::min(STORED_BLOCK, rowBytes() - i);
+        out[0] = 0; // Not the last block
+        out[1] = length & 255;
+        out[2] = length >> 8;
+        out[3] = ~length & 255;
+        out[4] = (~length >> 8) & 255;
+        for (uint32_t n = 0; n < length; n += 5552) {
+          const uint32_t end = std::min(length, n + 5552);
+          for (uint32_t k = n; k < end; k++) {
+            adlerA += out[5 + k];
+            adlerB += adlerA;
+          }
+          adlerA %= 65521;
+          adlerB %= 65521;
+        }
+        out += 5 + length;
+      }
+      writeBigEndian(out, crc32(0, chunk.data() + 4, size - 8));
+      fseeko(file, start, SEEK_SET);
+      fwrite(chunk.data(), 1, size, file);
+    }
+    std::vector<unsigned char> last = {1, 0, 0, 0xff, 0xff, 0, 0, 0, 0};
+    writeBigEndian(last.data() + 5, adlerB << 16 | adlerA);
+    writeChunk(file, "IDAT", last);
+    writeChunk(file, "IEND", {});
+  }
+};
+
+// Runs work(worker) on every thread at once and waits for all of them.
+template <typename F> static void onThreads(int threads, F work) {
+  std::vector<std::thread> pool;
+  for (int k = 0; k < threads; k++) {
+    pool.emplace_back(work, k);
+  }
+  for (std::thread &t : pool) {
+    t.join();
+  }
+}
+
+static double secondsSince(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                       start)
+      .count();
+}
+
+// The same table as writeShadingLUT() in main.js: every sRGB channel value
+// darkened by every amount from 0 to 255 in linear light.
+static void writeShadingLUT(uint8_t *shades) {
+  for (int value = 0; value < 256; value++) {
+    // A Float32Array in main.js
+    const double srgb = value / 255.0;
+    const float linear = srgb > 0.04045 ? pow((srgb + 0.055) / 1.055, 2.4)
+                                        : srgb / 12.92;
+    for (int amount = 0; amount < 256; amount++) {
+      const double shaded = linear * (1.0 - amount / 255.0);
+      const double result = shaded > 0.0031308
+                                ? 1.055 * pow(shaded, 1 / 2.4) - 0.055
+                                : 12.92 * shaded;
+      shades[value * 256 + amount] =
+          (uint8_t)std::round(std::clamp(result, 0.0, 1.0) * 255);
+    }
+  }
+}
+
+struct Timing {
+  double run = 0.0;
+  double render = 0.0;
+  double antialias = 0.0;
+  double accumulate = 0.0;
+  double cycle = 0.0;
+};
+
+// Calculates a w by h frame (with its Decimal slots already written) like
+// the workers do, then colors it (and antialiases it and adds -accumulate
+// samples, like main.js does after a screen is done).
+static void renderFrame(const Options &o, int threads, int paletteLen, int w,
+                        int h, double posX, double posY, double zoom,
+                        Timing &timing) {
+  std::atomic<int> *counter = reinterpret_cast<std::atomic<int> *>(memoryBase);
+  auto start = std::chrono::steady_clock::now();
+  onThreads(threads, [&](int worker) {
+    while (run(o.type, w, h, posX, posY, zoom, INT_MAX, o.iterations,
+               paletteLen, o.interior, o.renderMode, o.shading, o.speed,
+               o.flow, o.juliaX, o.juliaY, o.flags, worker, threads) != -1) {
+    }
+  });
+  timing.run += secondsSince(start);
+
+  counter->store(0);
+  start = std::chrono::steady_clock::now();
+  onThreads(threads, [&](int) {
+    render(w * h, paletteLen, o.interior, o.renderMode, o.shading, o.speed,
+           o.flow, 0);
+  });
+  timing.render += secondsSince(start);
+
+  if (o.cycle > 0) {
+    // Flowing colors like main.js does (from the saved palette positions),
+    // ending up back at -flow.
+    start = std::chrono::steady_clock::now();
+    for (int frame = 1; frame <= o.cycle; frame++) {
+      const float flow = frame == o.cycle ? o.flow : o.flow + frame / 120.0f;
+      counter->store(0);
+      onThreads(threads, [&](int) {
+        render(w * h, paletteLen, o.interior, o.renderMode, o.shading, o.speed,
+               flow, 1);
+      });
+    }
+    timing.cycle += secondsSince(start);
+  }
+
+  if (o.antialias) {
+    counter->store(0);
+    start = std::chrono::steady_clock::now();
+    onThreads(threads, [&](int worker) {
+      while (run(o.type, w, h, posX, posY, zoom, INT_MAX, o.iterations,
+                 paletteLen, o.interior, o.renderMode, o.shading, o.speed,
+                 o.flow, o.juliaX, o.juliaY, o.flags | RUN_ANTIALIAS, worker,
+                 threads) != -1) {
+      }
+    });
+    timing.antialias += secondsSince(start);
+  }
+
+  if (o.accumulate > 0) {
+    start = std::chrono::steady_clock::now();
+    memset(reinterpret_cast<void *>(
+               memoryBase + Mem::accumulationStart(w * h, o.iterations)),
+           0, (size_t)w * h * 16);
+    int *passes = reinterpret_cast<int *>(memoryBase + Mem::AccumulatePasses);
+    for (int pass = 0; pass < o.accumulate; pass++) {
+      *passes = pass;
+      counter->store(0);
+      onThreads(threads, [&](int worker) {
+        while (run(o.type, w, h, posX, posY, zoom, INT_MAX, o.iterations,
+                   paletteLen, o.interior, o.renderMode, o.shading, o.speed,
+                   o.flow, o.juliaX, o.juliaY, o.flags | RUN_ACCUMULATE,
+                   worker, threads) != -1) {
+        }
+      });
+    }
+    timing.accumulate += secondsSince(start);
+  }
+}
+
+// Opens the output for one image (or frame), or returns false.
+static bool openOutput(const Options &o, const char *name, Output &output) {
+  output = Output{nullptr, o.format, o.w, o.h, 0};
+  if (o.format == FORMAT_STREAM) {
+    output.file = stdout;
+  } else {
+    // PNGs get read back to fill in the checksums.
+    output.file = fopen(name, o.format == FORMAT_PNG ? "wb+" : "wb");
+    if (output.file == nullptr) {
+      fprintf(stderr, "Couldn't open %s\n", name);
+      return false;
+    }
+  }
+  output.begin();
+  return true;
+}
+
+static void closeOutput(Output &output) {
+  output.end();
+  if (output.file == stdout) {
+    fflush(stdout);
+  } else {
+    fclose(output.file);
+  }
+}
+
+// Renders a zoom video from the center and width in the options to -to,
+// zooming in by -factor every frame (the last one can be less). The center
+// moves along with the zoom, so that the screen keeps moving the same amount
+// relative to its size.
+//
+// The reference orbit is only recalculated when main.js would (when the zoom
+// needs more limbs or the center moves too far from it). And with a whole
+// number factor, every factor x factor block of pixels contains one that was
+// in the frame before: the corner is rounded to the old pixel grid so they
+// line up exactly, and run() skips the pixels that already have data.
+static int renderVideo(const Options &o, int threads, int paletteLen,
+                       const uint64_t *startX, const uint64_t *startY) {
+  uint64_t endX[DECIMAL_LIMBS];
+  uint64_t endY[DECIMAL_LIMBS];
+  if (!parseDecimal(o.toX, endX) || !parseDecimal(o.toY, endY)) {
+    usage();
+    return 1;
+  }
+  const int w = o.w;
+  const int h = o.h;
+  const int pixels = w * h;
+  uint32_t *limbCount =
+      reinterpret_cast<uint32_t *>(memoryBase + Mem::LimbCount);
+  std::atomic<int> *referenceState =
+      reinterpret_cast<std::atomic<int> *>(memoryBase + Mem::ReferenceState);
+  float *iters = reinterpret_cast<float *>(memoryBase + Mem::PixelDataStart);
+  float *shading = iters + pixels;
+  const uint32_t *colors = reinterpret_cast<uint32_t *>(shading + pixels);
+  uint64_t *slots =
+      reinterpret_cast<uint64_t *>(memoryBase + Mem::DecimalStorage);
+
+  // The adds and subtracts here need all the limbs, whatever the reference
+  // was calculated with.
+  *limbCount = 0;
+  uint64_t difference[DECIMAL_LIMBS];
+  subtract(startX, endX, difference);
+  const double moveX = toDouble(difference);
+  subtract(startY, endY, difference);
+  const double moveY = toDouble(difference);
+
+  const double startZoom = o.width / w;
+  const double endZoom = o.toWidth / w;
+  const double diagonal = sqrt((double)w * w + (double)h * h);
+  std::vector<float> previous((size_t)pixels * 2);
+  uint64_t cornerX[DECIMAL_LIMBS];
+  uint64_t cornerY[DECIMAL_LIMBS];
+  uint64_t referenceX[DECIMAL_LIMBS];
+  uint64_t referenceY[DECIMAL_LIMBS];
+  uint64_t offset[DECIMAL_LIMBS];
+  double referenceZoom = 0.0;
+  double previousZoom = 0.0;
+  Timing total;
+  const auto start = std::chrono::steady_clock::now();
+
+  int frame = 0;
+  for (double zoom = startZoom;; frame++) {
+    *limbCount = 0;
+    // Where the corner would be without lining the pixels up
+    const double along = (zoom - endZoom) / (startZoom - endZoom);
+    uint64_t idealX[DECIMAL_LIMBS];
+    uint64_t idealY[DECIMAL_LIMBS];
+    fromDouble(moveX * along - w * 0.5 * zoom, offset);
+    add(endX, offset, idealX);
+    fromDouble(moveY * along - h * 0.5 * zoom, offset);
+    add(endY, offset, idealY);
+
+    const double ratio = previousZoom / zoom;
+    const int factor = (int)(ratio + 0.5);
+    const bool reuse = frame > 0 && factor >= 2 && fabs(ratio - factor) < 1e-9;
+    int64_t shiftX = 0;
+    int64_t shiftY = 0;
+    if (reuse) {
+      subtract(idealX, cornerX, difference);
+      shiftX = llround(toDouble(difference) / previousZoom);
+      subtract(idealY, cornerY, difference);
+      shiftY = llround(toDouble(difference) / previousZoom);
+      fromDouble(shiftX * previousZoom, offset);
+      add(cornerX, offset, slots + SLOT_CORNER_X * DECIMAL_LIMBS);
+      fromDouble(shiftY * previousZoom, offset);
+      add(cornerY, offset, slots + SLOT_CORNER_Y * DECIMAL_LIMBS);
+    } else {
+      memcpy(slots + SLOT_CORNER_X * DECIMAL_LIMBS, idealX, sizeof(idealX));
+      memcpy(slots + SLOT_CORNER_Y * DECIMAL_LIMBS, idealY, sizeof(idealY));
+    }
+    memcpy(cornerX, slots + SLOT_CORNER_X * DECIMAL_LIMBS, sizeof(cornerX));
+    memcpy(cornerY, slots + SLOT_CORNER_Y * DECIMAL_LIMBS, sizeof(cornerY));
+
+    // Same checks as prepareReference() in main.js
+    bool newReference = false;
+    if (zoom < PERTURBATION_ZOOM) {
+      uint64_t centerX[DECIMAL_LIMBS];
+      uint64_t centerY[DECIMAL_LIMBS];
+      fromDouble(w * 0.5 * zoom, offset);
+      add(cornerX, offset, centerX);
+      fromDouble(h * 0.5 * zoom, offset);
+      add(cornerY, offset, centerY);
+      subtract(centerX, referenceX, difference);
+      const double distanceX = toDouble(difference);
+      subtract(centerY, referenceY, difference);
+      const double distanceY = toDouble(difference);
+      newReference = referenceZoom == 0.0 || zoom > referenceZoom ||
+                     limbsNeeded(zoom) > limbsNeeded(referenceZoom) ||
+                     hypot(distanceX, distanceY) > zoom * diagonal * 0.5;
+      if (newReference) {
+        // The end of the video stays the same distance from the center
+        // relative to the screen, so a reference there lasts until the zoom
+        // needs more limbs. (A reference at the center would be too far
+        // away a few frames later.)
+        subtract(endX, centerX, difference);
+        const double endDistanceX = toDouble(difference);
+        subtract(endY, centerY, difference);
+        const double endDistanceY = toDouble(difference);
+        const bool atEnd =
+            hypot(endDistanceX, endDistanceY) <= zoom * diagonal * 0.5;
+        memcpy(referenceX, atEnd ? endX : centerX, sizeof(referenceX));
+        memcpy(referenceY, atEnd ? endY : centerY, sizeof(referenceY));
+        memcpy(slots + SLOT_CENTER_X * DECIMAL_LIMBS, referenceX,
+               sizeof(referenceX));
+        memcpy(slots + SLOT_CENTER_Y * DECIMAL_LIMBS, referenceY,
+               sizeof(referenceY));
+        referenceZoom = zoom;
+        referenceState->store(ReferenceStale);
+      }
+    }
+    // Everything else in the header starts over, like setPixel(0).
+    memset(reinterpret_cast<void *>(memoryBase), 0, 4);
+    memset(reinterpret_cast<void *>(memoryBase + Mem::SeriesState), 0, 16);
+
+    memset(iters, 0, (size_t)pixels * 12);
+    int64_t reused = 0;
+    if (reuse) {
+      // Pixel (x, y) is at old pixel (x / factor + shiftX, y / factor +
+      // shiftY) when both divide evenly.
+      for (int y = 0; y < h; y += factor) {
+        const int64_t oldY = y / factor + shiftY;
+        if (oldY < 0 || oldY >= h) {
+          continue;
+        }
+        for (int x = 0; x < w; x += factor) {
+          const int64_t oldX = x / factor + shiftX;
+          if (oldX >= 0 && oldX < w) {
+            const int64_t i = oldY * w + oldX;
+            iters[y * w + x] = previous[i];
+            shading[y * w + x] = previous[pixels + i];
+            reused++;
+          }
+        }
+      }
+    }
+
+    const double posX = toDouble(slots + SLOT_CORNER_X * DECIMAL_LIMBS);
+    const double posY = toDouble(slots + SLOT_CORNER_Y * DECIMAL_LIMBS);
+    Timing timing;
+    renderFrame(o, threads, paletteLen, w, h, posX, posY, zoom, timing);
+    memcpy(previous.data(), iters, (size_t)pixels * 8);
+    total.run += timing.run;
+    total.render += timing.render;
+    fprintf(stderr,
+            "frame %d: width %.3e, run %.3fs, render %.3fs, %.1f%% reused%s\n",
+            frame, zoom * w, timing.run, timing.render,
+            100.0 * reused / pixels, newReference ? ", new reference" : "");
+
+    if (o.output != nullptr) {
+      char name[4096];
+      snprintf(name, sizeof(name), o.output, frame);
+      Output output;
+      if (!openOutput(o, name, output)) {
+        return 1;
+      }
+      output.writeTile(0, 0, w, h, colors, iters, shading);
+      closeOutput(output);
+    }
+
+    if (zoom <= endZoom) {
+      break;
+    }
+    previousZoom = zoom;
+    zoom = std::max(zoom / o.factor, endZoom);
+  }
+  fprintf(stderr, "%d frames in %.3fs (run %.3fs, render %.3fs)\n", frame + 1,
+          secondsSince(start), total.run, total.render);
+  return 0;
+}
+
+int main(int argc, char **argv) {
+  Options o;
+  uint64_t centerX[DECIMAL_LIMBS];
+  uint64_t centerY[DECIMAL_LIMBS];
+  if (argc == 1) {
+    usage();
+    return 0;
+  }
+  if (!parseOptions(argc, argv, o) || !parseDecimal(o.x, centerX) ||
+      !parseDecimal(o.y, centerY)) {
+    usage();
+    return 1;
+  }
+  const int threads =
+      o.threads > 0 ? o.threads
+                    : std::max(1, (int)std::thread::hardware_concurrency());
+  const double zoom = o.width / o.w;
+  // Every tile is its own run(), so only one tile's data is in memory at a
+  // time. Without -tile they're bands of whole rows, and videos are whole
+  // frames.
+  const int tileW = o.tile > 0 ? std::min(o.tile, o.w) : o.w;
+  const int tileH =
+      o.toX != nullptr ? o.h
+      : o.tile > 0     ? std::min(o.tile, o.h)
+      : o.band > 0     ? std::min(o.band, o.h)
+                   : (int)std::max<int64_t>(
+                         1, std::min<int64_t>(o.h, BAND_BYTES / (o.w * 16LL)));
+  if ((int64_t)tileW * tileH > INT_MAX / 16) {
+    fprintf(stderr, "The tiles are too big; use a smaller -band or -tile\n");
+    return 1;
+  }
+
+  // The per-pixel data of a tile, then room for the reference orbit and BLA
+  // table like main.js makes for perturbation.
+  const int pixels = tileW * tileH;
+  const size_t size = Mem::accumulationStart(pixels, o.iterations) +
+                      (o.accumulate > 0 ? (size_t)pixels * 16 : 0);
+  void *memory = std::calloc(size, 1);
+  if (memory == nullptr) {
+    fprintf(stderr, "Couldn't allocate %zu bytes\n", size);
+    return 1;
+  }
+  memoryBase = (uintptr_t)memory;
+  float *iters = reinterpret_cast<float *>(memoryBase + Mem::PixelDataStart);
+  uint64_t *slots =
+      reinterpret_cast<uint64_t *>(memoryBase + Mem::DecimalStorage);
+
+  writeShadingLUT(reinterpret_cast<uint8_t *>(memoryBase + Mem::ShadingLUT));
+
+  // Same setup as setupPalettes() in main.js
+  uint32_t *palette =
+      reinterpret_cast<uint32_t *>(memoryBase + Mem::PaletteData);
+  const int paletteLen = (int)o.palette.size();
+  memcpy(palette, o.palette.data(), paletteLen * sizeof(uint32_t));
+  palette[0] ^= 0xff000000;
+  palette[paletteLen] = palette[0];
+
+  if (o.toX != nullptr) {
+    const int result = renderVideo(o, threads, paletteLen, centerX, centerY);
+    std::free(memory);
+    return result;
+  }
+
+  for (int pass = 0; pass < o.repeat; pass++) {
+    Output output{nullptr, o.format, o.w, o.h, 0};
+    if (o.output != nullptr && pass == o.repeat - 1 &&
+        !openOutput(o, o.output, output)) {
+      return 1;
+    }
+
+    Timing timing;
+    for (int64_t y0 = 0; y0 < o.h; y0 += tileH) {
+      for (int64_t x0 = 0; x0 < o.w; x0 += tileW) {
+        const int tw = (int)std::min<int64_t>(tileW, o.w - x0);
+        const int th = (int)std::min<int64_t>(tileH, o.h - y0);
+        // Start over like main.js does after a zoom (with the reference orbit
+        // marked as stale and all the limbs in use again).
+        memset(reinterpret_cast<void *>(memoryBase), 0, 32);
+        memset(iters, 0, (size_t)tw * th * 12);
+
+        // The tile's own center for the reference orbit and its top-left
+        // pixel, as offsets from the center of the image.
+        uint64_t offset[DECIMAL_LIMBS];
+        fromDouble((x0 + tw * 0.5 - o.w * 0.5) * zoom, offset);
+        add(centerX, offset, slots + SLOT_CENTER_X * DECIMAL_LIMBS);
+        fromDouble((y0 + th * 0.5 - o.h * 0.5) * zoom, offset);
+        add(centerY, offset, slots + SLOT_CENTER_Y * DECIMAL_LIMBS);
+        fromDouble((x0 - o.w * 0.5) * zoom, offset);
+        add(centerX, offset, slots + SLOT_CORNER_X * DECIMAL_LIMBS);
+        fromDouble((y0 - o.h * 0.5) * zoom, offset);
+        add(centerY, offset, slots + SLOT_CORNER_Y * DECIMAL_LIMBS);
+        const double posX = toDouble(slots + SLOT_CORNER_X * DECIMAL_LIMBS);
+        const double posY = toDouble(slots + SLOT_CORNER_Y * DECIMAL_LIMBS);
+        renderFrame(o, threads, paletteLen, tw, th, posX, posY, zoom, timing);
+
+        if (output.file != nullptr) {
+          const float *shading = iters + tw * th;
+          const uint32_t *colors =
+              reinterpret_cast<const uint32_t *>(shading + tw * th);
+          output.writeTile(x0, y0, tw, th, colors, iters, shading);
+        }
+      }
+    }
+    fprintf(stderr,
+            "run %.3fs, render %.3fs, antialias %.3fs, accumulate %.3fs (%d "
+            "threads, %dx%d tiles)\n",
+            timing.run, timing.render, timing.antialias, timing.accumulate,
+            threads, tileW, tileH);
+    if (o.cycle > 0) {
+      fprintf(stderr, "flowing colors %.2fms per frame\n",
+              timing.cycle * 1000.0 / o.cycle);
+    }
+
+    if (output.file != nullptr) {
+      closeOutput(output);
+    }
+  }
+  std::free(memory);
+  return 0;
+}
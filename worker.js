@@ -1,6 +1,8 @@
 "use strict";
 var workerID = -1,
   memory = null,
+  memoryBase = 0,
+  stackPointer = 0,
   buffer = null,
   handlePixels = null,
   handleRender = null;
@@ -11,6 +13,8 @@ onmessage = (e) => {
   }
   if (data.mem) {
     memory = data.mem;
+    memoryBase = data.memoryBase;
+    stackPointer = data.stackPointer;
     if (typeof memory === "number") {
       // This is a number, meaning that shared web workers aren't being used. Therefore, this worker needs to make its own WebAssmbly.Memory instance.
       memory = new WebAssembly.Memory({
@@ -34,6 +38,12 @@ function setupWorker() {
   WebAssembly.instantiateStreaming(fetch("fractal.wasm"), {
     env: {
       memory: memory,
+      __memory_base: memoryBase,
+      __table_base: 0,
+      __stack_pointer: new WebAssembly.Global(
+        { value: "i32", mutable: true },
+        stackPointer,
+      ),
     },
   }).then((result) => {
     handlePixels = result.instance.exports.run;